@@ -4,7 +4,7 @@
 #include <string>
 #include <memory>
 #include <list>
-#include <functional> // std::function
+#include <vector>
 #include <fmt/format.h>
 #include "traits.hpp"
 #include "params.hpp"
@@ -33,9 +33,6 @@ class Algo {
    virtual std::string rho_type() { return ""; } // what rho type is required
 };
 
-using FactorFnc = std::function<double(const Invar &, const Invar &)>;
-using CheckFnc = std::function<bool(const Invar &, const Invar &, int)>;
-
 // All information about calculating a spectral function: pointers to the operator data, raw spectral data
 // acccumulators, algorithm, etc.
 template <scalar S>
@@ -45,23 +42,20 @@ class BaseSpectrum {
    int spin{};                      // -1 or +1, or 0 where irrelevant
    using spAlgo = std::shared_ptr<Algo<S>>;
    spAlgo algo;      // Algo_FDM, Algo_DMNRG,...
-   FactorFnc ff;
-   CheckFnc cf;
-   BaseSpectrum(const MatrixElements<S> &op1, const MatrixElements<S> &op2, const int spin, spAlgo algo, FactorFnc ff, CheckFnc cf) :
-     op1(op1), op2(op2), spin(spin), algo(algo), ff(ff), cf(cf) {}
+   SpecFactor kind;  // symmetry factor
+   BaseSpectrum(const MatrixElements<S> &op1, const MatrixElements<S> &op2, const int spin, spAlgo algo, const SpecFactor kind) :
+     op1(op1), op2(op2), spin(spin), algo(algo), kind(kind) {}
    // Calculate (finite temperature) spectral function 1/Pi Im << op1^\dag(t) op2(0) >>. Required spin direction is
    // determined by 'SPIN'. For SPIN=0 both spin direction are equivalent. For QSZ, we need to differentiate the two.
    void calc(const Step &step, const DiagInfo<S> &diag,
              const DensMatElements<S> &rho, const DensMatElements<S> &rhoFDM, const Stats<S> &stats, const Symmetry<S> *Sym, const Params &P) {
      algo->begin(step);
      const auto & rho_here = algo->rho_type() == "rhoFDM" ? rhoFDM : rho;
-     // Strategy: we loop through all subspace pairs and check whether they have non-zero irreducible matrix elements.
-     for(const auto &[Ii, diagi]: diag)
-       for(const auto &[Ij, diagj]: diag) {
-         const Twoinvar II {Ij,Ii};
-         if (op1.count(II) && op2.count(II) && cf(Ij, Ii, spin) && Sym->project_subspace(Ii, P.project) && Sym->project_subspace(Ij, P.project))
-           algo->calc(step, diagi, diagj, op1.at(II), op2.at(II), ff(Ii, Ij), Ii, Ij, rho_here, stats); // stats.Zft needed
-       }
+     // Strategy: we loop through the subspace pairs for which both operators have non-zero irreducible matrix elements,
+     // rather than through all pairs of subspaces. The pairs and their symmetry factors are determined by the symmetry
+     // class with static dispatch, see Symmetry::spectrum_blocks_impl().
+     for (const auto &b: Sym->spectrum_blocks(diag, op1, op2, kind, spin))
+       algo->calc(step, *b.diagi, *b.diagj, *b.m1, *b.m2, b.factor, *b.Ii, *b.Ij, rho_here, stats); // stats.Zft needed
      algo->end(step);
    }
 };
@@ -3,6 +3,7 @@
 
 #include <complex>
 #include <tuple>
+#include <utility>
 #include "traits.hpp"
 #include "algo.hpp"
 #include "spectrum.hpp"
@@ -11,7 +12,23 @@ namespace NRG {
 
 using namespace std::complex_literals;
 
-// OPTIMIZATION NOTE: the inner loop should involve the last index.
+// Contractions with the density matrices over the kept states, computed as matrix products of the kept blocks:
+// A(rj,rm) = sum_ri op2(rj,ri) rho_Ip(rm,ri) and B(rj,rm) = sum_ri rho_I1(rj,ri) conj(op1(ri,rm)).
+template<scalar S, typename Matrix = Matrix_traits<S>>
+auto dmnrg_contractions(const Eigen<S> &diagIp, const Eigen<S> &diagI1, const Matrix &op1, const Matrix &op2,
+                        const Matrix &rhoNIp, const Matrix &rhoNI1) {
+  const auto nm = diagIp.getnrkept();
+  const auto nj = diagI1.getnrkept();
+  const auto op1k = submatrix_const(op1, {0, nj}, {0, nm});
+  const auto op2k = submatrix_const(op2, {0, nj}, {0, nm});
+  const auto rhoIpk = submatrix_const(rhoNIp, {0, nm}, {0, nm});
+  const auto rhoI1k = submatrix_const(rhoNI1, {0, nj}, {0, nj});
+  Matrix A = op2k * rhoIpk.transpose();
+  Matrix B = rhoI1k * op1k.conjugate();
+  return std::make_pair(A, B);
+}
+
+// The inner loops run over the last index, rm, for sequential access to the (row-major) matrices.
 
 template<scalar S, typename Matrix = Matrix_traits<S>, typename t_coef = coef_traits<S>, typename t_eigen = eigen_traits<S>, typename t_weight = weight_traits<S>>
 class Algo_DMNRG : public Algo<S> {
@@ -29,25 +46,24 @@ class Algo_DMNRG : public Algo<S> {
    void calc(const Step &step, const Eigen<S> &diagIp, const Eigen<S> &diagI1, const Matrix &op1, const Matrix &op2,
              t_coef factor, const Invar &Ip, const Invar &I1, const DensMatElements<S> &rho, [[maybe_unused]] const Stats<S> &stats) override
    {
-     const auto weights = [Emin = step.scale() * P.getEmin(), Emax = step.scale() * P.getEmax(), &rhoNIp = rho.at(Ip), &rhoNI1 = rho.at(I1), &diagIp, &diagI1, &op1, &op2](const auto rm, const auto rj) {
+     const auto AB = dmnrg_contractions(diagIp, diagI1, op1, op2, rho.at(Ip), rho.at(I1));
+     const auto &A = AB.first;
+     const auto &B = AB.second;
+     const auto weights = [Emin = step.scale() * P.getEmin(), Emax = step.scale() * P.getEmax(), &A, &B, &diagIp, &diagI1, &op1, &op2](const auto rm, const auto rj) {
        const auto Em = diagIp.values.abs_zero(rm);
        const auto Ej = diagI1.values.abs_zero(rj);
        const auto energy = Ej-Em;
        if (abs(energy) < Emin || abs(energy) > Emax) return std::make_tuple(energy, t_weight{}, t_weight{}); // does not contribute
-       t_weight sumA{};
-       for (const auto ri: diagIp.kept()) sumA += op2(rj, ri) * rhoNIp(rm, ri); // rm <-> ri, rho symmetric
-       const auto weightA = sumA * conj_me(op1(rj, rm));
-       t_weight sumB{};
-       for (const auto ri: diagI1.kept()) sumB += conj_me(op1(ri, rm)) * rhoNI1(rj, ri); // non-optimal
-       const auto weightB = sumB * op2(rj, rm);
+       const auto weightA = t_weight(A(rj, rm)) * conj_me(op1(rj, rm));
+       const auto weightB = t_weight(B(rj, rm)) * op2(rj, rm);
        return std::make_tuple(energy, weightA, weightB);
      };
      const auto term = [&weights, this](const auto rm, const auto rj) {
        const auto [energy, weightA, weightB] = weights(rm, rj);
        return std::make_pair(energy, weightA + (-sign) * weightB);
      };
-     for (const auto rm: diagIp.kept())
-       for (const auto rj: diagI1.kept())
+     for (const auto rj: diagI1.kept())
+       for (const auto rm: diagIp.kept())
          cb->add(term(rm, rj), factor);
    }
    void end([[maybe_unused]] const Step &step) override {
@@ -75,16 +91,15 @@ class Algo_DMNRGmats : public Algo<S> {
    void calc([[maybe_unused]] const Step &step, const Eigen<S> &diagIp, const Eigen<S> &diagI1, const Matrix &op1, const Matrix &op2,
              t_coef factor, [[maybe_unused]] const Invar &Ip, [[maybe_unused]] const Invar &I1, const DensMatElements<S> &rho, [[maybe_unused]] const Stats<S> &stats) override
    {
-      const auto weights = [&rhoNIp = rho.at(Ip), &rhoNI1 = rho.at(I1), &diagIp, &diagI1, &op1, &op2](const auto rm, const auto rj) {
-         const auto Em = diagIp.values.abs_zero(rm);
-         const auto Ej = diagI1.values.abs_zero(rj);
-         t_weight sumA{};
-         for (const auto ri: diagIp.kept()) sumA += op2(rj, ri) * rhoNIp(rm, ri); // rm <-> ri, rho symmetric
-         const auto weightA = sumA * conj_me(op1(rj, rm));
-         t_weight sumB{};
-         for (const auto ri: diagI1.kept()) sumB += conj_me(op1(ri, rm)) * rhoNI1(rj, ri); // non-optimal
-         const auto weightB = sumB * op2(rj, rm);
-         return std::make_tuple(Ej-Em, weightA, weightB);
+     const auto AB = dmnrg_contractions(diagIp, diagI1, op1, op2, rho.at(Ip), rho.at(I1));
+     const auto &A = AB.first;
+     const auto &B = AB.second;
+     const auto weights = [&A, &B, &diagIp, &diagI1, &op1, &op2](const auto rm, const auto rj) {
+       const auto Em = diagIp.values.abs_zero(rm);
+       const auto Ej = diagI1.values.abs_zero(rj);
+       const auto weightA = t_weight(A(rj, rm)) * conj_me(op1(rj, rm));
+       const auto weightB = t_weight(B(rj, rm)) * op2(rj, rm);
+       return std::make_tuple(Ej-Em, weightA, weightB);
      };
      const auto term = [&weights, this](const auto rm, const auto rj, const auto n) {
        const auto [energy, weightA, weightB] = weights(rm, rj);
@@ -93,8 +108,8 @@ class Algo_DMNRGmats : public Algo<S> {
        else // bosonic w=0 && Em=Ej case
          return -weightA / t_weight(P.T);
      };
-     for (const auto rm: diagIp.kept())
-       for (const auto rj: diagI1.kept())
+     for (const auto rj: diagI1.kept())
+       for (const auto rm: diagIp.kept())
          for (size_t n = 0; n < P.mats; n++)
            cm->add(n, factor * term(rm, rj, n));
    }
@@ -0,0 +1,152 @@
+// async_io.hpp - background thread for reading and writing the workdir files
+// Copyright (C) 2009-2024 Rok Zitko
+
+#ifndef _async_io_hpp_
+#define _async_io_hpp_
+
+#include <deque>
+#include <map>
+#include <vector>
+#include <memory>
+#include <functional>
+#include <future>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <string>
+#include <iostream>
+#include <type_traits>
+
+#include "portabil.hpp" // my_assert
+
+#include <fmt/format.h>
+
+namespace NRG {
+
+// Single background thread which executes the I/O tasks in FIFO order. The queue is bounded: submit() blocks while
+// max_pending tasks are waiting, which limits the amount of memory held by the data not yet written. The pending
+// tasks are completed before the destructor returns.
+class IOThread {
+ private:
+   std::mutex mtx;
+   std::condition_variable cv;
+   std::deque<std::function<void()>> queue;
+   const size_t max_pending;
+   bool done = false;
+   std::thread worker;
+   void run() {
+     while (true) {
+       std::function<void()> task;
+       {
+         std::unique_lock lock(mtx);
+         cv.wait(lock, [this] { return done || !queue.empty(); });
+         if (queue.empty()) return;
+         task = std::move(queue.front());
+         queue.pop_front();
+       }
+       cv.notify_all();
+       task();
+     }
+   }
+ public:
+   explicit IOThread(const size_t max_pending = 2) : max_pending(max_pending), worker([this] { run(); }) {}
+   IOThread(const IOThread &) = delete;
+   IOThread(IOThread &&) = delete;
+   IOThread & operator=(const IOThread &) = delete;
+   IOThread & operator=(IOThread &&) = delete;
+   ~IOThread() {
+     {
+       std::lock_guard lock(mtx);
+       done = true;
+     }
+     cv.notify_all();
+     worker.join();
+   }
+   template <typename F> auto submit(F f) {
+     using R   = std::invoke_result_t<F>;
+     auto task = std::make_shared<std::packaged_task<R()>>(std::move(f));
+     auto res  = task->get_future();
+     {
+       std::unique_lock lock(mtx);
+       cv.wait(lock, [this] { return queue.size() < max_pending; });
+       queue.emplace_back([task] { (*task)(); });
+     }
+     cv.notify_all();
+     return res;
+   }
+};
+
+// A prefetched object is a hit if it has already been loaded when requested, otherwise the computation stalls until
+// the load completes. A miss is a request for an object which was not prefetched; it is loaded synchronously. Writes
+// block only if the queue is full. If the stall times are a significant fraction of the total run time, the
+// calculation is I/O bound.
+struct IOStats {
+  size_t hits = 0, stalls = 0, misses = 0, writes = 0;
+  double stall_time = 0, miss_time = 0, write_time = 0; // seconds spent waiting in the computing thread
+  void report(const std::string &name, std::ostream &F = std::cout) const {
+    F << fmt::format("[{}] I/O: hits={} stalls={} ({:.3f} s) misses={} ({:.3f} s) writes={} ({:.3f} s)",
+                     name, hits, stalls, stall_time, misses, miss_time, writes, write_time) << std::endl;
+  }
+};
+
+// Prefetching loader and asynchronous writer for the objects stored in the workdir per NRG step (eigenvectors,
+// density matrices). Steps are prefetched explicitly, typically the one which will be needed after the current
+// one. If not enabled, there is no background thread and all operations are performed in the calling thread. The
+// loader may be empty if the object is only used for writing.
+template <typename T>
+class AsyncStepIO {
+ private:
+   using clock = std::chrono::steady_clock;
+   std::function<T(size_t)> load;
+   std::unique_ptr<IOThread> io;
+   std::map<size_t, std::future<T>> pending;
+   std::vector<std::future<void>> written;
+   IOStats stats;
+   static double since(const clock::time_point start) { return std::chrono::duration<double>(clock::now() - start).count(); }
+ public:
+   AsyncStepIO(std::function<T(size_t)> load, const bool enabled, const size_t max_pending = 2) :
+     load(std::move(load)), io(enabled ? std::make_unique<IOThread>(max_pending) : nullptr) {}
+   void prefetch(const size_t N) {
+     if (!io || !load || pending.count(N)) return;
+     pending[N] = io->submit([f = load, N] { return f(N); });
+   }
+   T get(const size_t N) {
+     const auto start = clock::now();
+     if (auto it = pending.find(N); it != pending.end()) {
+       auto fut = std::move(it->second);
+       pending.erase(it);
+       if (fut.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+         stats.hits++;
+       } else {
+         fut.wait();
+         stats.stalls++;
+         stats.stall_time += since(start);
+       }
+       return fut.get(); // rethrows the exception from the loader, if any
+     }
+     my_assert(load);
+     auto obj = load(N);
+     stats.misses++;
+     stats.miss_time += since(start);
+     return obj;
+   }
+   template <typename F> void write(F f) {
+     const auto start = clock::now();
+     if (io)
+       written.push_back(io->submit(std::move(f)));
+     else
+       f();
+     stats.writes++;
+     stats.write_time += since(start);
+   }
+   void flush() { // wait for all writes to complete, rethrows the I/O errors
+     for (auto &w : written) w.get();
+     written.clear();
+   }
+   [[nodiscard]] const auto & statistics() const noexcept { return stats; }
+};
+
+} // namespace
+
+#endif
@@ -0,0 +1,94 @@
+// blas_gemm.hpp - general matrix-matrix products on Eigen matrices, blocks and maps
+// Copyright (C) 2009-2024 Rok Zitko
+
+#ifndef _blas_gemm_hpp_
+#define _blas_gemm_hpp_
+
+#include <type_traits>
+#include <complex>
+#include <cassert>
+#include <algorithm> // min
+
+#include <Eigen/Dense>
+
+#include "traits.hpp"
+#include "cblas.h"
+
+namespace NRG {
+
+// C = alpha op(A) op(B) + beta C, where op(X) is either X or X^\dag. Two implementations are provided: eigen_gemm()
+// evaluates the product using Eigen's own kernels, while blas_gemm() calls dgemm/zgemm from the BLAS library which
+// the program is linked with, so that the threading is controlled in the same way as for the LAPACK routines, see
+// set_blas_threads(). gemm() is the one selected at build time (cmake option BLAS_GEMM). The operands must be
+// row-major with unit inner stride, but they may be sub-blocks of larger matrices (e.g. the eigenvector blocks, see
+// class Blocks). C must not alias A or B. If beta is zero, C need not be initialized.
+enum class GemmOp { N, H };
+
+template<GemmOp op, typename MX> decltype(auto) gemm_op(const MX &X) {
+  if constexpr (op == GemmOp::N) return (X); else return X.adjoint();
+}
+
+template<GemmOp opA, GemmOp opB, typename MC, typename MA, typename MB, scalar S>
+void eigen_gemm(MC &&C, const S alpha, const MA &A, const MB &B, const S beta) {
+  if (beta == S(0))
+    C.setZero();
+  else if (beta != S(1))
+    C *= beta;
+  C.noalias() += alpha * gemm_op<opA>(A) * gemm_op<opB>(B);
+}
+
+template<GemmOp op> constexpr auto cblas_op() { return op == GemmOp::N ? CblasNoTrans : CblasConjTrans; }
+
+template<GemmOp opA, GemmOp opB, typename MC, typename MA, typename MB, scalar S>
+void blas_gemm(MC &&C, const S alpha, const MA &A, const MB &B, const S beta) {
+  static_assert(std::decay_t<MC>::IsRowMajor && MA::IsRowMajor && MB::IsRowMajor, "row-major storage required");
+  const auto m = int(C.rows());
+  const auto n = int(C.cols());
+  const auto k = int(opA == GemmOp::N ? A.cols() : A.rows());
+  assert(m == (opA == GemmOp::N ? A.rows() : A.cols()) && n == (opB == GemmOp::N ? B.cols() : B.rows()));
+  assert(k == (opB == GemmOp::N ? B.rows() : B.cols()));
+  assert(C.innerStride() == 1 && A.innerStride() == 1 && B.innerStride() == 1);
+  if (m == 0 || n == 0) return;
+  if (k == 0 || A.size() == 0 || B.size() == 0) { // leading dimensions would be invalid
+    eigen_gemm<opA, opB>(C, alpha, A, B, beta);
+    return;
+  }
+  const auto lda = int(A.outerStride()), ldb = int(B.outerStride()), ldc = int(C.outerStride());
+  if constexpr (std::is_same_v<S, double>)
+    cblas_dgemm(CblasRowMajor, cblas_op<opA>(), cblas_op<opB>(), m, n, k, alpha, A.data(), lda, B.data(), ldb, beta, C.data(), ldc);
+  else if constexpr (std::is_same_v<S, std::complex<double>>)
+    cblas_zgemm(CblasRowMajor, cblas_op<opA>(), cblas_op<opB>(), m, n, k, &alpha, A.data(), lda, B.data(), ldb, &beta, C.data(), ldc);
+  else
+    eigen_gemm<opA, opB>(C, alpha, A, B, beta);
+}
+
+template<GemmOp opA, GemmOp opB, typename MC, typename MA, typename MB, scalar S>
+void gemm(MC &&C, const S alpha, const MA &A, const MB &B, const S beta) {
+#ifdef NRG_BLAS_GEMM
+  blas_gemm<opA, opB>(C, alpha, A, B, beta);
+#else
+  eigen_gemm<opA, opB>(C, alpha, A, B, beta);
+#endif
+}
+
+// Lower triangle of C += alpha op(A) op(B) for square C, in panels of gemm_panel columns. Each panel is a single
+// gemm() call for the rows on and below the diagonal block, which requires about half the operations of the full
+// product. The entries above the diagonal within the diagonal blocks are updated as well; the upper triangle is
+// meant to be restored afterwards, see hermitian_mirror().
+constexpr Eigen::Index gemm_panel = 64;
+
+template<GemmOp opA, GemmOp opB, typename MC, typename MA, typename MB, scalar S>
+void gemm_lower(MC &&C, const S alpha, const MA &A, const MB &B) {
+  const auto n = C.rows();
+  assert(C.cols() == n);
+  for (Eigen::Index c = 0; c < n; c += gemm_panel) {
+    const auto w = std::min(gemm_panel, n - c);
+    const auto Arows = [&] { if constexpr (opA == GemmOp::N) return A.middleRows(c, n - c); else return A.middleCols(c, n - c); }();
+    const auto Bcols = [&] { if constexpr (opB == GemmOp::N) return B.middleCols(c, w); else return B.middleRows(c, w); }();
+    gemm<opA, opB>(C.block(c, c, n - c, w), alpha, Arows, Bcols, S(1));
+  }
+}
+
+} // namespace
+
+#endif
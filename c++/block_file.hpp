@@ -0,0 +1,200 @@
+// block_file.hpp - random-access binary files of dense matrices, read via mmap
+// Copyright (C) 2009-2024 Rok Zitko
+
+#ifndef _block_file_hpp_
+#define _block_file_hpp_
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <ostream>
+#include <memory>
+#include <stdexcept>
+#include <complex>
+#include <cstdint>
+#include <cstring> // memcmp, memcpy
+#include <mutex>   // call_once
+
+#include <Eigen/Dense>
+
+#include "traits.hpp"
+#include "file_data.hpp"
+#include "compression.hpp"
+
+#include <fmt/format.h>
+
+namespace NRG {
+
+// File layout: header, metadata (opaque to this code, e.g. a Boost archive), index of the matrix blocks, and the
+// matrix payloads. The payloads are raw row-major arrays of S, each starting at an offset aligned to
+// block_file_alignment (relative to the beginning of the file, i.e., in memory for mapped files), so that they can be
+// used in place as Eigen::Map objects. If the payloads are compressed (see compression.hpp), each one is
+// decompressed when first accessed. All integers are in the native byte order; the files are only meant to be read back on
+// the machine where they were written.
+constexpr char block_file_magic[8] = {'N', 'R', 'G', 'B', 'L', 'K', '0', '3'};
+constexpr uint64_t block_file_alignment = 64;
+
+struct BlockFileHeader {
+  char magic[8];
+  uint64_t dtype;           // see block_file_dtype()
+  uint64_t codec;           // see Codec
+  uint64_t nrblocks;
+  uint64_t metadata_offset;
+  uint64_t metadata_size;
+  uint64_t index_offset;    // nrblocks x BlockFileEntry
+  uint64_t raw_size;        // total size of the payloads before compression
+  uint64_t stored_size;     // total size of the payloads in the file
+};
+
+struct BlockFileEntry {
+  uint64_t offset;          // payload offset from the beginning of the file
+  uint64_t size;            // payload size in the file
+  uint64_t rows, cols;
+};
+
+template<scalar S> constexpr uint64_t block_file_dtype() {
+  if constexpr (std::is_same_v<S, double>) return 1;
+  else if constexpr (std::is_same_v<S, std::complex<double>>) return 2;
+  else return 0;
+}
+
+constexpr uint64_t block_file_align(const uint64_t pos) {
+  return (pos + block_file_alignment - 1) / block_file_alignment * block_file_alignment;
+}
+
+// Index of the blocks and the total file size. sizes are the sizes of the (possibly compressed) payloads.
+template<scalar S>
+auto block_file_layout(BlockFileHeader &header, const std::string &metadata, const std::vector<const EigenMatrix<S> *> &blocks,
+                       const std::vector<uint64_t> &sizes, const Codec codec) {
+  std::memcpy(header.magic, block_file_magic, sizeof(header.magic));
+  header.dtype           = block_file_dtype<S>();
+  header.codec           = uint64_t(codec);
+  header.nrblocks        = blocks.size();
+  header.metadata_offset = sizeof(BlockFileHeader);
+  header.metadata_size   = metadata.size();
+  header.index_offset    = block_file_align(header.metadata_offset + header.metadata_size);
+  header.raw_size        = 0;
+  header.stored_size     = 0;
+  std::vector<BlockFileEntry> index;
+  auto pos = block_file_align(header.index_offset + blocks.size() * sizeof(BlockFileEntry));
+  for (size_t i = 0; i < blocks.size(); i++) {
+    index.push_back({pos, sizes[i], uint64_t(blocks[i]->rows()), uint64_t(blocks[i]->cols())});
+    header.raw_size += blocks[i]->size() * sizeof(S);
+    header.stored_size += sizes[i];
+    pos = block_file_align(pos + sizes[i]);
+  }
+  return std::make_pair(index, pos);
+}
+
+// Size without compression, i.e., the upper bound for compressed files
+template<scalar S>
+[[nodiscard]] size_t block_file_size(const std::string &metadata, const std::vector<const EigenMatrix<S> *> &blocks) {
+  BlockFileHeader header{};
+  std::vector<uint64_t> sizes;
+  for (const auto m : blocks) sizes.push_back(m->size() * sizeof(S));
+  return block_file_layout<S>(header, metadata, blocks, sizes, Codec::none).second;
+}
+
+// F must be positioned at the beginning of the file
+template<scalar S>
+void write_block_file(std::ostream &F, const std::string &metadata, const std::vector<const EigenMatrix<S> *> &blocks,
+                      const Codec codec = Codec::none) {
+  std::vector<std::string> compressed;
+  std::vector<uint64_t> sizes;
+  for (const auto m : blocks) {
+    if (codec == Codec::none) {
+      sizes.push_back(m->size() * sizeof(S));
+    } else {
+      compressed.push_back(compress(reinterpret_cast<const double *>(m->data()), m->size() * sizeof(S) / sizeof(double), codec));
+      sizes.push_back(compressed.back().size());
+    }
+  }
+  BlockFileHeader header{};
+  const auto [index, total] = block_file_layout<S>(header, metadata, blocks, sizes, codec);
+  const char zeros[block_file_alignment] = {};
+  auto pad_to = [&F, &zeros](const uint64_t offset) { F.write(zeros, std::streamsize(offset - uint64_t(F.tellp()))); };
+  F.write(reinterpret_cast<const char *>(&header), sizeof(header));
+  F.write(metadata.data(), std::streamsize(metadata.size()));
+  pad_to(header.index_offset);
+  F.write(reinterpret_cast<const char *>(index.data()), std::streamsize(index.size() * sizeof(BlockFileEntry)));
+  for (size_t i = 0; i < blocks.size(); i++) {
+    pad_to(index[i].offset);
+    const auto payload = codec == Codec::none ? reinterpret_cast<const char *>(blocks[i]->data()) : compressed[i].data();
+    F.write(payload, std::streamsize(sizes[i]));
+    if (F.bad()) throw std::runtime_error("Error writing block file"); // Check after each write.
+  }
+  pad_to(total);
+}
+
+// Block file, either in memory or memory-mapped (see Workdir::read()). Only the header and the index are validated
+// and read on construction; the matrix blocks are accessed in place, so that the cost of loading from disk is
+// proportional to the amount of data actually used. Compressed blocks are decompressed on first access and kept;
+// different blocks may be accessed concurrently.
+template<scalar S>
+class BlockFile {
+ private:
+   std::shared_ptr<const FileData> file;
+   BlockFileHeader header{};
+   std::vector<BlockFileEntry> index;
+   mutable std::vector<EigenMatrix<S>> decompressed; // empty for Codec::none
+   mutable std::unique_ptr<std::once_flag[]> once;   // per block, guards decompressed
+   void decompress_into(const size_t i, S *out) const {
+     const auto &e = index[i];
+     decompress(file->data() + e.offset, e.size, reinterpret_cast<double *>(out), e.rows * e.cols * sizeof(S) / sizeof(double), codec());
+   }
+ public:
+   using Map = Eigen::Map<const EigenMatrix<S>>; // row-major
+   explicit BlockFile(std::shared_ptr<const FileData> file_) : file(std::move(file_)) {
+     const auto &fn = file->name();
+     if (file->size() < sizeof(header)) throw std::runtime_error(fmt::format("File {} is truncated", fn));
+     std::memcpy(&header, file->data(), sizeof(header));
+     if (std::memcmp(header.magic, block_file_magic, sizeof(header.magic)) != 0)
+       throw std::runtime_error(fmt::format("File {} is not a block file", fn));
+     if (header.dtype != block_file_dtype<S>())
+       throw std::runtime_error(fmt::format("File {} has data type {}, expected {}", fn, header.dtype, block_file_dtype<S>()));
+     if (header.codec > uint64_t(Codec::float32))
+       throw std::runtime_error(fmt::format("File {} has unknown codec {}", fn, header.codec));
+     if (header.metadata_offset + header.metadata_size > file->size() ||
+         header.index_offset + header.nrblocks * sizeof(BlockFileEntry) > file->size())
+       throw std::runtime_error(fmt::format("File {} is truncated", fn));
+     index.resize(header.nrblocks);
+     std::memcpy(index.data(), file->data() + header.index_offset, index.size() * sizeof(BlockFileEntry));
+     for (const auto &e : index)
+       if (e.offset % block_file_alignment || e.offset + e.size > file->size() ||
+           (codec() == Codec::none && e.size != e.rows * e.cols * sizeof(S)))
+         throw std::runtime_error(fmt::format("File {} is corrupt", fn));
+     if (codec() != Codec::none) {
+       decompressed.resize(index.size());
+       once = std::make_unique<std::once_flag[]>(index.size());
+     }
+   }
+   [[nodiscard]] const auto & name() const noexcept { return file->name(); }
+   [[nodiscard]] auto size() const noexcept { return index.size(); } // number of blocks
+   [[nodiscard]] Codec codec() const noexcept { return Codec(header.codec); }
+   [[nodiscard]] double compression_ratio() const noexcept { return header.stored_size ? double(header.raw_size) / double(header.stored_size) : 1.0; }
+   void prefetch() const { file->prefetch(); }
+   [[nodiscard]] std::string_view metadata() const noexcept { return {file->data() + header.metadata_offset, header.metadata_size}; }
+   [[nodiscard]] auto rows(const size_t i) const { return Eigen::Index(index.at(i).rows); }
+   [[nodiscard]] auto cols(const size_t i) const { return Eigen::Index(index.at(i).cols); }
+   [[nodiscard]] Map operator[](const size_t i) const {
+     const auto &e = index.at(i);
+     if (codec() == Codec::none) return Map(reinterpret_cast<const S *>(file->data() + e.offset), rows(i), cols(i));
+     std::call_once(once[i], [this, i] {
+       EigenMatrix<S> m(rows(i), cols(i));
+       decompress_into(i, m.data());
+       decompressed[i] = std::move(m);
+     });
+     return Map(decompressed[i].data(), rows(i), cols(i));
+   }
+   // Copy of block i. Compressed blocks are decompressed directly into the result, without keeping a copy.
+   [[nodiscard]] EigenMatrix<S> copy(const size_t i) const {
+     if (codec() == Codec::none) return (*this)[i];
+     EigenMatrix<S> m(rows(i), cols(i));
+     decompress_into(i, m.data());
+     return m;
+   }
+};
+
+} // namespace
+
+#endif
@@ -3,6 +3,9 @@
 
 #include <vector>
 #include <fstream>
+#include <complex>
+#include <boost/serialization/vector.hpp>
+#include <boost/serialization/complex.hpp>
 #include "traits.hpp"
 #include "params.hpp"
 #include "numerics.hpp" // read_vector
@@ -34,6 +37,9 @@ public:
     if (n+1 > table.size()) table.resize(n+1);
     table[n] = val;
   }
+private:
+  friend class boost::serialization::access;
+  template <class Archive> void serialize(Archive &ar, [[maybe_unused]] const unsigned int version) { ar &table; }
 };
 
 // Read matrices into a std::vector. First value to be read, 'nr', is either vector dimension or
@@ -108,6 +114,9 @@ public:
     my_assert(alpha < tabs.size());
     tabs[alpha].set(N, val);
   }
+private:
+  friend class boost::serialization::access;
+  template <class Archive> void serialize(Archive &ar, [[maybe_unused]] const unsigned int version) { ar &tabs; }
 };
 
 template <scalar S>
@@ -161,6 +170,13 @@ public:
   [[nodiscard]] auto xiDOUP  (const t_ndx N, const t_ch ch) const { return xi  (N, ch + 3 * P.channels); }
   [[nodiscard]] auto zetaUPDO(const t_ndx N, const t_ch ch) const { return zeta(N, ch + 2 * P.channels); }
   [[nodiscard]] auto zetaDOUP(const t_ndx N, const t_ch ch) const { return zeta(N, ch + 3 * P.channels); }
+
+private:
+  // Coefficient tables only (sent to the MPI slaves, see DiagMPI)
+  friend class boost::serialization::access;
+  template <class Archive> void serialize(Archive &ar, [[maybe_unused]] const unsigned int version) {
+    ar &xi &zeta &xiR &zetaR &delta &kappa &ep &em &u0p &u0m;
+  }
 };
 
 } // namespace
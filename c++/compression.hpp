@@ -0,0 +1,252 @@
+// compression.hpp - compression of the matrix payloads in the workdir files
+// Copyright (C) 2009-2024 Rok Zitko
+
+#ifndef _compression_hpp_
+#define _compression_hpp_
+
+#include <string>
+#include <vector>
+#include <stdexcept>
+#include <limits>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+
+#include <zlib.h>
+#ifdef NRG_ZSTD
+#include <zstd.h>
+#endif
+
+#include <fmt/format.h>
+
+namespace NRG {
+
+// Codecs for arrays of doubles (complex numbers are treated as pairs of doubles):
+// - none: raw data, can be used in place (memory mapped), see BlockFile
+// - lossless: byte shuffle, then each byte plane is compressed separately (zstd if available, otherwise zlib deflate
+//   with Huffman coding only, see PlaneCoder). The shuffle groups the bytes of equal significance: the planes holding
+//   the sign and exponent bits compress well, while the low mantissa bytes of floating-point data are essentially
+//   random. Planes which do not compress are detected on a sample and stored as they are, so the time is spent only
+//   where there is something to gain.
+// - float32: lossy, the values are rounded to single precision, then shuffled and compressed. The relative error
+//   of each element is at most 2^-24 (about 6e-8); values below FLT_MIN in magnitude have absolute error at most
+//   2^-150. Values which do not fit in a float are rejected. Appropriate only if the quantities computed from the
+//   eigenvectors and density matrices (e.g. spectral weights) are not needed with better relative accuracy.
+enum class Codec : uint64_t { none = 0, lossless = 1, float32 = 2 };
+
+inline Codec codec_from_string(const std::string &s) {
+  if (s == "none") return Codec::none;
+  if (s == "lossless") return Codec::lossless;
+  if (s == "float32") return Codec::float32;
+  throw std::invalid_argument(fmt::format("Unknown codec {}", s));
+}
+
+inline std::string to_string(const Codec c) {
+  switch (c) {
+    case Codec::none: return "none";
+    case Codec::lossless: return "lossless";
+    case Codec::float32: return "float32";
+  }
+  return fmt::format("unknown({})", uint64_t(c));
+}
+
+// Byte k of element i goes to position k*n+i
+inline void byte_shuffle(const char *in, char *out, const size_t n, const size_t width) {
+  for (size_t i = 0; i < n; i++)
+    for (size_t k = 0; k < width; k++) out[k * n + i] = in[i * width + k];
+}
+
+inline void byte_unshuffle(const char *in, char *out, const size_t n, const size_t width) {
+  for (size_t k = 0; k < width; k++)
+    for (size_t i = 0; i < n; i++) out[i * width + k] = in[k * n + i];
+}
+
+// zlib counts the buffer sizes in uInt, so large buffers are passed in chunks of at most 'chunk' bytes
+constexpr size_t zlib_chunk = size_t(1) << 30;
+
+// Deflate len bytes at the fastest setting. Huffman coding only: string matching rarely finds anything in the byte
+// planes of floating-point data, but costs most of the time. The output buffer is grown as needed.
+inline std::string deflate_bytes(const char *in, const size_t len, const size_t chunk = zlib_chunk) {
+  z_stream zs{};
+  if (deflateInit2(&zs, Z_BEST_SPEED, Z_DEFLATED, 15, 8, Z_HUFFMAN_ONLY) != Z_OK) throw std::runtime_error("Compression failed");
+  std::string out(std::min(deflateBound(&zs, uLong(std::min(len, chunk))), uLong(chunk)), '\0');
+  size_t in_pos = 0, out_pos = 0;
+  int res = Z_OK;
+  while (res != Z_STREAM_END) {
+    if (zs.avail_in == 0 && in_pos < len) {
+      zs.next_in  = reinterpret_cast<Bytef *>(const_cast<char *>(in + in_pos));
+      zs.avail_in = uInt(std::min(len - in_pos, chunk));
+      in_pos += zs.avail_in;
+    }
+    if (out_pos == out.size()) out.resize(out.size() + std::min(out.size(), chunk));
+    zs.next_out  = reinterpret_cast<Bytef *>(out.data() + out_pos);
+    zs.avail_out = uInt(std::min(out.size() - out_pos, chunk));
+    const auto avail = zs.avail_out;
+    res = deflate(&zs, in_pos == len ? Z_FINISH : Z_NO_FLUSH);
+    out_pos += avail - zs.avail_out;
+    if (res != Z_OK && res != Z_STREAM_END && res != Z_BUF_ERROR) break;
+  }
+  deflateEnd(&zs);
+  if (res != Z_STREAM_END) throw std::runtime_error("Compression failed");
+  out.resize(out_pos);
+  return out;
+}
+
+// Inflate exactly out_len bytes from len bytes of input
+inline void inflate_bytes(const char *in, const size_t len, char *out, const size_t out_len, const size_t chunk = zlib_chunk) {
+  z_stream zs{};
+  if (inflateInit(&zs) != Z_OK) throw std::runtime_error("Decompression failed");
+  size_t in_pos = 0, out_pos = 0;
+  int res = Z_OK;
+  while (res == Z_OK) {
+    if (zs.avail_in == 0) {
+      zs.next_in  = reinterpret_cast<Bytef *>(const_cast<char *>(in + in_pos));
+      zs.avail_in = uInt(std::min(len - in_pos, chunk));
+      in_pos += zs.avail_in;
+    }
+    zs.next_out  = reinterpret_cast<Bytef *>(out + out_pos);
+    zs.avail_out = uInt(std::min(out_len - out_pos, chunk));
+    const auto avail = zs.avail_out;
+    res = inflate(&zs, Z_NO_FLUSH);
+    out_pos += avail - zs.avail_out;
+    if (res == Z_BUF_ERROR && zs.avail_in == 0 && in_pos < len) res = Z_OK; // next input chunk
+    if (res == Z_BUF_ERROR && zs.avail_out == 0 && out_pos < out_len) res = Z_OK; // next output chunk
+  }
+  inflateEnd(&zs);
+  if (res != Z_STREAM_END || out_pos != out_len || in_pos != len || zs.avail_in != 0)
+    throw std::runtime_error("Decompression failed");
+}
+
+#ifdef NRG_ZSTD
+// zstd at its fastest regular level: several times faster than zlib in both directions, at a similar ratio on the
+// byte planes of floating-point data (the literals are Huffman coded as well).
+constexpr int zstd_level = 1;
+
+inline std::string zstd_bytes(const char *in, const size_t len) {
+  std::string out(ZSTD_compressBound(len), '\0');
+  const auto res = ZSTD_compress(out.data(), out.size(), in, len, zstd_level);
+  if (ZSTD_isError(res)) throw std::runtime_error("Compression failed");
+  out.resize(res);
+  return out;
+}
+
+inline void unzstd_bytes(const char *in, const size_t len, char *out, const size_t out_len) {
+  const auto res = ZSTD_decompress(out, out_len, in, len);
+  if (ZSTD_isError(res) || res != out_len) throw std::runtime_error("Decompression failed");
+}
+#endif
+
+// Entropy coder for the byte planes. zstd is used when the code is built with it (cmake finds libzstd), zlib is the
+// fallback. The coder is recorded in the compressed data.
+enum class PlaneCoder : uint64_t { zlib = 0, zstd = 1 };
+
+#ifdef NRG_ZSTD
+constexpr PlaneCoder default_plane_coder = PlaneCoder::zstd;
+#else
+constexpr PlaneCoder default_plane_coder = PlaneCoder::zlib;
+#endif
+
+inline std::string encode_plane(const char *in, const size_t len, const PlaneCoder coder) {
+#ifdef NRG_ZSTD
+  if (coder == PlaneCoder::zstd) return zstd_bytes(in, len);
+#endif
+  if (coder == PlaneCoder::zlib) return deflate_bytes(in, len);
+  throw std::invalid_argument(fmt::format("Plane coder {} not available", uint64_t(coder)));
+}
+
+inline void decode_plane(const char *in, const size_t len, char *out, const size_t out_len, const PlaneCoder coder) {
+#ifdef NRG_ZSTD
+  if (coder == PlaneCoder::zstd) return unzstd_bytes(in, len, out, out_len);
+#endif
+  if (coder == PlaneCoder::zlib) return inflate_bytes(in, len, out, out_len);
+  throw std::runtime_error(fmt::format("Decompression failed: plane coder {} not available", uint64_t(coder)));
+}
+
+// A byte plane is compressed if a sample from its beginning compresses by at least this factor
+constexpr size_t plane_sample = 65536;
+constexpr double plane_min_ratio = 1.05;
+
+inline bool plane_compressible(const char *plane, const size_t n, const PlaneCoder coder) {
+  if (n <= plane_sample) return n > 0; // the whole plane is the sample
+  return double(plane_sample) >= plane_min_ratio * double(encode_plane(plane, plane_sample, coder).size());
+}
+
+// Format of the compressed data: the coder (uint64_t), the stored sizes of the width byte planes (uint64_t each),
+// followed by the planes. A plane whose stored size equals n is stored uncompressed.
+inline std::string compress_planes(const char *shuffled, const size_t n, const size_t width,
+                                   const PlaneCoder coder = default_plane_coder) {
+  std::vector<uint64_t> header(width + 1);
+  header[0] = uint64_t(coder);
+  std::vector<std::string> planes(width);
+  for (size_t k = 0; k < width; k++) {
+    const auto plane = shuffled + k * n;
+    if (plane_compressible(plane, n, coder)) planes[k] = encode_plane(plane, n, coder);
+    if (planes[k].empty() || planes[k].size() >= n) planes[k].assign(plane, n);
+    header[k + 1] = planes[k].size();
+  }
+  std::string out(reinterpret_cast<const char *>(header.data()), header.size() * sizeof(uint64_t));
+  for (const auto &p : planes) out += p;
+  return out;
+}
+
+inline void decompress_planes(const char *in, const size_t len, char *shuffled, const size_t n, const size_t width) {
+  std::vector<uint64_t> header(width + 1);
+  if (len < header.size() * sizeof(uint64_t)) throw std::runtime_error("Decompression failed");
+  std::memcpy(header.data(), in, header.size() * sizeof(uint64_t));
+  const auto coder = PlaneCoder(header[0]);
+  size_t pos = header.size() * sizeof(uint64_t);
+  for (size_t k = 0; k < width; k++) {
+    const auto size = header[k + 1];
+    if (size > len - pos) throw std::runtime_error("Decompression failed");
+    if (size == n)
+      std::memcpy(shuffled + k * n, in + pos, n);
+    else
+      decode_plane(in + pos, size, shuffled + k * n, n, coder);
+    pos += size;
+  }
+  if (pos != len) throw std::runtime_error("Decompression failed");
+}
+
+// Compress n doubles (codec other than none)
+inline std::string compress(const double *x, const size_t n, const Codec codec) {
+  std::vector<char> shuffled;
+  size_t width = 0;
+  if (codec == Codec::lossless) {
+    width = sizeof(double);
+    shuffled.resize(n * width);
+    byte_shuffle(reinterpret_cast<const char *>(x), shuffled.data(), n, width);
+  } else if (codec == Codec::float32) {
+    std::vector<float> f(n);
+    for (size_t i = 0; i < n; i++) {
+      if (!(std::abs(x[i]) <= std::numeric_limits<float>::max()))
+        throw std::runtime_error(fmt::format("Value {} can't be stored in float32 format", x[i]));
+      f[i] = float(x[i]);
+    }
+    width = sizeof(float);
+    shuffled.resize(n * width);
+    byte_shuffle(reinterpret_cast<const char *>(f.data()), shuffled.data(), n, width);
+  } else
+    throw std::invalid_argument(fmt::format("compress() called with codec {}", to_string(codec)));
+  return compress_planes(shuffled.data(), n, width);
+}
+
+// Decompress into n doubles
+inline void decompress(const char *in, const size_t len, double *x, const size_t n, const Codec codec) {
+  const size_t width = codec == Codec::float32 ? sizeof(float) : sizeof(double);
+  if (codec != Codec::lossless && codec != Codec::float32)
+    throw std::invalid_argument(fmt::format("decompress() called with codec {}", to_string(codec)));
+  std::vector<char> shuffled(n * width);
+  decompress_planes(in, len, shuffled.data(), n, width);
+  if (codec == Codec::lossless) {
+    byte_unshuffle(shuffled.data(), reinterpret_cast<char *>(x), n, width);
+  } else {
+    std::vector<float> f(n);
+    byte_unshuffle(shuffled.data(), reinterpret_cast<char *>(f.data()), n, width);
+    for (size_t i = 0; i < n; i++) x[i] = f[i];
+  }
+}
+
+} // namespace
+
+#endif
@@ -35,6 +35,8 @@
 #include "diag_mpi.hpp"
 #include "diag_openmp.hpp"
 #include "diag_serial.hpp"
+#include "diag_twophase.hpp"
+#include "diag_hybrid.hpp"
 #include "h5.hpp"
 #include "io.hpp"
 
@@ -59,8 +61,17 @@ SubspaceDimensions::SubspaceDimensions(const Invar &I, const InvarVec &ancestors
 // Determine the structure of matrices in the new NRG shell
 template<scalar S>
 SubspaceStructure::SubspaceStructure(const DiagInfo<S> &diagprev, const Symmetry<S> *Sym) {
-  for (const auto &I : new_subspaces(diagprev, Sym))
-    (*this)[I] = SubspaceDimensions{I, Sym->ancestors(I), diagprev, Sym};
+  for (const auto &[I, eig] : diagprev) prev.push_back(I); // sorted, since DiagInfo is a map
+  for (const auto &I : new_subspaces(diagprev, Sym)) {
+    auto &sub = (*this)[I] = SubspaceDimensions{I, Sym->ancestors(I), diagprev, Sym};
+    for (const auto &anc : sub.ancestors) sub.ids.push_back(id(anc));
+  }
+}
+
+template<scalar S>
+std::vector<double> TaskList::costs(const std::vector<Invar> &tasks, const DiagInfo<S> &diagprev, const Symmetry<S> *Sym) {
+  return tasks | ranges::views::transform([&diagprev, Sym](const auto &I) {
+    return cost(SubspaceDimensions{I, Sym->ancestors(I), diagprev, Sym}.total()); }) | ranges::to<std::vector>();
 }
 
 // Subspaces for the new iteration
@@ -75,9 +86,12 @@ auto new_subspaces(const DiagInfo<S> &diagprev, const Symmetry<S> *Sym) {
   return subspaces;
 }
 
+// Build the Hamiltonian matrix of subspace I. Only the (corrected) eigenvalues of the stored states are used from
+// diagprev. Also called on the MPI slaves, see DiagMPI. threads is the number of threads for the assembly; by
+// default all threads outside parallel regions and a single thread inside them.
 template<scalar S>
-auto hamiltonian(const Step &step, const Invar &I, const Opch<S> &opch, const Coef<S> &coef,
-                 const DiagInfo<S> &diagprev, const Output<S> &output, const Symmetry<S> *Sym, const Params &P) {
+auto hamiltonian_matrix(const Step &step, const Invar &I, const Opch<S> &opch, const Coef<S> &coef,
+                        const DiagInfo<S> &diagprev, const Symmetry<S> *Sym, const Params &P, const int threads = 0) {
   const auto anc = Sym->ancestors(I);
   const SubspaceDimensions rm{I, anc, diagprev, Sym};
   const auto dim = rm.total();
@@ -92,8 +106,18 @@ auto hamiltonian(const Step &step, const Invar &I, const Opch<S> &opch, const Co
     for (const auto & [n, r] : range | ranges::views::enumerate)
       h(r,r) = P.nrg_step_scale_factor() * diagprev.at(anc[i]).values.corr(n); // H_{N+1}=\lambda^{1/2} H_N+\xi_N (hopping terms)
   }
+  HamiltonianAssembly<S> assembly;
   Sym->make_matrix(h, step, rm, I, anc, opch, coef);  // Symmetry-type-specific matrix initialization steps
+  nrglog('i', "Off-diagonal blocks: " << assembly.size());
+  assembly.apply(h, threads > 0 ? threads : omp_in_parallel() ? 1 : omp_get_max_threads());
   if (P.logletter('m')) dump_matrix(h);
+  return h;
+}
+
+template<scalar S>
+auto hamiltonian(const Step &step, const Invar &I, const Opch<S> &opch, const Coef<S> &coef,
+                 const DiagInfo<S> &diagprev, const Output<S> &output, const Symmetry<S> *Sym, const Params &P, const int threads = 0) {
+  auto h = hamiltonian_matrix(step, I, opch, coef, diagprev, Sym, P, threads);
   if (P.h5raw && (P.h5all || (P.h5last && step.last())) && P.h5ham)
     h5_dump_matrix(*output.h5raw, std::to_string(step.ndx()+1) + "/hamiltonian/" + I.name() + "/matrix", h);
   return h;
@@ -106,12 +130,20 @@ auto do_diag(const Step &step, const Operators<S> &operators, const Coef<S> &coe
   Sym->show_coefficients(step, coef);
   double diagratio = P.diagratio; // non-const
   DiagInfo<S> diag;
+  std::vector<Invar> redo; // subspaces to re-diagonalise on incremental restart (empty: all)
+  double cost_full = 0, cost_redo = 0; // estimated work of full and incremental restarts
+  workspace_stats.reset();
   while (true) {
     try {
       if (step.nrg()) {
         if (!(P.resume && P.laststored.has_value() && step.ndx() <= P.laststored.value())) {
           const auto section_timing = mt.time_it("diag");
-          diag = eng->diagonalisations(step, operators.opch, coef, diagprev, output, tasklist.get(), DiagParams(P, diagratio), Sym, P); // compute in first run
+          if (redo.empty()) {
+            diag = eng->diagonalisations(step, operators.opch, coef, diagprev, output, tasklist.get(), DiagParams(P, diagratio), Sym, P); // compute in first run
+          } else {
+            auto diagredo = eng->diagonalisations(step, operators.opch, coef, diagprev, output, redo, DiagParams(P, diagratio), Sym, P);
+            for (auto &[I, eig] : diagredo) diag[I] = std::move(eig); // other subspaces are retained
+          }
         } else {
           diag = DiagInfo<S>(step.ndx(), P, false); // or read from disk
         }
@@ -130,8 +162,21 @@ auto do_diag(const Step &step, const Operators<S> &operators, const Coef<S> &coe
       if (!(step.nrg() && P.restart)) break;
       diagratio = std::min(diagratio * P.restartfactor, 1.0);
       color_print(P.pretty_out, fmt::emphasis::bold | fg(fmt::color::yellow), "\nRestarting this iteration step. diagratio={}\n\n", diagratio);
+      stats.restarts[step.ndx()]++;
+      cost_full += tasklist.cost();
+      if (P.restartincr) {
+        redo = tasklist.get(e.subspaces);
+        cost_redo += tasklist.cost(redo);
+        nrglog('A', "Re-diagonalising " << redo.size() << " out of " << tasklist.get().size() << " subspaces");
+      } else
+        cost_redo += tasklist.cost();
     }
   }
+  if (stats.restarts[step.ndx()]) {
+    stats.restart_saved[step.ndx()] = 1.0 - cost_redo/cost_full;
+    fmt::print("Restarts: {}, saved work: {:.3}\n", stats.restarts[step.ndx()], stats.restart_saved[step.ndx()]);
+  }
+  if (P.logletter('W')) workspace_stats.report();
   return diag;
 }
 
@@ -183,6 +228,10 @@ void store_states(const Step &step, Store<S> &store, Store<S> &store_all, const
     // We need 'substruct' to obtain information about the structure (rmax values) of the ancestor spaces.
     store[step.ndx()] = Subs(diag, substruct, step.last());
   }
+  nrglog('D', "Store: " << store_all[step.ndx()].bytes() + store[step.ndx()].bytes() << " bytes at this step, "
+         << store_all.bytes() + store.bytes() << " bytes in total (eigenvectors not retained: "
+         << ranges::accumulate(diag_in.eigs(), size_t{0}, {}, [](const auto &eig) { return eig.getnrstored() * eig.getdim() * sizeof(S); })
+         << " bytes)");
 }
 
 // Perform processing after a successful NRG step. Also called from doZBW() as a final step.
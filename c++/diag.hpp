@@ -11,6 +11,10 @@
 #include <iostream>
 #include <iomanip> // std::setprecision
 #include <stdexcept>
+#include <map>
+#include <tuple>
+#include <atomic>
+#include <string_view>
 
 #include "traits.hpp"
 #include "params.hpp"
@@ -26,6 +30,69 @@
 
 namespace NRG {
 
+// Counters for the LAPACK workspace arena, summed over all threads. Reset and reported in each NRG step (log letter
+// 'W'). In MPI runs, the counters on the slave processes are local and not reported.
+struct WorkspaceStats {
+  std::atomic<size_t> allocated{0}; // bytes obtained from the allocator
+  std::atomic<size_t> reused{0};    // bytes served from previously allocated buffers
+  std::atomic<size_t> queries{0};   // LAPACK workspace queries performed
+  std::atomic<size_t> cached{0};    // workspace queries avoided
+  void reset() { allocated = 0; reused = 0; queries = 0; cached = 0; }
+  void report() const {
+    fmt::print("LAPACK workspace: allocated={} reused={} [bytes], queries={} cached={}\n",
+               allocated.load(), reused.load(), queries.load(), cached.load());
+  }
+};
+inline WorkspaceStats workspace_stats;
+
+// Persistent LAPACK workspace. The work arrays are retained between calls and they only grow, thus diagonalising
+// many subspaces of similar size does not repeatedly allocate and free memory. The optimal array lengths returned
+// by the LAPACK workspace queries are cached per (routine, jobz, range, dim, M). There is one instance per thread,
+// see workspace(), so that the arena can be used without locking in the OpenMP engine.
+class LapackWorkspace {
+ public:
+   struct Sizes {
+     int lwork = 0, liwork = 0, lrwork = 0;
+   };
+   using Key = std::tuple<std::string_view, char, char, int, int>; // routine, jobz, range, dim, M
+ private:
+   std::vector<double> dwork_buf, rwork_buf;
+   std::vector<lapack_complex_double> zwork_buf;
+   std::vector<int> iwork_buf, isuppz_buf;
+   std::map<Key, Sizes> sizes;
+   template<typename T> T* grow(std::vector<T> &buf, const size_t n) {
+     const auto bytes = n * sizeof(T);
+     if (n > buf.size()) {
+       buf.clear(); // previous contents are not needed, avoid copying
+       buf.resize(n);
+       workspace_stats.allocated += bytes;
+     } else
+       workspace_stats.reused += bytes;
+     if (buf.empty()) buf.resize(1); // LAPACK requires valid pointers
+     return buf.data();
+   }
+ public:
+   auto dwork(const size_t n) { return grow(dwork_buf, n); }
+   auto zwork(const size_t n) { return grow(zwork_buf, n); }
+   auto rwork(const size_t n) { return grow(rwork_buf, n); }
+   auto iwork(const size_t n) { return grow(iwork_buf, n); }
+   auto isuppz(const size_t n) { return grow(isuppz_buf, n); }
+   // Return the cached array lengths or perform the workspace query q()
+   template<typename F> Sizes query(const Key &key, F q) {
+     if (const auto f = sizes.find(key); f != sizes.end()) {
+       workspace_stats.cached++;
+       return f->second;
+     }
+     workspace_stats.queries++;
+     return sizes[key] = q();
+   }
+};
+
+inline LapackWorkspace & workspace() {
+  thread_local LapackWorkspace ws;
+  return ws;
+}
+
 // Handle complex-type conversions (used in copy_vec)
 [[nodiscard]] inline auto to_matel(const double x) { return x; }
 [[nodiscard]] inline auto to_matel(const lapack_complex_double &z) { return std::complex<double>(z.real, z.imag); }
@@ -52,10 +119,29 @@ void copy_vec(U* eigenvectors, MM & diagvectors, const size_t dim, const size_t
 template<scalar S, vector V, typename U>
 auto copy_results(const V &eigenvalues, U* eigenvectors, const char jobz, const size_t dim, const size_t M)
 {
-  RawEigen<S> d(M, dim);
+  RawEigen<S> d(jobz == 'V' ? M : 0, dim); // no storage for eigenvectors if jobz='N'
   copy_val(eigenvalues, d.val, M);
-  if (jobz == 'V') copy_vec(eigenvectors, d.vec, dim, M);
-  my_assert(d.val.size() == nrvec(d.vec));
+  if (jobz == 'V') {
+    copy_vec(eigenvectors, d.vec, dim, M);
+    my_assert(d.val.size() == nrvec(d.vec));
+  }
+  return d;
+}
+
+// Hand over the eigenvectors to RawEigen without copying. The row-ordered matrix vecs holds the eigenvectors in its
+// rows: this is the input matrix for dsyev/dsyevd/zheev (overwritten in place by LAPACK) or the Z array for
+// dsyevr/zheevr. Only the first M rows are retained. If jobz='N', vecs is discarded.
+template<scalar S, vector V, matrix MM>
+auto move_results(const V &eigenvalues, MM &vecs, const char jobz, const size_t dim, const size_t M)
+{
+  RawEigen<S> d;
+  copy_val(eigenvalues, d.val, M);
+  if (jobz == 'V') {
+    if (nrvec(vecs) != M) NRG::resize(vecs, M, dim); // conserving matrix resize
+    d.vec = std::move(vecs);
+    my_assert(d.val.size() == nrvec(d.vec) && dim == NRG::dim(d.vec));
+  } else
+    d.vec.resize(0, dim); // no storage for eigenvectors, but keep the dimension
   return d;
 }
 
@@ -70,17 +156,21 @@ auto diagonalise_dsyev(RM &m, const char jobz = 'V') {
   int NN     = dim;         // the order of the matrix
   int LDA    = dim;         // the leading dimension of the array a
   int INFO   = 0;           // 0 on successful exit
-  int LWORK0 = -1;          // length of the WORK array
-  double WORK0 = 0;         // on exit: optimal WORK size
+  auto &ws    = workspace();
   // Step 1: determine optimal LWORK
-  LAPACK_dsyev(&jobz, &UPLO, &NN, ham, &LDA, eigenvalues.data(), &WORK0, &LWORK0, &INFO);
-  my_assert(INFO == 0);
-  int LWORK    = int(WORK0);
-  std::vector<double> WORK(LWORK);
+  const auto sizes = ws.query({"dsyev", jobz, 'A', dim, dim}, [&] {
+    int LWORK0 = -1;          // length of the WORK array
+    double WORK0 = 0;         // on exit: optimal WORK size
+    LAPACK_dsyev(&jobz, &UPLO, &NN, ham, &LDA, eigenvalues.data(), &WORK0, &LWORK0, &INFO);
+    my_assert(INFO == 0);
+    return LapackWorkspace::Sizes{int(WORK0)};
+  });
+  int LWORK = sizes.lwork;
+  auto WORK = ws.dwork(LWORK);
   // Step 2: perform the diagonalisation
-  LAPACK_dsyev(&jobz, &UPLO, &NN, ham, &LDA, eigenvalues.data(), WORK.data(), &LWORK, &INFO);
+  LAPACK_dsyev(&jobz, &UPLO, &NN, ham, &LDA, eigenvalues.data(), WORK, &LWORK, &INFO);
   if (INFO != 0) throw std::runtime_error(fmt::format("dsyev failed. INFO={}", INFO));
-  return copy_results<double>(eigenvalues, ham, jobz, dim, dim);
+  return move_results<double>(eigenvalues, m, jobz, dim, dim);
 }
 
 template<real_matrix RM>
@@ -94,17 +184,21 @@ auto diagonalise_dsyevd(RM &m, const char jobz = 'V')
   int NN     = dim;
   int LDA    = dim;
   int INFO   = 0;
-  int LWORK  = -1;
-  int LIWORK = -1;
-  double WORK0 = 0; // on exit: optimal WORK size
-  int IWORK0 = 0;   // on exit: optimal IWORK size
-  LAPACK_dsyevd(&jobz, &UPLO, &NN, ham, &LDA, eigenvalues.data(), &WORK0, &LWORK, &IWORK0, &LIWORK, &INFO);
-  my_assert(INFO == 0);
-  LWORK      = int(WORK0);
-  LIWORK     = IWORK0;
-  std::vector<double> WORK(LWORK);
-  std::vector<int> IWORK(LIWORK);
-  LAPACK_dsyevd(&jobz, &UPLO, &NN, ham, &LDA, eigenvalues.data(), WORK.data(), &LWORK, IWORK.data(), &LIWORK, &INFO);
+  auto &ws   = workspace();
+  const auto sizes = ws.query({"dsyevd", jobz, 'A', dim, dim}, [&] {
+    int LWORK0  = -1;
+    int LIWORK0 = -1;
+    double WORK0 = 0; // on exit: optimal WORK size
+    int IWORK0 = 0;   // on exit: optimal IWORK size
+    LAPACK_dsyevd(&jobz, &UPLO, &NN, ham, &LDA, eigenvalues.data(), &WORK0, &LWORK0, &IWORK0, &LIWORK0, &INFO);
+    my_assert(INFO == 0);
+    return LapackWorkspace::Sizes{int(WORK0), IWORK0};
+  });
+  int LWORK  = sizes.lwork;
+  int LIWORK = sizes.liwork;
+  auto WORK  = ws.dwork(LWORK);
+  auto IWORK = ws.iwork(LIWORK);
+  LAPACK_dsyevd(&jobz, &UPLO, &NN, ham, &LDA, eigenvalues.data(), WORK, &LWORK, IWORK, &LIWORK, &INFO);
   if (INFO != 0) {
     // dsyevd sometimes fails to converge (INFO>0). In such cases we do not trigger
     // an error but return 0, to permit error recovery.
@@ -113,18 +207,21 @@ auto diagonalise_dsyevd(RM &m, const char jobz = 'V')
     else
       throw std::runtime_error(fmt::format("dsyev failed. INFO={}", INFO));
   }
-  return copy_results<double>(eigenvalues, ham, jobz, dim, dim);
+  return move_results<double>(eigenvalues, m, jobz, dim, dim);
 }
 
 template<real_matrix RM>
-auto diagonalise_dsyevr(RM &m, const double ratio = 1.0, const char jobz = 'V') {
+auto diagonalise_dsyevr(RM &m, const double ratio = 1.0, const char jobz = 'V', const size_t nr = 0) {
   if (!is_row_ordered(m)) m = NRG::trans(m);
   const auto dim = int(size1(m));
   // M is the number of the eigenvalues that we will attempt to
   // calculate using dsyevr.
   auto M = dim;
   char RANGE = 'A'; // 'A'=all, 'V'=interval, 'I'=part
-  if (ratio != 1.0) {
+  if (nr > 0) { // explicit number of eigenpairs, overrides ratio
+    M     = std::clamp<int>(nr, 1, dim);
+    RANGE = M < dim ? 'I' : 'A';
+  } else if (ratio != 1.0) {
     M     = ceil(ratio * M); // round up
     M     = std::clamp<int>(M, 1, dim);        // at least 1, at most dim
     RANGE = 'I';
@@ -144,33 +241,40 @@ auto diagonalise_dsyevr(RM &m, const double ratio = 1.0, const char jobz = 'V')
   // matrix obtained by reducing m to tridiagonal form.
   int MM{}; // total number of eigenvalues found
   int LDZ = dim;
-  std::vector<int> ISUPPZ(2 * M);
+  auto &ws = workspace();
+  auto ISUPPZ = ws.isuppz(2 * M);
   //  The support of the eigenvectors in Z, i.e., the indices
   //  indicating the nonzero elements in Z.  The i-th eigenvector is
   //  nonzero only in elements ISUPPZ( 2*i-1 ) through ISUPPZ(2*i).
-  std::vector<double> Z(LDZ * M); // eigenvectors
-  int LWORK0  = -1;
-  int LIWORK0 = -1;
-  double WORK0 = 0; // on exit: optimal WORK size
-  int IWORK0 = 0;   // on exist: optimal IWORK size
+  // Eigenvectors are written directly into the result matrix. Column-major LDZ x M array Z is a row-major M x dim matrix.
+  double Zdummy = 0; // not referenced if jobz='N'
+  auto vecs = Matrix_traits<double>(jobz == 'V' ? M : 0, dim);
+  auto Z = jobz == 'V' ? data(vecs) : &Zdummy;
   // Step 1: determine optimal LWORK and LIWORK
-  LAPACK_dsyevr(&jobz, &RANGE, &UPLO, &NN, ham, &LDA, &VL, &VU, &IL, &IU, &ABSTOL, &MM, eigenvalues.data(), Z.data(), &LDZ, ISUPPZ.data(), &WORK0, &LWORK0,
-                &IWORK0, &LIWORK0, &INFO);
-  my_assert(INFO == 0);
-  int LWORK  = int(WORK0);
-  int LIWORK = IWORK0;
-  std::vector<double> WORK(LWORK);
-  std::vector<int> IWORK(LIWORK);
+  const auto sizes = ws.query({"dsyevr", jobz, RANGE, dim, M}, [&] {
+    int LWORK0  = -1;
+    int LIWORK0 = -1;
+    double WORK0 = 0; // on exit: optimal WORK size
+    int IWORK0 = 0;   // on exist: optimal IWORK size
+    LAPACK_dsyevr(&jobz, &RANGE, &UPLO, &NN, ham, &LDA, &VL, &VU, &IL, &IU, &ABSTOL, &MM, eigenvalues.data(), Z, &LDZ, ISUPPZ, &WORK0, &LWORK0,
+                  &IWORK0, &LIWORK0, &INFO);
+    my_assert(INFO == 0);
+    return LapackWorkspace::Sizes{int(WORK0), IWORK0};
+  });
+  int LWORK  = sizes.lwork;
+  int LIWORK = sizes.liwork;
+  auto WORK  = ws.dwork(LWORK);
+  auto IWORK = ws.iwork(LIWORK);
   // Step 2: perform the diagonalisation
-  LAPACK_dsyevr(&jobz, &RANGE, &UPLO, &NN, ham, &LDA, &VL, &VU, &IL, &IU, &ABSTOL, &MM, eigenvalues.data(), Z.data(), &LDZ, ISUPPZ.data(), WORK.data(),
-                &LWORK, IWORK.data(), &LIWORK, &INFO);
+  LAPACK_dsyevr(&jobz, &RANGE, &UPLO, &NN, ham, &LDA, &VL, &VU, &IL, &IU, &ABSTOL, &MM, eigenvalues.data(), Z, &LDZ, ISUPPZ, WORK,
+                &LWORK, IWORK, &LIWORK, &INFO);
   if (INFO != 0) throw std::runtime_error(fmt::format("dsyev failed. INFO={}", INFO));
   if (MM != int(M)) {
     std::cout << "dsyevr computed " << MM << "/" << M << std::endl;
     M = MM;
     my_assert(M > 0); // at least one
   }
-  return copy_results<double>(eigenvalues, Z.data(), jobz, dim, M);
+  return move_results<double>(eigenvalues, vecs, jobz, dim, M);
 }
 
 template<complex_matrix CM>
@@ -183,30 +287,37 @@ auto diagonalise_zheev(CM &m, const char jobz = 'V') {
   int NN     = dim;         // the order of the matrix
   int LDA    = dim;         // the leading dimension of the array a
   int INFO   = 0;           // 0 on successful exit
-  int LWORK0 = -1;          // length of the WORK array (-1 == query!)
-  lapack_complex_double WORK0;
+  auto &ws   = workspace();
   int RWORKdim = std::max(1, 3 * dim - 2);
-  std::vector<double> RWORK(RWORKdim);
+  auto RWORK = ws.rwork(RWORKdim);
   // Step 1: determine optimal LWORK
-  LAPACK_zheev(&jobz, &UPLO, &NN, ham, &LDA, eigenvalues.data(), &WORK0, &LWORK0, RWORK.data(), &INFO);
-  my_assert(INFO == 0);
-  int LWORK  = int(WORK0.real);
-  std::vector<lapack_complex_double> WORK(LWORK);
+  const auto sizes = ws.query({"zheev", jobz, 'A', dim, dim}, [&] {
+    int LWORK0 = -1;          // length of the WORK array (-1 == query!)
+    lapack_complex_double WORK0;
+    LAPACK_zheev(&jobz, &UPLO, &NN, ham, &LDA, eigenvalues.data(), &WORK0, &LWORK0, RWORK, &INFO);
+    my_assert(INFO == 0);
+    return LapackWorkspace::Sizes{int(WORK0.real)};
+  });
+  int LWORK = sizes.lwork;
+  auto WORK = ws.zwork(LWORK);
   // Step 2: perform the diagonalisation
-  LAPACK_zheev(&jobz, &UPLO, &NN, ham, &LDA, eigenvalues.data(), WORK.data(), &LWORK, RWORK.data(), &INFO);
+  LAPACK_zheev(&jobz, &UPLO, &NN, ham, &LDA, eigenvalues.data(), WORK, &LWORK, RWORK, &INFO);
   if (INFO != 0) throw std::runtime_error(fmt::format("dsyev failed. INFO={}", INFO));
-  return copy_results<std::complex<double>>(eigenvalues, ham, jobz, dim, dim);
+  return move_results<std::complex<double>>(eigenvalues, m, jobz, dim, dim);
 }
 
 template<complex_matrix CM>
-auto diagonalise_zheevr(CM &m, const double ratio = 1.0, const char jobz = 'V') {
+auto diagonalise_zheevr(CM &m, const double ratio = 1.0, const char jobz = 'V', const size_t nr = 0) {
   if (!is_row_ordered(m)) m = NRG::trans(m);
   const auto dim = int(size1(m));
   // M is the number of the eigenvalues that we will attempt to
   // calculate using zheevr.
   auto M = dim;
   char RANGE = 'A'; // 'A'=all, 'V'=interval, 'I'=part
-  if (ratio != 1.0) {
+  if (nr > 0) { // explicit number of eigenpairs, overrides ratio
+    M     = std::clamp<int>(nr, 1, dim);
+    RANGE = M < dim ? 'I' : 'A';
+  } else if (ratio != 1.0) {
     M     = ceil(ratio * M); // round up
     M     = std::clamp<int>(M, 1, dim);        // at least 1, at most dim
     RANGE = 'I';
@@ -226,69 +337,89 @@ auto diagonalise_zheevr(CM &m, const double ratio = 1.0, const char jobz = 'V')
   // matrix obtained by reducing m to tridiagonal form.
   int MM = 0; // total number of eigenvalues found
   int LDZ = dim;
-  std::vector<int> ISUPPZ(2 * M);
+  auto &ws = workspace();
+  auto ISUPPZ = ws.isuppz(2 * M);
   //  The support of the eigenvectors in Z, i.e., the indices indicating the nonzero elements in Z.  The i-th
   //  eigenvector is nonzero only in elements ISUPPZ( 2*i-1 ) through ISUPPZ(2*i).
-  std::vector<lapack_complex_double> Z(LDZ * M); // eigenvectors
-  int LWORK0 = -1;                 // length of the WORK array (-1 == query!)
-  lapack_complex_double WORK0;
-  int LRWORK0 = -1;  // query
-  double RWORK0 = 0; // on exit: optimal RWORK size
-  int LIWORK0 = -1;  // query
-  int IWORK0 = 0;    // on exit: optimal IWORK size
+  // Eigenvectors are written directly into the result matrix, see diagonalise_dsyevr().
+  lapack_complex_double Zdummy; // not referenced if jobz='N'
+  auto vecs = Matrix_traits<std::complex<double>>(jobz == 'V' ? M : 0, dim);
+  auto Z = jobz == 'V' ? reinterpret_cast<lapack_complex_double*>(data(vecs)) : &Zdummy;
   // Step 1: determine optimal LWORK, LRWORK, and LIWORK
-  LAPACK_zheevr(&jobz, &RANGE, &UPLO, &NN, ham, &LDA, &VL, &VU, &IL, &IU, &ABSTOL, &MM, eigenvalues.data(), Z.data(), &LDZ, ISUPPZ.data(), &WORK0, &LWORK0,
-                &RWORK0, &LRWORK0, &IWORK0, &LIWORK0, &INFO);
-  my_assert(INFO == 0);
-  int LWORK   = int(WORK0.real);
-  std::vector<lapack_complex_double> WORK(LWORK);
-  int LRWORK  = int(RWORK0);
-  std::vector<double> RWORK(LRWORK);
-  int LIWORK  = IWORK0;
-  std::vector<int> IWORK(LIWORK);
+  const auto sizes = ws.query({"zheevr", jobz, RANGE, dim, M}, [&] {
+    int LWORK0 = -1;                 // length of the WORK array (-1 == query!)
+    lapack_complex_double WORK0;
+    int LRWORK0 = -1;  // query
+    double RWORK0 = 0; // on exit: optimal RWORK size
+    int LIWORK0 = -1;  // query
+    int IWORK0 = 0;    // on exit: optimal IWORK size
+    LAPACK_zheevr(&jobz, &RANGE, &UPLO, &NN, ham, &LDA, &VL, &VU, &IL, &IU, &ABSTOL, &MM, eigenvalues.data(), Z, &LDZ, ISUPPZ, &WORK0, &LWORK0,
+                  &RWORK0, &LRWORK0, &IWORK0, &LIWORK0, &INFO);
+    my_assert(INFO == 0);
+    return LapackWorkspace::Sizes{int(WORK0.real), IWORK0, int(RWORK0)};
+  });
+  int LWORK   = sizes.lwork;
+  auto WORK   = ws.zwork(LWORK);
+  int LRWORK  = sizes.lrwork;
+  auto RWORK  = ws.rwork(LRWORK);
+  int LIWORK  = sizes.liwork;
+  auto IWORK  = ws.iwork(LIWORK);
   // Step 2: perform the diagonalisation
-  LAPACK_zheevr(&jobz, &RANGE, &UPLO, &NN, ham, &LDA, &VL, &VU, &IL, &IU, &ABSTOL, &MM, eigenvalues.data(), Z.data(), &LDZ, ISUPPZ.data(), WORK.data(), &LWORK,
-                RWORK.data(), &LRWORK, IWORK.data(), &LIWORK, &INFO);
+  LAPACK_zheevr(&jobz, &RANGE, &UPLO, &NN, ham, &LDA, &VL, &VU, &IL, &IU, &ABSTOL, &MM, eigenvalues.data(), Z, &LDZ, ISUPPZ, WORK, &LWORK,
+                RWORK, &LRWORK, IWORK, &LIWORK, &INFO);
   if (INFO != 0) throw std::runtime_error(fmt::format("zheevr failed. INFO={}", INFO));
   if (MM != int(M)) {
     std::cout << "zheevr computed " << MM << "/" << M << std::endl;
     M = MM;
     my_assert(M > 0); // at least one
   }
-  return copy_results<std::complex<double>>(eigenvalues, Z.data(), jobz, dim, M);
+  return move_results<std::complex<double>>(eigenvalues, vecs, jobz, dim, M);
 }
 
 // Wrapper for the diagonalization of the Hamiltonian matrix. The number of eigenpairs returned does NOT need to be
-// equal to the dimension of the matrix h. Matrix m is destroyed in the process, thus no const attribute!
-template<matrix M> auto diagonalise(M &m, const DiagParams &DP, const int myrank) {
+// equal to the dimension of the matrix h. Matrix m is destroyed in the process, thus no const attribute! Its storage
+// may be reused for the eigenvectors.
+// If nrwanted>0, exactly nrwanted lowest eigenpairs are computed using dsyevr/zheevr (second phase of the two-phase
+// diagonalisation). If DP.jobz='N', all eigenvalues are computed, but no eigenvectors (first phase).
+template<matrix M> auto diagonalise(M &m, const DiagParams &DP, const int myrank, const size_t nrwanted = 0) {
   using S = typename M::value_type;
   const std::string rank_string = myrank >= 0 ? " [rank=" + std::to_string(myrank) + "]" : "";
-  mpilog("diagonalise " << size1(m) << "x" << size2(m) << " " << DP.diag << " " << DP.diagratio);
+  mpilog("diagonalise " << size1(m) << "x" << size2(m) << " " << DP.diag << " " << DP.diagratio << " " << DP.jobz << " " << nrwanted);
   nrglogdp('@', "diagonalise() - size(m)=" << size1(m) << rank_string);
   Timing timer;
   my_assert(is_matrix_upper(m));
+  const auto dim_m = size1(m); // m may be moved from
+  const auto jobz = DP.jobz;
+  const auto ratio = jobz == 'N' ? 1.0 : DP.diagratio; // all eigenvalues are required in the first phase
+  const bool partial = nrwanted > 0 && nrwanted < size1(m);
   RawEigen<S> d;
   if constexpr (std::is_same_v<S, double>) {
-    if (DP.diag == "dsyev"s || DP.diag == "default"s) d = diagonalise_dsyev(m);
-    if (DP.diag == "dsyevd"s) {
-      d = diagonalise_dsyevd(m);
-      if (d.getnrcomputed() == 0) {
-        std::cout << "dsyevd failed, falling back to dsyev" << std::endl;
-        d = diagonalise_dsyev(m);
+    if (partial) d = diagonalise_dsyevr(m, 1.0, jobz, nrwanted);
+    else {
+      if (DP.diag == "dsyev"s || DP.diag == "default"s) d = diagonalise_dsyev(m, jobz);
+      if (DP.diag == "dsyevd"s) {
+        d = diagonalise_dsyevd(m, jobz);
+        if (d.getnrcomputed() == 0) {
+          std::cout << "dsyevd failed, falling back to dsyev" << std::endl;
+          d = diagonalise_dsyev(m, jobz);
+        }
       }
+      if (DP.diag == "dsyevr"s) d = diagonalise_dsyevr(m, nrwanted ? 1.0 : ratio, jobz);
     }
-    if (DP.diag == "dsyevr"s) d = diagonalise_dsyevr(m, DP.diagratio);
   }
   if constexpr (std::is_same_v<S, std::complex<double>>) {
-    if (DP.diag == "zheev"s || DP.diag == "default"s) d = diagonalise_zheev(m);
-    if (DP.diag == "zheevr"s) d = diagonalise_zheevr(m, DP.diagratio);
+    if (partial) d = diagonalise_zheevr(m, 1.0, jobz, nrwanted);
+    else {
+      if (DP.diag == "zheev"s || DP.diag == "default"s) d = diagonalise_zheev(m, jobz);
+      if (DP.diag == "zheevr"s) d = diagonalise_zheevr(m, nrwanted ? 1.0 : ratio, jobz);
+    }
   }
   const auto nr_computed = d.getnrcomputed();
   my_assert(nr_computed > 0); // zero computed eigenvalues signals serious failure
-  my_assert(has_lesseq_rows(d.vec, m)); // sanity check
+  my_assert(nrvec(d.vec) <= dim_m && NRG::dim(d.vec) == dim_m); // sanity check
   if (DP.logletter('e'))
     d.dump_eigenvalues();
-  nrglogdp('A', "LAPACK, dim=" << dim(m) << " M=" << nr_computed << rank_string);
+  nrglogdp('A', "LAPACK, dim=" << dim_m << " M=" << nr_computed << rank_string);
   nrglogdp('t', "Elapsed: " << std::setprecision(3) << timer.total_in_seconds() << rank_string);
   return d;
 }
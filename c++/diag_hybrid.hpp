@@ -0,0 +1,135 @@
+#ifndef _diag_hybrid_hpp_
+#define _diag_hybrid_hpp_
+
+#include <memory>
+#include <vector>
+#include <numeric>
+#include <algorithm>
+#include <chrono>
+#include <utility>
+
+#include "traits.hpp"
+#include "step.hpp"
+#include "operators.hpp"
+#include "coef.hpp"
+#include "eigen.hpp"
+#include "output.hpp"
+#include "invar.hpp"
+#include "params.hpp"
+#include "symmetry.hpp"
+#include "subspaces.hpp"
+#include "diag_mpi.hpp"
+#include "diagengine.hpp"
+
+#include <fmt/format.h>
+
+namespace NRG {
+
+// Hybrid MPI+OpenMP diagonalisation engine. Each MPI rank (typically one per node or socket) diagonalises a batch
+// of subspaces using P.diagth OpenMP threads. The batches are determined in advance by the LPT (longest processing
+// time first) list-scheduling algorithm: the tasks are assigned in the order of decreasing cost to the rank that
+// would finish first. The cost of a task on rank r is rate[r]*dim^3, where the rate (time per unit of dim^3) is
+// measured in the previous steps, see TaskList::cost(). The Hamiltonian matrices are constructed on the slaves, see
+// DiagMPI::send_step(), except with h5raw && h5ham, when the DiagMPI scheduler is used.
+// Communication is performed through the underlying DiagMPI engine, which also runs the slave loop.
+template <scalar S>
+class DiagHybrid : public DiagEngine<S> {
+ private:
+   std::shared_ptr<DiagMPI<S>> mpi;
+   std::vector<double> rate; // measured time per unit of cost for each rank, 0 if not known yet
+   static constexpr double rate_memory = 0.5; // weight of the previous estimate in the running average
+   double rate_estimate(const size_t r) const {
+     if (rate[r] > 0) return rate[r];
+     std::vector<double> known;
+     std::copy_if(rate.begin(), rate.end(), std::back_inserter(known), [](const auto x) { return x > 0; });
+     return known.empty() ? 1.0 : std::accumulate(known.begin(), known.end(), 0.0) / double(known.size());
+   }
+   // LPT schedule: batch of tasks for each rank and the total cost of each batch
+   auto schedule(const std::vector<Invar> &tasks, const std::vector<double> &cost) const {
+     const auto nr = rate.size();
+     std::vector<std::vector<Invar>> batches(nr);
+     std::vector<double> finish(nr, 0.0), assigned(nr, 0.0);
+     std::vector<size_t> order(tasks.size());
+     std::iota(order.begin(), order.end(), 0);
+     std::stable_sort(order.begin(), order.end(), [&cost](const auto a, const auto b) { return cost[a] > cost[b]; });
+     for (const auto i : order) {
+       size_t best = 0;
+       for (size_t r = 1; r < nr; r++)
+         if (finish[r] + rate_estimate(r) * cost[i] < finish[best] + rate_estimate(best) * cost[i]) best = r;
+       finish[best] += rate_estimate(best) * cost[i];
+       assigned[best] += cost[i];
+       batches[best].push_back(tasks[i]);
+     }
+     return std::make_pair(batches, assigned);
+   }
+   void report(const std::vector<double> &elapsed, const std::vector<size_t> &nrtasks) const {
+     const auto makespan = *std::max_element(elapsed.begin(), elapsed.end());
+     std::string s;
+     for (size_t r = 0; r < elapsed.size(); r++)
+       s += fmt::format(" {}:{:.0f}%({})", r, makespan > 0 ? 100.0 * elapsed[r] / makespan : 100.0, nrtasks[r]);
+     fmt::print("[Hybrid] utilisation per rank (tasks):{} makespan={:.3g} s\n", s, makespan);
+   }
+ public:
+   explicit DiagHybrid(std::shared_ptr<DiagMPI<S>> mpi) : mpi(std::move(mpi)), rate(this->mpi->nrnodes(), 0.0) {}
+   DiagInfo<S> diagonalisations(const Step &step, const Opch<S> &opch, const Coef<S> &coef, const DiagInfo<S> &diagprev, const Output<S> &output,
+                                const std::vector<Invar> &tasks, const DiagParams &DP, const Symmetry<S> *Sym, const Params &P) override {
+     // The Hamiltonians for h5ham must be constructed on the master, where output.h5raw is available
+     if (P.h5raw && P.h5ham) return mpi->diagonalisations(step, opch, coef, diagprev, output, tasks, DP, Sym, P);
+     DiagInfo<S> diagnew;
+     const auto nrranks = rate.size();
+     const auto cost = TaskList::costs(tasks, diagprev, Sym);
+     const auto [batches, assigned] = schedule(tasks, cost);
+     mpi->send_params(DP);
+     mpi->send_step(step, opch, coef, diagprev, P);
+     std::vector<size_t> remaining(nrranks);
+     for (size_t r = 1; r < nrranks; r++) {
+       remaining[r] = batches[r].size();
+       if (remaining[r]) {
+         mpi->send_batch(int(r), batches[r]);
+         mpi->post_result(int(r));
+       }
+     }
+     std::vector<double> elapsed(nrranks, 0.0);
+     // Own batch
+     const auto start = std::chrono::steady_clock::now();
+     const auto &own = batches[0];
+     // cppcheck-suppress unreadVariable symbolName=nth
+     const int nth = P.diagth; // NOLINT
+#pragma omp parallel for schedule(dynamic) num_threads(nth)
+     for (size_t i = 0; i < own.size(); i++) {
+       auto h = hamiltonian(step, own[i], opch, coef, diagprev, output, Sym, P); // non-const, consumed by diagonalise()
+#pragma omp critical
+       { nrglog('(', "[Hybrid] Diagonalizing " << own[i] << " dim=" << dim(h) << " on rank 0"); }
+       auto e = diagonalise(h, DP, mpi->myrank(), DP.wanted(own[i]));
+#pragma omp critical
+       { diagnew[own[i]] = Eigen<S>(std::move(e), step); }
+     }
+     elapsed[0] = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+     // Results from the slaves, in the order of arrival
+     auto store = [&](const int source) {
+       auto [Irecv, eig] = mpi->read_from(source);
+       diagnew[Irecv] = Eigen<S>(std::move(eig), step);
+       if (--remaining[source])
+         mpi->post_result(source);
+       else
+         elapsed[source] = mpi->receive_time(source);
+     };
+     while (std::any_of(remaining.begin(), remaining.end(), [](const auto n) { return n > 0; }))
+       mpi->collect_results(true, store);
+     // Refine the cost model
+     std::vector<size_t> nrtasks(nrranks);
+     for (size_t r = 0; r < nrranks; r++) {
+       nrtasks[r] = batches[r].size();
+       if (assigned[r] > 0 && elapsed[r] > 0) {
+         const auto measured = elapsed[r] / assigned[r];
+         rate[r] = rate[r] > 0 ? rate_memory * rate[r] + (1.0 - rate_memory) * measured : measured;
+       }
+     }
+     report(elapsed, nrtasks);
+     return diagnew;
+   }
+};
+
+}
+
+#endif
@@ -5,6 +5,15 @@
 #include <list>
 #include <deque>
 #include <algorithm>
+#include <memory>
+#include <map>
+#include <vector>
+#include <fstream>
+#include <sstream>
+#include <iterator>
+#include <chrono>
+#include <optional>
+#include <tuple>
 
 #ifdef OMPI_SKIP_MPICXX // workaround to avoid warnings for for redefinition in mpi/environment.hpp
  #undef OMPI_SKIP_MPICXX
@@ -12,6 +21,7 @@
 #include <boost/mpi/environment.hpp>
 #include <boost/mpi/communicator.hpp>
 #include <boost/mpi/collectives.hpp> // broadcast
+#include <boost/mpi/nonblocking.hpp> // wait_some, test_some
 
 #include "traits.hpp"
 #include "invar.hpp"
@@ -22,20 +32,76 @@
 #include "diag.hpp"
 #include "misc.hpp"
 #include "core.hpp"
+#include "coef.hpp"
+#include "read-input.hpp"
 #include "diagengine.hpp"
+#include "mpi_transfer.hpp"
 
 namespace NRG {
 
-enum TAG : int { TAG_EXIT = 1, TAG_DIAG, TAG_SYNC, TAG_INVAR, TAG_MATRIX, TAG_MATRIX_PART, TAG_MATRIX_SIZE, TAG_VEC };
+enum TAG : int { TAG_EXIT = 1, TAG_DIAG, TAG_SYNC, TAG_INVAR, TAG_MATRIX, TAG_MATRIX_SIZE, TAG_VEC, TAG_STEP, TAG_HAM, TAG_RESULT, TAG_BATCH, TAG_TIME };
 
 template <scalar S>
 class DiagMPI : public DiagEngine<S>{
  private:
    boost::mpi::environment &mpienv;
    boost::mpi::communicator &mpiw;
+   // Slave-side Hamiltonian assembly (P.mpiham): the data required by hamiltonian_matrix(). Params and Symmetry are
+   // set up from the 'param' and 'data' files once, the rest is received from the master in each step.
+   struct SlaveContext {
+     std::unique_ptr<Params> P;
+     std::shared_ptr<Symmetry<S>> Sym;
+     std::unique_ptr<Coef<S>> coef;
+     std::unique_ptr<Step> step;
+     DiagInfo<S> diagprev; // eigenvalues only
+     Opch<S> opch;
+   };
+   std::unique_ptr<SlaveContext> ctx;
+   std::optional<std::tuple<int, size_t, int>> sent_step; // (trueN, ndx, runtype) of the last step broadcast
+   static constexpr size_t slave_slots = 2; // tasks in flight per slave, see diagonalisations()
+   // Matrices sent to the slaves using nonblocking operations, kept alive (together with the dimensions) until the
+   // transfer completes. The master does not wait for the transfer, but the MPI library only moves the data while it
+   // is called: purge_pending() is thus invoked from the scheduler loop between tasks. (The master's own
+   // diagonalisations contain no MPI calls, so a large message makes progress there only if the implementation has
+   // an asynchronous progress thread.)
+   struct PendingSend {
+     EigenMatrix<S> m;
+     mpi_dims dims;
+     std::vector<boost::mpi::request> reqs;
+   };
+   std::list<PendingSend> pending; // std::list: the addresses of m and dims are stable
+   void isend_matrix(const int dest, EigenMatrix<S> m) {
+     mpilog("Sending matrix of size " << size1(m) << " x " << size2(m) << " to " << dest << " (nonblocking)");
+     auto &p = pending.emplace_back(PendingSend{std::move(m), {}, {}});
+     p.reqs = NRG::isend_matrix(mpiw, dest, TAG_MATRIX_SIZE, TAG_MATRIX, p.m, p.dims);
+   }
+   // Drive the pending transfers (test_all calls into the MPI library) and release the completed ones.
+   void purge_pending() {
+     pending.remove_if([](auto &p) { return bool(boost::mpi::test_all(p.reqs.begin(), p.reqs.end())); });
+   }
+   void wait_pending() {
+     for (auto &p : pending) boost::mpi::wait_all(p.reqs.begin(), p.reqs.end());
+     pending.clear();
+   }
+   // Results from the slaves, see post_result()
+   std::vector<boost::mpi::request> results;
+   std::vector<size_t> nrvals; // result headers, indexed by rank
+   void slave_setup() {
+     std::ostringstream null; // silence the output on the slaves
+     auto cout_buf = std::cout.rdbuf(null.rdbuf());
+     ctx = std::make_unique<SlaveContext>();
+     ctx->P = std::make_unique<Params>("param", "param", std::make_unique<Workdir>(Workdir::existing, default_workdir), false, true);
+     std::ifstream fdata("data");
+     if (!fdata) throw std::runtime_error("Can't load initial data.");
+     const auto sym_string = parse_datafile_header(fdata);
+     const auto channels = read_one<size_t>(fdata);
+     ctx->Sym = set_symmetry<S>(*ctx->P, sym_string, channels);
+     ctx->coef = std::make_unique<Coef<S>>(*ctx->P);
+     std::cout.rdbuf(cout_buf);
+   }
 
  public:
-   DiagMPI(boost::mpi::environment &mpienv, boost::mpi::communicator &mpiw) : mpienv(mpienv), mpiw(mpiw) {}
+   DiagMPI(boost::mpi::environment &mpienv, boost::mpi::communicator &mpiw) : mpienv(mpienv), mpiw(mpiw), nrvals(mpiw.size()) {}
    ~DiagMPI() {
      for (auto i = 1; i < mpiw.size(); i++) mpiw.send(i, TAG_EXIT, 0); // notify slaves we are done
    }
@@ -52,52 +118,100 @@ class DiagMPI : public DiagEngine<S>{
      return DP;
    }
    void send_matrix(const int dest, const EigenMatrix<S> &m) {
-     mpilog("send_matrix() caled, dest=" << dest);
-     const size_t size1 = NRG::size1(m);
-     mpiw.send(dest, TAG_MATRIX_SIZE, size1);
-     const size_t size2 = NRG::size2(m);
-     mpiw.send(dest, TAG_MATRIX_SIZE, size2);
-     mpilog("Sending matrix of size " << size1 << " x " << size2 << " to " << dest);
-//   NOTE: MPI is limited to message size of 2GB (or 4GB). For big problems we thus need to send objects line by line.
-//   mpiw.send(dest, TAG_MATRIX, (S*)m.data(), size1*size2);
-     for (size_t i = 0; i < size1; i++)
-       mpiw.send(dest, TAG_MATRIX_PART, (S*)m.data() + i*size2, size2);
+     mpilog("Sending matrix of size " << size1(m) << " x " << size2(m) << " to " << dest);
+     NRG::send_matrix(mpiw, dest, TAG_MATRIX_SIZE, TAG_MATRIX, m);
    }
    auto receive_matrix(const int source) {
      mpilog("receive_matrix() called, source=" << source);
-     size_t size1;
-     mpiw.recv(source, TAG_MATRIX_SIZE, size1);
-     size_t size2;
-     mpiw.recv(source, TAG_MATRIX_SIZE, size2);
-     mpilog("Receiving matrix of size " << size1 << " x " << size2 << " from " << source);
-     EigenMatrix<S> m(size1, size2);
-//     mpiw.recv(source, TAG_MATRIX, (S*)m.data(), size1*size2);
-     for (size_t i = 0; i < size1; i++)
-       mpiw.recv(source, TAG_MATRIX_PART, (S*)m.data() + i*size2, size2);
-     return m;
+     return recv_matrix<S>(mpiw, source, TAG_MATRIX_SIZE, TAG_MATRIX);
    }
    void send_raweigen(const int dest, const RawEigen<S> &eig) {
      mpilog("Sending eigen from " << mpiw.rank() << " to " << dest);
-     mpiw.send(dest, TAG_VEC, eig.val);
+     const size_t nr = eig.val.size();
+     mpiw.send(dest, TAG_RESULT, nr);
+     mpiw.send(dest, TAG_VEC, eig.val.data(), int(nr));
      send_matrix(dest, eig.vec);
    }
-   auto receive_raweigen(const int source) {
+   auto receive_raweigen(const int source, const size_t nr) {
      mpilog("Receiving eigen from " << source << " on " << mpiw.rank());
      RawEigen<S> eig;
-     mpiw.recv(source, TAG_VEC, eig.val);
+     eig.val.resize(nr);
+     mpiw.recv(source, TAG_VEC, eig.val.data(), int(nr));
      eig.vec = receive_matrix(source);
      return eig;
-   } 
-   // Read results from a slave process.
+   }
+   // Read results from a slave process, after the result header has been received.
    std::pair<Invar, RawEigen<S>> read_from(const int source) {
      mpilog("Reading results from " << source);
-     const auto eig = receive_raweigen(source);
+     const auto eig = receive_raweigen(source, nrvals[source]);
      Invar Irecv;
      mpiw.recv(source, TAG_INVAR, Irecv);
      mpilog("Received results for subspace " << Irecv << " [nr=" << eig.getnrcomputed() << ", dim=" << eig.getdim() << "]");
      return {Irecv, eig};
    }
+   // When a task is scheduled on a slave, a receive for the result header (the number of eigenvalues, TAG_RESULT) is
+   // posted. The remaining data is read once this request completes.
+   void post_result(const int source) {
+     results.push_back(mpiw.irecv(source, TAG_RESULT, nrvals[source]));
+   }
+   // Process the results that have arrived. If wait is true, block until at least one result is available.
+   template <typename F> void collect_results(const bool wait, F store) {
+     std::vector<boost::mpi::status> done;
+     const auto first_done = wait ? boost::mpi::wait_some(results.begin(), results.end(), std::back_inserter(done)).second
+                                  : boost::mpi::test_some(results.begin(), results.end(), std::back_inserter(done)).second;
+     results.erase(first_done, results.end());
+     for (const auto &status : done) store(status.source());
+   }
+   // Broadcast the input for the Hamiltonian matrix construction on the slaves (P.mpiham). This is O(size of
+   // <||f||>) per step, while the matrices themselves are O(dim^2) per task. The data only changes from step to step,
+   // so repeated calls for the same step (two-phase diagonalisation, restarts in do_diag()) send nothing. Nmax and
+   // Nlen are sent along, since the slaves do not process the discretization data, see determine_Nmax_Nlen().
+   void send_step(const Step &step, const Opch<S> &opch, const Coef<S> &coef, const DiagInfo<S> &diagprev, const Params &P) {
+     auto trueN = step.get_trueN();
+     auto runtype = int(step.get_runtype());
+     const auto key = std::make_tuple(trueN, step.ndx(), runtype);
+     if (sent_step == key) return;
+     sent_step = key;
+     mpilog("Sending step data, N=" << trueN);
+     for (auto i = 1; i < mpiw.size(); i++) mpiw.send(i, TAG_STEP, 0);
+     auto Nmax = P.Nmax;
+     auto Nlen = P.Nlen;
+     std::map<Invar, std::vector<eigen_traits<S>>> energies; // corrected eigenvalues of the stored states
+     for (const auto &[I, eig] : diagprev)
+       energies[I] = std::vector(eig.values.all_corr().begin(), eig.values.all_corr().begin() + eig.getnrstored());
+     auto opchcopy = opch;
+     auto coefcopy = coef;
+     boost::mpi::broadcast(mpiw, Nmax, 0);
+     boost::mpi::broadcast(mpiw, Nlen, 0);
+     boost::mpi::broadcast(mpiw, trueN, 0);
+     boost::mpi::broadcast(mpiw, runtype, 0);
+     boost::mpi::broadcast(mpiw, energies, 0);
+     boost::mpi::broadcast(mpiw, opchcopy, 0);
+     boost::mpi::broadcast(mpiw, coefcopy, 0);
+   }
+   void receive_step() {
+     if (!ctx) slave_setup();
+     int trueN{}, runtype{};
+     std::map<Invar, std::vector<eigen_traits<S>>> energies;
+     boost::mpi::broadcast(mpiw, ctx->P->Nmax, 0);
+     boost::mpi::broadcast(mpiw, ctx->P->Nlen, 0);
+     boost::mpi::broadcast(mpiw, trueN, 0);
+     boost::mpi::broadcast(mpiw, runtype, 0);
+     boost::mpi::broadcast(mpiw, energies, 0);
+     boost::mpi::broadcast(mpiw, ctx->opch, 0);
+     boost::mpi::broadcast(mpiw, *ctx->coef, 0);
+     ctx->step = std::make_unique<Step>(*ctx->P, RUNTYPE(runtype));
+     ctx->step->set(trueN);
+     ctx->diagprev.clear();
+     for (auto &[I, e] : energies) {
+       auto &eig = ctx->diagprev[I];
+       eig.values.set_corr(e);
+       eig.values.set(std::move(e));
+     }
+     mpilog("Received step data, N=" << trueN);
+   }
    auto myrank() { return mpiw.rank(); }
+   auto nrnodes() { return mpiw.size(); }
    // Handle a diagonalisation request
    void slave_diag(const int master, const DiagParams &DP) {
      // 1. receive the matrix and the subspace identification
@@ -107,20 +221,84 @@ class DiagMPI : public DiagEngine<S>{
      mpilog("Received I=" << I);
      auto m = receive_matrix(master);
      // 2. preform the diagonalisation
-     const auto eig = diagonalise(m, DP, myrank());
+     const auto eig = diagonalise(m, DP, myrank(), DP.wanted(I));
      // 3. send back the results
      send_raweigen(master, eig);
      mpiw.send(master, TAG_INVAR, I);
    }
+   // Handle a diagonalisation request with the Hamiltonian matrix constructed on the slave
+   void slave_diag_ham(const int master, const DiagParams &DP) {
+     mpilog("slave_diag_ham() called, master=" << master);
+     Invar I;
+     mpiw.recv(master, TAG_INVAR, I);
+     my_assert(ctx && ctx->step);
+     auto h = hamiltonian_matrix(*ctx->step, I, ctx->opch, *ctx->coef, ctx->diagprev, ctx->Sym.get(), *ctx->P);
+     const auto eig = diagonalise(h, DP, myrank(), DP.wanted(I));
+     send_raweigen(master, eig);
+     mpiw.send(master, TAG_INVAR, I);
+   }
+   // Send a batch of tasks to a slave (DiagHybrid). The Hamiltonian matrices are constructed on the slave.
+   void send_batch(const int dest, const std::vector<Invar> &batch) {
+     mpilog("Sending batch of " << batch.size() << " tasks to " << dest);
+     mpiw.send(dest, TAG_BATCH, 0);
+     mpiw.send(dest, TAG_INVAR, batch);
+   }
+   // Handle a batch request: diagonalise all tasks using P.diagth threads, then send back the results one by one,
+   // followed by the wall-clock time spent in the diagonalisations.
+   void slave_diag_batch(const int master, const DiagParams &DP) {
+     mpilog("slave_diag_batch() called, master=" << master);
+     std::vector<Invar> batch;
+     mpiw.recv(master, TAG_INVAR, batch);
+     my_assert(ctx && ctx->step);
+     const auto start = std::chrono::steady_clock::now();
+     std::vector<RawEigen<S>> eigs(batch.size());
+     // cppcheck-suppress unreadVariable symbolName=nth
+     const int nth = ctx->P->diagth; // NOLINT
+#pragma omp parallel for schedule(dynamic) num_threads(nth)
+     for (size_t i = 0; i < batch.size(); i++) {
+       auto h = hamiltonian_matrix(*ctx->step, batch[i], ctx->opch, *ctx->coef, ctx->diagprev, ctx->Sym.get(), *ctx->P);
+       eigs[i] = diagonalise(h, DP, myrank(), DP.wanted(batch[i]));
+     }
+     const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+     for (size_t i = 0; i < batch.size(); i++) {
+       send_raweigen(master, eigs[i]);
+       mpiw.send(master, TAG_INVAR, batch[i]);
+       eigs[i] = RawEigen<S>(); // release memory
+     }
+     mpiw.send(master, TAG_TIME, elapsed.count());
+   }
+   auto receive_time(const int source) {
+     double t{};
+     mpiw.recv(source, TAG_TIME, t);
+     return t;
+   }
    DiagInfo<S> diagonalisations(const Step &step, const Opch<S> &opch, const Coef<S> &coef, const DiagInfo<S> &diagprev, const Output<S> &output,
                                 const std::vector<Invar> &tasks, const DiagParams &DP, const Symmetry<S> *Sym, const Params &P) {
        DiagInfo<S> diagnew;
        send_params(DP);                                         // Synchronise parameters
+       const bool slave_ham = P.mpiham && mpiw.size() > 1 && !(P.h5raw && P.h5ham);
+       if (slave_ham) send_step(step, opch, coef, diagprev, P);
        std::list<Invar> tasks_todo(tasks.begin(), tasks.end());
        std::list<Invar> tasks_done;
-       std::deque<int> nodes_available(mpiw.size());            // Available nodes including the master, which is always at the head of the deque
-       std::iota(nodes_available.begin(), nodes_available.end(), 0);
-       nrglog('M', "nrtasks=" << tasks_todo.size() << " nrnodes=" << nodes_available.size());
+       // Free task slots. The master has one slot and is always at the head of the deque. Each slave has
+       // slave_slots slots: while it diagonalises one task, the next one is already sent to it, so that the
+       // transfer of the input overlaps with the computation on the slave.
+       std::deque<int> nodes_available{0};
+       for (size_t k = 0; k < slave_slots; k++)
+         for (auto i = 1; i < mpiw.size(); i++) nodes_available.push_back(i);
+       nrglog('M', "nrtasks=" << tasks_todo.size() << " nrnodes=" << mpiw.size());
+       // Tasks sent to each slave and not yet completed. The slaves process their tasks in order, and only one
+       // receive for the result header is posted at a time for each slave.
+       std::vector<size_t> outstanding(mpiw.size(), 0);
+       auto expect_result = [&](const int i) { if (outstanding[i]++ == 0) post_result(i); };
+       auto store = [&](const int source) {
+         nrglog('M', "Receiving results from " << source);
+         auto [Irecv, eig] = read_from(source);
+         diagnew[Irecv] = Eigen<S>(std::move(eig), step);
+         tasks_done.push_back(Irecv);
+         if (--outstanding[source]) post_result(source);
+         nodes_available.push_back(source); // A slot on this node is now available for new tasks!
+       };
        while (!tasks_todo.empty()) {
          my_assert(!nodes_available.empty());
          // i is the node to which the next job will be scheduled. (If a single task is left undone, do it on the master
@@ -128,36 +306,42 @@ class DiagMPI : public DiagEngine<S>{
          const auto i = tasks_todo.size() != 1 ? get_back(nodes_available) : 0;
          // On master, we take short jobs from the end. On slaves, we take long jobs from the beginning.
          const Invar I = i == 0 ? get_back(tasks_todo) : get_front(tasks_todo);
-         auto h = hamiltonian(step, I, opch, coef, diagprev, output, Sym, P); // non-const
-         nrglog('M', "Scheduler: job " << I << " (dim=" << dim(h) << ")" << " on node " << i);
          if (i == 0) {
-           // On master, diagonalize immediately.
-           auto e = diagonalise(h, DP, myrank());
+           // On master, diagonalize immediately. Push the pending sends as far as possible first.
+           purge_pending();
+           auto h = hamiltonian(step, I, opch, coef, diagprev, output, Sym, P); // non-const
+           nrglog('M', "Scheduler: job " << I << " (dim=" << dim(h) << ")" << " on node " << i);
+           auto e = diagonalise(h, DP, myrank(), DP.wanted(I));
            diagnew[I] = Eigen<S>(std::move(e), step);
            tasks_done.push_back(I);
            nodes_available.push_back(0);
+         } else if (slave_ham) {
+           // The slave builds the matrix itself.
+           nrglog('M', "Scheduler: job " << I << " on node " << i);
+           mpiw.send(i, TAG_HAM, 0);
+           mpiw.send(i, TAG_INVAR, I);
+           expect_result(i);
          } else {
+           auto h = hamiltonian(step, I, opch, coef, diagprev, output, Sym, P); // non-const
+           nrglog('M', "Scheduler: job " << I << " (dim=" << dim(h) << ")" << " on node " << i);
            mpiw.send(i, TAG_DIAG, 0);
            mpiw.send(i, TAG_INVAR, I);
-           send_matrix(i, h);
+           isend_matrix(i, std::move(h));
+           expect_result(i);
          }
+         purge_pending();
          // Check for terminated jobs
-         while (auto status = mpiw.iprobe(boost::mpi::any_source, TAG_VEC)) {
-           nrglog('M', "Receiveing results from " << status->source());
-           auto [Irecv, eig] = read_from(status->source());
-           diagnew[Irecv] = Eigen<S>(std::move(eig), step);
-           tasks_done.push_back(Irecv);
-           // The node is now available for new tasks!
-           nodes_available.push_back(status->source());
-         }
+         collect_results(false, store);
        }
-       // Keep reading results sent from the slave processes until all tasks have been completed.
-       while (tasks_done.size() != tasks.size()) {
-         const auto status = mpiw.probe(boost::mpi::any_source, TAG_VEC);
-         auto [Irecv, eig]  = read_from(status.source());
-         diagnew[Irecv] = Eigen<S>(std::move(eig), step);
-         tasks_done.push_back(Irecv);
+       // Keep reading results sent from the slave processes until all tasks have been completed. While matrices are
+       // still in transit, poll both the sends and the results; then block on the results.
+       while (!pending.empty() && tasks_done.size() != tasks.size()) {
+         purge_pending();
+         collect_results(false, store);
        }
+       while (tasks_done.size() != tasks.size())
+         collect_results(true, store);
+       wait_pending();
        return diagnew;
    }
 };
@@ -1,6 +1,9 @@
 #ifndef _diag_openmp_hpp_
 #define _diag_openmp_hpp_
 
+#include <vector>
+#include <algorithm>
+
 #include "traits.hpp"
 #include "step.hpp"
 #include "operators.hpp"
@@ -10,15 +13,53 @@
 #include "invar.hpp"
 #include "params.hpp"
 #include "symmetry.hpp"
+#include "subspaces.hpp"
+#include "openmp.hpp"
 #include "diagengine.hpp"
 
 namespace NRG {
 
 template<scalar S>
 class DiagOpenMP : public DiagEngine<S> {
+private:
+   // Two-phase scheduling. A subspace whose cost (see TaskList::costs()) exceeds the average load per core, i.e. the
+   // total cost divided by diagth, would alone determine the duration of the step if diagonalised on a single core.
+   // The small subspaces are diagonalised first, concurrently, with single-threaded LAPACK. The large ones are then
+   // diagonalised one after another, each using multithreaded LAPACK on all diagth cores. The number of BLAS threads
+   // is only changed outside parallel regions, thus this also works with libraries where it is a global setting
+   // (OpenBLAS with pthreads), see set_blas_threads().
+   DiagInfo<S> nested(const Step &step, const Opch<S> &opch, const Coef<S> &coef, const DiagInfo<S> &diagprev, const Output<S> &output,
+                      const std::vector<Invar> &tasks, const DiagParams &DP, const Symmetry<S> *Sym, const Params &P) {
+     DiagInfo<S> diagnew;
+     const auto nr = tasks.size();
+     const int nth = P.diagth;
+     const auto cost = TaskList::costs(tasks, diagprev, Sym);
+     const auto limit = ranges::accumulate(cost, 0.0) / nth;
+     std::vector<size_t> small, large;
+     for (size_t itask = 0; itask < nr; itask++) (cost[itask] > limit ? large : small).push_back(itask);
+     auto diag = [&](const size_t itask, const int cores) {
+       const Invar I = tasks[itask];
+       auto h = hamiltonian(step, I, opch, coef, diagprev, output, Sym, P, cores); // non-const, consumed by diagonalise()
+       const int thid = omp_get_thread_num();
+#pragma omp critical
+       { nrglog('(', "[OpenMP] Diagonalizing " << I << " dim=" << dim(h) << " (task " << itask + 1 << "/" << nr << ", thread " << thid << ", cores " << cores << ")"); }
+       auto e = diagonalise(h, DP, -1, DP.wanted(I)); // -1 = not using MPI
+#pragma omp critical
+       { diagnew[I] = Eigen(std::move(e), step); }
+     };
+     const auto blas = get_blas_threads();
+     set_blas_threads(1);
+#pragma omp parallel for schedule(dynamic) num_threads(nth)
+     for (size_t k = 0; k < small.size(); k++) diag(small[k], 1);
+     set_blas_threads(nth);
+     for (const auto itask : large) diag(itask, nth);
+     set_blas_threads(blas);
+     return diagnew;
+   }
 public:
    DiagInfo<S> diagonalisations(const Step &step, const Opch<S> &opch, const Coef<S> &coef, const DiagInfo<S> &diagprev, const Output<S> &output,
                                 const std::vector<Invar> &tasks, const DiagParams &DP, const Symmetry<S> *Sym, const Params &P) {
+     if (P.diagnested) return nested(step, opch, coef, diagprev, output, tasks, DP, Sym, P);
      DiagInfo<S> diagnew;
      const auto nr = tasks.size();
      size_t itask = 0;
@@ -31,7 +72,7 @@ public:
        const int thid = omp_get_thread_num();
 #pragma omp critical
        { nrglog('(', "[OpenMP] Diagonalizing " << I << " dim=" << dim(h) << " (task " << itask + 1 << "/" << nr << ", thread " << thid << ")"); }
-       auto e = diagonalise(h, DP, -1); // -1 = not using MPI
+       auto e = diagonalise(h, DP, -1, DP.wanted(I)); // -1 = not using MPI
 #pragma omp critical
        { diagnew[I] = Eigen(std::move(e), step); }
      }
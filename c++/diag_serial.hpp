@@ -23,7 +23,7 @@ public:
      for (const auto &I: tasks) {
        auto h = hamiltonian(step, I, opch, coef, diagprev, output, Sym, P);
        nrglog('(', "[serial] Diagonalizing " << I << " dim=" << dim(h));
-       auto e = diagonalise(h, DP, -1); // -1 = not using MPI
+       auto e = diagonalise(h, DP, -1, DP.wanted(I)); // -1 = not using MPI
        diagnew[I] = Eigen(std::move(e), step);
      }
      return diagnew;
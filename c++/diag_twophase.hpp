@@ -0,0 +1,78 @@
+#ifndef _diag_twophase_hpp_
+#define _diag_twophase_hpp_
+
+#include <memory>
+#include <optional>
+#include <algorithm>
+
+#include "traits.hpp"
+#include "step.hpp"
+#include "operators.hpp"
+#include "coef.hpp"
+#include "eigen.hpp"
+#include "output.hpp"
+#include "invar.hpp"
+#include "params.hpp"
+#include "symmetry.hpp"
+#include "splitting.hpp"
+#include "truncation.hpp"
+#include "diagengine.hpp"
+
+#include <fmt/format.h>
+
+namespace NRG {
+
+// Eigenvalue-first diagonalisation. In the first phase, only the eigenvalues are computed in all subspaces. From
+// these, the truncation cutoff Emax is determined in the same way as in truncate_prepare(). In the second phase, the
+// eigenvectors are computed only for the states with E<=Emax and one additional state per subspace (required to
+// establish that a sufficient number of states has been computed). The actual diagonalisations are performed by the
+// underlying engine (serial, OpenMP or MPI).
+template<scalar S>
+class DiagTwoPhase : public DiagEngine<S> {
+ private:
+   std::shared_ptr<DiagEngine<S>> eng;
+   std::optional<size_t> prev_ndx; // step index of the previous call, used to detect restarts in do_diag()
+   // Number of eigenpairs required in each subspace
+   auto wanted(const Step &step, DiagInfo<S> &spectrum, const Params &P) {
+     std::map<Invar, size_t> nrwanted;
+     spectrum.Egs_subtraction();
+     Clusters<S> clusters(spectrum, P.fixeps);
+     const auto Emax = highest_retained_energy(step, spectrum, P);
+     const bool all = step.last() && P.keep_all_states_in_last_step();
+     for (const auto &[I, eig] : spectrum) {
+       const size_t nr = 1 + ranges::count_if(eig.values.all_corr(), [Emax](const double e) { return e <= Emax; });
+       nrwanted[I] = all ? eig.getdim() : std::min(nr, eig.getdim());
+     }
+     return nrwanted;
+   }
+ public:
+   explicit DiagTwoPhase(std::shared_ptr<DiagEngine<S>> eng) : eng(std::move(eng)) {}
+   DiagInfo<S> diagonalisations(const Step &step, const Opch<S> &opch, const Coef<S> &coef, const DiagInfo<S> &diagprev, const Output<S> &output,
+                                const std::vector<Invar> &tasks, const DiagParams &DP, const Symmetry<S> *Sym, const Params &P) override {
+     // If the cutoff determined in the first phase turns out to be insufficient, do_diag() calls us again for the
+     // same step. In this case all eigenpairs are computed.
+     const bool restarted = prev_ndx == step.ndx();
+     prev_ndx = step.ndx();
+     if (restarted) {
+       std::cout << "Two-phase diagonalisation: computing all eigenpairs." << std::endl;
+       return eng->diagonalisations(step, opch, coef, diagprev, output, tasks, DP, Sym, P);
+     }
+     auto DPval = DP;
+     DPval.jobz = 'N';
+     auto spectrum = eng->diagonalisations(step, opch, coef, diagprev, output, tasks, DPval, Sym, P);
+     auto DPvec = DP;
+     DPvec.nrwanted = wanted(step, spectrum, P);
+     size_t nrvec = 0, nrall = 0;
+     for (const auto &[I, eig] : spectrum) {
+       nrvec += DPvec.wanted(I);
+       nrall += eig.getdim();
+       nrglog('A', "Two-phase: " << I << " dim=" << eig.getdim() << " M=" << DPvec.wanted(I));
+     }
+     fmt::print("Two-phase diagonalisation: eigenvectors for {} out of {} states\n", nrvec, nrall);
+     return eng->diagonalisations(step, opch, coef, diagprev, output, tasks, DPvec, Sym, P);
+   }
+};
+
+}
+
+#endif
@@ -64,11 +64,11 @@ auto init_rho(const Step &step, const DiagInfo<S> &diag_in, const Symmetry<S> *S
 
 // Calculation of the contribution from subspace I1 of rhoN (density matrix at iteration N) to rhoNEW (density matrix
 // at iteration N-1)
-template<scalar S, typename Matrix = Matrix_traits<S>, typename t_coef = coef_traits<S>>
+template<scalar S, typename MU, typename Matrix = Matrix_traits<S>, typename t_coef = coef_traits<S>>
 void cdmI(const size_t i,        // Subspace index
           const Invar &I1,       // Quantum numbers corresponding to subspace i
           const Matrix &rhoN,    // rho^N
-          const Eigen<S> &diagI1,   // contains U_{I1}
+          const MU &UI1,         // U_{I1}, eigenvectors in rows
           Matrix &rhoNEW,        // rho^{N-1}
           const size_t N,
           const t_coef factor, // multiplicative factor that accounts for multiplicity
@@ -87,15 +87,18 @@ void cdmI(const size_t i,        // Subspace index
   if (rmax == 0) return;    // rmax can be zero in the case a subspace has been completely truncated
   my_assert(rmax == dim);   // Otherwise, rmax must equal dim
   // Check range of omega: do the dimensions of C^N_I1(omega omega') and U^N_I1(omega|r1) match?
-  my_assert(nromega <= diagI1.getnrstored());
-  const auto U = diagI1.vectors.submatrix_const({0, nromega}, store_all[N].at(I1).rmax.part(i)); // YYY: Ublock ??
-  rotate<S>(rhoNEW, factor, U, rhoN);
+  my_assert(nromega <= size1(UI1));
+  const auto U = submatrix_const(UI1, {0, nromega}, store_all[N].at(I1).rmax.part(i));
+  if (P.recalchermitian)
+    rotate_lower<S>(rhoNEW, std::real(factor), U, rhoN); // upper triangle restored by the caller
+  else
+    rotate<S>(rhoNEW, factor, U, rhoN);
 }
 
 // Calculation of the shell-N REDUCED DENSITY MATRICES: Calculate rho at previous iteration (N-1) from rho
 // at the current iteration (N, rho)
 template<scalar S>
-auto calc_densitymatrix_iterN(const DiagInfo<S> &diag, const DensMatElements<S> &rho,
+auto calc_densitymatrix_iterN(const UnitaryFile<S> &diag, const DensMatElements<S> &rho,
                               const size_t N, const Store<S> &store_all, const Symmetry<S> *Sym, const Params &P) {
   nrglog('D', "calc_densitymatrix_iterN N=" << N);
   DensMatElements<S> rhoPrev;
@@ -106,10 +109,10 @@ auto calc_densitymatrix_iterN(const DiagInfo<S> &diag, const DensMatElements<S>
     const auto ns = Sym->new_subspaces(I);
     for (const auto &[i, sub] : ns | ranges::views::enumerate) {
       const auto x = rho.find(sub);
-      const auto y = diag.find(sub);
-      if (x != rho.end() && y != diag.end())
-        cdmI(i, sub, x->second, y->second, rhoPrev[I], N, double(Sym->mult(sub)) / double(Sym->mult(I)), store_all, P);
+      if (x != rho.end() && diag.contains(sub))
+        cdmI(i, sub, x->second, diag.vectors(sub), rhoPrev[I], N, double(Sym->mult(sub)) / double(Sym->mult(I)), store_all, P);
     }
+    if (P.recalchermitian) hermitian_mirror(rhoPrev[I]);
   }
   return rhoPrev;
 }
@@ -118,7 +121,7 @@ auto calc_densitymatrix_iterN(const DiagInfo<S> &diag, const DensMatElements<S>
 inline bool already_computed(const std::string &prefix, const Params &P) {
   for (auto N = P.Nmax - 1; N > P.Ninit; N--) {
     const std::string fn = P.workdir->rhofn(N-1, prefix); // note the minus 1
-    if (!file_exists(fn)) {
+    if (!P.workdir->exists(fn)) {
       std::cout << fn << " not found. Computing." << std::endl;
       return false;
     }
@@ -135,14 +138,21 @@ void calc_densitymatrix(DensMatElements<S> &rho, const Store<S> &store_all, cons
   check_trace_rho(rho, Sym->multfnc()); // Must be 1.
   if (P.ZBW()) return;
   const auto section_timing = mt.time_it("DM");
+  EigenvectorProvider<S> eigenvectors(P);
+  AsyncStepIO<DensMatElements<S>> rho_io(nullptr, P.asyncio); // writing only
   for (size_t N = P.Nmax - 1; N > P.Ninit; N--) {
     std::cout << "[DM] " << N << std::endl;
-    const DiagInfo<S> diag_loaded(N, P);
+    const auto diag_loaded = eigenvectors(N);
+    if (N-1 > P.Ninit) eigenvectors.prefetch(N-1); // overlaps with the computation below
     auto rhoPrev = calc_densitymatrix_iterN(diag_loaded, rho, N, store_all, Sym, P); // need store_all for backiteration!
     check_trace_rho(rhoPrev, Sym->multfnc()); // Make sure rho is normalized to 1.
-    rhoPrev.save(N-1, P, filename);
+    rho_io.write([rhoPrev, N, &P, filename] { rhoPrev.save(N-1, P, filename); }); // a copy is written
     rho.swap(rhoPrev);
   }
+  rho_io.flush();
+  release_scratch();
+  eigenvectors.statistics().report("DM unitary");
+  rho_io.statistics().report("DM rho");
 }
 
 // ****************** Calculation of the FULL REDUCED DENSITY MATIRICES
@@ -163,7 +173,7 @@ DensMatElements<S> init_rho_FDM(const size_t N, const Store<S> &store, const Sta
     rhoFDM[I] = zero_matrix<S>(ds.max());
     if (stats.ZnDNd[N] != 0.0)
       for (const auto i: ds.all())
-        rhoFDM[I](i, i) = exp(-ds.eig.values.abs_zero(i) / T) * stats.wn[N] / stats.ZnDNd[N];
+        rhoFDM[I](i, i) = exp(-ds.values.abs_zero(i) / T) * stats.wn[N] / stats.ZnDNd[N];
   }
   if (stats.wn[N] != 0.0) { // note: wn \propto ZnDNd, so this is the same condition as above
     // Trace should be equal to the total weight of the shell-N contribution to the FDM.
@@ -176,7 +186,7 @@ DensMatElements<S> init_rho_FDM(const size_t N, const Store<S> &store, const Sta
 
 template<scalar S>
 auto calc_fulldensitymatrix_iterN(const Step &step, // only required for step::last()
-                                  const DiagInfo<S> &diag,
+                                  const UnitaryFile<S> &diag,
                                   const DensMatElements<S> &rhoFDM, // input
                                   const size_t N, const Store<S> &store, const Store<S> &store_all, const Stats<S> &stats,
                                   const Symmetry<S> *Sym, const Params &P) {
@@ -195,16 +205,18 @@ auto calc_fulldensitymatrix_iterN(const Step &step, // only required for step::l
       // DM construction for non-Abelian symmetries: must include the ratio of multiplicities as a coefficient.
       const auto coef = double(Sym->mult(sub)) / double(Sym->mult(I));
       // Contribution from the KK sector.
+      if (!diag.contains(sub)) continue;
+      const auto U = diag.vectors(sub);
       const auto x1 = rhoFDM.find(sub);
-      const auto y = diag.find(sub);
-      if (x1 != rhoFDM.end() && y != diag.end())
-        cdmI(i, sub, x1->second, y->second, rhoFDMPrev[I], N, coef, store_all, P);
+      if (x1 != rhoFDM.end())
+        cdmI(i, sub, x1->second, U, rhoFDMPrev[I], N, coef, store_all, P);
       // Contribution from the DD sector. rhoDD -> rhoFDMPrev
       if (!step.last(N))
-        if (const auto x2 = rhoDD.find(sub); x2 !=rhoDD.end() && y != diag.end())
-          cdmI(i, sub, x2->second, y->second, rhoFDMPrev[I], N, coef, store_all, P);
+        if (const auto x2 = rhoDD.find(sub); x2 !=rhoDD.end())
+          cdmI(i, sub, x2->second, U, rhoFDMPrev[I], N, coef, store_all, P);
       // (Exception: for the N-1 iteration, the rhoPrev is already initialized with the DD sector of the last iteration.) }
     } // over combinations
+    if (P.recalchermitian) hermitian_mirror(rhoFDMPrev[I]);
   } // over subspaces
   return rhoFDMPrev;
 }
@@ -215,18 +227,25 @@ void calc_fulldensitymatrix(const Step &step, DensMatElements<S> &rhoFDM, const
   if (P.resume && already_computed(filename, P)) return;
   if (P.ZBW()) return;
   const auto section_timing = mt.time_it("FDM");
+  EigenvectorProvider<S> eigenvectors(P);
+  AsyncStepIO<DensMatElements<S>> rho_io(nullptr, P.asyncio); // writing only
   for (size_t N = P.Nmax - 1; N > P.Ninit; N--) {
     std::cout << "[FDM] " << N << std::endl;
-    const DiagInfo<S> diag_loaded(N, P); // = load_and_project(N, Sym, P);
+    const auto diag_loaded = eigenvectors(N); // = load_and_project(N, Sym, P);
+    if (N-1 > P.Ninit) eigenvectors.prefetch(N-1);
     auto rhoFDMPrev        = calc_fulldensitymatrix_iterN(step, diag_loaded, rhoFDM, N, store, store_all, stats, Sym, P);
     const auto tr          = rhoFDMPrev.trace(Sym->multfnc());
     const auto expected    = std::accumulate(stats.wn.begin() + N, stats.wn.begin() + P.Nmax, 0.0);
     const auto diff        = (tr - expected) / expected;
     nrglog('w', "tr[rhoFDM(" << N << ")]=" << tr << " sum(wn)=" << expected << " diff=" << diff);
     my_assert(num_equal(diff, 0.0));
-    rhoFDMPrev.save(N-1, P, filename);
+    rho_io.write([rhoFDMPrev, N, &P, filename] { rhoFDMPrev.save(N-1, P, filename); });
     rhoFDM.swap(rhoFDMPrev);
   }
+  rho_io.flush();
+  release_scratch();
+  eigenvectors.statistics().report("FDM unitary");
+  rho_io.statistics().report("FDM rho");
 }
 
 } // namespace
@@ -2,7 +2,10 @@
 #define _eigen_hpp_
 
 #include <vector>
+#include <map>
 #include <string>
+#include <sstream>
+#include <utility>
 #include <limits> // quiet_NaN
 #include <stdexcept>
 
@@ -18,6 +21,7 @@
 #include "step.hpp"
 #include "h5.hpp"
 #include "numerics.hpp"
+#include "block_file.hpp"
 
 #include <fmt/format.h>
 
@@ -125,57 +129,82 @@ class Vectors {
       resize(0, d); // Shrink to zero size, but keep the information about the dimensionality!!
       assert(M() == 0 && dim() == d);
     }
+    [[nodiscard]] Matrix release() { // hand over the storage, as in shrink() the dimensionality is retained
+      const auto d = dim();
+      auto tmp = std::move(m);
+      m.resize(0, d);
+      return tmp;
+    }
     void save(boost::archive::binary_oarchive &oa) const {
       NRG::save(oa, m);
     }
     void load(boost::archive::binary_iarchive &ia) {
       m = NRG::load<S>(ia);
     }
+    void load(Matrix m_) { m = std::move(m_); } // eigenvectors read back from a file, no checks
     void h5save(H5Easy::File &fd, const std::string &name) const {
       h5_dump_matrix(fd, name + "/matrix", m);
     }
 };
 
 // Eigenvectors separated according to the invariant subspace from which they originate.
-// Required for using efficient BLAS routines when performing recalculations of the matrix elements.
+// Required for using efficient BLAS routines when performing recalculations of the matrix elements. The blocks are
+// views (strided column ranges) into a single eigenvector matrix, whose storage is taken over from Vectors without
+// copying. Truncation only reduces the number of rows in the views.
 template <scalar S, typename Matrix = Matrix_traits<S>>
 class Blocks {
 private:
-  std::vector<Matrix> blocks;
+  Matrix m;                                      // eigenvectors (in rows)
+  size_t nr = 0;                                 // number of eigenvectors in the blocks
+  std::vector<std::pair<size_t, size_t>> parts;  // column ranges [begin, end)
 public:
-  void resize(const size_t nr) {
-    blocks.resize(nr);
-  }
-  void set(const size_t i, Matrix m) {
-    assert(i < blocks.size());
-    blocks[i] = std::move(m);
+  using View = Eigen::Block<const Matrix>;
+  void set(Matrix m_, std::vector<std::pair<size_t, size_t>> parts_) {
+    m     = std::move(m_);
+    nr    = nrvec(m);
+    parts = std::move(parts_);
+    assert(ranges::all_of(parts, [d = dim(m)](const auto &p) { return p.first <= p.second && p.second <= d; }));
   }
+  [[nodiscard]] auto size() const noexcept { return parts.size(); }
   [[nodiscard]] bool is_unitary() const noexcept {
-    return NRG::is_unitary_blocks<S>(blocks);
+    return NRG::is_unitary<S>(Matrix(m.topRows(nr)));
   }
-  const Matrix & get(const size_t i) const {
-    assert(i < blocks.size());
-    return blocks[i];
+  View get(const size_t i) const {
+    assert(i < parts.size());
+    const auto &[begin, end] = parts[i];
+    return m.block(0, begin, nr, end - begin);
   }
-  const Matrix & operator()(const size_t i) const { // 1-based MMA index, called from recalc_f()
-    assert(1 <= i && i <= blocks.size());
-    return blocks[i-1];
+  View operator()(const size_t i) const { // 1-based MMA index, called from recalc_f()
+    assert(1 <= i && i <= parts.size());
+    return get(i-1);
   }
-  void truncate(const size_t nr) {
-    for (auto &i : blocks) {
-      assert(nr <= nrvec(i));
-      NRG::resize(i, nr, dim(i)); // conserving matrix resize
-    }
+  void truncate(const size_t nr_) {
+    assert(nr_ <= nr);
+    nr = nr_;
   }
   void save(boost::archive::binary_oarchive &oa) const {
-    oa << blocks.size();
-    for (const auto &b: blocks) NRG::save(oa, b);
+    oa << parts.size();
+    for (const auto i : range0(parts.size())) NRG::save(oa, Matrix(get(i)));
   }
   void load(boost::archive::binary_iarchive &ia) {
-    resize(read_one<size_t>(ia));
+    const auto nrblocks = read_one<size_t>(ia);
+    std::vector<Matrix> blocks(nrblocks);
     for (auto &b: blocks) b = NRG::load<S>(ia);
+    std::vector<std::pair<size_t, size_t>> p;
+    size_t cols = 0;
+    for (const auto &b : blocks) {
+      p.emplace_back(cols, cols + dim(b));
+      cols += dim(b);
+    }
+    Matrix mm(nrblocks ? nrvec(blocks[0]) : 0, cols);
+    for (const auto i : range0(nrblocks)) mm.middleCols(p[i].first, dim(blocks[i])) = blocks[i];
+    set(std::move(mm), std::move(p));
+  }
+  void clear() {
+    m  = Matrix();
+    nr = 0;
+    parts.clear();
   }
-  void clear() { ranges::fill(blocks, Matrix()); }
 };
 
 // Result of a diagonalisation: eigenvalues and eigenvectors
@@ -190,7 +219,7 @@ public:
     val.resize(M);
     vec.resize(M, dim); // non-conserving matrix resize
   }
-  [[nodiscard]] auto getnrcomputed() const noexcept { assert(val.size() == nrvec(vec)); return val.size(); } // nr eigenvalue/eigenvector pairs
+  [[nodiscard]] auto getnrcomputed() const noexcept { assert(val.size() == nrvec(vec) || nrvec(vec) == 0); return val.size(); } // nr eigenvalue/eigenvector pairs (vec is empty if only eigenvalues were computed)
   [[nodiscard]] auto getdim() const noexcept { return dim(vec); } // matrix dimension (length of eigenvectors)
   void dump_eigenvalues(const size_t max_nr = std::numeric_limits<size_t>::max(), std::ostream &F = std::cout) const {
     F << "eig= " << std::setprecision(std::numeric_limits<double>::max_digits10);
@@ -285,13 +314,19 @@ public:
     U.clear();
   }
   void save(boost::archive::binary_oarchive &oa) const {
-    values.save(oa);
+    save_metadata(oa);
     vectors.save(oa);
-    oa << nrpost << nrstored << last;
-  }  
+  }
   void load(boost::archive::binary_iarchive &ia) {
-    values.load(ia);
+    load_metadata(ia);
     vectors.load(ia);
+  }
+  void save_metadata(boost::archive::binary_oarchive &oa) const { // everything except the eigenvectors
+    values.save(oa);
+    oa << nrpost << nrstored << last;
+  }
+  void load_metadata(boost::archive::binary_iarchive &ia) {
+    values.load(ia);
     ia >> nrpost >> nrstored >> last;
   }
   void h5save(H5Easy::File &fd, const std::string &name, const bool save_vectors = true) const {
@@ -301,6 +336,58 @@ public:
   }
 };
 
+// Eigenvalues and eigenvectors of one NRG step, as stored in the unitaryN file. The file is a block file (see
+// block_file.hpp): the metadata section holds the Eigen objects without the eigenvectors and the block number for
+// each subspace, the blocks are the eigenvector matrices. These are used in place through the memory mapping, so
+// that only the parts which are actually accessed are read from disk (unless compressed, see workdircodec).
+template <scalar S, typename Matrix = Matrix_traits<S>>
+class UnitaryFile {
+ private:
+   BlockFile<S> file;
+   std::map<Invar, std::pair<Eigen<S>, size_t>> index; // eigenvalues etc., block number
+ public:
+   using Map = typename BlockFile<S>::Map;
+   explicit UnitaryFile(std::shared_ptr<const FileData> data) : file(std::move(data)) {
+     std::istringstream ss{std::string(file.metadata())};
+     boost::archive::binary_iarchive ia(ss);
+     const auto nr = read_one<size_t>(ia); // Number of subspaces
+     for ([[maybe_unused]] const auto cnt : range0(nr)) {
+       const auto I = read_one<Invar>(ia);
+       auto &[eig, block] = index[I];
+       eig.load_metadata(ia);
+       block = read_one<size_t>(ia);
+       if (block >= file.size()) throw std::runtime_error(fmt::format("Error reading {}", file.name()));
+       eig.vectors.resize(0, file.cols(block)); // dimension only
+     }
+   }
+   template <typename DI> static void save(Workdir &workdir, const std::string &fn, const DI &diag, const Codec codec = Codec::none) {
+     std::ostringstream ss;
+     std::vector<const Matrix *> blocks;
+     {
+       boost::archive::binary_oarchive oa(ss);
+       oa << diag.size();
+       for (const auto &[I, eig] : diag) {
+         oa << I;
+         eig.save_metadata(oa);
+         oa << blocks.size();
+         blocks.push_back(&eig.vectors.get());
+       }
+     }
+     const auto metadata = std::move(ss).str();
+     workdir.write(fn, block_file_size<S>(metadata, blocks),
+                   [&metadata, &blocks, codec](std::ostream &F) { write_block_file<S>(F, metadata, blocks, codec); });
+   }
+   [[nodiscard]] auto subspaces() const noexcept { return index | boost::adaptors::map_keys; }
+   [[nodiscard]] bool contains(const Invar &I) const { return index.count(I); }
+   void prefetch() const { file.prefetch(); }
+   [[nodiscard]] Map vectors(const Invar &I) const { return file[index.at(I).second]; } // eigenvectors in rows
+   [[nodiscard]] Eigen<S> eigen(const Invar &I) const { // copy into memory
+     auto eig = index.at(I).first;
+     eig.vectors.load(Matrix(vectors(I)));
+     return eig;
+   }
+};
+
 // Full information after diagonalizations (eigenspectra in all subspaces)
 template <scalar S, typename Matrix = Matrix_traits<S>, typename t_eigen = eigen_traits<S>>
 class DiagInfo : public std::map<Invar, Eigen<S>> {
@@ -389,29 +476,15 @@ class DiagInfo : public std::map<Invar, Eigen<S>> {
        fmt::print("Number of states (multiplicity taken into account): {}\n\n", count_states(mult));
      }
    void save(const size_t N, const Params &P) const {
-     const std::string fn = P.workdir->unitaryfn(N);
-     std::ofstream MATRIXF(fn, std::ios::binary | std::ios::out);
-     if (!MATRIXF) throw std::runtime_error(fmt::format("Can't open file {} for writing.", fn));
-     boost::archive::binary_oarchive oa(MATRIXF);
-     oa << this->size();
-     for(const auto &[I, eig]: *this) {
-       oa << I;
-       eig.save(oa);
-       if (MATRIXF.bad()) throw std::runtime_error(fmt::format("Error writing {}", fn)); // Check after each write.
-     }
+     UnitaryFile<S>::save(*P.workdir, P.workdir->unitaryfn(N), *this, P.codec());
    }
    void load(const size_t N, const Params &P, const bool remove_files = false) {
      const std::string fn = P.workdir->unitaryfn(N);
-     std::ifstream MATRIXF(fn, std::ios::binary | std::ios::in);
-     if (!MATRIXF) throw std::runtime_error(fmt::format("Can't open file {} for reading", fn));
-     boost::archive::binary_iarchive ia(MATRIXF);
-     const auto nr = read_one<size_t>(ia); // Number of subspaces
-     for ([[maybe_unused]] const auto cnt : range0(nr)) {
-       const auto inv = read_one<Invar>(ia);
-       (*this)[inv].load(ia);
-       if (MATRIXF.bad()) throw std::runtime_error(fmt::format("Error reading {}", fn));
+     {
+       const UnitaryFile<S> file(P.workdir->read(fn));
+       for (const auto &I : file.subspaces()) (*this)[I] = file.eigen(I);
      }
-     if (remove_files) NRG::remove(fn);
+     if (remove_files) P.workdir->remove(fn);
    }
    void h5save(H5Easy::File &fd, const std::string &name, const bool save_vectors = true) const {
      for (const auto &[I, eig]: *this) eig.h5save(fd, name + "/" + I.name(), save_vectors);
@@ -0,0 +1,96 @@
+// file_data.hpp - contents of the workdir files, held in memory or mapped from disk
+// Copyright (C) 2009-2024 Rok Zitko
+
+#ifndef _file_data_hpp_
+#define _file_data_hpp_
+
+#include <string>
+#include <memory>
+#include <streambuf>
+#include <stdexcept>
+#include <utility> // exchange
+
+#include <fcntl.h>    // open
+#include <unistd.h>   // close, sysconf
+#include <sys/mman.h> // mmap, munmap, madvise
+#include <sys/stat.h> // fstat
+
+#include <fmt/format.h>
+
+namespace NRG {
+
+// Read-only contents of a file, see Workdir::read().
+class FileData {
+ private:
+   std::string fn;
+ public:
+   explicit FileData(std::string fn_) : fn(std::move(fn_)) {}
+   FileData(const FileData &) = delete;
+   FileData & operator=(const FileData &) = delete;
+   virtual ~FileData() = default;
+   [[nodiscard]] const auto & name() const noexcept { return fn; }
+   [[nodiscard]] virtual const char *data() const noexcept = 0;
+   [[nodiscard]] virtual size_t size() const noexcept = 0;
+   virtual void prefetch() const {} // make the contents resident in memory
+};
+
+// File held in memory
+class MemoryFile : public FileData {
+ private:
+   std::shared_ptr<const std::string> buf;
+ public:
+   MemoryFile(std::string fn_, std::shared_ptr<const std::string> buf_) : FileData(std::move(fn_)), buf(std::move(buf_)) {}
+   [[nodiscard]] const char *data() const noexcept override { return buf->data(); }
+   [[nodiscard]] size_t size() const noexcept override { return buf->size(); }
+};
+
+// Read-only memory mapping of a whole file. The pages are read from disk only when they are accessed.
+class MappedFile : public FileData {
+ private:
+   void *addr = nullptr;
+   size_t len = 0;
+ public:
+   explicit MappedFile(const std::string &filename) : FileData(filename) {
+     const int fd = ::open(filename.c_str(), O_RDONLY);
+     if (fd < 0) throw std::runtime_error(fmt::format("Can't open file {} for reading", filename));
+     struct stat st {};
+     if (::fstat(fd, &st) != 0) {
+       ::close(fd);
+       throw std::runtime_error(fmt::format("Can't stat file {}", filename));
+     }
+     len = size_t(st.st_size);
+     if (len) {
+       addr = ::mmap(nullptr, len, PROT_READ, MAP_PRIVATE, fd, 0);
+       if (addr == MAP_FAILED) addr = nullptr;
+     }
+     ::close(fd); // the mapping remains valid
+     if (len && !addr) throw std::runtime_error(fmt::format("Can't map file {}", filename));
+   }
+   ~MappedFile() override {
+     if (addr) ::munmap(addr, len);
+   }
+   [[nodiscard]] const char *data() const noexcept override { return static_cast<const char *>(addr); }
+   [[nodiscard]] size_t size() const noexcept override { return len; }
+   // Read the whole file into memory in advance, e.g. from a background thread, see AsyncStepIO.
+   void prefetch() const override {
+     if (!addr) return;
+     ::madvise(addr, len, MADV_WILLNEED);
+     const auto page = size_t(::sysconf(_SC_PAGESIZE));
+     char sum = 0;
+     for (size_t i = 0; i < len; i += page) sum ^= data()[i]; // touch each page
+     [[maybe_unused]] volatile char sink = sum;
+   }
+};
+
+// Input stream buffer over the file contents, e.g. for reading Boost archives without copying the data.
+class FileDataBuf : public std::streambuf {
+ public:
+   explicit FileDataBuf(const FileData &f) {
+     auto p = const_cast<char *>(f.data()); // NOLINT: get area is never written to
+     setg(p, p, p + f.size());
+   }
+};
+
+} // namespace
+
+#endif
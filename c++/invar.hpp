@@ -6,6 +6,7 @@
 
 #include <utility>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <map>
 #include <iostream>
@@ -46,7 +47,7 @@ class Invar {
    template <class Archive> void serialize(Archive &ar, [[maybe_unused]] const unsigned int version) { ar &data; }
  public:
    inline static std::vector<int> qntype;         // must be defined before calls to Invar::combine() and Invar::invert()
-   inline static std::map<std::string, int> names; // must be defined before calls to Invar::get()
+   inline static std::map<std::string, int, std::less<>> names; // must be defined before calls to Invar::get()
    // invdim holds the number of quantum numbers required to specify the invariant subspaces (representations), i.e. (in
    // more fancy terms) the dimension of the Cartan subalgebra of the full symmetry algebra.
    inline static size_t invdim = 0; // 0 before initialization!
@@ -126,7 +127,7 @@ class Invar {
          break;
        }
    }
-   [[nodiscard]] auto get(const std::string &which) const {
+   [[nodiscard]] auto get(const std::string_view which) const { // no std::string temporaries for literal arguments
      const auto i = names.find(which);
      if (i == end(names)) throw std::invalid_argument(fmt::format("{} is an unknown quantum number.", which));
      const auto index = i->second;
@@ -5,6 +5,9 @@
 #define _matrix_hpp_
 
 #include <stdexcept>
+#include <vector>
+#include <tuple>
+#include <algorithm>
 
 #include "invar.hpp"
 #include "eigen.hpp"
@@ -17,6 +20,67 @@
 
 namespace NRG {
 
+// Assembly of the Hamiltonian matrix. While an assembly object exists, all contributions computed in make_matrix()
+// (off-diagonal blocks, diagonal shifts) are only recorded as (target block, source matrix, factor, transpose flag)
+// entries; the map lookups and the checks are thus performed once per subspace, before any data is copied. apply()
+// then adds the entries to the matrix, grouped by the target block. Different target blocks are independent, thus
+// for large subspaces the groups are processed in parallel. Within a group, the entries are added in the order of
+// recording, i.e., each matrix element receives the same sequence of additions as in the immediate evaluation and
+// the result is identical. Only the upper triangle (the part read by LAPACK) is written. Without an active assembly
+// object (e.g. when make_matrix() is called directly), the contributions are added immediately.
+template<scalar S>
+class HamiltonianAssembly {
+ public:
+   using Matrix = Matrix_traits<S>;
+   using t_coef = coef_traits<S>;
+   struct Entry {
+     size_t row, col, rows, cols; // target block
+     const Matrix *mat;           // source matrix, nullptr for a multiple of the identity
+     t_coef factor;
+     bool conj_transpose;         // add factor * mat^\dag instead of factor * mat
+     void apply(Matrix &h) const {
+       auto hsub = h.block(row, col, rows, cols);
+       if (mat == nullptr)
+         hsub.diagonal().array() += factor;
+       else if (conj_transpose)
+         hsub.noalias() += factor * mat->adjoint();
+       else
+         hsub.noalias() += factor * *mat;
+     }
+   };
+   static constexpr size_t parallel_dim = 1000; // minimal subspace dimension for the parallel assembly
+ private:
+   std::vector<Entry> entries;
+   inline static thread_local HamiltonianAssembly *active = nullptr; // the Hamiltonian is built in a single thread
+ public:
+   HamiltonianAssembly() {
+     my_assert(active == nullptr);
+     active = this;
+   }
+   HamiltonianAssembly(const HamiltonianAssembly &) = delete;
+   HamiltonianAssembly &operator=(const HamiltonianAssembly &) = delete;
+   ~HamiltonianAssembly() { if (active == this) active = nullptr; }
+   static void add(const Entry &e, Matrix &h) {
+     if (active) active->entries.push_back(e); else e.apply(h);
+   }
+   [[nodiscard]] auto size() const { return entries.size(); }
+   // threads is the team size for the parallel assembly. Pass 1 when called from within a parallel region, unless
+   // the cores have been reserved for the calling thread (see DiagOpenMP::nested()).
+   void apply(Matrix &h, const int threads) {
+     active = nullptr;
+     std::stable_sort(entries.begin(), entries.end(), [](const auto &a, const auto &b) { return std::tie(a.row, a.col) < std::tie(b.row, b.col); });
+     std::vector<size_t> groups; // first entry of each group
+     for (size_t k = 0; k < entries.size(); k++)
+       if (k == 0 || entries[k].row != entries[k-1].row || entries[k].col != entries[k-1].col) groups.push_back(k);
+     groups.push_back(entries.size());
+     const auto nr = groups.size() - 1;
+#pragma omp parallel for schedule(dynamic) num_threads(threads) if(threads > 1 && size1(h) >= parallel_dim)
+     for (size_t g = 0; g < nr; g++)
+       for (auto k = groups[g]; k < groups[g+1]; k++) entries[k].apply(h);
+     entries.clear();
+   }
+};
+
 // +++ Construct an offdiagonal part of the Hamiltonian. +++
 
 // We test if the block (i,j) exists at all. If not, factor is not evaluated. This prevents divisions by zero.
@@ -44,17 +108,14 @@ void Symmetry<S>::offdiag_function_impl(const Step &step, const size_t i, const
   if (const auto f = opch[ch][fnr].find({In[i-1], In[j-1]}); f != opch[ch][fnr].cend()) {   // < In[i] r | f^\dag | In[j] r' >
     const Matrix & mat = f->second;
     my_assert(qq.rmax(i-1) == size1(mat) && qq.rmax(j-1) == size2(mat));
-    const auto factor_scaled = factor / step.scale();
+    const t_coef factor_scaled = factor / step.scale();
     // We are building the upper triangular part of the Hermitian Hamiltonian. Thus usually i < j. If not, we must
     // conjugate transpose the contribution!
     const bool conj_transpose = i > j;
-    if (conj_transpose) {
-      auto hsub = submatrix(h, qq.part_mma(j), qq.part_mma(i));
-      hsub += conj_me(factor_scaled) * herm(mat);
-    } else {
-      auto hsub = submatrix(h, qq.part_mma(i), qq.part_mma(j));
-      hsub += factor_scaled * mat;
-    }
+    const auto row = conj_transpose ? j : i;
+    const auto col = conj_transpose ? i : j;
+    HamiltonianAssembly<S>::add({qq.offset(row-1), qq.offset(col-1), qq.rmax(row-1), qq.rmax(col-1), &mat,
+                                 conj_transpose ? conj_me(factor_scaled) : factor_scaled, conj_transpose}, h);
   } else
     throw std::runtime_error(fmt::format("offdiag_function(): matrix not found {} {} {} {}", i, j, ch, fnr));
 }
@@ -74,7 +135,8 @@ void Symmetry<S>::diag_function_impl(const Step &step, const size_t i, const dou
   // For convenience we subtract the average site occupancy. XXX: how does this affect the total energy??
   const auto avgoccup = (double)P.spin / 2; // multiplicity divided by 2
   // Energy shift of the diagonal matrix elements in the NRG Hamiltonian.
-  for (const auto j: qq.view_mma(i)) h(j, j) += sc_zeta * (number - f*avgoccup) / step.scale();
+  const auto [begin, size] = qq.chunk(i);
+  HamiltonianAssembly<S>::add({begin, begin, size, size, nullptr, sc_zeta * (number - f*avgoccup) / step.scale(), false}, h); // multiple of identity
 }
 
 template<scalar S>
@@ -107,7 +169,7 @@ void Symmetry<S>::diag_offdiag_function(const Step &step, const size_t i, const
   if (!contributes) return;
   my_assert(size1 == size2);
   const t_coef factor_scaled = factor / step.scale();
-  for (const auto l: range0(size1)) h(begin1 + l, begin2 + l) += factor_scaled;
+  HamiltonianAssembly<S>::add({begin1, begin2, size1, size2, nullptr, factor_scaled, false}, h); // factor_scaled * identity
 }
 
 } // namespace NRG
@@ -68,8 +68,8 @@ void calc_ZnD(const Store<S> &store, Stats<S> &stats, const Symmetry<S> *Sym, co
     for (const auto &[I, ds] : store[N])
       for (const auto i : ds.all()) {
         my_mpf g, n;
-        mpf_set_d(g, Sym->mult(I) * exp(-ds.eig.values.abs_G(i)/T));     // abs_G >= 0.0
-        mpf_set_d(n, Sym->mult(I) * exp(-ds.eig.values.abs_zero(i)/T)); // abs_zero >= 0.0
+        mpf_set_d(g, Sym->mult(I) * exp(-ds.values.abs_G(i)/T));     // abs_G >= 0.0
+        mpf_set_d(n, Sym->mult(I) * exp(-ds.values.abs_zero(i)/T)); // abs_zero >= 0.0
         mpf_add(ZnDG, ZnDG, g);
         mpf_add(ZnDN, ZnDN, n);
       }
@@ -131,10 +131,10 @@ void fdm_thermodynamics(const Store<S> &store, Stats<S> &stats, const Symmetry<S
       for (const auto &[I, ds] : store[N])
         for (const auto i : ds.all()) {
           my_mpf weight;
-          mpf_set_d(weight, stats.wn[N] * Sym->mult(I) * exp(-ds.eig.values.abs_zero(i)/T));
+          mpf_set_d(weight, stats.wn[N] * Sym->mult(I) * exp(-ds.values.abs_zero(i)/T));
           mpf_div(weight, weight, stats.ZnDN[N]);
           my_mpf e;
-          mpf_set_d(e, ds.eig.values.abs_T(i));
+          mpf_set_d(e, ds.values.abs_T(i));
           my_mpf e2;
           mpf_mul(e2, e, e);
           mpf_mul(e, e, weight);
@@ -208,11 +208,15 @@ void calculate_spectral_and_expv_impl(const Step &step, Stats<S> &stats, Output<
   DensMatElements<S> rho, rhoFDM;
   if (step.dmnrg()) {
     if (P.need_rho()) {
-      rho.load(step.ndx(), P, fn_rho, P.removefiles);
+      rho = oprecalc.rho_io.get(step.ndx());
       check_trace_rho(rho, Sym->multfnc()); // Check if Tr[rho]=1, i.e. the normalization
     }
     if (P.need_rhoFDM())
-      rhoFDM.load(step.ndx(), P, fn_rhoFDM, P.removefiles);
+      rhoFDM = oprecalc.rhoFDM_io.get(step.ndx());
+    if (step.ndx() < step.lastndx()) { // load the next step while this one is being processed
+      if (P.need_rho()) oprecalc.rho_io.prefetch(step.ndx()+1);
+      if (P.need_rhoFDM()) oprecalc.rhoFDM_io.prefetch(step.ndx()+1);
+    }
   }
   // Calculate all spectral functions
   calc_Z(step, stats, diag, Sym->multfnc(), P); // required for FT and CFS approaches
@@ -0,0 +1,88 @@
+// mpi_transfer.hpp - bulk transfer of dense matrices between MPI ranks
+// Copyright (C) 2009-2024 Rok Zitko
+
+#ifndef _mpi_transfer_hpp_
+#define _mpi_transfer_hpp_
+
+#include <vector>
+#include <array>
+#include <algorithm>
+#include <climits>
+#include <complex>
+
+#ifdef OMPI_SKIP_MPICXX // workaround to avoid warnings for for redefinition in mpi/environment.hpp
+ #undef OMPI_SKIP_MPICXX
+#endif
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/request.hpp>
+#include <boost/mpi/nonblocking.hpp> // wait_all, test_all
+
+#include "traits.hpp"
+
+namespace NRG {
+
+// MPI counts are of type int, thus a single message is limited to 2^31-1 elements (and some implementations fail
+// even earlier, at 2 GB). A matrix is therefore sent as a sequence of contiguous chunks of at most this size. All
+// chunks are posted at once as nonblocking operations.
+constexpr size_t mpi_chunk_bytes = size_t(1) << 27; // 128 MB
+
+// The data are transferred as arrays of real numbers, which map to a native MPI datatype. (std::complex<T> is
+// layout-compatible with T[2]; Boost.MPI would otherwise fall back to serialization for complex arrays.)
+template <scalar S> struct mpi_real { using type = S; };
+template <scalar S> struct mpi_real<std::complex<S>> { using type = S; };
+template <scalar S> using mpi_real_t = typename mpi_real<S>::type;
+
+template <scalar S> auto mpi_data(S *p) { return reinterpret_cast<mpi_real_t<S> *>(p); }
+template <scalar S> auto mpi_data(const S *p) { return reinterpret_cast<const mpi_real_t<S> *>(p); }
+template <scalar S> constexpr size_t mpi_length(const size_t nr) { return nr * (sizeof(S) / sizeof(mpi_real_t<S>)); }
+
+template <scalar S> constexpr size_t mpi_chunk_elements(const size_t chunk_bytes) {
+  return std::clamp<size_t>(chunk_bytes / sizeof(mpi_real_t<S>), 1, INT_MAX);
+}
+
+using mpi_dims = std::array<size_t, 2>;
+
+// Start sending matrix m to rank dest: the dimensions (tag_size, stored in dims) and the data in chunks (tag_data).
+// Nothing blocks. m and dims must not be modified or destroyed before the returned requests complete.
+template <scalar S>
+auto isend_matrix(boost::mpi::communicator &comm, const int dest, const int tag_size, const int tag_data,
+                  const EigenMatrix<S> &m, mpi_dims &dims, const size_t chunk_bytes = mpi_chunk_bytes) {
+  dims = {size1(m), size2(m)};
+  const size_t total = mpi_length<S>(dims[0] * dims[1]);
+  const size_t chunk = mpi_chunk_elements<S>(chunk_bytes);
+  std::vector<boost::mpi::request> reqs;
+  reqs.reserve(1 + (total + chunk - 1) / chunk);
+  reqs.push_back(comm.isend(dest, tag_size, dims.data(), 2));
+  for (size_t offset = 0; offset < total; offset += chunk)
+    reqs.push_back(comm.isend(dest, tag_data, mpi_data(m.data()) + offset, int(std::min(chunk, total - offset))));
+  return reqs;
+}
+
+template <scalar S>
+void send_matrix(boost::mpi::communicator &comm, const int dest, const int tag_size, const int tag_data,
+                 const EigenMatrix<S> &m, const size_t chunk_bytes = mpi_chunk_bytes) {
+  mpi_dims dims;
+  auto reqs = isend_matrix(comm, dest, tag_size, tag_data, m, dims, chunk_bytes);
+  boost::mpi::wait_all(reqs.begin(), reqs.end());
+}
+
+// Receive a matrix sent by isend_matrix(). The chunk size must match the one used on the sending side.
+template <scalar S>
+auto recv_matrix(boost::mpi::communicator &comm, const int source, const int tag_size, const int tag_data,
+                 const size_t chunk_bytes = mpi_chunk_bytes) {
+  mpi_dims dims{};
+  comm.recv(source, tag_size, dims.data(), 2);
+  EigenMatrix<S> m(dims[0], dims[1]);
+  const size_t total = mpi_length<S>(dims[0] * dims[1]);
+  const size_t chunk = mpi_chunk_elements<S>(chunk_bytes);
+  std::vector<boost::mpi::request> reqs;
+  reqs.reserve((total + chunk - 1) / chunk);
+  for (size_t offset = 0; offset < total; offset += chunk)
+    reqs.push_back(comm.irecv(source, tag_data, mpi_data(m.data()) + offset, int(std::min(chunk, total - offset))));
+  boost::mpi::wait_all(reqs.begin(), reqs.end());
+  return m;
+}
+
+} // namespace
+
+#endif
@@ -131,6 +131,7 @@ public:
     }
     if (step.dmnrg()) {
       if (P.h5raw) stats.h5save_dmnrg(*output.h5raw); // saved in raw-dm.h5
+      oprecalc.io_report();
     }
     fmt::print("\n** Iteration completed.\n\n");
     return diag;
@@ -161,6 +162,14 @@ public:
       eng = std::make_shared<DiagOpenMP<S>>();
     if (P.diag_mode == "serial")
       eng = std::make_shared<DiagSerial<S>>();
+    if (P.diag_mode == "hybrid") {
+      if (auto mpi = std::dynamic_pointer_cast<DiagMPI<S>>(eng))
+        eng = std::make_shared<DiagHybrid<S>>(mpi);
+      else
+        std::cout << "diag_mode=hybrid requires the MPI engine, ignored." << std::endl;
+    }
+    if (P.twophase)
+      eng = std::make_shared<DiagTwoPhase<S>>(eng);
     auto diag = run_nrg(RUNTYPE::NRG, input.operators, input.coef, input.diag);
     if (P.dm) {
       if (P.need_rho()) calc_rho(diag); // XXX: diag required here?
@@ -174,6 +183,7 @@ public:
   NRG_calculation & operator=(const NRG_calculation &&) = delete;
   ~NRG_calculation() {
     if (!P.embedded) mt.report(); // only when running as a stand-alone application
+    if (P.workdir->memory_budget()) P.workdir->report();
     if (P.done) { std::ofstream D("DONE"); } // Indicate completion by creating a flag file
   }
 };
@@ -54,24 +54,32 @@ void run_nrg_slave_impl(boost::mpi::environment &mpienv, boost::mpi::communicato
   constexpr auto master = 0;
   DiagParams DP;
   for (;;) {
-    if (mpiw.iprobe(master, boost::mpi::any_tag)) { // message can be received.
-      int task = 0;
-      const auto status = mpiw.recv(master, boost::mpi::any_tag, task);
-      mpilog("Slave " << mpiw.rank() << " received message with tag " << status.tag());
-      switch (status.tag()) {
-      case TAG_SYNC:
-        DP = eng.receive_params();
-        break;
-      case TAG_DIAG:
-        eng.slave_diag(master, DP);
-        break;
-      case TAG_EXIT:
-        return; // exit from run_slave()
-      default:
-        std::cout << "MPI error: unknown tag on " << mpiw.rank() << std::endl;
-        break;
-      }
-    } else usleep(100); // sleep to reduce the load on the computer. (OpenMPI "feature" workaround)
+    // Block until the next control message arrives. Its tag determines the request.
+    int task = 0;
+    const auto status = mpiw.recv(master, boost::mpi::any_tag, task);
+    mpilog("Slave " << mpiw.rank() << " received message with tag " << status.tag());
+    switch (status.tag()) {
+    case TAG_SYNC:
+      DP = eng.receive_params();
+      break;
+    case TAG_DIAG:
+      eng.slave_diag(master, DP);
+      break;
+    case TAG_STEP:
+      eng.receive_step();
+      break;
+    case TAG_HAM:
+      eng.slave_diag_ham(master, DP);
+      break;
+    case TAG_BATCH:
+      eng.slave_diag_batch(master, DP);
+      break;
+    case TAG_EXIT:
+      return; // exit from run_slave()
+    default:
+      std::cout << "MPI error: unknown tag on " << mpiw.rank() << std::endl;
+      break;
+    }
   }
 }
 
@@ -90,21 +90,71 @@ template <scalar T> auto read_matrix(std::istream &F, const size_t size1, const
   return read_Eigen_matrix<T>(F, size1, size2);
 }
 
-template<scalar S, Eigen_matrix EM, typename t_coef = coef_traits<S>>
-void product(EM &M, const t_coef factor, const EM &A, const EM &B) {
+// Per-thread scratch storage. The buffers of all threads are registered, so that they can be freed by
+// release_scratch() once the large matrices are no longer needed.
+struct ScratchBase {
+  virtual void release() = 0;
+ protected:
+  ~ScratchBase() = default;
+};
+
+inline std::mutex scratch_mtx;
+inline std::set<ScratchBase *> scratch_buffers;
+
+template<scalar S>
+struct ScratchBuffer final : ScratchBase {
+  std::vector<S> data;
+  ScratchBuffer() {
+    std::lock_guard lock(scratch_mtx);
+    scratch_buffers.insert(this);
+  }
+  ~ScratchBuffer() {
+    std::lock_guard lock(scratch_mtx);
+    scratch_buffers.erase(this);
+  }
+  ScratchBuffer(const ScratchBuffer &) = delete;
+  ScratchBuffer &operator=(const ScratchBuffer &) = delete;
+  void release() override { std::vector<S>().swap(data); }
+};
+
+// Per-thread scratch matrix. The storage only grows and is reused between calls, so the contents are overwritten by
+// the next call from the same thread. Use different slots for scratch matrices which are needed at the same time.
+template<scalar S, int slot = 0>
+auto scratch_matrix(const size_t size1, const size_t size2) {
+  thread_local ScratchBuffer<S> buffer;
+  if (buffer.data.size() < size1*size2) buffer.data.resize(size1*size2);
+  return Eigen::Map<EigenMatrix<S>>(buffer.data.data(), Eigen::Index(size1), Eigen::Index(size2));
+}
+
+// Free the scratch storage of all threads. Must not be called while any scratch matrix is in use, i.e., only
+// between the parallel sections, e.g. at the end of each step of the operator recalculation.
+inline void release_scratch() {
+  std::lock_guard lock(scratch_mtx);
+  for (auto b : scratch_buffers) b->release();
+}
+
+// Scratch slot for the intermediate products in transform() and rotate(). Slots 0 and 1 are used by the callers.
+constexpr int gemm_slot = 2;
+
+// The matrix products are evaluated by gemm() in blas_gemm.hpp, the intermediate results are stored in scratch
+// matrices. A and B may be matrix views (e.g. eigenvector blocks, see class Blocks).
+template<scalar S, Eigen_matrix EM, typename MA, typename MB, typename t_coef = coef_traits<S>>
+void product(EM &M, const t_coef factor, const MA &A, const MB &B) {
   if (finite_size(A) && finite_size(B)) {
     assert(size1(M) == size1(A) && size2(A) == size2(B) && size1(B) == size2(M));
     assert(my_isfinite(factor));
-    M += factor * A * B.adjoint();
+    gemm<GemmOp::N, GemmOp::H>(M, S(factor), A, B, S(1));
   }
 }
 
-template<scalar S, Eigen_matrix EM, typename t_coef = coef_traits<S>>
-void transform(EM &M, const t_coef factor, const EM &A, const EM &O, const EM &B) {
+template<scalar S, Eigen_matrix EM, typename MA, typename MB, typename t_coef = coef_traits<S>>
+void transform(EM &M, const t_coef factor, const MA &A, const EM &O, const MB &B) {
   if (finite_size(A) && finite_size(B)) {
     assert(size1(M) == size1(A) && size2(A) == size1(O) && size2(O) == size2(B) && size1(B) == size2(M));
     assert(my_isfinite(factor));
-    M += factor * A * O * B.adjoint();
+    auto T = scratch_matrix<S, gemm_slot>(size1(A), size2(O));
+    gemm<GemmOp::N, GemmOp::N>(T, S(1), A, O, S(0));
+    gemm<GemmOp::N, GemmOp::H>(M, S(factor), T, B, S(1));
   }
 }
 
@@ -113,16 +163,62 @@ void rotate(EM &M, const t_coef factor, const U_type &U, const EM &O) {
   if (finite_size(U)) {
     assert(size1(M) == size2(U) && size1(U) == size1(O) && size2(O) == size1(U) && size2(U) == size2(M));
     assert(my_isfinite(factor));
-    M += factor * U.adjoint() * O * U;
+    auto T = scratch_matrix<S, gemm_slot>(size1(O), size2(U));
+    gemm<GemmOp::N, GemmOp::N>(T, S(1), O, U, S(0));
+    gemm<GemmOp::H, GemmOp::N>(M, S(factor), U, T, S(1));
+  }
+}
+
+// Hermitian variants of transform() and rotate() for Hermitian O and real factor. Since the result is Hermitian, only
+// its lower triangle is computed: the second multiplication is done by gemm_lower(), which requires half the
+// operations. After all contributions have been added, the upper triangle is restored using hermitian_mirror().
+template<scalar S, typename MM, typename MA, typename MO>
+void transform_lower(MM &&M, const double factor, const MA &A, const MO &O) { // M += factor A O A^\dag
+  if (finite_size(A)) {
+    assert(size1(M) == size1(A) && size2(A) == size1(O) && size1(O) == size2(O) && size1(A) == size2(M));
+    assert(my_isfinite(factor));
+    auto T = scratch_matrix<S, gemm_slot>(size1(A), size2(O));
+    gemm<GemmOp::N, GemmOp::N>(T, S(factor), A, O, S(0));
+    gemm_lower<GemmOp::N, GemmOp::H>(M, S(1), T, A);
   }
 }
 
+template<scalar S, typename MM, typename U_type, typename MO>
+void rotate_lower(MM &&M, const double factor, const U_type &U, const MO &O) { // M += factor U^\dag O U
+  if (finite_size(U)) {
+    assert(size1(M) == size2(U) && size1(U) == size1(O) && size2(O) == size1(U) && size2(U) == size2(M));
+    assert(my_isfinite(factor));
+    auto T = scratch_matrix<S, gemm_slot>(size1(O), size2(U));
+    gemm<GemmOp::N, GemmOp::N>(T, S(factor), O, U, S(0));
+    gemm_lower<GemmOp::H, GemmOp::N>(M, S(1), U, T);
+  }
+}
+
+template<typename MM>
+void hermitian_mirror(MM &&M) {
+  assert(size1(M) == size2(M));
+  for (Eigen::Index i = 0; i < M.rows(); i++)
+    for (Eigen::Index j = i+1; j < M.cols(); j++) M(i, j) = conj_me(M(j, i));
+}
+
+// Is M Hermitian to within relative tolerance tol?
+template<typename MM>
+bool is_hermitian(const MM &M, const double tol = 1e-12) {
+  return M.rows() == M.cols() && (M - M.adjoint()).norm() <= tol * M.norm();
+}
+
 template<scalar S>
 Eigen::Block<const EigenMatrix<S>> submatrix_const(const EigenMatrix<S> &M, const std::pair<size_t,size_t> &r1, const std::pair<size_t,size_t> &r2)
 {
   return M.block(r1.first, r2.first, r1.second - r1.first, r2.second - r2.first);
 }
 
+template <scalar S> // matrix stored in a memory-mapped file
+Eigen::Block<const Eigen::Map<const EigenMatrix<S>>> submatrix_const(const Eigen::Map<const EigenMatrix<S>> &M, const std::pair<size_t,size_t> &r1, const std::pair<size_t,size_t> &r2)
+{
+  return M.block(r1.first, r2.first, r1.second - r1.first, r2.second - r2.first);
+}
+
 template<scalar S>
 Eigen::Block<EigenMatrix<S>> submatrix(EigenMatrix<S> &M, const std::pair<size_t,size_t> &r1, const std::pair<size_t,size_t> &r2)
 {
@@ -34,6 +34,36 @@ inline void report_openMP(std::ostream &s = std::cout) {
   s << std::endl;
 }
 
+#ifdef NRG_OPENBLAS
+extern "C" {
+void openblas_set_num_threads(int);
+int openblas_get_num_threads();
+}
+#endif
+
+// Number of threads used by multithreaded BLAS/LAPACK routines.
+inline int get_blas_threads() {
+#if defined(MKL)
+  return mkl_get_max_threads();
+#elif defined(NRG_OPENBLAS)
+  return openblas_get_num_threads();
+#else
+  return omp_get_max_threads();
+#endif
+}
+
+// Set the number of threads used by multithreaded BLAS/LAPACK routines. With OpenBLAS this is a global setting, thus
+// it must be called outside parallel regions. For OpenMP-threaded libraries it sets the team size of the parallel
+// regions subsequently started by the calling thread.
+inline void set_blas_threads(const int n) {
+#if defined(MKL)
+  mkl_set_num_threads(n);
+#elif defined(NRG_OPENBLAS)
+  openblas_set_num_threads(n);
+#endif
+  omp_set_num_threads(n);
+}
+
 } // namespace
 
 #endif
@@ -4,12 +4,19 @@
 #include <map>
 #include <iostream>
 #include <fstream>
+#include <sstream>
 #include <iomanip>
 #include <string>
 #include <stdexcept>
+#include <limits>
+#include <cassert>
 
 #include <boost/archive/binary_iarchive.hpp>
 #include <boost/archive/binary_oarchive.hpp>
+#include <boost/serialization/base_object.hpp>
+#include <boost/serialization/map.hpp>
+#include <boost/serialization/vector.hpp>
+#include <boost/serialization/utility.hpp> // std::pair
 #include <boost/range/adaptor/map.hpp>
 #include <range/v3/all.hpp>
 
@@ -38,6 +45,7 @@ class MatrixElements : public std::map<Twoinvar, Matrix> {
          throw std::runtime_error("Corrupted input file.");
      }
      my_assert(this->size() == nf);
+     update_metadata();
    }
    // We trim the matrices containing the irreducible matrix elements of the operators to the sizes that are actually
    // required in the next iterations. This saves memory and leads to better cache usage in recalc_general()
@@ -48,6 +56,46 @@ class MatrixElements : public std::map<Twoinvar, Matrix> {
        const auto &[dim1, dim2] = diag.dims(I1, I2); // Target matrix dimensions
        mat = trim_matrix(mat, dim1, dim2);
      }
+     update_metadata();
+   }
+   // Hermiticity is a property of the operator: it is established when the operator is read, see
+   // check_hermitian(), and carried over to the recalculated operators, see Symmetry::recalc_singlet().
+   [[nodiscard]] bool hermitian() const noexcept { return hermitian_op; }
+   void set_hermitian(const bool h) noexcept { hermitian_op = h; }
+   // Are all diagonal blocks <I||O||I> Hermitian? Used only for the input data and in debug checks.
+   [[nodiscard]] bool check_hermitian(const double tol = 1e-12) const {
+     for (const auto &[II, mat] : *this) {
+       const auto rows = size1(mat);
+       if (II.first != II.second || rows == 0) continue;
+       if (size2(mat) % rows) return false;
+       for (size_t j = 0; j < size2(mat) / rows; j++)
+         if (!NRG::is_hermitian(mat.middleCols(j*rows, rows), tol)) return false;
+     }
+     return true;
+   }
+   // Block metadata used in recalc_general(): Frobenius norms (to skip negligible contributions) and hermiticity of
+   // the diagonal blocks <I||O||I> of Hermitian operators (to compute only one triangle of the result). For a stacked
+   // batch of operators (see Oprecalc::stack()) the blocks consist of square sub-blocks. The metadata is only known
+   // after update_metadata(), which must be called whenever the blocks are modified (this is done after the
+   // recalculation and after trimming). For blocks without metadata, norm() returns infinity and is_hermitian()
+   // returns false.
+   void update_metadata() {
+     info.clear();
+     assert(!hermitian_op || check_hermitian(1e-8));
+     for (const auto &[II, mat] : *this) {
+       const auto rows = size1(mat);
+       const bool hermitian = hermitian_op && II.first == II.second && rows > 0 && size2(mat) % rows == 0;
+       info[II] = {mat.norm(), hermitian};
+     }
+   }
+   [[nodiscard]] double norm(const Twoinvar &II) const {
+     const auto it = info.find(II);
+     return it != info.end() ? it->second.norm : std::numeric_limits<double>::infinity();
+   }
+   [[nodiscard]] bool is_zero(const Twoinvar &II) const { return norm(II) == 0.0; }
+   [[nodiscard]] bool is_hermitian(const Twoinvar &II) const {
+     const auto it = info.find(II);
+     return it != info.end() && it->second.hermitian;
    }
    std::ostream &insertor(std::ostream &os) const {
      for (const auto &[II, mat] : *this)
@@ -71,6 +119,31 @@ class MatrixElements : public std::map<Twoinvar, Matrix> {
        h5_dump_matrix(fd, name + "/" + I1.name() + "/" + I2.name() + "/matrix", mat);
      }
    }
+ private:
+   struct BlockInfo {
+     double norm;
+     bool hermitian;
+   };
+   std::map<Twoinvar, BlockInfo> info; // not serialized
+   bool hermitian_op = false;
+   friend class boost::serialization::access;
+   template <class Archive> void serialize(Archive &ar, [[maybe_unused]] const unsigned int version) {
+     ar &boost::serialization::base_object<std::map<Twoinvar, Matrix>>(*this);
+     ar &hermitian_op;
+   }
+};
+
+// Symmetry factor of the contributions to a spectral function, see Symmetry::spectrum_blocks(). For the spectral
+// densities of doublet operators, the pairs of subspaces are also checked for spin, see Symmetry::check_SPIN().
+enum class SpecFactor { correlator, specdens, specdensquad, spinsusc, orbsusc };
+
+// Contribution of the pair of subspaces (Ij, Ii) to a spectral function <<op1^\dag; op2>>, see BaseSpectrum::calc()
+template<scalar S>
+struct SpectrumBlock {
+  const Invar *Ii, *Ij;
+  const Matrix_traits<S> *m1, *m2;
+  const Eigen<S> *diagi, *diagj;
+  double factor;
 };
 
 template<scalar S, typename Matrix = Matrix_traits<S>>
@@ -81,33 +154,38 @@ class DensMatElements : public std::map<Invar, Matrix> {
        return ranges::accumulate(*this, 0.0, {},
                                  [mult](const auto z) { const auto &[I, mat] = z; return mult(I) * trace_real(mat); });
      }
+   // Saved as a block file (see block_file.hpp), the metadata section holds the list of subspaces
    void save(const size_t N, const Params &P, const std::string &prefix) const {
      const auto fn = P.workdir->rhofn(N, prefix);
-     std::ofstream MATRIXF(fn, std::ios::binary | std::ios::out);
-     if (!MATRIXF) throw std::runtime_error(fmt::format("Can't open file {} for writing.", fn));
-     boost::archive::binary_oarchive oa(MATRIXF);
-     oa << this->size();
-     for (const auto &[I, mat] : *this) {
-       oa << I;
-       NRG::save(oa, mat);
-       if (MATRIXF.bad()) throw std::runtime_error(fmt::format("Error writing {}", fn));  // Check each time
+     std::ostringstream ss;
+     std::vector<const EigenMatrix<S> *> blocks;
+     {
+       boost::archive::binary_oarchive oa(ss);
+       oa << this->size();
+       for (const auto &[I, mat] : *this) {
+         oa << I;
+         blocks.push_back(&mat);
+       }
      }
-     MATRIXF.close();
+     const auto metadata = std::move(ss).str();
+     P.workdir->write(fn, block_file_size<S>(metadata, blocks),
+                      [&metadata, &blocks, codec = P.codec()](std::ostream &F) { write_block_file<S>(F, metadata, blocks, codec); });
    }
    void load(const size_t N, const Params &P, const std::string &prefix, const bool remove_files) {
      const auto fn = P.workdir->rhofn(N, prefix);
-     std::ifstream MATRIXF(fn, std::ios::binary | std::ios::in);
-     if (!MATRIXF) throw std::runtime_error(fmt::format("Can't open file {} for reading", fn));
-     boost::archive::binary_iarchive ia(MATRIXF);
-     const auto nr = read_one<size_t>(ia);
-     for ([[maybe_unused]] const auto cnt : range0(nr)) {
-       const auto inv = read_one<Invar>(ia);
-       (*this)[inv] = NRG::load<S>(ia);
-       if (MATRIXF.bad()) throw std::runtime_error(fmt::format("Error reading {}", fn));  // Check each time
+     {
+       const BlockFile<S> file(P.workdir->read(fn));
+       std::istringstream ss{std::string(file.metadata())};
+       boost::archive::binary_iarchive ia(ss);
+       const auto nr = read_one<size_t>(ia);
+       if (nr != file.size()) throw std::runtime_error(fmt::format("Error reading {}", fn));
+       for (const auto i : range0(nr)) {
+         const auto inv = read_one<Invar>(ia);
+         (*this)[inv] = file.copy(i);
+       }
      }
-     MATRIXF.close();
      if (remove_files)
-       if (NRG::remove(fn)) throw std::runtime_error(fmt::format("Error removing {}", fn));
+       if (P.workdir->remove(fn)) throw std::runtime_error(fmt::format("Error removing {}", fn));
    }
 };
 
@@ -160,6 +238,11 @@ class Opch : public std::vector<OpchChannel<S>> {
          F << fmt::format("<f> dump, i={} j={}\n", i, j) << mat << std::endl;
      F << std::endl;
    }
+ private:
+   friend class boost::serialization::access;
+   template <class Archive> void serialize(Archive &ar, [[maybe_unused]] const unsigned int version) {
+     ar &boost::serialization::base_object<std::vector<OpchChannel<S>>>(*this);
+   }
 };
 
 // Object of class Operators cotains full information about matrix representations when entering stage N of the NRG
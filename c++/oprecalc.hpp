@@ -3,6 +3,10 @@
 
 #include <string>
 #include <set>
+#include <map>
+#include <list>
+#include <algorithm>
+#include <vector>
 #include <memory>
 #include "time_mem.hpp"
 #include "operators.hpp"
@@ -11,6 +15,7 @@
 #include "params.hpp"
 #include "algo.hpp"
 #include "stats.hpp"
+#include "async_io.hpp"
 
 #include <fmt/format.h>
 
@@ -53,47 +58,164 @@ class Oprecalc {
      }
    };
    SL sl;
+
+   // Density matrices for the spectral functions in the DMNRG run. The matrices for the next step are loaded in the
+   // background while the current step is processed, see calculate_spectral_and_expv_impl().
+   static auto dm_loader(const std::string &prefix, const Params &P) {
+     return [prefix, &P](const size_t N) {
+       DensMatElements<S> rho;
+       rho.load(N, P, prefix, P.removefiles);
+       return rho;
+     };
+   }
+   AsyncStepIO<DensMatElements<S>> rho_io, rhoFDM_io;
+   void io_report() const {
+     if (P.need_rho()) rho_io.statistics().report("DMNRG rho");
+     if (P.need_rhoFDM()) rhoFDM_io.statistics().report("DMNRG rhoFDM");
+   }
  
-   // Wrapper routine for recalculations
-   template <typename RecalcFnc>
-     MatrixElements<S> recalc(const std::string &name, const MatrixElements<S> &mold, RecalcFnc recalc_fnc, const std::string &tip,
-                              const Step &step, const DiagInfo<S> &diag, const SubspaceStructure &substruct) {
-       nrglog('0', "\n#### Recalculate " << tip << " " << name);
-       auto mnew = recalc_fnc(diag, substruct, mold);
-       if (tip == "g") Sym->recalc_global(step, diag, name, mnew);
-       return mnew;
+   // Place the matrices of a batch of operators side by side: <IN1||O||INp> = [<IN1||O_1||INp> | <IN1||O_2||INp> |
+   // ...]. Missing blocks are filled with zeros.
+   static MatrixElements<S> stack(const std::vector<MatrixElements<S> *> &batch) {
+     const auto n = batch.size();
+     std::map<Twoinvar, std::pair<size_t, size_t>> dims;
+     for (const auto m : batch)
+       for (const auto &[II, mat] : *m) {
+         const auto [it, inserted] = dims.emplace(II, std::make_pair(size1(mat), size2(mat)));
+         my_assert(inserted || it->second == std::make_pair(size1(mat), size2(mat)));
+       }
+     MatrixElements<S> stacked;
+     stacked.set_hermitian(std::all_of(batch.begin(), batch.end(), [](const auto m) { return m->hermitian(); }));
+     for (const auto &[II, d] : dims) {
+       const auto [rows, cols] = d;
+       auto &mat = stacked[II] = zero_matrix<S>(rows, n*cols);
+       for (const auto j : range0(n))
+         if (const auto it = batch[j]->find(II); it != batch[j]->end()) mat.middleCols(j*cols, cols) = it->second;
      }
+     stacked.update_metadata();
+     return stacked;
+   }
 
-   template <typename ... Args>
-     MatrixElements<S> recalc_or_clear(const bool selected, Args&& ... args) {
-       return selected ? recalc(std::forward<Args>(args)...) : MatrixElements<S>();
+   // Inverse of stack(). If no operator in the batch contributes to a block, recalc_general() returns a single
+   // dim1 x dimp zero matrix, which is then shared by all operators.
+   static void unstack(const MatrixElements<S> &stacked, const std::vector<MatrixElements<S> *> &batch, const DiagInfo<S> &diag) {
+     const auto n = batch.size();
+     for (auto m : batch) m->clear();
+     for (const auto &[II, mat] : stacked) {
+       const auto dimp = diag.dims(II.first, II.second).second;
+       for (const auto j : range0(n))
+         (*batch[j])[II] = size2(mat) == n*dimp ? Matrix_traits<S>(mat.middleCols(j*dimp, dimp)) : mat;
      }
+   }
+
+   // Operators of one type which are recalculated together
+   struct Pending {
+     std::string tip;
+     std::vector<MatrixElements<S> *> batch;
+     std::vector<std::string> names;
+     MatrixElements<S> stacked;           // input, if batch.size() > 1
+     const MatrixElements<S> *input{};    // either stacked or *batch[0]
+     MatrixElements<S> output;
+     size_t first_job{}, last_job{};      // range in the list of deferred jobs
+   };
 
-   // Recalculate operator matrix representations
+   // All selected operators of one type share the recalculation tables, so they are processed together as a batch:
+   // each product with a block of eigenvectors is then a single large matrix-matrix multiplication for the whole
+   // batch. Unselected operators are cleared.
+   template <typename Selected, typename RecalcFnc>
+     void prepare(std::list<Pending> &pending, const std::vector<RecalcJob<S>> &jobs, CustomOp<S> &set, Selected selected,
+                  RecalcFnc recalc_fnc, const std::string &tip, const DiagInfo<S> &diag, const SubspaceStructure &substruct) {
+       std::vector<Pending> group;
+       for (auto &[name, m] : set) {
+         if (!selected(name)) {
+           m = MatrixElements<S>();
+           continue;
+         }
+         if (group.empty() || !P.recalcbatch) group.push_back({tip});
+         group.back().batch.push_back(&m);
+         group.back().names.push_back(name);
+       }
+       for (auto &g : group) {
+         auto &p = pending.emplace_back(std::move(g));
+         nrglog('0', "\n#### Recalculate " << tip << " " << p.names[0] << (p.batch.size() > 1 ? fmt::format(" (batch of {})", p.batch.size()) : ""));
+         if (p.batch.size() > 1) p.stacked = stack(p.batch);
+         p.input = p.batch.size() > 1 ? &p.stacked : p.batch[0];
+         p.first_job = jobs.size();
+         p.output = recalc_fnc(diag, substruct, *p.input);
+         p.last_job = jobs.size();
+       }
+     }
+
+   // Perform the deferred recalc_general() calls in parallel, largest first. The output maps already contain the
+   // (placeholder) entries for all the results, so the threads only overwrite distinct existing elements.
+   void run_jobs(std::list<Pending> &pending, const std::vector<RecalcJob<S>> &jobs, const DiagInfo<S> &diag,
+                 const SubspaceStructure &substruct) {
+     std::vector<Matrix_traits<S> *> dest(jobs.size(), nullptr);
+     std::vector<double> cost(jobs.size(), 0.0);
+     for (auto &p : pending)
+       for (auto j = p.first_job; j < p.last_job; j++) {
+         dest[j] = &p.output.at(Twoinvar(jobs[j].I1, jobs[j].Ip));
+         cost[j] = jobs[j].cost * double(p.batch.size());
+       }
+     std::map<Matrix_traits<S> *, size_t> last; // if a result is assigned more than once, the last assignment counts
+     for (const auto j : range0(jobs.size())) last[dest[j]] = j;
+     std::vector<size_t> order;
+     for (const auto &[d, j] : last) order.push_back(j);
+     std::sort(order.begin(), order.end(), [&cost](const auto a, const auto b) { return cost[a] > cost[b]; });
+     // cppcheck-suppress unreadVariable symbolName=nth
+     const int nth = P.recalcth; // NOLINT
+#pragma omp parallel for schedule(dynamic) num_threads(nth)
+     for (size_t i = 0; i < order.size(); i++) {
+       const auto j = order[i];
+       *dest[j] = Sym->recalc_job(diag, substruct, jobs[j]);
+     }
+   }
+
+   void finish(Pending &p, const Step &step, const DiagInfo<S> &diag) {
+     if (p.batch.size() > 1)
+       unstack(p.output, p.batch, diag);
+     else
+       *p.batch[0] = std::move(p.output);
+     if (p.tip == "g")
+       for (const auto j : range0(p.batch.size())) Sym->recalc_global(step, diag, p.names[j], *p.batch[j]);
+     for (auto m : p.batch) m->update_metadata();
+   }
+
+   // Recalculate operator matrix representations. The recalc_general() calls are first collected for all operators
+   // (each of them computes an independent block of the result) and then executed using P.recalcth threads.
    void recalculate_operators(Operators<S> &a, const Step &step, const DiagInfo<S> &diag, const SubspaceStructure &substruct, const Params &P) {
      nrglog('@', "recalculate_operators()");
      const auto section_timing = mt.time_it("recalc");
-       for (auto &[name, m] : a.ops)
-         m = recalc_or_clear(ops.do_s(name, P, step), name, m, [this](const auto &... pr) { return Sym->recalc_singlet(pr..., 1);  }, "s", step, diag, substruct);
-       for (auto &[name, m] : a.opsp)
-         m = recalc_or_clear(ops.count({"p", name}),  name, m, [this](const auto &... pr) { return Sym->recalc_singlet(pr..., -1); }, "p", step, diag, substruct);
-       for (auto &[name, m] : a.opsg)
-         m = recalc_or_clear(ops.do_g(name, P, step), name, m, [this](const auto &... pr) { return Sym->recalc_singlet(pr...,  1); }, "g", step, diag, substruct);
-       for (auto &[name, m] : a.opd)
-         m = recalc_or_clear(ops.count({"d", name}),  name, m, [this](const auto &... pr) { return Sym->recalc_doublet(pr...);     }, "d", step, diag, substruct);
-       for (auto &[name, m] : a.opt)
-         m = recalc_or_clear(ops.count({"t", name}),  name, m, [this](const auto &... pr) { return Sym->recalc_triplet(pr...);     }, "t", step, diag, substruct);
-       for (auto &[name, m] : a.opot)
-         m = recalc_or_clear(ops.count({"ot", name}), name, m, [this](const auto &... pr) { return Sym->recalc_orb_triplet(pr...); }, "ot", step, diag, substruct);
-       for (auto &[name, m] : a.opq)
-         m = recalc_or_clear(ops.count({"q", name}),  name, m, [this](const auto &... pr) { return Sym->recalc_quadruplet(pr...);  }, "q", step, diag, substruct);
+     Sym->recalc_planner().clear(); // block dimensions change from step to step
+     std::list<Pending> pending;
+     std::vector<RecalcJob<S>> jobs;
+     {
+       struct Defer { // RAII
+         const Symmetry<S> *sym;
+         Defer(const Symmetry<S> *sym, std::vector<RecalcJob<S>> *jobs) : sym(sym) { sym->defer_recalc(jobs); }
+         ~Defer() { sym->defer_recalc(nullptr); }
+         Defer(const Defer &) = delete;
+         Defer &operator=(const Defer &) = delete;
+       } defer(Sym.get(), P.recalcth > 1 ? &jobs : nullptr);
+       prepare(pending, jobs, a.ops,  [&](const auto &name) { return ops.do_s(name, P, step); },     [this](const auto &... pr) { return Sym->recalc_singlet(pr..., 1);  }, "s", diag, substruct);
+       prepare(pending, jobs, a.opsp, [&](const auto &name) { return ops.count({"p", name}) > 0; },  [this](const auto &... pr) { return Sym->recalc_singlet(pr..., -1); }, "p", diag, substruct);
+       prepare(pending, jobs, a.opsg, [&](const auto &name) { return ops.do_g(name, P, step); },     [this](const auto &... pr) { return Sym->recalc_singlet(pr...,  1); }, "g", diag, substruct);
+       prepare(pending, jobs, a.opd,  [&](const auto &name) { return ops.count({"d", name}) > 0; },  [this](const auto &... pr) { return Sym->recalc_doublet(pr...);     }, "d", diag, substruct);
+       prepare(pending, jobs, a.opt,  [&](const auto &name) { return ops.count({"t", name}) > 0; },  [this](const auto &... pr) { return Sym->recalc_triplet(pr...);     }, "t", diag, substruct);
+       prepare(pending, jobs, a.opot, [&](const auto &name) { return ops.count({"ot", name}) > 0; }, [this](const auto &... pr) { return Sym->recalc_orb_triplet(pr...); }, "ot", diag, substruct);
+       prepare(pending, jobs, a.opq,  [&](const auto &name) { return ops.count({"q", name}) > 0; },  [this](const auto &... pr) { return Sym->recalc_quadruplet(pr...);  }, "q", diag, substruct);
      }
+     if (!jobs.empty()) run_jobs(pending, jobs, diag, substruct);
+     for (auto &p : pending) finish(p, step, diag);
+     release_scratch(); // block dimensions change from step to step
+     if (P.logletter('p')) Sym->recalc_planner().report();
+   }
 
    // Establish the data structures for storing spectral information [and prepare output files].
    template<typename A, typename M>
-     [[nodiscard]] bool prepare_spec_algo(std::string prefix, const Params &P, FactorFnc ff, CheckFnc cf, M && op1, M && op2, int spin,
+     [[nodiscard]] bool prepare_spec_algo(std::string prefix, const Params &P, const SpecFactor kind, M && op1, M && op2, int spin,
                             std::string name, const gf_type gt) {
-       BaseSpectrum<S> spec(std::forward<M>(op1), std::forward<M>(op2), spin, std::make_shared<A>(name, prefix, gt, P), ff, cf);
+       BaseSpectrum<S> spec(std::forward<M>(op1), std::forward<M>(op2), spin, std::make_shared<A>(name, prefix, gt, P), kind);
        sl.push_back(spec);
        return true; // recalculation of operators required
      }
@@ -144,13 +266,13 @@ class Oprecalc {
    }
 
    void loopover(const CustomOp<S> &set1, const CustomOp<S> &set2,
-                 const string_token &stringtoken, FactorFnc ff, CheckFnc cf,
+                 const string_token &stringtoken, const SpecFactor kind,
                  const std::string &prefix,
                  const std::string &type1, const std::string &type2, const gf_type gt, const int spin) {
     for (const auto &[name1, op1] : set1) {
       for (const auto &[name2, op2] : set2) {
         if (const auto name = sdname(name1, name2, spin); stringtoken.find(name)) {
-          if (prepare_spec(prefix, ff, cf, op1, op2, spin, name, gt)) {
+          if (prepare_spec(prefix, kind, op1, op2, spin, name, gt)) {
             ops.insert({type1, name1});
             ops.insert({type2, name2});
           }
@@ -161,45 +283,47 @@ class Oprecalc {
 
   // Reset lists of operators which need to be iterated
   Oprecalc(const RUNTYPE &runtype, const Operators<S> &a, std::shared_ptr<Symmetry<S>> Sym, MemTime &mt, const Params &P) :
-    runtype(runtype), Sym(Sym), mt(mt), P(P)
+    runtype(runtype), Sym(Sym), mt(mt), P(P),
+    rho_io(dm_loader(fn_rho, P), P.asyncio && runtype == RUNTYPE::DMNRG),
+    rhoFDM_io(dm_loader(fn_rhoFDM, P), P.asyncio && runtype == RUNTYPE::DMNRG)
   {
     std::cout << std::endl << "Computing the following spectra:" << std::endl;
     // Correlators (singlet operators of all kinds)
     string_token sts(P.specs);
-    loopover(a.ops,  a.ops,  sts, Sym->CorrelatorFactorFnc(), Sym->TrivialCheckSpinFnc(), "corr", "s", "s", gf_type::bosonic, 0);
-    loopover(a.opsp, a.opsp, sts, Sym->CorrelatorFactorFnc(), Sym->TrivialCheckSpinFnc(), "corr", "p", "p", gf_type::bosonic, 0);
-    loopover(a.opsg, a.opsg, sts, Sym->CorrelatorFactorFnc(), Sym->TrivialCheckSpinFnc(), "corr", "g", "g", gf_type::bosonic, 0);
-    loopover(a.ops,  a.opsg, sts, Sym->CorrelatorFactorFnc(), Sym->TrivialCheckSpinFnc(), "corr", "s", "g", gf_type::bosonic, 0);
-    loopover(a.opsg, a.ops,  sts, Sym->CorrelatorFactorFnc(), Sym->TrivialCheckSpinFnc(), "corr", "g", "s", gf_type::bosonic, 0);
+    loopover(a.ops,  a.ops,  sts, SpecFactor::correlator, "corr", "s", "s", gf_type::bosonic, 0);
+    loopover(a.opsp, a.opsp, sts, SpecFactor::correlator, "corr", "p", "p", gf_type::bosonic, 0);
+    loopover(a.opsg, a.opsg, sts, SpecFactor::correlator, "corr", "g", "g", gf_type::bosonic, 0);
+    loopover(a.ops,  a.opsg, sts, SpecFactor::correlator, "corr", "s", "g", gf_type::bosonic, 0);
+    loopover(a.opsg, a.ops,  sts, SpecFactor::correlator, "corr", "g", "s", gf_type::bosonic, 0);
     // Global susceptibilities (global singlet operators)
     string_token stchit(P.specchit);
-    loopover(a.ops,  a.ops,  stchit, Sym->CorrelatorFactorFnc(), Sym->TrivialCheckSpinFnc(), "chit", "s", "s", gf_type::bosonic, 0);
-    loopover(a.ops,  a.opsg, stchit, Sym->CorrelatorFactorFnc(), Sym->TrivialCheckSpinFnc(), "chit", "s", "g", gf_type::bosonic, 0);
-    loopover(a.opsg, a.ops,  stchit, Sym->CorrelatorFactorFnc(), Sym->TrivialCheckSpinFnc(), "chit", "g", "s", gf_type::bosonic, 0);
-    loopover(a.opsg, a.opsg, stchit, Sym->CorrelatorFactorFnc(), Sym->TrivialCheckSpinFnc(), "chit", "g", "g", gf_type::bosonic, 0);
+    loopover(a.ops,  a.ops,  stchit, SpecFactor::correlator, "chit", "s", "s", gf_type::bosonic, 0);
+    loopover(a.ops,  a.opsg, stchit, SpecFactor::correlator, "chit", "s", "g", gf_type::bosonic, 0);
+    loopover(a.opsg, a.ops,  stchit, SpecFactor::correlator, "chit", "g", "s", gf_type::bosonic, 0);
+    loopover(a.opsg, a.opsg, stchit, SpecFactor::correlator, "chit", "g", "g", gf_type::bosonic, 0);
     // Dynamic spin susceptibilities (triplet operators)
     string_token stt(P.spect);
-    loopover(a.opt, a.opt, stt, Sym->SpinSuscFactorFnc(), Sym->TrivialCheckSpinFnc(),  "spin", "t", "t", gf_type::bosonic, 0);
+    loopover(a.opt, a.opt, stt, SpecFactor::spinsusc, "spin", "t", "t", gf_type::bosonic, 0);
     string_token stot(P.specot);
-    loopover(a.opot, a.opot, stot, Sym->OrbSuscFactorFnc(), Sym->TrivialCheckSpinFnc(), "orbspin", "ot", "ot", gf_type::bosonic, 0);
+    loopover(a.opot, a.opot, stot, SpecFactor::orbsusc, "orbspin", "ot", "ot", gf_type::bosonic, 0);
     const auto varmin = Sym->isfield() ? -1 : 0;
     const auto varmax = Sym->isfield() ? +1 : 0;
     // Spectral functions (doublet operators)
     string_token std(P.specd);
     for (int SPIN = varmin; SPIN <= varmax; SPIN += 2)
-      loopover(a.opd, a.opd, std, Sym->SpecdensFactorFnc(), Sym->SpecdensCheckSpinFnc(), "spec", "d", "d", gf_type::fermionic, SPIN);
+      loopover(a.opd, a.opd, std, SpecFactor::specdens, "spec", "d", "d", gf_type::fermionic, SPIN);
     string_token stgt(P.specgt);
     for (int SPIN = varmin; SPIN <= varmax; SPIN += 2)
-      loopover(a.opd, a.opd, stgt, Sym->SpecdensFactorFnc(), Sym->SpecdensCheckSpinFnc(), "gt", "d", "d", gf_type::fermionic, SPIN);
+      loopover(a.opd, a.opd, stgt, SpecFactor::specdens, "gt", "d", "d", gf_type::fermionic, SPIN);
     string_token sti1t(P.speci1t);
     for (int SPIN = varmin; SPIN <= varmax; SPIN += 2)
-      loopover(a.opd, a.opd, sti1t, Sym->SpecdensFactorFnc(), Sym->SpecdensCheckSpinFnc(),"i1t", "d", "d", gf_type::fermionic, SPIN);
+      loopover(a.opd, a.opd, sti1t, SpecFactor::specdens, "i1t", "d", "d", gf_type::fermionic, SPIN);
     string_token sti2t(P.speci2t);
     for (int SPIN = varmin; SPIN <= varmax; SPIN += 2)
-      loopover(a.opd, a.opd, sti2t, Sym->SpecdensFactorFnc(), Sym->SpecdensCheckSpinFnc(), "i2t", "d", "d", gf_type::fermionic, SPIN);
+      loopover(a.opd, a.opd, sti2t, SpecFactor::specdens, "i2t", "d", "d", gf_type::fermionic, SPIN);
     // Spectral functions (quadruplet operators)
     string_token stq(P.specq);
-    loopover(a.opq, a.opq, stq, Sym->SpecdensquadFactorFnc(), Sym->TrivialCheckSpinFnc(),  "specq", "q", "q", gf_type::fermionic, 0);
+    loopover(a.opq, a.opq, stq, SpecFactor::specdensquad, "specq", "q", "q", gf_type::fermionic, 0);
     ops.report();
   }
 };
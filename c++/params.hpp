@@ -12,11 +12,14 @@
 
 #include <boost/archive/binary_iarchive.hpp>
 #include <boost/archive/binary_oarchive.hpp>
+#include <boost/serialization/map.hpp>
 
 #include <fmt/format.h>
 
 #include "misc.hpp" // contains, from_string, is_stdout_redirected, parsing code
 #include "workdir.hpp"
+#include "compression.hpp"
+#include "invar.hpp"
 #include "h5.hpp"
 
 namespace NRG {
@@ -157,6 +160,18 @@ class Params {
   param<bool> restart{"restart", "Restart calculation to achieve truncation goal?", "true", all}; // N
   param<double> restartfactor{"restartfactor", "Rescale factor for restart=true", "2.0", all};    // N
 
+  // If restartincr=true, only the subspaces where the partial spectrum did not reach the truncation cutoff are
+  // re-diagonalised on restart; the results in other subspaces are retained. The kept states are the same as with a
+  // full restart, but fewer discarded states are available for the thermodynamic quantities.
+  param<bool> restartincr{"restartincr", "Re-diagonalise only insufficient subspaces on restart", "false", all}; // N
+
+  // Two-phase diagonalisation: in the first phase only the eigenvalues are computed in all subspaces, which
+  // determines the truncation cutoff. In the second phase the eigenvectors are computed (dsyevr/zheevr) only for
+  // the states that will be retained (plus one extra state per subspace). This replaces the diagratio guess, but
+  // it is only applicable in calculations that do not require the discarded states (i.e., not for CFS/FDM). As
+  // with diagratio<1, the thermodynamic quantities are computed using the computed states only.
+  param<bool> twophase{"twophase", "Eigenvalue-first two-phase diagonalisation", "false", all}; // N
+
   // Truncation parameters. If keepenergy>0.0, then the cut-off
   // energy truncation scheme will be used. Parameter 'keep' is then
   // used to cap the maximum number of states. If 'keepmin' is set to
@@ -285,6 +300,39 @@ class Params {
   // Number of concurrent threads for matrix diagonalisation
   param<int> diagth{"diagth", "Diagonalisation threads", "1", all}; // N
 
+  // Multithreaded LAPACK for large subspaces in the OpenMP diagonalisation engine. The subspaces whose estimated
+  // cost (dim^3) exceeds 1/diagth of the total are diagonalised one after another using multithreaded LAPACK on all
+  // diagth cores, after the small ones have been diagonalised concurrently with single-threaded LAPACK.
+  param<bool> diagnested{"diagnested", "Multithreaded LAPACK for large subspaces in DiagOpenMP", "false", all}; // N
+
+  // Construct the Hamiltonian matrices on the MPI slaves. The master broadcasts the eigenvalues from the previous
+  // step, the <||f||> matrix elements and the coefficient tables once per step, instead of sending a dense matrix for
+  // each subspace. Ignored if the Hamiltonian matrices are to be stored (h5ham).
+  param<bool> mpiham{"mpiham", "Construct Hamiltonian matrices on MPI slaves", "false", all}; // N
+
+  // Evaluate the matrix products in recalc_general() according to an execution plan: the multiplication order is
+  // chosen based on the block dimensions and the terms sharing the same eigenvector block are summed up before the
+  // multiplication with that block. Use log=p to report the operation counts.
+  param<bool> recalcplan{"recalcplan", "Planned matrix products in operator recalculation", "true", all}; // N
+
+  // Skip the contributions to the recalculated operator matrices whose norm is guaranteed to be below this
+  // threshold. With the default value, only the operator matrix blocks which are exactly zero are skipped, which does
+  // not affect the results. A negative value disables skipping. Use log=p to report the number of skipped terms.
+  param<double> recalcskip{"recalcskip", "Threshold for skipping negligible terms in operator recalculation", "0", all}; // N
+
+  // The density matrices and the diagonal blocks <I||O||I> of Hermitian singlet operators are Hermitian. If enabled,
+  // only one triangle of these matrices is computed (triangular matrix product) and then mirrored. The operators are
+  // recognized as Hermitian automatically, the general path is used otherwise.
+  param<bool> recalchermitian{"recalchermitian", "Exploit hermiticity in recalculations", "true", all}; // N
+
+  // Number of threads for the recalculation of operators. The independent blocks <I1||O||Ip> of all operators are
+  // computed concurrently, the largest first.
+  param<int> recalcth{"recalcth", "Operator recalculation threads", "1", all}; // N
+
+  // Recalculate the operators of the same type (singlet, doublet, etc.) together. Their matrices are placed side by
+  // side, so that each multiplication with a block of eigenvectors is a single large GEMM for all operators.
+  param<bool> recalcbatch{"recalcbatch", "Batched recalculation of operators of the same type", "true", all}; // N
+
   // Interleaved diagonalization
   param<bool> substeps{"substeps", "Interleaved diagonalization", "false", all}; // N
 
@@ -414,11 +462,13 @@ class Params {
    e - dump eigenvalues in function diagonalize_h()
    A - eigensolver diagnostics (routine used, matrix size)
    t - timing for eigensolver routines
+   W - LAPACK workspace allocation statistics
    m - dump Hamiltonian matrix of each subspace [very verbose!]
    f - follow recalc_f() [low-level]
    F - matrix elements in recalc_f() [very verbose!]
    r - follow recalc_general() [low-level]
    R - matrix elements in recalc_general() [very verbose!]
+   p - operation counts of the recalculation plans
    g - follow calc_generic() [low-level]
    w - calculation of weights w_n
    M - MPI parallelization details
@@ -478,11 +528,24 @@ class Params {
   // matrix files are kept after the calculation.
   param<bool> removefiles{"removefiles", "Remove temporary data files?", "true", all}; // N
 
+  // Read and write the unitary transformation and density matrix files in a background thread, overlapping the
+  // I/O with the computation in the DM and FDM backward sweeps and in the DMNRG run.
+  param<bool> asyncio{"asyncio", "Asynchronous workdir I/O", "true", all}; // N
+
+  // Keep the unitary transformation and density matrix files in memory up to this amount of data, spilling the least
+  // recently used ones to disk beyond it. 0 means that all files go to disk.
+  param<size_t> workdirmem{"workdirmem", "Memory budget for workdir files [MB]", "0", all}; // N
+
+  // Compression of the unitary transformation and density matrix files: none, lossless or float32 (lossy, relative
+  // error up to 6e-8), see compression.hpp.
+  param<std::string> workdircodec{"workdircodec", "Compression of workdir files", "none", all}; // N
+
   param<bool> checksumrules{"checksumrules", "Check operator sumrules", "false", all}; // N
 
   param<bool> absolute{"absolute", "Do NRG without any rescaling", "false", all};
 
-  // Parallelization strategy: MPI, OpenMP or serial
+  // Parallelization strategy: MPI, OpenMP, serial or hybrid. In the hybrid mode each MPI rank diagonalises a batch of
+  // subspaces using diagth OpenMP threads, see DiagHybrid.
   param<std::string> diag_mode{"diag_mode", "Parallelization strategy", "MPI", all};
 
   param<bool> h5raw{"h5raw", "Store raw data in an HDF5 file", "false", all};
@@ -552,6 +615,7 @@ class Params {
   bool fdm_flags() const noexcept { return fdm || fdmgt || fdmls || fdmmats || fdmexpv; }
   bool dmnrg_flags() const noexcept { return dmnrg || dmnrgmats; }
   bool cfs_or_fdm_flags() const noexcept { return cfs_flags() || fdm_flags(); }
+  Codec codec() const { return codec_from_string(workdircodec); }
   bool dm_flags() const noexcept { return cfs_flags() || fdm_flags() || dmnrg_flags(); }
   bool keep_all_states_in_last_step() const noexcept { return lastall || (cfs_or_fdm_flags() && !lastalloverride); }
   bool need_rho() const noexcept { return cfs_flags() || dmnrg_flags(); }
@@ -569,9 +633,7 @@ class Params {
     if (resume) {
       laststored = std::nullopt;
       for (size_t N = Ninit; N < Nmax; N++) {
-        const std::string fn = workdir->unitaryfn(N);
-        std::ifstream F(fn);
-        if (F.good())
+        if (workdir->exists(workdir->unitaryfn(N)))
           laststored = N;
       }
       if (laststored.has_value()) 
@@ -590,10 +652,12 @@ class Params {
       my_assert(0.0 < diagratio && diagratio <= 1.0);
       if (cfs_flags() && diagratio != 1.0) throw std::invalid_argument("CFS/FDM is not compatible with partial diagonalisation.");
     }
+    if (twophase && cfs_or_fdm_flags()) throw std::invalid_argument("CFS/FDM is not compatible with two-phase diagonalisation.");
     my_assert(!(dumpabs && dumpscaled)); // dumpabs=true and dumpscaled=true is a meaningless combination
     // Take the first character (for backward compatibility)
     discretization = std::string(discretization, 0, 1);
     if (chitp_ratio > 0.0) chitp = chitp_ratio / betabar;
+    [[maybe_unused]] const auto c = codec(); // throws if unknown
   }
 
   void dump(std::ostream &F = std::cout) {
@@ -638,6 +702,7 @@ class Params {
       }
     }
     validate();
+    workdir->set_memory_budget(workdirmem * 1024 * 1024);
     init_laststored();
     if (!quiet) dump();
   }
@@ -700,12 +765,18 @@ class DiagParams {
    double diagratio{};
    bool logall{};
    std::string logstr{};
+   char jobz = 'V';                    // 'N' for eigenvalues only
+   std::map<Invar, size_t> nrwanted{}; // number of eigenpairs to compute in each subspace (two-phase diagonalisation)
 
    DiagParams() {}
    explicit DiagParams(const Params &P, const double diagratio_ = -1) :
      diag(P.diag), diagratio(diagratio_ > 0 ? diagratio_ : P.diagratio),
      logall(P.logall), logstr(P.logstr) {}
    bool logletter(char c) const { return logall ? true : logstr.find(c) != std::string::npos; }
+   size_t wanted(const Invar &I) const { // 0 = not specified
+     const auto f = nrwanted.find(I);
+     return f != nrwanted.cend() ? f->second : 0;
+   }
 
  private:
    friend class boost::serialization::access;
@@ -714,6 +785,8 @@ class DiagParams {
       ar &diagratio;
       ar &logall;
       ar &logstr;
+      ar &jobz;
+      ar &nrwanted;
    }
 };
 
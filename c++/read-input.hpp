@@ -77,6 +77,12 @@ private:
   size_t channels;
   size_t Nmax;
   size_t nsubs;
+  // Hermiticity of the singlet operators is established here, once, and then carried along, see MatrixElements.
+  void read_singlet(MatrixElements<S> &m, std::istream &fdata) {
+    m = MatrixElements<S>(fdata, diag);
+    m.set_hermitian(m.check_hermitian());
+    m.update_metadata();
+  }
 public:
   std::shared_ptr<Symmetry<S>> Sym;
   DiagInfo<S> diag;
@@ -103,9 +109,9 @@ public:
         case '#':
           break; // ignore embedded comment lines
         case 'e': GS_energy = read_one<double>(fdata); break;
-        case 's': operators.ops[opname]  = MatrixElements<S>(fdata, diag); break;
+        case 's': read_singlet(operators.ops[opname], fdata); break;
         case 'p': operators.opsp[opname] = MatrixElements<S>(fdata, diag); break;
-        case 'g': operators.opsg[opname] = MatrixElements<S>(fdata, diag); break;
+        case 'g': read_singlet(operators.opsg[opname], fdata); break;
         case 'd': operators.opd[opname]  = MatrixElements<S>(fdata, diag); break;
         case 't': operators.opt[opname]  = MatrixElements<S>(fdata, diag); break;
         case 'o': operators.opot[opname] = MatrixElements<S>(fdata, diag); break;
@@ -12,21 +12,19 @@
 
 namespace NRG {
 
-// We split the matrices of eigenvectors into blocks according to the partition into "ancestor subspaces". At the price
-// of some copying, this increases memory locality of data and thus improves numerical performence of matrix-matrix multiplies
-// in the recalculation of matrix elements. Note that the original (matrix) data is discarded after the splitting.
-template<scalar S, typename Matrix = Matrix_traits<S>>
+// We split the matrices of eigenvectors into blocks according to the partition into "ancestor subspaces". The blocks
+// are strided views into the eigenvector matrix, whose storage is handed over from e.vectors without copying. The
+// matrix-matrix multiplies in the recalculation of matrix elements then operate directly on these views.
+template<scalar S>
 inline void split_in_blocks_Eigen(Eigen<S> &e, const SubspaceDimensions &sub) {
-  const auto combs = sub.combs();
-  e.U.resize(combs);
   const auto nr = e.getnrstored();
   my_assert(0 < nr && nr <= e.getdim());
-  for (const auto block: range0(combs)) {
-    Matrix U = e.vectors.submatrix_const({0, nr}, sub.part(block));
-    e.U.set(block, std::move(U));
-  }
+  std::vector<std::pair<size_t, size_t>> parts;
+  for (const auto block: range0(sub.combs())) parts.push_back(sub.part(block));
+  auto m = e.vectors.release();
+  NRG::resize(m, nr, e.getdim()); // no-op unless the eigenvectors were already truncated
+  e.U.set(std::move(m), std::move(parts));
   assert(e.U.is_unitary());
-  e.vectors.shrink();
 }
 
 template<scalar S>
@@ -65,52 +63,204 @@ auto Symmetry<S>::recalc_f(const DiagInfo<S> &diag,
   nrglog('f', "dim1=" << dim1 << " dimp=" << dimp);
   auto f = zero_matrix<S>(dim1, dimp);
   // <I1||f||Ip> gets contributions from various |QSr> states. These are given by i1, ip in the Recalc_f type tables.
+  // Each contribution is a product of two eigenvector blocks, f += factor U1 Up^\dag. Instead of many small GEMMs, the
+  // blocks are concatenated along the combination axis (with the factors folded into the U1 blocks) and the sum is
+  // computed as a single GEMM: f = [factor_1 U1(i1_1) | factor_2 U1(i1_2) | ...] [Up(ip_1) | Up(ip_2) | ...]^\dag.
+  size_t len = 0;
+  for (const auto &[i1, ip, factor]: table)
+    if (finite_size(diagI1.U(i1)) && finite_size(diagIp.U(ip))) len += size2(diagI1.U(i1));
+  auto A = scratch_matrix<S, 0>(dim1, len);
+  auto B = scratch_matrix<S, 1>(dimp, len);
+  size_t offset = 0;
   for (const auto &[i1, ip, factor]: table) {
     nrglog('f', "** i1=" << i1 << " ip=" << ip << " factor=" << factor);
     const auto U1 = diagI1.U(i1);
     const auto Up = diagIp.U(ip);
     nrglog('f', "* norm1=" << frobenius_norm(U1) << " normp=" << frobenius_norm(Up));
-    if (finite_size(U1) && finite_size(Up)) nrglog('f', "* U1(0,0)=" << U1(0,0) << " Up(0,0)=" << Up(0,0));
-    product<S>(f, factor, U1, Up);
+    if (!finite_size(U1) || !finite_size(Up)) continue;
+    nrglog('f', "* U1(0,0)=" << U1(0,0) << " Up(0,0)=" << Up(0,0));
+    my_assert(size2(U1) == size2(Up));
+    my_assert(my_isfinite(factor));
+    const auto r = size2(U1);
+    A.middleCols(offset, r) = factor * U1;
+    B.middleCols(offset, r) = Up;
+    offset += r;
   }
+  if (len) gemm<GemmOp::N, GemmOp::H>(f, S(1), A, B, S(0));
   if (P.logletter('F')) dump_matrix(f);
   return f;
 }
 
+// Evaluate the sum of f A O B^\dag over the terms of the recalculation table in the order determined by the plan,
+// see recalc_plan.hpp. The intermediate products are formed in a per-thread scratch matrix. The operator matrices
+// may hold a batch of 'width' operators placed side by side, O = [O_1 | O_2 | ...], in which case the result is
+// [A O_1 B^\dag | A O_2 B^\dag | ...] and each product with A is a single GEMM for the whole batch. The operator
+// blocks are passed as a dense array indexed by the position in the recalculation table, see recalc_compute().
+// All products are evaluated by gemm(), see blas_gemm.hpp.
+template<scalar S>
+void recalc_execute(EigenMatrix<S> &cn, const RecalcPlan &plan, const size_t width, const Recalc<S> *table,
+                    const Eigen<S> &diagI1, const Eigen<S> &diagIp, const EigenMatrix<S> *const *blocks) {
+  const auto dimp = plan.dimp;
+  const auto &terms = plan.terms;
+  // cn += T B^\dag, where T = [T_1 | T_2 | ...] is dim1 x width*rp
+  auto multiply_B = [&cn, &diagIp, width, dimp](const auto &T, const size_t ip, const size_t rp) {
+    const auto Up = diagIp.U(ip);
+    for (size_t j = 0; j < width; j++)
+      gemm<GemmOp::N, GemmOp::H>(cn.middleCols(j*dimp, dimp), S(1), T.middleCols(j*rp, rp), Up, S(1));
+  };
+  // T += f O B^\dag, where T is r1 x width*dimp
+  auto add_OB = [&diagIp, width, dimp](auto &T, const auto factor, const EigenMatrix<S> &O, const size_t ip, const size_t rp) {
+    const auto Up = diagIp.U(ip);
+    for (size_t j = 0; j < width; j++)
+      gemm<GemmOp::N, GemmOp::H>(T.middleCols(j*dimp, dimp), S(factor), O.middleCols(j*rp, rp), Up, S(1));
+  };
+  if (plan.grouping == RecalcGrouping::none) {
+    for (const auto &t : terms) {
+      const auto &r = table[t.k];
+      const auto &O = *blocks[t.k];
+      if (t.order == RecalcOrder::left) {
+        auto T = scratch_matrix<S>(plan.dim1, width*t.rp);
+        gemm<GemmOp::N, GemmOp::N>(T, S(r.factor), diagI1.U(t.i1), O, S(0));
+        multiply_B(T, t.ip, t.rp);
+      } else {
+        auto T = scratch_matrix<S>(t.r1, width*dimp);
+        T.setZero();
+        add_OB(T, r.factor, O, t.ip, t.rp);
+        gemm<GemmOp::N, GemmOp::N>(cn, S(1), diagI1.U(t.i1), T, S(1));
+      }
+    }
+    return;
+  }
+  // Grouped evaluation: the terms with the same group key are consecutive
+  for (size_t begin = 0; begin < terms.size();) {
+    const auto &first = terms[begin];
+    const auto key = plan.group(first);
+    auto end = begin;
+    while (end < terms.size() && plan.group(terms[end]) == key) end++;
+    if (plan.grouping == RecalcGrouping::ip) { // sum_i1 f A O, then multiply by B^\dag
+      auto T = scratch_matrix<S>(plan.dim1, width*first.rp);
+      T.setZero();
+      for (auto i = begin; i < end; i++) {
+        const auto &r = table[terms[i].k];
+        gemm<GemmOp::N, GemmOp::N>(T, S(r.factor), diagI1.U(terms[i].i1), *blocks[terms[i].k], S(1));
+      }
+      multiply_B(T, first.ip, first.rp);
+    } else { // sum_ip f O B^\dag, then multiply by A
+      auto T = scratch_matrix<S>(first.r1, width*dimp);
+      T.setZero();
+      for (auto i = begin; i < end; i++) {
+        const auto &r = table[terms[i].k];
+        add_OB(T, r.factor, *blocks[terms[i].k], terms[i].ip, terms[i].rp);
+      }
+      gemm<GemmOp::N, GemmOp::N>(cn, S(1), diagI1.U(first.i1), T, S(1));
+    }
+    begin = end;
+  }
+}
+
 // Recalculate the (irreducible) matrix elements of various operators. This is the most important routine in this
 // program, so it is heavily instrumentalized for debugging purposes. It is called from recalc_doublet(),
-// recalc_singlet(), and other routines. The inner-most for() loops can be found here, so this is the right spot that
-// one should try to hand optimize.
-template<scalar S> template<typename T>
-std::optional<Matrix_traits<S>> Symmetry<S>::recalc_general(const DiagInfo<S> &diag,
+// recalc_singlet(), and other routines. If the calculation is deferred (see defer_recalc()), only the job is
+// recorded here and the placeholder matrix is later overwritten by the result of recalc_job(). The generated code
+// passes the concrete symmetry class as sym, thus triangle_inequality() is not called through the virtual table.
+template<scalar S> template<typename Sym, typename T>
+std::optional<Matrix_traits<S>> Symmetry<S>::recalc_general(const Sym &sym,              // concrete symmetry class
+                                                            const DiagInfo<S> &diag,
                                                             const SubspaceStructure &substruct,
-                                                            const MatrixElements<S> &cold,
+                                                            const BlockIndexPtr<S> &blocks, // operator at the previous step
                                                             const Invar &I1,             // target subspace (bra)
                                                             const Invar &Ip,             // target subspace (ket)
                                                             const T &table,
                                                             const Invar &Iop) const      // quantum numbers of the operator
 {
   if (P.logletter('r')) std::cout << "*** recalc_general: " << nrgdump3(I1, Ip, Iop) << std::endl;
-  if (!triangle_inequality(I1, Ip, Iop)) return {};
+  if (!sym.triangle_inequality(I1, Ip, Iop)) return {};
+  if (deferred) {
+    const auto & [dim1, dimp] = diag.dims(I1, Ip);
+    const auto cost = double(dim1) * double(dimp) * double(dim1 + dimp) * double(std::size(table));
+    deferred->push_back({I1, Ip, Iop, {std::begin(table), std::end(table)}, blocks, cost});
+    return Matrix_traits<S>();
+  }
+  return recalc_compute(diag, substruct, *blocks, I1, Ip, table, Iop);
+}
+
+// The inner-most for() loops can be found here, so this is the right spot that one should try to hand optimize. The
+// matrix products are evaluated according to an execution plan which minimizes the operation count, see
+// recalc_plan.hpp. The table entries are first resolved against the subspace structure (ancestor subspaces and their
+// dimensions, computed once per step in SubspaceStructure) and against the index of the operator blocks, so that the
+// evaluation itself works on dense arrays indexed by the position in the table. Thread-safe.
+template<scalar S> template<typename T>
+Matrix_traits<S> Symmetry<S>::recalc_compute(const DiagInfo<S> &diag,
+                                             const SubspaceStructure &substruct,
+                                             const BlockIndex<S> &index,
+                                             const Invar &I1,
+                                             const Invar &Ip,
+                                             const T &table,
+                                             const Invar &Iop) const
+{
   const auto & [diagI1, diagIp] = diag.subs(I1, Ip);
   const auto & [dim1, dimp]     = diag.dims(I1, Ip);
-  const Twoinvar II = {I1, Ip};
-  auto cn = zero_matrix<S>(dim1, dimp);
-  if (dim1 == 0 || dimp == 0) return cn; // return empty matrix
-  for (const auto &[i1, ip, IN1, INp, factor]: table) {
+  if (dim1 == 0 || dimp == 0) return zero_matrix<S>(dim1, dimp); // return empty matrix
+  const auto &sub1 = substruct.at(I1);
+  const auto &subp = substruct.at(Ip);
+  std::vector<RecalcPlan::Term> terms;
+  std::vector<const Matrix *> blocks(std::size(table), nullptr); // operator block for each contributing entry
+  bool hermitian_terms = true; // all contributions are of the form f A O A^\dag with real f and Hermitian O
+  size_t width = 0; // number of operators in a batch, see Oprecalc::recalculate_operators()
+  for (const auto &[k, entry]: table | ranges::views::enumerate) {
+    const auto &[i1, ip, factor] = entry;
     my_assert(1 <= i1 && i1 <= nr_combs() && 1 <= ip && ip <= nr_combs());
-    if (P.logletter('r')) std::cout << nrgdump7(i1, ip, IN1, ancestor(I1,i1-1), INp, ancestor(Ip,ip-1), factor) << std::endl;
-    if (!Invar_allowed(IN1) || !Invar_allowed(INp)) continue;
-    my_assert(IN1 == ancestor(I1, i1-1));
-    my_assert(INp == ancestor(Ip, ip-1));
-    const auto rmax1 = substruct.at(I1).rmax(i1-1);
-    const auto rmaxp = substruct.at(Ip).rmax(ip-1);
-    if (rmax1 == 0 || rmaxp == 0) continue;
-    const Twoinvar ININ = {IN1, INp};
-    if (cold.count(ININ) == 0) continue;
+    if (P.logletter('r')) std::cout << nrgdump5(i1, ip, sub1.ancestor(i1-1), subp.ancestor(ip-1), factor) << std::endl;
+    const auto rmax1 = sub1.rmax(i1-1);
+    const auto rmaxp = subp.rmax(ip-1);
+    if (rmax1 == 0 || rmaxp == 0) continue; // this is also the case for the subspaces which are not allowed
+    const auto block = index.find(sub1.ancestor_id(i1-1), subp.ancestor_id(ip-1));
+    if (!block) continue;
     my_assert(isfinite(factor));
-    transform<S>(cn, factor, diagI1.U(i1), cold.at(ININ), diagIp.U(ip));
+    const auto &O = *block->mat;
+    my_assert(size1(O) == rmax1 && size2(O) % rmaxp == 0);
+    my_assert(width == 0 || width == size2(O) / rmaxp);
+    width = size2(O) / rmaxp;
+    // The blocks of eigenvectors have orthonormal rows, thus ||f A O B^\dag|| <= |f| ||O||.
+    if (std::abs(factor) * block->norm <= P.recalcskip) {
+      planner.skip(double(width) * (double(dim1)*rmax1*rmaxp + double(dim1)*rmaxp*dimp));
+      continue;
+    }
+    terms.push_back({size_t(k), i1, ip, rmax1, rmaxp});
+    blocks[k] = &O;
+    hermitian_terms = hermitian_terms && i1 == ip && std::imag(factor) == 0.0 && block->hermitian;
   } // over table
+  auto cn = zero_matrix<S>(dim1, std::max<size_t>(width, 1) * dimp);
+  // Diagonal blocks of Hermitian operators, <I||O||I> in recalc_singlet(): the result is Hermitian, so only the lower
+  // triangle is computed and then mirrored.
+  const bool hermitian = P.recalchermitian && I1 == Ip && !terms.empty() && hermitian_terms;
+  if (hermitian) {
+    for (const auto &t : terms) {
+      const auto &r = std::data(table)[t.k];
+      const auto &O = *blocks[t.k];
+      for (size_t j = 0; j < width; j++)
+        transform_lower<S>(cn.middleCols(j*dimp, dimp), std::real(r.factor), diagI1.U(t.i1), O.middleCols(j*t.rp, t.rp));
+    }
+    for (size_t j = 0; j < width; j++) hermitian_mirror(cn.middleCols(j*dimp, dimp));
+  } else if (P.recalcplan) {
+    if (!terms.empty()) {
+      const auto plan = planner.plan(I1, Ip, Iop, dim1, dimp, std::move(terms), width);
+      recalc_execute<S>(cn, *plan, width, std::data(table), diagI1, diagIp, blocks.data());
+    }
+  } else {
+    for (const auto &t : terms) {
+      const auto &r = std::data(table)[t.k];
+      const auto &O = *blocks[t.k];
+      if (width == 1)
+        transform<S>(cn, r.factor, diagI1.U(t.i1), O, diagIp.U(t.ip));
+      else
+        for (size_t j = 0; j < width; j++) {
+          auto T = scratch_matrix<S>(dim1, t.rp);
+          gemm<GemmOp::N, GemmOp::N>(T, S(r.factor), diagI1.U(t.i1), O.middleCols(j*t.rp, t.rp), S(0));
+          gemm<GemmOp::N, GemmOp::H>(cn.middleCols(j*dimp, dimp), S(1), T, diagIp.U(t.ip), S(1));
+        }
+    }
+  }
   if (P.logletter('R')) dump_matrix(cn);
   return cn;
 }
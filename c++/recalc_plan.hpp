@@ -0,0 +1,142 @@
+// recalc_plan.hpp - execution plans for the recalculation of irreducible matrix elements
+// Copyright (C) 2009-2024 Rok Zitko
+
+#ifndef _recalc_plan_hpp_
+#define _recalc_plan_hpp_
+
+#include <vector>
+#include <map>
+#include <tuple>
+#include <memory>
+#include <mutex>
+#include <algorithm>
+#include <iostream>
+
+#include "invar.hpp"
+
+#include <fmt/format.h>
+
+namespace NRG {
+
+// recalc_general() computes the sum over the recalculation table of f_k A_k O_k B_k^\dag, where A_k = U(I1, i1_k) is
+// a dim1 x r1_k block, O_k = <IN1_k||O||INp_k> is r1_k x rp_k, and B_k = U(Ip, ip_k) is dimp x rp_k. Each term may be
+// evaluated either as (A O) B^\dag or as A (O B^\dag). Furthermore, the terms sharing the same ket block B (or the
+// same bra block A) may first be summed up in a scratch matrix, which is then multiplied by B^\dag (or A) only once.
+// The plan is the cheapest of these alternatives. Costs are counted in scalar multiply-add operations.
+enum class RecalcOrder { left, right };      // (A O) B^\dag or A (O B^\dag)
+enum class RecalcGrouping { none, ip, i1 };  // no grouping, group terms with equal ip (left order), or equal i1 (right order)
+
+struct RecalcPlan {
+  struct Term {
+    size_t k;      // index in the recalculation table
+    size_t i1, ip; // block indexes (1-based)
+    size_t r1, rp; // block dimensions
+    RecalcOrder order = RecalcOrder::left;
+    bool operator==(const Term &t) const { return k == t.k && i1 == t.i1 && ip == t.ip && r1 == t.r1 && rp == t.rp; }
+  };
+  size_t dim1 = 0, dimp = 0;
+  std::vector<Term> terms; // in execution order
+  RecalcGrouping grouping = RecalcGrouping::none;
+  double naive = 0; // cost of the term-by-term evaluation, A O B^\dag evaluated from left to right
+  double cost = 0;  // cost of the planned evaluation
+  // Key of the group that term t belongs to
+  [[nodiscard]] size_t group(const Term &t) const { return grouping == RecalcGrouping::ip ? t.ip : t.i1; }
+  // Same input as the one this plan was constructed from?
+  [[nodiscard]] bool matches(const size_t dim1_, const size_t dimp_, const std::vector<Term> &input) const {
+    return dim1 == dim1_ && dimp == dimp_ && std::is_permutation(terms.begin(), terms.end(), input.begin(), input.end());
+  }
+};
+
+// The input terms are those entries in the recalculation table which actually contribute, i.e., the ancestor
+// subspaces are allowed and non-empty, and the operator matrix block exists.
+inline RecalcPlan make_recalc_plan(const size_t dim1, const size_t dimp, std::vector<RecalcPlan::Term> terms) {
+  RecalcPlan plan;
+  plan.dim1 = dim1;
+  plan.dimp = dimp;
+  const double d1 = dim1, dp = dimp;
+  double best = 0, cost_ip = 0, cost_i1 = 0;
+  std::map<size_t, size_t> ips, i1s; // distinct blocks and their dimensions
+  for (auto &t : terms) {
+    const double r1 = t.r1, rp = t.rp;
+    const auto left = d1*r1*rp + d1*rp*dp;
+    const auto right = r1*rp*dp + d1*r1*dp;
+    plan.naive += left;
+    best += std::min(left, right);
+    t.order = left <= right ? RecalcOrder::left : RecalcOrder::right;
+    cost_ip += d1*r1*rp;
+    cost_i1 += r1*rp*dp;
+    ips[t.ip] = t.rp;
+    i1s[t.i1] = t.r1;
+  }
+  for (const auto &[ip, rp] : ips) cost_ip += d1*double(rp)*dp;
+  for (const auto &[i1, r1] : i1s) cost_i1 += d1*double(r1)*dp;
+  plan.cost = best;
+  if (cost_ip < plan.cost) {
+    plan.grouping = RecalcGrouping::ip;
+    plan.cost = cost_ip;
+  }
+  if (cost_i1 < plan.cost) {
+    plan.grouping = RecalcGrouping::i1;
+    plan.cost = cost_i1;
+  }
+  if (plan.grouping != RecalcGrouping::none) {
+    const auto order = plan.grouping == RecalcGrouping::ip ? RecalcOrder::left : RecalcOrder::right;
+    for (auto &t : terms) t.order = order;
+    std::stable_sort(terms.begin(), terms.end(), [&plan](const auto &a, const auto &b) { return plan.group(a) < plan.group(b); });
+  }
+  plan.terms = std::move(terms);
+  return plan;
+}
+
+// Cache of execution plans. The plans are valid for one NRG step, since the block dimensions change from step to
+// step; the cache is therefore cleared before the operators are recalculated. Within a step, the same plan is
+// reused for all operators of the same type. Thread-safe.
+class RecalcPlanner {
+ private:
+   using Key = std::tuple<Invar, Invar, Invar>; // I1, Ip, Iop
+   std::map<Key, std::shared_ptr<const RecalcPlan>> cache;
+   size_t built = 0, reused = 0;
+   double naive = 0, planned = 0; // accumulated costs
+   size_t skipped = 0;            // number of negligible terms which were skipped
+   double skipped_cost = 0;
+   mutable std::mutex mtx;
+ public:
+   std::shared_ptr<const RecalcPlan> plan(const Invar &I1, const Invar &Ip, const Invar &Iop, const size_t dim1, const size_t dimp,
+                                          std::vector<RecalcPlan::Term> input, const size_t width = 1) {
+     const Key key{I1, Ip, Iop};
+     std::lock_guard lock(mtx);
+     auto &p = cache[key];
+     if (p && p->matches(dim1, dimp, input)) {
+       reused++;
+     } else {
+       p = std::make_shared<const RecalcPlan>(make_recalc_plan(dim1, dimp, std::move(input)));
+       built++;
+     }
+     naive += double(width) * p->naive; // the costs are proportional to the number of operators in a batch
+     planned += double(width) * p->cost;
+     return p;
+   }
+   void skip(const double cost) { // cost of the direct evaluation of the skipped term
+     std::lock_guard lock(mtx);
+     skipped++;
+     skipped_cost += cost;
+   }
+   void clear() {
+     std::lock_guard lock(mtx);
+     cache.clear();
+     built = reused = skipped = 0;
+     naive = planned = skipped_cost = 0;
+   }
+   void report(std::ostream &F = std::cout) const {
+     std::lock_guard lock(mtx);
+     if (built)
+       F << fmt::format("Recalc plans: built={} reused={} naive={:.4g} planned={:.4g} Gflop (saved {:.1f}%)",
+                        built, reused, 2e-9*naive, 2e-9*planned, naive > 0 ? 100.0*(naive-planned)/naive : 0.0) << std::endl;
+     if (skipped)
+       F << fmt::format("Recalc skipped: {} terms ({} GEMMs, {:.4g} Gflop)", skipped, 2*skipped, 2e-9*skipped_cost) << std::endl;
+   }
+};
+
+} // namespace
+
+#endif
@@ -42,6 +42,10 @@ class Stats {
    std::vector<double> abs_Egs;        // Values of 'Egs' (multiplied by the scale, i.e. in absolute scale) for all NRG steps.
    std::vector<double> energy_offsets; // Values of "total_energy" for all NRG steps.
 
+   // ** Restarts of the diagonalisation (do_diag)
+   std::vector<size_t> restarts;       // Number of restarts for all NRG steps.
+   std::vector<double> restart_saved;  // Fraction of the restart diagonalisation work (sum of dim^3) avoided by incremental restarts.
+
    // ** Containers related to the FDM-NRG approach
    // Consult A. Weichselbaum, J. von Delft, PRL 99, 076402 (2007).
    vmpf ZnDG;                    // Z_n^D=\sum_s^D exp(-beta E^n_s), sum over **discarded** states at shell n
@@ -60,6 +64,7 @@ class Stats {
   explicit Stats(const Params &_P, const std::vector<std::string> &td_fields, const double GS_energy_0,
                  const std::string &filename_td = "td"s, const std::string &filename_tdfdm = "tdfdm"s) :
      P(_P), td(P, filename_td), total_energy(GS_energy_0), rel_Egs(MAX_NDX), abs_Egs(MAX_NDX), energy_offsets(MAX_NDX),
+     restarts(MAX_NDX), restart_saved(MAX_NDX),
      ZnDG(MAX_NDX), ZnDN(MAX_NDX), ZnDNd(MAX_NDX), wn(MAX_NDX), wnfactor(MAX_NDX), td_fdm(P, filename_tdfdm) {
        td.allfields.add(td_fields, 1);
      }
@@ -84,6 +89,8 @@ class Stats {
        h5_dump_scalar(fd, prefix + "/rel_Egs", rel_Egs[ndx]);
        h5_dump_scalar(fd, prefix + "/abs_Egs", rel_Egs[ndx]);
        h5_dump_scalar(fd, prefix + "/energy_offset", energy_offsets[ndx]);
+       h5_dump_scalar(fd, prefix + "/restarts", restarts[ndx]);
+       h5_dump_scalar(fd, prefix + "/restart_saved", restart_saved[ndx]);
      }
      for (const auto &[name, value]: expv)
        h5_dump_scalar(fd, "expv/" + name, value);
@@ -6,6 +6,7 @@
 #include <iostream>
 #include <fstream>
 #include <string>
+#include <utility>
 
 #include <boost/range/irange.hpp>
 #include <boost/range/adaptor/map.hpp>
@@ -14,21 +15,32 @@
 #include "eigen.hpp"
 #include "subspaces.hpp"
 #include "h5.hpp"
+#include "async_io.hpp"
 
 namespace NRG {
 
 // Container for all information which needs to be gathered in each invariant subspace.
-// Required for the density-matrix construction.
+// Required for the density-matrix construction. Only the eigenvalues and the dimensions are retained, not the
+// eigenvectors: those are large and they are only needed in the backward sweep over the NRG shells, where they are
+// loaded from the unitaryN files one shell at a time, see EigenvectorProvider.
 template<scalar S>
 struct Sub {
-  Eigen<S> eig;
+  Values<S> values;
+  size_t nrkept = 0;           // number of kept states
+  size_t dim = 0;              // subspace dimension (number of all states)
   SubspaceDimensions rmax;
   bool is_last = false;
-  [[nodiscard]] auto kept() const { return eig.getnrkept(); }
-  [[nodiscard]] auto total() const { return eig.getdim(); }
+  Sub() = default;
+  Sub(const Eigen<S> &eig, SubspaceDimensions rmax, const bool is_last) :
+    values(eig.values), nrkept(eig.getnrkept()), dim(eig.getdim()), rmax(std::move(rmax)), is_last(is_last) {}
+  [[nodiscard]] auto kept() const { return nrkept; }
+  [[nodiscard]] auto total() const { return dim; }
   [[nodiscard]] auto min() const { return is_last ? 0 : kept(); } // min(), max() return the range of D states to be summed over in FDM
   [[nodiscard]] auto max() const { return total(); }
   [[nodiscard]] auto all() const { return boost::irange(min(), max()); }
+  [[nodiscard]] size_t bytes() const { // approximate heap memory usage
+    return sizeof(*this) + (values.all_rel().size() + values.all_corr().size()) * sizeof(eigen_traits<S>);
+  }
   void h5save(H5Easy::File &fd, const std::string &name) const {
     h5_dump_scalar(fd, name + "/kept", kept());
     h5_dump_scalar(fd, name + "/total", total());
@@ -43,7 +55,10 @@ class Subs : public std::map<Invar, Sub<S>> {
    Subs() = default;
    Subs(const DiagInfo<S> &diag, const SubspaceStructure &substruct, const bool last) {
      for (const auto &[I, eig]: diag)
-       (*this)[I] = { eig, substruct.at_or_null(I), last };
+       this->try_emplace(I, eig, substruct.at_or_null(I), last);
+   }
+   [[nodiscard]] size_t bytes() const {
+     return ranges::accumulate(*this, size_t{0}, {}, [](const auto &x) { return x.second.bytes(); });
    }
    void h5save(H5Easy::File &fd, const std::string &name) const {
      const std::vector<int> dummy = {1};
@@ -54,6 +69,25 @@ class Subs : public std::map<Invar, Sub<S>> {
    }
 };
 
+// On-demand access to the eigenvectors of shell N. They are saved to the unitaryN files after the diagonalization
+// in the first NRG run (see after_diag() and DiagInfo::save()) and mapped into memory when required in the backward
+// sweeps of the DM-NRG and FDM algorithms, see UnitaryFile. With asyncio=true, the next shell can be prefetched in
+// the background while the current one is being processed.
+template<scalar S>
+class EigenvectorProvider {
+ private:
+   AsyncStepIO<UnitaryFile<S>> io;
+ public:
+   explicit EigenvectorProvider(const Params &P) : io([&P](const size_t N) {
+     UnitaryFile<S> file(P.workdir->read(P.workdir->unitaryfn(N)));
+     if (P.asyncio) file.prefetch(); // otherwise the pages are read when accessed
+     return file;
+   }, P.asyncio) {}
+   [[nodiscard]] UnitaryFile<S> operator()(const size_t N) { return io.get(N); }
+   void prefetch(const size_t N) { io.prefetch(N); }
+   [[nodiscard]] const auto & statistics() const noexcept { return io.statistics(); }
+};
+
 template<scalar S>
 class Store : public std::vector<Subs<S>> {
  public:
@@ -64,7 +98,7 @@ class Store : public std::vector<Subs<S>> {
      for (const auto N : Nall()) {
        F << std::endl << "===== Iteration number: " << N+1 << std::endl; // mind the shift by 1
        for (const auto &[I, ds]: this->at(N))
-         F << "Subspace: " << I << std::endl << (ds.eig.values.all_abs_G() | ranges::to_vector) << std::endl;
+         F << "Subspace: " << I << std::endl << (ds.values.all_abs_G() | ranges::to_vector) << std::endl;
      }
    }
    void dump_all_absolute_energies(const std::string &filename = "absolute_energies.dat"s) {
@@ -85,7 +119,10 @@ class Store : public std::vector<Subs<S>> {
    void shift_abs_energies(const double GS_energy) {
      for (const auto N : Nall())
        for (auto &ds : this->at(N) | boost::adaptors::map_values)
-         ds.eig.subtract_GS_energy(GS_energy);
+         ds.values.set_abs_GS_energy(GS_energy);
+   }
+   [[nodiscard]] size_t bytes() const {
+     return ranges::accumulate(*this, size_t{0}, {}, [](const auto &subs) { return subs.bytes(); });
    }
    void h5save(H5Easy::File &fd, const std::string &name) const {
      const std::vector range = {Nbegin, Nend};
@@ -3,6 +3,10 @@
 
 #include <memory>
 #include <vector>
+#include <algorithm>
+#include <iterator>
+#include <cmath>
+#include <limits>
 
 #include <range/v3/all.hpp>
 
@@ -19,6 +23,8 @@ class SubspaceDimensions {
  private:
    std::vector<size_t> dims;
    std::vector<Invar> ancestors;
+   std::vector<size_t> ids; // positions of the ancestors among the subspaces at the previous step
+   friend class SubspaceStructure;
  public:
    SubspaceDimensions() = default;
    template<scalar S>
@@ -60,7 +66,14 @@ class SubspaceDimensions {
      my_assert(i1 != j1);
      return exists(i1-1) && exists(j1-1); // shift by 1
    }
-   [[nodiscard]] Invar ancestor(const size_t i) const { return ancestors[i]; }
+   [[nodiscard]] const Invar &ancestor(const size_t i) const {
+     my_assert(i < ancestors.size()); // not available in deserialized objects, see serialize()
+     return ancestors[i];
+   }
+   [[nodiscard]] size_t ancestor_id(const size_t i) const { // see SubspaceStructure::id()
+     my_assert(i < ids.size());
+     return ids[i];
+   }
    void dump(std::ostream &F = std::cout) const {
      my_assert(dims.size() == ancestors.size());
      for (int i = 0; i < dims.size(); i++)
@@ -103,6 +116,16 @@ class SubspaceStructure : public std::map<Invar, SubspaceDimensions> {
      for (const auto &[I, rm]: *this)
        rm.h5save(fd, name + "/" + I.name());
    }
+   // The subspaces at the previous step are numbered consecutively, so that the blocks of the operators can be
+   // indexed without comparing the quantum numbers, see BlockIndex.
+   static constexpr size_t npos = std::numeric_limits<size_t>::max();
+   [[nodiscard]] auto nr_prev() const { return prev.size(); }
+   [[nodiscard]] size_t id(const Invar &I) const {
+     const auto it = std::lower_bound(prev.begin(), prev.end(), I);
+     return it != prev.end() && *it == I ? size_t(it - prev.begin()) : npos;
+   }
+ private:
+   std::vector<Invar> prev; // subspaces at the previous step, sorted
 };
 
 // List of invariant subspaces in which diagonalisations need to be performed
@@ -126,6 +149,25 @@ class TaskList {
      tasks = tasks_with_sizes | ranges::views::transform( [](const auto &p) { return p.second; } ) | ranges::to<std::vector>();
    }
    [[nodiscard]] std::vector<Invar> get() const { return tasks; }
+   // Subset of tasks, in the same order as in the full list
+   [[nodiscard]] std::vector<Invar> get(const std::vector<Invar> &subset) const {
+     std::vector<Invar> list;
+     ranges::copy_if(tasks, std::back_inserter(list), [&subset](const auto &I) { return std::find(subset.begin(), subset.end(), I) != subset.end(); });
+     return list;
+   }
+   // Cost model for the diagonalisation of a subspace of dimension dim, shared by all diagonalisation engines
+   [[nodiscard]] static double cost(const size_t dim) { return std::pow(double(dim), 3); }
+   // Estimated costs of the given tasks at the new iteration
+   template<scalar S>
+     [[nodiscard]] static std::vector<double> costs(const std::vector<Invar> &tasks, const DiagInfo<S> &diagprev, const Symmetry<S> *Sym);
+   // Estimated cost of diagonalisations for all tasks or for a subset
+   [[nodiscard]] double cost() const {
+     return ranges::accumulate(tasks_with_sizes, 0.0, {}, [](const auto &p) { return cost(p.first); });
+   }
+   [[nodiscard]] double cost(const std::vector<Invar> &subset) const {
+     return ranges::accumulate(tasks_with_sizes, 0.0, {}, [&subset](const auto &p) {
+       return std::find(subset.begin(), subset.end(), p.second) != subset.end() ? cost(p.first) : 0.0; });
+   }
 };
 
 } // namespace
@@ -10,6 +10,11 @@
 #include <iomanip>
 #include <limits>
 #include <optional>
+#include <array>
+#include <memory>
+#include <map>
+#include <algorithm>
+#include <tuple>
 
 #include "operators.hpp"
 #include "params.hpp"
@@ -21,6 +26,7 @@
 #include "subspaces.hpp"
 #include "stats.hpp"
 #include "coef.hpp"
+#include "recalc_plan.hpp"
 
 namespace NRG {
 
@@ -46,15 +52,70 @@ struct Recalc_f {
 
 // Structure which holds subspace information and factor for each of nonzero irreducible matrix elements. cf.
 // Hofstetter PhD p. 120. <Q+1 S+-1/2 .. i1 ||f^\dag|| Q S .. ip>_N = factor < IN1 .. ||f^\dag|| INp ..>_{N_1}
+// The subspaces IN1 and INp in the N-1 stage are the ancestors of I1 and Ip, they are taken from SubspaceStructure.
 template<scalar S>
 struct Recalc {
   size_t i1{}; // combination of states
   size_t ip{};
-  Invar IN1; // subspace in N-1 stage
-  Invar INp;
   coef_traits<S> factor{}; // additional multiplicative factor
 };
 
+// Combination indexes of a recalculation table. The tables in the coefficient files are converted into constexpr
+// arrays of RecalcIndex and functors for the factors, see recalc-table.awk.
+struct RecalcIndex {
+  size_t i1, ip;
+};
+
+template<scalar S, size_t N, typename F>
+auto make_recalc_table(const RecalcIndex (&index)[N], F factor) {
+  std::array<Recalc<S>, N> table;
+  for (size_t k = 0; k < N; k++) table[k] = {index[k].i1, index[k].ip, factor(k)};
+  return table;
+}
+
+// Blocks of an operator at the previous step, indexed by the positions of the subspaces (see SubspaceStructure::id())
+// rather than by their quantum numbers, together with the block metadata. It is built once per operator at the start
+// of recalc_doublet(), recalc_singlet(), etc., so that recalc_compute() needs no map lookups for the table entries.
+// The operator must outlive the index.
+template<scalar S>
+class BlockIndex {
+ public:
+   struct Block {
+     size_t idp;
+     const Matrix_traits<S> *mat;
+     double norm;
+     bool hermitian;
+   };
+   BlockIndex(const MatrixElements<S> &m, const SubspaceStructure &substruct) : rows(substruct.nr_prev()) {
+     for (const auto &[II, mat] : m) {
+       const auto id1 = substruct.id(II.first);
+       const auto idp = substruct.id(II.second);
+       if (id1 == SubspaceStructure::npos || idp == SubspaceStructure::npos) continue; // not an ancestor
+       rows[id1].push_back({idp, &mat, m.norm(II), m.is_hermitian(II)});
+     }
+   }
+   [[nodiscard]] const Block *find(const size_t id1, const size_t idp) const {
+     if (id1 >= rows.size()) return nullptr;
+     for (const auto &b : rows[id1]) // few blocks per row
+       if (b.idp == idp) return &b;
+     return nullptr;
+   }
+ private:
+   std::vector<std::vector<Block>> rows; // blocks <id1||O||idp> for each id1
+};
+
+template<scalar S>
+using BlockIndexPtr = std::shared_ptr<const BlockIndex<S>>;
+
+// Deferred call of recalc_general(), see Oprecalc::recalculate_operators()
+template<scalar S>
+struct RecalcJob {
+  Invar I1, Ip, Iop;
+  std::vector<Recalc<S>> table;
+  BlockIndexPtr<S> blocks;
+  double cost; // estimated, for scheduling
+};
+
 template<scalar S>
 class Symmetry {
  protected:
@@ -69,6 +130,8 @@ class Symmetry {
    std::vector<Invar> In, QN;
    const Invar InvarSinglet; // QNs for singlet operator
    const Invar Invar_f;      // QNs for f operator
+   mutable RecalcPlanner planner; // execution plans for recalc_general()
+   mutable std::vector<RecalcJob<S>> *deferred = nullptr; // if set, recalc_general() only records the jobs
  public:
    virtual void load() = 0; // load In, QN
    void erase_first() { // drop the first element in In, QN to convert to 0-based vectors; call after load()
@@ -86,11 +149,10 @@ class Symmetry {
    auto input_subspaces() const { return In; }
    auto QN_subspace(const size_t i) const { my_assert(i < P.combs); return QN[i]; }
    auto ancestor(const Invar &I, const size_t i) const {
-     my_assert(i < P.combs);
-     const auto input = input_subspaces();
+     my_assert(i < P.combs && i < In.size());
      Invar anc = I;
-     anc.combine(input[i]);
-     return anc; // I.combine(input[i]) == input[i].combine(I)
+     anc.combine(In[i]);
+     return anc; // I.combine(In[i]) == In[i].combine(I)
    }
    [[nodiscard]] size_t nr_combs() const {
      my_assert(P.combs == In.size());
@@ -113,6 +175,10 @@ class Symmetry {
      return input;
    }
    auto get_td_fields() const { return td_fields; }
+   RecalcPlanner &recalc_planner() const { return planner; }
+   // While jobs != nullptr, recalc_general() returns empty placeholder matrices and appends the calculations to
+   // jobs; these are then performed by recalc_job(). Not reentrant.
+   void defer_recalc(std::vector<RecalcJob<S>> *jobs) const { deferred = jobs; }
    // For some symmetry types with two-channels we distinguish between even and odd parity with respect to the
    // channel-interchange operation.
    virtual bool islr() const { return false; }
@@ -149,6 +215,44 @@ class Symmetry {
      return proj;
    }
 
+   // Blocks of op1 and op2 which contribute to a spectral function for given spin, in the order of a double loop over
+   // the subspaces (Ii outer, Ij inner). Implemented in each symmetry class by DECL, see spectrum_blocks_impl().
+   virtual std::vector<SpectrumBlock<S>> spectrum_blocks(const DiagInfo<S> &diag, const MatrixElements<S> &op1, const MatrixElements<S> &op2,
+                                                         const SpecFactor kind, const int spin) const = 0;
+   // Static dispatch: Sym is the concrete symmetry class (all of them are final), so that the calls of its methods in
+   // the loops are resolved at compile time. The same is done in recalc_general().
+   template<typename Sym>
+     std::vector<SpectrumBlock<S>> spectrum_blocks_impl(const Sym &sym, const DiagInfo<S> &diag, const MatrixElements<S> &op1,
+                                                        const MatrixElements<S> &op2, const SpecFactor kind, const int spin) const {
+       std::map<Invar, const Eigen<S> *> kept; // the projection is determined once per subspace
+       for (const auto &[I, eig]: diag)
+         if (sym.project_subspace(I, P.project)) kept.emplace(I, &eig);
+       std::vector<SpectrumBlock<S>> blocks;
+       for (const auto &[II, m1]: op1) {
+         const auto &[Ij, Ii] = II;
+         const auto i = kept.find(Ii);
+         const auto j = kept.find(Ij);
+         if (i == kept.end() || j == kept.end()) continue;
+         const auto m2 = op2.find(II);
+         if (m2 == op2.end()) continue;
+         if (kind == SpecFactor::specdens && !sym.check_SPIN(Ij, Ii, spin)) continue;
+         blocks.push_back({&Ii, &Ij, &m1, &m2->second, i->second, j->second, spectrum_factor(sym, kind, Ii, Ij)});
+       }
+       std::sort(blocks.begin(), blocks.end(), [](const auto &a, const auto &b) { return std::tie(*a.Ii, *a.Ij) < std::tie(*b.Ii, *b.Ij); });
+       return blocks;
+     }
+   template<typename Sym>
+     static double spectrum_factor(const Sym &sym, const SpecFactor kind, const Invar &Ip, const Invar &I1) {
+       switch (kind) {
+         case SpecFactor::correlator:   return sym.mult(I1);
+         case SpecFactor::specdens:     return sym.specdens_factor(Ip, I1);
+         case SpecFactor::specdensquad: return sym.specdensquad_factor(Ip, I1);
+         case SpecFactor::spinsusc:     return sym.dynamicsusceptibility_factor(Ip, I1);
+         case SpecFactor::orbsusc:      return sym.dynamic_orb_susceptibility_factor(Ip, I1);
+       }
+       my_assert_not_reached();
+     }
+
    using Matrix  = Matrix_traits<S>;
    using t_matel = matel_traits<S>;
    using t_coef  = coef_traits<S>;
@@ -200,19 +304,18 @@ class Symmetry {
    //  parity -1). Generic implementation, valid for all symmetry types.
    MatrixElements<S> recalc_singlet(const DiagInfo<S> &diag, const SubspaceStructure &substruct, const MatrixElements<S> &nold, const int parity) const {
      MatrixElements<S> nnew;
+     const auto blocks = std::make_shared<const BlockIndex<S>>(nold, substruct);
      my_assert(islr() ? parity == 1 || parity == -1 : parity == 1);
      for (const auto &I : diag.subspaces()) {
        const Invar I1 = I;
        const Invar Ip = parity == -1 ? I.InvertParity() : I;
        std::vector<Recalc<S>> recalc_table;
-       for (const auto i: combs()) {
-         const auto anc = ancestor(I, i);
-         recalc_table.push_back({i+1, i+1, anc, parity == -1 ? anc.InvertParity() : anc, 1.0});
-       }
+       for (const auto i: combs()) recalc_table.push_back({i+1, i+1, 1.0});
        const auto Iop = parity == -1 ? InvarSinglet.InvertParity() : InvarSinglet;
-       auto nn = recalc_general(diag, substruct, nold, I1, Ip, recalc_table, Iop);
+       auto nn = recalc_general(*this, diag, substruct, blocks, I1, Ip, recalc_table, Iop);
        if (nn) nnew[Twoinvar(I1,Ip)] = *nn;
      }
+     nnew.set_hermitian(nold.hermitian());
      return nnew;
    }
 
@@ -242,23 +345,31 @@ class Symmetry {
      auto recalc_f(const DiagInfo<S> &diag, const Invar &I1, const Invar &Ip, const T &table) const;
 
    template<typename T>
-     std::optional<Matrix_traits<S>> recalc_general(const DiagInfo<S> &diag, const SubspaceStructure &substruct, const MatrixElements<S> &cold,
+     Matrix_traits<S> recalc_compute(const DiagInfo<S> &diag, const SubspaceStructure &substruct, const BlockIndex<S> &blocks,
+                                     const Invar &I1, const Invar &Ip, const T &table, const Invar &Iop) const;
+
+   Matrix_traits<S> recalc_job(const DiagInfo<S> &diag, const SubspaceStructure &substruct, const RecalcJob<S> &job) const {
+     return recalc_compute(diag, substruct, *job.blocks, job.I1, job.Ip, job.table, job.Iop);
+   }
+
+   template<typename Sym, typename T>
+     std::optional<Matrix_traits<S>> recalc_general(const Sym &sym, const DiagInfo<S> &diag, const SubspaceStructure &substruct, const BlockIndexPtr<S> &blocks,
                          const Invar &I1, const Invar &Ip, const T &table, const Invar &Iop) const;
 
    void recalc1_global(const DiagInfo<S> &diag, const Invar &I,
                        Matrix &m, const size_t i1, const size_t ip, const t_coef value) const;
 
-   auto CorrelatorFactorFnc() const   { return [this]([[maybe_unused]] const Invar &Ip, const Invar &I1) { return this->mult(I1); }; }
    auto SpecdensFactorFnc() const     { return [this](const Invar &Ip, const Invar &I1) { return this->specdens_factor(Ip, I1); }; }
    auto SpecdensquadFactorFnc() const { return [this](const Invar &Ip, const Invar &I1) { return this->specdensquad_factor(Ip, I1); }; }
-   auto SpinSuscFactorFnc() const     { return [this](const Invar &Ip, const Invar &I1) { return this->dynamicsusceptibility_factor(Ip, I1); }; }
-   auto OrbSuscFactorFnc() const      { return [this](const Invar &Ip, const Invar &I1) { return this->dynamic_orb_susceptibility_factor(Ip, I1); }; }
-   auto TrivialCheckSpinFnc() const   { return []([[maybe_unused]] const Invar &Ip, [[maybe_unused]] const Invar &I1, [[maybe_unused]] int SPIN) { return true; }; }
-   auto SpecdensCheckSpinFnc() const  { return [this](const Invar &I1, const Invar &Ip, int SPIN) { return this->check_SPIN(I1, Ip, SPIN); }; }
 };
 
 // Add DECL declaration in each symmetry class
 #define DECL                                                                                                      \
+  std::vector<SpectrumBlock<SC>> spectrum_blocks(const DiagInfo<SC> &diag, const MatrixElements<SC> &op1,        \
+                                                 const MatrixElements<SC> &op2, const SpecFactor kind,           \
+                                                 const int spin) const override {                                \
+    return this->spectrum_blocks_impl(*this, diag, op1, op2, kind, spin);                                         \
+  }                                                                                                               \
   void make_matrix(Matrix &h, const Step &step, const SubspaceDimensions &qq, const Invar &I, const InvarVec &In, \
              const Opch<SC> &opch, const Coef<SC> &coef) const override;                                          \
   Opch<SC> recalc_irreduc(const Step &step, const DiagInfo<SC> &diag) const override
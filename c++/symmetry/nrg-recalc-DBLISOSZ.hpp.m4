@@ -11,6 +11,7 @@ include(recalc-macros.m4)
 template<typename SC>
 MatrixElements<SC> SymmetryDBLISOSZ<SC>::recalc_doublet(const DiagInfo<SC> &diag, const SubspaceStructure &substruct, const MatrixElements<SC> &cold) const {
   MatrixElements<SC> cnew;
+  const auto blocks = std::make_shared<const BlockIndex<SC>>(cold, substruct);
   for(const auto &[I1, eig]: diag) {
     int ii11 = I1.get("II1");
     int ii21 = I1.get("II2");
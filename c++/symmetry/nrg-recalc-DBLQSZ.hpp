@@ -31,6 +31,7 @@ namespace NRG {
 template<typename SC>
 MatrixElements<SC> SymmetryDBLQSZ<SC>::recalc_doublet(const DiagInfo<SC> &diag, const SubspaceStructure &substruct, const MatrixElements<SC> &cold) const {
   MatrixElements<SC> cnew;
+  const auto blocks = std::make_shared<const BlockIndex<SC>>(cold, substruct);
   for(const auto &[I1, eig]: diag) {
     int q11 = I1.get("Q1");
     int q21 = I1.get("Q2");
@@ -43,10 +44,46 @@ MatrixElements<SC> SymmetryDBLQSZ<SC>::recalc_doublet(const DiagInfo<SC> &diag,
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "dblqsz/dblqsz-2ch-doubletm0p.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {4, 4},
+        {5, 5},
+        {6, 6},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {10, 10},
+        {11, 11},
+        {12, 12},
+        {13, 13},
+        {14, 14},
+        {15, 15},
+        {16, 16}
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(1, 0, -1));
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return -1;
+          case 2: return -1;
+          case 3: return 1;
+          case 4: return -1;
+          case 5: return -1;
+          case 6: return 1;
+          case 7: return 1;
+          case 8: return 1;
+          case 9: return 1;
+          case 10: return -1;
+          case 11: return -1;
+          case 12: return 1;
+          case 13: return -1;
+          case 14: return -1;
+          case 15: return 1;
+          default: my_assert_not_reached();
+        }
+      };
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(1, 0, -1));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -58,10 +95,46 @@ MatrixElements<SC> SymmetryDBLQSZ<SC>::recalc_doublet(const DiagInfo<SC> &diag,
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "dblqsz/dblqsz-2ch-doubletm0m.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {4, 4},
+        {5, 5},
+        {6, 6},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {10, 10},
+        {11, 11},
+        {12, 12},
+        {13, 13},
+        {14, 14},
+        {15, 15},
+        {16, 16}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return -1;
+          case 2: return -1;
+          case 3: return 1;
+          case 4: return -1;
+          case 5: return -1;
+          case 6: return 1;
+          case 7: return 1;
+          case 8: return 1;
+          case 9: return 1;
+          case 10: return -1;
+          case 11: return -1;
+          case 12: return 1;
+          case 13: return -1;
+          case 14: return -1;
+          case 15: return 1;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(1, 0, +1));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(1, 0, +1));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -73,10 +146,46 @@ MatrixElements<SC> SymmetryDBLQSZ<SC>::recalc_doublet(const DiagInfo<SC> &diag,
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "dblqsz/dblqsz-2ch-doublet0mp.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {4, 4},
+        {5, 5},
+        {6, 6},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {10, 10},
+        {11, 11},
+        {12, 12},
+        {13, 13},
+        {14, 14},
+        {15, 15},
+        {16, 16}
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(0, 1, -1));
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return -1;
+          case 2: return -1;
+          case 3: return 1;
+          case 4: return -1;
+          case 5: return -1;
+          case 6: return 1;
+          case 7: return 1;
+          case 8: return 1;
+          case 9: return 1;
+          case 10: return -1;
+          case 11: return -1;
+          case 12: return 1;
+          case 13: return -1;
+          case 14: return -1;
+          case 15: return 1;
+          default: my_assert_not_reached();
+        }
+      };
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(0, 1, -1));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -88,10 +197,46 @@ MatrixElements<SC> SymmetryDBLQSZ<SC>::recalc_doublet(const DiagInfo<SC> &diag,
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "dblqsz/dblqsz-2ch-doublet0mm.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {4, 4},
+        {5, 5},
+        {6, 6},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {10, 10},
+        {11, 11},
+        {12, 12},
+        {13, 13},
+        {14, 14},
+        {15, 15},
+        {16, 16}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return -1;
+          case 2: return -1;
+          case 3: return 1;
+          case 4: return -1;
+          case 5: return -1;
+          case 6: return 1;
+          case 7: return 1;
+          case 8: return 1;
+          case 9: return 1;
+          case 10: return -1;
+          case 11: return -1;
+          case 12: return 1;
+          case 13: return -1;
+          case 14: return -1;
+          case 15: return 1;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(0, 1, +1));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(0, 1, +1));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -11,6 +11,7 @@ include(recalc-macros.m4)
 template<typename SC>
 MatrixElements<SC> SymmetryDBLQSZ<SC>::recalc_doublet(const DiagInfo<SC> &diag, const SubspaceStructure &substruct, const MatrixElements<SC> &cold) const {
   MatrixElements<SC> cnew;
+  const auto blocks = std::make_shared<const BlockIndex<SC>>(cold, substruct);
   for(const auto &[I1, eig]: diag) {
     int q11 = I1.get("Q1");
     int q21 = I1.get("Q2");
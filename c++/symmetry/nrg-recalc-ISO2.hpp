@@ -32,6 +32,7 @@ namespace NRG {
 template<typename SC>
 MatrixElements<SC> SymmetryISO2<SC>::recalc_doublet(const DiagInfo<SC> &diag, const SubspaceStructure &substruct, const MatrixElements<SC> &cold) const {
   MatrixElements<SC> cnew;
+  const auto blocks = std::make_shared<const BlockIndex<SC>>(cold, substruct);
   for(const auto &[I1, eig]: diag) {
     int ii1 = I1.get("II");
     int ss1 = I1.get("SS");
@@ -44,10 +45,26 @@ MatrixElements<SC> SymmetryISO2<SC>::recalc_doublet(const DiagInfo<SC> &diag, co
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "iso2/iso2-1ch-doubletmp.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {1, 2},
+        {2, 2},
+        {3, 3},
+        {4, 3},
+        {4, 4}
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(2, 2));
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1/(1 + 2*ISO(ii1));
+          case 2: return (2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1));
+          case 3: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 4: return 1/(1 + 2*S(ss1));
+          case 5: return -1;
+          default: my_assert_not_reached();
+        }
+      };
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(2, 2));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -57,10 +74,74 @@ MatrixElements<SC> SymmetryISO2<SC>::recalc_doublet(const DiagInfo<SC> &diag, co
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "iso2/iso2-2ch-doubletmp.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {1, 2},
+        {2, 2},
+        {2, 3},
+        {3, 3},
+        {4, 4},
+        {4, 5},
+        {5, 5},
+        {6, 4},
+        {6, 5},
+        {6, 6},
+        {6, 7},
+        {7, 5},
+        {7, 7},
+        {8, 8},
+        {8, 9},
+        {9, 9},
+        {10, 8},
+        {10, 9},
+        {10, 10},
+        {10, 11},
+        {11, 9},
+        {11, 11},
+        {12, 12},
+        {13, 12},
+        {13, 13},
+        {14, 13},
+        {14, 14},
+        {15, 15},
+        {16, 16}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1/sqrt(ISO(ii1)*(1 + 2*ISO(ii1)));
+          case 2: return (-1 + ISO(ii1) + 2*Power(ISO(ii1),2))/sqrt(ISO(ii1)*(1 + ISO(ii1))*(-1 + 2*ISO(ii1))*(1 + 2*ISO(ii1)));
+          case 3: return 1/sqrt((1 + ISO(ii1))*(1 + 2*ISO(ii1)));
+          case 4: return sqrt((ISO(ii1)*(1 + 2*ISO(ii1)))/(Power(1 + ISO(ii1),3)*(3 + 2*ISO(ii1)))) + sqrt(ISO(ii1)/(Power(1 + ISO(ii1),3)*(3 + 4*ISO(ii1)*(2 + ISO(ii1))))) + sqrt(1 + 1/(1 + ISO(ii1)) - 6/(3 + 2*ISO(ii1)));
+          case 5: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 6: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1));
+          case 7: return (-4*sqrt(ISO(ii1)*(1 + ISO(ii1))*S(ss1)*(1 + S(ss1))))/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1));
+          case 8: return 1/(1 + 2*S(ss1));
+          case 9: return 1/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1));
+          case 10: return -1;
+          case 11: return 1/(-1 - 2*ISO(ii1));
+          case 12: return (2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1));
+          case 13: return (-2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1));
+          case 14: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 15: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1));
+          case 16: return (-4*sqrt(ISO(ii1)*(1 + ISO(ii1))*S(ss1)*(1 + S(ss1))))/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1));
+          case 17: return 1/(1 + 2*S(ss1));
+          case 18: return 1/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1));
+          case 19: return -1;
+          case 20: return 1/(-1 - 2*ISO(ii1));
+          case 21: return (2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1));
+          case 22: return (-2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1));
+          case 23: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 24: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 25: return (3*sqrt(S(ss1)*(3 + 4*S(ss1)*(2 + S(ss1)))) + 2*sqrt(Power(S(ss1),3)*(3 + 4*S(ss1)*(2 + S(ss1)))))/(sqrt(1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))));
+          case 26: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 27: return 1;
+          case 28: return 1;
+          case 29: return 1;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(2, 2));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(2, 2));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -75,10 +156,26 @@ MatrixElements<SC> SymmetryISO2<SC>::recalc_doublet(const DiagInfo<SC> &diag, co
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "iso2/iso2-1ch-doubletmm.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {1, 2},
+        {2, 2},
+        {3, 3},
+        {3, 4},
+        {4, 4}
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(2, 2));
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1/(1 + 2*ISO(ii1));
+          case 2: return (2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1));
+          case 3: return -1;
+          case 4: return 1/(-1 - 2*S(ss1));
+          case 5: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          default: my_assert_not_reached();
+        }
+      };
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(2, 2));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -88,10 +185,74 @@ MatrixElements<SC> SymmetryISO2<SC>::recalc_doublet(const DiagInfo<SC> &diag, co
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "iso2/iso2-2ch-doubletmm.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {1, 2},
+        {2, 2},
+        {2, 3},
+        {3, 3},
+        {4, 4},
+        {4, 5},
+        {4, 6},
+        {4, 7},
+        {5, 5},
+        {5, 7},
+        {6, 6},
+        {6, 7},
+        {7, 7},
+        {8, 8},
+        {8, 9},
+        {8, 10},
+        {8, 11},
+        {9, 9},
+        {9, 11},
+        {10, 10},
+        {10, 11},
+        {11, 11},
+        {12, 12},
+        {12, 13},
+        {13, 13},
+        {13, 14},
+        {14, 14},
+        {15, 15},
+        {16, 16}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1/sqrt(ISO(ii1)*(1 + 2*ISO(ii1)));
+          case 2: return (-1 + ISO(ii1) + 2*Power(ISO(ii1),2))/sqrt(ISO(ii1)*(1 + ISO(ii1))*(-1 + 2*ISO(ii1))*(1 + 2*ISO(ii1)));
+          case 3: return 1/sqrt((1 + ISO(ii1))*(1 + 2*ISO(ii1)));
+          case 4: return sqrt((ISO(ii1)*(1 + 2*ISO(ii1)))/(Power(1 + ISO(ii1),3)*(3 + 2*ISO(ii1)))) + sqrt(ISO(ii1)/(Power(1 + ISO(ii1),3)*(3 + 4*ISO(ii1)*(2 + ISO(ii1))))) + sqrt(1 + 1/(1 + ISO(ii1)) - 6/(3 + 2*ISO(ii1)));
+          case 5: return -1;
+          case 6: return 1/(-1 - 2*ISO(ii1));
+          case 7: return 1/(-1 - 2*S(ss1));
+          case 8: return -(1/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1)));
+          case 9: return (-2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1));
+          case 10: return (-2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1));
+          case 11: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 12: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1));
+          case 13: return (-4*sqrt(ISO(ii1)*(1 + ISO(ii1))*S(ss1)*(1 + S(ss1))))/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1));
+          case 14: return -1;
+          case 15: return 1/(-1 - 2*ISO(ii1));
+          case 16: return 1/(-1 - 2*S(ss1));
+          case 17: return -(1/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1)));
+          case 18: return (-2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1));
+          case 19: return (-2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1));
+          case 20: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 21: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1));
+          case 22: return (-4*sqrt(ISO(ii1)*(1 + ISO(ii1))*S(ss1)*(1 + S(ss1))))/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1));
+          case 23: return 1;
+          case 24: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 25: return (-1 + S(ss1) + 2*Power(S(ss1),2))/sqrt(S(ss1)*(1 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1)));
+          case 26: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 27: return sqrt((S(ss1)*(1 + 2*S(ss1)))/(Power(1 + S(ss1),3)*(3 + 2*S(ss1)))) + sqrt(S(ss1)/(Power(1 + S(ss1),3)*(3 + 4*S(ss1)*(2 + S(ss1))))) + sqrt(1 + 1/(1 + S(ss1)) - 6/(3 + 2*S(ss1)));
+          case 28: return 1;
+          case 29: return 1;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(2, 2));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(2, 2));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -106,10 +267,26 @@ MatrixElements<SC> SymmetryISO2<SC>::recalc_doublet(const DiagInfo<SC> &diag, co
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "iso2/iso2-1ch-doubletpp.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 1},
+        {2, 2},
+        {3, 3},
+        {4, 3},
+        {4, 4}
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(2, 2));
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return (2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1));
+          case 1: return 1/(-1 - 2*ISO(ii1));
+          case 2: return 1;
+          case 3: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 4: return 1/(1 + 2*S(ss1));
+          case 5: return -1;
+          default: my_assert_not_reached();
+        }
+      };
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(2, 2));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -119,10 +296,74 @@ MatrixElements<SC> SymmetryISO2<SC>::recalc_doublet(const DiagInfo<SC> &diag, co
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "iso2/iso2-2ch-doubletpp.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 1},
+        {2, 2},
+        {3, 2},
+        {3, 3},
+        {4, 4},
+        {5, 4},
+        {5, 5},
+        {6, 4},
+        {6, 6},
+        {7, 4},
+        {7, 5},
+        {7, 6},
+        {7, 7},
+        {8, 8},
+        {9, 8},
+        {9, 9},
+        {10, 8},
+        {10, 10},
+        {11, 8},
+        {11, 9},
+        {11, 10},
+        {11, 11},
+        {12, 12},
+        {13, 12},
+        {13, 13},
+        {14, 13},
+        {14, 14},
+        {15, 15},
+        {16, 16}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1/sqrt((ISO(ii1)*(1 + 2*ISO(ii1)))/(-1 + ISO(ii1) + 2*Power(ISO(ii1),2)));
+          case 1: return -(1/sqrt(ISO(ii1)*(1 + 2*ISO(ii1))));
+          case 2: return (3*sqrt(ISO(ii1)*(3 + 4*ISO(ii1)*(2 + ISO(ii1)))) + 2*sqrt(Power(ISO(ii1),3)*(3 + 4*ISO(ii1)*(2 + ISO(ii1)))))/(sqrt(1 + ISO(ii1))*(3 + 4*ISO(ii1)*(2 + ISO(ii1))));
+          case 3: return -(1/sqrt((1 + ISO(ii1))*(1 + 2*ISO(ii1))));
+          case 4: return 1;
+          case 5: return (-4*sqrt(ISO(ii1)*(1 + ISO(ii1))*S(ss1)*(1 + S(ss1))))/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1));
+          case 6: return (2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1));
+          case 7: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 8: return (2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1));
+          case 9: return (-2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1));
+          case 10: return -(1/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1)));
+          case 11: return 1/(1 + 2*S(ss1));
+          case 12: return 1/(1 + 2*ISO(ii1));
+          case 13: return -1;
+          case 14: return (-4*sqrt(ISO(ii1)*(1 + ISO(ii1))*S(ss1)*(1 + S(ss1))))/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1));
+          case 15: return (2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1));
+          case 16: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 17: return (2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1));
+          case 18: return (-2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1));
+          case 19: return -(1/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1)));
+          case 20: return 1/(1 + 2*S(ss1));
+          case 21: return 1/(1 + 2*ISO(ii1));
+          case 22: return -1;
+          case 23: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 24: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 25: return (3*sqrt(S(ss1)*(3 + 4*S(ss1)*(2 + S(ss1)))) + 2*sqrt(Power(S(ss1),3)*(3 + 4*S(ss1)*(2 + S(ss1)))))/(sqrt(1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))));
+          case 26: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 27: return 1;
+          case 28: return 1;
+          case 29: return 1;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(2, 2));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(2, 2));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -137,10 +378,26 @@ MatrixElements<SC> SymmetryISO2<SC>::recalc_doublet(const DiagInfo<SC> &diag, co
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "iso2/iso2-1ch-doubletpm.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 1},
+        {2, 2},
+        {3, 3},
+        {3, 4},
+        {4, 4}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return (2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1));
+          case 1: return 1/(-1 - 2*ISO(ii1));
+          case 2: return 1;
+          case 3: return -1;
+          case 4: return 1/(-1 - 2*S(ss1));
+          case 5: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(2, 2));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(2, 2));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -150,10 +407,74 @@ MatrixElements<SC> SymmetryISO2<SC>::recalc_doublet(const DiagInfo<SC> &diag, co
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "iso2/iso2-2ch-doubletpm.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 1},
+        {2, 2},
+        {3, 2},
+        {3, 3},
+        {4, 4},
+        {4, 6},
+        {5, 4},
+        {5, 5},
+        {5, 6},
+        {5, 7},
+        {6, 6},
+        {7, 6},
+        {7, 7},
+        {8, 8},
+        {8, 10},
+        {9, 8},
+        {9, 9},
+        {9, 10},
+        {9, 11},
+        {10, 10},
+        {11, 10},
+        {11, 11},
+        {12, 12},
+        {12, 13},
+        {13, 13},
+        {13, 14},
+        {14, 14},
+        {15, 15},
+        {16, 16}
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(2, 2));
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1/sqrt((ISO(ii1)*(1 + 2*ISO(ii1)))/(-1 + ISO(ii1) + 2*Power(ISO(ii1),2)));
+          case 1: return -(1/sqrt(ISO(ii1)*(1 + 2*ISO(ii1))));
+          case 2: return (3*sqrt(ISO(ii1)*(3 + 4*ISO(ii1)*(2 + ISO(ii1)))) + 2*sqrt(Power(ISO(ii1),3)*(3 + 4*ISO(ii1)*(2 + ISO(ii1)))))/(sqrt(1 + ISO(ii1))*(3 + 4*ISO(ii1)*(2 + ISO(ii1))));
+          case 3: return -(1/sqrt((1 + ISO(ii1))*(1 + 2*ISO(ii1))));
+          case 4: return 1;
+          case 5: return (-2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1));
+          case 6: return (-2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1));
+          case 7: return 1/(1 + 2*ISO(ii1));
+          case 8: return -1;
+          case 9: return 1/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1));
+          case 10: return 1/(-1 - 2*S(ss1));
+          case 11: return (-4*sqrt(ISO(ii1)*(1 + ISO(ii1))*S(ss1)*(1 + S(ss1))))/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1));
+          case 12: return (2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1));
+          case 13: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 14: return (-2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1));
+          case 15: return (-2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1));
+          case 16: return 1/(1 + 2*ISO(ii1));
+          case 17: return -1;
+          case 18: return 1/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1));
+          case 19: return 1/(-1 - 2*S(ss1));
+          case 20: return (-4*sqrt(ISO(ii1)*(1 + ISO(ii1))*S(ss1)*(1 + S(ss1))))/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1));
+          case 21: return (2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1));
+          case 22: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 23: return 1;
+          case 24: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 25: return (-1 + S(ss1) + 2*Power(S(ss1),2))/sqrt(S(ss1)*(1 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1)));
+          case 26: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 27: return sqrt((S(ss1)*(1 + 2*S(ss1)))/(Power(1 + S(ss1),3)*(3 + 2*S(ss1)))) + sqrt(S(ss1)/(Power(1 + S(ss1),3)*(3 + 4*S(ss1)*(2 + S(ss1))))) + sqrt(1 + 1/(1 + S(ss1)) - 6/(3 + 2*S(ss1)));
+          case 28: return 1;
+          case 29: return 1;
+          default: my_assert_not_reached();
+        }
+      };
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(2, 2));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -349,6 +670,7 @@ Opch<SC> SymmetryISO2<SC>::recalc_irreduc(const Step &step, const DiagInfo<SC> &
 template<typename SC>
 MatrixElements<SC> SymmetryISO2<SC>::recalc_triplet(const DiagInfo<SC> &diag, const SubspaceStructure &substruct, const MatrixElements<SC> &cold) const {
   MatrixElements<SC> cnew;
+  const auto blocks = std::make_shared<const BlockIndex<SC>>(cold, substruct);
   for(const auto &[I1, eig]: diag) {
     int ii1 = I1.get("II");
     int ss1 = I1.get("SS");
@@ -361,10 +683,26 @@ MatrixElements<SC> SymmetryISO2<SC>::recalc_triplet(const DiagInfo<SC> &diag, co
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "iso2/iso2-1ch-triplets.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {3, 4},
+        {4, 3},
+        {4, 4}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 3: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 4: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 5: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(1, 3));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(1, 3));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -374,10 +712,70 @@ MatrixElements<SC> SymmetryISO2<SC>::recalc_triplet(const DiagInfo<SC> &diag, co
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "iso2/iso2-2ch-triplets.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {4, 4},
+        {4, 6},
+        {5, 5},
+        {5, 7},
+        {6, 4},
+        {6, 6},
+        {7, 5},
+        {7, 7},
+        {8, 8},
+        {8, 10},
+        {9, 9},
+        {9, 11},
+        {10, 8},
+        {10, 10},
+        {11, 9},
+        {11, 11},
+        {12, 12},
+        {12, 13},
+        {13, 12},
+        {13, 13},
+        {13, 14},
+        {14, 13},
+        {14, 14},
+        {15, 15},
+        {16, 16}
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(1, 3));
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return 1;
+          case 3: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 4: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 5: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 6: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 7: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 8: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 9: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 10: return (2*sqrt(S(ss1)/(3 + 4*S(ss1)*(2 + S(ss1)))) + sqrt(S(ss1) - (2*S(ss1))/(3 + 2*S(ss1))))/sqrt(1 + S(ss1));
+          case 11: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 12: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 13: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 14: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 15: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 16: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 17: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 18: return (2*sqrt(S(ss1)/(3 + 4*S(ss1)*(2 + S(ss1)))) + sqrt(S(ss1) - (2*S(ss1))/(3 + 2*S(ss1))))/sqrt(1 + S(ss1));
+          case 19: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 20: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 21: return -(1/S(ss1));
+          case 22: return 1 - 1/S(ss1) + 1/(1 + S(ss1));
+          case 23: return 1/(1 + S(ss1));
+          case 24: return (-3 - 2*S(ss1))/((1 + S(ss1))*sqrt(3 + 4*S(ss1)*(2 + S(ss1))));
+          case 25: return (12*sqrt(S(ss1)*(1 + S(ss1))*(2 + S(ss1))) + 33*sqrt(Power(S(ss1),5)*(1 + S(ss1))*(2 + S(ss1))) + 24*sqrt(Power(S(ss1),7)*(1 + S(ss1))*(2 + S(ss1))) + 4*sqrt(Power(S(ss1),9)*(1 + S(ss1))*(2 + S(ss1))) + 18*sqrt((S(ss1)*(2 + S(ss1))*Power(1 + 2*S(ss1),2))/((1 + S(ss1))*Power(3 + 2*S(ss1),2))) + S(ss1)*(29*sqrt(S(ss1)*(1 + S(ss1))*(2 + S(ss1))) + 60*sqrt((S(ss1)*(2 + S(ss1))*Power(1 + 2*S(ss1),2))/((1 + S(ss1))*Power(3 + 2*S(ss1),2))) + 2*S(ss1)*sqrt((S(ss1)*(2 + S(ss1))*Power(1 + 2*S(ss1),2))/((1 + S(ss1))*Power(3 + 2*S(ss1),2)))*(31 + 10*S(ss1))))/(Power(1 + S(ss1),2.5)*(2 + S(ss1))*Power(3 + 2*S(ss1),2));
+          case 26: return 1;
+          case 27: return 1;
+          default: my_assert_not_reached();
+        }
+      };
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(1, 3));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -392,10 +790,24 @@ MatrixElements<SC> SymmetryISO2<SC>::recalc_triplet(const DiagInfo<SC> &diag, co
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "iso2/iso2-1ch-tripletp.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {4, 3},
+        {4, 4}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 3: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 4: return 1;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(1, 3));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(1, 3));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -405,10 +817,60 @@ MatrixElements<SC> SymmetryISO2<SC>::recalc_triplet(const DiagInfo<SC> &diag, co
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "iso2/iso2-2ch-tripletp.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {4, 4},
+        {5, 5},
+        {6, 4},
+        {6, 6},
+        {7, 5},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {10, 8},
+        {10, 10},
+        {11, 9},
+        {11, 11},
+        {12, 12},
+        {13, 12},
+        {13, 13},
+        {14, 12},
+        {14, 13},
+        {14, 14},
+        {15, 15},
+        {16, 16}
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(1, 3));
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return 1;
+          case 3: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 4: return sqrt(1 + 1/(1 + S(ss1)) - 2/(1 + 2*S(ss1)));
+          case 5: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 6: return 1;
+          case 7: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 8: return 1;
+          case 9: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 10: return sqrt(1 + 1/(1 + S(ss1)) - 2/(1 + 2*S(ss1)));
+          case 11: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 12: return 1;
+          case 13: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 14: return 1;
+          case 15: return sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 16: return -(sqrt(1 + 2/(1 + 2*S(ss1)))/(1 + S(ss1)));
+          case 17: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 18: return 1/(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 19: return -(1/(1 + S(ss1)));
+          case 20: return 1;
+          case 21: return 1;
+          case 22: return 1;
+          default: my_assert_not_reached();
+        }
+      };
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(1, 3));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -423,10 +885,24 @@ MatrixElements<SC> SymmetryISO2<SC>::recalc_triplet(const DiagInfo<SC> &diag, co
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "iso2/iso2-1ch-tripletm.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {3, 4},
+        {4, 4}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return 1;
+          case 3: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 4: return (1/sqrt((S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1)))/(-1 + 2*S(ss1))) + 1/sqrt((S(ss1)*(1 + S(ss1)))/(-1 + 4*Power(S(ss1),2))))/2.;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(1, 3));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(1, 3));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -436,10 +912,60 @@ MatrixElements<SC> SymmetryISO2<SC>::recalc_triplet(const DiagInfo<SC> &diag, co
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "iso2/iso2-2ch-tripletm.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {4, 4},
+        {4, 6},
+        {5, 5},
+        {5, 7},
+        {6, 6},
+        {7, 7},
+        {8, 8},
+        {8, 10},
+        {9, 9},
+        {9, 11},
+        {10, 10},
+        {11, 11},
+        {12, 12},
+        {12, 13},
+        {12, 14},
+        {13, 13},
+        {13, 14},
+        {14, 14},
+        {15, 15},
+        {16, 16}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return 1;
+          case 3: return 1;
+          case 4: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 5: return 1;
+          case 6: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 7: return (1/sqrt((S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1)))/(-1 + 2*S(ss1))) + 1/sqrt((S(ss1)*(1 + S(ss1)))/(-1 + 4*Power(S(ss1),2))))/2.;
+          case 8: return (1/sqrt((S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1)))/(-1 + 2*S(ss1))) + 1/sqrt((S(ss1)*(1 + S(ss1)))/(-1 + 4*Power(S(ss1),2))))/2.;
+          case 9: return 1;
+          case 10: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 11: return 1;
+          case 12: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 13: return (1/sqrt((S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1)))/(-1 + 2*S(ss1))) + 1/sqrt((S(ss1)*(1 + S(ss1)))/(-1 + 4*Power(S(ss1),2))))/2.;
+          case 14: return (1/sqrt((S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1)))/(-1 + 2*S(ss1))) + 1/sqrt((S(ss1)*(1 + S(ss1)))/(-1 + 4*Power(S(ss1),2))))/2.;
+          case 15: return 1;
+          case 16: return 1/S(ss1);
+          case 17: return 1/(S(ss1) + 2*Power(S(ss1),2));
+          case 18: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 19: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 20: return sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 21: return 1;
+          case 22: return 1;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(1, 3));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(1, 3));
       if (cn) cnew[II] = *cn;
     }
   }
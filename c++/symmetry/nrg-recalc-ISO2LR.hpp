@@ -282,6 +282,7 @@ Opch<SC> SymmetryISO2LR<SC>::recalc_irreduc(const Step &step, const DiagInfo<SC>
 template<typename SC>
 MatrixElements<SC> SymmetryISO2LR<SC>::recalc_doublet(const DiagInfo<SC> &diag, const SubspaceStructure &substruct, const MatrixElements<SC> &cold) const {
   MatrixElements<SC> cnew;
+  const auto blocks = std::make_shared<const BlockIndex<SC>>(cold, substruct);
   for(const auto &[I1, eig]: diag) {
     int ii1 = I1.get("II");
     int ss1 = I1.get("SS");
@@ -294,10 +295,74 @@ MatrixElements<SC> SymmetryISO2LR<SC>::recalc_doublet(const DiagInfo<SC> &diag,
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "iso2lr/iso2lr-2ch-doubletmp.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {4, 3},
+        {4, 4},
+        {5, 4},
+        {5, 5},
+        {6, 6},
+        {6, 7},
+        {7, 7},
+        {8, 6},
+        {8, 7},
+        {8, 8},
+        {8, 9},
+        {9, 7},
+        {9, 9},
+        {10, 10},
+        {10, 11},
+        {11, 11},
+        {12, 10},
+        {12, 11},
+        {12, 12},
+        {12, 13},
+        {13, 11},
+        {13, 13},
+        {14, 14},
+        {14, 15},
+        {15, 15},
+        {15, 16},
+        {16, 16}
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(2, 2, +1));
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 3: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 4: return (S(ss1)*(3 + 2*S(ss1)))/sqrt(S(ss1)*(1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))));
+          case 5: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 6: return 1;
+          case 7: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 8: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1));
+          case 9: return (-4*sqrt(ISO(ii1)*(1 + ISO(ii1))*S(ss1)*(1 + S(ss1))))/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1));
+          case 10: return 1/(1 + 2*S(ss1));
+          case 11: return 1/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1));
+          case 12: return -1;
+          case 13: return 1/(-1 - 2*ISO(ii1));
+          case 14: return (2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1));
+          case 15: return (-2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1));
+          case 16: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 17: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1));
+          case 18: return (-4*sqrt(ISO(ii1)*(1 + ISO(ii1))*S(ss1)*(1 + S(ss1))))/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1));
+          case 19: return 1/(1 + 2*S(ss1));
+          case 20: return 1/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1));
+          case 21: return -1;
+          case 22: return 1/(-1 - 2*ISO(ii1));
+          case 23: return (2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1));
+          case 24: return (-2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1));
+          case 25: return sqrt(1/(-1 + 2*ISO(ii1)))*sqrt(-1 + 2*ISO(ii1));
+          case 26: return sqrt(1/(ISO(ii1)*(-1 + 2*ISO(ii1))))*sqrt(1 - 2/(1 + 2*ISO(ii1)));
+          case 27: return (ISO(ii1)*(-1 + 2*ISO(ii1)) + sqrt(-1 + 4*Power(ISO(ii1),2))*sqrt(1 - 2/(1 + 2*ISO(ii1))))/sqrt(ISO(ii1)*(1 + ISO(ii1))*(-1 + 4*Power(ISO(ii1),2)));
+          case 28: return 1/sqrt((1 + ISO(ii1))*(1 + 2*ISO(ii1)));
+          case 29: return sqrt(1 + 1/(1 + ISO(ii1)) - 2/(1 + 2*ISO(ii1)));
+          default: my_assert_not_reached();
+        }
+      };
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(2, 2, +1));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -309,10 +374,74 @@ MatrixElements<SC> SymmetryISO2LR<SC>::recalc_doublet(const DiagInfo<SC> &diag,
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "iso2lr/iso2lr-2ch-doubletmm.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {3, 4},
+        {4, 4},
+        {4, 5},
+        {5, 5},
+        {6, 6},
+        {6, 7},
+        {6, 8},
+        {6, 9},
+        {7, 7},
+        {7, 9},
+        {8, 8},
+        {8, 9},
+        {9, 9},
+        {10, 10},
+        {10, 11},
+        {10, 12},
+        {10, 13},
+        {11, 11},
+        {11, 13},
+        {12, 12},
+        {12, 13},
+        {13, 13},
+        {14, 14},
+        {14, 15},
+        {15, 15},
+        {15, 16},
+        {16, 16}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return sqrt(1/(-1 + 2*S(ss1)))*sqrt(-1 + 2*S(ss1));
+          case 3: return sqrt(1/(S(ss1)*(-1 + 2*S(ss1))))*sqrt(1 - 2/(1 + 2*S(ss1)));
+          case 4: return (S(ss1)*(-1 + 2*S(ss1)) + sqrt(-1 + 4*Power(S(ss1),2))*sqrt(1 - 2/(1 + 2*S(ss1))))/sqrt(S(ss1)*(1 + S(ss1))*(-1 + 4*Power(S(ss1),2)));
+          case 5: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 6: return sqrt(1 + 1/(1 + S(ss1)) - 2/(1 + 2*S(ss1)));
+          case 7: return -(sqrt(1/(-1 + 2*S(ss1)))*sqrt(-1 + 2*S(ss1)));
+          case 8: return -((sqrt(1/(-1 + 2*S(ss1)))*sqrt(-1 + 2*S(ss1)))/(1 + 2*ISO(ii1)));
+          case 9: return 1/(-1 - 2*S(ss1));
+          case 10: return -(1/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1)));
+          case 11: return (-2*sqrt(ISO(ii1)/(-1 + 2*S(ss1)))*sqrt((1 + ISO(ii1))*(-1 + 2*S(ss1))))/(1 + 2*ISO(ii1));
+          case 12: return (-2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1));
+          case 13: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 14: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1));
+          case 15: return (-4*sqrt(ISO(ii1)*(1 + ISO(ii1))*S(ss1)*(1 + S(ss1))))/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1));
+          case 16: return -(sqrt(1/(-1 + 2*S(ss1)))*sqrt(-1 + 2*S(ss1)));
+          case 17: return -((sqrt(1/(-1 + 2*S(ss1)))*sqrt(-1 + 2*S(ss1)))/(1 + 2*ISO(ii1)));
+          case 18: return 1/(-1 - 2*S(ss1));
+          case 19: return -(1/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1)));
+          case 20: return (-2*sqrt(ISO(ii1)/(-1 + 2*S(ss1)))*sqrt((1 + ISO(ii1))*(-1 + 2*S(ss1))))/(1 + 2*ISO(ii1));
+          case 21: return (-2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1));
+          case 22: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 23: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1));
+          case 24: return (-4*sqrt(ISO(ii1)*(1 + ISO(ii1))*S(ss1)*(1 + S(ss1))))/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1));
+          case 25: return sqrt(1/(-1 + 2*ISO(ii1)))*sqrt(-1 + 2*ISO(ii1));
+          case 26: return sqrt(1/(ISO(ii1)*(-1 + 2*ISO(ii1))))*sqrt(1 - 2/(1 + 2*ISO(ii1)));
+          case 27: return (ISO(ii1)*(-1 + 2*ISO(ii1)) + sqrt(-1 + 4*Power(ISO(ii1),2))*sqrt(1 - 2/(1 + 2*ISO(ii1))))/sqrt(ISO(ii1)*(1 + ISO(ii1))*(-1 + 4*Power(ISO(ii1),2)));
+          case 28: return 1/sqrt((1 + ISO(ii1))*(1 + 2*ISO(ii1)));
+          case 29: return sqrt(1 + 1/(1 + ISO(ii1)) - 2/(1 + 2*ISO(ii1)));
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(2, 2, +1));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(2, 2, +1));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -324,10 +453,74 @@ MatrixElements<SC> SymmetryISO2LR<SC>::recalc_doublet(const DiagInfo<SC> &diag,
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "iso2lr/iso2lr-2ch-doubletpp.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {4, 3},
+        {4, 4},
+        {5, 4},
+        {5, 5},
+        {6, 6},
+        {7, 6},
+        {7, 7},
+        {8, 6},
+        {8, 8},
+        {9, 6},
+        {9, 7},
+        {9, 8},
+        {9, 9},
+        {10, 10},
+        {11, 10},
+        {11, 11},
+        {12, 10},
+        {12, 12},
+        {13, 10},
+        {13, 11},
+        {13, 12},
+        {13, 13},
+        {14, 14},
+        {15, 14},
+        {15, 15},
+        {16, 15},
+        {16, 16}
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(2, 2, +1));
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 3: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 4: return (S(ss1)*(3 + 2*S(ss1)))/sqrt(S(ss1)*(1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))));
+          case 5: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 6: return 1;
+          case 7: return (-4*sqrt(ISO(ii1)*(1 + ISO(ii1))*S(ss1)*(1 + S(ss1))))/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1));
+          case 8: return (2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1));
+          case 9: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 10: return (2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1));
+          case 11: return (-2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1));
+          case 12: return -(1/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1)));
+          case 13: return 1/(1 + 2*S(ss1));
+          case 14: return 1/(1 + 2*ISO(ii1));
+          case 15: return -1;
+          case 16: return (-4*sqrt(ISO(ii1)*(1 + ISO(ii1))*S(ss1)*(1 + S(ss1))))/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1));
+          case 17: return (2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1));
+          case 18: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 19: return (2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1));
+          case 20: return (-2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1));
+          case 21: return -(1/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1)));
+          case 22: return 1/(1 + 2*S(ss1));
+          case 23: return 1/(1 + 2*ISO(ii1));
+          case 24: return -1;
+          case 25: return 1/sqrt((ISO(ii1)*(1 + 2*ISO(ii1)))/(-1 + ISO(ii1) + 2*Power(ISO(ii1),2)));
+          case 26: return -(1/sqrt(ISO(ii1)*(1 + 2*ISO(ii1))));
+          case 27: return (ISO(ii1)*(3 + 2*ISO(ii1)))/sqrt(ISO(ii1)*(1 + ISO(ii1))*(3 + 4*ISO(ii1)*(2 + ISO(ii1))));
+          case 28: return -(1/sqrt((1 + ISO(ii1))*(1 + 2*ISO(ii1))));
+          case 29: return 1;
+          default: my_assert_not_reached();
+        }
+      };
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(2, 2, +1));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -339,10 +532,74 @@ MatrixElements<SC> SymmetryISO2LR<SC>::recalc_doublet(const DiagInfo<SC> &diag,
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "iso2lr/iso2lr-2ch-doubletpm.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {3, 4},
+        {4, 4},
+        {4, 5},
+        {5, 5},
+        {6, 6},
+        {6, 8},
+        {7, 6},
+        {7, 7},
+        {7, 8},
+        {7, 9},
+        {8, 8},
+        {9, 8},
+        {9, 9},
+        {10, 10},
+        {10, 12},
+        {11, 10},
+        {11, 11},
+        {11, 12},
+        {11, 13},
+        {12, 12},
+        {13, 12},
+        {13, 13},
+        {14, 14},
+        {15, 14},
+        {15, 15},
+        {16, 15},
+        {16, 16}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return sqrt(1/(-1 + 2*S(ss1)))*sqrt(-1 + 2*S(ss1));
+          case 3: return sqrt(1/(S(ss1)*(-1 + 2*S(ss1))))*sqrt(1 - 2/(1 + 2*S(ss1)));
+          case 4: return (S(ss1)*(-1 + 2*S(ss1)) + sqrt(-1 + 4*Power(S(ss1),2))*sqrt(1 - 2/(1 + 2*S(ss1))))/sqrt(S(ss1)*(1 + S(ss1))*(-1 + 4*Power(S(ss1),2)));
+          case 5: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 6: return sqrt(1 + 1/(1 + S(ss1)) - 2/(1 + 2*S(ss1)));
+          case 7: return -2*sqrt((ISO(ii1)*(1 + ISO(ii1)))/(Power(1 + 2*ISO(ii1),2)*(-1 + 2*S(ss1))))*sqrt(-1 + 2*S(ss1));
+          case 8: return (-2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1));
+          case 9: return (sqrt(1/(-1 + 2*S(ss1)))*sqrt(-1 + 2*S(ss1)))/(1 + 2*ISO(ii1));
+          case 10: return -(sqrt(((1 + ISO(ii1))*S(ss1)*(-1 + 2*S(ss1)))/(3 + 2*ISO(ii1)))*(2*sqrt(1/((3 + 5*ISO(ii1) + 2*Power(ISO(ii1),2))*S(ss1)*(-1 + 2*S(ss1)))) + sqrt(Power(1 + 2*ISO(ii1),2)/((3 + 5*ISO(ii1) + 2*Power(ISO(ii1),2))*S(ss1)*(-1 + 2*S(ss1))))));
+          case 11: return 1/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1));
+          case 12: return 1/(-1 - 2*S(ss1));
+          case 13: return (-4*sqrt(ISO(ii1)*(1 + ISO(ii1))*S(ss1)*(1 + S(ss1))))/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1));
+          case 14: return (2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1));
+          case 15: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 16: return -2*sqrt((ISO(ii1)*(1 + ISO(ii1)))/(Power(1 + 2*ISO(ii1),2)*(-1 + 2*S(ss1))))*sqrt(-1 + 2*S(ss1));
+          case 17: return (-2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1));
+          case 18: return (sqrt(1/(-1 + 2*S(ss1)))*sqrt(-1 + 2*S(ss1)))/(1 + 2*ISO(ii1));
+          case 19: return -(sqrt(((1 + ISO(ii1))*S(ss1)*(-1 + 2*S(ss1)))/(3 + 2*ISO(ii1)))*(2*sqrt(1/((3 + 5*ISO(ii1) + 2*Power(ISO(ii1),2))*S(ss1)*(-1 + 2*S(ss1)))) + sqrt(Power(1 + 2*ISO(ii1),2)/((3 + 5*ISO(ii1) + 2*Power(ISO(ii1),2))*S(ss1)*(-1 + 2*S(ss1))))));
+          case 20: return 1/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1));
+          case 21: return 1/(-1 - 2*S(ss1));
+          case 22: return (-4*sqrt(ISO(ii1)*(1 + ISO(ii1))*S(ss1)*(1 + S(ss1))))/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1));
+          case 23: return (2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*ISO(ii1) + 2*S(ss1) + 4*ISO(ii1)*S(ss1));
+          case 24: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 25: return 1/sqrt((ISO(ii1)*(1 + 2*ISO(ii1)))/(-1 + ISO(ii1) + 2*Power(ISO(ii1),2)));
+          case 26: return -(1/sqrt(ISO(ii1)*(1 + 2*ISO(ii1))));
+          case 27: return (ISO(ii1)*(3 + 2*ISO(ii1)))/sqrt(ISO(ii1)*(1 + ISO(ii1))*(3 + 4*ISO(ii1)*(2 + ISO(ii1))));
+          case 28: return -(1/sqrt((1 + ISO(ii1))*(1 + 2*ISO(ii1))));
+          case 29: return 1;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(2, 2, +1));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(2, 2, +1));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -355,6 +612,7 @@ MatrixElements<SC> SymmetryISO2LR<SC>::recalc_doublet(const DiagInfo<SC> &diag,
 template<typename SC>
 MatrixElements<SC> SymmetryISO2LR<SC>::recalc_triplet(const DiagInfo<SC> &diag, const SubspaceStructure &substruct, const MatrixElements<SC> &cold) const {
   MatrixElements<SC> cnew;
+  const auto blocks = std::make_shared<const BlockIndex<SC>>(cold, substruct);
   for(const auto &[I1, eig]: diag) {
     int ii1 = I1.get("II");
     int ss1 = I1.get("SS");
@@ -367,10 +625,70 @@ MatrixElements<SC> SymmetryISO2LR<SC>::recalc_triplet(const DiagInfo<SC> &diag,
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "iso2lr/iso2lr-2ch-triplets.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {3, 4},
+        {4, 3},
+        {4, 4},
+        {4, 5},
+        {5, 4},
+        {5, 5},
+        {6, 6},
+        {6, 8},
+        {7, 7},
+        {7, 9},
+        {8, 6},
+        {8, 8},
+        {9, 7},
+        {9, 9},
+        {10, 10},
+        {10, 12},
+        {11, 11},
+        {11, 13},
+        {12, 10},
+        {12, 12},
+        {13, 11},
+        {13, 13},
+        {14, 14},
+        {15, 15},
+        {16, 16}
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(1, 3, +1));
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return (sqrt(1/(-1 + 2*S(ss1)))*sqrt(-1 + 2*S(ss1))*sqrt(-1 + Power(S(ss1),2)))/S(ss1);
+          case 3: return ((-1 + 2*S(ss1))*sqrt(1/(-1 + 4*Power(S(ss1),2))))/S(ss1);
+          case 4: return -(1/S(ss1));
+          case 5: return 1 - 1/S(ss1) + 1/(1 + S(ss1));
+          case 6: return 1/(1 + S(ss1));
+          case 7: return -(sqrt(1 + 2/(1 + 2*S(ss1)))/(1 + S(ss1)));
+          case 8: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 9: return sqrt(1 - 1/S(ss1) + 2/(1 + 2*S(ss1)));
+          case 10: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 11: return sqrt(1 - 1/S(ss1) + 2/(1 + 2*S(ss1)));
+          case 12: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 13: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 14: return 2*sqrt(S(ss1)/(3 + 11*S(ss1) + 12*Power(S(ss1),2) + 4*Power(S(ss1),3))) + sqrt(S(ss1)/(Power(1 + S(ss1),3)*(3 + 4*S(ss1)*(2 + S(ss1))))) + 3*S(ss1)*sqrt(S(ss1)/(Power(1 + S(ss1),3)*(3 + 4*S(ss1)*(2 + S(ss1))))) + 2*sqrt(Power(S(ss1),5)/(Power(1 + S(ss1),3)*(3 + 4*S(ss1)*(2 + S(ss1)))));
+          case 15: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 16: return 2*sqrt(S(ss1)/(3 + 11*S(ss1) + 12*Power(S(ss1),2) + 4*Power(S(ss1),3))) + sqrt(S(ss1)/(Power(1 + S(ss1),3)*(3 + 4*S(ss1)*(2 + S(ss1))))) + 3*S(ss1)*sqrt(S(ss1)/(Power(1 + S(ss1),3)*(3 + 4*S(ss1)*(2 + S(ss1))))) + 2*sqrt(Power(S(ss1),5)/(Power(1 + S(ss1),3)*(3 + 4*S(ss1)*(2 + S(ss1)))));
+          case 17: return sqrt(1 - 1/S(ss1) + 2/(1 + 2*S(ss1)));
+          case 18: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 19: return sqrt(1 - 1/S(ss1) + 2/(1 + 2*S(ss1)));
+          case 20: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 21: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 22: return 2*sqrt(S(ss1)/(3 + 11*S(ss1) + 12*Power(S(ss1),2) + 4*Power(S(ss1),3))) + sqrt(S(ss1)/(Power(1 + S(ss1),3)*(3 + 4*S(ss1)*(2 + S(ss1))))) + 3*S(ss1)*sqrt(S(ss1)/(Power(1 + S(ss1),3)*(3 + 4*S(ss1)*(2 + S(ss1))))) + 2*sqrt(Power(S(ss1),5)/(Power(1 + S(ss1),3)*(3 + 4*S(ss1)*(2 + S(ss1)))));
+          case 23: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 24: return 2*sqrt(S(ss1)/(3 + 11*S(ss1) + 12*Power(S(ss1),2) + 4*Power(S(ss1),3))) + sqrt(S(ss1)/(Power(1 + S(ss1),3)*(3 + 4*S(ss1)*(2 + S(ss1))))) + 3*S(ss1)*sqrt(S(ss1)/(Power(1 + S(ss1),3)*(3 + 4*S(ss1)*(2 + S(ss1))))) + 2*sqrt(Power(S(ss1),5)/(Power(1 + S(ss1),3)*(3 + 4*S(ss1)*(2 + S(ss1)))));
+          case 25: return sqrt(1/(-1 + 2*ISO(ii1)))*sqrt(-1 + 2*ISO(ii1));
+          case 26: return 1;
+          case 27: return 1;
+          default: my_assert_not_reached();
+        }
+      };
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(1, 3, +1));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -382,10 +700,60 @@ MatrixElements<SC> SymmetryISO2LR<SC>::recalc_triplet(const DiagInfo<SC> &diag,
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "iso2lr/iso2lr-2ch-tripletp.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {4, 3},
+        {4, 4},
+        {5, 3},
+        {5, 4},
+        {5, 5},
+        {6, 6},
+        {7, 7},
+        {8, 6},
+        {8, 8},
+        {9, 7},
+        {9, 9},
+        {10, 10},
+        {11, 11},
+        {12, 10},
+        {12, 12},
+        {13, 11},
+        {13, 13},
+        {14, 14},
+        {15, 15},
+        {16, 16}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return 1/((1 + 2*S(ss1))*sqrt(1/(-3 + 4*S(ss1)*(1 + S(ss1)))));
+          case 3: return -(sqrt(3 + 4*S(ss1)*(2 + S(ss1)))/((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 4: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 5: return 1/(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 6: return -(1/(1 + S(ss1)));
+          case 7: return 1;
+          case 8: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 9: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 10: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 11: return 1;
+          case 12: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 13: return 1;
+          case 14: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 15: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 16: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 17: return 1;
+          case 18: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 19: return 1;
+          case 20: return sqrt(1/(-1 + 2*ISO(ii1)))*sqrt(-1 + 2*ISO(ii1));
+          case 21: return 1;
+          case 22: return 1;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(1, 3, +1));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(1, 3, +1));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -397,10 +765,60 @@ MatrixElements<SC> SymmetryISO2LR<SC>::recalc_triplet(const DiagInfo<SC> &diag,
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "iso2lr/iso2lr-2ch-tripletm.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {3, 4},
+        {3, 5},
+        {4, 4},
+        {4, 5},
+        {5, 5},
+        {6, 6},
+        {6, 8},
+        {7, 7},
+        {7, 9},
+        {8, 8},
+        {9, 9},
+        {10, 10},
+        {10, 12},
+        {11, 11},
+        {11, 13},
+        {12, 12},
+        {13, 13},
+        {14, 14},
+        {15, 15},
+        {16, 16}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return sqrt(1/(-1 + 2*S(ss1)))*sqrt(-1 + 2*S(ss1));
+          case 3: return (sqrt(1/(-1 + 2*S(ss1)))*sqrt(-1 + 2*S(ss1)))/S(ss1);
+          case 4: return (sqrt(1/(-1 + 4*Power(S(ss1),2)))*sqrt(1 - 2/(1 + 2*S(ss1))))/S(ss1);
+          case 5: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 6: return sqrt((-1 + 2*S(ss1))/(Power(S(ss1),2)*(1 + 2*S(ss1))));
+          case 7: return sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 8: return sqrt(1/(-1 + S(ss1)))*sqrt(-1 + S(ss1));
+          case 9: return sqrt(1/(S(ss1)*(-1 + 2*S(ss1))))*sqrt(1 - 2/(1 + 2*S(ss1)));
+          case 10: return sqrt(1/(-1 + S(ss1)))*sqrt(-1 + S(ss1));
+          case 11: return sqrt(2 - 1/S(ss1))*sqrt(1/(-1 + 4*Power(S(ss1),2)));
+          case 12: return (sqrt(4 - 1/S(ss1) - 3/(1 + S(ss1)))*(1 + sqrt((-1 + 2*S(ss1))/(1 + 3*S(ss1) + 2*Power(S(ss1),2)))*sqrt(1/(-1 - S(ss1) + 4*Power(S(ss1),2) + 4*Power(S(ss1),3))) + S(ss1)*sqrt((-1 + 2*S(ss1))/(1 + 3*S(ss1) + 2*Power(S(ss1),2)))*sqrt(1/(-1 - S(ss1) + 4*Power(S(ss1),2) + 4*Power(S(ss1),3)))))/2.;
+          case 13: return (sqrt((-(1/S(ss1)) + 4*S(ss1))/(1 + S(ss1)))*(1 + sqrt((-1 + 2*S(ss1))/(1 + 3*S(ss1) + 2*Power(S(ss1),2)))*sqrt(1/(-1 - S(ss1) + 4*Power(S(ss1),2) + 4*Power(S(ss1),3))) + S(ss1)*sqrt((-1 + 2*S(ss1))/(1 + 3*S(ss1) + 2*Power(S(ss1),2)))*sqrt(1/(-1 - S(ss1) + 4*Power(S(ss1),2) + 4*Power(S(ss1),3)))))/2.;
+          case 14: return sqrt(1/(-1 + S(ss1)))*sqrt(-1 + S(ss1));
+          case 15: return sqrt(1/(S(ss1)*(-1 + 2*S(ss1))))*sqrt(1 - 2/(1 + 2*S(ss1)));
+          case 16: return sqrt(1/(-1 + S(ss1)))*sqrt(-1 + S(ss1));
+          case 17: return sqrt(2 - 1/S(ss1))*sqrt(1/(-1 + 4*Power(S(ss1),2)));
+          case 18: return (sqrt(4 - 1/S(ss1) - 3/(1 + S(ss1)))*(1 + sqrt((-1 + 2*S(ss1))/(1 + 3*S(ss1) + 2*Power(S(ss1),2)))*sqrt(1/(-1 - S(ss1) + 4*Power(S(ss1),2) + 4*Power(S(ss1),3))) + S(ss1)*sqrt((-1 + 2*S(ss1))/(1 + 3*S(ss1) + 2*Power(S(ss1),2)))*sqrt(1/(-1 - S(ss1) + 4*Power(S(ss1),2) + 4*Power(S(ss1),3)))))/2.;
+          case 19: return (sqrt((-(1/S(ss1)) + 4*S(ss1))/(1 + S(ss1)))*(1 + sqrt((-1 + 2*S(ss1))/(1 + 3*S(ss1) + 2*Power(S(ss1),2)))*sqrt(1/(-1 - S(ss1) + 4*Power(S(ss1),2) + 4*Power(S(ss1),3))) + S(ss1)*sqrt((-1 + 2*S(ss1))/(1 + 3*S(ss1) + 2*Power(S(ss1),2)))*sqrt(1/(-1 - S(ss1) + 4*Power(S(ss1),2) + 4*Power(S(ss1),3)))))/2.;
+          case 20: return sqrt(1/(-1 + 2*ISO(ii1)))*sqrt(-1 + 2*ISO(ii1));
+          case 21: return 1;
+          case 22: return 1;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(1, 3, +1));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(1, 3, +1));
       if (cn) cnew[II] = *cn;
     }
   }
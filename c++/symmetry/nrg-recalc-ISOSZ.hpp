@@ -31,6 +31,7 @@ namespace NRG {
 template<typename SC>
 MatrixElements<SC> SymmetryISOSZ<SC>::recalc_doublet(const DiagInfo<SC> &diag, const SubspaceStructure &substruct, const MatrixElements<SC> &cold) const {
   MatrixElements<SC> cnew;
+  const auto blocks = std::make_shared<const BlockIndex<SC>>(cold, substruct);
   for(const auto &[I1, eig]: diag) {
     int ii1   = I1.get("II");
     int ssz1 = I1.get("SSZ");
@@ -43,10 +44,24 @@ MatrixElements<SC> SymmetryISOSZ<SC>::recalc_doublet(const DiagInfo<SC> &diag, c
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "isosz/isosz-1ch-doubletmp.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {1, 2},
+        {2, 2},
+        {3, 3},
+        {4, 4}
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(2, -1));
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1/(1 + 2*ISO(ii1));
+          case 2: return (2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1));
+          case 3: return -1;
+          case 4: return -1;
+          default: my_assert_not_reached();
+        }
+      };
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(2, -1));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -56,10 +71,58 @@ MatrixElements<SC> SymmetryISOSZ<SC>::recalc_doublet(const DiagInfo<SC> &diag, c
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "isosz/isosz-2ch-doubletmp.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {1, 2},
+        {2, 2},
+        {2, 3},
+        {3, 3},
+        {4, 4},
+        {4, 5},
+        {5, 5},
+        {6, 6},
+        {6, 7},
+        {7, 7},
+        {8, 8},
+        {8, 9},
+        {9, 9},
+        {10, 10},
+        {10, 11},
+        {11, 11},
+        {12, 12},
+        {13, 13},
+        {14, 14},
+        {15, 15},
+        {16, 16}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1/sqrt(ISO(ii1)*(1 + 2*ISO(ii1)));
+          case 2: return (-1 + ISO(ii1) + 2*Power(ISO(ii1),2))/sqrt(ISO(ii1)*(1 + ISO(ii1))*(-1 + 2*ISO(ii1))*(1 + 2*ISO(ii1)));
+          case 3: return 1/sqrt((1 + ISO(ii1))*(1 + 2*ISO(ii1)));
+          case 4: return sqrt((ISO(ii1)*(1 + 2*ISO(ii1)))/(Power(1 + ISO(ii1),3)*(3 + 2*ISO(ii1)))) + sqrt(ISO(ii1)/(Power(1 + ISO(ii1),3)*(3 + 4*ISO(ii1)*(2 + ISO(ii1))))) + sqrt(1 + 1/(1 + ISO(ii1)) - 6/(3 + 2*ISO(ii1)));
+          case 5: return -1;
+          case 6: return 1/(-1 - 2*ISO(ii1));
+          case 7: return (-2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1));
+          case 8: return -1;
+          case 9: return 1/(-1 - 2*ISO(ii1));
+          case 10: return (-2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1));
+          case 11: return -1;
+          case 12: return 1/(-1 - 2*ISO(ii1));
+          case 13: return (-2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1));
+          case 14: return -1;
+          case 15: return 1/(-1 - 2*ISO(ii1));
+          case 16: return (-2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1));
+          case 17: return 1;
+          case 18: return 1;
+          case 19: return 1;
+          case 20: return 1;
+          case 21: return 1;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(2, -1));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(2, -1));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -74,10 +137,24 @@ MatrixElements<SC> SymmetryISOSZ<SC>::recalc_doublet(const DiagInfo<SC> &diag, c
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "isosz/isosz-1ch-doubletmm.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {1, 2},
+        {2, 2},
+        {3, 3},
+        {4, 4}
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(2, +1));
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1/(1 + 2*ISO(ii1));
+          case 2: return (2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1));
+          case 3: return -1;
+          case 4: return -1;
+          default: my_assert_not_reached();
+        }
+      };
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(2, +1));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -87,10 +164,58 @@ MatrixElements<SC> SymmetryISOSZ<SC>::recalc_doublet(const DiagInfo<SC> &diag, c
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "isosz/isosz-2ch-doubletmm.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {1, 2},
+        {2, 2},
+        {2, 3},
+        {3, 3},
+        {4, 4},
+        {4, 5},
+        {5, 5},
+        {6, 6},
+        {6, 7},
+        {7, 7},
+        {8, 8},
+        {8, 9},
+        {9, 9},
+        {10, 10},
+        {10, 11},
+        {11, 11},
+        {12, 12},
+        {13, 13},
+        {14, 14},
+        {15, 15},
+        {16, 16}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1/sqrt(ISO(ii1)*(1 + 2*ISO(ii1)));
+          case 2: return (-1 + ISO(ii1) + 2*Power(ISO(ii1),2))/sqrt(ISO(ii1)*(1 + ISO(ii1))*(-1 + 2*ISO(ii1))*(1 + 2*ISO(ii1)));
+          case 3: return 1/sqrt((1 + ISO(ii1))*(1 + 2*ISO(ii1)));
+          case 4: return sqrt((ISO(ii1)*(1 + 2*ISO(ii1)))/(Power(1 + ISO(ii1),3)*(3 + 2*ISO(ii1)))) + sqrt(ISO(ii1)/(Power(1 + ISO(ii1),3)*(3 + 4*ISO(ii1)*(2 + ISO(ii1))))) + sqrt(1 + 1/(1 + ISO(ii1)) - 6/(3 + 2*ISO(ii1)));
+          case 5: return -1;
+          case 6: return 1/(-1 - 2*ISO(ii1));
+          case 7: return (-2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1));
+          case 8: return -1;
+          case 9: return 1/(-1 - 2*ISO(ii1));
+          case 10: return (-2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1));
+          case 11: return -1;
+          case 12: return 1/(-1 - 2*ISO(ii1));
+          case 13: return (-2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1));
+          case 14: return -1;
+          case 15: return 1/(-1 - 2*ISO(ii1));
+          case 16: return (-2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1));
+          case 17: return 1;
+          case 18: return 1;
+          case 19: return 1;
+          case 20: return 1;
+          case 21: return 1;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(2, +1));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(2, +1));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -105,10 +230,24 @@ MatrixElements<SC> SymmetryISOSZ<SC>::recalc_doublet(const DiagInfo<SC> &diag, c
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "isosz/isosz-1ch-doubletpp.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 1},
+        {2, 2},
+        {3, 3},
+        {4, 4}
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(2, -1));
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return (2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1));
+          case 1: return 1/(-1 - 2*ISO(ii1));
+          case 2: return 1;
+          case 3: return -1;
+          case 4: return -1;
+          default: my_assert_not_reached();
+        }
+      };
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(2, -1));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -118,10 +257,58 @@ MatrixElements<SC> SymmetryISOSZ<SC>::recalc_doublet(const DiagInfo<SC> &diag, c
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "isosz/isosz-2ch-doubletpp.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 1},
+        {2, 2},
+        {3, 2},
+        {3, 3},
+        {4, 4},
+        {5, 4},
+        {5, 5},
+        {6, 6},
+        {7, 6},
+        {7, 7},
+        {8, 8},
+        {9, 8},
+        {9, 9},
+        {10, 10},
+        {11, 10},
+        {11, 11},
+        {12, 12},
+        {13, 13},
+        {14, 14},
+        {15, 15},
+        {16, 16}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1/sqrt((ISO(ii1)*(1 + 2*ISO(ii1)))/(-1 + ISO(ii1) + 2*Power(ISO(ii1),2)));
+          case 1: return -(1/sqrt(ISO(ii1)*(1 + 2*ISO(ii1))));
+          case 2: return (3*sqrt(ISO(ii1)*(3 + 4*ISO(ii1)*(2 + ISO(ii1)))) + 2*sqrt(Power(ISO(ii1),3)*(3 + 4*ISO(ii1)*(2 + ISO(ii1)))))/(sqrt(1 + ISO(ii1))*(3 + 4*ISO(ii1)*(2 + ISO(ii1))));
+          case 3: return -(1/sqrt((1 + ISO(ii1))*(1 + 2*ISO(ii1))));
+          case 4: return 1;
+          case 5: return (-2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1));
+          case 6: return 1/(1 + 2*ISO(ii1));
+          case 7: return -1;
+          case 8: return (-2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1));
+          case 9: return 1/(1 + 2*ISO(ii1));
+          case 10: return -1;
+          case 11: return (-2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1));
+          case 12: return 1/(1 + 2*ISO(ii1));
+          case 13: return -1;
+          case 14: return (-2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1));
+          case 15: return 1/(1 + 2*ISO(ii1));
+          case 16: return -1;
+          case 17: return 1;
+          case 18: return 1;
+          case 19: return 1;
+          case 20: return 1;
+          case 21: return 1;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(2, -1));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(2, -1));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -136,10 +323,24 @@ MatrixElements<SC> SymmetryISOSZ<SC>::recalc_doublet(const DiagInfo<SC> &diag, c
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "isosz/isosz-1ch-doubletpm.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 1},
+        {2, 2},
+        {3, 3},
+        {4, 4}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return (2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1));
+          case 1: return 1/(-1 - 2*ISO(ii1));
+          case 2: return 1;
+          case 3: return -1;
+          case 4: return -1;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(2, +1));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(2, +1));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -149,10 +350,58 @@ MatrixElements<SC> SymmetryISOSZ<SC>::recalc_doublet(const DiagInfo<SC> &diag, c
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "isosz/isosz-2ch-doubletpm.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 1},
+        {2, 2},
+        {3, 2},
+        {3, 3},
+        {4, 4},
+        {5, 4},
+        {5, 5},
+        {6, 6},
+        {7, 6},
+        {7, 7},
+        {8, 8},
+        {9, 8},
+        {9, 9},
+        {10, 10},
+        {11, 10},
+        {11, 11},
+        {12, 12},
+        {13, 13},
+        {14, 14},
+        {15, 15},
+        {16, 16}
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(2, +1));
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1/sqrt((ISO(ii1)*(1 + 2*ISO(ii1)))/(-1 + ISO(ii1) + 2*Power(ISO(ii1),2)));
+          case 1: return -(1/sqrt(ISO(ii1)*(1 + 2*ISO(ii1))));
+          case 2: return (3*sqrt(ISO(ii1)*(3 + 4*ISO(ii1)*(2 + ISO(ii1)))) + 2*sqrt(Power(ISO(ii1),3)*(3 + 4*ISO(ii1)*(2 + ISO(ii1)))))/(sqrt(1 + ISO(ii1))*(3 + 4*ISO(ii1)*(2 + ISO(ii1))));
+          case 3: return -(1/sqrt((1 + ISO(ii1))*(1 + 2*ISO(ii1))));
+          case 4: return 1;
+          case 5: return (-2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1));
+          case 6: return 1/(1 + 2*ISO(ii1));
+          case 7: return -1;
+          case 8: return (-2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1));
+          case 9: return 1/(1 + 2*ISO(ii1));
+          case 10: return -1;
+          case 11: return (-2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1));
+          case 12: return 1/(1 + 2*ISO(ii1));
+          case 13: return -1;
+          case 14: return (-2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1));
+          case 15: return 1/(1 + 2*ISO(ii1));
+          case 16: return -1;
+          case 17: return 1;
+          case 18: return 1;
+          case 19: return 1;
+          case 20: return 1;
+          case 21: return 1;
+          default: my_assert_not_reached();
+        }
+      };
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(2, +1));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -350,6 +599,7 @@ Opch<SC> SymmetryISOSZ<SC>::recalc_irreduc(const Step &step, const DiagInfo<SC>
 template<typename SC>
 MatrixElements<SC> SymmetryISOSZ<SC>::recalc_triplet(const DiagInfo<SC> &diag, const SubspaceStructure &substruct, const MatrixElements<SC> &cold) const {
   MatrixElements<SC> cnew;
+  const auto blocks = std::make_shared<const BlockIndex<SC>>(cold, substruct);
   for(const auto &[I1, eig]: diag) {
     int ii1   = I1.get("II");
     int ssz1 = I1.get("SSZ");
@@ -362,10 +612,22 @@ MatrixElements<SC> SymmetryISOSZ<SC>::recalc_triplet(const DiagInfo<SC> &diag, c
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "isosz/isosz-1ch-triplets.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {4, 4}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return 1;
+          case 3: return 1;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(1, 0));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(1, 0));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -375,10 +637,46 @@ MatrixElements<SC> SymmetryISOSZ<SC>::recalc_triplet(const DiagInfo<SC> &diag, c
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "isosz/isosz-2ch-triplets.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {4, 4},
+        {5, 5},
+        {6, 6},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {10, 10},
+        {11, 11},
+        {12, 12},
+        {13, 13},
+        {14, 14},
+        {15, 15},
+        {16, 16}
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(1, 0));
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return 1;
+          case 3: return 1;
+          case 4: return 1;
+          case 5: return 1;
+          case 6: return 1;
+          case 7: return 1;
+          case 8: return 1;
+          case 9: return 1;
+          case 10: return 1;
+          case 11: return 1;
+          case 12: return 1;
+          case 13: return 1;
+          case 14: return 1;
+          case 15: return 1;
+          default: my_assert_not_reached();
+        }
+      };
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(1, 0));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -393,10 +691,22 @@ MatrixElements<SC> SymmetryISOSZ<SC>::recalc_triplet(const DiagInfo<SC> &diag, c
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "isosz/isosz-1ch-tripletp.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {4, 4}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return 1;
+          case 3: return 1;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(1, -2));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(1, -2));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -406,10 +716,46 @@ MatrixElements<SC> SymmetryISOSZ<SC>::recalc_triplet(const DiagInfo<SC> &diag, c
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "isosz/isosz-2ch-tripletp.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {4, 4},
+        {5, 5},
+        {6, 6},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {10, 10},
+        {11, 11},
+        {12, 12},
+        {13, 13},
+        {14, 14},
+        {15, 15},
+        {16, 16}
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(1, -2));
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return 1;
+          case 3: return 1;
+          case 4: return 1;
+          case 5: return 1;
+          case 6: return 1;
+          case 7: return 1;
+          case 8: return 1;
+          case 9: return 1;
+          case 10: return 1;
+          case 11: return 1;
+          case 12: return 1;
+          case 13: return 1;
+          case 14: return 1;
+          case 15: return 1;
+          default: my_assert_not_reached();
+        }
+      };
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(1, -2));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -424,10 +770,22 @@ MatrixElements<SC> SymmetryISOSZ<SC>::recalc_triplet(const DiagInfo<SC> &diag, c
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "isosz/isosz-1ch-tripletm.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {4, 4}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return 1;
+          case 3: return 1;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(1, +2));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(1, +2));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -437,10 +795,46 @@ MatrixElements<SC> SymmetryISOSZ<SC>::recalc_triplet(const DiagInfo<SC> &diag, c
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "isosz/isosz-2ch-tripletm.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {4, 4},
+        {5, 5},
+        {6, 6},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {10, 10},
+        {11, 11},
+        {12, 12},
+        {13, 13},
+        {14, 14},
+        {15, 15},
+        {16, 16}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return 1;
+          case 3: return 1;
+          case 4: return 1;
+          case 5: return 1;
+          case 6: return 1;
+          case 7: return 1;
+          case 8: return 1;
+          case 9: return 1;
+          case 10: return 1;
+          case 11: return 1;
+          case 12: return 1;
+          case 13: return 1;
+          case 14: return 1;
+          case 15: return 1;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(1, +2));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(1, +2));
       if (cn) cnew[II] = *cn;
     }
   }
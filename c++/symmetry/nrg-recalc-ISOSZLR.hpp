@@ -261,6 +261,7 @@ Opch<SC> SymmetryISOSZLR<SC>::recalc_irreduc(const Step &step, const DiagInfo<SC
 template<typename SC>
 MatrixElements<SC> SymmetryISOSZLR<SC>::recalc_doublet(const DiagInfo<SC> &diag, const SubspaceStructure &substruct, const MatrixElements<SC> &cold) const {
   MatrixElements<SC> cnew;
+  const auto blocks = std::make_shared<const BlockIndex<SC>>(cold, substruct);
   for(const auto &[I1, eig]: diag) {
     int ii1   = I1.get("II");
     int ssz1 = I1.get("SSZ");
@@ -273,10 +274,58 @@ MatrixElements<SC> SymmetryISOSZLR<SC>::recalc_doublet(const DiagInfo<SC> &diag,
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "isoszlr/isoszlr-2ch-doubletmp.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {4, 4},
+        {5, 5},
+        {6, 6},
+        {6, 7},
+        {7, 7},
+        {8, 8},
+        {8, 9},
+        {9, 9},
+        {10, 10},
+        {10, 11},
+        {11, 11},
+        {12, 12},
+        {12, 13},
+        {13, 13},
+        {14, 14},
+        {14, 15},
+        {15, 15},
+        {15, 16},
+        {16, 16}
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(2, -1, +1));
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return 1;
+          case 3: return 1;
+          case 4: return 1;
+          case 5: return -1;
+          case 6: return 1/(-1 - 2*ISO(ii1));
+          case 7: return (-2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1));
+          case 8: return -1;
+          case 9: return 1/(-1 - 2*ISO(ii1));
+          case 10: return (-2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1));
+          case 11: return -1;
+          case 12: return 1/(-1 - 2*ISO(ii1));
+          case 13: return (-2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1));
+          case 14: return -1;
+          case 15: return 1/(-1 - 2*ISO(ii1));
+          case 16: return (-2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1));
+          case 17: return 1;
+          case 18: return 1/sqrt(ISO(ii1)*(1 + 2*ISO(ii1)));
+          case 19: return (-1 + ISO(ii1) + 2*Power(ISO(ii1),2))/sqrt(ISO(ii1)*(1 + ISO(ii1))*(-1 + 4*Power(ISO(ii1),2)));
+          case 20: return 1/sqrt((1 + ISO(ii1))*(1 + 2*ISO(ii1)));
+          case 21: return sqrt(1 + 1/(1 + ISO(ii1)) - 2/(1 + 2*ISO(ii1)));
+          default: my_assert_not_reached();
+        }
+      };
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(2, -1, +1));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -288,10 +337,58 @@ MatrixElements<SC> SymmetryISOSZLR<SC>::recalc_doublet(const DiagInfo<SC> &diag,
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "isoszlr/isoszlr-2ch-doubletmm.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {4, 4},
+        {5, 5},
+        {6, 6},
+        {6, 7},
+        {7, 7},
+        {8, 8},
+        {8, 9},
+        {9, 9},
+        {10, 10},
+        {10, 11},
+        {11, 11},
+        {12, 12},
+        {12, 13},
+        {13, 13},
+        {14, 14},
+        {14, 15},
+        {15, 15},
+        {15, 16},
+        {16, 16}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return 1;
+          case 3: return 1;
+          case 4: return 1;
+          case 5: return -1;
+          case 6: return 1/(-1 - 2*ISO(ii1));
+          case 7: return (-2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1));
+          case 8: return -1;
+          case 9: return 1/(-1 - 2*ISO(ii1));
+          case 10: return (-2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1));
+          case 11: return -1;
+          case 12: return 1/(-1 - 2*ISO(ii1));
+          case 13: return (-2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1));
+          case 14: return -1;
+          case 15: return 1/(-1 - 2*ISO(ii1));
+          case 16: return (-2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1));
+          case 17: return 1;
+          case 18: return 1/sqrt(ISO(ii1)*(1 + 2*ISO(ii1)));
+          case 19: return (-1 + ISO(ii1) + 2*Power(ISO(ii1),2))/sqrt(ISO(ii1)*(1 + ISO(ii1))*(-1 + 4*Power(ISO(ii1),2)));
+          case 20: return 1/sqrt((1 + ISO(ii1))*(1 + 2*ISO(ii1)));
+          case 21: return sqrt(1 + 1/(1 + ISO(ii1)) - 2/(1 + 2*ISO(ii1)));
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(2, +1, +1));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(2, +1, +1));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -303,10 +400,58 @@ MatrixElements<SC> SymmetryISOSZLR<SC>::recalc_doublet(const DiagInfo<SC> &diag,
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "isoszlr/isoszlr-2ch-doubletpp.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {4, 4},
+        {5, 5},
+        {6, 6},
+        {7, 6},
+        {7, 7},
+        {8, 8},
+        {9, 8},
+        {9, 9},
+        {10, 10},
+        {11, 10},
+        {11, 11},
+        {12, 12},
+        {13, 12},
+        {13, 13},
+        {14, 14},
+        {15, 14},
+        {15, 15},
+        {16, 15},
+        {16, 16}
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(2, -1, +1));
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return 1;
+          case 3: return 1;
+          case 4: return 1;
+          case 5: return (-2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1));
+          case 6: return 1/(1 + 2*ISO(ii1));
+          case 7: return -1;
+          case 8: return (-2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1));
+          case 9: return 1/(1 + 2*ISO(ii1));
+          case 10: return -1;
+          case 11: return (-2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1));
+          case 12: return 1/(1 + 2*ISO(ii1));
+          case 13: return -1;
+          case 14: return (-2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1));
+          case 15: return 1/(1 + 2*ISO(ii1));
+          case 16: return -1;
+          case 17: return 1/sqrt((ISO(ii1)*(1 + 2*ISO(ii1)))/(-1 + ISO(ii1) + 2*Power(ISO(ii1),2)));
+          case 18: return -(1/sqrt(ISO(ii1)*(1 + 2*ISO(ii1))));
+          case 19: return (ISO(ii1)*(3 + 2*ISO(ii1)))/sqrt(ISO(ii1)*(1 + ISO(ii1))*(3 + 4*ISO(ii1)*(2 + ISO(ii1))));
+          case 20: return -(1/sqrt((1 + ISO(ii1))*(1 + 2*ISO(ii1))));
+          case 21: return 1;
+          default: my_assert_not_reached();
+        }
+      };
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(2, -1, +1));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -318,10 +463,58 @@ MatrixElements<SC> SymmetryISOSZLR<SC>::recalc_doublet(const DiagInfo<SC> &diag,
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "isoszlr/isoszlr-2ch-doubletpm.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {4, 4},
+        {5, 5},
+        {6, 6},
+        {7, 6},
+        {7, 7},
+        {8, 8},
+        {9, 8},
+        {9, 9},
+        {10, 10},
+        {11, 10},
+        {11, 11},
+        {12, 12},
+        {13, 12},
+        {13, 13},
+        {14, 14},
+        {15, 14},
+        {15, 15},
+        {16, 15},
+        {16, 16}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return 1;
+          case 3: return 1;
+          case 4: return 1;
+          case 5: return (-2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1));
+          case 6: return 1/(1 + 2*ISO(ii1));
+          case 7: return -1;
+          case 8: return (-2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1));
+          case 9: return 1/(1 + 2*ISO(ii1));
+          case 10: return -1;
+          case 11: return (-2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1));
+          case 12: return 1/(1 + 2*ISO(ii1));
+          case 13: return -1;
+          case 14: return (-2*sqrt(ISO(ii1)*(1 + ISO(ii1))))/(1 + 2*ISO(ii1));
+          case 15: return 1/(1 + 2*ISO(ii1));
+          case 16: return -1;
+          case 17: return 1/sqrt((ISO(ii1)*(1 + 2*ISO(ii1)))/(-1 + ISO(ii1) + 2*Power(ISO(ii1),2)));
+          case 18: return -(1/sqrt(ISO(ii1)*(1 + 2*ISO(ii1))));
+          case 19: return (ISO(ii1)*(3 + 2*ISO(ii1)))/sqrt(ISO(ii1)*(1 + ISO(ii1))*(3 + 4*ISO(ii1)*(2 + ISO(ii1))));
+          case 20: return -(1/sqrt((1 + ISO(ii1))*(1 + 2*ISO(ii1))));
+          case 21: return 1;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(2, +1, +1));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(2, +1, +1));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -334,6 +527,7 @@ MatrixElements<SC> SymmetryISOSZLR<SC>::recalc_doublet(const DiagInfo<SC> &diag,
 template<typename SC>
 MatrixElements<SC> SymmetryISOSZLR<SC>::recalc_triplet(const DiagInfo<SC> &diag, const SubspaceStructure &substruct, const MatrixElements<SC> &cold) const {
   MatrixElements<SC> cnew;
+  const auto blocks = std::make_shared<const BlockIndex<SC>>(cold, substruct);
   for(const auto &[I1, eig]: diag) {
     int ii1   = I1.get("II");
     int ssz1 = I1.get("SSZ");
@@ -346,10 +540,46 @@ MatrixElements<SC> SymmetryISOSZLR<SC>::recalc_triplet(const DiagInfo<SC> &diag,
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "isoszlr/isoszlr-2ch-triplets.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {4, 4},
+        {5, 5},
+        {6, 6},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {10, 10},
+        {11, 11},
+        {12, 12},
+        {13, 13},
+        {14, 14},
+        {15, 15},
+        {16, 16}
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(1, 0, +1));
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return 1;
+          case 3: return 1;
+          case 4: return 1;
+          case 5: return 1;
+          case 6: return 1;
+          case 7: return 1;
+          case 8: return 1;
+          case 9: return 1;
+          case 10: return 1;
+          case 11: return 1;
+          case 12: return 1;
+          case 13: return 1;
+          case 14: return 1;
+          case 15: return 1;
+          default: my_assert_not_reached();
+        }
+      };
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(1, 0, +1));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -361,10 +591,46 @@ MatrixElements<SC> SymmetryISOSZLR<SC>::recalc_triplet(const DiagInfo<SC> &diag,
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "isoszlr/isoszlr-2ch-tripletp.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {4, 4},
+        {5, 5},
+        {6, 6},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {10, 10},
+        {11, 11},
+        {12, 12},
+        {13, 13},
+        {14, 14},
+        {15, 15},
+        {16, 16}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return 1;
+          case 3: return 1;
+          case 4: return 1;
+          case 5: return 1;
+          case 6: return 1;
+          case 7: return 1;
+          case 8: return 1;
+          case 9: return 1;
+          case 10: return 1;
+          case 11: return 1;
+          case 12: return 1;
+          case 13: return 1;
+          case 14: return 1;
+          case 15: return 1;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(1, -2, +1));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(1, -2, +1));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -376,10 +642,46 @@ MatrixElements<SC> SymmetryISOSZLR<SC>::recalc_triplet(const DiagInfo<SC> &diag,
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "isoszlr/isoszlr-2ch-tripletm.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {4, 4},
+        {5, 5},
+        {6, 6},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {10, 10},
+        {11, 11},
+        {12, 12},
+        {13, 13},
+        {14, 14},
+        {15, 15},
+        {16, 16}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return 1;
+          case 3: return 1;
+          case 4: return 1;
+          case 5: return 1;
+          case 6: return 1;
+          case 7: return 1;
+          case 8: return 1;
+          case 9: return 1;
+          case 10: return 1;
+          case 11: return 1;
+          case 12: return 1;
+          case 13: return 1;
+          case 14: return 1;
+          case 15: return 1;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(1, +2, +1));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(1, +2, +1));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -32,6 +32,7 @@ namespace NRG {
 template<typename SC>
 MatrixElements<SC> SymmetryQJ<SC>::recalc_doublet(const DiagInfo<SC> &diag, const SubspaceStructure &substruct, const MatrixElements<SC> &cold) const {
   MatrixElements<SC> cnew;
+  const auto blocks = std::make_shared<const BlockIndex<SC>>(cold, substruct);
   for(const auto &[I1, eig]: diag) {
     int q1 = I1.get("Q");
     int jj1 = I1.get("JJ");
@@ -43,10 +44,228 @@ MatrixElements<SC> SymmetryQJ<SC>::recalc_doublet(const DiagInfo<SC> &diag, cons
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "qj/qj-doubletp.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 2},
+        {3, 3},
+        {4, 4},
+        {5, 4},
+        {5, 5},
+        {6, 5},
+        {6, 6},
+        {7, 6},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {10, 10},
+        {11, 10},
+        {11, 11},
+        {12, 11},
+        {12, 12},
+        {13, 13},
+        {14, 13},
+        {14, 14},
+        {15, 14},
+        {15, 15},
+        {16, 15},
+        {16, 16},
+        {17, 16},
+        {17, 17},
+        {18, 18},
+        {19, 18},
+        {19, 19},
+        {20, 19},
+        {20, 20},
+        {21, 20},
+        {21, 21},
+        {22, 21},
+        {22, 22},
+        {23, 23},
+        {24, 23},
+        {24, 24},
+        {25, 25},
+        {26, 25},
+        {26, 26},
+        {27, 26},
+        {27, 27},
+        {28, 27},
+        {28, 28},
+        {29, 29},
+        {30, 29},
+        {30, 30},
+        {31, 30},
+        {31, 31},
+        {32, 31},
+        {32, 32},
+        {33, 33},
+        {34, 33},
+        {34, 34},
+        {35, 34},
+        {35, 35},
+        {36, 35},
+        {36, 36},
+        {37, 37},
+        {38, 37},
+        {38, 38},
+        {39, 38},
+        {39, 39},
+        {40, 39},
+        {40, 40},
+        {41, 40},
+        {41, 41},
+        {42, 41},
+        {42, 42},
+        {43, 43},
+        {44, 44},
+        {45, 45},
+        {46, 45},
+        {46, 46},
+        {47, 46},
+        {47, 47},
+        {48, 48},
+        {49, 48},
+        {49, 49},
+        {50, 49},
+        {50, 50},
+        {51, 50},
+        {51, 51},
+        {52, 51},
+        {52, 52},
+        {53, 53},
+        {54, 53},
+        {54, 54},
+        {55, 54},
+        {55, 55},
+        {56, 55},
+        {56, 56},
+        {57, 56},
+        {57, 57},
+        {58, 58},
+        {59, 58},
+        {59, 59},
+        {60, 60},
+        {61, 60},
+        {61, 61},
+        {62, 61},
+        {62, 62},
+        {63, 62},
+        {63, 63},
+        {64, 64}
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(1, 2));
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return (-2*sqrt(J(jj1)*(1 + J(jj1))))/(1 + 2*J(jj1));
+          case 2: return 1/(1 + 2*J(jj1));
+          case 3: return -1;
+          case 4: return -2*sqrt((-1 + Power(J(jj1),2))/(-1 + 4*Power(J(jj1),2)));
+          case 5: return sqrt(3)/sqrt(-1 + 4*Power(J(jj1),2));
+          case 6: return -(sqrt(-3 + 4*J(jj1) + 4*Power(J(jj1),2))/(1 + 2*J(jj1)));
+          case 7: return 2/(1 + 2*J(jj1));
+          case 8: return (J(jj1)*sqrt((4 + 4*J(jj1))/(J(jj1) + 2*Power(J(jj1),2)))*(sqrt((2 + 3*J(jj1) + Power(J(jj1),2))/(3 + 2*J(jj1)))*(3 + 8*J(jj1) + 4*Power(J(jj1),2)) - J(jj1)*sqrt((2 + 3*J(jj1) + Power(J(jj1),2))/(3 + 2*J(jj1)))*(3 + 8*J(jj1) + 4*Power(J(jj1),2)) - 7*sqrt(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3)) - 8*J(jj1)*sqrt(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3))))/(Power(3 + 2*J(jj1),2)*(2 + 3*J(jj1) + Power(J(jj1),2)));
+          case 9: return sqrt(3)/sqrt(3 + 8*J(jj1) + 4*Power(J(jj1),2));
+          case 10: return -1;
+          case 11: return 1;
+          case 12: return 1;
+          case 13: return sqrt((-1 + J(jj1) + 2*Power(J(jj1),2))/(J(jj1)*(1 + 2*J(jj1))));
+          case 14: return -(1/sqrt(J(jj1)*(1 + 2*J(jj1))));
+          case 15: return (3 + 2*J(jj1))/sqrt((1 + 1/J(jj1))*(3 + 8*J(jj1) + 4*Power(J(jj1),2)));
+          case 16: return -(1/sqrt(1 + 3*J(jj1) + 2*Power(J(jj1),2)));
+          case 17: return 1;
+          case 18: return sqrt((3 + J(jj1) - 2*Power(J(jj1),2))/(1 + J(jj1) - 2*Power(J(jj1),2)));
+          case 19: return -(sqrt(2)/sqrt(-1 - J(jj1) + 2*Power(J(jj1),2)));
+          case 20: return (-3*sqrt(1 + 1/J(jj1)) + sqrt(J(jj1)*(1 + J(jj1))) + 2*sqrt(Power(J(jj1),3)*(1 + J(jj1))))/sqrt(-3 - 8*J(jj1) - Power(J(jj1),2) + 8*Power(J(jj1),3) + 4*Power(J(jj1),4));
+          case 21: return -(sqrt(3)/sqrt(J(jj1)*(1 + 2*J(jj1))));
+          case 22: return ((-1 + 2*J(jj1))*sqrt((2 + 5*J(jj1) + 2*Power(J(jj1),2))/(-1 + J(jj1) + 2*Power(J(jj1),2))))/(1 + 2*J(jj1));
+          case 23: return -((sqrt(3 + 3/J(jj1))*(6*sqrt(J(jj1)*(6 + 19*J(jj1) + 16*Power(J(jj1),2) + 4*Power(J(jj1),3))) + 7*sqrt(Power(J(jj1),3)*(6 + 19*J(jj1) + 16*Power(J(jj1),2) + 4*Power(J(jj1),3))) + 2*sqrt(Power(J(jj1),5)*(6 + 19*J(jj1) + 16*Power(J(jj1),2) + 4*Power(J(jj1),3)))))/((1 + 3*J(jj1) + 2*Power(J(jj1),2))*Power(6 + 7*J(jj1) + 2*Power(J(jj1),2),1.5)));
+          case 24: return sqrt(1 + J(jj1))*((-3 + 2*J(jj1))/sqrt((Power(2 + J(jj1),3)*Power(3 + 2*J(jj1),2)*(5 + 2*J(jj1)))/(J(jj1)*(1 + 3*J(jj1) + 2*Power(J(jj1),2)))) + (6*J(jj1)*(-1 + 2*J(jj1)))/sqrt((J(jj1)*Power(2 + J(jj1),3)*Power(3 + 2*J(jj1),2)*(5 + 7*J(jj1) + 2*Power(J(jj1),2)))/(1 + 2*J(jj1))) + (48*sqrt(J(jj1)/(10 + 39*J(jj1) + 49*Power(J(jj1),2) + 24*Power(J(jj1),3) + 4*Power(J(jj1),4))))/(6 + 7*J(jj1) + 2*Power(J(jj1),2)) + (9*J(jj1)*(-1 + 6*J(jj1)))/((6 + 7*J(jj1) + 2*Power(J(jj1),2))*sqrt(J(jj1)*(10 + 39*J(jj1) + 49*Power(J(jj1),2) + 24*Power(J(jj1),3) + 4*Power(J(jj1),4)))));
+          case 25: return sqrt(2)*sqrt(1 + J(jj1))*(-2*sqrt(((1 + J(jj1))*(1 + 2*J(jj1)))/((2 + J(jj1))*Power(5 + 2*J(jj1),2))) + (-3 + 2*J(jj1))*sqrt((1 + 3*J(jj1) + 2*Power(J(jj1),2))/(Power(2 + J(jj1),3)*Power(5 + 2*J(jj1),2))) + 6*(-1 + 2*J(jj1))*sqrt(((1 + J(jj1))*(1 + 2*J(jj1)))/(Power(2 + J(jj1),3)*Power(15 + 16*J(jj1) + 4*Power(J(jj1),2),2))) + (3*(1 + 2*J(jj1))*(-1 + 6*J(jj1)))/((2 + J(jj1))*(15 + 16*J(jj1) + 4*Power(J(jj1),2))*sqrt(2 + 7*J(jj1) + 7*Power(J(jj1),2) + 2*Power(J(jj1),3))) + (24*J(jj1))/(sqrt(2 + 7*J(jj1) + 7*Power(J(jj1),2) + 2*Power(J(jj1),3))*(30 + 47*J(jj1) + 24*Power(J(jj1),2) + 4*Power(J(jj1),3))));
+          case 26: return 1;
+          case 27: return sqrt((3 + J(jj1) - 2*Power(J(jj1),2))/(1 + J(jj1) - 2*Power(J(jj1),2)));
+          case 28: return -(sqrt(2)/sqrt(-1 - J(jj1) + 2*Power(J(jj1),2)));
+          case 29: return (-3*sqrt(1 + 1/J(jj1)) + sqrt(J(jj1)*(1 + J(jj1))) + 2*sqrt(Power(J(jj1),3)*(1 + J(jj1))))/sqrt(-3 - 8*J(jj1) - Power(J(jj1),2) + 8*Power(J(jj1),3) + 4*Power(J(jj1),4));
+          case 30: return -(sqrt(3)/sqrt(J(jj1)*(1 + 2*J(jj1))));
+          case 31: return ((-1 + 2*J(jj1))*sqrt((2 + 5*J(jj1) + 2*Power(J(jj1),2))/(-1 + J(jj1) + 2*Power(J(jj1),2))))/(1 + 2*J(jj1));
+          case 32: return -((sqrt(3 + 3/J(jj1))*(6*sqrt(J(jj1)*(6 + 19*J(jj1) + 16*Power(J(jj1),2) + 4*Power(J(jj1),3))) + 7*sqrt(Power(J(jj1),3)*(6 + 19*J(jj1) + 16*Power(J(jj1),2) + 4*Power(J(jj1),3))) + 2*sqrt(Power(J(jj1),5)*(6 + 19*J(jj1) + 16*Power(J(jj1),2) + 4*Power(J(jj1),3)))))/((1 + 3*J(jj1) + 2*Power(J(jj1),2))*Power(6 + 7*J(jj1) + 2*Power(J(jj1),2),1.5)));
+          case 33: return sqrt(1 + J(jj1))*((-3 + 2*J(jj1))/sqrt((Power(2 + J(jj1),3)*Power(3 + 2*J(jj1),2)*(5 + 2*J(jj1)))/(J(jj1)*(1 + 3*J(jj1) + 2*Power(J(jj1),2)))) + (6*J(jj1)*(-1 + 2*J(jj1)))/sqrt((J(jj1)*Power(2 + J(jj1),3)*Power(3 + 2*J(jj1),2)*(5 + 7*J(jj1) + 2*Power(J(jj1),2)))/(1 + 2*J(jj1))) + (48*sqrt(J(jj1)/(10 + 39*J(jj1) + 49*Power(J(jj1),2) + 24*Power(J(jj1),3) + 4*Power(J(jj1),4))))/(6 + 7*J(jj1) + 2*Power(J(jj1),2)) + (9*J(jj1)*(-1 + 6*J(jj1)))/((6 + 7*J(jj1) + 2*Power(J(jj1),2))*sqrt(J(jj1)*(10 + 39*J(jj1) + 49*Power(J(jj1),2) + 24*Power(J(jj1),3) + 4*Power(J(jj1),4)))));
+          case 34: return sqrt(2)*sqrt(1 + J(jj1))*(-2*sqrt(((1 + J(jj1))*(1 + 2*J(jj1)))/((2 + J(jj1))*Power(5 + 2*J(jj1),2))) + (-3 + 2*J(jj1))*sqrt((1 + 3*J(jj1) + 2*Power(J(jj1),2))/(Power(2 + J(jj1),3)*Power(5 + 2*J(jj1),2))) + 6*(-1 + 2*J(jj1))*sqrt(((1 + J(jj1))*(1 + 2*J(jj1)))/(Power(2 + J(jj1),3)*Power(15 + 16*J(jj1) + 4*Power(J(jj1),2),2))) + (3*(1 + 2*J(jj1))*(-1 + 6*J(jj1)))/((2 + J(jj1))*(15 + 16*J(jj1) + 4*Power(J(jj1),2))*sqrt(2 + 7*J(jj1) + 7*Power(J(jj1),2) + 2*Power(J(jj1),3))) + (24*J(jj1))/(sqrt(2 + 7*J(jj1) + 7*Power(J(jj1),2) + 2*Power(J(jj1),3))*(30 + 47*J(jj1) + 24*Power(J(jj1),2) + 4*Power(J(jj1),3))));
+          case 35: return 1;
+          case 36: return (-2*sqrt(J(jj1)*(1 + J(jj1))))/(1 + 2*J(jj1));
+          case 37: return 1/(1 + 2*J(jj1));
+          case 38: return -1;
+          case 39: return -2*sqrt((-1 + Power(J(jj1),2))/(-1 + 4*Power(J(jj1),2)));
+          case 40: return sqrt(3)/sqrt(-1 + 4*Power(J(jj1),2));
+          case 41: return -(sqrt(-3 + 4*J(jj1) + 4*Power(J(jj1),2))/(1 + 2*J(jj1)));
+          case 42: return 2/(1 + 2*J(jj1));
+          case 43: return (J(jj1)*sqrt((4 + 4*J(jj1))/(J(jj1) + 2*Power(J(jj1),2)))*(sqrt((2 + 3*J(jj1) + Power(J(jj1),2))/(3 + 2*J(jj1)))*(3 + 8*J(jj1) + 4*Power(J(jj1),2)) - J(jj1)*sqrt((2 + 3*J(jj1) + Power(J(jj1),2))/(3 + 2*J(jj1)))*(3 + 8*J(jj1) + 4*Power(J(jj1),2)) - 7*sqrt(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3)) - 8*J(jj1)*sqrt(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3))))/(Power(3 + 2*J(jj1),2)*(2 + 3*J(jj1) + Power(J(jj1),2)));
+          case 44: return sqrt(3)/sqrt(3 + 8*J(jj1) + 4*Power(J(jj1),2));
+          case 45: return -1;
+          case 46: return -2*sqrt((-1 + Power(J(jj1),2))/(-1 + 4*Power(J(jj1),2)));
+          case 47: return sqrt(3)/sqrt(-1 + 4*Power(J(jj1),2));
+          case 48: return -(sqrt(-3 + 4*J(jj1) + 4*Power(J(jj1),2))/(1 + 2*J(jj1)));
+          case 49: return 2/(1 + 2*J(jj1));
+          case 50: return (J(jj1)*sqrt((4 + 4*J(jj1))/(J(jj1) + 2*Power(J(jj1),2)))*(sqrt((2 + 3*J(jj1) + Power(J(jj1),2))/(3 + 2*J(jj1)))*(3 + 8*J(jj1) + 4*Power(J(jj1),2)) - J(jj1)*sqrt((2 + 3*J(jj1) + Power(J(jj1),2))/(3 + 2*J(jj1)))*(3 + 8*J(jj1) + 4*Power(J(jj1),2)) - 7*sqrt(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3)) - 8*J(jj1)*sqrt(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3))))/(Power(3 + 2*J(jj1),2)*(2 + 3*J(jj1) + Power(J(jj1),2)));
+          case 51: return sqrt(3)/sqrt(3 + 8*J(jj1) + 4*Power(J(jj1),2));
+          case 52: return -1;
+          case 53: return -2*sqrt((-1 + Power(J(jj1),2))/(-1 + 4*Power(J(jj1),2)));
+          case 54: return sqrt(3)/sqrt(-1 + 4*Power(J(jj1),2));
+          case 55: return -(sqrt(-3 + 4*J(jj1) + 4*Power(J(jj1),2))/(1 + 2*J(jj1)));
+          case 56: return 2/(1 + 2*J(jj1));
+          case 57: return (J(jj1)*sqrt((4 + 4*J(jj1))/(J(jj1) + 2*Power(J(jj1),2)))*(sqrt((2 + 3*J(jj1) + Power(J(jj1),2))/(3 + 2*J(jj1)))*(3 + 8*J(jj1) + 4*Power(J(jj1),2)) - J(jj1)*sqrt((2 + 3*J(jj1) + Power(J(jj1),2))/(3 + 2*J(jj1)))*(3 + 8*J(jj1) + 4*Power(J(jj1),2)) - 7*sqrt(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3)) - 8*J(jj1)*sqrt(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3))))/(Power(3 + 2*J(jj1),2)*(2 + 3*J(jj1) + Power(J(jj1),2)));
+          case 58: return sqrt(3)/sqrt(3 + 8*J(jj1) + 4*Power(J(jj1),2));
+          case 59: return -1;
+          case 60: return -2*sqrt(((-2 + J(jj1))*(1 + J(jj1)))/(-3 - 4*J(jj1) + 4*Power(J(jj1),2)));
+          case 61: return sqrt(5)/sqrt(-3 - 4*J(jj1) + 4*Power(J(jj1),2));
+          case 62: return (9 - 4*Power(J(jj1),2))/sqrt(9 - 40*Power(J(jj1),2) + 16*Power(J(jj1),4));
+          case 63: return (2*sqrt(2))/sqrt(-1 + 4*Power(J(jj1),2));
+          case 64: return (-2*sqrt(-2 + J(jj1) + Power(J(jj1),2)))/(1 + 2*J(jj1));
+          case 65: return 3/(1 + 2*J(jj1));
+          case 66: return -((sqrt(1 + J(jj1))*(120*sqrt((-2 + 4*J(jj1))/((1 + J(jj1))*Power(2 + J(jj1),2)*Power(3 + 2*J(jj1),3)*(5 + 12*J(jj1) + 4*Power(J(jj1),2)))) + (J(jj1)*(-7 + 2*J(jj1))*(-1 + 2*J(jj1))*sqrt((2 + 4*J(jj1))/((3 + 2*J(jj1))*(-5 + 3*J(jj1) + 12*Power(J(jj1),2) + 4*Power(J(jj1),3)))))/(6 + 7*J(jj1) + 2*Power(J(jj1),2)) + (18*sqrt(2)*J(jj1)*(-3 + 2*J(jj1))*(-1 + 2*J(jj1)))/((6 + 7*J(jj1) + 2*Power(J(jj1),2))*sqrt((3 + 2*J(jj1))*(-5 - 7*J(jj1) + 18*Power(J(jj1),2) + 28*Power(J(jj1),3) + 8*Power(J(jj1),4)))) + (18*sqrt(2)*(-1 + 2*J(jj1))*(-5 + 6*J(jj1)))/((6 + 7*J(jj1) + 2*Power(J(jj1),2))*sqrt((3 + 2*J(jj1))*(-5 - 7*J(jj1) + 18*Power(J(jj1),2) + 28*Power(J(jj1),3) + 8*Power(J(jj1),4))))))/sqrt(2));
+          case 67: return (2*sqrt(2))/sqrt(3 + 8*J(jj1) + 4*Power(J(jj1),2));
+          case 68: return -2*sqrt(1 + J(jj1))*((-2 + J(jj1))/sqrt((Power(2 + J(jj1),2)*(3 + J(jj1))*Power(5 + 2*J(jj1),3))/(J(jj1)*(1 + 3*J(jj1) + 2*Power(J(jj1),2)))) + (150*sqrt(J(jj1)/((3 + 7*J(jj1) + 2*Power(J(jj1),2))*(5 + 7*J(jj1) + 2*Power(J(jj1),2))*Power(6 + 7*J(jj1) + 2*Power(J(jj1),2),2))))/(5 + 2*J(jj1)) + (18*J(jj1)*(-1 + 3*J(jj1)))/sqrt((J(jj1)*(1 + J(jj1))*(3 + J(jj1))*Power(5 + 2*J(jj1),3)*Power(6 + 7*J(jj1) + 2*Power(J(jj1),2),2))/(1 + 2*J(jj1))) + (4*J(jj1)*(-3 + 4*J(jj1)))/sqrt((J(jj1)*(3 + J(jj1))*Power(5 + 2*J(jj1),3)*Power(6 + 7*J(jj1) + 2*Power(J(jj1),2),2))/(1 + 3*J(jj1) + 2*Power(J(jj1),2))) + (24*J(jj1)*(-1 + 8*J(jj1)))/(sqrt(J(jj1)*(5 + 2*J(jj1))*(3 + 10*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3)))*(30 + 47*J(jj1) + 24*Power(J(jj1),2) + 4*Power(J(jj1),3))));
+          case 69: return -(sqrt(5)*sqrt(1 + J(jj1))*(2*(-2 + J(jj1))*sqrt((1 + 3*J(jj1) + 2*Power(J(jj1),2))/(Power(3 + J(jj1),2)*Power(5 + 2*J(jj1),3))) - sqrt((1 + 3*J(jj1) + 2*Power(J(jj1),2))/(5 + 2*J(jj1)))/(3 + J(jj1)) + 2*(-3 + 4*J(jj1))*sqrt((1 + 3*J(jj1) + 2*Power(J(jj1),2))/(Power(5 + 2*J(jj1),3)*Power(6 + 5*J(jj1) + Power(J(jj1),2),2))) + 12*(-1 + 3*J(jj1))*sqrt((1 + 3*J(jj1) + 2*Power(J(jj1),2))/(Power(5 + 2*J(jj1),3)*Power(18 + 27*J(jj1) + 13*Power(J(jj1),2) + 2*Power(J(jj1),3),2))) + (6*(1 + 2*J(jj1))*(-1 + 8*J(jj1)))/((5 + 2*J(jj1))*(18 + 27*J(jj1) + 13*Power(J(jj1),2) + 2*Power(J(jj1),3))*sqrt(5 + 17*J(jj1) + 16*Power(J(jj1),2) + 4*Power(J(jj1),3))) + (60*J(jj1))/(sqrt(5 + 17*J(jj1) + 16*Power(J(jj1),2) + 4*Power(J(jj1),3))*(90 + 171*J(jj1) + 119*Power(J(jj1),2) + 36*Power(J(jj1),3) + 4*Power(J(jj1),4)))));
+          case 70: return -1;
+          case 71: return 1;
+          case 72: return 1;
+          case 73: return sqrt((-1 + J(jj1) + 2*Power(J(jj1),2))/(J(jj1)*(1 + 2*J(jj1))));
+          case 74: return -(1/sqrt(J(jj1)*(1 + 2*J(jj1))));
+          case 75: return (3 + 2*J(jj1))/sqrt((1 + 1/J(jj1))*(3 + 8*J(jj1) + 4*Power(J(jj1),2)));
+          case 76: return -(1/sqrt(1 + 3*J(jj1) + 2*Power(J(jj1),2)));
+          case 77: return 1;
+          case 78: return sqrt((3 + J(jj1) - 2*Power(J(jj1),2))/(1 + J(jj1) - 2*Power(J(jj1),2)));
+          case 79: return -(sqrt(2)/sqrt(-1 - J(jj1) + 2*Power(J(jj1),2)));
+          case 80: return (-3*sqrt(1 + 1/J(jj1)) + sqrt(J(jj1)*(1 + J(jj1))) + 2*sqrt(Power(J(jj1),3)*(1 + J(jj1))))/sqrt(-3 - 8*J(jj1) - Power(J(jj1),2) + 8*Power(J(jj1),3) + 4*Power(J(jj1),4));
+          case 81: return -(sqrt(3)/sqrt(J(jj1)*(1 + 2*J(jj1))));
+          case 82: return ((-1 + 2*J(jj1))*sqrt((2 + 5*J(jj1) + 2*Power(J(jj1),2))/(-1 + J(jj1) + 2*Power(J(jj1),2))))/(1 + 2*J(jj1));
+          case 83: return -((sqrt(3 + 3/J(jj1))*(6*sqrt(J(jj1)*(6 + 19*J(jj1) + 16*Power(J(jj1),2) + 4*Power(J(jj1),3))) + 7*sqrt(Power(J(jj1),3)*(6 + 19*J(jj1) + 16*Power(J(jj1),2) + 4*Power(J(jj1),3))) + 2*sqrt(Power(J(jj1),5)*(6 + 19*J(jj1) + 16*Power(J(jj1),2) + 4*Power(J(jj1),3)))))/((1 + 3*J(jj1) + 2*Power(J(jj1),2))*Power(6 + 7*J(jj1) + 2*Power(J(jj1),2),1.5)));
+          case 84: return sqrt(1 + J(jj1))*((-3 + 2*J(jj1))/sqrt((Power(2 + J(jj1),3)*Power(3 + 2*J(jj1),2)*(5 + 2*J(jj1)))/(J(jj1)*(1 + 3*J(jj1) + 2*Power(J(jj1),2)))) + (6*J(jj1)*(-1 + 2*J(jj1)))/sqrt((J(jj1)*Power(2 + J(jj1),3)*Power(3 + 2*J(jj1),2)*(5 + 7*J(jj1) + 2*Power(J(jj1),2)))/(1 + 2*J(jj1))) + (48*sqrt(J(jj1)/(10 + 39*J(jj1) + 49*Power(J(jj1),2) + 24*Power(J(jj1),3) + 4*Power(J(jj1),4))))/(6 + 7*J(jj1) + 2*Power(J(jj1),2)) + (9*J(jj1)*(-1 + 6*J(jj1)))/((6 + 7*J(jj1) + 2*Power(J(jj1),2))*sqrt(J(jj1)*(10 + 39*J(jj1) + 49*Power(J(jj1),2) + 24*Power(J(jj1),3) + 4*Power(J(jj1),4)))));
+          case 85: return sqrt(2)*sqrt(1 + J(jj1))*(-2*sqrt(((1 + J(jj1))*(1 + 2*J(jj1)))/((2 + J(jj1))*Power(5 + 2*J(jj1),2))) + (-3 + 2*J(jj1))*sqrt((1 + 3*J(jj1) + 2*Power(J(jj1),2))/(Power(2 + J(jj1),3)*Power(5 + 2*J(jj1),2))) + 6*(-1 + 2*J(jj1))*sqrt(((1 + J(jj1))*(1 + 2*J(jj1)))/(Power(2 + J(jj1),3)*Power(15 + 16*J(jj1) + 4*Power(J(jj1),2),2))) + (3*(1 + 2*J(jj1))*(-1 + 6*J(jj1)))/((2 + J(jj1))*(15 + 16*J(jj1) + 4*Power(J(jj1),2))*sqrt(2 + 7*J(jj1) + 7*Power(J(jj1),2) + 2*Power(J(jj1),3))) + (24*J(jj1))/(sqrt(2 + 7*J(jj1) + 7*Power(J(jj1),2) + 2*Power(J(jj1),3))*(30 + 47*J(jj1) + 24*Power(J(jj1),2) + 4*Power(J(jj1),3))));
+          case 86: return 1;
+          case 87: return sqrt((3 + J(jj1) - 2*Power(J(jj1),2))/(1 + J(jj1) - 2*Power(J(jj1),2)));
+          case 88: return -(sqrt(2)/sqrt(-1 - J(jj1) + 2*Power(J(jj1),2)));
+          case 89: return (-3*sqrt(1 + 1/J(jj1)) + sqrt(J(jj1)*(1 + J(jj1))) + 2*sqrt(Power(J(jj1),3)*(1 + J(jj1))))/sqrt(-3 - 8*J(jj1) - Power(J(jj1),2) + 8*Power(J(jj1),3) + 4*Power(J(jj1),4));
+          case 90: return -(sqrt(3)/sqrt(J(jj1)*(1 + 2*J(jj1))));
+          case 91: return ((-1 + 2*J(jj1))*sqrt((2 + 5*J(jj1) + 2*Power(J(jj1),2))/(-1 + J(jj1) + 2*Power(J(jj1),2))))/(1 + 2*J(jj1));
+          case 92: return -((sqrt(3 + 3/J(jj1))*(6*sqrt(J(jj1)*(6 + 19*J(jj1) + 16*Power(J(jj1),2) + 4*Power(J(jj1),3))) + 7*sqrt(Power(J(jj1),3)*(6 + 19*J(jj1) + 16*Power(J(jj1),2) + 4*Power(J(jj1),3))) + 2*sqrt(Power(J(jj1),5)*(6 + 19*J(jj1) + 16*Power(J(jj1),2) + 4*Power(J(jj1),3)))))/((1 + 3*J(jj1) + 2*Power(J(jj1),2))*Power(6 + 7*J(jj1) + 2*Power(J(jj1),2),1.5)));
+          case 93: return sqrt(1 + J(jj1))*((-3 + 2*J(jj1))/sqrt((Power(2 + J(jj1),3)*Power(3 + 2*J(jj1),2)*(5 + 2*J(jj1)))/(J(jj1)*(1 + 3*J(jj1) + 2*Power(J(jj1),2)))) + (6*J(jj1)*(-1 + 2*J(jj1)))/sqrt((J(jj1)*Power(2 + J(jj1),3)*Power(3 + 2*J(jj1),2)*(5 + 7*J(jj1) + 2*Power(J(jj1),2)))/(1 + 2*J(jj1))) + (48*sqrt(J(jj1)/(10 + 39*J(jj1) + 49*Power(J(jj1),2) + 24*Power(J(jj1),3) + 4*Power(J(jj1),4))))/(6 + 7*J(jj1) + 2*Power(J(jj1),2)) + (9*J(jj1)*(-1 + 6*J(jj1)))/((6 + 7*J(jj1) + 2*Power(J(jj1),2))*sqrt(J(jj1)*(10 + 39*J(jj1) + 49*Power(J(jj1),2) + 24*Power(J(jj1),3) + 4*Power(J(jj1),4)))));
+          case 94: return sqrt(2)*sqrt(1 + J(jj1))*(-2*sqrt(((1 + J(jj1))*(1 + 2*J(jj1)))/((2 + J(jj1))*Power(5 + 2*J(jj1),2))) + (-3 + 2*J(jj1))*sqrt((1 + 3*J(jj1) + 2*Power(J(jj1),2))/(Power(2 + J(jj1),3)*Power(5 + 2*J(jj1),2))) + 6*(-1 + 2*J(jj1))*sqrt(((1 + J(jj1))*(1 + 2*J(jj1)))/(Power(2 + J(jj1),3)*Power(15 + 16*J(jj1) + 4*Power(J(jj1),2),2))) + (3*(1 + 2*J(jj1))*(-1 + 6*J(jj1)))/((2 + J(jj1))*(15 + 16*J(jj1) + 4*Power(J(jj1),2))*sqrt(2 + 7*J(jj1) + 7*Power(J(jj1),2) + 2*Power(J(jj1),3))) + (24*J(jj1))/(sqrt(2 + 7*J(jj1) + 7*Power(J(jj1),2) + 2*Power(J(jj1),3))*(30 + 47*J(jj1) + 24*Power(J(jj1),2) + 4*Power(J(jj1),3))));
+          case 95: return 1;
+          case 96: return (-2*sqrt(J(jj1)*(1 + J(jj1))))/(1 + 2*J(jj1));
+          case 97: return 1/(1 + 2*J(jj1));
+          case 98: return -1;
+          case 99: return -2*sqrt((-1 + Power(J(jj1),2))/(-1 + 4*Power(J(jj1),2)));
+          case 100: return sqrt(3)/sqrt(-1 + 4*Power(J(jj1),2));
+          case 101: return -(sqrt(-3 + 4*J(jj1) + 4*Power(J(jj1),2))/(1 + 2*J(jj1)));
+          case 102: return 2/(1 + 2*J(jj1));
+          case 103: return (J(jj1)*sqrt((4 + 4*J(jj1))/(J(jj1) + 2*Power(J(jj1),2)))*(sqrt((2 + 3*J(jj1) + Power(J(jj1),2))/(3 + 2*J(jj1)))*(3 + 8*J(jj1) + 4*Power(J(jj1),2)) - J(jj1)*sqrt((2 + 3*J(jj1) + Power(J(jj1),2))/(3 + 2*J(jj1)))*(3 + 8*J(jj1) + 4*Power(J(jj1),2)) - 7*sqrt(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3)) - 8*J(jj1)*sqrt(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3))))/(Power(3 + 2*J(jj1),2)*(2 + 3*J(jj1) + Power(J(jj1),2)));
+          case 104: return sqrt(3)/sqrt(3 + 8*J(jj1) + 4*Power(J(jj1),2));
+          case 105: return -1;
+          case 106: return 1;
+          default: my_assert_not_reached();
+        }
+      };
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(1, 2));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -58,10 +277,228 @@ MatrixElements<SC> SymmetryQJ<SC>::recalc_doublet(const DiagInfo<SC> &diag, cons
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "qj/qj-doubletm.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {2, 3},
+        {3, 3},
+        {4, 4},
+        {4, 5},
+        {5, 5},
+        {5, 6},
+        {6, 6},
+        {6, 7},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {10, 10},
+        {10, 11},
+        {11, 11},
+        {11, 12},
+        {12, 12},
+        {13, 13},
+        {13, 14},
+        {14, 14},
+        {14, 15},
+        {15, 15},
+        {15, 16},
+        {16, 16},
+        {16, 17},
+        {17, 17},
+        {18, 18},
+        {18, 19},
+        {19, 19},
+        {19, 20},
+        {20, 20},
+        {20, 21},
+        {21, 21},
+        {21, 22},
+        {22, 22},
+        {23, 23},
+        {23, 24},
+        {24, 24},
+        {25, 25},
+        {25, 26},
+        {26, 26},
+        {26, 27},
+        {27, 27},
+        {27, 28},
+        {28, 28},
+        {29, 29},
+        {29, 30},
+        {30, 30},
+        {30, 31},
+        {31, 31},
+        {31, 32},
+        {32, 32},
+        {33, 33},
+        {33, 34},
+        {34, 34},
+        {34, 35},
+        {35, 35},
+        {35, 36},
+        {36, 36},
+        {37, 37},
+        {37, 38},
+        {38, 38},
+        {38, 39},
+        {39, 39},
+        {39, 40},
+        {40, 40},
+        {40, 41},
+        {41, 41},
+        {41, 42},
+        {42, 42},
+        {43, 43},
+        {44, 44},
+        {45, 45},
+        {45, 46},
+        {46, 46},
+        {46, 47},
+        {47, 47},
+        {48, 48},
+        {48, 49},
+        {49, 49},
+        {49, 50},
+        {50, 50},
+        {50, 51},
+        {51, 51},
+        {51, 52},
+        {52, 52},
+        {53, 53},
+        {53, 54},
+        {54, 54},
+        {54, 55},
+        {55, 55},
+        {55, 56},
+        {56, 56},
+        {56, 57},
+        {57, 57},
+        {58, 58},
+        {58, 59},
+        {59, 59},
+        {60, 60},
+        {60, 61},
+        {61, 61},
+        {61, 62},
+        {62, 62},
+        {62, 63},
+        {63, 63},
+        {64, 64}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return -1;
+          case 2: return 1/(-1 - 2*J(jj1));
+          case 3: return (-2*sqrt(J(jj1)*(1 + J(jj1))))/(1 + 2*J(jj1));
+          case 4: return -1;
+          case 5: return -(sqrt(3)/sqrt(-1 + 4*Power(J(jj1),2)));
+          case 6: return (-2*(-1 + Power(J(jj1),2)))/sqrt(1 - 5*Power(J(jj1),2) + 4*Power(J(jj1),4));
+          case 7: return -2/(1 + 2*J(jj1));
+          case 8: return -(sqrt(-3 + 4*J(jj1) + 4*Power(J(jj1),2))/(1 + 2*J(jj1)));
+          case 9: return -((sqrt(3)*(3*sqrt(J(jj1)*(1 + J(jj1))) + 5*sqrt(Power(J(jj1),3)*(1 + J(jj1))) + 2*sqrt(Power(J(jj1),5)*(1 + J(jj1)))))/sqrt(J(jj1)*(1 + 2*J(jj1))*Power(3 + 5*J(jj1) + 2*Power(J(jj1),2),3)));
+          case 10: return -((9*sqrt(J(jj1)/(3 + 2*J(jj1))) + sqrt(J(jj1)*(3 + 2*J(jj1))) + 2*J(jj1)*(3*sqrt(J(jj1)/(3 + 2*J(jj1))) + sqrt(J(jj1)*(3 + 2*J(jj1)))))/((3 + 2*J(jj1))*sqrt(2 + 5*J(jj1) + 2*Power(J(jj1),2))));
+          case 11: return 1;
+          case 12: return 1;
+          case 13: return 1;
+          case 14: return 1/sqrt(J(jj1)*(1 + 2*J(jj1)));
+          case 15: return (-sqrt(2 + 1/J(jj1)) + sqrt(J(jj1)*(1 + 2*J(jj1))) + 2*sqrt(Power(J(jj1),3)*(1 + 2*J(jj1))))/((1 + 2*J(jj1))*sqrt(-1 + J(jj1) + 2*Power(J(jj1),2)));
+          case 16: return 1/sqrt((1 + J(jj1))*(1 + 2*J(jj1)));
+          case 17: return (sqrt(J(jj1)/(1 + J(jj1))) + sqrt(J(jj1)/(1 + J(jj1)))*(1 + 2*J(jj1)) + sqrt(J(jj1)*(1 + J(jj1)))*(1 + 2*J(jj1)))/((1 + J(jj1))*sqrt(3 + 8*J(jj1) + 4*Power(J(jj1),2)));
+          case 18: return 1;
+          case 19: return sqrt(2)/sqrt((-1 + J(jj1))*(1 + 2*J(jj1)));
+          case 20: return (-3 - J(jj1) + 2*Power(J(jj1),2))/sqrt(3 + 4*J(jj1) - 7*Power(J(jj1),2) - 4*Power(J(jj1),3) + 4*Power(J(jj1),4));
+          case 21: return sqrt(3)/sqrt(J(jj1)*(1 + 2*J(jj1)));
+          case 22: return (6*sqrt((-1 + J(jj1))/(J(jj1)*(3 + 8*J(jj1) + 4*Power(J(jj1),2)))) + (-1 + J(jj1))*(-1 + 2*J(jj1))*sqrt(J(jj1)/(-3 - 5*J(jj1) + 4*Power(J(jj1),2) + 4*Power(J(jj1),3))) + (3*(-1 + J(jj1))*Power(-1 + 2*J(jj1),1.5))/sqrt(J(jj1)*(3 - J(jj1) - 14*Power(J(jj1),2) + 4*Power(J(jj1),3) + 8*Power(J(jj1),4))))/(1 + J(jj1));
+          case 23: return sqrt(3)/sqrt(1 + 3*J(jj1) + 2*Power(J(jj1),2));
+          case 24: return (-2 + 3*J(jj1) + 2*Power(J(jj1),2))/sqrt(-2 - 3*J(jj1) + 7*Power(J(jj1),2) + 12*Power(J(jj1),3) + 4*Power(J(jj1),4));
+          case 25: return (sqrt(2)*(sqrt(Power(J(jj1),3)*Power(1 + J(jj1),3)*Power(1 + 2*J(jj1),2)*(3 + 2*J(jj1))) + 6*sqrt(J(jj1)*(3 + 5*J(jj1) + 2*Power(J(jj1),2))) + 12*J(jj1)*sqrt(J(jj1)*(3 + 5*J(jj1) + 2*Power(J(jj1),2))) + 6*sqrt(Power(J(jj1),5)*(3 + 5*J(jj1) + 2*Power(J(jj1),2)))))/sqrt(J(jj1)*(1 + 2*J(jj1))*Power(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3),3));
+          case 26: return (8*sqrt(J(jj1)/(2 + J(jj1))) + sqrt(J(jj1)*(2 + J(jj1))) + 2*J(jj1)*(2*sqrt(J(jj1)/(2 + J(jj1))) + sqrt(J(jj1)*(2 + J(jj1)))))/((2 + J(jj1))*sqrt(5 + 12*J(jj1) + 4*Power(J(jj1),2)));
+          case 27: return 1;
+          case 28: return sqrt(2)/sqrt((-1 + J(jj1))*(1 + 2*J(jj1)));
+          case 29: return (-3 - J(jj1) + 2*Power(J(jj1),2))/sqrt(3 + 4*J(jj1) - 7*Power(J(jj1),2) - 4*Power(J(jj1),3) + 4*Power(J(jj1),4));
+          case 30: return sqrt(3)/sqrt(J(jj1)*(1 + 2*J(jj1)));
+          case 31: return (6*sqrt((-1 + J(jj1))/(J(jj1)*(3 + 8*J(jj1) + 4*Power(J(jj1),2)))) + (-1 + J(jj1))*(-1 + 2*J(jj1))*sqrt(J(jj1)/(-3 - 5*J(jj1) + 4*Power(J(jj1),2) + 4*Power(J(jj1),3))) + (3*(-1 + J(jj1))*Power(-1 + 2*J(jj1),1.5))/sqrt(J(jj1)*(3 - J(jj1) - 14*Power(J(jj1),2) + 4*Power(J(jj1),3) + 8*Power(J(jj1),4))))/(1 + J(jj1));
+          case 32: return sqrt(3)/sqrt(1 + 3*J(jj1) + 2*Power(J(jj1),2));
+          case 33: return (-2 + 3*J(jj1) + 2*Power(J(jj1),2))/sqrt(-2 - 3*J(jj1) + 7*Power(J(jj1),2) + 12*Power(J(jj1),3) + 4*Power(J(jj1),4));
+          case 34: return (sqrt(2)*(sqrt(Power(J(jj1),3)*Power(1 + J(jj1),3)*Power(1 + 2*J(jj1),2)*(3 + 2*J(jj1))) + 6*sqrt(J(jj1)*(3 + 5*J(jj1) + 2*Power(J(jj1),2))) + 12*J(jj1)*sqrt(J(jj1)*(3 + 5*J(jj1) + 2*Power(J(jj1),2))) + 6*sqrt(Power(J(jj1),5)*(3 + 5*J(jj1) + 2*Power(J(jj1),2)))))/sqrt(J(jj1)*(1 + 2*J(jj1))*Power(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3),3));
+          case 35: return (8*sqrt(J(jj1)/(2 + J(jj1))) + sqrt(J(jj1)*(2 + J(jj1))) + 2*J(jj1)*(2*sqrt(J(jj1)/(2 + J(jj1))) + sqrt(J(jj1)*(2 + J(jj1)))))/((2 + J(jj1))*sqrt(5 + 12*J(jj1) + 4*Power(J(jj1),2)));
+          case 36: return -1;
+          case 37: return 1/(-1 - 2*J(jj1));
+          case 38: return (-2*sqrt(J(jj1)*(1 + J(jj1))))/(1 + 2*J(jj1));
+          case 39: return -1;
+          case 40: return -(sqrt(3)/sqrt(-1 + 4*Power(J(jj1),2)));
+          case 41: return (-2*(-1 + Power(J(jj1),2)))/sqrt(1 - 5*Power(J(jj1),2) + 4*Power(J(jj1),4));
+          case 42: return -2/(1 + 2*J(jj1));
+          case 43: return -(sqrt(-3 + 4*J(jj1) + 4*Power(J(jj1),2))/(1 + 2*J(jj1)));
+          case 44: return -((sqrt(3)*(3*sqrt(J(jj1)*(1 + J(jj1))) + 5*sqrt(Power(J(jj1),3)*(1 + J(jj1))) + 2*sqrt(Power(J(jj1),5)*(1 + J(jj1)))))/sqrt(J(jj1)*(1 + 2*J(jj1))*Power(3 + 5*J(jj1) + 2*Power(J(jj1),2),3)));
+          case 45: return -((9*sqrt(J(jj1)/(3 + 2*J(jj1))) + sqrt(J(jj1)*(3 + 2*J(jj1))) + 2*J(jj1)*(3*sqrt(J(jj1)/(3 + 2*J(jj1))) + sqrt(J(jj1)*(3 + 2*J(jj1)))))/((3 + 2*J(jj1))*sqrt(2 + 5*J(jj1) + 2*Power(J(jj1),2))));
+          case 46: return -1;
+          case 47: return -(sqrt(3)/sqrt(-1 + 4*Power(J(jj1),2)));
+          case 48: return (-2*(-1 + Power(J(jj1),2)))/sqrt(1 - 5*Power(J(jj1),2) + 4*Power(J(jj1),4));
+          case 49: return -2/(1 + 2*J(jj1));
+          case 50: return -(sqrt(-3 + 4*J(jj1) + 4*Power(J(jj1),2))/(1 + 2*J(jj1)));
+          case 51: return -((sqrt(3)*(3*sqrt(J(jj1)*(1 + J(jj1))) + 5*sqrt(Power(J(jj1),3)*(1 + J(jj1))) + 2*sqrt(Power(J(jj1),5)*(1 + J(jj1)))))/sqrt(J(jj1)*(1 + 2*J(jj1))*Power(3 + 5*J(jj1) + 2*Power(J(jj1),2),3)));
+          case 52: return -((9*sqrt(J(jj1)/(3 + 2*J(jj1))) + sqrt(J(jj1)*(3 + 2*J(jj1))) + 2*J(jj1)*(3*sqrt(J(jj1)/(3 + 2*J(jj1))) + sqrt(J(jj1)*(3 + 2*J(jj1)))))/((3 + 2*J(jj1))*sqrt(2 + 5*J(jj1) + 2*Power(J(jj1),2))));
+          case 53: return -1;
+          case 54: return -(sqrt(3)/sqrt(-1 + 4*Power(J(jj1),2)));
+          case 55: return (-2*(-1 + Power(J(jj1),2)))/sqrt(1 - 5*Power(J(jj1),2) + 4*Power(J(jj1),4));
+          case 56: return -2/(1 + 2*J(jj1));
+          case 57: return -(sqrt(-3 + 4*J(jj1) + 4*Power(J(jj1),2))/(1 + 2*J(jj1)));
+          case 58: return -((sqrt(3)*(3*sqrt(J(jj1)*(1 + J(jj1))) + 5*sqrt(Power(J(jj1),3)*(1 + J(jj1))) + 2*sqrt(Power(J(jj1),5)*(1 + J(jj1)))))/sqrt(J(jj1)*(1 + 2*J(jj1))*Power(3 + 5*J(jj1) + 2*Power(J(jj1),2),3)));
+          case 59: return -((9*sqrt(J(jj1)/(3 + 2*J(jj1))) + sqrt(J(jj1)*(3 + 2*J(jj1))) + 2*J(jj1)*(3*sqrt(J(jj1)/(3 + 2*J(jj1))) + sqrt(J(jj1)*(3 + 2*J(jj1)))))/((3 + 2*J(jj1))*sqrt(2 + 5*J(jj1) + 2*Power(J(jj1),2))));
+          case 60: return -1;
+          case 61: return -(sqrt(5)/sqrt(-3 - 4*J(jj1) + 4*Power(J(jj1),2)));
+          case 62: return (-2*(-2 - J(jj1) + Power(J(jj1),2)))/sqrt((6 - 7*J(jj1) + 2*Power(J(jj1),2))*(1 + 3*J(jj1) + 2*Power(J(jj1),2)));
+          case 63: return (-2*sqrt((2 + 4*J(jj1))/(-1 + 2*J(jj1))))/(1 + 2*J(jj1));
+          case 64: return (9 - 4*Power(J(jj1),2))/sqrt(9 - 40*Power(J(jj1),2) + 16*Power(J(jj1),4));
+          case 65: return -3/(1 + 2*J(jj1));
+          case 66: return (-2*sqrt(-2 + J(jj1) + Power(J(jj1),2)))/(1 + 2*J(jj1));
+          case 67: return (-2*sqrt(2))/sqrt(3 + 8*J(jj1) + 4*Power(J(jj1),2));
+          case 68: return -8*J(jj1)*(-1 + 2*J(jj1))*sqrt((1 + 2*J(jj1))/(Power(2 + J(jj1),2)*Power(3 + 2*J(jj1),3)*(-5 + 8*J(jj1) + 4*Power(J(jj1),2)))) - (J(jj1)*(-1 + 2*J(jj1))*sqrt((1 + 2*J(jj1))/(-15 + 14*J(jj1) + 28*Power(J(jj1),2) + 8*Power(J(jj1),3))))/(2 + J(jj1)) - (18*J(jj1)*(-1 + 2*J(jj1))*sqrt((1 + 2*J(jj1))/(-15 + 14*J(jj1) + 28*Power(J(jj1),2) + 8*Power(J(jj1),3))))/(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3)) - (30*sqrt((-1 + 2*J(jj1))/(15 + 46*J(jj1) + 36*Power(J(jj1),2) + 8*Power(J(jj1),3))))/(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3)) - (48*J(jj1)*(-1 + 2*J(jj1)))/((6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3))*sqrt(-15 - 16*J(jj1) + 56*Power(J(jj1),2) + 64*Power(J(jj1),3) + 16*Power(J(jj1),4)));
+          case 69: return -((sqrt(5)*(sqrt(Power(J(jj1),3)*(2 + J(jj1))*Power(1 + 2*J(jj1),2)*Power(3 + 5*J(jj1) + 2*Power(J(jj1),2),3)) + 8*J(jj1)*sqrt(J(jj1)*Power(1 + J(jj1),3)*Power(1 + 2*J(jj1),2)*(6 + 7*J(jj1) + 2*Power(J(jj1),2))) + 30*sqrt(J(jj1)*(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3))) + 66*J(jj1)*sqrt(J(jj1)*(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3))) + 36*sqrt(Power(J(jj1),5)*(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3)))))/sqrt(J(jj1)*(1 + 2*J(jj1))*Power(30 + 77*J(jj1) + 71*Power(J(jj1),2) + 28*Power(J(jj1),3) + 4*Power(J(jj1),4),3)));
+          case 70: return -((25*sqrt(J(jj1)/(5 + 2*J(jj1))) + sqrt(J(jj1)*(5 + 2*J(jj1))) + 2*J(jj1)*(5*sqrt(J(jj1)/(5 + 2*J(jj1))) + sqrt(J(jj1)*(5 + 2*J(jj1)))))/((5 + 2*J(jj1))*sqrt(3 + 7*J(jj1) + 2*Power(J(jj1),2))));
+          case 71: return 1;
+          case 72: return 1;
+          case 73: return 1;
+          case 74: return 1/sqrt(J(jj1)*(1 + 2*J(jj1)));
+          case 75: return (-sqrt(2 + 1/J(jj1)) + sqrt(J(jj1)*(1 + 2*J(jj1))) + 2*sqrt(Power(J(jj1),3)*(1 + 2*J(jj1))))/((1 + 2*J(jj1))*sqrt(-1 + J(jj1) + 2*Power(J(jj1),2)));
+          case 76: return 1/sqrt((1 + J(jj1))*(1 + 2*J(jj1)));
+          case 77: return (sqrt(J(jj1)/(1 + J(jj1))) + sqrt(J(jj1)/(1 + J(jj1)))*(1 + 2*J(jj1)) + sqrt(J(jj1)*(1 + J(jj1)))*(1 + 2*J(jj1)))/((1 + J(jj1))*sqrt(3 + 8*J(jj1) + 4*Power(J(jj1),2)));
+          case 78: return 1;
+          case 79: return sqrt(2)/sqrt((-1 + J(jj1))*(1 + 2*J(jj1)));
+          case 80: return (-3 - J(jj1) + 2*Power(J(jj1),2))/sqrt(3 + 4*J(jj1) - 7*Power(J(jj1),2) - 4*Power(J(jj1),3) + 4*Power(J(jj1),4));
+          case 81: return sqrt(3)/sqrt(J(jj1)*(1 + 2*J(jj1)));
+          case 82: return (6*sqrt((-1 + J(jj1))/(J(jj1)*(3 + 8*J(jj1) + 4*Power(J(jj1),2)))) + (-1 + J(jj1))*(-1 + 2*J(jj1))*sqrt(J(jj1)/(-3 - 5*J(jj1) + 4*Power(J(jj1),2) + 4*Power(J(jj1),3))) + (3*(-1 + J(jj1))*Power(-1 + 2*J(jj1),1.5))/sqrt(J(jj1)*(3 - J(jj1) - 14*Power(J(jj1),2) + 4*Power(J(jj1),3) + 8*Power(J(jj1),4))))/(1 + J(jj1));
+          case 83: return sqrt(3)/sqrt(1 + 3*J(jj1) + 2*Power(J(jj1),2));
+          case 84: return (-2 + 3*J(jj1) + 2*Power(J(jj1),2))/sqrt(-2 - 3*J(jj1) + 7*Power(J(jj1),2) + 12*Power(J(jj1),3) + 4*Power(J(jj1),4));
+          case 85: return (sqrt(2)*(sqrt(Power(J(jj1),3)*Power(1 + J(jj1),3)*Power(1 + 2*J(jj1),2)*(3 + 2*J(jj1))) + 6*sqrt(J(jj1)*(3 + 5*J(jj1) + 2*Power(J(jj1),2))) + 12*J(jj1)*sqrt(J(jj1)*(3 + 5*J(jj1) + 2*Power(J(jj1),2))) + 6*sqrt(Power(J(jj1),5)*(3 + 5*J(jj1) + 2*Power(J(jj1),2)))))/sqrt(J(jj1)*(1 + 2*J(jj1))*Power(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3),3));
+          case 86: return (8*sqrt(J(jj1)/(2 + J(jj1))) + sqrt(J(jj1)*(2 + J(jj1))) + 2*J(jj1)*(2*sqrt(J(jj1)/(2 + J(jj1))) + sqrt(J(jj1)*(2 + J(jj1)))))/((2 + J(jj1))*sqrt(5 + 12*J(jj1) + 4*Power(J(jj1),2)));
+          case 87: return 1;
+          case 88: return sqrt(2)/sqrt((-1 + J(jj1))*(1 + 2*J(jj1)));
+          case 89: return (-3 - J(jj1) + 2*Power(J(jj1),2))/sqrt(3 + 4*J(jj1) - 7*Power(J(jj1),2) - 4*Power(J(jj1),3) + 4*Power(J(jj1),4));
+          case 90: return sqrt(3)/sqrt(J(jj1)*(1 + 2*J(jj1)));
+          case 91: return (6*sqrt((-1 + J(jj1))/(J(jj1)*(3 + 8*J(jj1) + 4*Power(J(jj1),2)))) + (-1 + J(jj1))*(-1 + 2*J(jj1))*sqrt(J(jj1)/(-3 - 5*J(jj1) + 4*Power(J(jj1),2) + 4*Power(J(jj1),3))) + (3*(-1 + J(jj1))*Power(-1 + 2*J(jj1),1.5))/sqrt(J(jj1)*(3 - J(jj1) - 14*Power(J(jj1),2) + 4*Power(J(jj1),3) + 8*Power(J(jj1),4))))/(1 + J(jj1));
+          case 92: return sqrt(3)/sqrt(1 + 3*J(jj1) + 2*Power(J(jj1),2));
+          case 93: return (-2 + 3*J(jj1) + 2*Power(J(jj1),2))/sqrt(-2 - 3*J(jj1) + 7*Power(J(jj1),2) + 12*Power(J(jj1),3) + 4*Power(J(jj1),4));
+          case 94: return (sqrt(2)*(sqrt(Power(J(jj1),3)*Power(1 + J(jj1),3)*Power(1 + 2*J(jj1),2)*(3 + 2*J(jj1))) + 6*sqrt(J(jj1)*(3 + 5*J(jj1) + 2*Power(J(jj1),2))) + 12*J(jj1)*sqrt(J(jj1)*(3 + 5*J(jj1) + 2*Power(J(jj1),2))) + 6*sqrt(Power(J(jj1),5)*(3 + 5*J(jj1) + 2*Power(J(jj1),2)))))/sqrt(J(jj1)*(1 + 2*J(jj1))*Power(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3),3));
+          case 95: return (8*sqrt(J(jj1)/(2 + J(jj1))) + sqrt(J(jj1)*(2 + J(jj1))) + 2*J(jj1)*(2*sqrt(J(jj1)/(2 + J(jj1))) + sqrt(J(jj1)*(2 + J(jj1)))))/((2 + J(jj1))*sqrt(5 + 12*J(jj1) + 4*Power(J(jj1),2)));
+          case 96: return -1;
+          case 97: return 1/(-1 - 2*J(jj1));
+          case 98: return (-2*sqrt(J(jj1)*(1 + J(jj1))))/(1 + 2*J(jj1));
+          case 99: return -1;
+          case 100: return -(sqrt(3)/sqrt(-1 + 4*Power(J(jj1),2)));
+          case 101: return (-2*(-1 + Power(J(jj1),2)))/sqrt(1 - 5*Power(J(jj1),2) + 4*Power(J(jj1),4));
+          case 102: return -2/(1 + 2*J(jj1));
+          case 103: return -(sqrt(-3 + 4*J(jj1) + 4*Power(J(jj1),2))/(1 + 2*J(jj1)));
+          case 104: return -((sqrt(3)*(3*sqrt(J(jj1)*(1 + J(jj1))) + 5*sqrt(Power(J(jj1),3)*(1 + J(jj1))) + 2*sqrt(Power(J(jj1),5)*(1 + J(jj1)))))/sqrt(J(jj1)*(1 + 2*J(jj1))*Power(3 + 5*J(jj1) + 2*Power(J(jj1),2),3)));
+          case 105: return -((9*sqrt(J(jj1)/(3 + 2*J(jj1))) + sqrt(J(jj1)*(3 + 2*J(jj1))) + 2*J(jj1)*(3*sqrt(J(jj1)/(3 + 2*J(jj1))) + sqrt(J(jj1)*(3 + 2*J(jj1)))))/((3 + 2*J(jj1))*sqrt(2 + 5*J(jj1) + 2*Power(J(jj1),2))));
+          case 106: return 1;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(1, 2));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(1, 2));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -77,6 +514,7 @@ MatrixElements<SC> SymmetryQJ<SC>::recalc_doublet(const DiagInfo<SC> &diag, cons
 template<typename SC>
 MatrixElements<SC> SymmetryQJ<SC>::recalc_quadruplet(const DiagInfo<SC> &diag, const SubspaceStructure &substruct, const MatrixElements<SC> &cold) const {
   MatrixElements<SC> cnew;
+  const auto blocks = std::make_shared<const BlockIndex<SC>>(cold, substruct);
   for(const auto &[I1, eig]: diag) {
     int q1 = I1.get("Q");
     int jj1 = I1.get("JJ");
@@ -89,10 +527,316 @@ MatrixElements<SC> SymmetryQJ<SC>::recalc_quadruplet(const DiagInfo<SC> &diag, c
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "qj/qj-quad1.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 2},
+        {3, 3},
+        {4, 4},
+        {5, 4},
+        {5, 5},
+        {6, 4},
+        {6, 5},
+        {6, 6},
+        {7, 4},
+        {7, 5},
+        {7, 6},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {10, 10},
+        {11, 10},
+        {11, 11},
+        {12, 10},
+        {12, 11},
+        {12, 12},
+        {13, 13},
+        {14, 13},
+        {14, 14},
+        {15, 13},
+        {15, 14},
+        {15, 15},
+        {16, 13},
+        {16, 14},
+        {16, 15},
+        {16, 16},
+        {17, 14},
+        {17, 15},
+        {17, 16},
+        {17, 17},
+        {18, 18},
+        {19, 18},
+        {19, 19},
+        {20, 18},
+        {20, 19},
+        {20, 20},
+        {21, 18},
+        {21, 19},
+        {21, 20},
+        {21, 21},
+        {22, 19},
+        {22, 20},
+        {22, 21},
+        {22, 22},
+        {23, 23},
+        {24, 23},
+        {24, 24},
+        {25, 25},
+        {26, 25},
+        {26, 26},
+        {27, 25},
+        {27, 26},
+        {27, 27},
+        {28, 25},
+        {28, 26},
+        {28, 27},
+        {28, 28},
+        {29, 29},
+        {30, 29},
+        {30, 30},
+        {31, 29},
+        {31, 30},
+        {31, 31},
+        {32, 29},
+        {32, 30},
+        {32, 31},
+        {32, 32},
+        {33, 33},
+        {34, 33},
+        {34, 34},
+        {35, 33},
+        {35, 34},
+        {35, 35},
+        {36, 33},
+        {36, 34},
+        {36, 35},
+        {36, 36},
+        {37, 37},
+        {38, 37},
+        {38, 38},
+        {39, 37},
+        {39, 38},
+        {39, 39},
+        {40, 37},
+        {40, 38},
+        {40, 39},
+        {40, 40},
+        {41, 38},
+        {41, 39},
+        {41, 40},
+        {41, 41},
+        {42, 39},
+        {42, 40},
+        {42, 41},
+        {42, 42},
+        {43, 43},
+        {44, 44},
+        {45, 45},
+        {46, 45},
+        {46, 46},
+        {47, 45},
+        {47, 46},
+        {47, 47},
+        {48, 48},
+        {49, 48},
+        {49, 49},
+        {50, 48},
+        {50, 49},
+        {50, 50},
+        {51, 48},
+        {51, 49},
+        {51, 50},
+        {51, 51},
+        {52, 49},
+        {52, 50},
+        {52, 51},
+        {52, 52},
+        {53, 53},
+        {54, 53},
+        {54, 54},
+        {55, 53},
+        {55, 54},
+        {55, 55},
+        {56, 53},
+        {56, 54},
+        {56, 55},
+        {56, 56},
+        {57, 54},
+        {57, 55},
+        {57, 56},
+        {57, 57},
+        {58, 58},
+        {59, 58},
+        {59, 59},
+        {60, 60},
+        {61, 60},
+        {61, 61},
+        {62, 60},
+        {62, 61},
+        {62, 62},
+        {63, 60},
+        {63, 61},
+        {63, 62},
+        {63, 63},
+        {64, 64}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return (-2*sqrt((J(jj1)*(6 + 7*J(jj1) + 2*Power(J(jj1),2)))/(1 + 2*J(jj1))))/(3 + 2*J(jj1));
+          case 2: return sqrt(3)/sqrt(3 + 8*J(jj1) + 4*Power(J(jj1),2));
+          case 3: return -1;
+          case 4: return (-2*sqrt(-2 + J(jj1) + Power(J(jj1),2)))/(1 + 2*J(jj1));
+          case 5: return (3*(sqrt(J(jj1)*(2 + J(jj1))) + 4*sqrt(Power(J(jj1),3)*(2 + J(jj1))) + 4*sqrt(Power(J(jj1),5)*(2 + J(jj1)))))/((1 + J(jj1))*Power(1 + 2*J(jj1),3));
+          case 6: return ((5 - 8*J(jj1) - 4*Power(J(jj1),2))*sqrt((J(jj1)*(6 + 7*J(jj1) + 2*Power(J(jj1),2)))/(-5 - 2*J(jj1) + 20*Power(J(jj1),2) + 8*Power(J(jj1),3))))/((1 + J(jj1))*(3 + 2*J(jj1)));
+          case 7: return (-6*sqrt(2 + 3*J(jj1) + Power(J(jj1),2)))/(3 + 11*J(jj1) + 12*Power(J(jj1),2) + 4*Power(J(jj1),3));
+          case 8: return (2*sqrt(3)*J(jj1)*(5 + 2*J(jj1)))/((3 + 2*J(jj1))*sqrt(J(jj1)*(1 + 2*J(jj1))*(5 + 7*J(jj1) + 2*Power(J(jj1),2))));
+          case 9: return (-2*sqrt(J(jj1)*(3 + J(jj1))))/(3 + 2*J(jj1));
+          case 10: return 3/(3 + 11*J(jj1) + 12*Power(J(jj1),2) + 4*Power(J(jj1),3));
+          case 11: return -3/(3 + 5*J(jj1) + 2*Power(J(jj1),2));
+          case 12: return 3/(3 + 2*J(jj1));
+          case 13: return -1;
+          case 14: return 1;
+          case 15: return 1;
+          case 16: return sqrt((-2 + J(jj1) + 5*Power(J(jj1),2) + 2*Power(J(jj1),3))/(1 + 2*J(jj1)))/(1 + J(jj1));
+          case 17: return -((sqrt(3)*sqrt(6 + 7*J(jj1) + 2*Power(J(jj1),2)))/(3 + 5*J(jj1) + 2*Power(J(jj1),2)));
+          case 18: return (5 + 2*J(jj1))/sqrt(31 + 15/J(jj1) + 20*J(jj1) + 4*Power(J(jj1),2));
+          case 19: return sqrt(3)/((1 + J(jj1))*sqrt(3 + 8*J(jj1) + 4*Power(J(jj1),2)));
+          case 20: return -(sqrt(3)/sqrt((1 + J(jj1))*(3 + 2*J(jj1))));
+          case 21: return 1;
+          case 22: return sqrt((-6 + J(jj1) + 2*Power(J(jj1),2))/(J(jj1)*(1 + 2*J(jj1))));
+          case 23: return -((sqrt(0.6666666666666666)*sqrt((6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3))/(-1 + J(jj1)))*(-6/sqrt((J(jj1)*Power(1 + 2*J(jj1),2)*(3 + 2*J(jj1)))/(1 - 3*J(jj1) + 2*Power(J(jj1),2))) + (6*sqrt((J(jj1)*(1 - 3*J(jj1) + 2*Power(J(jj1),2)))/(3 + 2*J(jj1))))/(1 + 2*J(jj1)) - 3*(-1 + J(jj1))*sqrt((Power(3 - 2*J(jj1),2)*(-1 + 2*J(jj1)))/(J(jj1)*Power(1 + 2*J(jj1),2)*(-3 + J(jj1) + 2*Power(J(jj1),2))))))/(1 + J(jj1)));
+          case 24: return sqrt((-5 + 3*J(jj1) + 2*Power(J(jj1),2))*(-2 + 3*J(jj1) + 2*Power(J(jj1),2)))/((1 + J(jj1))*(1 + 2*J(jj1)));
+          case 25: return (3*sqrt(2)*sqrt((2 + J(jj1))/(3*J(jj1) + 8*Power(J(jj1),2) + 4*Power(J(jj1),3))))/(1 + J(jj1));
+          case 26: return 3*sqrt(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3))*((16*(-1 + J(jj1))*sqrt((-1 + 2*J(jj1))/(5 + 12*J(jj1) + 4*Power(J(jj1),2))))/Power(3 + 5*J(jj1) + 2*Power(J(jj1),2),1.5) - (2*J(jj1)*(-3 + 2*J(jj1))*(-1 + 2*J(jj1)))/(Power(3 + 5*J(jj1) + 2*Power(J(jj1),2),1.5)*sqrt(-5 - 2*J(jj1) + 20*Power(J(jj1),2) + 8*Power(J(jj1),3))) + (Power(1 - 2*J(jj1),2)*(-11 + 2*J(jj1)))/((3 + 5*J(jj1) + 2*Power(J(jj1),2))*sqrt(-15 - 31*J(jj1) + 40*Power(J(jj1),2) + 120*Power(J(jj1),3) + 80*Power(J(jj1),4) + 16*Power(J(jj1),5))));
+          case 27: return sqrt(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3))*(60*sqrt((J(jj1)*(-1 + 2*J(jj1)))/(Power(3 + 5*J(jj1) + 2*Power(J(jj1),2),3)*(30 + 37*J(jj1) + 15*Power(J(jj1),2) + 2*Power(J(jj1),3)))) + 24*(-2 + J(jj1))*(-1 + 2*J(jj1))*sqrt(J(jj1)/(Power(3 + 5*J(jj1) + 2*Power(J(jj1),2),3)*(-30 + 23*J(jj1) + 59*Power(J(jj1),2) + 28*Power(J(jj1),3) + 4*Power(J(jj1),4)))) + (J(jj1)*(-1 + 2*J(jj1))*(3 - 13*J(jj1) + 2*Power(J(jj1),2)))/((3 + 5*J(jj1) + 2*Power(J(jj1),2))*sqrt(J(jj1)*(-90 - 81*J(jj1) + 232*Power(J(jj1),2) + 425*Power(J(jj1),3) + 270*Power(J(jj1),4) + 76*Power(J(jj1),5) + 8*Power(J(jj1),6)))));
+          case 28: return (-3*sqrt((6 + 4*J(jj1))/(J(jj1)*Power(1 + 2*J(jj1),2))))/(3 + 5*J(jj1) + 2*Power(J(jj1),2));
+          case 29: return (3*J(jj1)*(5 + 2*J(jj1))*sqrt((9 + 6*J(jj1))/(J(jj1)*Power(1 + 2*J(jj1),2)*(10 + 9*J(jj1) + 2*Power(J(jj1),2)))))/(3 + 5*J(jj1) + 2*Power(J(jj1),2));
+          case 30: return (-3*J(jj1)*(3 + J(jj1)))/((1 + J(jj1))*sqrt(J(jj1)*(3 + J(jj1))*(6 + 7*J(jj1) + 2*Power(J(jj1),2))));
+          case 31: return (7 + 2*J(jj1))*sqrt(J(jj1)/(42 + 61*J(jj1) + 28*Power(J(jj1),2) + 4*Power(J(jj1),3)));
+          case 32: return (-3*sqrt(2))/(sqrt((2 + J(jj1))*(1 + 2*J(jj1)))*(3 + 5*J(jj1) + 2*Power(J(jj1),2)));
+          case 33: return (3*sqrt(12 + 26*J(jj1) + 18*Power(J(jj1),2) + 4*Power(J(jj1),3)))/(Power(3 + 2*J(jj1),1.5)*(2 + 3*J(jj1) + Power(J(jj1),2)));
+          case 34: return -(sqrt(6)/sqrt((2 + J(jj1))*(3 + 2*J(jj1))));
+          case 35: return 1;
+          case 36: return sqrt((-6 + J(jj1) + 2*Power(J(jj1),2))/(J(jj1)*(1 + 2*J(jj1))));
+          case 37: return -((sqrt(0.6666666666666666)*sqrt((6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3))/(-1 + J(jj1)))*(-6/sqrt((J(jj1)*Power(1 + 2*J(jj1),2)*(3 + 2*J(jj1)))/(1 - 3*J(jj1) + 2*Power(J(jj1),2))) + (6*sqrt((J(jj1)*(1 - 3*J(jj1) + 2*Power(J(jj1),2)))/(3 + 2*J(jj1))))/(1 + 2*J(jj1)) - 3*(-1 + J(jj1))*sqrt((Power(3 - 2*J(jj1),2)*(-1 + 2*J(jj1)))/(J(jj1)*Power(1 + 2*J(jj1),2)*(-3 + J(jj1) + 2*Power(J(jj1),2))))))/(1 + J(jj1)));
+          case 38: return sqrt((-5 + 3*J(jj1) + 2*Power(J(jj1),2))*(-2 + 3*J(jj1) + 2*Power(J(jj1),2)))/((1 + J(jj1))*(1 + 2*J(jj1)));
+          case 39: return (3*sqrt(2)*sqrt((2 + J(jj1))/(3*J(jj1) + 8*Power(J(jj1),2) + 4*Power(J(jj1),3))))/(1 + J(jj1));
+          case 40: return 3*sqrt(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3))*((16*(-1 + J(jj1))*sqrt((-1 + 2*J(jj1))/(5 + 12*J(jj1) + 4*Power(J(jj1),2))))/Power(3 + 5*J(jj1) + 2*Power(J(jj1),2),1.5) - (2*J(jj1)*(-3 + 2*J(jj1))*(-1 + 2*J(jj1)))/(Power(3 + 5*J(jj1) + 2*Power(J(jj1),2),1.5)*sqrt(-5 - 2*J(jj1) + 20*Power(J(jj1),2) + 8*Power(J(jj1),3))) + (Power(1 - 2*J(jj1),2)*(-11 + 2*J(jj1)))/((3 + 5*J(jj1) + 2*Power(J(jj1),2))*sqrt(-15 - 31*J(jj1) + 40*Power(J(jj1),2) + 120*Power(J(jj1),3) + 80*Power(J(jj1),4) + 16*Power(J(jj1),5))));
+          case 41: return sqrt(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3))*(60*sqrt((J(jj1)*(-1 + 2*J(jj1)))/(Power(3 + 5*J(jj1) + 2*Power(J(jj1),2),3)*(30 + 37*J(jj1) + 15*Power(J(jj1),2) + 2*Power(J(jj1),3)))) + 24*(-2 + J(jj1))*(-1 + 2*J(jj1))*sqrt(J(jj1)/(Power(3 + 5*J(jj1) + 2*Power(J(jj1),2),3)*(-30 + 23*J(jj1) + 59*Power(J(jj1),2) + 28*Power(J(jj1),3) + 4*Power(J(jj1),4)))) + (J(jj1)*(-1 + 2*J(jj1))*(3 - 13*J(jj1) + 2*Power(J(jj1),2)))/((3 + 5*J(jj1) + 2*Power(J(jj1),2))*sqrt(J(jj1)*(-90 - 81*J(jj1) + 232*Power(J(jj1),2) + 425*Power(J(jj1),3) + 270*Power(J(jj1),4) + 76*Power(J(jj1),5) + 8*Power(J(jj1),6)))));
+          case 42: return (-3*sqrt((6 + 4*J(jj1))/(J(jj1)*Power(1 + 2*J(jj1),2))))/(3 + 5*J(jj1) + 2*Power(J(jj1),2));
+          case 43: return (3*J(jj1)*(5 + 2*J(jj1))*sqrt((9 + 6*J(jj1))/(J(jj1)*Power(1 + 2*J(jj1),2)*(10 + 9*J(jj1) + 2*Power(J(jj1),2)))))/(3 + 5*J(jj1) + 2*Power(J(jj1),2));
+          case 44: return (-3*J(jj1)*(3 + J(jj1)))/((1 + J(jj1))*sqrt(J(jj1)*(3 + J(jj1))*(6 + 7*J(jj1) + 2*Power(J(jj1),2))));
+          case 45: return (7 + 2*J(jj1))*sqrt(J(jj1)/(42 + 61*J(jj1) + 28*Power(J(jj1),2) + 4*Power(J(jj1),3)));
+          case 46: return (-3*sqrt(2))/(sqrt((2 + J(jj1))*(1 + 2*J(jj1)))*(3 + 5*J(jj1) + 2*Power(J(jj1),2)));
+          case 47: return (3*sqrt(12 + 26*J(jj1) + 18*Power(J(jj1),2) + 4*Power(J(jj1),3)))/(Power(3 + 2*J(jj1),1.5)*(2 + 3*J(jj1) + Power(J(jj1),2)));
+          case 48: return -(sqrt(6)/sqrt((2 + J(jj1))*(3 + 2*J(jj1))));
+          case 49: return 1;
+          case 50: return (-2*sqrt((J(jj1)*(6 + 7*J(jj1) + 2*Power(J(jj1),2)))/(1 + 2*J(jj1))))/(3 + 2*J(jj1));
+          case 51: return sqrt(3)/sqrt(3 + 8*J(jj1) + 4*Power(J(jj1),2));
+          case 52: return -1;
+          case 53: return (-2*sqrt(-2 + J(jj1) + Power(J(jj1),2)))/(1 + 2*J(jj1));
+          case 54: return (3*(sqrt(J(jj1)*(2 + J(jj1))) + 4*sqrt(Power(J(jj1),3)*(2 + J(jj1))) + 4*sqrt(Power(J(jj1),5)*(2 + J(jj1)))))/((1 + J(jj1))*Power(1 + 2*J(jj1),3));
+          case 55: return ((5 - 8*J(jj1) - 4*Power(J(jj1),2))*sqrt((J(jj1)*(6 + 7*J(jj1) + 2*Power(J(jj1),2)))/(-5 - 2*J(jj1) + 20*Power(J(jj1),2) + 8*Power(J(jj1),3))))/((1 + J(jj1))*(3 + 2*J(jj1)));
+          case 56: return (-6*sqrt(2 + 3*J(jj1) + Power(J(jj1),2)))/(3 + 11*J(jj1) + 12*Power(J(jj1),2) + 4*Power(J(jj1),3));
+          case 57: return (2*sqrt(3)*J(jj1)*(5 + 2*J(jj1)))/((3 + 2*J(jj1))*sqrt(J(jj1)*(1 + 2*J(jj1))*(5 + 7*J(jj1) + 2*Power(J(jj1),2))));
+          case 58: return (-2*sqrt(J(jj1)*(3 + J(jj1))))/(3 + 2*J(jj1));
+          case 59: return 3/(3 + 11*J(jj1) + 12*Power(J(jj1),2) + 4*Power(J(jj1),3));
+          case 60: return -3/(3 + 5*J(jj1) + 2*Power(J(jj1),2));
+          case 61: return 3/(3 + 2*J(jj1));
+          case 62: return -1;
+          case 63: return (-2*sqrt(-2 + J(jj1) + Power(J(jj1),2)))/(1 + 2*J(jj1));
+          case 64: return (3*(sqrt(J(jj1)*(2 + J(jj1))) + 4*sqrt(Power(J(jj1),3)*(2 + J(jj1))) + 4*sqrt(Power(J(jj1),5)*(2 + J(jj1)))))/((1 + J(jj1))*Power(1 + 2*J(jj1),3));
+          case 65: return ((5 - 8*J(jj1) - 4*Power(J(jj1),2))*sqrt((J(jj1)*(6 + 7*J(jj1) + 2*Power(J(jj1),2)))/(-5 - 2*J(jj1) + 20*Power(J(jj1),2) + 8*Power(J(jj1),3))))/((1 + J(jj1))*(3 + 2*J(jj1)));
+          case 66: return (-6*sqrt(2 + 3*J(jj1) + Power(J(jj1),2)))/(3 + 11*J(jj1) + 12*Power(J(jj1),2) + 4*Power(J(jj1),3));
+          case 67: return (2*sqrt(3)*J(jj1)*(5 + 2*J(jj1)))/((3 + 2*J(jj1))*sqrt(J(jj1)*(1 + 2*J(jj1))*(5 + 7*J(jj1) + 2*Power(J(jj1),2))));
+          case 68: return (-2*sqrt(J(jj1)*(3 + J(jj1))))/(3 + 2*J(jj1));
+          case 69: return 3/(3 + 11*J(jj1) + 12*Power(J(jj1),2) + 4*Power(J(jj1),3));
+          case 70: return -3/(3 + 5*J(jj1) + 2*Power(J(jj1),2));
+          case 71: return 3/(3 + 2*J(jj1));
+          case 72: return -1;
+          case 73: return (-2*sqrt(-2 + J(jj1) + Power(J(jj1),2)))/(1 + 2*J(jj1));
+          case 74: return (3*(sqrt(J(jj1)*(2 + J(jj1))) + 4*sqrt(Power(J(jj1),3)*(2 + J(jj1))) + 4*sqrt(Power(J(jj1),5)*(2 + J(jj1)))))/((1 + J(jj1))*Power(1 + 2*J(jj1),3));
+          case 75: return ((5 - 8*J(jj1) - 4*Power(J(jj1),2))*sqrt((J(jj1)*(6 + 7*J(jj1) + 2*Power(J(jj1),2)))/(-5 - 2*J(jj1) + 20*Power(J(jj1),2) + 8*Power(J(jj1),3))))/((1 + J(jj1))*(3 + 2*J(jj1)));
+          case 76: return (-6*sqrt(2 + 3*J(jj1) + Power(J(jj1),2)))/(3 + 11*J(jj1) + 12*Power(J(jj1),2) + 4*Power(J(jj1),3));
+          case 77: return (2*sqrt(3)*J(jj1)*(5 + 2*J(jj1)))/((3 + 2*J(jj1))*sqrt(J(jj1)*(1 + 2*J(jj1))*(5 + 7*J(jj1) + 2*Power(J(jj1),2))));
+          case 78: return (-2*sqrt(J(jj1)*(3 + J(jj1))))/(3 + 2*J(jj1));
+          case 79: return 3/(3 + 11*J(jj1) + 12*Power(J(jj1),2) + 4*Power(J(jj1),3));
+          case 80: return -3/(3 + 5*J(jj1) + 2*Power(J(jj1),2));
+          case 81: return 3/(3 + 2*J(jj1));
+          case 82: return -1;
+          case 83: return -2*sqrt((-4 + Power(J(jj1),2))/(-1 + 4*Power(J(jj1),2)));
+          case 84: return (sqrt(15)*sqrt((2 + J(jj1) - 2*Power(J(jj1),2) - Power(J(jj1),3))/(J(jj1) - 4*Power(J(jj1),3))))/(1 + J(jj1));
+          case 85: return (15*sqrt((-1 + J(jj1))/(J(jj1)*(15 + 16*J(jj1) + 4*Power(J(jj1),2)))) + 26*sqrt(((-1 + J(jj1))*J(jj1))/(15 + 16*J(jj1) + 4*Power(J(jj1),2))) - 12*sqrt(((-1 + J(jj1))*Power(J(jj1),3))/(15 + 16*J(jj1) + 4*Power(J(jj1),2))) - 8*sqrt(((-1 + J(jj1))*Power(J(jj1),5))/(15 + 16*J(jj1) + 4*Power(J(jj1),2))))/((1 + J(jj1))*Power(1 + 2*J(jj1),2)*sqrt((-3 + 2*J(jj1))/(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3))));
+          case 86: return (-2*sqrt(30)*sqrt((6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3))/(-1 + 2*J(jj1))))/(3 + 11*J(jj1) + 12*Power(J(jj1),2) + 4*Power(J(jj1),3));
+          case 87: return -2*sqrt(0.6666666666666666)*sqrt(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3))*((30*(-3 + 2*J(jj1)))/(sqrt(((1 + J(jj1))*Power(3 + 2*J(jj1),2)*(5 + 2*J(jj1)))/(-1 + J(jj1)))*(1 + 3*J(jj1) + 2*Power(J(jj1),2))) - (3*(-5 + 2*J(jj1))*(1 - 3*J(jj1) + 2*Power(J(jj1),2)))/sqrt((-1 + J(jj1))*Power(1 + J(jj1),3)*(5 + 2*J(jj1))*Power(3 + 8*J(jj1) + 4*Power(J(jj1),2),2)) + (6*Power(-1 + J(jj1),2)*(-15 + 2*J(jj1)))/((3 + 2*J(jj1))*(1 + 3*J(jj1) + 2*Power(J(jj1),2))*sqrt(-5 - 2*J(jj1) + 5*Power(J(jj1),2) + 2*Power(J(jj1),3))));
+          case 88: return -2*sqrt(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3))*(8*(-1 + J(jj1))*(-13 + 4*J(jj1))*sqrt((J(jj1)*(-1 + 2*J(jj1)))/(Power(1 + 2*J(jj1),2)*Power(3 + 5*J(jj1) + 2*Power(J(jj1),2),3)*(-15 + 4*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3)))) + Power(-1 + J(jj1),2)*(-19 + 2*J(jj1))*(-1 + 2*J(jj1))*sqrt(J(jj1)/(Power(1 + 2*J(jj1),2)*Power(3 + 5*J(jj1) + 2*Power(J(jj1),2),3)*(15 - 34*J(jj1) - Power(J(jj1),2) + 16*Power(J(jj1),3) + 4*Power(J(jj1),4)))) + (100*sqrt((J(jj1)*(1 - 3*J(jj1) + 2*Power(J(jj1),2)))/(45 + 108*J(jj1) + 91*Power(J(jj1),2) + 32*Power(J(jj1),3) + 4*Power(J(jj1),4))))/(3 + 11*J(jj1) + 12*Power(J(jj1),2) + 4*Power(J(jj1),3)));
+          case 89: return (3*sqrt(10))/((1 + 2*J(jj1))*sqrt(J(jj1)*(-3 + J(jj1) + 8*Power(J(jj1),2) + 4*Power(J(jj1),3))));
+          case 90: return (-3*sqrt(6)*sqrt(3 - 5/J(jj1) + 12*J(jj1) + 4*Power(J(jj1),2)))/((1 + J(jj1))*(1 + 2*J(jj1))*(3 + 2*J(jj1)));
+          case 91: return sqrt(3)*sqrt(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3))*(-200*sqrt((Power(-1 + J(jj1),2)*J(jj1)*(-1 + 2*J(jj1)))/(Power(3 + 2*J(jj1),3)*(15 + 11*J(jj1) + 2*Power(J(jj1),2))*Power(2 + 7*J(jj1) + 7*Power(J(jj1),2) + 2*Power(J(jj1),3),2))) - (12*Power(1 - 2*J(jj1),2)*(-13 + 4*J(jj1))*sqrt(J(jj1)/(Power(2 + 3*J(jj1) + Power(J(jj1),2),2)*(-45 + 27*J(jj1) + 98*Power(J(jj1),2) + 52*Power(J(jj1),3) + 8*Power(J(jj1),4)))))/(3 + 8*J(jj1) + 4*Power(J(jj1),2)) - (6*Power(J(jj1),2)*(-1 + 2*J(jj1))*(19 - 21*J(jj1) + 2*Power(J(jj1),2)))/((2 + 3*J(jj1) + Power(J(jj1),2))*(3 + 8*J(jj1) + 4*Power(J(jj1),2))*sqrt(J(jj1)*(-45 + 27*J(jj1) + 98*Power(J(jj1),2) + 52*Power(J(jj1),3) + 8*Power(J(jj1),4)))) + (J(jj1)*(-1 + 2*J(jj1))*(1 - 15*J(jj1) + 6*Power(J(jj1),2)))/((2 + J(jj1))*(3 + 5*J(jj1) + 2*Power(J(jj1),2))*sqrt(J(jj1)*(-45 + 27*J(jj1) + 98*Power(J(jj1),2) + 52*Power(J(jj1),3) + 8*Power(J(jj1),4)))));
+          case 92: return -(sqrt(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3))*(180*(-3 + 2*J(jj1))*(-1 + 2*J(jj1))*sqrt(J(jj1)/(Power(3 + 2*J(jj1),3)*Power(10 + 19*J(jj1) + 11*Power(J(jj1),2) + 2*Power(J(jj1),3),2)*(-21 + 29*J(jj1) + 24*Power(J(jj1),2) + 4*Power(J(jj1),3)))) + (Power(1 - 2*J(jj1),2)*(-9 + J(jj1))*J(jj1)*(1 + 2*J(jj1)))/(Power(3 + 2*J(jj1),1.5)*(10 + 19*J(jj1) + 11*Power(J(jj1),2) + 2*Power(J(jj1),3))*sqrt(J(jj1)*(-21 + 29*J(jj1) + 24*Power(J(jj1),2) + 4*Power(J(jj1),3)))) + (600*sqrt((J(jj1)*(-1 + 2*J(jj1)))/(Power(2 + 3*J(jj1) + Power(J(jj1),2),2)*(63 + 81*J(jj1) + 32*Power(J(jj1),2) + 4*Power(J(jj1),3)))))/(15 + 16*J(jj1) + 4*Power(J(jj1),2)) + (36*J(jj1)*(-1 + 2*J(jj1))*(1 - 7*J(jj1) + 2*Power(J(jj1),2)))/((3 + 5*J(jj1) + 2*Power(J(jj1),2))*(10 + 9*J(jj1) + 2*Power(J(jj1),2))*sqrt(J(jj1)*(-63 + 45*J(jj1) + 130*Power(J(jj1),2) + 60*Power(J(jj1),3) + 8*Power(J(jj1),4))))));
+          case 93: return (-4*sqrt(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3))*((2*J(jj1)*(-5 + 6*J(jj1)))/(Power(3 + 2*J(jj1),1.5)*sqrt(2 + 3*J(jj1) + Power(J(jj1),2))) - (3*J(jj1)*(-5 + 2*J(jj1))*(-1 + 2*J(jj1)))/(sqrt(2 + J(jj1))*Power(3 + 5*J(jj1) + 2*Power(J(jj1),2),1.5)) - (2*J(jj1))/sqrt(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3)) + (2*J(jj1)*(-15 + 2*J(jj1))*(1 - 3*J(jj1) + 2*Power(J(jj1),2)))/(sqrt(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3))*(3 + 11*J(jj1) + 12*Power(J(jj1),2) + 4*Power(J(jj1),3))) + (5*(-3 + 11*J(jj1) - 12*Power(J(jj1),2) + 4*Power(J(jj1),3)))/(sqrt(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3))*(3 + 11*J(jj1) + 12*Power(J(jj1),2) + 4*Power(J(jj1),3)))))/(5 + 2*J(jj1));
+          case 94: return -(sqrt(0.6666666666666666)*sqrt(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3))*((-6 + 18*J(jj1))/sqrt(((2 + J(jj1))*Power(5 + 2*J(jj1),3)*(9 + 18*J(jj1) + 11*Power(J(jj1),2) + 2*Power(J(jj1),3)))/(J(jj1)*(1 + 2*J(jj1)))) + 18*sqrt((1 + 2*J(jj1))/(6 + 5*J(jj1) + Power(J(jj1),2)))*(19 - 21*J(jj1) + 2*Power(J(jj1),2))*Power(J(jj1)/(15 + 31*J(jj1) + 20*Power(J(jj1),2) + 4*Power(J(jj1),3)),1.5) + (300*(1 - 3*J(jj1) + 2*Power(J(jj1),2))*sqrt(J(jj1)/((3 + 7*J(jj1) + 2*Power(J(jj1),2))*(30 + 77*J(jj1) + 71*Power(J(jj1),2) + 28*Power(J(jj1),3) + 4*Power(J(jj1),4)))))/(15 + 31*J(jj1) + 20*Power(J(jj1),2) + 4*Power(J(jj1),3)) + (48*Power(J(jj1),2)*(-1 + 2*J(jj1))*(-13 + 4*J(jj1)))/((15 + 31*J(jj1) + 20*Power(J(jj1),2) + 4*Power(J(jj1),3))*sqrt(J(jj1)*(3 + 7*J(jj1) + 2*Power(J(jj1),2))*(30 + 77*J(jj1) + 71*Power(J(jj1),2) + 28*Power(J(jj1),3) + 4*Power(J(jj1),4)))) - (12*J(jj1)*(1 + 2*J(jj1))*(1 - 15*J(jj1) + 6*Power(J(jj1),2)))/((15 + 16*J(jj1) + 4*Power(J(jj1),2))*sqrt(J(jj1)*(2 + J(jj1))*(45 + 198*J(jj1) + 307*Power(J(jj1),2) + 214*Power(J(jj1),3) + 68*Power(J(jj1),4) + 8*Power(J(jj1),5))))));
+          case 95: return -2*sqrt(0.6666666666666666)*sqrt(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3))*((-3*(-3 + 2*J(jj1)))/sqrt(((2 + J(jj1))*Power(3 + J(jj1),2)*Power(5 + 2*J(jj1),3)*(21 + 20*J(jj1) + 4*Power(J(jj1),2)))/(J(jj1)*Power(1 + 2*J(jj1),2))) + (450*(-1 + 2*J(jj1))*sqrt(J(jj1)/(Power(1 + J(jj1),2)*(7 + 2*J(jj1))*(30 + 47*J(jj1) + 24*Power(J(jj1),2) + 4*Power(J(jj1),3)))))/(45 + 63*J(jj1) + 28*Power(J(jj1),2) + 4*Power(J(jj1),3)) + (6*J(jj1)*(1 + 2*J(jj1))*(9 - 19*J(jj1) + 2*Power(J(jj1),2)))/((3 + J(jj1))*(15 + 16*J(jj1) + 4*Power(J(jj1),2))*sqrt(J(jj1)*(210 + 389*J(jj1) + 262*Power(J(jj1),2) + 76*Power(J(jj1),3) + 8*Power(J(jj1),4)))) + (54*J(jj1)*(1 + 2*J(jj1))*(1 - 7*J(jj1) + 2*Power(J(jj1),2)))/((3 + 4*J(jj1) + Power(J(jj1),2))*(15 + 16*J(jj1) + 4*Power(J(jj1),2))*sqrt(J(jj1)*(210 + 389*J(jj1) + 262*Power(J(jj1),2) + 76*Power(J(jj1),3) + 8*Power(J(jj1),4)))) + (360*Power(J(jj1),2)*(-3 + 2*J(jj1)))/((1 + J(jj1))*(45 + 63*J(jj1) + 28*Power(J(jj1),2) + 4*Power(J(jj1),3))*sqrt(J(jj1)*(210 + 389*J(jj1) + 262*Power(J(jj1),2) + 76*Power(J(jj1),3) + 8*Power(J(jj1),4)))));
+          case 96: return -2*sqrt(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3))*((-6 + J(jj1))*sqrt((J(jj1)*(1 + J(jj1))*Power(1 + 2*J(jj1),2))/(Power(5 + 2*J(jj1),3)*(8 + 6*J(jj1) + Power(J(jj1),2))*Power(21 + 13*J(jj1) + 2*Power(J(jj1),2),2))) + (8*(1 + 2*J(jj1))*(-9 + 4*J(jj1))*sqrt((J(jj1)*(1 + J(jj1)))/(Power(21 + 13*J(jj1) + 2*Power(J(jj1),2),2)*(40 + 46*J(jj1) + 17*Power(J(jj1),2) + 2*Power(J(jj1),3)))))/(15 + 16*J(jj1) + 4*Power(J(jj1),2)) + (180*(-1 + J(jj1))*J(jj1)*(1 + 2*J(jj1)))/((21 + 13*J(jj1) + 2*Power(J(jj1),2))*(15 + 16*J(jj1) + 4*Power(J(jj1),2))*sqrt(J(jj1)*(40 + 86*J(jj1) + 63*Power(J(jj1),2) + 19*Power(J(jj1),3) + 2*Power(J(jj1),4)))) + (120*J(jj1)*(-3 + 8*J(jj1)))/((21 + 13*J(jj1) + 2*Power(J(jj1),2))*(15 + 16*J(jj1) + 4*Power(J(jj1),2))*sqrt(J(jj1)*(40 + 86*J(jj1) + 63*Power(J(jj1),2) + 19*Power(J(jj1),3) + 2*Power(J(jj1),4)))) + (1050*sqrt(J(jj1)/(40 + 86*J(jj1) + 63*Power(J(jj1),2) + 19*Power(J(jj1),3) + 2*Power(J(jj1),4))))/(315 + 531*J(jj1) + 322*Power(J(jj1),2) + 84*Power(J(jj1),3) + 8*Power(J(jj1),4)));
+          case 97: return sqrt(10)*sqrt(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3))*(-2*sqrt((1 + 2*J(jj1))/(Power(3 + J(jj1),2)*(3 + 2*J(jj1))*Power(5 + 2*J(jj1),3)))*(-1 + 3*J(jj1)) - (2*J(jj1)*(19 - 21*J(jj1) + 2*Power(J(jj1),2))*sqrt((1 + 2*J(jj1))/Power(15 + 16*J(jj1) + 4*Power(J(jj1),2),3)))/(6 + 5*J(jj1) + Power(J(jj1),2)) + sqrt((1 + 2*J(jj1))/(15 + 16*J(jj1) + 4*Power(J(jj1),2)))/(3 + J(jj1)) - (2*J(jj1)*(-1 + 2*J(jj1))*sqrt(1 + 2*J(jj1))*(-13 + 4*J(jj1)))/(Power(15 + 16*J(jj1) + 4*Power(J(jj1),2),1.5)*(6 + 11*J(jj1) + 6*Power(J(jj1),2) + Power(J(jj1),3))) + ((1 + 2*J(jj1))*(1 - 15*J(jj1) + 6*Power(J(jj1),2)))/((3 + J(jj1))*(10 + 9*J(jj1) + 2*Power(J(jj1),2))*sqrt(15 + 46*J(jj1) + 36*Power(J(jj1),2) + 8*Power(J(jj1),3))) - (20*J(jj1)*(1 - 3*J(jj1) + 2*Power(J(jj1),2)))/((15 + 16*J(jj1) + 4*Power(J(jj1),2))*(6 + 11*J(jj1) + 6*Power(J(jj1),2) + Power(J(jj1),3))*sqrt(15 + 46*J(jj1) + 36*Power(J(jj1),2) + 8*Power(J(jj1),3))));
+          case 98: return -(sqrt(30)/sqrt((5 + 2*J(jj1))*(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3))));
+          case 99: return -(sqrt(15)*sqrt(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3))*(-(((1 + 2*J(jj1))*sqrt((2 + 3*J(jj1) + Power(J(jj1),2))/((5 + 2*J(jj1))*Power(28 + 15*J(jj1) + 2*Power(J(jj1),2),2))))/(3 + J(jj1))) + (2*(-6 + J(jj1))*(1 + 2*J(jj1))*sqrt((2 + 3*J(jj1) + Power(J(jj1),2))/((5 + 2*J(jj1))*Power(28 + 15*J(jj1) + 2*Power(J(jj1),2),2))))/(15 + 11*J(jj1) + 2*Power(J(jj1),2)) + 4*(-9 + 4*J(jj1))*sqrt(((1 + J(jj1))*Power(1 + 2*J(jj1),2))/((2 + J(jj1))*Power(5 + 2*J(jj1),3)*Power(84 + 73*J(jj1) + 21*Power(J(jj1),2) + 2*Power(J(jj1),3),2))) + (120*(-1 + J(jj1))*(1 + 2*J(jj1))*sqrt((1 + J(jj1))/((10 + 9*J(jj1) + 2*Power(J(jj1),2))*Power(28 + 15*J(jj1) + 2*Power(J(jj1),2),2))))/(45 + 63*J(jj1) + 28*Power(J(jj1),2) + 4*Power(J(jj1),3)) + (420*J(jj1))/((9 + 9*J(jj1) + 2*Power(J(jj1),2))*sqrt(10 + 19*J(jj1) + 11*Power(J(jj1),2) + 2*Power(J(jj1),3))*(140 + 131*J(jj1) + 40*Power(J(jj1),2) + 4*Power(J(jj1),3))) + (30*(1 + 2*J(jj1))*(-3 + 8*J(jj1)))/((5 + 2*J(jj1))*sqrt(10 + 19*J(jj1) + 11*Power(J(jj1),2) + 2*Power(J(jj1),3))*(252 + 387*J(jj1) + 209*Power(J(jj1),2) + 48*Power(J(jj1),3) + 4*Power(J(jj1),4)))));
+          case 100: return -1;
+          case 101: return 1;
+          case 102: return 1;
+          case 103: return sqrt((-2 + J(jj1) + 5*Power(J(jj1),2) + 2*Power(J(jj1),3))/(1 + 2*J(jj1)))/(1 + J(jj1));
+          case 104: return -((sqrt(3)*sqrt(6 + 7*J(jj1) + 2*Power(J(jj1),2)))/(3 + 5*J(jj1) + 2*Power(J(jj1),2)));
+          case 105: return (5 + 2*J(jj1))/sqrt(31 + 15/J(jj1) + 20*J(jj1) + 4*Power(J(jj1),2));
+          case 106: return sqrt(3)/((1 + J(jj1))*sqrt(3 + 8*J(jj1) + 4*Power(J(jj1),2)));
+          case 107: return -(sqrt(3)/sqrt((1 + J(jj1))*(3 + 2*J(jj1))));
+          case 108: return 1;
+          case 109: return sqrt((-6 + J(jj1) + 2*Power(J(jj1),2))/(J(jj1)*(1 + 2*J(jj1))));
+          case 110: return -((sqrt(0.6666666666666666)*sqrt((6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3))/(-1 + J(jj1)))*(-6/sqrt((J(jj1)*Power(1 + 2*J(jj1),2)*(3 + 2*J(jj1)))/(1 - 3*J(jj1) + 2*Power(J(jj1),2))) + (6*sqrt((J(jj1)*(1 - 3*J(jj1) + 2*Power(J(jj1),2)))/(3 + 2*J(jj1))))/(1 + 2*J(jj1)) - 3*(-1 + J(jj1))*sqrt((Power(3 - 2*J(jj1),2)*(-1 + 2*J(jj1)))/(J(jj1)*Power(1 + 2*J(jj1),2)*(-3 + J(jj1) + 2*Power(J(jj1),2))))))/(1 + J(jj1)));
+          case 111: return sqrt((-5 + 3*J(jj1) + 2*Power(J(jj1),2))*(-2 + 3*J(jj1) + 2*Power(J(jj1),2)))/((1 + J(jj1))*(1 + 2*J(jj1)));
+          case 112: return (3*sqrt(2)*sqrt((2 + J(jj1))/(3*J(jj1) + 8*Power(J(jj1),2) + 4*Power(J(jj1),3))))/(1 + J(jj1));
+          case 113: return 3*sqrt(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3))*((16*(-1 + J(jj1))*sqrt((-1 + 2*J(jj1))/(5 + 12*J(jj1) + 4*Power(J(jj1),2))))/Power(3 + 5*J(jj1) + 2*Power(J(jj1),2),1.5) - (2*J(jj1)*(-3 + 2*J(jj1))*(-1 + 2*J(jj1)))/(Power(3 + 5*J(jj1) + 2*Power(J(jj1),2),1.5)*sqrt(-5 - 2*J(jj1) + 20*Power(J(jj1),2) + 8*Power(J(jj1),3))) + (Power(1 - 2*J(jj1),2)*(-11 + 2*J(jj1)))/((3 + 5*J(jj1) + 2*Power(J(jj1),2))*sqrt(-15 - 31*J(jj1) + 40*Power(J(jj1),2) + 120*Power(J(jj1),3) + 80*Power(J(jj1),4) + 16*Power(J(jj1),5))));
+          case 114: return sqrt(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3))*(60*sqrt((J(jj1)*(-1 + 2*J(jj1)))/(Power(3 + 5*J(jj1) + 2*Power(J(jj1),2),3)*(30 + 37*J(jj1) + 15*Power(J(jj1),2) + 2*Power(J(jj1),3)))) + 24*(-2 + J(jj1))*(-1 + 2*J(jj1))*sqrt(J(jj1)/(Power(3 + 5*J(jj1) + 2*Power(J(jj1),2),3)*(-30 + 23*J(jj1) + 59*Power(J(jj1),2) + 28*Power(J(jj1),3) + 4*Power(J(jj1),4)))) + (J(jj1)*(-1 + 2*J(jj1))*(3 - 13*J(jj1) + 2*Power(J(jj1),2)))/((3 + 5*J(jj1) + 2*Power(J(jj1),2))*sqrt(J(jj1)*(-90 - 81*J(jj1) + 232*Power(J(jj1),2) + 425*Power(J(jj1),3) + 270*Power(J(jj1),4) + 76*Power(J(jj1),5) + 8*Power(J(jj1),6)))));
+          case 115: return (-3*sqrt((6 + 4*J(jj1))/(J(jj1)*Power(1 + 2*J(jj1),2))))/(3 + 5*J(jj1) + 2*Power(J(jj1),2));
+          case 116: return (3*J(jj1)*(5 + 2*J(jj1))*sqrt((9 + 6*J(jj1))/(J(jj1)*Power(1 + 2*J(jj1),2)*(10 + 9*J(jj1) + 2*Power(J(jj1),2)))))/(3 + 5*J(jj1) + 2*Power(J(jj1),2));
+          case 117: return (-3*J(jj1)*(3 + J(jj1)))/((1 + J(jj1))*sqrt(J(jj1)*(3 + J(jj1))*(6 + 7*J(jj1) + 2*Power(J(jj1),2))));
+          case 118: return (7 + 2*J(jj1))*sqrt(J(jj1)/(42 + 61*J(jj1) + 28*Power(J(jj1),2) + 4*Power(J(jj1),3)));
+          case 119: return (-3*sqrt(2))/(sqrt((2 + J(jj1))*(1 + 2*J(jj1)))*(3 + 5*J(jj1) + 2*Power(J(jj1),2)));
+          case 120: return (3*sqrt(12 + 26*J(jj1) + 18*Power(J(jj1),2) + 4*Power(J(jj1),3)))/(Power(3 + 2*J(jj1),1.5)*(2 + 3*J(jj1) + Power(J(jj1),2)));
+          case 121: return -(sqrt(6)/sqrt((2 + J(jj1))*(3 + 2*J(jj1))));
+          case 122: return 1;
+          case 123: return sqrt((-6 + J(jj1) + 2*Power(J(jj1),2))/(J(jj1)*(1 + 2*J(jj1))));
+          case 124: return -((sqrt(0.6666666666666666)*sqrt((6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3))/(-1 + J(jj1)))*(-6/sqrt((J(jj1)*Power(1 + 2*J(jj1),2)*(3 + 2*J(jj1)))/(1 - 3*J(jj1) + 2*Power(J(jj1),2))) + (6*sqrt((J(jj1)*(1 - 3*J(jj1) + 2*Power(J(jj1),2)))/(3 + 2*J(jj1))))/(1 + 2*J(jj1)) - 3*(-1 + J(jj1))*sqrt((Power(3 - 2*J(jj1),2)*(-1 + 2*J(jj1)))/(J(jj1)*Power(1 + 2*J(jj1),2)*(-3 + J(jj1) + 2*Power(J(jj1),2))))))/(1 + J(jj1)));
+          case 125: return sqrt((-5 + 3*J(jj1) + 2*Power(J(jj1),2))*(-2 + 3*J(jj1) + 2*Power(J(jj1),2)))/((1 + J(jj1))*(1 + 2*J(jj1)));
+          case 126: return (3*sqrt(2)*sqrt((2 + J(jj1))/(3*J(jj1) + 8*Power(J(jj1),2) + 4*Power(J(jj1),3))))/(1 + J(jj1));
+          case 127: return 3*sqrt(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3))*((16*(-1 + J(jj1))*sqrt((-1 + 2*J(jj1))/(5 + 12*J(jj1) + 4*Power(J(jj1),2))))/Power(3 + 5*J(jj1) + 2*Power(J(jj1),2),1.5) - (2*J(jj1)*(-3 + 2*J(jj1))*(-1 + 2*J(jj1)))/(Power(3 + 5*J(jj1) + 2*Power(J(jj1),2),1.5)*sqrt(-5 - 2*J(jj1) + 20*Power(J(jj1),2) + 8*Power(J(jj1),3))) + (Power(1 - 2*J(jj1),2)*(-11 + 2*J(jj1)))/((3 + 5*J(jj1) + 2*Power(J(jj1),2))*sqrt(-15 - 31*J(jj1) + 40*Power(J(jj1),2) + 120*Power(J(jj1),3) + 80*Power(J(jj1),4) + 16*Power(J(jj1),5))));
+          case 128: return sqrt(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3))*(60*sqrt((J(jj1)*(-1 + 2*J(jj1)))/(Power(3 + 5*J(jj1) + 2*Power(J(jj1),2),3)*(30 + 37*J(jj1) + 15*Power(J(jj1),2) + 2*Power(J(jj1),3)))) + 24*(-2 + J(jj1))*(-1 + 2*J(jj1))*sqrt(J(jj1)/(Power(3 + 5*J(jj1) + 2*Power(J(jj1),2),3)*(-30 + 23*J(jj1) + 59*Power(J(jj1),2) + 28*Power(J(jj1),3) + 4*Power(J(jj1),4)))) + (J(jj1)*(-1 + 2*J(jj1))*(3 - 13*J(jj1) + 2*Power(J(jj1),2)))/((3 + 5*J(jj1) + 2*Power(J(jj1),2))*sqrt(J(jj1)*(-90 - 81*J(jj1) + 232*Power(J(jj1),2) + 425*Power(J(jj1),3) + 270*Power(J(jj1),4) + 76*Power(J(jj1),5) + 8*Power(J(jj1),6)))));
+          case 129: return (-3*sqrt((6 + 4*J(jj1))/(J(jj1)*Power(1 + 2*J(jj1),2))))/(3 + 5*J(jj1) + 2*Power(J(jj1),2));
+          case 130: return (3*J(jj1)*(5 + 2*J(jj1))*sqrt((9 + 6*J(jj1))/(J(jj1)*Power(1 + 2*J(jj1),2)*(10 + 9*J(jj1) + 2*Power(J(jj1),2)))))/(3 + 5*J(jj1) + 2*Power(J(jj1),2));
+          case 131: return (-3*J(jj1)*(3 + J(jj1)))/((1 + J(jj1))*sqrt(J(jj1)*(3 + J(jj1))*(6 + 7*J(jj1) + 2*Power(J(jj1),2))));
+          case 132: return (7 + 2*J(jj1))*sqrt(J(jj1)/(42 + 61*J(jj1) + 28*Power(J(jj1),2) + 4*Power(J(jj1),3)));
+          case 133: return (-3*sqrt(2))/(sqrt((2 + J(jj1))*(1 + 2*J(jj1)))*(3 + 5*J(jj1) + 2*Power(J(jj1),2)));
+          case 134: return (3*sqrt(12 + 26*J(jj1) + 18*Power(J(jj1),2) + 4*Power(J(jj1),3)))/(Power(3 + 2*J(jj1),1.5)*(2 + 3*J(jj1) + Power(J(jj1),2)));
+          case 135: return -(sqrt(6)/sqrt((2 + J(jj1))*(3 + 2*J(jj1))));
+          case 136: return 1;
+          case 137: return (-2*sqrt((J(jj1)*(6 + 7*J(jj1) + 2*Power(J(jj1),2)))/(1 + 2*J(jj1))))/(3 + 2*J(jj1));
+          case 138: return sqrt(3)/sqrt(3 + 8*J(jj1) + 4*Power(J(jj1),2));
+          case 139: return -1;
+          case 140: return (-2*sqrt(-2 + J(jj1) + Power(J(jj1),2)))/(1 + 2*J(jj1));
+          case 141: return (3*(sqrt(J(jj1)*(2 + J(jj1))) + 4*sqrt(Power(J(jj1),3)*(2 + J(jj1))) + 4*sqrt(Power(J(jj1),5)*(2 + J(jj1)))))/((1 + J(jj1))*Power(1 + 2*J(jj1),3));
+          case 142: return ((5 - 8*J(jj1) - 4*Power(J(jj1),2))*sqrt((J(jj1)*(6 + 7*J(jj1) + 2*Power(J(jj1),2)))/(-5 - 2*J(jj1) + 20*Power(J(jj1),2) + 8*Power(J(jj1),3))))/((1 + J(jj1))*(3 + 2*J(jj1)));
+          case 143: return (-6*sqrt(2 + 3*J(jj1) + Power(J(jj1),2)))/(3 + 11*J(jj1) + 12*Power(J(jj1),2) + 4*Power(J(jj1),3));
+          case 144: return (2*sqrt(3)*J(jj1)*(5 + 2*J(jj1)))/((3 + 2*J(jj1))*sqrt(J(jj1)*(1 + 2*J(jj1))*(5 + 7*J(jj1) + 2*Power(J(jj1),2))));
+          case 145: return (-2*sqrt(J(jj1)*(3 + J(jj1))))/(3 + 2*J(jj1));
+          case 146: return 3/(3 + 11*J(jj1) + 12*Power(J(jj1),2) + 4*Power(J(jj1),3));
+          case 147: return -3/(3 + 5*J(jj1) + 2*Power(J(jj1),2));
+          case 148: return 3/(3 + 2*J(jj1));
+          case 149: return -1;
+          case 150: return 1;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(1, 4));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(1, 4));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -104,10 +848,370 @@ MatrixElements<SC> SymmetryQJ<SC>::recalc_quadruplet(const DiagInfo<SC> &diag, c
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "qj/qj-quad2.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {2, 3},
+        {3, 2},
+        {3, 3},
+        {4, 4},
+        {4, 5},
+        {5, 4},
+        {5, 5},
+        {5, 6},
+        {6, 4},
+        {6, 5},
+        {6, 6},
+        {6, 7},
+        {7, 5},
+        {7, 6},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {10, 10},
+        {10, 11},
+        {11, 10},
+        {11, 11},
+        {11, 12},
+        {12, 10},
+        {12, 11},
+        {12, 12},
+        {13, 13},
+        {13, 14},
+        {14, 13},
+        {14, 14},
+        {14, 15},
+        {15, 13},
+        {15, 14},
+        {15, 15},
+        {15, 16},
+        {16, 14},
+        {16, 15},
+        {16, 16},
+        {16, 17},
+        {17, 15},
+        {17, 16},
+        {17, 17},
+        {18, 18},
+        {18, 19},
+        {19, 18},
+        {19, 19},
+        {19, 20},
+        {20, 18},
+        {20, 19},
+        {20, 20},
+        {20, 21},
+        {21, 19},
+        {21, 20},
+        {21, 21},
+        {21, 22},
+        {22, 20},
+        {22, 21},
+        {22, 22},
+        {23, 23},
+        {23, 24},
+        {24, 23},
+        {24, 24},
+        {25, 25},
+        {25, 26},
+        {26, 25},
+        {26, 26},
+        {26, 27},
+        {27, 25},
+        {27, 26},
+        {27, 27},
+        {27, 28},
+        {28, 26},
+        {28, 27},
+        {28, 28},
+        {29, 29},
+        {29, 30},
+        {30, 29},
+        {30, 30},
+        {30, 31},
+        {31, 29},
+        {31, 30},
+        {31, 31},
+        {31, 32},
+        {32, 30},
+        {32, 31},
+        {32, 32},
+        {33, 33},
+        {33, 34},
+        {34, 33},
+        {34, 34},
+        {34, 35},
+        {35, 33},
+        {35, 34},
+        {35, 35},
+        {35, 36},
+        {36, 34},
+        {36, 35},
+        {36, 36},
+        {37, 37},
+        {37, 38},
+        {38, 37},
+        {38, 38},
+        {38, 39},
+        {39, 37},
+        {39, 38},
+        {39, 39},
+        {39, 40},
+        {40, 38},
+        {40, 39},
+        {40, 40},
+        {40, 41},
+        {41, 39},
+        {41, 40},
+        {41, 41},
+        {41, 42},
+        {42, 40},
+        {42, 41},
+        {42, 42},
+        {43, 43},
+        {44, 44},
+        {45, 45},
+        {45, 46},
+        {46, 45},
+        {46, 46},
+        {46, 47},
+        {47, 45},
+        {47, 46},
+        {47, 47},
+        {48, 48},
+        {48, 49},
+        {49, 48},
+        {49, 49},
+        {49, 50},
+        {50, 48},
+        {50, 49},
+        {50, 50},
+        {50, 51},
+        {51, 49},
+        {51, 50},
+        {51, 51},
+        {51, 52},
+        {52, 50},
+        {52, 51},
+        {52, 52},
+        {53, 53},
+        {53, 54},
+        {54, 53},
+        {54, 54},
+        {54, 55},
+        {55, 53},
+        {55, 54},
+        {55, 55},
+        {55, 56},
+        {56, 54},
+        {56, 55},
+        {56, 56},
+        {56, 57},
+        {57, 55},
+        {57, 56},
+        {57, 57},
+        {58, 58},
+        {58, 59},
+        {59, 58},
+        {59, 59},
+        {60, 60},
+        {60, 61},
+        {61, 60},
+        {61, 61},
+        {61, 62},
+        {62, 60},
+        {62, 61},
+        {62, 62},
+        {62, 63},
+        {63, 61},
+        {63, 62},
+        {63, 63},
+        {64, 64}
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(1, 4));
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return -(sqrt(-3 + 4*J(jj1) + 4*Power(J(jj1),2))/(1 + 2*J(jj1)));
+          case 2: return -(sqrt(3)/sqrt(3 + 8*J(jj1) + 4*Power(J(jj1),2)));
+          case 3: return 2/(1 + 2*J(jj1));
+          case 4: return -sqrt((J(jj1)*(1 + 2*J(jj1)))/(6 + 7*J(jj1) + 2*Power(J(jj1),2))) - 3*sqrt(J(jj1)/(6 + 19*J(jj1) + 16*Power(J(jj1),2) + 4*Power(J(jj1),3)));
+          case 5: return -(sqrt((9 - 13*Power(J(jj1),2) + 4*Power(J(jj1),4))/(-1 + 4*Power(J(jj1),2)))/J(jj1));
+          case 6: return (-3*sqrt(-1 + Power(J(jj1),2)))/(J(jj1) + 2*Power(J(jj1),2));
+          case 7: return (6*sqrt(((-(1/J(jj1)) + J(jj1))*(3 + 5*J(jj1) + 2*Power(J(jj1),2)))/(-3 + 6*J(jj1))))/((1 + J(jj1))*(1 + 2*J(jj1)));
+          case 8: return (6*sqrt(1 + 1/J(jj1)) + 10*sqrt(J(jj1)*(1 + J(jj1))) - 6*sqrt(Power(J(jj1),3)*(1 + J(jj1))) - 4*sqrt(Power(J(jj1),5)*(1 + J(jj1))))/((1 + J(jj1))*Power(1 + 2*J(jj1),2));
+          case 9: return (-2*sqrt(3)*(-2 + 3*J(jj1) + 2*Power(J(jj1),2)))/((1 + 2*J(jj1))*sqrt(-6 - J(jj1) + 17*Power(J(jj1),2) + 16*Power(J(jj1),3) + 4*Power(J(jj1),4)));
+          case 10: return -3/(J(jj1) + 2*Power(J(jj1),2));
+          case 11: return -((sqrt((3 + 5*J(jj1) + 2*Power(J(jj1),2))/(1 + 2*J(jj1)))*(9*sqrt((1 + J(jj1))/(1 + 2*J(jj1))) + 8*Power(J(jj1),3)*sqrt((1 + J(jj1))/(1 + 2*J(jj1))) + 3*J(jj1)*(-5*sqrt((1 + J(jj1))/(1 + 2*J(jj1))) + sqrt(1 + 3*J(jj1) + 2*Power(J(jj1),2))) - 2*Power(J(jj1),2)*(5*sqrt((1 + J(jj1))/(1 + 2*J(jj1))) + 2*sqrt(1 + 3*J(jj1) + 2*Power(J(jj1),2)))))/(J(jj1)*(1 + J(jj1))*Power(3 + 2*J(jj1),1.5)));
+          case 12: return (5*sqrt((Power(J(jj1),3)*(1 + 3*J(jj1) + 2*Power(J(jj1),2)))/(2 + J(jj1))) - 2*sqrt((Power(J(jj1),5)*(1 + 3*J(jj1) + 2*Power(J(jj1),2)))/(2 + J(jj1))) + 24*J(jj1)*sqrt((J(jj1)*(1 + J(jj1)))/(2 + 5*J(jj1) + 2*Power(J(jj1),2))) - 18*sqrt((Power(1 - 2*J(jj1),2)*J(jj1)*(1 + J(jj1)))/(2 + 5*J(jj1) + 2*Power(J(jj1),2))) - 24*sqrt((Power(J(jj1),5)*(1 + J(jj1)))/(2 + 5*J(jj1) + 2*Power(J(jj1),2))))/((3 + 2*J(jj1))*sqrt(J(jj1)*(1 + J(jj1))*(2 + 5*J(jj1) + 2*Power(J(jj1),2))));
+          case 13: return (-3*(10*sqrt((J(jj1)*(1 + J(jj1)))/(10 + 9*J(jj1) + 2*Power(J(jj1),2))) + 9*sqrt((Power(J(jj1),3)*(1 + J(jj1)))/(10 + 9*J(jj1) + 2*Power(J(jj1),2))) + 2*sqrt((Power(J(jj1),5)*(1 + J(jj1)))/(10 + 9*J(jj1) + 2*Power(J(jj1),2)))))/((3 + 2*J(jj1))*sqrt(J(jj1)*(1 + J(jj1))*(10 + 9*J(jj1) + 2*Power(J(jj1),2))));
+          case 14: return (-6*(2 + J(jj1)))/(sqrt(2 + 3*J(jj1) + Power(J(jj1),2))*(3 + 8*J(jj1) + 4*Power(J(jj1),2)));
+          case 15: return 2*sqrt(3)*(5 + 2*J(jj1))*sqrt(J(jj1)/(Power(3 + 2*J(jj1),2)*(5 + 17*J(jj1) + 16*Power(J(jj1),2) + 4*Power(J(jj1),3))));
+          case 16: return (-2*sqrt(J(jj1)*(3 + J(jj1))))/(3 + 2*J(jj1));
+          case 17: return 1;
+          case 18: return 1;
+          case 19: return sqrt(3 - 4*J(jj1) - 7*Power(J(jj1),2) + 4*Power(J(jj1),3) + 4*Power(J(jj1),4))/(J(jj1) + 2*Power(J(jj1),2));
+          case 20: return 1/sqrt((J(jj1)*Power(1 + 2*J(jj1),2))/(-3 + 6*J(jj1)));
+          case 21: return -(sqrt((-3 + 4*J(jj1) + 4*Power(J(jj1),2))/(1 + 3*J(jj1) + 2*Power(J(jj1),2)))/J(jj1));
+          case 22: return (-3 + 3*J(jj1) + 2*Power(J(jj1),2))/sqrt(J(jj1)*(1 + 2*J(jj1))*(3 + 5*J(jj1) + 2*Power(J(jj1),2)));
+          case 23: return sqrt(3)/sqrt(3 + 5*J(jj1) + 2*Power(J(jj1),2));
+          case 24: return sqrt(3)/(sqrt(J(jj1)*(1 + J(jj1)))*(1 + 2*J(jj1)));
+          case 25: return (-3*sqrt((J(jj1)*(1 + 2*J(jj1)))/(2 + 3*J(jj1) + Power(J(jj1),2))) + 2*J(jj1)*sqrt((J(jj1)*(1 + 2*J(jj1)))/(2 + 3*J(jj1) + Power(J(jj1),2))) - 2*sqrt((J(jj1)*(1 + 3*J(jj1) + 2*Power(J(jj1),2)))/(2 + J(jj1))) + 3*(-1 + 2*J(jj1))*sqrt(J(jj1)/(2 + 7*J(jj1) + 7*Power(J(jj1),2) + 2*Power(J(jj1),3))))/sqrt(3 + 8*J(jj1) + 4*Power(J(jj1),2));
+          case 26: return ((1 + 2*J(jj1))*sqrt((J(jj1)*(1 + J(jj1)))/(10 + 9*J(jj1) + 2*Power(J(jj1),2))) + 6*sqrt(J(jj1)/(10 + 19*J(jj1) + 11*Power(J(jj1),2) + 2*Power(J(jj1),3))) + 3*(1 + 2*J(jj1))*sqrt(J(jj1)/(10 + 19*J(jj1) + 11*Power(J(jj1),2) + 2*Power(J(jj1),3))))/sqrt(6 + 7*J(jj1) + 2*Power(J(jj1),2));
+          case 27: return sqrt(((6 - 7*J(jj1) + 2*Power(J(jj1),2))*(3 + 5*J(jj1) + 2*Power(J(jj1),2)))/(J(jj1)*(1 - J(jj1) - 4*Power(J(jj1),2) + 4*Power(J(jj1),3))));
+          case 28: return sqrt(6)*sqrt((3 + J(jj1) - 2*Power(J(jj1),2))/(Power(J(jj1),2) - 4*Power(J(jj1),4)));
+          case 29: return -(sqrt((18 - 8*Power(J(jj1),2))/(1 + J(jj1) - 2*Power(J(jj1),2)))/J(jj1));
+          case 30: return (-9 + J(jj1) + 2*Power(J(jj1),2))/(J(jj1)*(1 + 2*J(jj1)));
+          case 31: return (3*sqrt((-2 + J(jj1) + Power(J(jj1),2))*(-1 + J(jj1) + 2*Power(J(jj1),2))))/(J(jj1)*(1 + J(jj1))*(1 + 2*J(jj1)));
+          case 32: return (3*sqrt(2))/(J(jj1)*sqrt(-1 + 4*Power(J(jj1),2)));
+          case 33: return -(((-9 + 4*J(jj1) + 4*Power(J(jj1),2))*sqrt((9 + 15*J(jj1) + 6*Power(J(jj1),2))/(-1 + 4*Power(J(jj1),2))))/(J(jj1)*(1 + J(jj1))*(3 + 2*J(jj1))));
+          case 34: return (18 - 33*J(jj1) - 13*Power(J(jj1),2) + 12*Power(J(jj1),3) + 4*Power(J(jj1),4))/(J(jj1)*(3 + 2*J(jj1))*sqrt((1 + J(jj1))*(-2 - J(jj1) + 8*Power(J(jj1),2) + 4*Power(J(jj1),3))));
+          case 35: return 3*sqrt(3 + 5*J(jj1) + 2*Power(J(jj1),2))*(20/sqrt((Power(3 + 2*J(jj1),3)*Power(2 + 3*J(jj1) + Power(J(jj1),2),2)*(5 + 12*J(jj1) + 4*Power(J(jj1),2)))/(-1 + 2*J(jj1))) + (J(jj1)*(-3 + 2*J(jj1))*(-1 + 2*J(jj1)))/(Power(3 + 2*J(jj1),1.5)*(2 + 3*J(jj1) + Power(J(jj1),2))*sqrt(-5 - 2*J(jj1) + 20*Power(J(jj1),2) + 8*Power(J(jj1),3))) + (2*(-1 + 2*J(jj1))*(-5 + 6*J(jj1)))/((3 + 2*J(jj1))*(2 + 3*J(jj1) + Power(J(jj1),2))*sqrt(-15 - 16*J(jj1) + 56*Power(J(jj1),2) + 64*Power(J(jj1),3) + 16*Power(J(jj1),4))));
+          case 36: return (3*sqrt(3)*sqrt(-6 - J(jj1) + 17*Power(J(jj1),2) + 16*Power(J(jj1),3) + 4*Power(J(jj1),4)))/(3*J(jj1) + 11*Power(J(jj1),2) + 12*Power(J(jj1),3) + 4*Power(J(jj1),4));
+          case 37: return (-2*(-3 + 4*J(jj1) + 2*Power(J(jj1),2)))/((1 + J(jj1))*(1 + 2*J(jj1))*(3 + 2*J(jj1))*sqrt((J(jj1)*(2 + J(jj1)))/(9 + 15*J(jj1) + 6*Power(J(jj1),2))));
+          case 38: return (-60*sqrt((J(jj1)*(3 + 2*J(jj1)))/(5 + 2*J(jj1))) - 4*sqrt((Power(J(jj1),3)*(3 + 2*J(jj1)))/(5 + 2*J(jj1))) + 53*sqrt((Power(J(jj1),5)*(3 + 2*J(jj1)))/(5 + 2*J(jj1))) + 28*sqrt((Power(J(jj1),7)*(3 + 2*J(jj1)))/(5 + 2*J(jj1))) + 4*sqrt((Power(J(jj1),9)*(3 + 2*J(jj1)))/(5 + 2*J(jj1))))/sqrt(J(jj1)*(1 + J(jj1))*Power(2 + J(jj1),3)*Power(3 + 2*J(jj1),2)*(5 + 12*J(jj1) + 4*Power(J(jj1),2)));
+          case 39: return (sqrt(6)*(30*sqrt((J(jj1)*(3 + 5*J(jj1) + 2*Power(J(jj1),2)))/(15 + 11*J(jj1) + 2*Power(J(jj1),2))) + 37*sqrt((Power(J(jj1),3)*(3 + 5*J(jj1) + 2*Power(J(jj1),2)))/(15 + 11*J(jj1) + 2*Power(J(jj1),2))) + 15*sqrt((Power(J(jj1),5)*(3 + 5*J(jj1) + 2*Power(J(jj1),2)))/(15 + 11*J(jj1) + 2*Power(J(jj1),2))) + 2*sqrt((Power(J(jj1),7)*(3 + 5*J(jj1) + 2*Power(J(jj1),2)))/(15 + 11*J(jj1) + 2*Power(J(jj1),2)))))/sqrt(J(jj1)*(1 + J(jj1))*Power(2 + J(jj1),3)*Power(3 + 2*J(jj1),2)*(15 + 11*J(jj1) + 2*Power(J(jj1),2)));
+          case 40: return sqrt(6 + 10*J(jj1) + 4*Power(J(jj1),2))*(3*(-2 + J(jj1))*sqrt((Power(1 - 2*J(jj1),2)*(1 + 2*J(jj1)))/(Power(1 + J(jj1),2)*(5 + 2*J(jj1))*Power(6 + 7*J(jj1) + 2*Power(J(jj1),2),3))) + (2 + 2*J(jj1) - 4*Power(J(jj1),2))/((2 + J(jj1))*sqrt((5 + 2*J(jj1))*(6 + 19*J(jj1) + 16*Power(J(jj1),2) + 4*Power(J(jj1),3)))) + sqrt((1 + 2*J(jj1))/(30 + 47*J(jj1) + 24*Power(J(jj1),2) + 4*Power(J(jj1),3))) + (6*(1 - 3*J(jj1) + 2*Power(J(jj1),2)))/((1 + J(jj1))*(6 + 7*J(jj1) + 2*Power(J(jj1),2))*sqrt(30 + 107*J(jj1) + 118*Power(J(jj1),2) + 52*Power(J(jj1),3) + 8*Power(J(jj1),4))) + (6 + J(jj1) - 20*Power(J(jj1),2) + 4*Power(J(jj1),3))/((6 + 7*J(jj1) + 2*Power(J(jj1),2))*sqrt(30 + 107*J(jj1) + 118*Power(J(jj1),2) + 52*Power(J(jj1),3) + 8*Power(J(jj1),4))));
+          case 41: return -4*sqrt(2)*(3 + J(jj1))*sqrt(J(jj1)/((1 + 2*J(jj1))*Power(3 + 2*J(jj1),2)*(6 + 5*J(jj1) + Power(J(jj1),2))));
+          case 42: return (7 + 2*J(jj1))*sqrt(J(jj1)/(42 + 61*J(jj1) + 28*Power(J(jj1),2) + 4*Power(J(jj1),3)));
+          case 43: return sqrt(((6 - 7*J(jj1) + 2*Power(J(jj1),2))*(3 + 5*J(jj1) + 2*Power(J(jj1),2)))/(J(jj1)*(1 - J(jj1) - 4*Power(J(jj1),2) + 4*Power(J(jj1),3))));
+          case 44: return sqrt(6)*sqrt((3 + J(jj1) - 2*Power(J(jj1),2))/(Power(J(jj1),2) - 4*Power(J(jj1),4)));
+          case 45: return -(sqrt((18 - 8*Power(J(jj1),2))/(1 + J(jj1) - 2*Power(J(jj1),2)))/J(jj1));
+          case 46: return (-9 + J(jj1) + 2*Power(J(jj1),2))/(J(jj1)*(1 + 2*J(jj1)));
+          case 47: return (3*sqrt((-2 + J(jj1) + Power(J(jj1),2))*(-1 + J(jj1) + 2*Power(J(jj1),2))))/(J(jj1)*(1 + J(jj1))*(1 + 2*J(jj1)));
+          case 48: return (3*sqrt(2))/(J(jj1)*sqrt(-1 + 4*Power(J(jj1),2)));
+          case 49: return -(((-9 + 4*J(jj1) + 4*Power(J(jj1),2))*sqrt((9 + 15*J(jj1) + 6*Power(J(jj1),2))/(-1 + 4*Power(J(jj1),2))))/(J(jj1)*(1 + J(jj1))*(3 + 2*J(jj1))));
+          case 50: return (18 - 33*J(jj1) - 13*Power(J(jj1),2) + 12*Power(J(jj1),3) + 4*Power(J(jj1),4))/(J(jj1)*(3 + 2*J(jj1))*sqrt((1 + J(jj1))*(-2 - J(jj1) + 8*Power(J(jj1),2) + 4*Power(J(jj1),3))));
+          case 51: return 3*sqrt(3 + 5*J(jj1) + 2*Power(J(jj1),2))*(20/sqrt((Power(3 + 2*J(jj1),3)*Power(2 + 3*J(jj1) + Power(J(jj1),2),2)*(5 + 12*J(jj1) + 4*Power(J(jj1),2)))/(-1 + 2*J(jj1))) + (J(jj1)*(-3 + 2*J(jj1))*(-1 + 2*J(jj1)))/(Power(3 + 2*J(jj1),1.5)*(2 + 3*J(jj1) + Power(J(jj1),2))*sqrt(-5 - 2*J(jj1) + 20*Power(J(jj1),2) + 8*Power(J(jj1),3))) + (2*(-1 + 2*J(jj1))*(-5 + 6*J(jj1)))/((3 + 2*J(jj1))*(2 + 3*J(jj1) + Power(J(jj1),2))*sqrt(-15 - 16*J(jj1) + 56*Power(J(jj1),2) + 64*Power(J(jj1),3) + 16*Power(J(jj1),4))));
+          case 52: return (3*sqrt(3)*sqrt(-6 - J(jj1) + 17*Power(J(jj1),2) + 16*Power(J(jj1),3) + 4*Power(J(jj1),4)))/(3*J(jj1) + 11*Power(J(jj1),2) + 12*Power(J(jj1),3) + 4*Power(J(jj1),4));
+          case 53: return (-2*(-3 + 4*J(jj1) + 2*Power(J(jj1),2)))/((1 + J(jj1))*(1 + 2*J(jj1))*(3 + 2*J(jj1))*sqrt((J(jj1)*(2 + J(jj1)))/(9 + 15*J(jj1) + 6*Power(J(jj1),2))));
+          case 54: return (-60*sqrt((J(jj1)*(3 + 2*J(jj1)))/(5 + 2*J(jj1))) - 4*sqrt((Power(J(jj1),3)*(3 + 2*J(jj1)))/(5 + 2*J(jj1))) + 53*sqrt((Power(J(jj1),5)*(3 + 2*J(jj1)))/(5 + 2*J(jj1))) + 28*sqrt((Power(J(jj1),7)*(3 + 2*J(jj1)))/(5 + 2*J(jj1))) + 4*sqrt((Power(J(jj1),9)*(3 + 2*J(jj1)))/(5 + 2*J(jj1))))/sqrt(J(jj1)*(1 + J(jj1))*Power(2 + J(jj1),3)*Power(3 + 2*J(jj1),2)*(5 + 12*J(jj1) + 4*Power(J(jj1),2)));
+          case 55: return (sqrt(6)*(30*sqrt((J(jj1)*(3 + 5*J(jj1) + 2*Power(J(jj1),2)))/(15 + 11*J(jj1) + 2*Power(J(jj1),2))) + 37*sqrt((Power(J(jj1),3)*(3 + 5*J(jj1) + 2*Power(J(jj1),2)))/(15 + 11*J(jj1) + 2*Power(J(jj1),2))) + 15*sqrt((Power(J(jj1),5)*(3 + 5*J(jj1) + 2*Power(J(jj1),2)))/(15 + 11*J(jj1) + 2*Power(J(jj1),2))) + 2*sqrt((Power(J(jj1),7)*(3 + 5*J(jj1) + 2*Power(J(jj1),2)))/(15 + 11*J(jj1) + 2*Power(J(jj1),2)))))/sqrt(J(jj1)*(1 + J(jj1))*Power(2 + J(jj1),3)*Power(3 + 2*J(jj1),2)*(15 + 11*J(jj1) + 2*Power(J(jj1),2)));
+          case 56: return sqrt(6 + 10*J(jj1) + 4*Power(J(jj1),2))*(3*(-2 + J(jj1))*sqrt((Power(1 - 2*J(jj1),2)*(1 + 2*J(jj1)))/(Power(1 + J(jj1),2)*(5 + 2*J(jj1))*Power(6 + 7*J(jj1) + 2*Power(J(jj1),2),3))) + (2 + 2*J(jj1) - 4*Power(J(jj1),2))/((2 + J(jj1))*sqrt((5 + 2*J(jj1))*(6 + 19*J(jj1) + 16*Power(J(jj1),2) + 4*Power(J(jj1),3)))) + sqrt((1 + 2*J(jj1))/(30 + 47*J(jj1) + 24*Power(J(jj1),2) + 4*Power(J(jj1),3))) + (6*(1 - 3*J(jj1) + 2*Power(J(jj1),2)))/((1 + J(jj1))*(6 + 7*J(jj1) + 2*Power(J(jj1),2))*sqrt(30 + 107*J(jj1) + 118*Power(J(jj1),2) + 52*Power(J(jj1),3) + 8*Power(J(jj1),4))) + (6 + J(jj1) - 20*Power(J(jj1),2) + 4*Power(J(jj1),3))/((6 + 7*J(jj1) + 2*Power(J(jj1),2))*sqrt(30 + 107*J(jj1) + 118*Power(J(jj1),2) + 52*Power(J(jj1),3) + 8*Power(J(jj1),4))));
+          case 57: return -4*sqrt(2)*(3 + J(jj1))*sqrt(J(jj1)/((1 + 2*J(jj1))*Power(3 + 2*J(jj1),2)*(6 + 5*J(jj1) + Power(J(jj1),2))));
+          case 58: return (7 + 2*J(jj1))*sqrt(J(jj1)/(42 + 61*J(jj1) + 28*Power(J(jj1),2) + 4*Power(J(jj1),3)));
+          case 59: return -(sqrt(-3 + 4*J(jj1) + 4*Power(J(jj1),2))/(1 + 2*J(jj1)));
+          case 60: return -(sqrt(3)/sqrt(3 + 8*J(jj1) + 4*Power(J(jj1),2)));
+          case 61: return 2/(1 + 2*J(jj1));
+          case 62: return -sqrt((J(jj1)*(1 + 2*J(jj1)))/(6 + 7*J(jj1) + 2*Power(J(jj1),2))) - 3*sqrt(J(jj1)/(6 + 19*J(jj1) + 16*Power(J(jj1),2) + 4*Power(J(jj1),3)));
+          case 63: return -(sqrt((9 - 13*Power(J(jj1),2) + 4*Power(J(jj1),4))/(-1 + 4*Power(J(jj1),2)))/J(jj1));
+          case 64: return (-3*sqrt(-1 + Power(J(jj1),2)))/(J(jj1) + 2*Power(J(jj1),2));
+          case 65: return (6*sqrt(((-(1/J(jj1)) + J(jj1))*(3 + 5*J(jj1) + 2*Power(J(jj1),2)))/(-3 + 6*J(jj1))))/((1 + J(jj1))*(1 + 2*J(jj1)));
+          case 66: return (6*sqrt(1 + 1/J(jj1)) + 10*sqrt(J(jj1)*(1 + J(jj1))) - 6*sqrt(Power(J(jj1),3)*(1 + J(jj1))) - 4*sqrt(Power(J(jj1),5)*(1 + J(jj1))))/((1 + J(jj1))*Power(1 + 2*J(jj1),2));
+          case 67: return (-2*sqrt(3)*(-2 + 3*J(jj1) + 2*Power(J(jj1),2)))/((1 + 2*J(jj1))*sqrt(-6 - J(jj1) + 17*Power(J(jj1),2) + 16*Power(J(jj1),3) + 4*Power(J(jj1),4)));
+          case 68: return -3/(J(jj1) + 2*Power(J(jj1),2));
+          case 69: return -((sqrt((3 + 5*J(jj1) + 2*Power(J(jj1),2))/(1 + 2*J(jj1)))*(9*sqrt((1 + J(jj1))/(1 + 2*J(jj1))) + 8*Power(J(jj1),3)*sqrt((1 + J(jj1))/(1 + 2*J(jj1))) + 3*J(jj1)*(-5*sqrt((1 + J(jj1))/(1 + 2*J(jj1))) + sqrt(1 + 3*J(jj1) + 2*Power(J(jj1),2))) - 2*Power(J(jj1),2)*(5*sqrt((1 + J(jj1))/(1 + 2*J(jj1))) + 2*sqrt(1 + 3*J(jj1) + 2*Power(J(jj1),2)))))/(J(jj1)*(1 + J(jj1))*Power(3 + 2*J(jj1),1.5)));
+          case 70: return (5*sqrt((Power(J(jj1),3)*(1 + 3*J(jj1) + 2*Power(J(jj1),2)))/(2 + J(jj1))) - 2*sqrt((Power(J(jj1),5)*(1 + 3*J(jj1) + 2*Power(J(jj1),2)))/(2 + J(jj1))) + 24*J(jj1)*sqrt((J(jj1)*(1 + J(jj1)))/(2 + 5*J(jj1) + 2*Power(J(jj1),2))) - 18*sqrt((Power(1 - 2*J(jj1),2)*J(jj1)*(1 + J(jj1)))/(2 + 5*J(jj1) + 2*Power(J(jj1),2))) - 24*sqrt((Power(J(jj1),5)*(1 + J(jj1)))/(2 + 5*J(jj1) + 2*Power(J(jj1),2))))/((3 + 2*J(jj1))*sqrt(J(jj1)*(1 + J(jj1))*(2 + 5*J(jj1) + 2*Power(J(jj1),2))));
+          case 71: return (-3*(10*sqrt((J(jj1)*(1 + J(jj1)))/(10 + 9*J(jj1) + 2*Power(J(jj1),2))) + 9*sqrt((Power(J(jj1),3)*(1 + J(jj1)))/(10 + 9*J(jj1) + 2*Power(J(jj1),2))) + 2*sqrt((Power(J(jj1),5)*(1 + J(jj1)))/(10 + 9*J(jj1) + 2*Power(J(jj1),2)))))/((3 + 2*J(jj1))*sqrt(J(jj1)*(1 + J(jj1))*(10 + 9*J(jj1) + 2*Power(J(jj1),2))));
+          case 72: return (-6*(2 + J(jj1)))/(sqrt(2 + 3*J(jj1) + Power(J(jj1),2))*(3 + 8*J(jj1) + 4*Power(J(jj1),2)));
+          case 73: return 2*sqrt(3)*(5 + 2*J(jj1))*sqrt(J(jj1)/(Power(3 + 2*J(jj1),2)*(5 + 17*J(jj1) + 16*Power(J(jj1),2) + 4*Power(J(jj1),3))));
+          case 74: return (-2*sqrt(J(jj1)*(3 + J(jj1))))/(3 + 2*J(jj1));
+          case 75: return -(sqrt((9 - 13*Power(J(jj1),2) + 4*Power(J(jj1),4))/(-1 + 4*Power(J(jj1),2)))/J(jj1));
+          case 76: return (-3*sqrt(-1 + Power(J(jj1),2)))/(J(jj1) + 2*Power(J(jj1),2));
+          case 77: return (6*sqrt(((-(1/J(jj1)) + J(jj1))*(3 + 5*J(jj1) + 2*Power(J(jj1),2)))/(-3 + 6*J(jj1))))/((1 + J(jj1))*(1 + 2*J(jj1)));
+          case 78: return (6*sqrt(1 + 1/J(jj1)) + 10*sqrt(J(jj1)*(1 + J(jj1))) - 6*sqrt(Power(J(jj1),3)*(1 + J(jj1))) - 4*sqrt(Power(J(jj1),5)*(1 + J(jj1))))/((1 + J(jj1))*Power(1 + 2*J(jj1),2));
+          case 79: return (-2*sqrt(3)*(-2 + 3*J(jj1) + 2*Power(J(jj1),2)))/((1 + 2*J(jj1))*sqrt(-6 - J(jj1) + 17*Power(J(jj1),2) + 16*Power(J(jj1),3) + 4*Power(J(jj1),4)));
+          case 80: return -3/(J(jj1) + 2*Power(J(jj1),2));
+          case 81: return -((sqrt((3 + 5*J(jj1) + 2*Power(J(jj1),2))/(1 + 2*J(jj1)))*(9*sqrt((1 + J(jj1))/(1 + 2*J(jj1))) + 8*Power(J(jj1),3)*sqrt((1 + J(jj1))/(1 + 2*J(jj1))) + 3*J(jj1)*(-5*sqrt((1 + J(jj1))/(1 + 2*J(jj1))) + sqrt(1 + 3*J(jj1) + 2*Power(J(jj1),2))) - 2*Power(J(jj1),2)*(5*sqrt((1 + J(jj1))/(1 + 2*J(jj1))) + 2*sqrt(1 + 3*J(jj1) + 2*Power(J(jj1),2)))))/(J(jj1)*(1 + J(jj1))*Power(3 + 2*J(jj1),1.5)));
+          case 82: return (5*sqrt((Power(J(jj1),3)*(1 + 3*J(jj1) + 2*Power(J(jj1),2)))/(2 + J(jj1))) - 2*sqrt((Power(J(jj1),5)*(1 + 3*J(jj1) + 2*Power(J(jj1),2)))/(2 + J(jj1))) + 24*J(jj1)*sqrt((J(jj1)*(1 + J(jj1)))/(2 + 5*J(jj1) + 2*Power(J(jj1),2))) - 18*sqrt((Power(1 - 2*J(jj1),2)*J(jj1)*(1 + J(jj1)))/(2 + 5*J(jj1) + 2*Power(J(jj1),2))) - 24*sqrt((Power(J(jj1),5)*(1 + J(jj1)))/(2 + 5*J(jj1) + 2*Power(J(jj1),2))))/((3 + 2*J(jj1))*sqrt(J(jj1)*(1 + J(jj1))*(2 + 5*J(jj1) + 2*Power(J(jj1),2))));
+          case 83: return (-3*(10*sqrt((J(jj1)*(1 + J(jj1)))/(10 + 9*J(jj1) + 2*Power(J(jj1),2))) + 9*sqrt((Power(J(jj1),3)*(1 + J(jj1)))/(10 + 9*J(jj1) + 2*Power(J(jj1),2))) + 2*sqrt((Power(J(jj1),5)*(1 + J(jj1)))/(10 + 9*J(jj1) + 2*Power(J(jj1),2)))))/((3 + 2*J(jj1))*sqrt(J(jj1)*(1 + J(jj1))*(10 + 9*J(jj1) + 2*Power(J(jj1),2))));
+          case 84: return (-6*(2 + J(jj1)))/(sqrt(2 + 3*J(jj1) + Power(J(jj1),2))*(3 + 8*J(jj1) + 4*Power(J(jj1),2)));
+          case 85: return 2*sqrt(3)*(5 + 2*J(jj1))*sqrt(J(jj1)/(Power(3 + 2*J(jj1),2)*(5 + 17*J(jj1) + 16*Power(J(jj1),2) + 4*Power(J(jj1),3))));
+          case 86: return (-2*sqrt(J(jj1)*(3 + J(jj1))))/(3 + 2*J(jj1));
+          case 87: return -(sqrt((9 - 13*Power(J(jj1),2) + 4*Power(J(jj1),4))/(-1 + 4*Power(J(jj1),2)))/J(jj1));
+          case 88: return (-3*sqrt(-1 + Power(J(jj1),2)))/(J(jj1) + 2*Power(J(jj1),2));
+          case 89: return (6*sqrt(((-(1/J(jj1)) + J(jj1))*(3 + 5*J(jj1) + 2*Power(J(jj1),2)))/(-3 + 6*J(jj1))))/((1 + J(jj1))*(1 + 2*J(jj1)));
+          case 90: return (6*sqrt(1 + 1/J(jj1)) + 10*sqrt(J(jj1)*(1 + J(jj1))) - 6*sqrt(Power(J(jj1),3)*(1 + J(jj1))) - 4*sqrt(Power(J(jj1),5)*(1 + J(jj1))))/((1 + J(jj1))*Power(1 + 2*J(jj1),2));
+          case 91: return (-2*sqrt(3)*(-2 + 3*J(jj1) + 2*Power(J(jj1),2)))/((1 + 2*J(jj1))*sqrt(-6 - J(jj1) + 17*Power(J(jj1),2) + 16*Power(J(jj1),3) + 4*Power(J(jj1),4)));
+          case 92: return -3/(J(jj1) + 2*Power(J(jj1),2));
+          case 93: return -((sqrt((3 + 5*J(jj1) + 2*Power(J(jj1),2))/(1 + 2*J(jj1)))*(9*sqrt((1 + J(jj1))/(1 + 2*J(jj1))) + 8*Power(J(jj1),3)*sqrt((1 + J(jj1))/(1 + 2*J(jj1))) + 3*J(jj1)*(-5*sqrt((1 + J(jj1))/(1 + 2*J(jj1))) + sqrt(1 + 3*J(jj1) + 2*Power(J(jj1),2))) - 2*Power(J(jj1),2)*(5*sqrt((1 + J(jj1))/(1 + 2*J(jj1))) + 2*sqrt(1 + 3*J(jj1) + 2*Power(J(jj1),2)))))/(J(jj1)*(1 + J(jj1))*Power(3 + 2*J(jj1),1.5)));
+          case 94: return (5*sqrt((Power(J(jj1),3)*(1 + 3*J(jj1) + 2*Power(J(jj1),2)))/(2 + J(jj1))) - 2*sqrt((Power(J(jj1),5)*(1 + 3*J(jj1) + 2*Power(J(jj1),2)))/(2 + J(jj1))) + 24*J(jj1)*sqrt((J(jj1)*(1 + J(jj1)))/(2 + 5*J(jj1) + 2*Power(J(jj1),2))) - 18*sqrt((Power(1 - 2*J(jj1),2)*J(jj1)*(1 + J(jj1)))/(2 + 5*J(jj1) + 2*Power(J(jj1),2))) - 24*sqrt((Power(J(jj1),5)*(1 + J(jj1)))/(2 + 5*J(jj1) + 2*Power(J(jj1),2))))/((3 + 2*J(jj1))*sqrt(J(jj1)*(1 + J(jj1))*(2 + 5*J(jj1) + 2*Power(J(jj1),2))));
+          case 95: return (-3*(10*sqrt((J(jj1)*(1 + J(jj1)))/(10 + 9*J(jj1) + 2*Power(J(jj1),2))) + 9*sqrt((Power(J(jj1),3)*(1 + J(jj1)))/(10 + 9*J(jj1) + 2*Power(J(jj1),2))) + 2*sqrt((Power(J(jj1),5)*(1 + J(jj1)))/(10 + 9*J(jj1) + 2*Power(J(jj1),2)))))/((3 + 2*J(jj1))*sqrt(J(jj1)*(1 + J(jj1))*(10 + 9*J(jj1) + 2*Power(J(jj1),2))));
+          case 96: return (-6*(2 + J(jj1)))/(sqrt(2 + 3*J(jj1) + Power(J(jj1),2))*(3 + 8*J(jj1) + 4*Power(J(jj1),2)));
+          case 97: return 2*sqrt(3)*(5 + 2*J(jj1))*sqrt(J(jj1)/(Power(3 + 2*J(jj1),2)*(5 + 17*J(jj1) + 16*Power(J(jj1),2) + 4*Power(J(jj1),3))));
+          case 98: return (-2*sqrt(J(jj1)*(3 + J(jj1))))/(3 + 2*J(jj1));
+          case 99: return -sqrt(((10 - 9*J(jj1) + 2*Power(J(jj1),2))*(3 + 5*J(jj1) + 2*Power(J(jj1),2)))/(J(jj1)*(3 + J(jj1) - 8*Power(J(jj1),2) + 4*Power(J(jj1),3))));
+          case 100: return -(sqrt(15)*sqrt(((-2 + J(jj1))*(1 + J(jj1)))/(J(jj1)*(1 - J(jj1) - 4*Power(J(jj1),2) + 4*Power(J(jj1),3)))));
+          case 101: return (2*sqrt(5)*sqrt((-2 + J(jj1))*(3 + 2*J(jj1))))/sqrt(J(jj1)*(-3 + 2*J(jj1))*(-1 + 4*Power(J(jj1),2)));
+          case 102: return (-2*(-6 + Power(J(jj1),2)))/(J(jj1)*sqrt(-1 + 4*Power(J(jj1),2)));
+          case 103: return (-2*sqrt(6)*(-6 + J(jj1) + 2*Power(J(jj1),2))*sqrt((-1 + J(jj1))/(6 - 13*J(jj1) + 4*Power(J(jj1),3))))/(J(jj1)*(1 + 2*J(jj1)));
+          case 104: return -(sqrt(30)/sqrt((-1 + J(jj1))*J(jj1)*(-1 + 4*Power(J(jj1),2))));
+          case 105: return ((-27 + 4*J(jj1) + 8*Power(J(jj1),2))*sqrt((6 + 4*J(jj1))/(J(jj1) - 3*Power(J(jj1),2) + 2*Power(J(jj1),3))))/(3 + 8*J(jj1) + 4*Power(J(jj1),2));
+          case 106: return (-54 + 35*J(jj1) + 31*Power(J(jj1),2) - 8*Power(J(jj1),3) - 4*Power(J(jj1),4))/((1 + J(jj1))*(1 + 2*J(jj1))*(3 + 2*J(jj1))*sqrt((J(jj1)*(2 - 5*J(jj1) + Power(J(jj1),2) + 2*Power(J(jj1),3)))/(3 + 5*J(jj1) + 2*Power(J(jj1),2))));
+          case 107: return sqrt(9 + 15*J(jj1) + 6*Power(J(jj1),2))*(-100/sqrt((J(jj1)*Power(3 + 2*J(jj1),3)*Power(1 + 3*J(jj1) + 2*Power(J(jj1),2),2)*(10 + 9*J(jj1) + 2*Power(J(jj1),2)))/(1 - 3*J(jj1) + 2*Power(J(jj1),2))) - 16*(-1 + J(jj1))*(-5 + 3*J(jj1))*sqrt((-1 + 2*J(jj1))/(J(jj1)*Power(3 + 2*J(jj1),3)*Power(1 + 3*J(jj1) + 2*Power(J(jj1),2),2)*(-10 + J(jj1) + 7*Power(J(jj1),2) + 2*Power(J(jj1),3)))) - ((1 - 3*J(jj1) + 2*Power(J(jj1),2))*(10 - 21*J(jj1) + 6*Power(J(jj1),2)))/((3 + 2*J(jj1))*(1 + 3*J(jj1) + 2*Power(J(jj1),2))*sqrt(J(jj1)*(30 - 43*J(jj1) - 57*Power(J(jj1),2) + 26*Power(J(jj1),3) + 36*Power(J(jj1),4) + 8*Power(J(jj1),5)))));
+          case 108: return (-6*sqrt(6)*(-2 + J(jj1) + Power(J(jj1),2)))/(J(jj1)*(1 + 2*J(jj1))*sqrt((3 + 2*J(jj1))*(2 - 5*J(jj1) + Power(J(jj1),2) + 2*Power(J(jj1),3))));
+          case 109: return (6*(-6 + 3*J(jj1) + 2*Power(J(jj1),2)))/(J(jj1)*(1 + 2*J(jj1))*(3 + 2*J(jj1)));
+          case 110: return sqrt(3 + 5*J(jj1) + 2*Power(J(jj1),2))*(-300*sqrt((Power(-1 + J(jj1),2)*(-1 + 2*J(jj1)))/(J(jj1)*Power(1 + 2*J(jj1),2)*(5 + 7*J(jj1) + 2*Power(J(jj1),2))*Power(6 + 7*J(jj1) + 2*Power(J(jj1),2),3))) - (9*(-1 + 2*J(jj1))*(10 - 21*J(jj1) + 6*Power(J(jj1),2))*sqrt(J(jj1)/(-5 + 3*J(jj1) + 12*Power(J(jj1),2) + 4*Power(J(jj1),3))))/((1 + 2*J(jj1))*Power(6 + 7*J(jj1) + 2*Power(J(jj1),2),1.5)) - (J(jj1)*(-1 + 2*J(jj1))*(10 - 15*J(jj1) + 2*Power(J(jj1),2)))/(Power(6 + 7*J(jj1) + 2*Power(J(jj1),2),1.5)*sqrt(J(jj1)*(-5 + 3*J(jj1) + 12*Power(J(jj1),2) + 4*Power(J(jj1),3)))) - (36*Power(1 - 2*J(jj1),2)*(-5 + 3*J(jj1)))/((6 + 19*J(jj1) + 16*Power(J(jj1),2) + 4*Power(J(jj1),3))*sqrt(J(jj1)*(-30 - 17*J(jj1) + 83*Power(J(jj1),2) + 114*Power(J(jj1),3) + 52*Power(J(jj1),4) + 8*Power(J(jj1),5)))));
+          case 111: return 2*sqrt(6)*sqrt(3 + 5*J(jj1) + 2*Power(J(jj1),2))*(-((-2 + J(jj1))*J(jj1)*(-1 + 2*J(jj1))*sqrt((1 + 2*J(jj1))/(Power(5 + 2*J(jj1),2)*Power(6 + 7*J(jj1) + 2*Power(J(jj1),2),3)*(-3 + 2*J(jj1) + 7*Power(J(jj1),2) + 2*Power(J(jj1),3))))) - (3*J(jj1)*(-1 + 2*J(jj1))*(-7 + 6*J(jj1)))/((5 + 2*J(jj1))*Power(6 + 7*J(jj1) + 2*Power(J(jj1),2),1.5)*sqrt(-3 - 4*J(jj1) + 11*Power(J(jj1),2) + 16*Power(J(jj1),3) + 4*Power(J(jj1),4))) - (75*sqrt((-1 + 2*J(jj1))/(18 + 81*J(jj1) + 130*Power(J(jj1),2) + 95*Power(J(jj1),3) + 32*Power(J(jj1),4) + 4*Power(J(jj1),5))))/(30 + 47*J(jj1) + 24*Power(J(jj1),2) + 4*Power(J(jj1),3)) - (15*(-1 + 2*J(jj1))*(-3 + 4*J(jj1)))/((5 + 2*J(jj1))*(6 + 7*J(jj1) + 2*Power(J(jj1),2))*sqrt(-18 - 45*J(jj1) + 32*Power(J(jj1),2) + 165*Power(J(jj1),3) + 158*Power(J(jj1),4) + 60*Power(J(jj1),5) + 8*Power(J(jj1),6))));
+          case 112: return sqrt(6)*sqrt(3 + 5*J(jj1) + 2*Power(J(jj1),2))*(-(J(jj1)*sqrt((-1 + 2*J(jj1))/(J(jj1)*Power(3 + 2*J(jj1),3)*(5 + 2*J(jj1))*Power(2 + 3*J(jj1) + Power(J(jj1),2),2)))*(18 - 17*J(jj1) + 2*Power(J(jj1),2))) + (4*(2 - 5*J(jj1) + 2*Power(J(jj1),2))*sqrt(J(jj1)/(-5 + 8*J(jj1) + 4*Power(J(jj1),2))))/((2 + J(jj1))*Power(3 + 2*J(jj1),1.5)) - (16*(-3 + J(jj1))*(-1 + J(jj1))*J(jj1)*sqrt((-1 + 2*J(jj1))/(J(jj1)*Power(2 + 3*J(jj1) + Power(J(jj1),2),2)*(15 + 16*J(jj1) + 4*Power(J(jj1),2)))))/(3 + 8*J(jj1) + 4*Power(J(jj1),2)) - 10*sqrt(((-1 + 2*J(jj1))*Power(3 - 5*J(jj1) + 2*Power(J(jj1),2),2))/(J(jj1)*Power(3 + 2*J(jj1),3)*(5 + 2*J(jj1))*Power(2 + 7*J(jj1) + 7*Power(J(jj1),2) + 2*Power(J(jj1),3),2))) + (1 - 2*J(jj1))*sqrt(J(jj1)/(Power(2 + J(jj1),2)*(-15 + 14*J(jj1) + 28*Power(J(jj1),2) + 8*Power(J(jj1),3)))));
+          case 113: return (sqrt(2)*(-15 + 20*J(jj1) + 8*Power(J(jj1),2)))/((3 + 2*J(jj1))*sqrt(J(jj1)*(1 + J(jj1))*(5 + 12*J(jj1) + 4*Power(J(jj1),2))));
+          case 114: return sqrt(3 + 5*J(jj1) + 2*Power(J(jj1),2))*(-48*(-2 + J(jj1))*J(jj1)*sqrt((1 + 3*J(jj1) + 2*Power(J(jj1),2))/(Power(6 + 5*J(jj1) + Power(J(jj1),2),2)*Power(15 + 16*J(jj1) + 4*Power(J(jj1),2),3))) - (J(jj1)*(-9 + 2*J(jj1)))/((10 + 9*J(jj1) + 2*Power(J(jj1),2))*sqrt((Power(3 + J(jj1),2)*(15 + 16*J(jj1) + 4*Power(J(jj1),2)))/(1 + 3*J(jj1) + 2*Power(J(jj1),2)))) - (36*J(jj1)*(-7 + 6*J(jj1)))/(sqrt((Power(3 + J(jj1),2)*(15 + 31*J(jj1) + 20*Power(J(jj1),2) + 4*Power(J(jj1),3)))/(1 + 2*J(jj1)))*(30 + 47*J(jj1) + 24*Power(J(jj1),2) + 4*Power(J(jj1),3))) - (240*J(jj1)*(-3 + 4*J(jj1)))/((3 + J(jj1))*(30 + 47*J(jj1) + 24*Power(J(jj1),2) + 4*Power(J(jj1),3))*sqrt(15 + 61*J(jj1) + 82*Power(J(jj1),2) + 44*Power(J(jj1),3) + 8*Power(J(jj1),4))) - (450*(-1 + 2*J(jj1)))/((2 + J(jj1))*(45 + 63*J(jj1) + 28*Power(J(jj1),2) + 4*Power(J(jj1),3))*sqrt(15 + 61*J(jj1) + 82*Power(J(jj1),2) + 44*Power(J(jj1),3) + 8*Power(J(jj1),4))));
+          case 115: return -((sqrt(15)*(sqrt((Power(J(jj1),3)*(2 + J(jj1))*Power(1 + 2*J(jj1),2)*Power(3 + 5*J(jj1) + 2*Power(J(jj1),2),3))/(21 + 13*J(jj1) + 2*Power(J(jj1),2))) + 210*sqrt((J(jj1)*(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3)))/(21 + 13*J(jj1) + 2*Power(J(jj1),2))) + 120*sqrt((Power(J(jj1),5)*(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3)))/(21 + 13*J(jj1) + 2*Power(J(jj1),2))) + 4*J(jj1)*(4*sqrt((J(jj1)*Power(1 + J(jj1),3)*Power(1 + 2*J(jj1),2)*(6 + 7*J(jj1) + 2*Power(J(jj1),2)))/(21 + 13*J(jj1) + 2*Power(J(jj1),2))) + 75*sqrt((J(jj1)*(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3)))/(21 + 13*J(jj1) + 2*Power(J(jj1),2))))))/sqrt(J(jj1)*(1 + J(jj1))*Power(3 + 2*J(jj1),2)*Power(10 + 9*J(jj1) + 2*Power(J(jj1),2),3)*(21 + 13*J(jj1) + 2*Power(J(jj1),2))));
+          case 116: return sqrt(3.3333333333333335)*sqrt(3 + 5*J(jj1) + 2*Power(J(jj1),2))*((-5 + 4*J(jj1))*sqrt((1 + 3*J(jj1) + 2*Power(J(jj1),2))/(Power(5 + 2*J(jj1),3)*(18 + 27*J(jj1) + 13*Power(J(jj1),2) + 2*Power(J(jj1),3)))) - 6*(-5 + 3*J(jj1))*sqrt((Power(1 - 2*J(jj1),2)*(1 + 2*J(jj1)))/((3 + 4*J(jj1) + Power(J(jj1),2))*Power(30 + 47*J(jj1) + 24*Power(J(jj1),2) + 4*Power(J(jj1),3),3))) - 3*(10 - 21*J(jj1) + 6*Power(J(jj1),2))*sqrt((1 + 3*J(jj1) + 2*Power(J(jj1),2))/((3 + J(jj1))*Power(30 + 47*J(jj1) + 24*Power(J(jj1),2) + 4*Power(J(jj1),3),3))) - sqrt((1 + 3*J(jj1) + 2*Power(J(jj1),2))/(90 + 171*J(jj1) + 119*Power(J(jj1),2) + 36*Power(J(jj1),3) + 4*Power(J(jj1),4))) - ((1 + 2*J(jj1))*(10 - 15*J(jj1) + 2*Power(J(jj1),2))*sqrt((1 + J(jj1))/(90 + 351*J(jj1) + 461*Power(J(jj1),2) + 274*Power(J(jj1),3) + 76*Power(J(jj1),4) + 8*Power(J(jj1),5))))/(10 + 9*J(jj1) + 2*Power(J(jj1),2)) - (30*(1 - 3*J(jj1) + 2*Power(J(jj1),2)))/((30 + 47*J(jj1) + 24*Power(J(jj1),2) + 4*Power(J(jj1),3))*sqrt(90 + 441*J(jj1) + 812*Power(J(jj1),2) + 735*Power(J(jj1),3) + 350*Power(J(jj1),4) + 84*Power(J(jj1),5) + 8*Power(J(jj1),6))));
+          case 117: return sqrt(5)*sqrt(3 + 5*J(jj1) + 2*Power(J(jj1),2))*(-12*(-2 + J(jj1))*sqrt((J(jj1)*(1 + 3*J(jj1) + 2*Power(J(jj1),2)))/(Power(3 + J(jj1),2)*(7 + 2*J(jj1))*Power(10 + 9*J(jj1) + 2*Power(J(jj1),2),3))) + (9 - 2*J(jj1))*sqrt((J(jj1)*(1 + 3*J(jj1) + 2*Power(J(jj1),2)))/(Power(3 + J(jj1),2)*Power(5 + 2*J(jj1),3)*(14 + 11*J(jj1) + 2*Power(J(jj1),2)))) + sqrt((J(jj1)*(1 + 3*J(jj1) + 2*Power(J(jj1),2)))/(Power(3 + J(jj1),2)*(70 + 83*J(jj1) + 32*Power(J(jj1),2) + 4*Power(J(jj1),3)))) - (12*(-7 + 6*J(jj1))*sqrt((J(jj1)*(1 + 3*J(jj1) + 2*Power(J(jj1),2)))/(70 + 83*J(jj1) + 32*Power(J(jj1),2) + 4*Power(J(jj1),3))))/(90 + 171*J(jj1) + 119*Power(J(jj1),2) + 36*Power(J(jj1),3) + 4*Power(J(jj1),4)) - (90*(-1 + 2*J(jj1))*sqrt(J(jj1)/(Power(9 + 9*J(jj1) + 2*Power(J(jj1),2),2)*(70 + 293*J(jj1) + 421*Power(J(jj1),2) + 266*Power(J(jj1),3) + 76*Power(J(jj1),4) + 8*Power(J(jj1),5)))))/(10 + 9*J(jj1) + 2*Power(J(jj1),2)) - (30*(1 + 2*J(jj1))*(-3 + 4*J(jj1))*sqrt(J(jj1)/(Power(9 + 9*J(jj1) + 2*Power(J(jj1),2),2)*(70 + 293*J(jj1) + 421*Power(J(jj1),2) + 266*Power(J(jj1),3) + 76*Power(J(jj1),4) + 8*Power(J(jj1),5)))))/(10 + 9*J(jj1) + 2*Power(J(jj1),2)));
+          case 118: return -2*(4 + J(jj1))*sqrt(J(jj1)/(60 + 79*J(jj1) + 32*Power(J(jj1),2) + 4*Power(J(jj1),3)));
+          case 119: return 1;
+          case 120: return 1;
+          case 121: return sqrt(3 - 4*J(jj1) - 7*Power(J(jj1),2) + 4*Power(J(jj1),3) + 4*Power(J(jj1),4))/(J(jj1) + 2*Power(J(jj1),2));
+          case 122: return 1/sqrt((J(jj1)*Power(1 + 2*J(jj1),2))/(-3 + 6*J(jj1)));
+          case 123: return -(sqrt((-3 + 4*J(jj1) + 4*Power(J(jj1),2))/(1 + 3*J(jj1) + 2*Power(J(jj1),2)))/J(jj1));
+          case 124: return (-3 + 3*J(jj1) + 2*Power(J(jj1),2))/sqrt(J(jj1)*(1 + 2*J(jj1))*(3 + 5*J(jj1) + 2*Power(J(jj1),2)));
+          case 125: return sqrt(3)/sqrt(3 + 5*J(jj1) + 2*Power(J(jj1),2));
+          case 126: return sqrt(3)/(sqrt(J(jj1)*(1 + J(jj1)))*(1 + 2*J(jj1)));
+          case 127: return (-3*sqrt((J(jj1)*(1 + 2*J(jj1)))/(2 + 3*J(jj1) + Power(J(jj1),2))) + 2*J(jj1)*sqrt((J(jj1)*(1 + 2*J(jj1)))/(2 + 3*J(jj1) + Power(J(jj1),2))) - 2*sqrt((J(jj1)*(1 + 3*J(jj1) + 2*Power(J(jj1),2)))/(2 + J(jj1))) + 3*(-1 + 2*J(jj1))*sqrt(J(jj1)/(2 + 7*J(jj1) + 7*Power(J(jj1),2) + 2*Power(J(jj1),3))))/sqrt(3 + 8*J(jj1) + 4*Power(J(jj1),2));
+          case 128: return ((1 + 2*J(jj1))*sqrt((J(jj1)*(1 + J(jj1)))/(10 + 9*J(jj1) + 2*Power(J(jj1),2))) + 6*sqrt(J(jj1)/(10 + 19*J(jj1) + 11*Power(J(jj1),2) + 2*Power(J(jj1),3))) + 3*(1 + 2*J(jj1))*sqrt(J(jj1)/(10 + 19*J(jj1) + 11*Power(J(jj1),2) + 2*Power(J(jj1),3))))/sqrt(6 + 7*J(jj1) + 2*Power(J(jj1),2));
+          case 129: return sqrt(((6 - 7*J(jj1) + 2*Power(J(jj1),2))*(3 + 5*J(jj1) + 2*Power(J(jj1),2)))/(J(jj1)*(1 - J(jj1) - 4*Power(J(jj1),2) + 4*Power(J(jj1),3))));
+          case 130: return sqrt(6)*sqrt((3 + J(jj1) - 2*Power(J(jj1),2))/(Power(J(jj1),2) - 4*Power(J(jj1),4)));
+          case 131: return -(sqrt((18 - 8*Power(J(jj1),2))/(1 + J(jj1) - 2*Power(J(jj1),2)))/J(jj1));
+          case 132: return (-9 + J(jj1) + 2*Power(J(jj1),2))/(J(jj1)*(1 + 2*J(jj1)));
+          case 133: return (3*sqrt((-2 + J(jj1) + Power(J(jj1),2))*(-1 + J(jj1) + 2*Power(J(jj1),2))))/(J(jj1)*(1 + J(jj1))*(1 + 2*J(jj1)));
+          case 134: return (3*sqrt(2))/(J(jj1)*sqrt(-1 + 4*Power(J(jj1),2)));
+          case 135: return -(((-9 + 4*J(jj1) + 4*Power(J(jj1),2))*sqrt((9 + 15*J(jj1) + 6*Power(J(jj1),2))/(-1 + 4*Power(J(jj1),2))))/(J(jj1)*(1 + J(jj1))*(3 + 2*J(jj1))));
+          case 136: return (18 - 33*J(jj1) - 13*Power(J(jj1),2) + 12*Power(J(jj1),3) + 4*Power(J(jj1),4))/(J(jj1)*(3 + 2*J(jj1))*sqrt((1 + J(jj1))*(-2 - J(jj1) + 8*Power(J(jj1),2) + 4*Power(J(jj1),3))));
+          case 137: return 3*sqrt(3 + 5*J(jj1) + 2*Power(J(jj1),2))*(20/sqrt((Power(3 + 2*J(jj1),3)*Power(2 + 3*J(jj1) + Power(J(jj1),2),2)*(5 + 12*J(jj1) + 4*Power(J(jj1),2)))/(-1 + 2*J(jj1))) + (J(jj1)*(-3 + 2*J(jj1))*(-1 + 2*J(jj1)))/(Power(3 + 2*J(jj1),1.5)*(2 + 3*J(jj1) + Power(J(jj1),2))*sqrt(-5 - 2*J(jj1) + 20*Power(J(jj1),2) + 8*Power(J(jj1),3))) + (2*(-1 + 2*J(jj1))*(-5 + 6*J(jj1)))/((3 + 2*J(jj1))*(2 + 3*J(jj1) + Power(J(jj1),2))*sqrt(-15 - 16*J(jj1) + 56*Power(J(jj1),2) + 64*Power(J(jj1),3) + 16*Power(J(jj1),4))));
+          case 138: return (3*sqrt(3)*sqrt(-6 - J(jj1) + 17*Power(J(jj1),2) + 16*Power(J(jj1),3) + 4*Power(J(jj1),4)))/(3*J(jj1) + 11*Power(J(jj1),2) + 12*Power(J(jj1),3) + 4*Power(J(jj1),4));
+          case 139: return (-2*(-3 + 4*J(jj1) + 2*Power(J(jj1),2)))/((1 + J(jj1))*(1 + 2*J(jj1))*(3 + 2*J(jj1))*sqrt((J(jj1)*(2 + J(jj1)))/(9 + 15*J(jj1) + 6*Power(J(jj1),2))));
+          case 140: return (-60*sqrt((J(jj1)*(3 + 2*J(jj1)))/(5 + 2*J(jj1))) - 4*sqrt((Power(J(jj1),3)*(3 + 2*J(jj1)))/(5 + 2*J(jj1))) + 53*sqrt((Power(J(jj1),5)*(3 + 2*J(jj1)))/(5 + 2*J(jj1))) + 28*sqrt((Power(J(jj1),7)*(3 + 2*J(jj1)))/(5 + 2*J(jj1))) + 4*sqrt((Power(J(jj1),9)*(3 + 2*J(jj1)))/(5 + 2*J(jj1))))/sqrt(J(jj1)*(1 + J(jj1))*Power(2 + J(jj1),3)*Power(3 + 2*J(jj1),2)*(5 + 12*J(jj1) + 4*Power(J(jj1),2)));
+          case 141: return (sqrt(6)*(30*sqrt((J(jj1)*(3 + 5*J(jj1) + 2*Power(J(jj1),2)))/(15 + 11*J(jj1) + 2*Power(J(jj1),2))) + 37*sqrt((Power(J(jj1),3)*(3 + 5*J(jj1) + 2*Power(J(jj1),2)))/(15 + 11*J(jj1) + 2*Power(J(jj1),2))) + 15*sqrt((Power(J(jj1),5)*(3 + 5*J(jj1) + 2*Power(J(jj1),2)))/(15 + 11*J(jj1) + 2*Power(J(jj1),2))) + 2*sqrt((Power(J(jj1),7)*(3 + 5*J(jj1) + 2*Power(J(jj1),2)))/(15 + 11*J(jj1) + 2*Power(J(jj1),2)))))/sqrt(J(jj1)*(1 + J(jj1))*Power(2 + J(jj1),3)*Power(3 + 2*J(jj1),2)*(15 + 11*J(jj1) + 2*Power(J(jj1),2)));
+          case 142: return sqrt(6 + 10*J(jj1) + 4*Power(J(jj1),2))*(3*(-2 + J(jj1))*sqrt((Power(1 - 2*J(jj1),2)*(1 + 2*J(jj1)))/(Power(1 + J(jj1),2)*(5 + 2*J(jj1))*Power(6 + 7*J(jj1) + 2*Power(J(jj1),2),3))) + (2 + 2*J(jj1) - 4*Power(J(jj1),2))/((2 + J(jj1))*sqrt((5 + 2*J(jj1))*(6 + 19*J(jj1) + 16*Power(J(jj1),2) + 4*Power(J(jj1),3)))) + sqrt((1 + 2*J(jj1))/(30 + 47*J(jj1) + 24*Power(J(jj1),2) + 4*Power(J(jj1),3))) + (6*(1 - 3*J(jj1) + 2*Power(J(jj1),2)))/((1 + J(jj1))*(6 + 7*J(jj1) + 2*Power(J(jj1),2))*sqrt(30 + 107*J(jj1) + 118*Power(J(jj1),2) + 52*Power(J(jj1),3) + 8*Power(J(jj1),4))) + (6 + J(jj1) - 20*Power(J(jj1),2) + 4*Power(J(jj1),3))/((6 + 7*J(jj1) + 2*Power(J(jj1),2))*sqrt(30 + 107*J(jj1) + 118*Power(J(jj1),2) + 52*Power(J(jj1),3) + 8*Power(J(jj1),4))));
+          case 143: return -4*sqrt(2)*(3 + J(jj1))*sqrt(J(jj1)/((1 + 2*J(jj1))*Power(3 + 2*J(jj1),2)*(6 + 5*J(jj1) + Power(J(jj1),2))));
+          case 144: return (7 + 2*J(jj1))*sqrt(J(jj1)/(42 + 61*J(jj1) + 28*Power(J(jj1),2) + 4*Power(J(jj1),3)));
+          case 145: return sqrt(((6 - 7*J(jj1) + 2*Power(J(jj1),2))*(3 + 5*J(jj1) + 2*Power(J(jj1),2)))/(J(jj1)*(1 - J(jj1) - 4*Power(J(jj1),2) + 4*Power(J(jj1),3))));
+          case 146: return sqrt(6)*sqrt((3 + J(jj1) - 2*Power(J(jj1),2))/(Power(J(jj1),2) - 4*Power(J(jj1),4)));
+          case 147: return -(sqrt((18 - 8*Power(J(jj1),2))/(1 + J(jj1) - 2*Power(J(jj1),2)))/J(jj1));
+          case 148: return (-9 + J(jj1) + 2*Power(J(jj1),2))/(J(jj1)*(1 + 2*J(jj1)));
+          case 149: return (3*sqrt((-2 + J(jj1) + Power(J(jj1),2))*(-1 + J(jj1) + 2*Power(J(jj1),2))))/(J(jj1)*(1 + J(jj1))*(1 + 2*J(jj1)));
+          case 150: return (3*sqrt(2))/(J(jj1)*sqrt(-1 + 4*Power(J(jj1),2)));
+          case 151: return -(((-9 + 4*J(jj1) + 4*Power(J(jj1),2))*sqrt((9 + 15*J(jj1) + 6*Power(J(jj1),2))/(-1 + 4*Power(J(jj1),2))))/(J(jj1)*(1 + J(jj1))*(3 + 2*J(jj1))));
+          case 152: return (18 - 33*J(jj1) - 13*Power(J(jj1),2) + 12*Power(J(jj1),3) + 4*Power(J(jj1),4))/(J(jj1)*(3 + 2*J(jj1))*sqrt((1 + J(jj1))*(-2 - J(jj1) + 8*Power(J(jj1),2) + 4*Power(J(jj1),3))));
+          case 153: return 3*sqrt(3 + 5*J(jj1) + 2*Power(J(jj1),2))*(20/sqrt((Power(3 + 2*J(jj1),3)*Power(2 + 3*J(jj1) + Power(J(jj1),2),2)*(5 + 12*J(jj1) + 4*Power(J(jj1),2)))/(-1 + 2*J(jj1))) + (J(jj1)*(-3 + 2*J(jj1))*(-1 + 2*J(jj1)))/(Power(3 + 2*J(jj1),1.5)*(2 + 3*J(jj1) + Power(J(jj1),2))*sqrt(-5 - 2*J(jj1) + 20*Power(J(jj1),2) + 8*Power(J(jj1),3))) + (2*(-1 + 2*J(jj1))*(-5 + 6*J(jj1)))/((3 + 2*J(jj1))*(2 + 3*J(jj1) + Power(J(jj1),2))*sqrt(-15 - 16*J(jj1) + 56*Power(J(jj1),2) + 64*Power(J(jj1),3) + 16*Power(J(jj1),4))));
+          case 154: return (3*sqrt(3)*sqrt(-6 - J(jj1) + 17*Power(J(jj1),2) + 16*Power(J(jj1),3) + 4*Power(J(jj1),4)))/(3*J(jj1) + 11*Power(J(jj1),2) + 12*Power(J(jj1),3) + 4*Power(J(jj1),4));
+          case 155: return (-2*(-3 + 4*J(jj1) + 2*Power(J(jj1),2)))/((1 + J(jj1))*(1 + 2*J(jj1))*(3 + 2*J(jj1))*sqrt((J(jj1)*(2 + J(jj1)))/(9 + 15*J(jj1) + 6*Power(J(jj1),2))));
+          case 156: return (-60*sqrt((J(jj1)*(3 + 2*J(jj1)))/(5 + 2*J(jj1))) - 4*sqrt((Power(J(jj1),3)*(3 + 2*J(jj1)))/(5 + 2*J(jj1))) + 53*sqrt((Power(J(jj1),5)*(3 + 2*J(jj1)))/(5 + 2*J(jj1))) + 28*sqrt((Power(J(jj1),7)*(3 + 2*J(jj1)))/(5 + 2*J(jj1))) + 4*sqrt((Power(J(jj1),9)*(3 + 2*J(jj1)))/(5 + 2*J(jj1))))/sqrt(J(jj1)*(1 + J(jj1))*Power(2 + J(jj1),3)*Power(3 + 2*J(jj1),2)*(5 + 12*J(jj1) + 4*Power(J(jj1),2)));
+          case 157: return (sqrt(6)*(30*sqrt((J(jj1)*(3 + 5*J(jj1) + 2*Power(J(jj1),2)))/(15 + 11*J(jj1) + 2*Power(J(jj1),2))) + 37*sqrt((Power(J(jj1),3)*(3 + 5*J(jj1) + 2*Power(J(jj1),2)))/(15 + 11*J(jj1) + 2*Power(J(jj1),2))) + 15*sqrt((Power(J(jj1),5)*(3 + 5*J(jj1) + 2*Power(J(jj1),2)))/(15 + 11*J(jj1) + 2*Power(J(jj1),2))) + 2*sqrt((Power(J(jj1),7)*(3 + 5*J(jj1) + 2*Power(J(jj1),2)))/(15 + 11*J(jj1) + 2*Power(J(jj1),2)))))/sqrt(J(jj1)*(1 + J(jj1))*Power(2 + J(jj1),3)*Power(3 + 2*J(jj1),2)*(15 + 11*J(jj1) + 2*Power(J(jj1),2)));
+          case 158: return sqrt(6 + 10*J(jj1) + 4*Power(J(jj1),2))*(3*(-2 + J(jj1))*sqrt((Power(1 - 2*J(jj1),2)*(1 + 2*J(jj1)))/(Power(1 + J(jj1),2)*(5 + 2*J(jj1))*Power(6 + 7*J(jj1) + 2*Power(J(jj1),2),3))) + (2 + 2*J(jj1) - 4*Power(J(jj1),2))/((2 + J(jj1))*sqrt((5 + 2*J(jj1))*(6 + 19*J(jj1) + 16*Power(J(jj1),2) + 4*Power(J(jj1),3)))) + sqrt((1 + 2*J(jj1))/(30 + 47*J(jj1) + 24*Power(J(jj1),2) + 4*Power(J(jj1),3))) + (6*(1 - 3*J(jj1) + 2*Power(J(jj1),2)))/((1 + J(jj1))*(6 + 7*J(jj1) + 2*Power(J(jj1),2))*sqrt(30 + 107*J(jj1) + 118*Power(J(jj1),2) + 52*Power(J(jj1),3) + 8*Power(J(jj1),4))) + (6 + J(jj1) - 20*Power(J(jj1),2) + 4*Power(J(jj1),3))/((6 + 7*J(jj1) + 2*Power(J(jj1),2))*sqrt(30 + 107*J(jj1) + 118*Power(J(jj1),2) + 52*Power(J(jj1),3) + 8*Power(J(jj1),4))));
+          case 159: return -4*sqrt(2)*(3 + J(jj1))*sqrt(J(jj1)/((1 + 2*J(jj1))*Power(3 + 2*J(jj1),2)*(6 + 5*J(jj1) + Power(J(jj1),2))));
+          case 160: return (7 + 2*J(jj1))*sqrt(J(jj1)/(42 + 61*J(jj1) + 28*Power(J(jj1),2) + 4*Power(J(jj1),3)));
+          case 161: return -(sqrt(-3 + 4*J(jj1) + 4*Power(J(jj1),2))/(1 + 2*J(jj1)));
+          case 162: return -(sqrt(3)/sqrt(3 + 8*J(jj1) + 4*Power(J(jj1),2)));
+          case 163: return 2/(1 + 2*J(jj1));
+          case 164: return -sqrt((J(jj1)*(1 + 2*J(jj1)))/(6 + 7*J(jj1) + 2*Power(J(jj1),2))) - 3*sqrt(J(jj1)/(6 + 19*J(jj1) + 16*Power(J(jj1),2) + 4*Power(J(jj1),3)));
+          case 165: return -(sqrt((9 - 13*Power(J(jj1),2) + 4*Power(J(jj1),4))/(-1 + 4*Power(J(jj1),2)))/J(jj1));
+          case 166: return (-3*sqrt(-1 + Power(J(jj1),2)))/(J(jj1) + 2*Power(J(jj1),2));
+          case 167: return (6*sqrt(((-(1/J(jj1)) + J(jj1))*(3 + 5*J(jj1) + 2*Power(J(jj1),2)))/(-3 + 6*J(jj1))))/((1 + J(jj1))*(1 + 2*J(jj1)));
+          case 168: return (6*sqrt(1 + 1/J(jj1)) + 10*sqrt(J(jj1)*(1 + J(jj1))) - 6*sqrt(Power(J(jj1),3)*(1 + J(jj1))) - 4*sqrt(Power(J(jj1),5)*(1 + J(jj1))))/((1 + J(jj1))*Power(1 + 2*J(jj1),2));
+          case 169: return (-2*sqrt(3)*(-2 + 3*J(jj1) + 2*Power(J(jj1),2)))/((1 + 2*J(jj1))*sqrt(-6 - J(jj1) + 17*Power(J(jj1),2) + 16*Power(J(jj1),3) + 4*Power(J(jj1),4)));
+          case 170: return -3/(J(jj1) + 2*Power(J(jj1),2));
+          case 171: return -((sqrt((3 + 5*J(jj1) + 2*Power(J(jj1),2))/(1 + 2*J(jj1)))*(9*sqrt((1 + J(jj1))/(1 + 2*J(jj1))) + 8*Power(J(jj1),3)*sqrt((1 + J(jj1))/(1 + 2*J(jj1))) + 3*J(jj1)*(-5*sqrt((1 + J(jj1))/(1 + 2*J(jj1))) + sqrt(1 + 3*J(jj1) + 2*Power(J(jj1),2))) - 2*Power(J(jj1),2)*(5*sqrt((1 + J(jj1))/(1 + 2*J(jj1))) + 2*sqrt(1 + 3*J(jj1) + 2*Power(J(jj1),2)))))/(J(jj1)*(1 + J(jj1))*Power(3 + 2*J(jj1),1.5)));
+          case 172: return (5*sqrt((Power(J(jj1),3)*(1 + 3*J(jj1) + 2*Power(J(jj1),2)))/(2 + J(jj1))) - 2*sqrt((Power(J(jj1),5)*(1 + 3*J(jj1) + 2*Power(J(jj1),2)))/(2 + J(jj1))) + 24*J(jj1)*sqrt((J(jj1)*(1 + J(jj1)))/(2 + 5*J(jj1) + 2*Power(J(jj1),2))) - 18*sqrt((Power(1 - 2*J(jj1),2)*J(jj1)*(1 + J(jj1)))/(2 + 5*J(jj1) + 2*Power(J(jj1),2))) - 24*sqrt((Power(J(jj1),5)*(1 + J(jj1)))/(2 + 5*J(jj1) + 2*Power(J(jj1),2))))/((3 + 2*J(jj1))*sqrt(J(jj1)*(1 + J(jj1))*(2 + 5*J(jj1) + 2*Power(J(jj1),2))));
+          case 173: return (-3*(10*sqrt((J(jj1)*(1 + J(jj1)))/(10 + 9*J(jj1) + 2*Power(J(jj1),2))) + 9*sqrt((Power(J(jj1),3)*(1 + J(jj1)))/(10 + 9*J(jj1) + 2*Power(J(jj1),2))) + 2*sqrt((Power(J(jj1),5)*(1 + J(jj1)))/(10 + 9*J(jj1) + 2*Power(J(jj1),2)))))/((3 + 2*J(jj1))*sqrt(J(jj1)*(1 + J(jj1))*(10 + 9*J(jj1) + 2*Power(J(jj1),2))));
+          case 174: return (-6*(2 + J(jj1)))/(sqrt(2 + 3*J(jj1) + Power(J(jj1),2))*(3 + 8*J(jj1) + 4*Power(J(jj1),2)));
+          case 175: return 2*sqrt(3)*(5 + 2*J(jj1))*sqrt(J(jj1)/(Power(3 + 2*J(jj1),2)*(5 + 17*J(jj1) + 16*Power(J(jj1),2) + 4*Power(J(jj1),3))));
+          case 176: return (-2*sqrt(J(jj1)*(3 + J(jj1))))/(3 + 2*J(jj1));
+          case 177: return 1;
+          default: my_assert_not_reached();
+        }
+      };
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(1, 4));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -119,10 +1223,370 @@ MatrixElements<SC> SymmetryQJ<SC>::recalc_quadruplet(const DiagInfo<SC> &diag, c
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "qj/qj-quad3.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {2, 3},
+        {3, 2},
+        {3, 3},
+        {4, 4},
+        {4, 5},
+        {4, 6},
+        {5, 4},
+        {5, 5},
+        {5, 6},
+        {5, 7},
+        {6, 5},
+        {6, 6},
+        {6, 7},
+        {7, 6},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {10, 10},
+        {10, 11},
+        {10, 12},
+        {11, 10},
+        {11, 11},
+        {11, 12},
+        {12, 11},
+        {12, 12},
+        {13, 13},
+        {13, 14},
+        {13, 15},
+        {14, 13},
+        {14, 14},
+        {14, 15},
+        {14, 16},
+        {15, 14},
+        {15, 15},
+        {15, 16},
+        {15, 17},
+        {16, 15},
+        {16, 16},
+        {16, 17},
+        {17, 16},
+        {17, 17},
+        {18, 18},
+        {18, 19},
+        {18, 20},
+        {19, 18},
+        {19, 19},
+        {19, 20},
+        {19, 21},
+        {20, 19},
+        {20, 20},
+        {20, 21},
+        {20, 22},
+        {21, 20},
+        {21, 21},
+        {21, 22},
+        {22, 21},
+        {22, 22},
+        {23, 23},
+        {23, 24},
+        {24, 23},
+        {24, 24},
+        {25, 25},
+        {25, 26},
+        {25, 27},
+        {26, 25},
+        {26, 26},
+        {26, 27},
+        {26, 28},
+        {27, 26},
+        {27, 27},
+        {27, 28},
+        {28, 27},
+        {28, 28},
+        {29, 29},
+        {29, 30},
+        {29, 31},
+        {30, 29},
+        {30, 30},
+        {30, 31},
+        {30, 32},
+        {31, 30},
+        {31, 31},
+        {31, 32},
+        {32, 31},
+        {32, 32},
+        {33, 33},
+        {33, 34},
+        {33, 35},
+        {34, 33},
+        {34, 34},
+        {34, 35},
+        {34, 36},
+        {35, 34},
+        {35, 35},
+        {35, 36},
+        {36, 35},
+        {36, 36},
+        {37, 37},
+        {37, 38},
+        {37, 39},
+        {38, 37},
+        {38, 38},
+        {38, 39},
+        {38, 40},
+        {39, 38},
+        {39, 39},
+        {39, 40},
+        {39, 41},
+        {40, 39},
+        {40, 40},
+        {40, 41},
+        {40, 42},
+        {41, 40},
+        {41, 41},
+        {41, 42},
+        {42, 41},
+        {42, 42},
+        {43, 43},
+        {44, 44},
+        {45, 45},
+        {45, 46},
+        {45, 47},
+        {46, 45},
+        {46, 46},
+        {46, 47},
+        {47, 46},
+        {47, 47},
+        {48, 48},
+        {48, 49},
+        {48, 50},
+        {49, 48},
+        {49, 49},
+        {49, 50},
+        {49, 51},
+        {50, 49},
+        {50, 50},
+        {50, 51},
+        {50, 52},
+        {51, 50},
+        {51, 51},
+        {51, 52},
+        {52, 51},
+        {52, 52},
+        {53, 53},
+        {53, 54},
+        {53, 55},
+        {54, 53},
+        {54, 54},
+        {54, 55},
+        {54, 56},
+        {55, 54},
+        {55, 55},
+        {55, 56},
+        {55, 57},
+        {56, 55},
+        {56, 56},
+        {56, 57},
+        {57, 56},
+        {57, 57},
+        {58, 58},
+        {58, 59},
+        {59, 58},
+        {59, 59},
+        {60, 60},
+        {60, 61},
+        {60, 62},
+        {61, 60},
+        {61, 61},
+        {61, 62},
+        {61, 63},
+        {62, 61},
+        {62, 62},
+        {62, 63},
+        {63, 62},
+        {63, 63},
+        {64, 64}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return -2*sqrt((-1 + Power(J(jj1),2))/(-1 + 4*Power(J(jj1),2)));
+          case 2: return -2/(1 + 2*J(jj1));
+          case 3: return sqrt(3)/sqrt(-1 + 4*Power(J(jj1),2));
+          case 4: return -(sqrt(-3 + 4*J(jj1) + 4*Power(J(jj1),2))/(1 + 2*J(jj1)));
+          case 5: return (-2*sqrt((-2 + J(jj1))*(1 + J(jj1))))/(-1 + 2*J(jj1));
+          case 6: return -2*sqrt(3)*sqrt(((1 + J(jj1))*(-3 + 2*J(jj1)))/(Power(1 - 2*J(jj1),2)*J(jj1)*(1 + 2*J(jj1))));
+          case 7: return (6*sqrt((-1 + J(jj1))/J(jj1)))/(1 - 4*Power(J(jj1),2));
+          case 8: return (-2*(-2 + J(jj1))*sqrt((1 + J(jj1))/(-1 + 2*J(jj1))) + sqrt(-1 + J(jj1) + 2*Power(J(jj1),2)))/sqrt(-1 + J(jj1) + 2*Power(J(jj1),2));
+          case 9: return (13 - 4*Power(J(jj1),2))/(-1 + 4*Power(J(jj1),2));
+          case 10: return -((13 - 4*J(jj1) - 8*Power(J(jj1),2))/(1 + J(jj1) - 4*Power(J(jj1),2) - 4*Power(J(jj1),3)));
+          case 11: return -3/(1 + 3*J(jj1) + 2*Power(J(jj1),2));
+          case 12: return (2*sqrt(3)*sqrt(-7 + 3/J(jj1) + 4*Power(J(jj1),2)))/(-1 + 4*Power(J(jj1),2));
+          case 13: return (-2*(-3 + J(jj1) + Power(J(jj1),2)))/(sqrt(J(jj1)*(1 + J(jj1)))*(1 + 2*J(jj1)));
+          case 14: return (-2*sqrt(3)*(6*sqrt((J(jj1)*(-1 + J(jj1) + 2*Power(J(jj1),2)))/(2 + 5*J(jj1) + 2*Power(J(jj1),2))) + 6*J(jj1)*sqrt((J(jj1)*(-1 + J(jj1) + 2*Power(J(jj1),2)))/(2 + 5*J(jj1) + 2*Power(J(jj1),2))) + sqrt((Power(J(jj1),3)*(-1 - J(jj1) + 4*Power(J(jj1),2) + 4*Power(J(jj1),3)))/(2 + J(jj1)))))/sqrt(J(jj1)*Power(1 + J(jj1),2)*(1 + 2*J(jj1))*Power(3 + 2*J(jj1),3));
+          case 15: return (15*sqrt((J(jj1)*(-1 + 2*J(jj1)))/(3 + 2*J(jj1))) + 10*J(jj1)*sqrt((J(jj1)*(-1 + 2*J(jj1)))/(3 + 2*J(jj1))) - 6*sqrt((Power(J(jj1),5)*(-1 + 2*J(jj1)))/(3 + 2*J(jj1))) - 4*sqrt((Power(J(jj1),7)*(-1 + 2*J(jj1)))/(3 + 2*J(jj1))) + sqrt(J(jj1)*(-3 + 4*J(jj1) + 4*Power(J(jj1),2))) + 3*J(jj1)*sqrt(J(jj1)*(-3 + 4*J(jj1) + 4*Power(J(jj1),2))) + 2*sqrt(Power(J(jj1),5)*(-3 + 4*J(jj1) + 4*Power(J(jj1),2))))/((1 + J(jj1))*(1 + 2*J(jj1))*sqrt(-6 + 5*J(jj1) + 12*Power(J(jj1),2) + 4*Power(J(jj1),3)));
+          case 16: return (sqrt((1 + J(jj1))/(2 + 5*J(jj1) + 2*Power(J(jj1),2)))*(-6*(1 + 2*J(jj1))*sqrt((J(jj1)*(-1 + J(jj1) + 2*Power(J(jj1),2)))/(15 + 16*J(jj1) + 4*Power(J(jj1),2))) - (1 + 2*J(jj1))*sqrt((J(jj1)*(-3 + J(jj1) + 8*Power(J(jj1),2) + 4*Power(J(jj1),3)))/(5 + 2*J(jj1))) - 12*sqrt((J(jj1)*(-1 + 2*J(jj1)))/(15 + 31*J(jj1) + 20*Power(J(jj1),2) + 4*Power(J(jj1),3))) - 9*(1 + 2*J(jj1))*sqrt((J(jj1)*(-1 + 2*J(jj1)))/(15 + 31*J(jj1) + 20*Power(J(jj1),2) + 4*Power(J(jj1),3)))))/(3 + 5*J(jj1) + 2*Power(J(jj1),2));
+          case 17: return 1;
+          case 18: return 1;
+          case 19: return sqrt((3 + J(jj1) - 2*Power(J(jj1),2))/(J(jj1) - 2*Power(J(jj1),2)));
+          case 20: return (4*sqrt((1 - Power(J(jj1),2))/(J(jj1) - 2*Power(J(jj1),2))))/(1 + 2*J(jj1));
+          case 21: return sqrt(3)/(sqrt(J(jj1)*(1 + J(jj1)))*(1 + 2*J(jj1)));
+          case 22: return -(sqrt(3)/sqrt(J(jj1)*(-1 + 2*J(jj1))));
+          case 23: return (-4 + J(jj1) + 2*Power(J(jj1),2))/sqrt(J(jj1)*(1 + J(jj1))*(-1 + 4*Power(J(jj1),2)));
+          case 24: return (3*sqrt((-1 + 2*J(jj1))/(J(jj1)*(3 + 5*J(jj1) + 2*Power(J(jj1),2)))) + 2*sqrt((J(jj1)*(-1 + 2*J(jj1)))/(3 + 5*J(jj1) + 2*Power(J(jj1),2))))/sqrt(1 + 3*J(jj1) + 2*Power(J(jj1),2));
+          case 25: return (-7*sqrt((-1 + 2*J(jj1))/(1 + J(jj1))) + 4*Power(J(jj1),2)*sqrt((-1 + 2*J(jj1))/(1 + J(jj1))) - 2*sqrt(-1 + J(jj1) + 2*Power(J(jj1),2)) - 4*J(jj1)*sqrt(-1 + J(jj1) + 2*Power(J(jj1),2)))/(sqrt(3)*(1 + 2*J(jj1))*sqrt(-3 + 4*J(jj1) + 4*Power(J(jj1),2)));
+          case 26: return (2*sqrt((J(jj1)*(-1 + 4*Power(J(jj1),2)))/(2 + 3*J(jj1) + Power(J(jj1),2))) + 3*sqrt((J(jj1)*(-1 + 2*J(jj1)))/(2 + 7*J(jj1) + 7*Power(J(jj1),2) + 2*Power(J(jj1),3))) + sqrt((J(jj1)*(-1 - J(jj1) + 4*Power(J(jj1),2) + 4*Power(J(jj1),3)))/(2 + J(jj1))))/sqrt((1 + J(jj1))*(3 + 8*J(jj1) + 4*Power(J(jj1),2)));
+          case 27: return sqrt(((1 + J(jj1))*(-5 + 2*J(jj1)))/(1 - 3*J(jj1) + 2*Power(J(jj1),2)));
+          case 28: return (4*sqrt((4 + 2*J(jj1) - 2*Power(J(jj1),2))/(1 + J(jj1) - 2*Power(J(jj1),2))))/(-1 + 2*J(jj1));
+          case 29: return 3*sqrt((-6 + 4*J(jj1))/(Power(1 - 2*J(jj1),2)*J(jj1)*(-1 - J(jj1) + 2*Power(J(jj1),2))));
+          case 30: return -(sqrt(6)/sqrt(1 - 3*J(jj1) + 2*Power(J(jj1),2)));
+          case 31: return -((9*sqrt(1 + 1/J(jj1)) + sqrt(J(jj1)*(1 + J(jj1))) - 2*sqrt(Power(J(jj1),3)*(1 + J(jj1))))/sqrt(1 - 5*Power(J(jj1),2) + 4*Power(J(jj1),4)));
+          case 32: return (2*(-5 + 2*Power(J(jj1),2))*sqrt((3 + 3*J(jj1))/(J(jj1) + Power(J(jj1),2) - 6*Power(J(jj1),3) - 4*Power(J(jj1),4) + 8*Power(J(jj1),5))))/(1 + J(jj1));
+          case 33: return (3*sqrt(3)*(-3 + J(jj1) + 2*Power(J(jj1),2)))/((1 + J(jj1))*(1 + 2*J(jj1))*sqrt(J(jj1)*(3 - 7*J(jj1) + 4*Power(J(jj1),3))));
+          case 34: return -(sqrt(1 + J(jj1))*(-8*sqrt((Power(-2 + J(jj1),2)*(-3 + 2*J(jj1)))/(Power(1 - 2*J(jj1),2)*J(jj1)*(3 + 11*J(jj1) + 12*Power(J(jj1),2) + 4*Power(J(jj1),3)))) + (7 - 2*J(jj1))/sqrt((J(jj1)*(3 + 11*J(jj1) + 12*Power(J(jj1),2) + 4*Power(J(jj1),3)))/(-3 + 2*J(jj1))) + (2*J(jj1)*(-3 + 2*J(jj1)))/sqrt(J(jj1)*(-9 - 27*J(jj1) - 14*Power(J(jj1),2) + 12*Power(J(jj1),3) + 8*Power(J(jj1),4)))));
+          case 35: return sqrt(1 + J(jj1))*(18*sqrt((Power(3 - 2*J(jj1),2)*(-1 + J(jj1)))/(Power(1 - 2*J(jj1),2)*J(jj1)*Power(1 + J(jj1),3)*(3 + 8*J(jj1) + 4*Power(J(jj1),2)))) + (12*(-2 + J(jj1)))/(Power(1 + J(jj1),1.5)*sqrt((J(jj1)*(3 + 8*J(jj1) + 4*Power(J(jj1),2)))/(-1 + J(jj1)))) + ((7 - 9*J(jj1) + 2*Power(J(jj1),2))*sqrt(J(jj1)/(-3 - 5*J(jj1) + 4*Power(J(jj1),2) + 4*Power(J(jj1),3))))/Power(1 + J(jj1),1.5));
+          case 36: return (sqrt(3)*sqrt(1 + J(jj1))*((3*(-7 + 6*J(jj1)))/sqrt((J(jj1)*(1 + 2*J(jj1)))/(-1 + 2*J(jj1))) + (48*(-1 + J(jj1)))/sqrt(J(jj1)*(-1 + 4*Power(J(jj1),2))) + (2*J(jj1)*(-3 + 2*J(jj1))*(-1 + 2*J(jj1)))/sqrt(J(jj1)*(-1 + 4*Power(J(jj1),2)))))/Power(3 + 5*J(jj1) + 2*Power(J(jj1),2),1.5);
+          case 37: return (3*sqrt(2))/((1 + J(jj1))*sqrt(3 + 8*J(jj1) + 4*Power(J(jj1),2)));
+          case 38: return sqrt(1 + J(jj1))*((J(jj1)*(7 - 9*J(jj1) + 2*Power(J(jj1),2)))/sqrt(J(jj1)*Power(1 + J(jj1),3)*(-6 - J(jj1) + 5*Power(J(jj1),2) + 2*Power(J(jj1),3))) + (6*(-3 + 2*J(jj1))*sqrt((-1 + J(jj1))/(J(jj1)*(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3)))))/(1 + 3*J(jj1) + 2*Power(J(jj1),2)) + (12*(-2 + J(jj1))*J(jj1)*sqrt((-1 + J(jj1))/(J(jj1)*Power(1 + 2*J(jj1),2)*(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3)))))/(1 + J(jj1)) - 2*(-1 + J(jj1))*sqrt(J(jj1)/(-6 - 7*J(jj1) + 4*Power(J(jj1),2) + 7*Power(J(jj1),3) + 2*Power(J(jj1),4))));
+          case 39: return (-8 + 3*J(jj1) + 2*Power(J(jj1),2))/((1 + J(jj1))*(1 + 2*J(jj1)));
+          case 40: return (sqrt(2)*(30*sqrt((J(jj1)*(-3 + 4*J(jj1) + 4*Power(J(jj1),2)))/(5 + 2*J(jj1))) + 47*sqrt((Power(J(jj1),3)*(-3 + 4*J(jj1) + 4*Power(J(jj1),2)))/(5 + 2*J(jj1))) + 24*sqrt((Power(J(jj1),5)*(-3 + 4*J(jj1) + 4*Power(J(jj1),2)))/(5 + 2*J(jj1))) + 4*sqrt((Power(J(jj1),7)*(-3 + 4*J(jj1) + 4*Power(J(jj1),2)))/(5 + 2*J(jj1)))))/sqrt(J(jj1)*Power(1 + J(jj1),2)*(1 + 2*J(jj1))*Power(6 + 7*J(jj1) + 2*Power(J(jj1),2),3));
+          case 41: return sqrt(0.6666666666666666)*sqrt(1 + J(jj1))*(3*(-7 + 6*J(jj1))*sqrt((J(jj1)*(1 + 2*J(jj1)))/(Power(2 + J(jj1),2)*(5 + 2*J(jj1))*Power(3 + 5*J(jj1) + 2*Power(J(jj1),2),3))) - 2*sqrt((J(jj1)*(1 + 2*J(jj1)))/(15 + 31*J(jj1) + 20*Power(J(jj1),2) + 4*Power(J(jj1),3))) + (-5 + 2*J(jj1))*sqrt((J(jj1)*(1 + 2*J(jj1)))/(Power(2 + J(jj1),2)*(15 + 31*J(jj1) + 20*Power(J(jj1),2) + 4*Power(J(jj1),3)))) + (6*(-3 + 2*J(jj1))*(1 + 2*J(jj1))*sqrt(J(jj1)/(15 + 61*J(jj1) + 82*Power(J(jj1),2) + 44*Power(J(jj1),3) + 8*Power(J(jj1),4))))/(6 + 7*J(jj1) + 2*Power(J(jj1),2)) + (24*(-1 + J(jj1))*sqrt(J(jj1)/(Power(2 + J(jj1),2)*(15 + 61*J(jj1) + 82*Power(J(jj1),2) + 44*Power(J(jj1),3) + 8*Power(J(jj1),4)))))/(3 + 5*J(jj1) + 2*Power(J(jj1),2)));
+          case 42: return -((sqrt((1 + J(jj1))/(5 + 12*J(jj1) + 4*Power(J(jj1),2)))*(-4*(1 + J(jj1))*(1 + 2*J(jj1))*sqrt((J(jj1)*(-3 + 4*J(jj1) + 4*Power(J(jj1),2)))/(6 + 5*J(jj1) + Power(J(jj1),2))) - 30*sqrt((J(jj1)*(-1 + 2*J(jj1)))/(18 + 27*J(jj1) + 13*Power(J(jj1),2) + 2*Power(J(jj1),3))) - 24*(1 + 2*J(jj1))*sqrt((J(jj1)*(-1 + 2*J(jj1)))/(18 + 27*J(jj1) + 13*Power(J(jj1),2) + 2*Power(J(jj1),3))) - 18*(1 + J(jj1))*(1 + 2*J(jj1))*sqrt((J(jj1)*(-1 + 2*J(jj1)))/(18 + 27*J(jj1) + 13*Power(J(jj1),2) + 2*Power(J(jj1),3))) - (1 + J(jj1))*(1 + 2*J(jj1))*sqrt((J(jj1)*(-6 + 5*J(jj1) + 12*Power(J(jj1),2) + 4*Power(J(jj1),3)))/(3 + J(jj1)))))/(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3)));
+          case 43: return sqrt(((1 + J(jj1))*(-5 + 2*J(jj1)))/(1 - 3*J(jj1) + 2*Power(J(jj1),2)));
+          case 44: return (4*sqrt((4 + 2*J(jj1) - 2*Power(J(jj1),2))/(1 + J(jj1) - 2*Power(J(jj1),2))))/(-1 + 2*J(jj1));
+          case 45: return 3*sqrt((-6 + 4*J(jj1))/(Power(1 - 2*J(jj1),2)*J(jj1)*(-1 - J(jj1) + 2*Power(J(jj1),2))));
+          case 46: return -(sqrt(6)/sqrt(1 - 3*J(jj1) + 2*Power(J(jj1),2)));
+          case 47: return -((9*sqrt(1 + 1/J(jj1)) + sqrt(J(jj1)*(1 + J(jj1))) - 2*sqrt(Power(J(jj1),3)*(1 + J(jj1))))/sqrt(1 - 5*Power(J(jj1),2) + 4*Power(J(jj1),4)));
+          case 48: return (2*(-5 + 2*Power(J(jj1),2))*sqrt((3 + 3*J(jj1))/(J(jj1) + Power(J(jj1),2) - 6*Power(J(jj1),3) - 4*Power(J(jj1),4) + 8*Power(J(jj1),5))))/(1 + J(jj1));
+          case 49: return (3*sqrt(3)*(-3 + J(jj1) + 2*Power(J(jj1),2)))/((1 + J(jj1))*(1 + 2*J(jj1))*sqrt(J(jj1)*(3 - 7*J(jj1) + 4*Power(J(jj1),3))));
+          case 50: return -(sqrt(1 + J(jj1))*(-8*sqrt((Power(-2 + J(jj1),2)*(-3 + 2*J(jj1)))/(Power(1 - 2*J(jj1),2)*J(jj1)*(3 + 11*J(jj1) + 12*Power(J(jj1),2) + 4*Power(J(jj1),3)))) + (7 - 2*J(jj1))/sqrt((J(jj1)*(3 + 11*J(jj1) + 12*Power(J(jj1),2) + 4*Power(J(jj1),3)))/(-3 + 2*J(jj1))) + (2*J(jj1)*(-3 + 2*J(jj1)))/sqrt(J(jj1)*(-9 - 27*J(jj1) - 14*Power(J(jj1),2) + 12*Power(J(jj1),3) + 8*Power(J(jj1),4)))));
+          case 51: return sqrt(1 + J(jj1))*(18*sqrt((Power(3 - 2*J(jj1),2)*(-1 + J(jj1)))/(Power(1 - 2*J(jj1),2)*J(jj1)*Power(1 + J(jj1),3)*(3 + 8*J(jj1) + 4*Power(J(jj1),2)))) + (12*(-2 + J(jj1)))/(Power(1 + J(jj1),1.5)*sqrt((J(jj1)*(3 + 8*J(jj1) + 4*Power(J(jj1),2)))/(-1 + J(jj1)))) + ((7 - 9*J(jj1) + 2*Power(J(jj1),2))*sqrt(J(jj1)/(-3 - 5*J(jj1) + 4*Power(J(jj1),2) + 4*Power(J(jj1),3))))/Power(1 + J(jj1),1.5));
+          case 52: return (sqrt(3)*sqrt(1 + J(jj1))*((3*(-7 + 6*J(jj1)))/sqrt((J(jj1)*(1 + 2*J(jj1)))/(-1 + 2*J(jj1))) + (48*(-1 + J(jj1)))/sqrt(J(jj1)*(-1 + 4*Power(J(jj1),2))) + (2*J(jj1)*(-3 + 2*J(jj1))*(-1 + 2*J(jj1)))/sqrt(J(jj1)*(-1 + 4*Power(J(jj1),2)))))/Power(3 + 5*J(jj1) + 2*Power(J(jj1),2),1.5);
+          case 53: return (3*sqrt(2))/((1 + J(jj1))*sqrt(3 + 8*J(jj1) + 4*Power(J(jj1),2)));
+          case 54: return sqrt(1 + J(jj1))*((J(jj1)*(7 - 9*J(jj1) + 2*Power(J(jj1),2)))/sqrt(J(jj1)*Power(1 + J(jj1),3)*(-6 - J(jj1) + 5*Power(J(jj1),2) + 2*Power(J(jj1),3))) + (6*(-3 + 2*J(jj1))*sqrt((-1 + J(jj1))/(J(jj1)*(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3)))))/(1 + 3*J(jj1) + 2*Power(J(jj1),2)) + (12*(-2 + J(jj1))*J(jj1)*sqrt((-1 + J(jj1))/(J(jj1)*Power(1 + 2*J(jj1),2)*(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3)))))/(1 + J(jj1)) - 2*(-1 + J(jj1))*sqrt(J(jj1)/(-6 - 7*J(jj1) + 4*Power(J(jj1),2) + 7*Power(J(jj1),3) + 2*Power(J(jj1),4))));
+          case 55: return (-8 + 3*J(jj1) + 2*Power(J(jj1),2))/((1 + J(jj1))*(1 + 2*J(jj1)));
+          case 56: return (sqrt(2)*(30*sqrt((J(jj1)*(-3 + 4*J(jj1) + 4*Power(J(jj1),2)))/(5 + 2*J(jj1))) + 47*sqrt((Power(J(jj1),3)*(-3 + 4*J(jj1) + 4*Power(J(jj1),2)))/(5 + 2*J(jj1))) + 24*sqrt((Power(J(jj1),5)*(-3 + 4*J(jj1) + 4*Power(J(jj1),2)))/(5 + 2*J(jj1))) + 4*sqrt((Power(J(jj1),7)*(-3 + 4*J(jj1) + 4*Power(J(jj1),2)))/(5 + 2*J(jj1)))))/sqrt(J(jj1)*Power(1 + J(jj1),2)*(1 + 2*J(jj1))*Power(6 + 7*J(jj1) + 2*Power(J(jj1),2),3));
+          case 57: return sqrt(0.6666666666666666)*sqrt(1 + J(jj1))*(3*(-7 + 6*J(jj1))*sqrt((J(jj1)*(1 + 2*J(jj1)))/(Power(2 + J(jj1),2)*(5 + 2*J(jj1))*Power(3 + 5*J(jj1) + 2*Power(J(jj1),2),3))) - 2*sqrt((J(jj1)*(1 + 2*J(jj1)))/(15 + 31*J(jj1) + 20*Power(J(jj1),2) + 4*Power(J(jj1),3))) + (-5 + 2*J(jj1))*sqrt((J(jj1)*(1 + 2*J(jj1)))/(Power(2 + J(jj1),2)*(15 + 31*J(jj1) + 20*Power(J(jj1),2) + 4*Power(J(jj1),3)))) + (6*(-3 + 2*J(jj1))*(1 + 2*J(jj1))*sqrt(J(jj1)/(15 + 61*J(jj1) + 82*Power(J(jj1),2) + 44*Power(J(jj1),3) + 8*Power(J(jj1),4))))/(6 + 7*J(jj1) + 2*Power(J(jj1),2)) + (24*(-1 + J(jj1))*sqrt(J(jj1)/(Power(2 + J(jj1),2)*(15 + 61*J(jj1) + 82*Power(J(jj1),2) + 44*Power(J(jj1),3) + 8*Power(J(jj1),4)))))/(3 + 5*J(jj1) + 2*Power(J(jj1),2)));
+          case 58: return -((sqrt((1 + J(jj1))/(5 + 12*J(jj1) + 4*Power(J(jj1),2)))*(-4*(1 + J(jj1))*(1 + 2*J(jj1))*sqrt((J(jj1)*(-3 + 4*J(jj1) + 4*Power(J(jj1),2)))/(6 + 5*J(jj1) + Power(J(jj1),2))) - 30*sqrt((J(jj1)*(-1 + 2*J(jj1)))/(18 + 27*J(jj1) + 13*Power(J(jj1),2) + 2*Power(J(jj1),3))) - 24*(1 + 2*J(jj1))*sqrt((J(jj1)*(-1 + 2*J(jj1)))/(18 + 27*J(jj1) + 13*Power(J(jj1),2) + 2*Power(J(jj1),3))) - 18*(1 + J(jj1))*(1 + 2*J(jj1))*sqrt((J(jj1)*(-1 + 2*J(jj1)))/(18 + 27*J(jj1) + 13*Power(J(jj1),2) + 2*Power(J(jj1),3))) - (1 + J(jj1))*(1 + 2*J(jj1))*sqrt((J(jj1)*(-6 + 5*J(jj1) + 12*Power(J(jj1),2) + 4*Power(J(jj1),3)))/(3 + J(jj1)))))/(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3)));
+          case 59: return -2*sqrt((-1 + Power(J(jj1),2))/(-1 + 4*Power(J(jj1),2)));
+          case 60: return -2/(1 + 2*J(jj1));
+          case 61: return sqrt(3)/sqrt(-1 + 4*Power(J(jj1),2));
+          case 62: return -(sqrt(-3 + 4*J(jj1) + 4*Power(J(jj1),2))/(1 + 2*J(jj1)));
+          case 63: return (-2*sqrt((-2 + J(jj1))*(1 + J(jj1))))/(-1 + 2*J(jj1));
+          case 64: return -2*sqrt(3)*sqrt(((1 + J(jj1))*(-3 + 2*J(jj1)))/(Power(1 - 2*J(jj1),2)*J(jj1)*(1 + 2*J(jj1))));
+          case 65: return (6*sqrt((-1 + J(jj1))/J(jj1)))/(1 - 4*Power(J(jj1),2));
+          case 66: return (-2*(-2 + J(jj1))*sqrt((1 + J(jj1))/(-1 + 2*J(jj1))) + sqrt(-1 + J(jj1) + 2*Power(J(jj1),2)))/sqrt(-1 + J(jj1) + 2*Power(J(jj1),2));
+          case 67: return (13 - 4*Power(J(jj1),2))/(-1 + 4*Power(J(jj1),2));
+          case 68: return -((13 - 4*J(jj1) - 8*Power(J(jj1),2))/(1 + J(jj1) - 4*Power(J(jj1),2) - 4*Power(J(jj1),3)));
+          case 69: return -3/(1 + 3*J(jj1) + 2*Power(J(jj1),2));
+          case 70: return (2*sqrt(3)*sqrt(-7 + 3/J(jj1) + 4*Power(J(jj1),2)))/(-1 + 4*Power(J(jj1),2));
+          case 71: return (-2*(-3 + J(jj1) + Power(J(jj1),2)))/(sqrt(J(jj1)*(1 + J(jj1)))*(1 + 2*J(jj1)));
+          case 72: return (-2*sqrt(3)*(6*sqrt((J(jj1)*(-1 + J(jj1) + 2*Power(J(jj1),2)))/(2 + 5*J(jj1) + 2*Power(J(jj1),2))) + 6*J(jj1)*sqrt((J(jj1)*(-1 + J(jj1) + 2*Power(J(jj1),2)))/(2 + 5*J(jj1) + 2*Power(J(jj1),2))) + sqrt((Power(J(jj1),3)*(-1 - J(jj1) + 4*Power(J(jj1),2) + 4*Power(J(jj1),3)))/(2 + J(jj1)))))/sqrt(J(jj1)*Power(1 + J(jj1),2)*(1 + 2*J(jj1))*Power(3 + 2*J(jj1),3));
+          case 73: return (15*sqrt((J(jj1)*(-1 + 2*J(jj1)))/(3 + 2*J(jj1))) + 10*J(jj1)*sqrt((J(jj1)*(-1 + 2*J(jj1)))/(3 + 2*J(jj1))) - 6*sqrt((Power(J(jj1),5)*(-1 + 2*J(jj1)))/(3 + 2*J(jj1))) - 4*sqrt((Power(J(jj1),7)*(-1 + 2*J(jj1)))/(3 + 2*J(jj1))) + sqrt(J(jj1)*(-3 + 4*J(jj1) + 4*Power(J(jj1),2))) + 3*J(jj1)*sqrt(J(jj1)*(-3 + 4*J(jj1) + 4*Power(J(jj1),2))) + 2*sqrt(Power(J(jj1),5)*(-3 + 4*J(jj1) + 4*Power(J(jj1),2))))/((1 + J(jj1))*(1 + 2*J(jj1))*sqrt(-6 + 5*J(jj1) + 12*Power(J(jj1),2) + 4*Power(J(jj1),3)));
+          case 74: return (sqrt((1 + J(jj1))/(2 + 5*J(jj1) + 2*Power(J(jj1),2)))*(-6*(1 + 2*J(jj1))*sqrt((J(jj1)*(-1 + J(jj1) + 2*Power(J(jj1),2)))/(15 + 16*J(jj1) + 4*Power(J(jj1),2))) - (1 + 2*J(jj1))*sqrt((J(jj1)*(-3 + J(jj1) + 8*Power(J(jj1),2) + 4*Power(J(jj1),3)))/(5 + 2*J(jj1))) - 12*sqrt((J(jj1)*(-1 + 2*J(jj1)))/(15 + 31*J(jj1) + 20*Power(J(jj1),2) + 4*Power(J(jj1),3))) - 9*(1 + 2*J(jj1))*sqrt((J(jj1)*(-1 + 2*J(jj1)))/(15 + 31*J(jj1) + 20*Power(J(jj1),2) + 4*Power(J(jj1),3)))))/(3 + 5*J(jj1) + 2*Power(J(jj1),2));
+          case 75: return (-2*sqrt((-2 + J(jj1))*(1 + J(jj1))))/(-1 + 2*J(jj1));
+          case 76: return -2*sqrt(3)*sqrt(((1 + J(jj1))*(-3 + 2*J(jj1)))/(Power(1 - 2*J(jj1),2)*J(jj1)*(1 + 2*J(jj1))));
+          case 77: return (6*sqrt((-1 + J(jj1))/J(jj1)))/(1 - 4*Power(J(jj1),2));
+          case 78: return (-2*(-2 + J(jj1))*sqrt((1 + J(jj1))/(-1 + 2*J(jj1))) + sqrt(-1 + J(jj1) + 2*Power(J(jj1),2)))/sqrt(-1 + J(jj1) + 2*Power(J(jj1),2));
+          case 79: return (13 - 4*Power(J(jj1),2))/(-1 + 4*Power(J(jj1),2));
+          case 80: return -((13 - 4*J(jj1) - 8*Power(J(jj1),2))/(1 + J(jj1) - 4*Power(J(jj1),2) - 4*Power(J(jj1),3)));
+          case 81: return -3/(1 + 3*J(jj1) + 2*Power(J(jj1),2));
+          case 82: return (2*sqrt(3)*sqrt(-7 + 3/J(jj1) + 4*Power(J(jj1),2)))/(-1 + 4*Power(J(jj1),2));
+          case 83: return (-2*(-3 + J(jj1) + Power(J(jj1),2)))/(sqrt(J(jj1)*(1 + J(jj1)))*(1 + 2*J(jj1)));
+          case 84: return (-2*sqrt(3)*(6*sqrt((J(jj1)*(-1 + J(jj1) + 2*Power(J(jj1),2)))/(2 + 5*J(jj1) + 2*Power(J(jj1),2))) + 6*J(jj1)*sqrt((J(jj1)*(-1 + J(jj1) + 2*Power(J(jj1),2)))/(2 + 5*J(jj1) + 2*Power(J(jj1),2))) + sqrt((Power(J(jj1),3)*(-1 - J(jj1) + 4*Power(J(jj1),2) + 4*Power(J(jj1),3)))/(2 + J(jj1)))))/sqrt(J(jj1)*Power(1 + J(jj1),2)*(1 + 2*J(jj1))*Power(3 + 2*J(jj1),3));
+          case 85: return (15*sqrt((J(jj1)*(-1 + 2*J(jj1)))/(3 + 2*J(jj1))) + 10*J(jj1)*sqrt((J(jj1)*(-1 + 2*J(jj1)))/(3 + 2*J(jj1))) - 6*sqrt((Power(J(jj1),5)*(-1 + 2*J(jj1)))/(3 + 2*J(jj1))) - 4*sqrt((Power(J(jj1),7)*(-1 + 2*J(jj1)))/(3 + 2*J(jj1))) + sqrt(J(jj1)*(-3 + 4*J(jj1) + 4*Power(J(jj1),2))) + 3*J(jj1)*sqrt(J(jj1)*(-3 + 4*J(jj1) + 4*Power(J(jj1),2))) + 2*sqrt(Power(J(jj1),5)*(-3 + 4*J(jj1) + 4*Power(J(jj1),2))))/((1 + J(jj1))*(1 + 2*J(jj1))*sqrt(-6 + 5*J(jj1) + 12*Power(J(jj1),2) + 4*Power(J(jj1),3)));
+          case 86: return (sqrt((1 + J(jj1))/(2 + 5*J(jj1) + 2*Power(J(jj1),2)))*(-6*(1 + 2*J(jj1))*sqrt((J(jj1)*(-1 + J(jj1) + 2*Power(J(jj1),2)))/(15 + 16*J(jj1) + 4*Power(J(jj1),2))) - (1 + 2*J(jj1))*sqrt((J(jj1)*(-3 + J(jj1) + 8*Power(J(jj1),2) + 4*Power(J(jj1),3)))/(5 + 2*J(jj1))) - 12*sqrt((J(jj1)*(-1 + 2*J(jj1)))/(15 + 31*J(jj1) + 20*Power(J(jj1),2) + 4*Power(J(jj1),3))) - 9*(1 + 2*J(jj1))*sqrt((J(jj1)*(-1 + 2*J(jj1)))/(15 + 31*J(jj1) + 20*Power(J(jj1),2) + 4*Power(J(jj1),3)))))/(3 + 5*J(jj1) + 2*Power(J(jj1),2));
+          case 87: return (-2*sqrt((-2 + J(jj1))*(1 + J(jj1))))/(-1 + 2*J(jj1));
+          case 88: return -2*sqrt(3)*sqrt(((1 + J(jj1))*(-3 + 2*J(jj1)))/(Power(1 - 2*J(jj1),2)*J(jj1)*(1 + 2*J(jj1))));
+          case 89: return (6*sqrt((-1 + J(jj1))/J(jj1)))/(1 - 4*Power(J(jj1),2));
+          case 90: return (-2*(-2 + J(jj1))*sqrt((1 + J(jj1))/(-1 + 2*J(jj1))) + sqrt(-1 + J(jj1) + 2*Power(J(jj1),2)))/sqrt(-1 + J(jj1) + 2*Power(J(jj1),2));
+          case 91: return (13 - 4*Power(J(jj1),2))/(-1 + 4*Power(J(jj1),2));
+          case 92: return -((13 - 4*J(jj1) - 8*Power(J(jj1),2))/(1 + J(jj1) - 4*Power(J(jj1),2) - 4*Power(J(jj1),3)));
+          case 93: return -3/(1 + 3*J(jj1) + 2*Power(J(jj1),2));
+          case 94: return (2*sqrt(3)*sqrt(-7 + 3/J(jj1) + 4*Power(J(jj1),2)))/(-1 + 4*Power(J(jj1),2));
+          case 95: return (-2*(-3 + J(jj1) + Power(J(jj1),2)))/(sqrt(J(jj1)*(1 + J(jj1)))*(1 + 2*J(jj1)));
+          case 96: return (-2*sqrt(3)*(6*sqrt((J(jj1)*(-1 + J(jj1) + 2*Power(J(jj1),2)))/(2 + 5*J(jj1) + 2*Power(J(jj1),2))) + 6*J(jj1)*sqrt((J(jj1)*(-1 + J(jj1) + 2*Power(J(jj1),2)))/(2 + 5*J(jj1) + 2*Power(J(jj1),2))) + sqrt((Power(J(jj1),3)*(-1 - J(jj1) + 4*Power(J(jj1),2) + 4*Power(J(jj1),3)))/(2 + J(jj1)))))/sqrt(J(jj1)*Power(1 + J(jj1),2)*(1 + 2*J(jj1))*Power(3 + 2*J(jj1),3));
+          case 97: return (15*sqrt((J(jj1)*(-1 + 2*J(jj1)))/(3 + 2*J(jj1))) + 10*J(jj1)*sqrt((J(jj1)*(-1 + 2*J(jj1)))/(3 + 2*J(jj1))) - 6*sqrt((Power(J(jj1),5)*(-1 + 2*J(jj1)))/(3 + 2*J(jj1))) - 4*sqrt((Power(J(jj1),7)*(-1 + 2*J(jj1)))/(3 + 2*J(jj1))) + sqrt(J(jj1)*(-3 + 4*J(jj1) + 4*Power(J(jj1),2))) + 3*J(jj1)*sqrt(J(jj1)*(-3 + 4*J(jj1) + 4*Power(J(jj1),2))) + 2*sqrt(Power(J(jj1),5)*(-3 + 4*J(jj1) + 4*Power(J(jj1),2))))/((1 + J(jj1))*(1 + 2*J(jj1))*sqrt(-6 + 5*J(jj1) + 12*Power(J(jj1),2) + 4*Power(J(jj1),3)));
+          case 98: return (sqrt((1 + J(jj1))/(2 + 5*J(jj1) + 2*Power(J(jj1),2)))*(-6*(1 + 2*J(jj1))*sqrt((J(jj1)*(-1 + J(jj1) + 2*Power(J(jj1),2)))/(15 + 16*J(jj1) + 4*Power(J(jj1),2))) - (1 + 2*J(jj1))*sqrt((J(jj1)*(-3 + J(jj1) + 8*Power(J(jj1),2) + 4*Power(J(jj1),3)))/(5 + 2*J(jj1))) - 12*sqrt((J(jj1)*(-1 + 2*J(jj1)))/(15 + 31*J(jj1) + 20*Power(J(jj1),2) + 4*Power(J(jj1),3))) - 9*(1 + 2*J(jj1))*sqrt((J(jj1)*(-1 + 2*J(jj1)))/(15 + 31*J(jj1) + 20*Power(J(jj1),2) + 4*Power(J(jj1),3)))))/(3 + 5*J(jj1) + 2*Power(J(jj1),2));
+          case 99: return -2*sqrt(((-3 + J(jj1))*(1 + J(jj1)))/(3 - 8*J(jj1) + 4*Power(J(jj1),2)));
+          case 100: return -2*sqrt(5)*sqrt(((1 + J(jj1))*(-5 + 2*J(jj1)))/(-3 + 5*J(jj1) + 10*Power(J(jj1),2) - 20*Power(J(jj1),3) + 8*Power(J(jj1),4)));
+          case 101: return (2*sqrt(30)*sqrt((-2 + J(jj1))/(3 + J(jj1) - 8*Power(J(jj1),2) + 4*Power(J(jj1),3))))/(1 - 2*J(jj1));
+          case 102: return sqrt(15)/sqrt(3 - 8*J(jj1) + 4*Power(J(jj1),2));
+          case 103: return (23 + 4*J(jj1) - 4*Power(J(jj1),2))/((-1 + 2*J(jj1))*sqrt(-3 - 4*J(jj1) + 4*Power(J(jj1),2)));
+          case 104: return (sqrt(2)*(27 + 4*J(jj1) - 8*Power(J(jj1),2)))/((-1 + 2*J(jj1))*sqrt(J(jj1)*(-3 - 7*J(jj1) + 4*Power(J(jj1),3))));
+          case 105: return (-9*(4*sqrt((Power(J(jj1),3)*(1 + J(jj1)))/(-1 + 4*Power(J(jj1),2))) - 9*sqrt(-((1 + J(jj1))/(J(jj1) - 4*Power(J(jj1),3))))))/((1 + J(jj1))*sqrt(13.5 - 60*Power(J(jj1),2) + 24*Power(J(jj1),4)));
+          case 106: return sqrt(0.6666666666666666)*sqrt(1 + J(jj1))*((-10*(-5 + 2*J(jj1))*sqrt((2 - J(jj1))/(3 + 8*J(jj1) + Power(J(jj1),2) - 8*Power(J(jj1),3) - 4*Power(J(jj1),4))))/(-1 + 2*J(jj1)) - 4*(-1 + J(jj1))*(-9 + 2*J(jj1))*sqrt((-2 + J(jj1))/(Power(1 - 2*J(jj1),2)*(-3 - 8*J(jj1) - Power(J(jj1),2) + 8*Power(J(jj1),3) + 4*Power(J(jj1),4)))) + (4*(-2 + J(jj1))*(-1 + J(jj1)))/sqrt(6 + 13*J(jj1) - 6*Power(J(jj1),2) - 17*Power(J(jj1),3) + 4*Power(J(jj1),5)));
+          case 107: return -2*sqrt(1 + J(jj1))*((4*(-1 + J(jj1))*(-11 + 4*J(jj1))*sqrt((-3 + 2*J(jj1))/(Power(1 - 4*Power(J(jj1),2),2)*(-3 + J(jj1) + 2*Power(J(jj1),2)))))/(1 + J(jj1)) + (30*(-2 + J(jj1))*sqrt((-3 + 2*J(jj1))/(Power(1 + J(jj1),2)*(-3 + J(jj1) + 2*Power(J(jj1),2)))))/(-1 + 4*Power(J(jj1),2)) + ((-1 + J(jj1))*(15 - 13*J(jj1) + 2*Power(J(jj1),2)))/((1 + J(jj1))*(1 + 2*J(jj1))*sqrt(9 - 9*J(jj1) - 4*Power(J(jj1),2) + 4*Power(J(jj1),3))));
+          case 108: return (-6*(-7 + J(jj1) + 2*Power(J(jj1),2)))/((1 + J(jj1))*(-1 + 4*Power(J(jj1),2)));
+          case 109: return (-6*sqrt(6)*(-2 + J(jj1) + Power(J(jj1),2)))/((1 + J(jj1))*(1 + 2*J(jj1))*sqrt(6 - 11*J(jj1) - 7*Power(J(jj1),2) + 8*Power(J(jj1),3) + 4*Power(J(jj1),4)));
+          case 110: return sqrt(3)*sqrt(1 + J(jj1))*((-2*(-11 + 4*J(jj1))*sqrt((3 - 5*J(jj1) + 2*Power(J(jj1),2))/(J(jj1)*Power(1 + 2*J(jj1),2)*(6 + 7*J(jj1) + 2*Power(J(jj1),2)))))/(1 + J(jj1)) - 20*sqrt((Power(-2 + J(jj1),2)*(3 - 5*J(jj1) + 2*Power(J(jj1),2)))/(J(jj1)*(6 + 7*J(jj1) + 2*Power(J(jj1),2))*Power(1 + J(jj1) - 4*Power(J(jj1),2) - 4*Power(J(jj1),3),2))) - (2*J(jj1)*(15 - 13*J(jj1) + 2*Power(J(jj1),2))*sqrt((-1 + J(jj1))/(J(jj1)*Power(1 + 2*J(jj1),2)*(-18 - 9*J(jj1) + 8*Power(J(jj1),2) + 4*Power(J(jj1),3)))))/(1 + J(jj1)) + (J(jj1)*(3 - 5*J(jj1) + 2*Power(J(jj1),2)))/((1 + J(jj1))*sqrt(J(jj1)*(18 - 9*J(jj1) - 17*Power(J(jj1),2) + 4*Power(J(jj1),3) + 4*Power(J(jj1),4)))));
+          case 111: return -(sqrt(1 + J(jj1))*(120*sqrt((Power(3 - 2*J(jj1),2)*(-1 + J(jj1)))/(J(jj1)*Power(3 + 2*J(jj1),3)*(-2 + 3*J(jj1) + 2*Power(J(jj1),2))*Power(1 + 3*J(jj1) + 2*Power(J(jj1),2),2))) + (18*(-11 + 6*J(jj1))*sqrt((1 - 3*J(jj1) + 2*Power(J(jj1),2))/(J(jj1)*Power(1 + 2*J(jj1),2)*(6 + 7*J(jj1) + 2*Power(J(jj1),2)))))/(3 + 5*J(jj1) + 2*Power(J(jj1),2)) + (18*J(jj1)*(5 - 7*J(jj1) + 2*Power(J(jj1),2))*sqrt((1 - 2*J(jj1))/(6*J(jj1) + Power(J(jj1),2) - 5*Power(J(jj1),3) - 2*Power(J(jj1),4))))/((1 + 2*J(jj1))*(3 + 5*J(jj1) + 2*Power(J(jj1),2))) + (J(jj1)*(-1 + 2*J(jj1))*(9 - 11*J(jj1) + 2*Power(J(jj1),2)))/((3 + 5*J(jj1) + 2*Power(J(jj1),2))*sqrt(J(jj1)*(6 - 11*J(jj1) - 7*Power(J(jj1),2) + 8*Power(J(jj1),3) + 4*Power(J(jj1),4))))));
+          case 112: return -(sqrt(2 + 2*J(jj1))*((J(jj1)*sqrt(-1 + 2*J(jj1))*(-7 + 4*J(jj1)))/((1 + J(jj1))*Power(6 + 7*J(jj1) + 2*Power(J(jj1),2),1.5)) + (18*(-9 + 8*J(jj1)))/(sqrt((Power(1 + 2*J(jj1),2)*(6 + 7*J(jj1) + 2*Power(J(jj1),2)))/(-1 + 2*J(jj1)))*(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3))) + (18*J(jj1)*(-1 + 2*J(jj1))*(-4 + 3*J(jj1)))/((1 + 2*J(jj1))*(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3))*sqrt(-6 + 5*J(jj1) + 12*Power(J(jj1),2) + 4*Power(J(jj1),3))) + (300*(-1 + J(jj1)))/((1 + J(jj1))*sqrt(-6 + 5*J(jj1) + 12*Power(J(jj1),2) + 4*Power(J(jj1),3))*(6 + 19*J(jj1) + 16*Power(J(jj1),2) + 4*Power(J(jj1),3)))));
+          case 113: return -(sqrt(30)/sqrt((1 + J(jj1))*(6 + 19*J(jj1) + 16*Power(J(jj1),2) + 4*Power(J(jj1),3))));
+          case 114: return -2*sqrt(0.6666666666666666)*sqrt(1 + J(jj1))*(2*J(jj1)*(9 - 11*J(jj1) + 2*Power(J(jj1),2))*sqrt(1/(Power(3 + 2*J(jj1),3)*(-1 + Power(J(jj1),2))*(10 + 9*J(jj1) + 2*Power(J(jj1),2)))) + (9*J(jj1)*(5 - 7*J(jj1) + 2*Power(J(jj1),2)))/(Power(3 + 5*J(jj1) + 2*Power(J(jj1),2),1.5)*sqrt(-10 + J(jj1) + 7*Power(J(jj1),2) + 2*Power(J(jj1),3))) + (30*(-3 + 2*J(jj1))*sqrt((-1 + J(jj1))/(30 + 77*J(jj1) + 71*Power(J(jj1),2) + 28*Power(J(jj1),3) + 4*Power(J(jj1),4))))/(3 + 11*J(jj1) + 12*Power(J(jj1),2) + 4*Power(J(jj1),3)) + (12*J(jj1)*(-11 + 6*J(jj1))*sqrt((-1 + J(jj1))/(Power(1 + 2*J(jj1),2)*(30 + 77*J(jj1) + 71*Power(J(jj1),2) + 28*Power(J(jj1),3) + 4*Power(J(jj1),4)))))/(3 + 5*J(jj1) + 2*Power(J(jj1),2)) - (2*(-1 + J(jj1))*J(jj1))/sqrt(-30 - 47*J(jj1) + 6*Power(J(jj1),2) + 43*Power(J(jj1),3) + 24*Power(J(jj1),4) + 4*Power(J(jj1),5)));
+          case 115: return (-2*(-5 + 2*J(jj1) + Power(J(jj1),2))*sqrt((3 + 5*J(jj1) + 2*Power(J(jj1),2))/(1 + 2*J(jj1))))/(Power(1 + J(jj1),1.5)*(3 + 2*J(jj1)));
+          case 116: return (-2*sqrt(5)*(90*sqrt((J(jj1)*(-2 + J(jj1) + 5*Power(J(jj1),2) + 2*Power(J(jj1),3)))/(3 + J(jj1))) + 171*sqrt((Power(J(jj1),3)*(-2 + J(jj1) + 5*Power(J(jj1),2) + 2*Power(J(jj1),3)))/(3 + J(jj1))) + 119*sqrt((Power(J(jj1),5)*(-2 + J(jj1) + 5*Power(J(jj1),2) + 2*Power(J(jj1),3)))/(3 + J(jj1))) + 36*sqrt((Power(J(jj1),7)*(-2 + J(jj1) + 5*Power(J(jj1),2) + 2*Power(J(jj1),3)))/(3 + J(jj1))) + 4*sqrt((Power(J(jj1),9)*(-2 + J(jj1) + 5*Power(J(jj1),2) + 2*Power(J(jj1),3)))/(3 + J(jj1)))))/sqrt(J(jj1)*Power(1 + J(jj1),2)*(1 + 2*J(jj1))*Power(30 + 47*J(jj1) + 24*Power(J(jj1),2) + 4*Power(J(jj1),3),3));
+          case 117: return -(sqrt(1.6666666666666667)*sqrt(1 + J(jj1))*(12*(-4 + 3*J(jj1))*sqrt((J(jj1)*(1 + 2*J(jj1)))/((3 + J(jj1))*Power(5 + 2*J(jj1),2)*Power(6 + 7*J(jj1) + 2*Power(J(jj1),2),3))) + 6*(-9 + 8*J(jj1))*sqrt((J(jj1)*(1 + 2*J(jj1)))/((3 + J(jj1))*Power(5 + 7*J(jj1) + 2*Power(J(jj1),2),2)*Power(6 + 7*J(jj1) + 2*Power(J(jj1),2),3))) + 2*(-7 + 4*J(jj1))*sqrt((J(jj1)*(1 + 2*J(jj1)))/(Power(2 + J(jj1),3)*Power(5 + 2*J(jj1),2)*(9 + 9*J(jj1) + 2*Power(J(jj1),2)))) - sqrt((J(jj1)*(1 + 2*J(jj1)))/(18 + 27*J(jj1) + 13*Power(J(jj1),2) + 2*Power(J(jj1),3))) + 2*(-3 + J(jj1))*sqrt((J(jj1)*(1 + 2*J(jj1)))/(Power(5 + 2*J(jj1),2)*(18 + 27*J(jj1) + 13*Power(J(jj1),2) + 2*Power(J(jj1),3)))) + (60*(-1 + J(jj1))*sqrt(J(jj1)/(Power(5 + 7*J(jj1) + 2*Power(J(jj1),2),2)*(18 + 63*J(jj1) + 67*Power(J(jj1),2) + 28*Power(J(jj1),3) + 4*Power(J(jj1),4)))))/(6 + 7*J(jj1) + 2*Power(J(jj1),2))));
+          case 118: return (sqrt((1 + J(jj1))/(3 + 7*J(jj1) + 2*Power(J(jj1),2)))*(-10*(1 + J(jj1))*(1 + 2*J(jj1))*(3 + 2*J(jj1))*sqrt((J(jj1)*(-2 + 3*J(jj1) + 2*Power(J(jj1),2)))/(35 + 24*J(jj1) + 4*Power(J(jj1),2))) - (3 + 11*J(jj1) + 12*Power(J(jj1),2) + 4*Power(J(jj1),3))*sqrt((J(jj1)*(-10 + 11*J(jj1) + 16*Power(J(jj1),2) + 4*Power(J(jj1),3)))/(7 + 2*J(jj1))) - 180*sqrt((J(jj1)*(-1 + 2*J(jj1)))/(70 + 83*J(jj1) + 32*Power(J(jj1),2) + 4*Power(J(jj1),3))) - 150*(1 + 2*J(jj1))*sqrt((J(jj1)*(-1 + 2*J(jj1)))/(70 + 83*J(jj1) + 32*Power(J(jj1),2) + 4*Power(J(jj1),3))) - 120*(1 + 3*J(jj1) + 2*Power(J(jj1),2))*sqrt((J(jj1)*(-1 + 2*J(jj1)))/(70 + 83*J(jj1) + 32*Power(J(jj1),2) + 4*Power(J(jj1),3))) - 30*(1 + 2*J(jj1))*(3 + 5*J(jj1) + 2*Power(J(jj1),2))*sqrt((J(jj1)*(-1 + 2*J(jj1)))/(70 + 83*J(jj1) + 32*Power(J(jj1),2) + 4*Power(J(jj1),3)))))/(30 + 77*J(jj1) + 71*Power(J(jj1),2) + 28*Power(J(jj1),3) + 4*Power(J(jj1),4));
+          case 119: return 1;
+          case 120: return 1;
+          case 121: return sqrt((3 + J(jj1) - 2*Power(J(jj1),2))/(J(jj1) - 2*Power(J(jj1),2)));
+          case 122: return (4*sqrt((1 - Power(J(jj1),2))/(J(jj1) - 2*Power(J(jj1),2))))/(1 + 2*J(jj1));
+          case 123: return sqrt(3)/(sqrt(J(jj1)*(1 + J(jj1)))*(1 + 2*J(jj1)));
+          case 124: return -(sqrt(3)/sqrt(J(jj1)*(-1 + 2*J(jj1))));
+          case 125: return (-4 + J(jj1) + 2*Power(J(jj1),2))/sqrt(J(jj1)*(1 + J(jj1))*(-1 + 4*Power(J(jj1),2)));
+          case 126: return (3*sqrt((-1 + 2*J(jj1))/(J(jj1)*(3 + 5*J(jj1) + 2*Power(J(jj1),2)))) + 2*sqrt((J(jj1)*(-1 + 2*J(jj1)))/(3 + 5*J(jj1) + 2*Power(J(jj1),2))))/sqrt(1 + 3*J(jj1) + 2*Power(J(jj1),2));
+          case 127: return (-7*sqrt((-1 + 2*J(jj1))/(1 + J(jj1))) + 4*Power(J(jj1),2)*sqrt((-1 + 2*J(jj1))/(1 + J(jj1))) - 2*sqrt(-1 + J(jj1) + 2*Power(J(jj1),2)) - 4*J(jj1)*sqrt(-1 + J(jj1) + 2*Power(J(jj1),2)))/(sqrt(3)*(1 + 2*J(jj1))*sqrt(-3 + 4*J(jj1) + 4*Power(J(jj1),2)));
+          case 128: return (2*sqrt((J(jj1)*(-1 + 4*Power(J(jj1),2)))/(2 + 3*J(jj1) + Power(J(jj1),2))) + 3*sqrt((J(jj1)*(-1 + 2*J(jj1)))/(2 + 7*J(jj1) + 7*Power(J(jj1),2) + 2*Power(J(jj1),3))) + sqrt((J(jj1)*(-1 - J(jj1) + 4*Power(J(jj1),2) + 4*Power(J(jj1),3)))/(2 + J(jj1))))/sqrt((1 + J(jj1))*(3 + 8*J(jj1) + 4*Power(J(jj1),2)));
+          case 129: return sqrt(((1 + J(jj1))*(-5 + 2*J(jj1)))/(1 - 3*J(jj1) + 2*Power(J(jj1),2)));
+          case 130: return (4*sqrt((4 + 2*J(jj1) - 2*Power(J(jj1),2))/(1 + J(jj1) - 2*Power(J(jj1),2))))/(-1 + 2*J(jj1));
+          case 131: return 3*sqrt((-6 + 4*J(jj1))/(Power(1 - 2*J(jj1),2)*J(jj1)*(-1 - J(jj1) + 2*Power(J(jj1),2))));
+          case 132: return -(sqrt(6)/sqrt(1 - 3*J(jj1) + 2*Power(J(jj1),2)));
+          case 133: return -((9*sqrt(1 + 1/J(jj1)) + sqrt(J(jj1)*(1 + J(jj1))) - 2*sqrt(Power(J(jj1),3)*(1 + J(jj1))))/sqrt(1 - 5*Power(J(jj1),2) + 4*Power(J(jj1),4)));
+          case 134: return (2*(-5 + 2*Power(J(jj1),2))*sqrt((3 + 3*J(jj1))/(J(jj1) + Power(J(jj1),2) - 6*Power(J(jj1),3) - 4*Power(J(jj1),4) + 8*Power(J(jj1),5))))/(1 + J(jj1));
+          case 135: return (3*sqrt(3)*(-3 + J(jj1) + 2*Power(J(jj1),2)))/((1 + J(jj1))*(1 + 2*J(jj1))*sqrt(J(jj1)*(3 - 7*J(jj1) + 4*Power(J(jj1),3))));
+          case 136: return -(sqrt(1 + J(jj1))*(-8*sqrt((Power(-2 + J(jj1),2)*(-3 + 2*J(jj1)))/(Power(1 - 2*J(jj1),2)*J(jj1)*(3 + 11*J(jj1) + 12*Power(J(jj1),2) + 4*Power(J(jj1),3)))) + (7 - 2*J(jj1))/sqrt((J(jj1)*(3 + 11*J(jj1) + 12*Power(J(jj1),2) + 4*Power(J(jj1),3)))/(-3 + 2*J(jj1))) + (2*J(jj1)*(-3 + 2*J(jj1)))/sqrt(J(jj1)*(-9 - 27*J(jj1) - 14*Power(J(jj1),2) + 12*Power(J(jj1),3) + 8*Power(J(jj1),4)))));
+          case 137: return sqrt(1 + J(jj1))*(18*sqrt((Power(3 - 2*J(jj1),2)*(-1 + J(jj1)))/(Power(1 - 2*J(jj1),2)*J(jj1)*Power(1 + J(jj1),3)*(3 + 8*J(jj1) + 4*Power(J(jj1),2)))) + (12*(-2 + J(jj1)))/(Power(1 + J(jj1),1.5)*sqrt((J(jj1)*(3 + 8*J(jj1) + 4*Power(J(jj1),2)))/(-1 + J(jj1)))) + ((7 - 9*J(jj1) + 2*Power(J(jj1),2))*sqrt(J(jj1)/(-3 - 5*J(jj1) + 4*Power(J(jj1),2) + 4*Power(J(jj1),3))))/Power(1 + J(jj1),1.5));
+          case 138: return (sqrt(3)*sqrt(1 + J(jj1))*((3*(-7 + 6*J(jj1)))/sqrt((J(jj1)*(1 + 2*J(jj1)))/(-1 + 2*J(jj1))) + (48*(-1 + J(jj1)))/sqrt(J(jj1)*(-1 + 4*Power(J(jj1),2))) + (2*J(jj1)*(-3 + 2*J(jj1))*(-1 + 2*J(jj1)))/sqrt(J(jj1)*(-1 + 4*Power(J(jj1),2)))))/Power(3 + 5*J(jj1) + 2*Power(J(jj1),2),1.5);
+          case 139: return (3*sqrt(2))/((1 + J(jj1))*sqrt(3 + 8*J(jj1) + 4*Power(J(jj1),2)));
+          case 140: return sqrt(1 + J(jj1))*((J(jj1)*(7 - 9*J(jj1) + 2*Power(J(jj1),2)))/sqrt(J(jj1)*Power(1 + J(jj1),3)*(-6 - J(jj1) + 5*Power(J(jj1),2) + 2*Power(J(jj1),3))) + (6*(-3 + 2*J(jj1))*sqrt((-1 + J(jj1))/(J(jj1)*(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3)))))/(1 + 3*J(jj1) + 2*Power(J(jj1),2)) + (12*(-2 + J(jj1))*J(jj1)*sqrt((-1 + J(jj1))/(J(jj1)*Power(1 + 2*J(jj1),2)*(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3)))))/(1 + J(jj1)) - 2*(-1 + J(jj1))*sqrt(J(jj1)/(-6 - 7*J(jj1) + 4*Power(J(jj1),2) + 7*Power(J(jj1),3) + 2*Power(J(jj1),4))));
+          case 141: return (-8 + 3*J(jj1) + 2*Power(J(jj1),2))/((1 + J(jj1))*(1 + 2*J(jj1)));
+          case 142: return (sqrt(2)*(30*sqrt((J(jj1)*(-3 + 4*J(jj1) + 4*Power(J(jj1),2)))/(5 + 2*J(jj1))) + 47*sqrt((Power(J(jj1),3)*(-3 + 4*J(jj1) + 4*Power(J(jj1),2)))/(5 + 2*J(jj1))) + 24*sqrt((Power(J(jj1),5)*(-3 + 4*J(jj1) + 4*Power(J(jj1),2)))/(5 + 2*J(jj1))) + 4*sqrt((Power(J(jj1),7)*(-3 + 4*J(jj1) + 4*Power(J(jj1),2)))/(5 + 2*J(jj1)))))/sqrt(J(jj1)*Power(1 + J(jj1),2)*(1 + 2*J(jj1))*Power(6 + 7*J(jj1) + 2*Power(J(jj1),2),3));
+          case 143: return sqrt(0.6666666666666666)*sqrt(1 + J(jj1))*(3*(-7 + 6*J(jj1))*sqrt((J(jj1)*(1 + 2*J(jj1)))/(Power(2 + J(jj1),2)*(5 + 2*J(jj1))*Power(3 + 5*J(jj1) + 2*Power(J(jj1),2),3))) - 2*sqrt((J(jj1)*(1 + 2*J(jj1)))/(15 + 31*J(jj1) + 20*Power(J(jj1),2) + 4*Power(J(jj1),3))) + (-5 + 2*J(jj1))*sqrt((J(jj1)*(1 + 2*J(jj1)))/(Power(2 + J(jj1),2)*(15 + 31*J(jj1) + 20*Power(J(jj1),2) + 4*Power(J(jj1),3)))) + (6*(-3 + 2*J(jj1))*(1 + 2*J(jj1))*sqrt(J(jj1)/(15 + 61*J(jj1) + 82*Power(J(jj1),2) + 44*Power(J(jj1),3) + 8*Power(J(jj1),4))))/(6 + 7*J(jj1) + 2*Power(J(jj1),2)) + (24*(-1 + J(jj1))*sqrt(J(jj1)/(Power(2 + J(jj1),2)*(15 + 61*J(jj1) + 82*Power(J(jj1),2) + 44*Power(J(jj1),3) + 8*Power(J(jj1),4)))))/(3 + 5*J(jj1) + 2*Power(J(jj1),2)));
+          case 144: return -((sqrt((1 + J(jj1))/(5 + 12*J(jj1) + 4*Power(J(jj1),2)))*(-4*(1 + J(jj1))*(1 + 2*J(jj1))*sqrt((J(jj1)*(-3 + 4*J(jj1) + 4*Power(J(jj1),2)))/(6 + 5*J(jj1) + Power(J(jj1),2))) - 30*sqrt((J(jj1)*(-1 + 2*J(jj1)))/(18 + 27*J(jj1) + 13*Power(J(jj1),2) + 2*Power(J(jj1),3))) - 24*(1 + 2*J(jj1))*sqrt((J(jj1)*(-1 + 2*J(jj1)))/(18 + 27*J(jj1) + 13*Power(J(jj1),2) + 2*Power(J(jj1),3))) - 18*(1 + J(jj1))*(1 + 2*J(jj1))*sqrt((J(jj1)*(-1 + 2*J(jj1)))/(18 + 27*J(jj1) + 13*Power(J(jj1),2) + 2*Power(J(jj1),3))) - (1 + J(jj1))*(1 + 2*J(jj1))*sqrt((J(jj1)*(-6 + 5*J(jj1) + 12*Power(J(jj1),2) + 4*Power(J(jj1),3)))/(3 + J(jj1)))))/(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3)));
+          case 145: return sqrt(((1 + J(jj1))*(-5 + 2*J(jj1)))/(1 - 3*J(jj1) + 2*Power(J(jj1),2)));
+          case 146: return (4*sqrt((4 + 2*J(jj1) - 2*Power(J(jj1),2))/(1 + J(jj1) - 2*Power(J(jj1),2))))/(-1 + 2*J(jj1));
+          case 147: return 3*sqrt((-6 + 4*J(jj1))/(Power(1 - 2*J(jj1),2)*J(jj1)*(-1 - J(jj1) + 2*Power(J(jj1),2))));
+          case 148: return -(sqrt(6)/sqrt(1 - 3*J(jj1) + 2*Power(J(jj1),2)));
+          case 149: return -((9*sqrt(1 + 1/J(jj1)) + sqrt(J(jj1)*(1 + J(jj1))) - 2*sqrt(Power(J(jj1),3)*(1 + J(jj1))))/sqrt(1 - 5*Power(J(jj1),2) + 4*Power(J(jj1),4)));
+          case 150: return (2*(-5 + 2*Power(J(jj1),2))*sqrt((3 + 3*J(jj1))/(J(jj1) + Power(J(jj1),2) - 6*Power(J(jj1),3) - 4*Power(J(jj1),4) + 8*Power(J(jj1),5))))/(1 + J(jj1));
+          case 151: return (3*sqrt(3)*(-3 + J(jj1) + 2*Power(J(jj1),2)))/((1 + J(jj1))*(1 + 2*J(jj1))*sqrt(J(jj1)*(3 - 7*J(jj1) + 4*Power(J(jj1),3))));
+          case 152: return -(sqrt(1 + J(jj1))*(-8*sqrt((Power(-2 + J(jj1),2)*(-3 + 2*J(jj1)))/(Power(1 - 2*J(jj1),2)*J(jj1)*(3 + 11*J(jj1) + 12*Power(J(jj1),2) + 4*Power(J(jj1),3)))) + (7 - 2*J(jj1))/sqrt((J(jj1)*(3 + 11*J(jj1) + 12*Power(J(jj1),2) + 4*Power(J(jj1),3)))/(-3 + 2*J(jj1))) + (2*J(jj1)*(-3 + 2*J(jj1)))/sqrt(J(jj1)*(-9 - 27*J(jj1) - 14*Power(J(jj1),2) + 12*Power(J(jj1),3) + 8*Power(J(jj1),4)))));
+          case 153: return sqrt(1 + J(jj1))*(18*sqrt((Power(3 - 2*J(jj1),2)*(-1 + J(jj1)))/(Power(1 - 2*J(jj1),2)*J(jj1)*Power(1 + J(jj1),3)*(3 + 8*J(jj1) + 4*Power(J(jj1),2)))) + (12*(-2 + J(jj1)))/(Power(1 + J(jj1),1.5)*sqrt((J(jj1)*(3 + 8*J(jj1) + 4*Power(J(jj1),2)))/(-1 + J(jj1)))) + ((7 - 9*J(jj1) + 2*Power(J(jj1),2))*sqrt(J(jj1)/(-3 - 5*J(jj1) + 4*Power(J(jj1),2) + 4*Power(J(jj1),3))))/Power(1 + J(jj1),1.5));
+          case 154: return (sqrt(3)*sqrt(1 + J(jj1))*((3*(-7 + 6*J(jj1)))/sqrt((J(jj1)*(1 + 2*J(jj1)))/(-1 + 2*J(jj1))) + (48*(-1 + J(jj1)))/sqrt(J(jj1)*(-1 + 4*Power(J(jj1),2))) + (2*J(jj1)*(-3 + 2*J(jj1))*(-1 + 2*J(jj1)))/sqrt(J(jj1)*(-1 + 4*Power(J(jj1),2)))))/Power(3 + 5*J(jj1) + 2*Power(J(jj1),2),1.5);
+          case 155: return (3*sqrt(2))/((1 + J(jj1))*sqrt(3 + 8*J(jj1) + 4*Power(J(jj1),2)));
+          case 156: return sqrt(1 + J(jj1))*((J(jj1)*(7 - 9*J(jj1) + 2*Power(J(jj1),2)))/sqrt(J(jj1)*Power(1 + J(jj1),3)*(-6 - J(jj1) + 5*Power(J(jj1),2) + 2*Power(J(jj1),3))) + (6*(-3 + 2*J(jj1))*sqrt((-1 + J(jj1))/(J(jj1)*(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3)))))/(1 + 3*J(jj1) + 2*Power(J(jj1),2)) + (12*(-2 + J(jj1))*J(jj1)*sqrt((-1 + J(jj1))/(J(jj1)*Power(1 + 2*J(jj1),2)*(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3)))))/(1 + J(jj1)) - 2*(-1 + J(jj1))*sqrt(J(jj1)/(-6 - 7*J(jj1) + 4*Power(J(jj1),2) + 7*Power(J(jj1),3) + 2*Power(J(jj1),4))));
+          case 157: return (-8 + 3*J(jj1) + 2*Power(J(jj1),2))/((1 + J(jj1))*(1 + 2*J(jj1)));
+          case 158: return (sqrt(2)*(30*sqrt((J(jj1)*(-3 + 4*J(jj1) + 4*Power(J(jj1),2)))/(5 + 2*J(jj1))) + 47*sqrt((Power(J(jj1),3)*(-3 + 4*J(jj1) + 4*Power(J(jj1),2)))/(5 + 2*J(jj1))) + 24*sqrt((Power(J(jj1),5)*(-3 + 4*J(jj1) + 4*Power(J(jj1),2)))/(5 + 2*J(jj1))) + 4*sqrt((Power(J(jj1),7)*(-3 + 4*J(jj1) + 4*Power(J(jj1),2)))/(5 + 2*J(jj1)))))/sqrt(J(jj1)*Power(1 + J(jj1),2)*(1 + 2*J(jj1))*Power(6 + 7*J(jj1) + 2*Power(J(jj1),2),3));
+          case 159: return sqrt(0.6666666666666666)*sqrt(1 + J(jj1))*(3*(-7 + 6*J(jj1))*sqrt((J(jj1)*(1 + 2*J(jj1)))/(Power(2 + J(jj1),2)*(5 + 2*J(jj1))*Power(3 + 5*J(jj1) + 2*Power(J(jj1),2),3))) - 2*sqrt((J(jj1)*(1 + 2*J(jj1)))/(15 + 31*J(jj1) + 20*Power(J(jj1),2) + 4*Power(J(jj1),3))) + (-5 + 2*J(jj1))*sqrt((J(jj1)*(1 + 2*J(jj1)))/(Power(2 + J(jj1),2)*(15 + 31*J(jj1) + 20*Power(J(jj1),2) + 4*Power(J(jj1),3)))) + (6*(-3 + 2*J(jj1))*(1 + 2*J(jj1))*sqrt(J(jj1)/(15 + 61*J(jj1) + 82*Power(J(jj1),2) + 44*Power(J(jj1),3) + 8*Power(J(jj1),4))))/(6 + 7*J(jj1) + 2*Power(J(jj1),2)) + (24*(-1 + J(jj1))*sqrt(J(jj1)/(Power(2 + J(jj1),2)*(15 + 61*J(jj1) + 82*Power(J(jj1),2) + 44*Power(J(jj1),3) + 8*Power(J(jj1),4)))))/(3 + 5*J(jj1) + 2*Power(J(jj1),2)));
+          case 160: return -((sqrt((1 + J(jj1))/(5 + 12*J(jj1) + 4*Power(J(jj1),2)))*(-4*(1 + J(jj1))*(1 + 2*J(jj1))*sqrt((J(jj1)*(-3 + 4*J(jj1) + 4*Power(J(jj1),2)))/(6 + 5*J(jj1) + Power(J(jj1),2))) - 30*sqrt((J(jj1)*(-1 + 2*J(jj1)))/(18 + 27*J(jj1) + 13*Power(J(jj1),2) + 2*Power(J(jj1),3))) - 24*(1 + 2*J(jj1))*sqrt((J(jj1)*(-1 + 2*J(jj1)))/(18 + 27*J(jj1) + 13*Power(J(jj1),2) + 2*Power(J(jj1),3))) - 18*(1 + J(jj1))*(1 + 2*J(jj1))*sqrt((J(jj1)*(-1 + 2*J(jj1)))/(18 + 27*J(jj1) + 13*Power(J(jj1),2) + 2*Power(J(jj1),3))) - (1 + J(jj1))*(1 + 2*J(jj1))*sqrt((J(jj1)*(-6 + 5*J(jj1) + 12*Power(J(jj1),2) + 4*Power(J(jj1),3)))/(3 + J(jj1)))))/(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3)));
+          case 161: return -2*sqrt((-1 + Power(J(jj1),2))/(-1 + 4*Power(J(jj1),2)));
+          case 162: return -2/(1 + 2*J(jj1));
+          case 163: return sqrt(3)/sqrt(-1 + 4*Power(J(jj1),2));
+          case 164: return -(sqrt(-3 + 4*J(jj1) + 4*Power(J(jj1),2))/(1 + 2*J(jj1)));
+          case 165: return (-2*sqrt((-2 + J(jj1))*(1 + J(jj1))))/(-1 + 2*J(jj1));
+          case 166: return -2*sqrt(3)*sqrt(((1 + J(jj1))*(-3 + 2*J(jj1)))/(Power(1 - 2*J(jj1),2)*J(jj1)*(1 + 2*J(jj1))));
+          case 167: return (6*sqrt((-1 + J(jj1))/J(jj1)))/(1 - 4*Power(J(jj1),2));
+          case 168: return (-2*(-2 + J(jj1))*sqrt((1 + J(jj1))/(-1 + 2*J(jj1))) + sqrt(-1 + J(jj1) + 2*Power(J(jj1),2)))/sqrt(-1 + J(jj1) + 2*Power(J(jj1),2));
+          case 169: return (13 - 4*Power(J(jj1),2))/(-1 + 4*Power(J(jj1),2));
+          case 170: return -((13 - 4*J(jj1) - 8*Power(J(jj1),2))/(1 + J(jj1) - 4*Power(J(jj1),2) - 4*Power(J(jj1),3)));
+          case 171: return -3/(1 + 3*J(jj1) + 2*Power(J(jj1),2));
+          case 172: return (2*sqrt(3)*sqrt(-7 + 3/J(jj1) + 4*Power(J(jj1),2)))/(-1 + 4*Power(J(jj1),2));
+          case 173: return (-2*(-3 + J(jj1) + Power(J(jj1),2)))/(sqrt(J(jj1)*(1 + J(jj1)))*(1 + 2*J(jj1)));
+          case 174: return (-2*sqrt(3)*(6*sqrt((J(jj1)*(-1 + J(jj1) + 2*Power(J(jj1),2)))/(2 + 5*J(jj1) + 2*Power(J(jj1),2))) + 6*J(jj1)*sqrt((J(jj1)*(-1 + J(jj1) + 2*Power(J(jj1),2)))/(2 + 5*J(jj1) + 2*Power(J(jj1),2))) + sqrt((Power(J(jj1),3)*(-1 - J(jj1) + 4*Power(J(jj1),2) + 4*Power(J(jj1),3)))/(2 + J(jj1)))))/sqrt(J(jj1)*Power(1 + J(jj1),2)*(1 + 2*J(jj1))*Power(3 + 2*J(jj1),3));
+          case 175: return (15*sqrt((J(jj1)*(-1 + 2*J(jj1)))/(3 + 2*J(jj1))) + 10*J(jj1)*sqrt((J(jj1)*(-1 + 2*J(jj1)))/(3 + 2*J(jj1))) - 6*sqrt((Power(J(jj1),5)*(-1 + 2*J(jj1)))/(3 + 2*J(jj1))) - 4*sqrt((Power(J(jj1),7)*(-1 + 2*J(jj1)))/(3 + 2*J(jj1))) + sqrt(J(jj1)*(-3 + 4*J(jj1) + 4*Power(J(jj1),2))) + 3*J(jj1)*sqrt(J(jj1)*(-3 + 4*J(jj1) + 4*Power(J(jj1),2))) + 2*sqrt(Power(J(jj1),5)*(-3 + 4*J(jj1) + 4*Power(J(jj1),2))))/((1 + J(jj1))*(1 + 2*J(jj1))*sqrt(-6 + 5*J(jj1) + 12*Power(J(jj1),2) + 4*Power(J(jj1),3)));
+          case 176: return (sqrt((1 + J(jj1))/(2 + 5*J(jj1) + 2*Power(J(jj1),2)))*(-6*(1 + 2*J(jj1))*sqrt((J(jj1)*(-1 + J(jj1) + 2*Power(J(jj1),2)))/(15 + 16*J(jj1) + 4*Power(J(jj1),2))) - (1 + 2*J(jj1))*sqrt((J(jj1)*(-3 + J(jj1) + 8*Power(J(jj1),2) + 4*Power(J(jj1),3)))/(5 + 2*J(jj1))) - 12*sqrt((J(jj1)*(-1 + 2*J(jj1)))/(15 + 31*J(jj1) + 20*Power(J(jj1),2) + 4*Power(J(jj1),3))) - 9*(1 + 2*J(jj1))*sqrt((J(jj1)*(-1 + 2*J(jj1)))/(15 + 31*J(jj1) + 20*Power(J(jj1),2) + 4*Power(J(jj1),3)))))/(3 + 5*J(jj1) + 2*Power(J(jj1),2));
+          case 177: return 1;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(1, 4));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(1, 4));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -134,10 +1598,316 @@ MatrixElements<SC> SymmetryQJ<SC>::recalc_quadruplet(const DiagInfo<SC> &diag, c
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "qj/qj-quad4.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {2, 3},
+        {3, 3},
+        {4, 4},
+        {4, 5},
+        {4, 6},
+        {4, 7},
+        {5, 5},
+        {5, 6},
+        {5, 7},
+        {6, 6},
+        {6, 7},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {10, 10},
+        {10, 11},
+        {10, 12},
+        {11, 11},
+        {11, 12},
+        {12, 12},
+        {13, 13},
+        {13, 14},
+        {13, 15},
+        {13, 16},
+        {14, 14},
+        {14, 15},
+        {14, 16},
+        {14, 17},
+        {15, 15},
+        {15, 16},
+        {15, 17},
+        {16, 16},
+        {16, 17},
+        {17, 17},
+        {18, 18},
+        {18, 19},
+        {18, 20},
+        {18, 21},
+        {19, 19},
+        {19, 20},
+        {19, 21},
+        {19, 22},
+        {20, 20},
+        {20, 21},
+        {20, 22},
+        {21, 21},
+        {21, 22},
+        {22, 22},
+        {23, 23},
+        {23, 24},
+        {24, 24},
+        {25, 25},
+        {25, 26},
+        {25, 27},
+        {25, 28},
+        {26, 26},
+        {26, 27},
+        {26, 28},
+        {27, 27},
+        {27, 28},
+        {28, 28},
+        {29, 29},
+        {29, 30},
+        {29, 31},
+        {29, 32},
+        {30, 30},
+        {30, 31},
+        {30, 32},
+        {31, 31},
+        {31, 32},
+        {32, 32},
+        {33, 33},
+        {33, 34},
+        {33, 35},
+        {33, 36},
+        {34, 34},
+        {34, 35},
+        {34, 36},
+        {35, 35},
+        {35, 36},
+        {36, 36},
+        {37, 37},
+        {37, 38},
+        {37, 39},
+        {37, 40},
+        {38, 38},
+        {38, 39},
+        {38, 40},
+        {38, 41},
+        {39, 39},
+        {39, 40},
+        {39, 41},
+        {39, 42},
+        {40, 40},
+        {40, 41},
+        {40, 42},
+        {41, 41},
+        {41, 42},
+        {42, 42},
+        {43, 43},
+        {44, 44},
+        {45, 45},
+        {45, 46},
+        {45, 47},
+        {46, 46},
+        {46, 47},
+        {47, 47},
+        {48, 48},
+        {48, 49},
+        {48, 50},
+        {48, 51},
+        {49, 49},
+        {49, 50},
+        {49, 51},
+        {49, 52},
+        {50, 50},
+        {50, 51},
+        {50, 52},
+        {51, 51},
+        {51, 52},
+        {52, 52},
+        {53, 53},
+        {53, 54},
+        {53, 55},
+        {53, 56},
+        {54, 54},
+        {54, 55},
+        {54, 56},
+        {54, 57},
+        {55, 55},
+        {55, 56},
+        {55, 57},
+        {56, 56},
+        {56, 57},
+        {57, 57},
+        {58, 58},
+        {58, 59},
+        {59, 59},
+        {60, 60},
+        {60, 61},
+        {60, 62},
+        {60, 63},
+        {61, 61},
+        {61, 62},
+        {61, 63},
+        {62, 62},
+        {62, 63},
+        {63, 63},
+        {64, 64}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return -1;
+          case 2: return -(sqrt(3)/sqrt(-1 + 4*Power(J(jj1),2)));
+          case 3: return -((sqrt((-1 + J(jj1))/(1 + 2*J(jj1))) + sqrt(-1 - J(jj1) + 2*Power(J(jj1),2)))/sqrt(-1 + J(jj1) + 2*Power(J(jj1),2)));
+          case 4: return -1;
+          case 5: return 3/(1 - 2*J(jj1));
+          case 6: return 3/(J(jj1) - 2*Power(J(jj1),2));
+          case 7: return 3/(J(jj1) - 4*Power(J(jj1),3));
+          case 8: return (-2*sqrt((-2 + J(jj1))*(-1 + J(jj1) + 2*Power(J(jj1),2))))/Power(-1 + 2*J(jj1),1.5);
+          case 9: return (sqrt(3)*(-3*sqrt((J(jj1)*(-1 + J(jj1) + 2*Power(J(jj1),2)))/(1 + 2*J(jj1))) + 8*J(jj1)*sqrt((J(jj1)*(-1 + J(jj1) + 2*Power(J(jj1),2)))/(1 + 2*J(jj1))) - 4*sqrt((Power(J(jj1),5)*(-1 + J(jj1) + 2*Power(J(jj1),2)))/(1 + 2*J(jj1))) - 3*(-1 + 2*J(jj1))*sqrt((Power(3 - 2*J(jj1),2)*J(jj1)*(1 + J(jj1)))/(-1 + 4*Power(J(jj1),2)))))/(J(jj1)*(1 + J(jj1))*sqrt(-3 + 2*J(jj1))*Power(-1 + 2*J(jj1),1.5));
+          case 10: return (6*sqrt((-1 + J(jj1))/J(jj1)))/(1 - 4*Power(J(jj1),2));
+          case 11: return -((3*J(jj1)*sqrt((Power(3 - 2*J(jj1),2)*(-1 + J(jj1))*(-1 + 2*J(jj1))*(3 + 5*J(jj1) + 2*Power(J(jj1),2)))/(J(jj1)*(1 + 2*J(jj1)))) - 3*sqrt((-1 + J(jj1))*Power(J(jj1),3)*(-1 + 2*J(jj1))*(1 + 2*J(jj1))*(3 + 5*J(jj1) + 2*Power(J(jj1),2))) + 2*J(jj1)*sqrt((-1 + J(jj1))*Power(J(jj1),3)*(-1 + 2*J(jj1))*(1 + 2*J(jj1))*(3 + 5*J(jj1) + 2*Power(J(jj1),2))) - 12*J(jj1)*sqrt(((-1 + J(jj1))*J(jj1)*(-3 + J(jj1) + 8*Power(J(jj1),2) + 4*Power(J(jj1),3)))/(1 + 2*J(jj1))) + 8*Power(J(jj1),2)*sqrt(((-1 + J(jj1))*J(jj1)*(-3 + J(jj1) + 8*Power(J(jj1),2) + 4*Power(J(jj1),3)))/(1 + 2*J(jj1))))/(Power(J(jj1),1.5)*sqrt(-3 + 2*J(jj1))*(-3 + J(jj1) + 8*Power(J(jj1),2) + 4*Power(J(jj1),3))));
+          case 12: return (-12*J(jj1)*sqrt(((-1 + J(jj1))*(1 + J(jj1))*(-1 + 2*J(jj1)))/(1 + 2*J(jj1))) - 9*sqrt(((1 + J(jj1))*(1 - 3*J(jj1) + 2*Power(J(jj1),2)))/(1 + 2*J(jj1))) - 3*J(jj1)*sqrt(1 - 5*Power(J(jj1),2) + 4*Power(J(jj1),4)))/(J(jj1)*(3 + 5*J(jj1) + 2*Power(J(jj1),2))*sqrt(-1 + 4*Power(J(jj1),2)));
+          case 13: return -(6*sqrt(((-1 + J(jj1))*J(jj1)*(-1 + 2*J(jj1))*(1 + 2*J(jj1)))/(3 + 5*J(jj1) + 2*Power(J(jj1),2))) + 2*sqrt((-1 + J(jj1))*J(jj1)*(3 + 5*J(jj1) + 2*Power(J(jj1),2))*(-1 + 4*Power(J(jj1),2))) + 6*sqrt((J(jj1)*(1 - 3*J(jj1) + 2*Power(J(jj1),2)))/(3 + 11*J(jj1) + 12*Power(J(jj1),2) + 4*Power(J(jj1),3))) + 6*sqrt((J(jj1) - 5*Power(J(jj1),3) + 4*Power(J(jj1),5))/(3 + 2*J(jj1))))/(2.*sqrt(J(jj1)*(-1 + 4*Power(J(jj1),2))*(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3))));
+          case 14: return 1;
+          case 15: return 1;
+          case 16: return 1;
+          case 17: return sqrt(3)/sqrt(J(jj1)*(-1 + 2*J(jj1)));
+          case 18: return sqrt(3)/(J(jj1)*sqrt(-1 + 4*Power(J(jj1),2)));
+          case 19: return ((1 + J(jj1))*(-3 + 2*J(jj1)))/sqrt(J(jj1)*(3 - 5*J(jj1) - 4*Power(J(jj1),2) + 4*Power(J(jj1),3)));
+          case 20: return (sqrt(3)*sqrt((-1 + J(jj1))/(-1 + 2*J(jj1))))/J(jj1);
+          case 21: return (sqrt(((-1 + J(jj1))*(-1 + 2*J(jj1))*(1 + 2*J(jj1)))/(1 + J(jj1))) + sqrt((1 - 3*J(jj1) + 2*Power(J(jj1),2))/(1 + 3*J(jj1) + 2*Power(J(jj1),2))) + sqrt(1 - 5*Power(J(jj1),2) + 4*Power(J(jj1),4)))/sqrt(J(jj1)*(-3 + J(jj1) + 8*Power(J(jj1),2) + 4*Power(J(jj1),3)));
+          case 22: return 1;
+          case 23: return sqrt(6)/sqrt(1 - 3*J(jj1) + 2*Power(J(jj1),2));
+          case 24: return (3*sqrt(2))/(sqrt((-1 + J(jj1))*J(jj1))*(-1 + 2*J(jj1)));
+          case 25: return (3*sqrt(2))/sqrt(Power(J(jj1),2)*(1 - 3*J(jj1) + 2*Power(J(jj1),2))*(-1 + 4*Power(J(jj1),2)));
+          case 26: return (-5 - 3*J(jj1) + 2*Power(J(jj1),2))/sqrt((5 - 7*J(jj1) + 2*Power(J(jj1),2))*(-1 + J(jj1) + 2*Power(J(jj1),2)));
+          case 27: return (3*(-2 - J(jj1) + Power(J(jj1),2)))/(J(jj1)*sqrt(-2 + 5*J(jj1) - 5*Power(J(jj1),3) + 2*Power(J(jj1),4)));
+          case 28: return (3*sqrt(3)*(-3 + 2*J(jj1))*sqrt((-1 + J(jj1) + 2*Power(J(jj1),2))/(3 - 5*J(jj1) + 2*Power(J(jj1),2))))/(J(jj1)*(-1 + 4*Power(J(jj1),2)));
+          case 29: return (3*sqrt(2))/(sqrt(-1 + J(jj1) + 2*Power(J(jj1),2))*(J(jj1) + 2*Power(J(jj1),2)));
+          case 30: return -(sqrt(18 + 9*J(jj1) - 17*Power(J(jj1),2) - 4*Power(J(jj1),3) + 4*Power(J(jj1),4))/(J(jj1) - 2*Power(J(jj1),2)));
+          case 31: return (18*sqrt((3 - 5*J(jj1) + 2*Power(J(jj1),2))/(3 + 8*J(jj1) + 4*Power(J(jj1),2))))/(J(jj1)*(-1 + J(jj1) + 2*Power(J(jj1),2))) + (6*(3 + J(jj1))*sqrt((-1 + J(jj1))/(-9 - 18*J(jj1) + 4*Power(J(jj1),2) + 8*Power(J(jj1),3))))/(1 + J(jj1)) - (9*(3 + J(jj1))*sqrt((-1 + J(jj1))/(-9 - 18*J(jj1) + 4*Power(J(jj1),2) + 8*Power(J(jj1),3))))/(J(jj1)*(1 + J(jj1)));
+          case 32: return (3*sqrt(2)*(-3*(-1 + 2*J(jj1))*sqrt(-3 - 2*J(jj1) + 3*Power(J(jj1),2) + 2*Power(J(jj1),3)) + 6*J(jj1)*(-1 + 2*J(jj1))*sqrt(-3 - 2*J(jj1) + 3*Power(J(jj1),2) + 2*Power(J(jj1),3)) + 6*sqrt((-1 + J(jj1))/(3 + 5*J(jj1) + 2*Power(J(jj1),2)))*(-3 + J(jj1) + 8*Power(J(jj1),2) + 4*Power(J(jj1),3)) - J(jj1)*sqrt((-1 + J(jj1))/(3 + 5*J(jj1) + 2*Power(J(jj1),2)))*(-3 + J(jj1) + 8*Power(J(jj1),2) + 4*Power(J(jj1),3)) + 2*Power(J(jj1),2)*sqrt((-1 + J(jj1))/(3 + 5*J(jj1) + 2*Power(J(jj1),2)))*(-3 + J(jj1) + 8*Power(J(jj1),2) + 4*Power(J(jj1),3))))/(J(jj1)*Power(1 + J(jj1),2)*sqrt(1 + 2*J(jj1))*Power(-3 + 4*J(jj1) + 4*Power(J(jj1),2),1.5));
+          case 33: return (6*sqrt((3 - 5*J(jj1) + 2*Power(J(jj1),2))/(6 + 7*J(jj1) + 2*Power(J(jj1),2))))/(J(jj1) + 3*Power(J(jj1),2) + 2*Power(J(jj1),3)) + (-3 + 2*J(jj1))*sqrt((-1 + J(jj1))/(-18 - 9*J(jj1) + 8*Power(J(jj1),2) + 4*Power(J(jj1),3))) + (3*(-3 + 2*J(jj1))*sqrt((-1 + J(jj1))/(-18 - 9*J(jj1) + 8*Power(J(jj1),2) + 4*Power(J(jj1),3))))/(1 + J(jj1)) + 9*(-3 + 2*J(jj1))*sqrt((-1 + J(jj1))/(Power(1 + 3*J(jj1) + 2*Power(J(jj1),2),2)*(-18 - 9*J(jj1) + 8*Power(J(jj1),2) + 4*Power(J(jj1),3))));
+          case 34: return (sqrt(6)*(6*sqrt((J(jj1)*(3 - 7*J(jj1) + 4*Power(J(jj1),3)))/(1 + 2*J(jj1))) + 9*sqrt((Power(J(jj1),3)*(3 - 7*J(jj1) + 4*Power(J(jj1),3)))/(1 + 2*J(jj1))) + 4*sqrt(Power(J(jj1),3)*(3 - J(jj1) - 14*Power(J(jj1),2) + 4*Power(J(jj1),3) + 8*Power(J(jj1),4))) + sqrt(Power(J(jj1),5)*(3 - J(jj1) - 14*Power(J(jj1),2) + 4*Power(J(jj1),3) + 8*Power(J(jj1),4)))))/(J(jj1)*Power(1 + J(jj1),1.5)*(6 + 7*J(jj1) + 2*Power(J(jj1),2))*sqrt(-1 + 4*Power(J(jj1),2)));
+          case 35: return (2*(1 + 2*J(jj1))*sqrt(((-1 + J(jj1))*J(jj1)*(-1 + 2*J(jj1))*(3 + 5*J(jj1) + 2*Power(J(jj1),2)))/(2 + J(jj1))) + 6*(1 + 2*J(jj1))*sqrt(((-1 + J(jj1))*J(jj1)*(-1 + 2*J(jj1)))/(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3))) + 6*sqrt((J(jj1)*(1 - 3*J(jj1) + 2*Power(J(jj1),2)))/(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3))) + (1 + 2*J(jj1))*sqrt((-1 + J(jj1))*J(jj1)*(-1 + 2*J(jj1))*(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3))) + 6*sqrt((J(jj1)*(1 + 2*J(jj1))*(1 - 5*Power(J(jj1),2) + 4*Power(J(jj1),4)))/(6 + 7*J(jj1) + 2*Power(J(jj1),2))))/((1 + J(jj1))*sqrt(J(jj1)*(-30 - 47*J(jj1) + 96*Power(J(jj1),2) + 184*Power(J(jj1),3) + 96*Power(J(jj1),4) + 16*Power(J(jj1),5))));
+          case 36: return 1;
+          case 37: return sqrt(6)/sqrt(1 - 3*J(jj1) + 2*Power(J(jj1),2));
+          case 38: return (3*sqrt(2))/(sqrt((-1 + J(jj1))*J(jj1))*(-1 + 2*J(jj1)));
+          case 39: return (3*sqrt(2))/sqrt(Power(J(jj1),2)*(1 - 3*J(jj1) + 2*Power(J(jj1),2))*(-1 + 4*Power(J(jj1),2)));
+          case 40: return (-5 - 3*J(jj1) + 2*Power(J(jj1),2))/sqrt((5 - 7*J(jj1) + 2*Power(J(jj1),2))*(-1 + J(jj1) + 2*Power(J(jj1),2)));
+          case 41: return (3*(-2 - J(jj1) + Power(J(jj1),2)))/(J(jj1)*sqrt(-2 + 5*J(jj1) - 5*Power(J(jj1),3) + 2*Power(J(jj1),4)));
+          case 42: return (3*sqrt(3)*(-3 + 2*J(jj1))*sqrt((-1 + J(jj1) + 2*Power(J(jj1),2))/(3 - 5*J(jj1) + 2*Power(J(jj1),2))))/(J(jj1)*(-1 + 4*Power(J(jj1),2)));
+          case 43: return (3*sqrt(2))/(sqrt(-1 + J(jj1) + 2*Power(J(jj1),2))*(J(jj1) + 2*Power(J(jj1),2)));
+          case 44: return -(sqrt(18 + 9*J(jj1) - 17*Power(J(jj1),2) - 4*Power(J(jj1),3) + 4*Power(J(jj1),4))/(J(jj1) - 2*Power(J(jj1),2)));
+          case 45: return (18*sqrt((3 - 5*J(jj1) + 2*Power(J(jj1),2))/(3 + 8*J(jj1) + 4*Power(J(jj1),2))))/(J(jj1)*(-1 + J(jj1) + 2*Power(J(jj1),2))) + (6*(3 + J(jj1))*sqrt((-1 + J(jj1))/(-9 - 18*J(jj1) + 4*Power(J(jj1),2) + 8*Power(J(jj1),3))))/(1 + J(jj1)) - (9*(3 + J(jj1))*sqrt((-1 + J(jj1))/(-9 - 18*J(jj1) + 4*Power(J(jj1),2) + 8*Power(J(jj1),3))))/(J(jj1)*(1 + J(jj1)));
+          case 46: return (3*sqrt(2)*(-3*(-1 + 2*J(jj1))*sqrt(-3 - 2*J(jj1) + 3*Power(J(jj1),2) + 2*Power(J(jj1),3)) + 6*J(jj1)*(-1 + 2*J(jj1))*sqrt(-3 - 2*J(jj1) + 3*Power(J(jj1),2) + 2*Power(J(jj1),3)) + 6*sqrt((-1 + J(jj1))/(3 + 5*J(jj1) + 2*Power(J(jj1),2)))*(-3 + J(jj1) + 8*Power(J(jj1),2) + 4*Power(J(jj1),3)) - J(jj1)*sqrt((-1 + J(jj1))/(3 + 5*J(jj1) + 2*Power(J(jj1),2)))*(-3 + J(jj1) + 8*Power(J(jj1),2) + 4*Power(J(jj1),3)) + 2*Power(J(jj1),2)*sqrt((-1 + J(jj1))/(3 + 5*J(jj1) + 2*Power(J(jj1),2)))*(-3 + J(jj1) + 8*Power(J(jj1),2) + 4*Power(J(jj1),3))))/(J(jj1)*Power(1 + J(jj1),2)*sqrt(1 + 2*J(jj1))*Power(-3 + 4*J(jj1) + 4*Power(J(jj1),2),1.5));
+          case 47: return (6*sqrt((3 - 5*J(jj1) + 2*Power(J(jj1),2))/(6 + 7*J(jj1) + 2*Power(J(jj1),2))))/(J(jj1) + 3*Power(J(jj1),2) + 2*Power(J(jj1),3)) + (-3 + 2*J(jj1))*sqrt((-1 + J(jj1))/(-18 - 9*J(jj1) + 8*Power(J(jj1),2) + 4*Power(J(jj1),3))) + (3*(-3 + 2*J(jj1))*sqrt((-1 + J(jj1))/(-18 - 9*J(jj1) + 8*Power(J(jj1),2) + 4*Power(J(jj1),3))))/(1 + J(jj1)) + 9*(-3 + 2*J(jj1))*sqrt((-1 + J(jj1))/(Power(1 + 3*J(jj1) + 2*Power(J(jj1),2),2)*(-18 - 9*J(jj1) + 8*Power(J(jj1),2) + 4*Power(J(jj1),3))));
+          case 48: return (sqrt(6)*(6*sqrt((J(jj1)*(3 - 7*J(jj1) + 4*Power(J(jj1),3)))/(1 + 2*J(jj1))) + 9*sqrt((Power(J(jj1),3)*(3 - 7*J(jj1) + 4*Power(J(jj1),3)))/(1 + 2*J(jj1))) + 4*sqrt(Power(J(jj1),3)*(3 - J(jj1) - 14*Power(J(jj1),2) + 4*Power(J(jj1),3) + 8*Power(J(jj1),4))) + sqrt(Power(J(jj1),5)*(3 - J(jj1) - 14*Power(J(jj1),2) + 4*Power(J(jj1),3) + 8*Power(J(jj1),4)))))/(J(jj1)*Power(1 + J(jj1),1.5)*(6 + 7*J(jj1) + 2*Power(J(jj1),2))*sqrt(-1 + 4*Power(J(jj1),2)));
+          case 49: return (2*(1 + 2*J(jj1))*sqrt(((-1 + J(jj1))*J(jj1)*(-1 + 2*J(jj1))*(3 + 5*J(jj1) + 2*Power(J(jj1),2)))/(2 + J(jj1))) + 6*(1 + 2*J(jj1))*sqrt(((-1 + J(jj1))*J(jj1)*(-1 + 2*J(jj1)))/(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3))) + 6*sqrt((J(jj1)*(1 - 3*J(jj1) + 2*Power(J(jj1),2)))/(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3))) + (1 + 2*J(jj1))*sqrt((-1 + J(jj1))*J(jj1)*(-1 + 2*J(jj1))*(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3))) + 6*sqrt((J(jj1)*(1 + 2*J(jj1))*(1 - 5*Power(J(jj1),2) + 4*Power(J(jj1),4)))/(6 + 7*J(jj1) + 2*Power(J(jj1),2))))/((1 + J(jj1))*sqrt(J(jj1)*(-30 - 47*J(jj1) + 96*Power(J(jj1),2) + 184*Power(J(jj1),3) + 96*Power(J(jj1),4) + 16*Power(J(jj1),5))));
+          case 50: return -1;
+          case 51: return -(sqrt(3)/sqrt(-1 + 4*Power(J(jj1),2)));
+          case 52: return -((sqrt((-1 + J(jj1))/(1 + 2*J(jj1))) + sqrt(-1 - J(jj1) + 2*Power(J(jj1),2)))/sqrt(-1 + J(jj1) + 2*Power(J(jj1),2)));
+          case 53: return -1;
+          case 54: return 3/(1 - 2*J(jj1));
+          case 55: return 3/(J(jj1) - 2*Power(J(jj1),2));
+          case 56: return 3/(J(jj1) - 4*Power(J(jj1),3));
+          case 57: return (-2*sqrt((-2 + J(jj1))*(-1 + J(jj1) + 2*Power(J(jj1),2))))/Power(-1 + 2*J(jj1),1.5);
+          case 58: return (sqrt(3)*(-3*sqrt((J(jj1)*(-1 + J(jj1) + 2*Power(J(jj1),2)))/(1 + 2*J(jj1))) + 8*J(jj1)*sqrt((J(jj1)*(-1 + J(jj1) + 2*Power(J(jj1),2)))/(1 + 2*J(jj1))) - 4*sqrt((Power(J(jj1),5)*(-1 + J(jj1) + 2*Power(J(jj1),2)))/(1 + 2*J(jj1))) - 3*(-1 + 2*J(jj1))*sqrt((Power(3 - 2*J(jj1),2)*J(jj1)*(1 + J(jj1)))/(-1 + 4*Power(J(jj1),2)))))/(J(jj1)*(1 + J(jj1))*sqrt(-3 + 2*J(jj1))*Power(-1 + 2*J(jj1),1.5));
+          case 59: return (6*sqrt((-1 + J(jj1))/J(jj1)))/(1 - 4*Power(J(jj1),2));
+          case 60: return -((3*J(jj1)*sqrt((Power(3 - 2*J(jj1),2)*(-1 + J(jj1))*(-1 + 2*J(jj1))*(3 + 5*J(jj1) + 2*Power(J(jj1),2)))/(J(jj1)*(1 + 2*J(jj1)))) - 3*sqrt((-1 + J(jj1))*Power(J(jj1),3)*(-1 + 2*J(jj1))*(1 + 2*J(jj1))*(3 + 5*J(jj1) + 2*Power(J(jj1),2))) + 2*J(jj1)*sqrt((-1 + J(jj1))*Power(J(jj1),3)*(-1 + 2*J(jj1))*(1 + 2*J(jj1))*(3 + 5*J(jj1) + 2*Power(J(jj1),2))) - 12*J(jj1)*sqrt(((-1 + J(jj1))*J(jj1)*(-3 + J(jj1) + 8*Power(J(jj1),2) + 4*Power(J(jj1),3)))/(1 + 2*J(jj1))) + 8*Power(J(jj1),2)*sqrt(((-1 + J(jj1))*J(jj1)*(-3 + J(jj1) + 8*Power(J(jj1),2) + 4*Power(J(jj1),3)))/(1 + 2*J(jj1))))/(Power(J(jj1),1.5)*sqrt(-3 + 2*J(jj1))*(-3 + J(jj1) + 8*Power(J(jj1),2) + 4*Power(J(jj1),3))));
+          case 61: return (-12*J(jj1)*sqrt(((-1 + J(jj1))*(1 + J(jj1))*(-1 + 2*J(jj1)))/(1 + 2*J(jj1))) - 9*sqrt(((1 + J(jj1))*(1 - 3*J(jj1) + 2*Power(J(jj1),2)))/(1 + 2*J(jj1))) - 3*J(jj1)*sqrt(1 - 5*Power(J(jj1),2) + 4*Power(J(jj1),4)))/(J(jj1)*(3 + 5*J(jj1) + 2*Power(J(jj1),2))*sqrt(-1 + 4*Power(J(jj1),2)));
+          case 62: return -(6*sqrt(((-1 + J(jj1))*J(jj1)*(-1 + 2*J(jj1))*(1 + 2*J(jj1)))/(3 + 5*J(jj1) + 2*Power(J(jj1),2))) + 2*sqrt((-1 + J(jj1))*J(jj1)*(3 + 5*J(jj1) + 2*Power(J(jj1),2))*(-1 + 4*Power(J(jj1),2))) + 6*sqrt((J(jj1)*(1 - 3*J(jj1) + 2*Power(J(jj1),2)))/(3 + 11*J(jj1) + 12*Power(J(jj1),2) + 4*Power(J(jj1),3))) + 6*sqrt((J(jj1) - 5*Power(J(jj1),3) + 4*Power(J(jj1),5))/(3 + 2*J(jj1))))/(2.*sqrt(J(jj1)*(-1 + 4*Power(J(jj1),2))*(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3))));
+          case 63: return -1;
+          case 64: return 3/(1 - 2*J(jj1));
+          case 65: return 3/(J(jj1) - 2*Power(J(jj1),2));
+          case 66: return 3/(J(jj1) - 4*Power(J(jj1),3));
+          case 67: return (-2*sqrt((-2 + J(jj1))*(-1 + J(jj1) + 2*Power(J(jj1),2))))/Power(-1 + 2*J(jj1),1.5);
+          case 68: return (sqrt(3)*(-3*sqrt((J(jj1)*(-1 + J(jj1) + 2*Power(J(jj1),2)))/(1 + 2*J(jj1))) + 8*J(jj1)*sqrt((J(jj1)*(-1 + J(jj1) + 2*Power(J(jj1),2)))/(1 + 2*J(jj1))) - 4*sqrt((Power(J(jj1),5)*(-1 + J(jj1) + 2*Power(J(jj1),2)))/(1 + 2*J(jj1))) - 3*(-1 + 2*J(jj1))*sqrt((Power(3 - 2*J(jj1),2)*J(jj1)*(1 + J(jj1)))/(-1 + 4*Power(J(jj1),2)))))/(J(jj1)*(1 + J(jj1))*sqrt(-3 + 2*J(jj1))*Power(-1 + 2*J(jj1),1.5));
+          case 69: return (6*sqrt((-1 + J(jj1))/J(jj1)))/(1 - 4*Power(J(jj1),2));
+          case 70: return -((3*J(jj1)*sqrt((Power(3 - 2*J(jj1),2)*(-1 + J(jj1))*(-1 + 2*J(jj1))*(3 + 5*J(jj1) + 2*Power(J(jj1),2)))/(J(jj1)*(1 + 2*J(jj1)))) - 3*sqrt((-1 + J(jj1))*Power(J(jj1),3)*(-1 + 2*J(jj1))*(1 + 2*J(jj1))*(3 + 5*J(jj1) + 2*Power(J(jj1),2))) + 2*J(jj1)*sqrt((-1 + J(jj1))*Power(J(jj1),3)*(-1 + 2*J(jj1))*(1 + 2*J(jj1))*(3 + 5*J(jj1) + 2*Power(J(jj1),2))) - 12*J(jj1)*sqrt(((-1 + J(jj1))*J(jj1)*(-3 + J(jj1) + 8*Power(J(jj1),2) + 4*Power(J(jj1),3)))/(1 + 2*J(jj1))) + 8*Power(J(jj1),2)*sqrt(((-1 + J(jj1))*J(jj1)*(-3 + J(jj1) + 8*Power(J(jj1),2) + 4*Power(J(jj1),3)))/(1 + 2*J(jj1))))/(Power(J(jj1),1.5)*sqrt(-3 + 2*J(jj1))*(-3 + J(jj1) + 8*Power(J(jj1),2) + 4*Power(J(jj1),3))));
+          case 71: return (-12*J(jj1)*sqrt(((-1 + J(jj1))*(1 + J(jj1))*(-1 + 2*J(jj1)))/(1 + 2*J(jj1))) - 9*sqrt(((1 + J(jj1))*(1 - 3*J(jj1) + 2*Power(J(jj1),2)))/(1 + 2*J(jj1))) - 3*J(jj1)*sqrt(1 - 5*Power(J(jj1),2) + 4*Power(J(jj1),4)))/(J(jj1)*(3 + 5*J(jj1) + 2*Power(J(jj1),2))*sqrt(-1 + 4*Power(J(jj1),2)));
+          case 72: return -(6*sqrt(((-1 + J(jj1))*J(jj1)*(-1 + 2*J(jj1))*(1 + 2*J(jj1)))/(3 + 5*J(jj1) + 2*Power(J(jj1),2))) + 2*sqrt((-1 + J(jj1))*J(jj1)*(3 + 5*J(jj1) + 2*Power(J(jj1),2))*(-1 + 4*Power(J(jj1),2))) + 6*sqrt((J(jj1)*(1 - 3*J(jj1) + 2*Power(J(jj1),2)))/(3 + 11*J(jj1) + 12*Power(J(jj1),2) + 4*Power(J(jj1),3))) + 6*sqrt((J(jj1) - 5*Power(J(jj1),3) + 4*Power(J(jj1),5))/(3 + 2*J(jj1))))/(2.*sqrt(J(jj1)*(-1 + 4*Power(J(jj1),2))*(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3))));
+          case 73: return -1;
+          case 74: return 3/(1 - 2*J(jj1));
+          case 75: return 3/(J(jj1) - 2*Power(J(jj1),2));
+          case 76: return 3/(J(jj1) - 4*Power(J(jj1),3));
+          case 77: return (-2*sqrt((-2 + J(jj1))*(-1 + J(jj1) + 2*Power(J(jj1),2))))/Power(-1 + 2*J(jj1),1.5);
+          case 78: return (sqrt(3)*(-3*sqrt((J(jj1)*(-1 + J(jj1) + 2*Power(J(jj1),2)))/(1 + 2*J(jj1))) + 8*J(jj1)*sqrt((J(jj1)*(-1 + J(jj1) + 2*Power(J(jj1),2)))/(1 + 2*J(jj1))) - 4*sqrt((Power(J(jj1),5)*(-1 + J(jj1) + 2*Power(J(jj1),2)))/(1 + 2*J(jj1))) - 3*(-1 + 2*J(jj1))*sqrt((Power(3 - 2*J(jj1),2)*J(jj1)*(1 + J(jj1)))/(-1 + 4*Power(J(jj1),2)))))/(J(jj1)*(1 + J(jj1))*sqrt(-3 + 2*J(jj1))*Power(-1 + 2*J(jj1),1.5));
+          case 79: return (6*sqrt((-1 + J(jj1))/J(jj1)))/(1 - 4*Power(J(jj1),2));
+          case 80: return -((3*J(jj1)*sqrt((Power(3 - 2*J(jj1),2)*(-1 + J(jj1))*(-1 + 2*J(jj1))*(3 + 5*J(jj1) + 2*Power(J(jj1),2)))/(J(jj1)*(1 + 2*J(jj1)))) - 3*sqrt((-1 + J(jj1))*Power(J(jj1),3)*(-1 + 2*J(jj1))*(1 + 2*J(jj1))*(3 + 5*J(jj1) + 2*Power(J(jj1),2))) + 2*J(jj1)*sqrt((-1 + J(jj1))*Power(J(jj1),3)*(-1 + 2*J(jj1))*(1 + 2*J(jj1))*(3 + 5*J(jj1) + 2*Power(J(jj1),2))) - 12*J(jj1)*sqrt(((-1 + J(jj1))*J(jj1)*(-3 + J(jj1) + 8*Power(J(jj1),2) + 4*Power(J(jj1),3)))/(1 + 2*J(jj1))) + 8*Power(J(jj1),2)*sqrt(((-1 + J(jj1))*J(jj1)*(-3 + J(jj1) + 8*Power(J(jj1),2) + 4*Power(J(jj1),3)))/(1 + 2*J(jj1))))/(Power(J(jj1),1.5)*sqrt(-3 + 2*J(jj1))*(-3 + J(jj1) + 8*Power(J(jj1),2) + 4*Power(J(jj1),3))));
+          case 81: return (-12*J(jj1)*sqrt(((-1 + J(jj1))*(1 + J(jj1))*(-1 + 2*J(jj1)))/(1 + 2*J(jj1))) - 9*sqrt(((1 + J(jj1))*(1 - 3*J(jj1) + 2*Power(J(jj1),2)))/(1 + 2*J(jj1))) - 3*J(jj1)*sqrt(1 - 5*Power(J(jj1),2) + 4*Power(J(jj1),4)))/(J(jj1)*(3 + 5*J(jj1) + 2*Power(J(jj1),2))*sqrt(-1 + 4*Power(J(jj1),2)));
+          case 82: return -(6*sqrt(((-1 + J(jj1))*J(jj1)*(-1 + 2*J(jj1))*(1 + 2*J(jj1)))/(3 + 5*J(jj1) + 2*Power(J(jj1),2))) + 2*sqrt((-1 + J(jj1))*J(jj1)*(3 + 5*J(jj1) + 2*Power(J(jj1),2))*(-1 + 4*Power(J(jj1),2))) + 6*sqrt((J(jj1)*(1 - 3*J(jj1) + 2*Power(J(jj1),2)))/(3 + 11*J(jj1) + 12*Power(J(jj1),2) + 4*Power(J(jj1),3))) + 6*sqrt((J(jj1) - 5*Power(J(jj1),3) + 4*Power(J(jj1),5))/(3 + 2*J(jj1))))/(2.*sqrt(J(jj1)*(-1 + 4*Power(J(jj1),2))*(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3))));
+          case 83: return -1;
+          case 84: return -(sqrt(15)/sqrt(3 - 8*J(jj1) + 4*Power(J(jj1),2)));
+          case 85: return -(sqrt(30)/sqrt(J(jj1)*(-1 + 2*J(jj1))*(3 - 5*J(jj1) + 2*Power(J(jj1),2))));
+          case 86: return (-3*sqrt(10))/((-1 + 2*J(jj1))*sqrt(J(jj1)*(3 + J(jj1) - 8*Power(J(jj1),2) + 4*Power(J(jj1),3))));
+          case 87: return (-2*(-3 - 2*J(jj1) + Power(J(jj1),2)))/sqrt((9 - 9*J(jj1) + 2*Power(J(jj1),2))*(-1 + J(jj1) + 2*Power(J(jj1),2)));
+          case 88: return (2*sqrt(6)*(5*sqrt(J(jj1)*(1 + J(jj1))) + 3*J(jj1)*sqrt(J(jj1)*(1 + J(jj1))) - 2*sqrt(Power(J(jj1),5)*(1 + J(jj1)))))/(J(jj1)*(-1 + J(jj1) + 2*Power(J(jj1),2))*sqrt(15 - 16*J(jj1) + 4*Power(J(jj1),2)));
+          case 89: return (-6*sqrt(6)*(-2 + J(jj1))*sqrt((1 + 3*J(jj1) + 2*Power(J(jj1),2))/(6 - 7*J(jj1) + 2*Power(J(jj1),2))))/(J(jj1)*(-1 + 4*Power(J(jj1),2)));
+          case 90: return 12/(J(jj1) - 4*Power(J(jj1),3));
+          case 91: return (10*sqrt((10 - 9*J(jj1) + 2*Power(J(jj1),2))/(J(jj1)*(-3 - 2*J(jj1) + 3*Power(J(jj1),2) + 2*Power(J(jj1),3)))))/(1 - 2*J(jj1)) - 8*(-1 + J(jj1))*(-5 + 2*J(jj1))*sqrt((-2 + J(jj1))/(Power(1 - 2*J(jj1),2)*J(jj1)*(15 + 4*J(jj1) - 19*Power(J(jj1),2) - 4*Power(J(jj1),3) + 4*Power(J(jj1),4)))) - ((-1 + J(jj1))*(10 - 9*J(jj1) + 2*Power(J(jj1),2)))/sqrt(J(jj1)*(-30 + 7*J(jj1) + 42*Power(J(jj1),2) - 11*Power(J(jj1),3) - 12*Power(J(jj1),4) + 4*Power(J(jj1),5)));
+          case 92: return 3*sqrt(3)*((10*sqrt((6 - 7*J(jj1) + 2*Power(J(jj1),2))/(J(jj1)*(-3 - 2*J(jj1) + 3*Power(J(jj1),2) + 2*Power(J(jj1),3)))))/(1 - 4*Power(J(jj1),2)) - 8*(-2 + J(jj1))*(-1 + J(jj1))*sqrt((-3 + 2*J(jj1))/(J(jj1)*Power(1 - 4*Power(J(jj1),2),2)*(6 + J(jj1) - 8*Power(J(jj1),2) - Power(J(jj1),3) + 2*Power(J(jj1),4)))) - ((-1 + J(jj1))*(6 - 7*J(jj1) + 2*Power(J(jj1),2)))/((1 + 2*J(jj1))*sqrt(J(jj1)*(-18 + 9*J(jj1) + 26*Power(J(jj1),2) - 13*Power(J(jj1),3) - 8*Power(J(jj1),4) + 4*Power(J(jj1),5)))));
+          case 93: return 3*sqrt(6)*((10*sqrt((-3 + 2*J(jj1))/(J(jj1)*(3 + 5*J(jj1) + 2*Power(J(jj1),2)))))/((1 + J(jj1))*(1 - 4*Power(J(jj1),2))) - ((-1 + J(jj1))*(-3 + 2*J(jj1)))/(Power(1 + J(jj1),1.5)*(1 + 2*J(jj1))*sqrt(J(jj1)*(-9 + 4*Power(J(jj1),2)))) - (8*(-1 + J(jj1))*(-3 + 2*J(jj1)))/((1 + J(jj1))*(-1 + 4*Power(J(jj1),2))*sqrt(J(jj1)*(-9 - 9*J(jj1) + 4*Power(J(jj1),2) + 4*Power(J(jj1),3)))));
+          case 94: return 3*sqrt(10)*((-1 + 3*J(jj1) - 2*Power(J(jj1),2))*sqrt(1/(J(jj1)*(-1 + 2*J(jj1))*Power(1 + 2*J(jj1),2)*Power(3 + 5*J(jj1) + 2*Power(J(jj1),2),3))) - 10/((1 + 2*J(jj1))*(3 + 5*J(jj1) + 2*Power(J(jj1),2))*sqrt(J(jj1)*(-3 + J(jj1) + 8*Power(J(jj1),2) + 4*Power(J(jj1),3)))) - (8*Power(-1 + J(jj1),1.5))/((3 + 11*J(jj1) + 12*Power(J(jj1),2) + 4*Power(J(jj1),3))*sqrt(J(jj1)*(3 - 4*J(jj1) - 7*Power(J(jj1),2) + 4*Power(J(jj1),3) + 4*Power(J(jj1),4)))));
+          case 95: return ((60*sqrt((-6 + 13*J(jj1) - 9*Power(J(jj1),2) + 2*Power(J(jj1),3))/(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3))))/(J(jj1) - 4*Power(J(jj1),3)) - 36*(-2 + J(jj1))*sqrt((3 - 5*J(jj1) + 2*Power(J(jj1),2))/(Power(J(jj1),2)*Power(1 + 2*J(jj1),2)*(-12 - 20*J(jj1) - 5*Power(J(jj1),2) + 5*Power(J(jj1),3) + 2*Power(J(jj1),4)))) - 2*(6 - 7*J(jj1) + 2*Power(J(jj1),2))*sqrt((-1 + J(jj1))/(36 + 36*J(jj1) - 25*Power(J(jj1),2) - 25*Power(J(jj1),3) + 4*Power(J(jj1),4) + 4*Power(J(jj1),5))) - 18*(6 - 7*J(jj1) + 2*Power(J(jj1),2))*sqrt((-1 + J(jj1))/(Power(1 + 2*J(jj1),2)*(36 + 36*J(jj1) - 25*Power(J(jj1),2) - 25*Power(J(jj1),3) + 4*Power(J(jj1),4) + 4*Power(J(jj1),5)))))/2.;
+          case 96: return sqrt(6)*((-18*(-3 + 2*J(jj1))*sqrt((1 - 3*J(jj1) + 2*Power(J(jj1),2))/(Power(J(jj1),2)*(-6 + J(jj1) + 2*Power(J(jj1),2))*Power(3 + 8*J(jj1) + 4*Power(J(jj1),2),2))))/(1 + J(jj1)) - (30*sqrt((3 - 5*J(jj1) + 2*Power(J(jj1),2))/(Power(J(jj1),2)*(-2 + 3*J(jj1) + 2*Power(J(jj1),2))*Power(3 + 8*J(jj1) + 4*Power(J(jj1),2),2))))/(1 + J(jj1)) - ((-3 + 2*J(jj1))*(-1 + 2*J(jj1))*sqrt((-1 + J(jj1))/(6 - 13*J(jj1) + 4*Power(J(jj1),3))))/(3 + 5*J(jj1) + 2*Power(J(jj1),2)) - (9*(-3 + 2*J(jj1))*(-1 + 2*J(jj1))*sqrt((-1 + J(jj1))/(6 - 13*J(jj1) + 4*Power(J(jj1),3))))/(3 + 11*J(jj1) + 12*Power(J(jj1),2) + 4*Power(J(jj1),3)));
+          case 97: return (-2*sqrt(30)*(9*sqrt(-3 + 1/J(jj1) + 2*J(jj1)) + 15*sqrt((1 - J(jj1))/(J(jj1) - 2*Power(J(jj1),2))) + (15*sqrt(J(jj1)*(1 - 3*J(jj1) + 2*Power(J(jj1),2))))/(3 + 2*J(jj1)) + (2*sqrt(Power(J(jj1),5)*(1 - 3*J(jj1) + 2*Power(J(jj1),2))))/(3 + 2*J(jj1)) + 13*J(jj1)*sqrt((J(jj1)*(1 - 3*J(jj1) + 2*Power(J(jj1),2)))/Power(3 + 2*J(jj1),2))))/((1 + 2*J(jj1))*Power(3 + 2*J(jj1),1.5)*(2 + 3*J(jj1) + Power(J(jj1),2)));
+          case 98: return (-30*sqrt((3 - 5*J(jj1) + 2*Power(J(jj1),2))/(J(jj1)*Power(1 + J(jj1),3)*(10 + 9*J(jj1) + 2*Power(J(jj1),2)))))/(3 + 8*J(jj1) + 4*Power(J(jj1),2)) - 18*J(jj1)*(-3 + 2*J(jj1))*sqrt((-1 + J(jj1))/(J(jj1)*Power(1 + J(jj1),3)*Power(3 + 2*J(jj1),2)*(-30 - 7*J(jj1) + 12*Power(J(jj1),2) + 4*Power(J(jj1),3)))) + (3 - 2*J(jj1))*sqrt(((-1 + J(jj1))*J(jj1))/(-30 - 37*J(jj1) + 5*Power(J(jj1),2) + 16*Power(J(jj1),3) + 4*Power(J(jj1),4))) - 8*J(jj1)*(-3 + 2*J(jj1))*sqrt((-1 + J(jj1))/(J(jj1)*Power(3 + 2*J(jj1),2)*(-30 - 37*J(jj1) + 5*Power(J(jj1),2) + 16*Power(J(jj1),3) + 4*Power(J(jj1),4)))) - (48*(-3 + 2*J(jj1))*sqrt(((-1 + J(jj1))*J(jj1))/(Power(3 + 8*J(jj1) + 4*Power(J(jj1),2),2)*(-30 - 37*J(jj1) + 5*Power(J(jj1),2) + 16*Power(J(jj1),3) + 4*Power(J(jj1),4)))))/(1 + J(jj1));
+          case 99: return -((sqrt(15)*(10*sqrt(J(jj1)*(2 - 5*J(jj1) + Power(J(jj1),2) + 2*Power(J(jj1),3))) + 9*sqrt(Power(J(jj1),3)*(2 - 5*J(jj1) + Power(J(jj1),2) + 2*Power(J(jj1),3))) + 2*sqrt(Power(J(jj1),5)*(2 - 5*J(jj1) + Power(J(jj1),2) + 2*Power(J(jj1),3)))))/(J(jj1)*(10 + 9*J(jj1) + 2*Power(J(jj1),2))*sqrt(-3 - 5*J(jj1) + 10*Power(J(jj1),2) + 20*Power(J(jj1),3) + 8*Power(J(jj1),4))));
+          case 100: return -(10*(1 + J(jj1))*(1 + 2*J(jj1))*sqrt(((-1 + J(jj1))*J(jj1)*(-1 + 2*J(jj1))*(6 + 7*J(jj1) + 2*Power(J(jj1),2)))/(5 + 2*J(jj1))) + 20*(1 + 3*J(jj1) + 2*Power(J(jj1),2))*sqrt((J(jj1)*(3 - 7*J(jj1) + 4*Power(J(jj1),3)))/(10 + 9*J(jj1) + 2*Power(J(jj1),2))) + 60*(1 + 2*J(jj1))*sqrt(((-1 + J(jj1))*J(jj1)*(-1 + 2*J(jj1)))/(30 + 47*J(jj1) + 24*Power(J(jj1),2) + 4*Power(J(jj1),3))) + 60*sqrt((J(jj1)*(1 - 3*J(jj1) + 2*Power(J(jj1),2)))/(30 + 47*J(jj1) + 24*Power(J(jj1),2) + 4*Power(J(jj1),3))) + 60*(1 + 3*J(jj1) + 2*Power(J(jj1),2))*sqrt((J(jj1)*(1 - 3*J(jj1) + 2*Power(J(jj1),2)))/(30 + 47*J(jj1) + 24*Power(J(jj1),2) + 4*Power(J(jj1),3))) + 2*(1 + J(jj1))*(1 + 2*J(jj1))*sqrt((-1 + J(jj1))*J(jj1)*(-1 + 2*J(jj1))*(30 + 47*J(jj1) + 24*Power(J(jj1),2) + 4*Power(J(jj1),3))))/(2.*(3 + 5*J(jj1) + 2*Power(J(jj1),2))*sqrt(J(jj1)*(-30 - 37*J(jj1) + 105*Power(J(jj1),2) + 146*Power(J(jj1),3) + 60*Power(J(jj1),4) + 8*Power(J(jj1),5))));
+          case 101: return 1;
+          case 102: return 1;
+          case 103: return 1;
+          case 104: return sqrt(3)/sqrt(J(jj1)*(-1 + 2*J(jj1)));
+          case 105: return sqrt(3)/(J(jj1)*sqrt(-1 + 4*Power(J(jj1),2)));
+          case 106: return ((1 + J(jj1))*(-3 + 2*J(jj1)))/sqrt(J(jj1)*(3 - 5*J(jj1) - 4*Power(J(jj1),2) + 4*Power(J(jj1),3)));
+          case 107: return (sqrt(3)*sqrt((-1 + J(jj1))/(-1 + 2*J(jj1))))/J(jj1);
+          case 108: return (sqrt(((-1 + J(jj1))*(-1 + 2*J(jj1))*(1 + 2*J(jj1)))/(1 + J(jj1))) + sqrt((1 - 3*J(jj1) + 2*Power(J(jj1),2))/(1 + 3*J(jj1) + 2*Power(J(jj1),2))) + sqrt(1 - 5*Power(J(jj1),2) + 4*Power(J(jj1),4)))/sqrt(J(jj1)*(-3 + J(jj1) + 8*Power(J(jj1),2) + 4*Power(J(jj1),3)));
+          case 109: return 1;
+          case 110: return sqrt(6)/sqrt(1 - 3*J(jj1) + 2*Power(J(jj1),2));
+          case 111: return (3*sqrt(2))/(sqrt((-1 + J(jj1))*J(jj1))*(-1 + 2*J(jj1)));
+          case 112: return (3*sqrt(2))/sqrt(Power(J(jj1),2)*(1 - 3*J(jj1) + 2*Power(J(jj1),2))*(-1 + 4*Power(J(jj1),2)));
+          case 113: return (-5 - 3*J(jj1) + 2*Power(J(jj1),2))/sqrt((5 - 7*J(jj1) + 2*Power(J(jj1),2))*(-1 + J(jj1) + 2*Power(J(jj1),2)));
+          case 114: return (3*(-2 - J(jj1) + Power(J(jj1),2)))/(J(jj1)*sqrt(-2 + 5*J(jj1) - 5*Power(J(jj1),3) + 2*Power(J(jj1),4)));
+          case 115: return (3*sqrt(3)*(-3 + 2*J(jj1))*sqrt((-1 + J(jj1) + 2*Power(J(jj1),2))/(3 - 5*J(jj1) + 2*Power(J(jj1),2))))/(J(jj1)*(-1 + 4*Power(J(jj1),2)));
+          case 116: return (3*sqrt(2))/(sqrt(-1 + J(jj1) + 2*Power(J(jj1),2))*(J(jj1) + 2*Power(J(jj1),2)));
+          case 117: return -(sqrt(18 + 9*J(jj1) - 17*Power(J(jj1),2) - 4*Power(J(jj1),3) + 4*Power(J(jj1),4))/(J(jj1) - 2*Power(J(jj1),2)));
+          case 118: return (18*sqrt((3 - 5*J(jj1) + 2*Power(J(jj1),2))/(3 + 8*J(jj1) + 4*Power(J(jj1),2))))/(J(jj1)*(-1 + J(jj1) + 2*Power(J(jj1),2))) + (6*(3 + J(jj1))*sqrt((-1 + J(jj1))/(-9 - 18*J(jj1) + 4*Power(J(jj1),2) + 8*Power(J(jj1),3))))/(1 + J(jj1)) - (9*(3 + J(jj1))*sqrt((-1 + J(jj1))/(-9 - 18*J(jj1) + 4*Power(J(jj1),2) + 8*Power(J(jj1),3))))/(J(jj1)*(1 + J(jj1)));
+          case 119: return (3*sqrt(2)*(-3*(-1 + 2*J(jj1))*sqrt(-3 - 2*J(jj1) + 3*Power(J(jj1),2) + 2*Power(J(jj1),3)) + 6*J(jj1)*(-1 + 2*J(jj1))*sqrt(-3 - 2*J(jj1) + 3*Power(J(jj1),2) + 2*Power(J(jj1),3)) + 6*sqrt((-1 + J(jj1))/(3 + 5*J(jj1) + 2*Power(J(jj1),2)))*(-3 + J(jj1) + 8*Power(J(jj1),2) + 4*Power(J(jj1),3)) - J(jj1)*sqrt((-1 + J(jj1))/(3 + 5*J(jj1) + 2*Power(J(jj1),2)))*(-3 + J(jj1) + 8*Power(J(jj1),2) + 4*Power(J(jj1),3)) + 2*Power(J(jj1),2)*sqrt((-1 + J(jj1))/(3 + 5*J(jj1) + 2*Power(J(jj1),2)))*(-3 + J(jj1) + 8*Power(J(jj1),2) + 4*Power(J(jj1),3))))/(J(jj1)*Power(1 + J(jj1),2)*sqrt(1 + 2*J(jj1))*Power(-3 + 4*J(jj1) + 4*Power(J(jj1),2),1.5));
+          case 120: return sqrt(18 - 9*J(jj1) - 17*Power(J(jj1),2) + 4*Power(J(jj1),3) + 4*Power(J(jj1),4))/(J(jj1) + 2*Power(J(jj1),2));
+          case 121: return (sqrt(6)*(6*sqrt((J(jj1)*(3 - 7*J(jj1) + 4*Power(J(jj1),3)))/(1 + 2*J(jj1))) + 9*sqrt((Power(J(jj1),3)*(3 - 7*J(jj1) + 4*Power(J(jj1),3)))/(1 + 2*J(jj1))) + 4*sqrt(Power(J(jj1),3)*(3 - J(jj1) - 14*Power(J(jj1),2) + 4*Power(J(jj1),3) + 8*Power(J(jj1),4))) + sqrt(Power(J(jj1),5)*(3 - J(jj1) - 14*Power(J(jj1),2) + 4*Power(J(jj1),3) + 8*Power(J(jj1),4)))))/(J(jj1)*Power(1 + J(jj1),1.5)*(6 + 7*J(jj1) + 2*Power(J(jj1),2))*sqrt(-1 + 4*Power(J(jj1),2)));
+          case 122: return (2*(1 + 2*J(jj1))*sqrt(((-1 + J(jj1))*J(jj1)*(-1 + 2*J(jj1))*(3 + 5*J(jj1) + 2*Power(J(jj1),2)))/(2 + J(jj1))) + 6*(1 + 2*J(jj1))*sqrt(((-1 + J(jj1))*J(jj1)*(-1 + 2*J(jj1)))/(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3))) + 6*sqrt((J(jj1)*(1 - 3*J(jj1) + 2*Power(J(jj1),2)))/(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3))) + (1 + 2*J(jj1))*sqrt((-1 + J(jj1))*J(jj1)*(-1 + 2*J(jj1))*(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3))) + 6*sqrt((J(jj1)*(1 + 2*J(jj1))*(1 - 5*Power(J(jj1),2) + 4*Power(J(jj1),4)))/(6 + 7*J(jj1) + 2*Power(J(jj1),2))))/((1 + J(jj1))*sqrt(J(jj1)*(-30 - 47*J(jj1) + 96*Power(J(jj1),2) + 184*Power(J(jj1),3) + 96*Power(J(jj1),4) + 16*Power(J(jj1),5))));
+          case 123: return 1;
+          case 124: return sqrt(6)/sqrt(1 - 3*J(jj1) + 2*Power(J(jj1),2));
+          case 125: return (3*sqrt(2))/(sqrt((-1 + J(jj1))*J(jj1))*(-1 + 2*J(jj1)));
+          case 126: return (3*sqrt(2))/sqrt(Power(J(jj1),2)*(1 - 3*J(jj1) + 2*Power(J(jj1),2))*(-1 + 4*Power(J(jj1),2)));
+          case 127: return (-5 - 3*J(jj1) + 2*Power(J(jj1),2))/sqrt((5 - 7*J(jj1) + 2*Power(J(jj1),2))*(-1 + J(jj1) + 2*Power(J(jj1),2)));
+          case 128: return (3*(-2 - J(jj1) + Power(J(jj1),2)))/(J(jj1)*sqrt(-2 + 5*J(jj1) - 5*Power(J(jj1),3) + 2*Power(J(jj1),4)));
+          case 129: return (3*sqrt(3)*(-3 + 2*J(jj1))*sqrt((-1 + J(jj1) + 2*Power(J(jj1),2))/(3 - 5*J(jj1) + 2*Power(J(jj1),2))))/(J(jj1)*(-1 + 4*Power(J(jj1),2)));
+          case 130: return (3*sqrt(2))/(sqrt(-1 + J(jj1) + 2*Power(J(jj1),2))*(J(jj1) + 2*Power(J(jj1),2)));
+          case 131: return -(sqrt(18 + 9*J(jj1) - 17*Power(J(jj1),2) - 4*Power(J(jj1),3) + 4*Power(J(jj1),4))/(J(jj1) - 2*Power(J(jj1),2)));
+          case 132: return (18*sqrt((3 - 5*J(jj1) + 2*Power(J(jj1),2))/(3 + 8*J(jj1) + 4*Power(J(jj1),2))))/(J(jj1)*(-1 + J(jj1) + 2*Power(J(jj1),2))) + (6*(3 + J(jj1))*sqrt((-1 + J(jj1))/(-9 - 18*J(jj1) + 4*Power(J(jj1),2) + 8*Power(J(jj1),3))))/(1 + J(jj1)) - (9*(3 + J(jj1))*sqrt((-1 + J(jj1))/(-9 - 18*J(jj1) + 4*Power(J(jj1),2) + 8*Power(J(jj1),3))))/(J(jj1)*(1 + J(jj1)));
+          case 133: return (3*sqrt(2)*(-3*(-1 + 2*J(jj1))*sqrt(-3 - 2*J(jj1) + 3*Power(J(jj1),2) + 2*Power(J(jj1),3)) + 6*J(jj1)*(-1 + 2*J(jj1))*sqrt(-3 - 2*J(jj1) + 3*Power(J(jj1),2) + 2*Power(J(jj1),3)) + 6*sqrt((-1 + J(jj1))/(3 + 5*J(jj1) + 2*Power(J(jj1),2)))*(-3 + J(jj1) + 8*Power(J(jj1),2) + 4*Power(J(jj1),3)) - J(jj1)*sqrt((-1 + J(jj1))/(3 + 5*J(jj1) + 2*Power(J(jj1),2)))*(-3 + J(jj1) + 8*Power(J(jj1),2) + 4*Power(J(jj1),3)) + 2*Power(J(jj1),2)*sqrt((-1 + J(jj1))/(3 + 5*J(jj1) + 2*Power(J(jj1),2)))*(-3 + J(jj1) + 8*Power(J(jj1),2) + 4*Power(J(jj1),3))))/(J(jj1)*Power(1 + J(jj1),2)*sqrt(1 + 2*J(jj1))*Power(-3 + 4*J(jj1) + 4*Power(J(jj1),2),1.5));
+          case 134: return sqrt(18 - 9*J(jj1) - 17*Power(J(jj1),2) + 4*Power(J(jj1),3) + 4*Power(J(jj1),4))/(J(jj1) + 2*Power(J(jj1),2));
+          case 135: return (sqrt(6)*(6*sqrt((J(jj1)*(3 - 7*J(jj1) + 4*Power(J(jj1),3)))/(1 + 2*J(jj1))) + 9*sqrt((Power(J(jj1),3)*(3 - 7*J(jj1) + 4*Power(J(jj1),3)))/(1 + 2*J(jj1))) + 4*sqrt(Power(J(jj1),3)*(3 - J(jj1) - 14*Power(J(jj1),2) + 4*Power(J(jj1),3) + 8*Power(J(jj1),4))) + sqrt(Power(J(jj1),5)*(3 - J(jj1) - 14*Power(J(jj1),2) + 4*Power(J(jj1),3) + 8*Power(J(jj1),4)))))/(J(jj1)*Power(1 + J(jj1),1.5)*(6 + 7*J(jj1) + 2*Power(J(jj1),2))*sqrt(-1 + 4*Power(J(jj1),2)));
+          case 136: return (2*(1 + 2*J(jj1))*sqrt(((-1 + J(jj1))*J(jj1)*(-1 + 2*J(jj1))*(3 + 5*J(jj1) + 2*Power(J(jj1),2)))/(2 + J(jj1))) + 6*(1 + 2*J(jj1))*sqrt(((-1 + J(jj1))*J(jj1)*(-1 + 2*J(jj1)))/(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3))) + 6*sqrt((J(jj1)*(1 - 3*J(jj1) + 2*Power(J(jj1),2)))/(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3))) + (1 + 2*J(jj1))*sqrt((-1 + J(jj1))*J(jj1)*(-1 + 2*J(jj1))*(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3))) + 6*sqrt((J(jj1)*(1 + 2*J(jj1))*(1 - 5*Power(J(jj1),2) + 4*Power(J(jj1),4)))/(6 + 7*J(jj1) + 2*Power(J(jj1),2))))/((1 + J(jj1))*sqrt(J(jj1)*(-30 - 47*J(jj1) + 96*Power(J(jj1),2) + 184*Power(J(jj1),3) + 96*Power(J(jj1),4) + 16*Power(J(jj1),5))));
+          case 137: return -1;
+          case 138: return -(sqrt(3)/sqrt(-1 + 4*Power(J(jj1),2)));
+          case 139: return -((sqrt((-1 + J(jj1))/(1 + 2*J(jj1))) + sqrt(-1 - J(jj1) + 2*Power(J(jj1),2)))/sqrt(-1 + J(jj1) + 2*Power(J(jj1),2)));
+          case 140: return -1;
+          case 141: return 3/(1 - 2*J(jj1));
+          case 142: return 3/(J(jj1) - 2*Power(J(jj1),2));
+          case 143: return 3/(J(jj1) - 4*Power(J(jj1),3));
+          case 144: return (-2*sqrt((-2 + J(jj1))*(-1 + J(jj1) + 2*Power(J(jj1),2))))/Power(-1 + 2*J(jj1),1.5);
+          case 145: return (sqrt(3)*(-3*sqrt((J(jj1)*(-1 + J(jj1) + 2*Power(J(jj1),2)))/(1 + 2*J(jj1))) + 8*J(jj1)*sqrt((J(jj1)*(-1 + J(jj1) + 2*Power(J(jj1),2)))/(1 + 2*J(jj1))) - 4*sqrt((Power(J(jj1),5)*(-1 + J(jj1) + 2*Power(J(jj1),2)))/(1 + 2*J(jj1))) - 3*(-1 + 2*J(jj1))*sqrt((Power(3 - 2*J(jj1),2)*J(jj1)*(1 + J(jj1)))/(-1 + 4*Power(J(jj1),2)))))/(J(jj1)*(1 + J(jj1))*sqrt(-3 + 2*J(jj1))*Power(-1 + 2*J(jj1),1.5));
+          case 146: return (6*sqrt((-1 + J(jj1))/J(jj1)))/(1 - 4*Power(J(jj1),2));
+          case 147: return -((3*J(jj1)*sqrt((Power(3 - 2*J(jj1),2)*(-1 + J(jj1))*(-1 + 2*J(jj1))*(3 + 5*J(jj1) + 2*Power(J(jj1),2)))/(J(jj1)*(1 + 2*J(jj1)))) - 3*sqrt((-1 + J(jj1))*Power(J(jj1),3)*(-1 + 2*J(jj1))*(1 + 2*J(jj1))*(3 + 5*J(jj1) + 2*Power(J(jj1),2))) + 2*J(jj1)*sqrt((-1 + J(jj1))*Power(J(jj1),3)*(-1 + 2*J(jj1))*(1 + 2*J(jj1))*(3 + 5*J(jj1) + 2*Power(J(jj1),2))) - 12*J(jj1)*sqrt(((-1 + J(jj1))*J(jj1)*(-3 + J(jj1) + 8*Power(J(jj1),2) + 4*Power(J(jj1),3)))/(1 + 2*J(jj1))) + 8*Power(J(jj1),2)*sqrt(((-1 + J(jj1))*J(jj1)*(-3 + J(jj1) + 8*Power(J(jj1),2) + 4*Power(J(jj1),3)))/(1 + 2*J(jj1))))/(Power(J(jj1),1.5)*sqrt(-3 + 2*J(jj1))*(-3 + J(jj1) + 8*Power(J(jj1),2) + 4*Power(J(jj1),3))));
+          case 148: return (-12*J(jj1)*sqrt(((-1 + J(jj1))*(1 + J(jj1))*(-1 + 2*J(jj1)))/(1 + 2*J(jj1))) - 9*sqrt(((1 + J(jj1))*(1 - 3*J(jj1) + 2*Power(J(jj1),2)))/(1 + 2*J(jj1))) - 3*J(jj1)*sqrt(1 - 5*Power(J(jj1),2) + 4*Power(J(jj1),4)))/(J(jj1)*(3 + 5*J(jj1) + 2*Power(J(jj1),2))*sqrt(-1 + 4*Power(J(jj1),2)));
+          case 149: return -(6*sqrt(((-1 + J(jj1))*J(jj1)*(-1 + 2*J(jj1))*(1 + 2*J(jj1)))/(3 + 5*J(jj1) + 2*Power(J(jj1),2))) + 2*sqrt((-1 + J(jj1))*J(jj1)*(3 + 5*J(jj1) + 2*Power(J(jj1),2))*(-1 + 4*Power(J(jj1),2))) + 6*sqrt((J(jj1)*(1 - 3*J(jj1) + 2*Power(J(jj1),2)))/(3 + 11*J(jj1) + 12*Power(J(jj1),2) + 4*Power(J(jj1),3))) + 6*sqrt((J(jj1) - 5*Power(J(jj1),3) + 4*Power(J(jj1),5))/(3 + 2*J(jj1))))/(2.*sqrt(J(jj1)*(-1 + 4*Power(J(jj1),2))*(6 + 13*J(jj1) + 9*Power(J(jj1),2) + 2*Power(J(jj1),3))));
+          case 150: return 1;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(1, 4));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(1, 4));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -31,6 +31,7 @@ namespace NRG {
 template<typename SC>
 MatrixElements<SC> SymmetryQS<SC>::recalc_doublet(const DiagInfo<SC> &diag, const SubspaceStructure &substruct, const MatrixElements<SC> &cold) const {
   MatrixElements<SC> cnew;
+  const auto blocks = std::make_shared<const BlockIndex<SC>>(cold, substruct);
   if (!P.substeps) {
     for(const auto &[I1, eig]: diag) {
       int q1 = I1.get("Q");
@@ -44,10 +45,24 @@ MatrixElements<SC> SymmetryQS<SC>::recalc_doublet(const DiagInfo<SC> &diag, cons
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "qs/qs-1ch-doubletp.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 2},
+        {3, 3},
+        {4, 4}
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(1, 2));
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 2: return 1/(1 + 2*S(ss1));
+          case 3: return -1;
+          case 4: return 1;
+          default: my_assert_not_reached();
+        }
+      };
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(1, 2));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -57,10 +72,58 @@ MatrixElements<SC> SymmetryQS<SC>::recalc_doublet(const DiagInfo<SC> &diag, cons
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "qs/qs-2ch-doubletp.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 2},
+        {3, 3},
+        {4, 4},
+        {5, 4},
+        {5, 5},
+        {6, 6},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {10, 9},
+        {10, 10},
+        {11, 10},
+        {11, 11},
+        {12, 12},
+        {13, 12},
+        {13, 13},
+        {14, 14},
+        {15, 14},
+        {15, 15},
+        {16, 16}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 2: return 1/(1 + 2*S(ss1));
+          case 3: return -1;
+          case 4: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 5: return 1/(1 + 2*S(ss1));
+          case 6: return -1;
+          case 7: return 1;
+          case 8: return 1;
+          case 9: return 1;
+          case 10: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 11: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 12: return sqrt((S(ss1)*(3 + 4*S(ss1)*(2 + S(ss1))))/(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 13: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 14: return 1;
+          case 15: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 16: return 1/(1 + 2*S(ss1));
+          case 17: return -1;
+          case 18: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 19: return 1/(1 + 2*S(ss1));
+          case 20: return -1;
+          case 21: return 1;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(1, 2));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(1, 2));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -70,10 +133,200 @@ MatrixElements<SC> SymmetryQS<SC>::recalc_doublet(const DiagInfo<SC> &diag, cons
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "qs/qs-3ch-doubletp.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 2},
+        {3, 3},
+        {4, 4},
+        {5, 4},
+        {5, 5},
+        {6, 6},
+        {7, 6},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {10, 10},
+        {11, 11},
+        {12, 12},
+        {13, 13},
+        {14, 14},
+        {15, 14},
+        {15, 15},
+        {16, 15},
+        {16, 16},
+        {17, 17},
+        {18, 17},
+        {18, 18},
+        {19, 18},
+        {19, 19},
+        {20, 20},
+        {21, 20},
+        {21, 21},
+        {22, 21},
+        {22, 22},
+        {23, 23},
+        {24, 23},
+        {24, 24},
+        {25, 25},
+        {26, 25},
+        {26, 26},
+        {27, 27},
+        {28, 27},
+        {28, 28},
+        {29, 29},
+        {30, 29},
+        {30, 30},
+        {31, 31},
+        {32, 31},
+        {32, 32},
+        {33, 33},
+        {34, 33},
+        {34, 34},
+        {35, 35},
+        {36, 35},
+        {36, 36},
+        {37, 37},
+        {38, 37},
+        {38, 38},
+        {39, 39},
+        {40, 39},
+        {40, 40},
+        {41, 40},
+        {41, 41},
+        {42, 41},
+        {42, 42},
+        {43, 43},
+        {44, 44},
+        {45, 45},
+        {46, 46},
+        {47, 47},
+        {48, 48},
+        {49, 49},
+        {50, 49},
+        {50, 50},
+        {51, 50},
+        {51, 51},
+        {52, 52},
+        {53, 52},
+        {53, 53},
+        {54, 53},
+        {54, 54},
+        {55, 55},
+        {56, 55},
+        {56, 56},
+        {57, 56},
+        {57, 57},
+        {58, 58},
+        {59, 58},
+        {59, 59},
+        {60, 60},
+        {61, 60},
+        {61, 61},
+        {62, 62},
+        {63, 62},
+        {63, 63},
+        {64, 64}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 2: return 1/(1 + 2*S(ss1));
+          case 3: return -1;
+          case 4: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 5: return 1/(1 + 2*S(ss1));
+          case 6: return -1;
+          case 7: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 8: return 1/(1 + 2*S(ss1));
+          case 9: return -1;
+          case 10: return 1;
+          case 11: return 1;
+          case 12: return 1;
+          case 13: return 1;
+          case 14: return 1;
+          case 15: return 1;
+          case 16: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 17: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 18: return sqrt((S(ss1)*(3 + 4*S(ss1)*(2 + S(ss1))))/(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 19: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 20: return 1;
+          case 21: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 22: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 23: return sqrt((S(ss1)*(3 + 4*S(ss1)*(2 + S(ss1))))/(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 24: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 25: return 1;
+          case 26: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 27: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 28: return sqrt((S(ss1)*(3 + 4*S(ss1)*(2 + S(ss1))))/(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 29: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 30: return 1;
+          case 31: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 32: return 1/(1 + 2*S(ss1));
+          case 33: return -1;
+          case 34: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 35: return 1/(1 + 2*S(ss1));
+          case 36: return -1;
+          case 37: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 38: return 1/(1 + 2*S(ss1));
+          case 39: return -1;
+          case 40: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 41: return 1/(1 + 2*S(ss1));
+          case 42: return -1;
+          case 43: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 44: return 1/(1 + 2*S(ss1));
+          case 45: return -1;
+          case 46: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 47: return 1/(1 + 2*S(ss1));
+          case 48: return -1;
+          case 49: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 50: return 1/(1 + 2*S(ss1));
+          case 51: return -1;
+          case 52: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 53: return 1/(1 + 2*S(ss1));
+          case 54: return -1;
+          case 55: return -2*sqrt((-1 + Power(S(ss1),2))/(-1 + 4*Power(S(ss1),2)));
+          case 56: return sqrt(3)/sqrt(-1 + 4*Power(S(ss1),2));
+          case 57: return -(sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1)));
+          case 58: return 2/(1 + 2*S(ss1));
+          case 59: return (-2*S(ss1)*(-3*sqrt(((1 + S(ss1))*(2 + S(ss1)))/(3 + 2*S(ss1))) + 7*sqrt((1 + S(ss1))*(2 + S(ss1))*(3 + 2*S(ss1))) + S(ss1)*(-5*sqrt(((1 + S(ss1))*(2 + S(ss1)))/(3 + 2*S(ss1))) + 4*S(ss1)*(1 + S(ss1))*sqrt(((1 + S(ss1))*(2 + S(ss1)))/(3 + 2*S(ss1))) + 8*sqrt((1 + S(ss1))*(2 + S(ss1))*(3 + 2*S(ss1))))))/((2 + S(ss1))*sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1)))*Power(3 + 2*S(ss1),2));
+          case 60: return sqrt(3)/sqrt(3 + 4*S(ss1)*(2 + S(ss1)));
+          case 61: return -1;
+          case 62: return 1;
+          case 63: return 1;
+          case 64: return 1;
+          case 65: return 1;
+          case 66: return 1;
+          case 67: return 1;
+          case 68: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 69: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 70: return sqrt((S(ss1)*(3 + 4*S(ss1)*(2 + S(ss1))))/(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 71: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 72: return 1;
+          case 73: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 74: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 75: return sqrt((S(ss1)*(3 + 4*S(ss1)*(2 + S(ss1))))/(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 76: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 77: return 1;
+          case 78: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 79: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 80: return sqrt((S(ss1)*(3 + 4*S(ss1)*(2 + S(ss1))))/(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 81: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 82: return 1;
+          case 83: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 84: return 1/(1 + 2*S(ss1));
+          case 85: return -1;
+          case 86: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 87: return 1/(1 + 2*S(ss1));
+          case 88: return -1;
+          case 89: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 90: return 1/(1 + 2*S(ss1));
+          case 91: return -1;
+          case 92: return 1;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(1, 2));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(1, 2));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -83,10 +336,786 @@ MatrixElements<SC> SymmetryQS<SC>::recalc_doublet(const DiagInfo<SC> &diag, cons
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "qs/qs-4ch-doubletp.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 2},
+        {3, 3},
+        {4, 4},
+        {5, 4},
+        {5, 5},
+        {6, 6},
+        {7, 6},
+        {7, 7},
+        {8, 8},
+        {9, 8},
+        {9, 9},
+        {10, 10},
+        {11, 11},
+        {12, 12},
+        {13, 13},
+        {14, 14},
+        {15, 15},
+        {16, 16},
+        {17, 17},
+        {18, 18},
+        {19, 19},
+        {20, 20},
+        {21, 20},
+        {21, 21},
+        {22, 21},
+        {22, 22},
+        {23, 23},
+        {24, 23},
+        {24, 24},
+        {25, 24},
+        {25, 25},
+        {26, 26},
+        {27, 26},
+        {27, 27},
+        {28, 27},
+        {28, 28},
+        {29, 29},
+        {30, 29},
+        {30, 30},
+        {31, 30},
+        {31, 31},
+        {32, 32},
+        {33, 32},
+        {33, 33},
+        {34, 33},
+        {34, 34},
+        {35, 35},
+        {36, 35},
+        {36, 36},
+        {37, 36},
+        {37, 37},
+        {38, 38},
+        {39, 38},
+        {39, 39},
+        {40, 40},
+        {41, 40},
+        {41, 41},
+        {42, 42},
+        {43, 42},
+        {43, 43},
+        {44, 44},
+        {45, 44},
+        {45, 45},
+        {46, 46},
+        {47, 46},
+        {47, 47},
+        {48, 48},
+        {49, 48},
+        {49, 49},
+        {50, 50},
+        {51, 50},
+        {51, 51},
+        {52, 52},
+        {53, 52},
+        {53, 53},
+        {54, 54},
+        {55, 54},
+        {55, 55},
+        {56, 56},
+        {57, 56},
+        {57, 57},
+        {58, 58},
+        {59, 58},
+        {59, 59},
+        {60, 60},
+        {61, 60},
+        {61, 61},
+        {62, 62},
+        {63, 62},
+        {63, 63},
+        {64, 64},
+        {65, 64},
+        {65, 65},
+        {66, 66},
+        {67, 66},
+        {67, 67},
+        {68, 68},
+        {69, 68},
+        {69, 69},
+        {70, 70},
+        {71, 70},
+        {71, 71},
+        {72, 72},
+        {73, 72},
+        {73, 73},
+        {74, 74},
+        {75, 74},
+        {75, 75},
+        {76, 76},
+        {77, 76},
+        {77, 77},
+        {78, 78},
+        {79, 78},
+        {79, 79},
+        {80, 79},
+        {80, 80},
+        {81, 80},
+        {81, 81},
+        {82, 82},
+        {83, 82},
+        {83, 83},
+        {84, 83},
+        {84, 84},
+        {85, 84},
+        {85, 85},
+        {86, 86},
+        {87, 86},
+        {87, 87},
+        {88, 87},
+        {88, 88},
+        {89, 88},
+        {89, 89},
+        {90, 90},
+        {91, 90},
+        {91, 91},
+        {92, 91},
+        {92, 92},
+        {93, 92},
+        {93, 93},
+        {94, 94},
+        {95, 95},
+        {96, 96},
+        {97, 97},
+        {98, 98},
+        {99, 99},
+        {100, 100},
+        {101, 101},
+        {102, 102},
+        {103, 103},
+        {104, 104},
+        {105, 105},
+        {106, 106},
+        {107, 107},
+        {108, 108},
+        {109, 109},
+        {110, 110},
+        {111, 111},
+        {112, 112},
+        {113, 113},
+        {114, 114},
+        {115, 114},
+        {115, 115},
+        {116, 115},
+        {116, 116},
+        {117, 117},
+        {118, 117},
+        {118, 118},
+        {119, 118},
+        {119, 119},
+        {120, 120},
+        {121, 120},
+        {121, 121},
+        {122, 121},
+        {122, 122},
+        {123, 123},
+        {124, 123},
+        {124, 124},
+        {125, 124},
+        {125, 125},
+        {126, 126},
+        {127, 126},
+        {127, 127},
+        {128, 127},
+        {128, 128},
+        {129, 129},
+        {130, 129},
+        {130, 130},
+        {131, 130},
+        {131, 131},
+        {132, 132},
+        {133, 132},
+        {133, 133},
+        {134, 133},
+        {134, 134},
+        {135, 135},
+        {136, 135},
+        {136, 136},
+        {137, 136},
+        {137, 137},
+        {138, 138},
+        {139, 138},
+        {139, 139},
+        {140, 139},
+        {140, 140},
+        {141, 141},
+        {142, 141},
+        {142, 142},
+        {143, 142},
+        {143, 143},
+        {144, 144},
+        {145, 144},
+        {145, 145},
+        {146, 145},
+        {146, 146},
+        {147, 147},
+        {148, 147},
+        {148, 148},
+        {149, 148},
+        {149, 149},
+        {150, 150},
+        {151, 150},
+        {151, 151},
+        {152, 151},
+        {152, 152},
+        {153, 153},
+        {154, 153},
+        {154, 154},
+        {155, 154},
+        {155, 155},
+        {156, 156},
+        {157, 156},
+        {157, 157},
+        {158, 157},
+        {158, 158},
+        {159, 159},
+        {160, 159},
+        {160, 160},
+        {161, 160},
+        {161, 161},
+        {162, 161},
+        {162, 162},
+        {163, 162},
+        {163, 163},
+        {164, 164},
+        {165, 164},
+        {165, 165},
+        {166, 166},
+        {167, 166},
+        {167, 167},
+        {168, 168},
+        {169, 168},
+        {169, 169},
+        {170, 170},
+        {171, 170},
+        {171, 171},
+        {172, 172},
+        {173, 172},
+        {173, 173},
+        {174, 174},
+        {175, 174},
+        {175, 175},
+        {176, 176},
+        {177, 176},
+        {177, 177},
+        {178, 178},
+        {179, 178},
+        {179, 179},
+        {180, 180},
+        {181, 180},
+        {181, 181},
+        {182, 182},
+        {183, 182},
+        {183, 183},
+        {184, 184},
+        {185, 184},
+        {185, 185},
+        {186, 186},
+        {187, 186},
+        {187, 187},
+        {188, 188},
+        {189, 188},
+        {189, 189},
+        {190, 190},
+        {191, 190},
+        {191, 191},
+        {192, 192},
+        {193, 192},
+        {193, 193},
+        {194, 194},
+        {195, 194},
+        {195, 195},
+        {196, 196},
+        {197, 196},
+        {197, 197},
+        {198, 198},
+        {199, 198},
+        {199, 199},
+        {200, 200},
+        {201, 200},
+        {201, 201},
+        {202, 202},
+        {203, 202},
+        {203, 203},
+        {204, 204},
+        {205, 204},
+        {205, 205},
+        {206, 205},
+        {206, 206},
+        {207, 206},
+        {207, 207},
+        {208, 208},
+        {209, 208},
+        {209, 209},
+        {210, 209},
+        {210, 210},
+        {211, 210},
+        {211, 211},
+        {212, 212},
+        {213, 212},
+        {213, 213},
+        {214, 213},
+        {214, 214},
+        {215, 214},
+        {215, 215},
+        {216, 216},
+        {217, 216},
+        {217, 217},
+        {218, 217},
+        {218, 218},
+        {219, 218},
+        {219, 219},
+        {220, 220},
+        {221, 221},
+        {222, 222},
+        {223, 223},
+        {224, 224},
+        {225, 225},
+        {226, 226},
+        {227, 227},
+        {228, 228},
+        {229, 229},
+        {230, 230},
+        {231, 230},
+        {231, 231},
+        {232, 231},
+        {232, 232},
+        {233, 233},
+        {234, 233},
+        {234, 234},
+        {235, 234},
+        {235, 235},
+        {236, 236},
+        {237, 236},
+        {237, 237},
+        {238, 237},
+        {238, 238},
+        {239, 239},
+        {240, 239},
+        {240, 240},
+        {241, 240},
+        {241, 241},
+        {242, 242},
+        {243, 242},
+        {243, 243},
+        {244, 243},
+        {244, 244},
+        {245, 245},
+        {246, 245},
+        {246, 246},
+        {247, 246},
+        {247, 247},
+        {248, 248},
+        {249, 248},
+        {249, 249},
+        {250, 250},
+        {251, 250},
+        {251, 251},
+        {252, 252},
+        {253, 252},
+        {253, 253},
+        {254, 254},
+        {255, 254},
+        {255, 255},
+        {256, 256}
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(1, 2));
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 2: return 1/(1 + 2*S(ss1));
+          case 3: return -1;
+          case 4: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 5: return 1/(1 + 2*S(ss1));
+          case 6: return -1;
+          case 7: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 8: return 1/(1 + 2*S(ss1));
+          case 9: return -1;
+          case 10: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 11: return 1/(1 + 2*S(ss1));
+          case 12: return -1;
+          case 13: return 1;
+          case 14: return 1;
+          case 15: return 1;
+          case 16: return 1;
+          case 17: return 1;
+          case 18: return 1;
+          case 19: return 1;
+          case 20: return 1;
+          case 21: return 1;
+          case 22: return 1;
+          case 23: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 24: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 25: return sqrt((S(ss1)*(3 + 4*S(ss1)*(2 + S(ss1))))/(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 26: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 27: return 1;
+          case 28: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 29: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 30: return sqrt((S(ss1)*(3 + 4*S(ss1)*(2 + S(ss1))))/(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 31: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 32: return 1;
+          case 33: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 34: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 35: return sqrt((S(ss1)*(3 + 4*S(ss1)*(2 + S(ss1))))/(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 36: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 37: return 1;
+          case 38: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 39: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 40: return sqrt((S(ss1)*(3 + 4*S(ss1)*(2 + S(ss1))))/(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 41: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 42: return 1;
+          case 43: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 44: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 45: return sqrt((S(ss1)*(3 + 4*S(ss1)*(2 + S(ss1))))/(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 46: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 47: return 1;
+          case 48: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 49: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 50: return sqrt((S(ss1)*(3 + 4*S(ss1)*(2 + S(ss1))))/(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 51: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 52: return 1;
+          case 53: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 54: return 1/(1 + 2*S(ss1));
+          case 55: return -1;
+          case 56: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 57: return 1/(1 + 2*S(ss1));
+          case 58: return -1;
+          case 59: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 60: return 1/(1 + 2*S(ss1));
+          case 61: return -1;
+          case 62: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 63: return 1/(1 + 2*S(ss1));
+          case 64: return -1;
+          case 65: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 66: return 1/(1 + 2*S(ss1));
+          case 67: return -1;
+          case 68: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 69: return 1/(1 + 2*S(ss1));
+          case 70: return -1;
+          case 71: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 72: return 1/(1 + 2*S(ss1));
+          case 73: return -1;
+          case 74: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 75: return 1/(1 + 2*S(ss1));
+          case 76: return -1;
+          case 77: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 78: return 1/(1 + 2*S(ss1));
+          case 79: return -1;
+          case 80: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 81: return 1/(1 + 2*S(ss1));
+          case 82: return -1;
+          case 83: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 84: return 1/(1 + 2*S(ss1));
+          case 85: return -1;
+          case 86: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 87: return 1/(1 + 2*S(ss1));
+          case 88: return -1;
+          case 89: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 90: return 1/(1 + 2*S(ss1));
+          case 91: return -1;
+          case 92: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 93: return 1/(1 + 2*S(ss1));
+          case 94: return -1;
+          case 95: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 96: return 1/(1 + 2*S(ss1));
+          case 97: return -1;
+          case 98: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 99: return 1/(1 + 2*S(ss1));
+          case 100: return -1;
+          case 101: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 102: return 1/(1 + 2*S(ss1));
+          case 103: return -1;
+          case 104: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 105: return 1/(1 + 2*S(ss1));
+          case 106: return -1;
+          case 107: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 108: return 1/(1 + 2*S(ss1));
+          case 109: return -1;
+          case 110: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 111: return 1/(1 + 2*S(ss1));
+          case 112: return -1;
+          case 113: return -2*sqrt((-1 + Power(S(ss1),2))/(-1 + 4*Power(S(ss1),2)));
+          case 114: return sqrt(3)/sqrt(-1 + 4*Power(S(ss1),2));
+          case 115: return -(sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1)));
+          case 116: return 2/(1 + 2*S(ss1));
+          case 117: return (-2*S(ss1)*(-3*sqrt(((1 + S(ss1))*(2 + S(ss1)))/(3 + 2*S(ss1))) + 7*sqrt((1 + S(ss1))*(2 + S(ss1))*(3 + 2*S(ss1))) + S(ss1)*(-5*sqrt(((1 + S(ss1))*(2 + S(ss1)))/(3 + 2*S(ss1))) + 4*S(ss1)*(1 + S(ss1))*sqrt(((1 + S(ss1))*(2 + S(ss1)))/(3 + 2*S(ss1))) + 8*sqrt((1 + S(ss1))*(2 + S(ss1))*(3 + 2*S(ss1))))))/((2 + S(ss1))*sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1)))*Power(3 + 2*S(ss1),2));
+          case 118: return sqrt(3)/sqrt(3 + 4*S(ss1)*(2 + S(ss1)));
+          case 119: return -1;
+          case 120: return -2*sqrt((-1 + Power(S(ss1),2))/(-1 + 4*Power(S(ss1),2)));
+          case 121: return sqrt(3)/sqrt(-1 + 4*Power(S(ss1),2));
+          case 122: return -(sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1)));
+          case 123: return 2/(1 + 2*S(ss1));
+          case 124: return (-2*S(ss1)*(-3*sqrt(((1 + S(ss1))*(2 + S(ss1)))/(3 + 2*S(ss1))) + 7*sqrt((1 + S(ss1))*(2 + S(ss1))*(3 + 2*S(ss1))) + S(ss1)*(-5*sqrt(((1 + S(ss1))*(2 + S(ss1)))/(3 + 2*S(ss1))) + 4*S(ss1)*(1 + S(ss1))*sqrt(((1 + S(ss1))*(2 + S(ss1)))/(3 + 2*S(ss1))) + 8*sqrt((1 + S(ss1))*(2 + S(ss1))*(3 + 2*S(ss1))))))/((2 + S(ss1))*sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1)))*Power(3 + 2*S(ss1),2));
+          case 125: return sqrt(3)/sqrt(3 + 4*S(ss1)*(2 + S(ss1)));
+          case 126: return -1;
+          case 127: return -2*sqrt((-1 + Power(S(ss1),2))/(-1 + 4*Power(S(ss1),2)));
+          case 128: return sqrt(3)/sqrt(-1 + 4*Power(S(ss1),2));
+          case 129: return -(sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1)));
+          case 130: return 2/(1 + 2*S(ss1));
+          case 131: return (-2*S(ss1)*(-3*sqrt(((1 + S(ss1))*(2 + S(ss1)))/(3 + 2*S(ss1))) + 7*sqrt((1 + S(ss1))*(2 + S(ss1))*(3 + 2*S(ss1))) + S(ss1)*(-5*sqrt(((1 + S(ss1))*(2 + S(ss1)))/(3 + 2*S(ss1))) + 4*S(ss1)*(1 + S(ss1))*sqrt(((1 + S(ss1))*(2 + S(ss1)))/(3 + 2*S(ss1))) + 8*sqrt((1 + S(ss1))*(2 + S(ss1))*(3 + 2*S(ss1))))))/((2 + S(ss1))*sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1)))*Power(3 + 2*S(ss1),2));
+          case 132: return sqrt(3)/sqrt(3 + 4*S(ss1)*(2 + S(ss1)));
+          case 133: return -1;
+          case 134: return -2*sqrt((-1 + Power(S(ss1),2))/(-1 + 4*Power(S(ss1),2)));
+          case 135: return sqrt(3)/sqrt(-1 + 4*Power(S(ss1),2));
+          case 136: return -(sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1)));
+          case 137: return 2/(1 + 2*S(ss1));
+          case 138: return (-2*S(ss1)*(-3*sqrt(((1 + S(ss1))*(2 + S(ss1)))/(3 + 2*S(ss1))) + 7*sqrt((1 + S(ss1))*(2 + S(ss1))*(3 + 2*S(ss1))) + S(ss1)*(-5*sqrt(((1 + S(ss1))*(2 + S(ss1)))/(3 + 2*S(ss1))) + 4*S(ss1)*(1 + S(ss1))*sqrt(((1 + S(ss1))*(2 + S(ss1)))/(3 + 2*S(ss1))) + 8*sqrt((1 + S(ss1))*(2 + S(ss1))*(3 + 2*S(ss1))))))/((2 + S(ss1))*sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1)))*Power(3 + 2*S(ss1),2));
+          case 139: return sqrt(3)/sqrt(3 + 4*S(ss1)*(2 + S(ss1)));
+          case 140: return -1;
+          case 141: return 1;
+          case 142: return 1;
+          case 143: return 1;
+          case 144: return 1;
+          case 145: return 1;
+          case 146: return 1;
+          case 147: return 1;
+          case 148: return 1;
+          case 149: return 1;
+          case 150: return 1;
+          case 151: return 1;
+          case 152: return 1;
+          case 153: return 1;
+          case 154: return 1;
+          case 155: return 1;
+          case 156: return 1;
+          case 157: return 1;
+          case 158: return 1;
+          case 159: return 1;
+          case 160: return 1;
+          case 161: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 162: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 163: return sqrt((S(ss1)*(3 + 4*S(ss1)*(2 + S(ss1))))/(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 164: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 165: return 1;
+          case 166: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 167: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 168: return sqrt((S(ss1)*(3 + 4*S(ss1)*(2 + S(ss1))))/(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 169: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 170: return 1;
+          case 171: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 172: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 173: return sqrt((S(ss1)*(3 + 4*S(ss1)*(2 + S(ss1))))/(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 174: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 175: return 1;
+          case 176: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 177: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 178: return sqrt((S(ss1)*(3 + 4*S(ss1)*(2 + S(ss1))))/(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 179: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 180: return 1;
+          case 181: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 182: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 183: return sqrt((S(ss1)*(3 + 4*S(ss1)*(2 + S(ss1))))/(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 184: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 185: return 1;
+          case 186: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 187: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 188: return sqrt((S(ss1)*(3 + 4*S(ss1)*(2 + S(ss1))))/(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 189: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 190: return 1;
+          case 191: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 192: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 193: return sqrt((S(ss1)*(3 + 4*S(ss1)*(2 + S(ss1))))/(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 194: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 195: return 1;
+          case 196: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 197: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 198: return sqrt((S(ss1)*(3 + 4*S(ss1)*(2 + S(ss1))))/(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 199: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 200: return 1;
+          case 201: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 202: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 203: return sqrt((S(ss1)*(3 + 4*S(ss1)*(2 + S(ss1))))/(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 204: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 205: return 1;
+          case 206: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 207: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 208: return sqrt((S(ss1)*(3 + 4*S(ss1)*(2 + S(ss1))))/(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 209: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 210: return 1;
+          case 211: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 212: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 213: return sqrt((S(ss1)*(3 + 4*S(ss1)*(2 + S(ss1))))/(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 214: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 215: return 1;
+          case 216: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 217: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 218: return sqrt((S(ss1)*(3 + 4*S(ss1)*(2 + S(ss1))))/(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 219: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 220: return 1;
+          case 221: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 222: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 223: return sqrt((S(ss1)*(3 + 4*S(ss1)*(2 + S(ss1))))/(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 224: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 225: return 1;
+          case 226: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 227: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 228: return sqrt((S(ss1)*(3 + 4*S(ss1)*(2 + S(ss1))))/(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 229: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 230: return 1;
+          case 231: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 232: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 233: return sqrt((S(ss1)*(3 + 4*S(ss1)*(2 + S(ss1))))/(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 234: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 235: return 1;
+          case 236: return sqrt((3 + S(ss1) - 2*Power(S(ss1),2))/(1 + S(ss1) - 2*Power(S(ss1),2)));
+          case 237: return -(sqrt(2)/sqrt((-1 + S(ss1))*(1 + 2*S(ss1))));
+          case 238: return (-3 + S(ss1) + 2*Power(S(ss1),2))/sqrt((-1 + S(ss1))*S(ss1)*(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 239: return -(sqrt(3)/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 240: return (-1 + 2*S(ss1))/sqrt(((1 + 2*S(ss1))*(-1 + S(ss1) + 2*Power(S(ss1),2)))/(2 + S(ss1)));
+          case 241: return -((sqrt(3)*(6*sqrt(S(ss1)*(2 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 7*sqrt(Power(S(ss1),3)*(2 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*sqrt(Power(S(ss1),5)*(2 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)))))/(sqrt(S(ss1)*(1 + S(ss1)))*(1 + 2*S(ss1))*Power((2 + S(ss1))*(3 + 2*S(ss1)),1.5)));
+          case 242: return (5 + 2*S(ss1))*sqrt(S(ss1)/(10 + 29*S(ss1) + 20*Power(S(ss1),2) + 4*Power(S(ss1),3)));
+          case 243: return -(sqrt(2)/sqrt((2 + S(ss1))*(1 + 2*S(ss1))));
+          case 244: return 1;
+          case 245: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 246: return 1/(1 + 2*S(ss1));
+          case 247: return -1;
+          case 248: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 249: return 1/(1 + 2*S(ss1));
+          case 250: return -1;
+          case 251: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 252: return 1/(1 + 2*S(ss1));
+          case 253: return -1;
+          case 254: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 255: return 1/(1 + 2*S(ss1));
+          case 256: return -1;
+          case 257: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 258: return 1/(1 + 2*S(ss1));
+          case 259: return -1;
+          case 260: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 261: return 1/(1 + 2*S(ss1));
+          case 262: return -1;
+          case 263: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 264: return 1/(1 + 2*S(ss1));
+          case 265: return -1;
+          case 266: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 267: return 1/(1 + 2*S(ss1));
+          case 268: return -1;
+          case 269: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 270: return 1/(1 + 2*S(ss1));
+          case 271: return -1;
+          case 272: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 273: return 1/(1 + 2*S(ss1));
+          case 274: return -1;
+          case 275: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 276: return 1/(1 + 2*S(ss1));
+          case 277: return -1;
+          case 278: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 279: return 1/(1 + 2*S(ss1));
+          case 280: return -1;
+          case 281: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 282: return 1/(1 + 2*S(ss1));
+          case 283: return -1;
+          case 284: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 285: return 1/(1 + 2*S(ss1));
+          case 286: return -1;
+          case 287: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 288: return 1/(1 + 2*S(ss1));
+          case 289: return -1;
+          case 290: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 291: return 1/(1 + 2*S(ss1));
+          case 292: return -1;
+          case 293: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 294: return 1/(1 + 2*S(ss1));
+          case 295: return -1;
+          case 296: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 297: return 1/(1 + 2*S(ss1));
+          case 298: return -1;
+          case 299: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 300: return 1/(1 + 2*S(ss1));
+          case 301: return -1;
+          case 302: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 303: return 1/(1 + 2*S(ss1));
+          case 304: return -1;
+          case 305: return -2*sqrt((-1 + Power(S(ss1),2))/(-1 + 4*Power(S(ss1),2)));
+          case 306: return sqrt(3)/sqrt(-1 + 4*Power(S(ss1),2));
+          case 307: return -(sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1)));
+          case 308: return 2/(1 + 2*S(ss1));
+          case 309: return (-2*S(ss1)*(-3*sqrt(((1 + S(ss1))*(2 + S(ss1)))/(3 + 2*S(ss1))) + 7*sqrt((1 + S(ss1))*(2 + S(ss1))*(3 + 2*S(ss1))) + S(ss1)*(-5*sqrt(((1 + S(ss1))*(2 + S(ss1)))/(3 + 2*S(ss1))) + 4*S(ss1)*(1 + S(ss1))*sqrt(((1 + S(ss1))*(2 + S(ss1)))/(3 + 2*S(ss1))) + 8*sqrt((1 + S(ss1))*(2 + S(ss1))*(3 + 2*S(ss1))))))/((2 + S(ss1))*sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1)))*Power(3 + 2*S(ss1),2));
+          case 310: return sqrt(3)/sqrt(3 + 4*S(ss1)*(2 + S(ss1)));
+          case 311: return -1;
+          case 312: return -2*sqrt((-1 + Power(S(ss1),2))/(-1 + 4*Power(S(ss1),2)));
+          case 313: return sqrt(3)/sqrt(-1 + 4*Power(S(ss1),2));
+          case 314: return -(sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1)));
+          case 315: return 2/(1 + 2*S(ss1));
+          case 316: return (-2*S(ss1)*(-3*sqrt(((1 + S(ss1))*(2 + S(ss1)))/(3 + 2*S(ss1))) + 7*sqrt((1 + S(ss1))*(2 + S(ss1))*(3 + 2*S(ss1))) + S(ss1)*(-5*sqrt(((1 + S(ss1))*(2 + S(ss1)))/(3 + 2*S(ss1))) + 4*S(ss1)*(1 + S(ss1))*sqrt(((1 + S(ss1))*(2 + S(ss1)))/(3 + 2*S(ss1))) + 8*sqrt((1 + S(ss1))*(2 + S(ss1))*(3 + 2*S(ss1))))))/((2 + S(ss1))*sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1)))*Power(3 + 2*S(ss1),2));
+          case 317: return sqrt(3)/sqrt(3 + 4*S(ss1)*(2 + S(ss1)));
+          case 318: return -1;
+          case 319: return -2*sqrt((-1 + Power(S(ss1),2))/(-1 + 4*Power(S(ss1),2)));
+          case 320: return sqrt(3)/sqrt(-1 + 4*Power(S(ss1),2));
+          case 321: return -(sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1)));
+          case 322: return 2/(1 + 2*S(ss1));
+          case 323: return (-2*S(ss1)*(-3*sqrt(((1 + S(ss1))*(2 + S(ss1)))/(3 + 2*S(ss1))) + 7*sqrt((1 + S(ss1))*(2 + S(ss1))*(3 + 2*S(ss1))) + S(ss1)*(-5*sqrt(((1 + S(ss1))*(2 + S(ss1)))/(3 + 2*S(ss1))) + 4*S(ss1)*(1 + S(ss1))*sqrt(((1 + S(ss1))*(2 + S(ss1)))/(3 + 2*S(ss1))) + 8*sqrt((1 + S(ss1))*(2 + S(ss1))*(3 + 2*S(ss1))))))/((2 + S(ss1))*sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1)))*Power(3 + 2*S(ss1),2));
+          case 324: return sqrt(3)/sqrt(3 + 4*S(ss1)*(2 + S(ss1)));
+          case 325: return -1;
+          case 326: return -2*sqrt((-1 + Power(S(ss1),2))/(-1 + 4*Power(S(ss1),2)));
+          case 327: return sqrt(3)/sqrt(-1 + 4*Power(S(ss1),2));
+          case 328: return -(sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1)));
+          case 329: return 2/(1 + 2*S(ss1));
+          case 330: return (-2*S(ss1)*(-3*sqrt(((1 + S(ss1))*(2 + S(ss1)))/(3 + 2*S(ss1))) + 7*sqrt((1 + S(ss1))*(2 + S(ss1))*(3 + 2*S(ss1))) + S(ss1)*(-5*sqrt(((1 + S(ss1))*(2 + S(ss1)))/(3 + 2*S(ss1))) + 4*S(ss1)*(1 + S(ss1))*sqrt(((1 + S(ss1))*(2 + S(ss1)))/(3 + 2*S(ss1))) + 8*sqrt((1 + S(ss1))*(2 + S(ss1))*(3 + 2*S(ss1))))))/((2 + S(ss1))*sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1)))*Power(3 + 2*S(ss1),2));
+          case 331: return sqrt(3)/sqrt(3 + 4*S(ss1)*(2 + S(ss1)));
+          case 332: return -1;
+          case 333: return 1;
+          case 334: return 1;
+          case 335: return 1;
+          case 336: return 1;
+          case 337: return 1;
+          case 338: return 1;
+          case 339: return 1;
+          case 340: return 1;
+          case 341: return 1;
+          case 342: return 1;
+          case 343: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 344: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 345: return sqrt((S(ss1)*(3 + 4*S(ss1)*(2 + S(ss1))))/(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 346: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 347: return 1;
+          case 348: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 349: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 350: return sqrt((S(ss1)*(3 + 4*S(ss1)*(2 + S(ss1))))/(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 351: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 352: return 1;
+          case 353: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 354: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 355: return sqrt((S(ss1)*(3 + 4*S(ss1)*(2 + S(ss1))))/(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 356: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 357: return 1;
+          case 358: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 359: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 360: return sqrt((S(ss1)*(3 + 4*S(ss1)*(2 + S(ss1))))/(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 361: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 362: return 1;
+          case 363: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 364: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 365: return sqrt((S(ss1)*(3 + 4*S(ss1)*(2 + S(ss1))))/(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 366: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 367: return 1;
+          case 368: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 369: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 370: return sqrt((S(ss1)*(3 + 4*S(ss1)*(2 + S(ss1))))/(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 371: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 372: return 1;
+          case 373: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 374: return 1/(1 + 2*S(ss1));
+          case 375: return -1;
+          case 376: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 377: return 1/(1 + 2*S(ss1));
+          case 378: return -1;
+          case 379: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 380: return 1/(1 + 2*S(ss1));
+          case 381: return -1;
+          case 382: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 383: return 1/(1 + 2*S(ss1));
+          case 384: return -1;
+          case 385: return 1;
+          default: my_assert_not_reached();
+        }
+      };
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(1, 2));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -101,10 +1130,24 @@ MatrixElements<SC> SymmetryQS<SC>::recalc_doublet(const DiagInfo<SC> &diag, cons
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "qs/qs-1ch-doubletm.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {2, 3},
+        {3, 3},
+        {4, 4}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return -1;
+          case 2: return 1/(-1 - 2*S(ss1));
+          case 3: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 4: return 1;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(1, 2));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(1, 2));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -114,10 +1157,58 @@ MatrixElements<SC> SymmetryQS<SC>::recalc_doublet(const DiagInfo<SC> &diag, cons
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "qs/qs-2ch-doubletm.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {2, 3},
+        {3, 3},
+        {4, 4},
+        {4, 5},
+        {5, 5},
+        {6, 6},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {9, 10},
+        {10, 10},
+        {10, 11},
+        {11, 11},
+        {12, 12},
+        {12, 13},
+        {13, 13},
+        {14, 14},
+        {14, 15},
+        {15, 15},
+        {16, 16}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return -1;
+          case 2: return 1/(-1 - 2*S(ss1));
+          case 3: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 4: return -1;
+          case 5: return 1/(-1 - 2*S(ss1));
+          case 6: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 7: return 1;
+          case 8: return 1;
+          case 9: return 1;
+          case 10: return 1;
+          case 11: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 12: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 13: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 14: return ((3 + 2*S(ss1))*sqrt((S(ss1)*(1 + S(ss1)))/(3 + 4*S(ss1)*(2 + S(ss1)))))/(1 + S(ss1));
+          case 15: return -1;
+          case 16: return 1/(-1 - 2*S(ss1));
+          case 17: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 18: return -1;
+          case 19: return 1/(-1 - 2*S(ss1));
+          case 20: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 21: return 1;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(1, 2));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(1, 2));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -127,10 +1218,200 @@ MatrixElements<SC> SymmetryQS<SC>::recalc_doublet(const DiagInfo<SC> &diag, cons
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "qs/qs-3ch-doubletm.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {2, 3},
+        {3, 3},
+        {4, 4},
+        {4, 5},
+        {5, 5},
+        {6, 6},
+        {6, 7},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {10, 10},
+        {11, 11},
+        {12, 12},
+        {13, 13},
+        {14, 14},
+        {14, 15},
+        {15, 15},
+        {15, 16},
+        {16, 16},
+        {17, 17},
+        {17, 18},
+        {18, 18},
+        {18, 19},
+        {19, 19},
+        {20, 20},
+        {20, 21},
+        {21, 21},
+        {21, 22},
+        {22, 22},
+        {23, 23},
+        {23, 24},
+        {24, 24},
+        {25, 25},
+        {25, 26},
+        {26, 26},
+        {27, 27},
+        {27, 28},
+        {28, 28},
+        {29, 29},
+        {29, 30},
+        {30, 30},
+        {31, 31},
+        {31, 32},
+        {32, 32},
+        {33, 33},
+        {33, 34},
+        {34, 34},
+        {35, 35},
+        {35, 36},
+        {36, 36},
+        {37, 37},
+        {37, 38},
+        {38, 38},
+        {39, 39},
+        {39, 40},
+        {40, 40},
+        {40, 41},
+        {41, 41},
+        {41, 42},
+        {42, 42},
+        {43, 43},
+        {44, 44},
+        {45, 45},
+        {46, 46},
+        {47, 47},
+        {48, 48},
+        {49, 49},
+        {49, 50},
+        {50, 50},
+        {50, 51},
+        {51, 51},
+        {52, 52},
+        {52, 53},
+        {53, 53},
+        {53, 54},
+        {54, 54},
+        {55, 55},
+        {55, 56},
+        {56, 56},
+        {56, 57},
+        {57, 57},
+        {58, 58},
+        {58, 59},
+        {59, 59},
+        {60, 60},
+        {60, 61},
+        {61, 61},
+        {62, 62},
+        {62, 63},
+        {63, 63},
+        {64, 64}
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(1, 2));
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return -1;
+          case 2: return 1/(-1 - 2*S(ss1));
+          case 3: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 4: return -1;
+          case 5: return 1/(-1 - 2*S(ss1));
+          case 6: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 7: return -1;
+          case 8: return 1/(-1 - 2*S(ss1));
+          case 9: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 10: return 1;
+          case 11: return 1;
+          case 12: return 1;
+          case 13: return 1;
+          case 14: return 1;
+          case 15: return 1;
+          case 16: return 1;
+          case 17: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 18: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 19: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 20: return ((3 + 2*S(ss1))*sqrt((S(ss1)*(1 + S(ss1)))/(3 + 4*S(ss1)*(2 + S(ss1)))))/(1 + S(ss1));
+          case 21: return 1;
+          case 22: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 23: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 24: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 25: return ((3 + 2*S(ss1))*sqrt((S(ss1)*(1 + S(ss1)))/(3 + 4*S(ss1)*(2 + S(ss1)))))/(1 + S(ss1));
+          case 26: return 1;
+          case 27: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 28: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 29: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 30: return ((3 + 2*S(ss1))*sqrt((S(ss1)*(1 + S(ss1)))/(3 + 4*S(ss1)*(2 + S(ss1)))))/(1 + S(ss1));
+          case 31: return -1;
+          case 32: return 1/(-1 - 2*S(ss1));
+          case 33: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 34: return -1;
+          case 35: return 1/(-1 - 2*S(ss1));
+          case 36: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 37: return -1;
+          case 38: return 1/(-1 - 2*S(ss1));
+          case 39: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 40: return -1;
+          case 41: return 1/(-1 - 2*S(ss1));
+          case 42: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 43: return -1;
+          case 44: return 1/(-1 - 2*S(ss1));
+          case 45: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 46: return -1;
+          case 47: return 1/(-1 - 2*S(ss1));
+          case 48: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 49: return -1;
+          case 50: return 1/(-1 - 2*S(ss1));
+          case 51: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 52: return -1;
+          case 53: return 1/(-1 - 2*S(ss1));
+          case 54: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 55: return -1;
+          case 56: return -(sqrt(3)/sqrt(-1 + 4*Power(S(ss1),2)));
+          case 57: return (-2*(-1 + Power(S(ss1),2)))/sqrt(1 - 5*Power(S(ss1),2) + 4*Power(S(ss1),4));
+          case 58: return -2/(1 + 2*S(ss1));
+          case 59: return -(sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1)));
+          case 60: return -((sqrt(3)*(3*sqrt(S(ss1)*(1 + S(ss1))) + 5*sqrt(Power(S(ss1),3)*(1 + S(ss1))) + 2*sqrt(Power(S(ss1),5)*(1 + S(ss1)))))/sqrt(S(ss1)*(1 + 2*S(ss1))*Power(3 + 5*S(ss1) + 2*Power(S(ss1),2),3)));
+          case 61: return -2*(2 + S(ss1))*sqrt(S(ss1)/(6 + 19*S(ss1) + 16*Power(S(ss1),2) + 4*Power(S(ss1),3)));
+          case 62: return 1;
+          case 63: return 1;
+          case 64: return 1;
+          case 65: return 1;
+          case 66: return 1;
+          case 67: return 1;
+          case 68: return 1;
+          case 69: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 70: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 71: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 72: return ((3 + 2*S(ss1))*sqrt((S(ss1)*(1 + S(ss1)))/(3 + 4*S(ss1)*(2 + S(ss1)))))/(1 + S(ss1));
+          case 73: return 1;
+          case 74: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 75: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 76: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 77: return ((3 + 2*S(ss1))*sqrt((S(ss1)*(1 + S(ss1)))/(3 + 4*S(ss1)*(2 + S(ss1)))))/(1 + S(ss1));
+          case 78: return 1;
+          case 79: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 80: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 81: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 82: return ((3 + 2*S(ss1))*sqrt((S(ss1)*(1 + S(ss1)))/(3 + 4*S(ss1)*(2 + S(ss1)))))/(1 + S(ss1));
+          case 83: return -1;
+          case 84: return 1/(-1 - 2*S(ss1));
+          case 85: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 86: return -1;
+          case 87: return 1/(-1 - 2*S(ss1));
+          case 88: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 89: return -1;
+          case 90: return 1/(-1 - 2*S(ss1));
+          case 91: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 92: return 1;
+          default: my_assert_not_reached();
+        }
+      };
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(1, 2));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -140,10 +1421,786 @@ MatrixElements<SC> SymmetryQS<SC>::recalc_doublet(const DiagInfo<SC> &diag, cons
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "qs/qs-4ch-doubletm.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {2, 3},
+        {3, 3},
+        {4, 4},
+        {4, 5},
+        {5, 5},
+        {6, 6},
+        {6, 7},
+        {7, 7},
+        {8, 8},
+        {8, 9},
+        {9, 9},
+        {10, 10},
+        {11, 11},
+        {12, 12},
+        {13, 13},
+        {14, 14},
+        {15, 15},
+        {16, 16},
+        {17, 17},
+        {18, 18},
+        {19, 19},
+        {20, 20},
+        {20, 21},
+        {21, 21},
+        {21, 22},
+        {22, 22},
+        {23, 23},
+        {23, 24},
+        {24, 24},
+        {24, 25},
+        {25, 25},
+        {26, 26},
+        {26, 27},
+        {27, 27},
+        {27, 28},
+        {28, 28},
+        {29, 29},
+        {29, 30},
+        {30, 30},
+        {30, 31},
+        {31, 31},
+        {32, 32},
+        {32, 33},
+        {33, 33},
+        {33, 34},
+        {34, 34},
+        {35, 35},
+        {35, 36},
+        {36, 36},
+        {36, 37},
+        {37, 37},
+        {38, 38},
+        {38, 39},
+        {39, 39},
+        {40, 40},
+        {40, 41},
+        {41, 41},
+        {42, 42},
+        {42, 43},
+        {43, 43},
+        {44, 44},
+        {44, 45},
+        {45, 45},
+        {46, 46},
+        {46, 47},
+        {47, 47},
+        {48, 48},
+        {48, 49},
+        {49, 49},
+        {50, 50},
+        {50, 51},
+        {51, 51},
+        {52, 52},
+        {52, 53},
+        {53, 53},
+        {54, 54},
+        {54, 55},
+        {55, 55},
+        {56, 56},
+        {56, 57},
+        {57, 57},
+        {58, 58},
+        {58, 59},
+        {59, 59},
+        {60, 60},
+        {60, 61},
+        {61, 61},
+        {62, 62},
+        {62, 63},
+        {63, 63},
+        {64, 64},
+        {64, 65},
+        {65, 65},
+        {66, 66},
+        {66, 67},
+        {67, 67},
+        {68, 68},
+        {68, 69},
+        {69, 69},
+        {70, 70},
+        {70, 71},
+        {71, 71},
+        {72, 72},
+        {72, 73},
+        {73, 73},
+        {74, 74},
+        {74, 75},
+        {75, 75},
+        {76, 76},
+        {76, 77},
+        {77, 77},
+        {78, 78},
+        {78, 79},
+        {79, 79},
+        {79, 80},
+        {80, 80},
+        {80, 81},
+        {81, 81},
+        {82, 82},
+        {82, 83},
+        {83, 83},
+        {83, 84},
+        {84, 84},
+        {84, 85},
+        {85, 85},
+        {86, 86},
+        {86, 87},
+        {87, 87},
+        {87, 88},
+        {88, 88},
+        {88, 89},
+        {89, 89},
+        {90, 90},
+        {90, 91},
+        {91, 91},
+        {91, 92},
+        {92, 92},
+        {92, 93},
+        {93, 93},
+        {94, 94},
+        {95, 95},
+        {96, 96},
+        {97, 97},
+        {98, 98},
+        {99, 99},
+        {100, 100},
+        {101, 101},
+        {102, 102},
+        {103, 103},
+        {104, 104},
+        {105, 105},
+        {106, 106},
+        {107, 107},
+        {108, 108},
+        {109, 109},
+        {110, 110},
+        {111, 111},
+        {112, 112},
+        {113, 113},
+        {114, 114},
+        {114, 115},
+        {115, 115},
+        {115, 116},
+        {116, 116},
+        {117, 117},
+        {117, 118},
+        {118, 118},
+        {118, 119},
+        {119, 119},
+        {120, 120},
+        {120, 121},
+        {121, 121},
+        {121, 122},
+        {122, 122},
+        {123, 123},
+        {123, 124},
+        {124, 124},
+        {124, 125},
+        {125, 125},
+        {126, 126},
+        {126, 127},
+        {127, 127},
+        {127, 128},
+        {128, 128},
+        {129, 129},
+        {129, 130},
+        {130, 130},
+        {130, 131},
+        {131, 131},
+        {132, 132},
+        {132, 133},
+        {133, 133},
+        {133, 134},
+        {134, 134},
+        {135, 135},
+        {135, 136},
+        {136, 136},
+        {136, 137},
+        {137, 137},
+        {138, 138},
+        {138, 139},
+        {139, 139},
+        {139, 140},
+        {140, 140},
+        {141, 141},
+        {141, 142},
+        {142, 142},
+        {142, 143},
+        {143, 143},
+        {144, 144},
+        {144, 145},
+        {145, 145},
+        {145, 146},
+        {146, 146},
+        {147, 147},
+        {147, 148},
+        {148, 148},
+        {148, 149},
+        {149, 149},
+        {150, 150},
+        {150, 151},
+        {151, 151},
+        {151, 152},
+        {152, 152},
+        {153, 153},
+        {153, 154},
+        {154, 154},
+        {154, 155},
+        {155, 155},
+        {156, 156},
+        {156, 157},
+        {157, 157},
+        {157, 158},
+        {158, 158},
+        {159, 159},
+        {159, 160},
+        {160, 160},
+        {160, 161},
+        {161, 161},
+        {161, 162},
+        {162, 162},
+        {162, 163},
+        {163, 163},
+        {164, 164},
+        {164, 165},
+        {165, 165},
+        {166, 166},
+        {166, 167},
+        {167, 167},
+        {168, 168},
+        {168, 169},
+        {169, 169},
+        {170, 170},
+        {170, 171},
+        {171, 171},
+        {172, 172},
+        {172, 173},
+        {173, 173},
+        {174, 174},
+        {174, 175},
+        {175, 175},
+        {176, 176},
+        {176, 177},
+        {177, 177},
+        {178, 178},
+        {178, 179},
+        {179, 179},
+        {180, 180},
+        {180, 181},
+        {181, 181},
+        {182, 182},
+        {182, 183},
+        {183, 183},
+        {184, 184},
+        {184, 185},
+        {185, 185},
+        {186, 186},
+        {186, 187},
+        {187, 187},
+        {188, 188},
+        {188, 189},
+        {189, 189},
+        {190, 190},
+        {190, 191},
+        {191, 191},
+        {192, 192},
+        {192, 193},
+        {193, 193},
+        {194, 194},
+        {194, 195},
+        {195, 195},
+        {196, 196},
+        {196, 197},
+        {197, 197},
+        {198, 198},
+        {198, 199},
+        {199, 199},
+        {200, 200},
+        {200, 201},
+        {201, 201},
+        {202, 202},
+        {202, 203},
+        {203, 203},
+        {204, 204},
+        {204, 205},
+        {205, 205},
+        {205, 206},
+        {206, 206},
+        {206, 207},
+        {207, 207},
+        {208, 208},
+        {208, 209},
+        {209, 209},
+        {209, 210},
+        {210, 210},
+        {210, 211},
+        {211, 211},
+        {212, 212},
+        {212, 213},
+        {213, 213},
+        {213, 214},
+        {214, 214},
+        {214, 215},
+        {215, 215},
+        {216, 216},
+        {216, 217},
+        {217, 217},
+        {217, 218},
+        {218, 218},
+        {218, 219},
+        {219, 219},
+        {220, 220},
+        {221, 221},
+        {222, 222},
+        {223, 223},
+        {224, 224},
+        {225, 225},
+        {226, 226},
+        {227, 227},
+        {228, 228},
+        {229, 229},
+        {230, 230},
+        {230, 231},
+        {231, 231},
+        {231, 232},
+        {232, 232},
+        {233, 233},
+        {233, 234},
+        {234, 234},
+        {234, 235},
+        {235, 235},
+        {236, 236},
+        {236, 237},
+        {237, 237},
+        {237, 238},
+        {238, 238},
+        {239, 239},
+        {239, 240},
+        {240, 240},
+        {240, 241},
+        {241, 241},
+        {242, 242},
+        {242, 243},
+        {243, 243},
+        {243, 244},
+        {244, 244},
+        {245, 245},
+        {245, 246},
+        {246, 246},
+        {246, 247},
+        {247, 247},
+        {248, 248},
+        {248, 249},
+        {249, 249},
+        {250, 250},
+        {250, 251},
+        {251, 251},
+        {252, 252},
+        {252, 253},
+        {253, 253},
+        {254, 254},
+        {254, 255},
+        {255, 255},
+        {256, 256}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return -1;
+          case 2: return 1/(-1 - 2*S(ss1));
+          case 3: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 4: return -1;
+          case 5: return 1/(-1 - 2*S(ss1));
+          case 6: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 7: return -1;
+          case 8: return 1/(-1 - 2*S(ss1));
+          case 9: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 10: return -1;
+          case 11: return 1/(-1 - 2*S(ss1));
+          case 12: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 13: return 1;
+          case 14: return 1;
+          case 15: return 1;
+          case 16: return 1;
+          case 17: return 1;
+          case 18: return 1;
+          case 19: return 1;
+          case 20: return 1;
+          case 21: return 1;
+          case 22: return 1;
+          case 23: return 1;
+          case 24: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 25: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 26: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 27: return ((3 + 2*S(ss1))*sqrt((S(ss1)*(1 + S(ss1)))/(3 + 4*S(ss1)*(2 + S(ss1)))))/(1 + S(ss1));
+          case 28: return 1;
+          case 29: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 30: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 31: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 32: return ((3 + 2*S(ss1))*sqrt((S(ss1)*(1 + S(ss1)))/(3 + 4*S(ss1)*(2 + S(ss1)))))/(1 + S(ss1));
+          case 33: return 1;
+          case 34: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 35: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 36: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 37: return ((3 + 2*S(ss1))*sqrt((S(ss1)*(1 + S(ss1)))/(3 + 4*S(ss1)*(2 + S(ss1)))))/(1 + S(ss1));
+          case 38: return 1;
+          case 39: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 40: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 41: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 42: return ((3 + 2*S(ss1))*sqrt((S(ss1)*(1 + S(ss1)))/(3 + 4*S(ss1)*(2 + S(ss1)))))/(1 + S(ss1));
+          case 43: return 1;
+          case 44: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 45: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 46: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 47: return ((3 + 2*S(ss1))*sqrt((S(ss1)*(1 + S(ss1)))/(3 + 4*S(ss1)*(2 + S(ss1)))))/(1 + S(ss1));
+          case 48: return 1;
+          case 49: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 50: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 51: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 52: return ((3 + 2*S(ss1))*sqrt((S(ss1)*(1 + S(ss1)))/(3 + 4*S(ss1)*(2 + S(ss1)))))/(1 + S(ss1));
+          case 53: return -1;
+          case 54: return 1/(-1 - 2*S(ss1));
+          case 55: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 56: return -1;
+          case 57: return 1/(-1 - 2*S(ss1));
+          case 58: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 59: return -1;
+          case 60: return 1/(-1 - 2*S(ss1));
+          case 61: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 62: return -1;
+          case 63: return 1/(-1 - 2*S(ss1));
+          case 64: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 65: return -1;
+          case 66: return 1/(-1 - 2*S(ss1));
+          case 67: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 68: return -1;
+          case 69: return 1/(-1 - 2*S(ss1));
+          case 70: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 71: return -1;
+          case 72: return 1/(-1 - 2*S(ss1));
+          case 73: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 74: return -1;
+          case 75: return 1/(-1 - 2*S(ss1));
+          case 76: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 77: return -1;
+          case 78: return 1/(-1 - 2*S(ss1));
+          case 79: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 80: return -1;
+          case 81: return 1/(-1 - 2*S(ss1));
+          case 82: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 83: return -1;
+          case 84: return 1/(-1 - 2*S(ss1));
+          case 85: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 86: return -1;
+          case 87: return 1/(-1 - 2*S(ss1));
+          case 88: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 89: return -1;
+          case 90: return 1/(-1 - 2*S(ss1));
+          case 91: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 92: return -1;
+          case 93: return 1/(-1 - 2*S(ss1));
+          case 94: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 95: return -1;
+          case 96: return 1/(-1 - 2*S(ss1));
+          case 97: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 98: return -1;
+          case 99: return 1/(-1 - 2*S(ss1));
+          case 100: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 101: return -1;
+          case 102: return 1/(-1 - 2*S(ss1));
+          case 103: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 104: return -1;
+          case 105: return 1/(-1 - 2*S(ss1));
+          case 106: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 107: return -1;
+          case 108: return 1/(-1 - 2*S(ss1));
+          case 109: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 110: return -1;
+          case 111: return 1/(-1 - 2*S(ss1));
+          case 112: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 113: return -1;
+          case 114: return -(sqrt(3)/sqrt(-1 + 4*Power(S(ss1),2)));
+          case 115: return (-2*(-1 + Power(S(ss1),2)))/sqrt(1 - 5*Power(S(ss1),2) + 4*Power(S(ss1),4));
+          case 116: return -2/(1 + 2*S(ss1));
+          case 117: return -(sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1)));
+          case 118: return -((sqrt(3)*(3*sqrt(S(ss1)*(1 + S(ss1))) + 5*sqrt(Power(S(ss1),3)*(1 + S(ss1))) + 2*sqrt(Power(S(ss1),5)*(1 + S(ss1)))))/sqrt(S(ss1)*(1 + 2*S(ss1))*Power(3 + 5*S(ss1) + 2*Power(S(ss1),2),3)));
+          case 119: return -2*(2 + S(ss1))*sqrt(S(ss1)/(6 + 19*S(ss1) + 16*Power(S(ss1),2) + 4*Power(S(ss1),3)));
+          case 120: return -1;
+          case 121: return -(sqrt(3)/sqrt(-1 + 4*Power(S(ss1),2)));
+          case 122: return (-2*(-1 + Power(S(ss1),2)))/sqrt(1 - 5*Power(S(ss1),2) + 4*Power(S(ss1),4));
+          case 123: return -2/(1 + 2*S(ss1));
+          case 124: return -(sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1)));
+          case 125: return -((sqrt(3)*(3*sqrt(S(ss1)*(1 + S(ss1))) + 5*sqrt(Power(S(ss1),3)*(1 + S(ss1))) + 2*sqrt(Power(S(ss1),5)*(1 + S(ss1)))))/sqrt(S(ss1)*(1 + 2*S(ss1))*Power(3 + 5*S(ss1) + 2*Power(S(ss1),2),3)));
+          case 126: return -2*(2 + S(ss1))*sqrt(S(ss1)/(6 + 19*S(ss1) + 16*Power(S(ss1),2) + 4*Power(S(ss1),3)));
+          case 127: return -1;
+          case 128: return -(sqrt(3)/sqrt(-1 + 4*Power(S(ss1),2)));
+          case 129: return (-2*(-1 + Power(S(ss1),2)))/sqrt(1 - 5*Power(S(ss1),2) + 4*Power(S(ss1),4));
+          case 130: return -2/(1 + 2*S(ss1));
+          case 131: return -(sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1)));
+          case 132: return -((sqrt(3)*(3*sqrt(S(ss1)*(1 + S(ss1))) + 5*sqrt(Power(S(ss1),3)*(1 + S(ss1))) + 2*sqrt(Power(S(ss1),5)*(1 + S(ss1)))))/sqrt(S(ss1)*(1 + 2*S(ss1))*Power(3 + 5*S(ss1) + 2*Power(S(ss1),2),3)));
+          case 133: return -2*(2 + S(ss1))*sqrt(S(ss1)/(6 + 19*S(ss1) + 16*Power(S(ss1),2) + 4*Power(S(ss1),3)));
+          case 134: return -1;
+          case 135: return -(sqrt(3)/sqrt(-1 + 4*Power(S(ss1),2)));
+          case 136: return (-2*(-1 + Power(S(ss1),2)))/sqrt(1 - 5*Power(S(ss1),2) + 4*Power(S(ss1),4));
+          case 137: return -2/(1 + 2*S(ss1));
+          case 138: return -(sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1)));
+          case 139: return -((sqrt(3)*(3*sqrt(S(ss1)*(1 + S(ss1))) + 5*sqrt(Power(S(ss1),3)*(1 + S(ss1))) + 2*sqrt(Power(S(ss1),5)*(1 + S(ss1)))))/sqrt(S(ss1)*(1 + 2*S(ss1))*Power(3 + 5*S(ss1) + 2*Power(S(ss1),2),3)));
+          case 140: return -2*(2 + S(ss1))*sqrt(S(ss1)/(6 + 19*S(ss1) + 16*Power(S(ss1),2) + 4*Power(S(ss1),3)));
+          case 141: return 1;
+          case 142: return 1;
+          case 143: return 1;
+          case 144: return 1;
+          case 145: return 1;
+          case 146: return 1;
+          case 147: return 1;
+          case 148: return 1;
+          case 149: return 1;
+          case 150: return 1;
+          case 151: return 1;
+          case 152: return 1;
+          case 153: return 1;
+          case 154: return 1;
+          case 155: return 1;
+          case 156: return 1;
+          case 157: return 1;
+          case 158: return 1;
+          case 159: return 1;
+          case 160: return 1;
+          case 161: return 1;
+          case 162: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 163: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 164: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 165: return ((3 + 2*S(ss1))*sqrt((S(ss1)*(1 + S(ss1)))/(3 + 4*S(ss1)*(2 + S(ss1)))))/(1 + S(ss1));
+          case 166: return 1;
+          case 167: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 168: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 169: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 170: return ((3 + 2*S(ss1))*sqrt((S(ss1)*(1 + S(ss1)))/(3 + 4*S(ss1)*(2 + S(ss1)))))/(1 + S(ss1));
+          case 171: return 1;
+          case 172: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 173: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 174: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 175: return ((3 + 2*S(ss1))*sqrt((S(ss1)*(1 + S(ss1)))/(3 + 4*S(ss1)*(2 + S(ss1)))))/(1 + S(ss1));
+          case 176: return 1;
+          case 177: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 178: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 179: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 180: return ((3 + 2*S(ss1))*sqrt((S(ss1)*(1 + S(ss1)))/(3 + 4*S(ss1)*(2 + S(ss1)))))/(1 + S(ss1));
+          case 181: return 1;
+          case 182: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 183: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 184: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 185: return ((3 + 2*S(ss1))*sqrt((S(ss1)*(1 + S(ss1)))/(3 + 4*S(ss1)*(2 + S(ss1)))))/(1 + S(ss1));
+          case 186: return 1;
+          case 187: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 188: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 189: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 190: return ((3 + 2*S(ss1))*sqrt((S(ss1)*(1 + S(ss1)))/(3 + 4*S(ss1)*(2 + S(ss1)))))/(1 + S(ss1));
+          case 191: return 1;
+          case 192: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 193: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 194: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 195: return ((3 + 2*S(ss1))*sqrt((S(ss1)*(1 + S(ss1)))/(3 + 4*S(ss1)*(2 + S(ss1)))))/(1 + S(ss1));
+          case 196: return 1;
+          case 197: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 198: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 199: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 200: return ((3 + 2*S(ss1))*sqrt((S(ss1)*(1 + S(ss1)))/(3 + 4*S(ss1)*(2 + S(ss1)))))/(1 + S(ss1));
+          case 201: return 1;
+          case 202: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 203: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 204: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 205: return ((3 + 2*S(ss1))*sqrt((S(ss1)*(1 + S(ss1)))/(3 + 4*S(ss1)*(2 + S(ss1)))))/(1 + S(ss1));
+          case 206: return 1;
+          case 207: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 208: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 209: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 210: return ((3 + 2*S(ss1))*sqrt((S(ss1)*(1 + S(ss1)))/(3 + 4*S(ss1)*(2 + S(ss1)))))/(1 + S(ss1));
+          case 211: return 1;
+          case 212: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 213: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 214: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 215: return ((3 + 2*S(ss1))*sqrt((S(ss1)*(1 + S(ss1)))/(3 + 4*S(ss1)*(2 + S(ss1)))))/(1 + S(ss1));
+          case 216: return 1;
+          case 217: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 218: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 219: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 220: return ((3 + 2*S(ss1))*sqrt((S(ss1)*(1 + S(ss1)))/(3 + 4*S(ss1)*(2 + S(ss1)))))/(1 + S(ss1));
+          case 221: return 1;
+          case 222: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 223: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 224: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 225: return ((3 + 2*S(ss1))*sqrt((S(ss1)*(1 + S(ss1)))/(3 + 4*S(ss1)*(2 + S(ss1)))))/(1 + S(ss1));
+          case 226: return 1;
+          case 227: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 228: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 229: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 230: return ((3 + 2*S(ss1))*sqrt((S(ss1)*(1 + S(ss1)))/(3 + 4*S(ss1)*(2 + S(ss1)))))/(1 + S(ss1));
+          case 231: return 1;
+          case 232: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 233: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 234: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 235: return ((3 + 2*S(ss1))*sqrt((S(ss1)*(1 + S(ss1)))/(3 + 4*S(ss1)*(2 + S(ss1)))))/(1 + S(ss1));
+          case 236: return 1;
+          case 237: return sqrt(2)/sqrt((-1 + S(ss1))*(1 + 2*S(ss1)));
+          case 238: return ((1 + S(ss1))*(-3 + 2*S(ss1)))/sqrt((-1 + S(ss1))*(1 + S(ss1))*(-3 + 2*S(ss1))*(1 + 2*S(ss1)));
+          case 239: return sqrt(3)/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 240: return ((-1 + S(ss1))*(3 + 2*S(ss1)))/sqrt((-1 + S(ss1))*S(ss1)*(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 241: return sqrt(3)/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 242: return ((2 + S(ss1))*(-1 + 2*S(ss1)))/sqrt((1 + S(ss1))*(2 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1)));
+          case 243: return (sqrt(2)*(6*sqrt(S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1))) + 12*S(ss1)*sqrt(S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1))) + 6*sqrt(Power(S(ss1),5)*(1 + S(ss1))*(3 + 2*S(ss1))) + sqrt(Power(S(ss1),3)*Power(1 + S(ss1),3)*Power(1 + 2*S(ss1),2)*(3 + 2*S(ss1)))))/sqrt(S(ss1)*Power(1 + S(ss1),3)*Power(2 + S(ss1),3)*(1 + 2*S(ss1))*Power(3 + 2*S(ss1),3));
+          case 244: return ((5 + 2*S(ss1))*sqrt((S(ss1)*(2 + S(ss1)))/(5 + 12*S(ss1) + 4*Power(S(ss1),2))))/(2 + S(ss1));
+          case 245: return -1;
+          case 246: return 1/(-1 - 2*S(ss1));
+          case 247: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 248: return -1;
+          case 249: return 1/(-1 - 2*S(ss1));
+          case 250: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 251: return -1;
+          case 252: return 1/(-1 - 2*S(ss1));
+          case 253: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 254: return -1;
+          case 255: return 1/(-1 - 2*S(ss1));
+          case 256: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 257: return -1;
+          case 258: return 1/(-1 - 2*S(ss1));
+          case 259: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 260: return -1;
+          case 261: return 1/(-1 - 2*S(ss1));
+          case 262: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 263: return -1;
+          case 264: return 1/(-1 - 2*S(ss1));
+          case 265: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 266: return -1;
+          case 267: return 1/(-1 - 2*S(ss1));
+          case 268: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 269: return -1;
+          case 270: return 1/(-1 - 2*S(ss1));
+          case 271: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 272: return -1;
+          case 273: return 1/(-1 - 2*S(ss1));
+          case 274: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 275: return -1;
+          case 276: return 1/(-1 - 2*S(ss1));
+          case 277: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 278: return -1;
+          case 279: return 1/(-1 - 2*S(ss1));
+          case 280: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 281: return -1;
+          case 282: return 1/(-1 - 2*S(ss1));
+          case 283: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 284: return -1;
+          case 285: return 1/(-1 - 2*S(ss1));
+          case 286: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 287: return -1;
+          case 288: return 1/(-1 - 2*S(ss1));
+          case 289: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 290: return -1;
+          case 291: return 1/(-1 - 2*S(ss1));
+          case 292: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 293: return -1;
+          case 294: return 1/(-1 - 2*S(ss1));
+          case 295: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 296: return -1;
+          case 297: return 1/(-1 - 2*S(ss1));
+          case 298: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 299: return -1;
+          case 300: return 1/(-1 - 2*S(ss1));
+          case 301: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 302: return -1;
+          case 303: return 1/(-1 - 2*S(ss1));
+          case 304: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 305: return -1;
+          case 306: return -(sqrt(3)/sqrt(-1 + 4*Power(S(ss1),2)));
+          case 307: return (-2*(-1 + Power(S(ss1),2)))/sqrt(1 - 5*Power(S(ss1),2) + 4*Power(S(ss1),4));
+          case 308: return -2/(1 + 2*S(ss1));
+          case 309: return -(sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1)));
+          case 310: return -((sqrt(3)*(3*sqrt(S(ss1)*(1 + S(ss1))) + 5*sqrt(Power(S(ss1),3)*(1 + S(ss1))) + 2*sqrt(Power(S(ss1),5)*(1 + S(ss1)))))/sqrt(S(ss1)*(1 + 2*S(ss1))*Power(3 + 5*S(ss1) + 2*Power(S(ss1),2),3)));
+          case 311: return -2*(2 + S(ss1))*sqrt(S(ss1)/(6 + 19*S(ss1) + 16*Power(S(ss1),2) + 4*Power(S(ss1),3)));
+          case 312: return -1;
+          case 313: return -(sqrt(3)/sqrt(-1 + 4*Power(S(ss1),2)));
+          case 314: return (-2*(-1 + Power(S(ss1),2)))/sqrt(1 - 5*Power(S(ss1),2) + 4*Power(S(ss1),4));
+          case 315: return -2/(1 + 2*S(ss1));
+          case 316: return -(sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1)));
+          case 317: return -((sqrt(3)*(3*sqrt(S(ss1)*(1 + S(ss1))) + 5*sqrt(Power(S(ss1),3)*(1 + S(ss1))) + 2*sqrt(Power(S(ss1),5)*(1 + S(ss1)))))/sqrt(S(ss1)*(1 + 2*S(ss1))*Power(3 + 5*S(ss1) + 2*Power(S(ss1),2),3)));
+          case 318: return -2*(2 + S(ss1))*sqrt(S(ss1)/(6 + 19*S(ss1) + 16*Power(S(ss1),2) + 4*Power(S(ss1),3)));
+          case 319: return -1;
+          case 320: return -(sqrt(3)/sqrt(-1 + 4*Power(S(ss1),2)));
+          case 321: return (-2*(-1 + Power(S(ss1),2)))/sqrt(1 - 5*Power(S(ss1),2) + 4*Power(S(ss1),4));
+          case 322: return -2/(1 + 2*S(ss1));
+          case 323: return -(sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1)));
+          case 324: return -((sqrt(3)*(3*sqrt(S(ss1)*(1 + S(ss1))) + 5*sqrt(Power(S(ss1),3)*(1 + S(ss1))) + 2*sqrt(Power(S(ss1),5)*(1 + S(ss1)))))/sqrt(S(ss1)*(1 + 2*S(ss1))*Power(3 + 5*S(ss1) + 2*Power(S(ss1),2),3)));
+          case 325: return -2*(2 + S(ss1))*sqrt(S(ss1)/(6 + 19*S(ss1) + 16*Power(S(ss1),2) + 4*Power(S(ss1),3)));
+          case 326: return -1;
+          case 327: return -(sqrt(3)/sqrt(-1 + 4*Power(S(ss1),2)));
+          case 328: return (-2*(-1 + Power(S(ss1),2)))/sqrt(1 - 5*Power(S(ss1),2) + 4*Power(S(ss1),4));
+          case 329: return -2/(1 + 2*S(ss1));
+          case 330: return -(sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1)));
+          case 331: return -((sqrt(3)*(3*sqrt(S(ss1)*(1 + S(ss1))) + 5*sqrt(Power(S(ss1),3)*(1 + S(ss1))) + 2*sqrt(Power(S(ss1),5)*(1 + S(ss1)))))/sqrt(S(ss1)*(1 + 2*S(ss1))*Power(3 + 5*S(ss1) + 2*Power(S(ss1),2),3)));
+          case 332: return -2*(2 + S(ss1))*sqrt(S(ss1)/(6 + 19*S(ss1) + 16*Power(S(ss1),2) + 4*Power(S(ss1),3)));
+          case 333: return 1;
+          case 334: return 1;
+          case 335: return 1;
+          case 336: return 1;
+          case 337: return 1;
+          case 338: return 1;
+          case 339: return 1;
+          case 340: return 1;
+          case 341: return 1;
+          case 342: return 1;
+          case 343: return 1;
+          case 344: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 345: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 346: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 347: return ((3 + 2*S(ss1))*sqrt((S(ss1)*(1 + S(ss1)))/(3 + 4*S(ss1)*(2 + S(ss1)))))/(1 + S(ss1));
+          case 348: return 1;
+          case 349: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 350: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 351: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 352: return ((3 + 2*S(ss1))*sqrt((S(ss1)*(1 + S(ss1)))/(3 + 4*S(ss1)*(2 + S(ss1)))))/(1 + S(ss1));
+          case 353: return 1;
+          case 354: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 355: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 356: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 357: return ((3 + 2*S(ss1))*sqrt((S(ss1)*(1 + S(ss1)))/(3 + 4*S(ss1)*(2 + S(ss1)))))/(1 + S(ss1));
+          case 358: return 1;
+          case 359: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 360: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 361: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 362: return ((3 + 2*S(ss1))*sqrt((S(ss1)*(1 + S(ss1)))/(3 + 4*S(ss1)*(2 + S(ss1)))))/(1 + S(ss1));
+          case 363: return 1;
+          case 364: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 365: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 366: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 367: return ((3 + 2*S(ss1))*sqrt((S(ss1)*(1 + S(ss1)))/(3 + 4*S(ss1)*(2 + S(ss1)))))/(1 + S(ss1));
+          case 368: return 1;
+          case 369: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 370: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 371: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 372: return ((3 + 2*S(ss1))*sqrt((S(ss1)*(1 + S(ss1)))/(3 + 4*S(ss1)*(2 + S(ss1)))))/(1 + S(ss1));
+          case 373: return -1;
+          case 374: return 1/(-1 - 2*S(ss1));
+          case 375: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 376: return -1;
+          case 377: return 1/(-1 - 2*S(ss1));
+          case 378: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 379: return -1;
+          case 380: return 1/(-1 - 2*S(ss1));
+          case 381: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 382: return -1;
+          case 383: return 1/(-1 - 2*S(ss1));
+          case 384: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 385: return 1;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(1, 2));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(1, 2));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -163,10 +2220,24 @@ MatrixElements<SC> SymmetryQS<SC>::recalc_doublet(const DiagInfo<SC> &diag, cons
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "qs/qs-1ch-doubletp.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 2},
+        {3, 3},
+        {4, 4}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 2: return 1/(1 + 2*S(ss1));
+          case 3: return -1;
+          case 4: return 1;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(1, 2));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(1, 2));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -178,10 +2249,24 @@ MatrixElements<SC> SymmetryQS<SC>::recalc_doublet(const DiagInfo<SC> &diag, cons
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "qs/qs-1ch-doubletm.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {2, 3},
+        {3, 3},
+        {4, 4}
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(1, 2));
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return -1;
+          case 2: return 1/(-1 - 2*S(ss1));
+          case 3: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 4: return 1;
+          default: my_assert_not_reached();
+        }
+      };
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(1, 2));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -506,6 +2591,7 @@ OpchChannel<SC> SymmetryQS<SC>::recalc_irreduc_substeps(const Step &step, const
 template<typename SC>
 MatrixElements<SC> SymmetryQS<SC>::recalc_triplet(const DiagInfo<SC> &diag, const SubspaceStructure &substruct, const MatrixElements<SC> &cold) const {
   MatrixElements<SC> cnew;
+  const auto blocks = std::make_shared<const BlockIndex<SC>>(cold, substruct);
   if (!P.substeps) {
     for(const auto &[I1, eig]: diag) {
       int q1 = I1.get("Q");
@@ -519,10 +2605,26 @@ MatrixElements<SC> SymmetryQS<SC>::recalc_triplet(const DiagInfo<SC> &diag, cons
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "qs/qs-1ch-triplets.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {2, 3},
+        {3, 2},
+        {3, 3},
+        {4, 4}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 2: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 3: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 4: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 5: return 1;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(0, 3));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(0, 3));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -532,10 +2634,70 @@ MatrixElements<SC> SymmetryQS<SC>::recalc_triplet(const DiagInfo<SC> &diag, cons
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "qs/qs-2ch-triplets.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {2, 3},
+        {3, 2},
+        {3, 3},
+        {4, 4},
+        {4, 5},
+        {5, 4},
+        {5, 5},
+        {6, 6},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {9, 10},
+        {10, 9},
+        {10, 10},
+        {10, 11},
+        {11, 10},
+        {11, 11},
+        {12, 12},
+        {12, 13},
+        {13, 12},
+        {13, 13},
+        {14, 14},
+        {14, 15},
+        {15, 14},
+        {15, 15},
+        {16, 16}
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(0, 3));
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 2: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 3: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 4: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 5: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 6: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 7: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 8: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 9: return 1;
+          case 10: return 1;
+          case 11: return 1;
+          case 12: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 13: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 14: return -(1/S(ss1));
+          case 15: return 1 - 1/S(ss1) + 1/(1 + S(ss1));
+          case 16: return 1/(1 + S(ss1));
+          case 17: return -(sqrt(3 + 4*S(ss1)*(2 + S(ss1)))/((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 18: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 19: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 20: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 21: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 22: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 23: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 24: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 25: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 26: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 27: return 1;
+          default: my_assert_not_reached();
+        }
+      };
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(0, 3));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -545,10 +2707,258 @@ MatrixElements<SC> SymmetryQS<SC>::recalc_triplet(const DiagInfo<SC> &diag, cons
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "qs/qs-3ch-triplets.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {2, 3},
+        {3, 2},
+        {3, 3},
+        {4, 4},
+        {4, 5},
+        {5, 4},
+        {5, 5},
+        {6, 6},
+        {6, 7},
+        {7, 6},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {10, 10},
+        {11, 11},
+        {12, 12},
+        {13, 13},
+        {14, 14},
+        {14, 15},
+        {15, 14},
+        {15, 15},
+        {15, 16},
+        {16, 15},
+        {16, 16},
+        {17, 17},
+        {17, 18},
+        {18, 17},
+        {18, 18},
+        {18, 19},
+        {19, 18},
+        {19, 19},
+        {20, 20},
+        {20, 21},
+        {21, 20},
+        {21, 21},
+        {21, 22},
+        {22, 21},
+        {22, 22},
+        {23, 23},
+        {23, 24},
+        {24, 23},
+        {24, 24},
+        {25, 25},
+        {25, 26},
+        {26, 25},
+        {26, 26},
+        {27, 27},
+        {27, 28},
+        {28, 27},
+        {28, 28},
+        {29, 29},
+        {29, 30},
+        {30, 29},
+        {30, 30},
+        {31, 31},
+        {31, 32},
+        {32, 31},
+        {32, 32},
+        {33, 33},
+        {33, 34},
+        {34, 33},
+        {34, 34},
+        {35, 35},
+        {35, 36},
+        {36, 35},
+        {36, 36},
+        {37, 37},
+        {37, 38},
+        {38, 37},
+        {38, 38},
+        {39, 39},
+        {39, 40},
+        {40, 39},
+        {40, 40},
+        {40, 41},
+        {41, 40},
+        {41, 41},
+        {41, 42},
+        {42, 41},
+        {42, 42},
+        {43, 43},
+        {44, 44},
+        {45, 45},
+        {46, 46},
+        {47, 47},
+        {48, 48},
+        {49, 49},
+        {49, 50},
+        {50, 49},
+        {50, 50},
+        {50, 51},
+        {51, 50},
+        {51, 51},
+        {52, 52},
+        {52, 53},
+        {53, 52},
+        {53, 53},
+        {53, 54},
+        {54, 53},
+        {54, 54},
+        {55, 55},
+        {55, 56},
+        {56, 55},
+        {56, 56},
+        {56, 57},
+        {57, 56},
+        {57, 57},
+        {58, 58},
+        {58, 59},
+        {59, 58},
+        {59, 59},
+        {60, 60},
+        {60, 61},
+        {61, 60},
+        {61, 61},
+        {62, 62},
+        {62, 63},
+        {63, 62},
+        {63, 63},
+        {64, 64}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 2: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 3: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 4: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 5: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 6: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 7: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 8: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 9: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 10: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 11: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 12: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 13: return 1;
+          case 14: return 1;
+          case 15: return 1;
+          case 16: return 1;
+          case 17: return 1;
+          case 18: return 1;
+          case 19: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 20: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 21: return -(1/S(ss1));
+          case 22: return 1 - 1/S(ss1) + 1/(1 + S(ss1));
+          case 23: return 1/(1 + S(ss1));
+          case 24: return -(sqrt(3 + 4*S(ss1)*(2 + S(ss1)))/((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 25: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 26: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 27: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 28: return -(1/S(ss1));
+          case 29: return 1 - 1/S(ss1) + 1/(1 + S(ss1));
+          case 30: return 1/(1 + S(ss1));
+          case 31: return -(sqrt(3 + 4*S(ss1)*(2 + S(ss1)))/((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 32: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 33: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 34: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 35: return -(1/S(ss1));
+          case 36: return 1 - 1/S(ss1) + 1/(1 + S(ss1));
+          case 37: return 1/(1 + S(ss1));
+          case 38: return -(sqrt(3 + 4*S(ss1)*(2 + S(ss1)))/((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 39: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 40: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 41: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 42: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 43: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 44: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 45: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 46: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 47: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 48: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 49: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 50: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 51: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 52: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 53: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 54: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 55: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 56: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 57: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 58: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 59: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 60: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 61: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 62: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 63: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 64: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 65: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 66: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 67: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 68: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 69: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 70: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 71: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 72: return sqrt(1 + 6/(1 - 2*S(ss1)) + 3/S(ss1));
+          case 73: return (sqrt(3)*sqrt((-1 + S(ss1))/(-1 + 2*S(ss1))))/S(ss1);
+          case 74: return -(sqrt(3)/sqrt(S(ss1)*(-1 + 2*S(ss1))));
+          case 75: return (-4 + S(ss1) + 2*Power(S(ss1),2))/sqrt(S(ss1)*(1 + S(ss1))*(-1 + 4*Power(S(ss1),2)));
+          case 76: return (3*sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(-1 + 4*Power(S(ss1),2))) - 10*S(ss1)*sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(-1 + 4*Power(S(ss1),2))) + 8*Power(S(ss1),2)*sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(-1 + 4*Power(S(ss1),2))) + 9*(1 + S(ss1))*sqrt((S(ss1)*(-3 + 4*S(ss1)*(1 + S(ss1))))/((1 + S(ss1))*(1 + 2*S(ss1)))))/(2.*S(ss1)*Power(1 + S(ss1),1.5)*(3 + 2*S(ss1)));
+          case 77: return (-5*sqrt((Power(S(ss1),3)*(3 + 2*S(ss1)))/(1 + 2*S(ss1))) - 4*sqrt((Power(S(ss1),5)*(3 + 2*S(ss1)))/(1 + 2*S(ss1))) + 4*sqrt((Power(S(ss1),7)*(3 + 2*S(ss1)))/(1 + 2*S(ss1))) + sqrt(Power(S(ss1),3)*(3 + 4*S(ss1)*(2 + S(ss1)))) - 2*sqrt(Power(S(ss1),5)*(3 + 4*S(ss1)*(2 + S(ss1)))) + 3*sqrt(S(ss1) + (2*S(ss1))/(1 + 2*S(ss1))))/(S(ss1)*(3 + 2*S(ss1))*sqrt(S(ss1)*(-1 + S(ss1) + 2*Power(S(ss1),2))));
+          case 78: return (-3 + S(ss1)*(3 + 2*S(ss1)))/sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 79: return sqrt(3)/sqrt((1 + S(ss1))*(3 + 2*S(ss1)));
+          case 80: return -0.5*(sqrt(-9 + 6*S(ss1) + 15/(2 + S(ss1)))*(-3*sqrt(-3 + S(ss1) + 4*Power(S(ss1),2)*(2 + S(ss1))) + 9*sqrt(3 + S(ss1) + 6/(-1 + 2*S(ss1))) + 4*S(ss1)*(5 + S(ss1))*sqrt(3 + S(ss1) + 6/(-1 + 2*S(ss1)))))/(Power(1 + S(ss1),2)*Power(3 + 2*S(ss1),2));
+          case 81: return (5 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 2*S(ss1))*(5 + 2*S(ss1)))/S(ss1));
+          case 82: return 1;
+          case 83: return 1;
+          case 84: return 1;
+          case 85: return 1;
+          case 86: return 1;
+          case 87: return 1;
+          case 88: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 89: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 90: return -(1/S(ss1));
+          case 91: return 1 - 1/S(ss1) + 1/(1 + S(ss1));
+          case 92: return 1/(1 + S(ss1));
+          case 93: return -(sqrt(3 + 4*S(ss1)*(2 + S(ss1)))/((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 94: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 95: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 96: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 97: return -(1/S(ss1));
+          case 98: return 1 - 1/S(ss1) + 1/(1 + S(ss1));
+          case 99: return 1/(1 + S(ss1));
+          case 100: return -(sqrt(3 + 4*S(ss1)*(2 + S(ss1)))/((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 101: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 102: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 103: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 104: return -(1/S(ss1));
+          case 105: return 1 - 1/S(ss1) + 1/(1 + S(ss1));
+          case 106: return 1/(1 + S(ss1));
+          case 107: return -(sqrt(3 + 4*S(ss1)*(2 + S(ss1)))/((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 108: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 109: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 110: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 111: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 112: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 113: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 114: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 115: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 116: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 117: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 118: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 119: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 120: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 121: return 1;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(0, 3));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(0, 3));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -558,10 +2968,1046 @@ MatrixElements<SC> SymmetryQS<SC>::recalc_triplet(const DiagInfo<SC> &diag, cons
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "qs/qs-4ch-triplets.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {2, 3},
+        {3, 2},
+        {3, 3},
+        {4, 4},
+        {4, 5},
+        {5, 4},
+        {5, 5},
+        {6, 6},
+        {6, 7},
+        {7, 6},
+        {7, 7},
+        {8, 8},
+        {8, 9},
+        {9, 8},
+        {9, 9},
+        {10, 10},
+        {11, 11},
+        {12, 12},
+        {13, 13},
+        {14, 14},
+        {15, 15},
+        {16, 16},
+        {17, 17},
+        {18, 18},
+        {19, 19},
+        {20, 20},
+        {20, 21},
+        {21, 20},
+        {21, 21},
+        {21, 22},
+        {22, 21},
+        {22, 22},
+        {23, 23},
+        {23, 24},
+        {24, 23},
+        {24, 24},
+        {24, 25},
+        {25, 24},
+        {25, 25},
+        {26, 26},
+        {26, 27},
+        {27, 26},
+        {27, 27},
+        {27, 28},
+        {28, 27},
+        {28, 28},
+        {29, 29},
+        {29, 30},
+        {30, 29},
+        {30, 30},
+        {30, 31},
+        {31, 30},
+        {31, 31},
+        {32, 32},
+        {32, 33},
+        {33, 32},
+        {33, 33},
+        {33, 34},
+        {34, 33},
+        {34, 34},
+        {35, 35},
+        {35, 36},
+        {36, 35},
+        {36, 36},
+        {36, 37},
+        {37, 36},
+        {37, 37},
+        {38, 38},
+        {38, 39},
+        {39, 38},
+        {39, 39},
+        {40, 40},
+        {40, 41},
+        {41, 40},
+        {41, 41},
+        {42, 42},
+        {42, 43},
+        {43, 42},
+        {43, 43},
+        {44, 44},
+        {44, 45},
+        {45, 44},
+        {45, 45},
+        {46, 46},
+        {46, 47},
+        {47, 46},
+        {47, 47},
+        {48, 48},
+        {48, 49},
+        {49, 48},
+        {49, 49},
+        {50, 50},
+        {50, 51},
+        {51, 50},
+        {51, 51},
+        {52, 52},
+        {52, 53},
+        {53, 52},
+        {53, 53},
+        {54, 54},
+        {54, 55},
+        {55, 54},
+        {55, 55},
+        {56, 56},
+        {56, 57},
+        {57, 56},
+        {57, 57},
+        {58, 58},
+        {58, 59},
+        {59, 58},
+        {59, 59},
+        {60, 60},
+        {60, 61},
+        {61, 60},
+        {61, 61},
+        {62, 62},
+        {62, 63},
+        {63, 62},
+        {63, 63},
+        {64, 64},
+        {64, 65},
+        {65, 64},
+        {65, 65},
+        {66, 66},
+        {66, 67},
+        {67, 66},
+        {67, 67},
+        {68, 68},
+        {68, 69},
+        {69, 68},
+        {69, 69},
+        {70, 70},
+        {70, 71},
+        {71, 70},
+        {71, 71},
+        {72, 72},
+        {72, 73},
+        {73, 72},
+        {73, 73},
+        {74, 74},
+        {74, 75},
+        {75, 74},
+        {75, 75},
+        {76, 76},
+        {76, 77},
+        {77, 76},
+        {77, 77},
+        {78, 78},
+        {78, 79},
+        {79, 78},
+        {79, 79},
+        {79, 80},
+        {80, 79},
+        {80, 80},
+        {80, 81},
+        {81, 80},
+        {81, 81},
+        {82, 82},
+        {82, 83},
+        {83, 82},
+        {83, 83},
+        {83, 84},
+        {84, 83},
+        {84, 84},
+        {84, 85},
+        {85, 84},
+        {85, 85},
+        {86, 86},
+        {86, 87},
+        {87, 86},
+        {87, 87},
+        {87, 88},
+        {88, 87},
+        {88, 88},
+        {88, 89},
+        {89, 88},
+        {89, 89},
+        {90, 90},
+        {90, 91},
+        {91, 90},
+        {91, 91},
+        {91, 92},
+        {92, 91},
+        {92, 92},
+        {92, 93},
+        {93, 92},
+        {93, 93},
+        {94, 94},
+        {95, 95},
+        {96, 96},
+        {97, 97},
+        {98, 98},
+        {99, 99},
+        {100, 100},
+        {101, 101},
+        {102, 102},
+        {103, 103},
+        {104, 104},
+        {105, 105},
+        {106, 106},
+        {107, 107},
+        {108, 108},
+        {109, 109},
+        {110, 110},
+        {111, 111},
+        {112, 112},
+        {113, 113},
+        {114, 114},
+        {114, 115},
+        {115, 114},
+        {115, 115},
+        {115, 116},
+        {116, 115},
+        {116, 116},
+        {117, 117},
+        {117, 118},
+        {118, 117},
+        {118, 118},
+        {118, 119},
+        {119, 118},
+        {119, 119},
+        {120, 120},
+        {120, 121},
+        {121, 120},
+        {121, 121},
+        {121, 122},
+        {122, 121},
+        {122, 122},
+        {123, 123},
+        {123, 124},
+        {124, 123},
+        {124, 124},
+        {124, 125},
+        {125, 124},
+        {125, 125},
+        {126, 126},
+        {126, 127},
+        {127, 126},
+        {127, 127},
+        {127, 128},
+        {128, 127},
+        {128, 128},
+        {129, 129},
+        {129, 130},
+        {130, 129},
+        {130, 130},
+        {130, 131},
+        {131, 130},
+        {131, 131},
+        {132, 132},
+        {132, 133},
+        {133, 132},
+        {133, 133},
+        {133, 134},
+        {134, 133},
+        {134, 134},
+        {135, 135},
+        {135, 136},
+        {136, 135},
+        {136, 136},
+        {136, 137},
+        {137, 136},
+        {137, 137},
+        {138, 138},
+        {138, 139},
+        {139, 138},
+        {139, 139},
+        {139, 140},
+        {140, 139},
+        {140, 140},
+        {141, 141},
+        {141, 142},
+        {142, 141},
+        {142, 142},
+        {142, 143},
+        {143, 142},
+        {143, 143},
+        {144, 144},
+        {144, 145},
+        {145, 144},
+        {145, 145},
+        {145, 146},
+        {146, 145},
+        {146, 146},
+        {147, 147},
+        {147, 148},
+        {148, 147},
+        {148, 148},
+        {148, 149},
+        {149, 148},
+        {149, 149},
+        {150, 150},
+        {150, 151},
+        {151, 150},
+        {151, 151},
+        {151, 152},
+        {152, 151},
+        {152, 152},
+        {153, 153},
+        {153, 154},
+        {154, 153},
+        {154, 154},
+        {154, 155},
+        {155, 154},
+        {155, 155},
+        {156, 156},
+        {156, 157},
+        {157, 156},
+        {157, 157},
+        {157, 158},
+        {158, 157},
+        {158, 158},
+        {159, 159},
+        {159, 160},
+        {160, 159},
+        {160, 160},
+        {160, 161},
+        {161, 160},
+        {161, 161},
+        {161, 162},
+        {162, 161},
+        {162, 162},
+        {162, 163},
+        {163, 162},
+        {163, 163},
+        {164, 164},
+        {164, 165},
+        {165, 164},
+        {165, 165},
+        {166, 166},
+        {166, 167},
+        {167, 166},
+        {167, 167},
+        {168, 168},
+        {168, 169},
+        {169, 168},
+        {169, 169},
+        {170, 170},
+        {170, 171},
+        {171, 170},
+        {171, 171},
+        {172, 172},
+        {172, 173},
+        {173, 172},
+        {173, 173},
+        {174, 174},
+        {174, 175},
+        {175, 174},
+        {175, 175},
+        {176, 176},
+        {176, 177},
+        {177, 176},
+        {177, 177},
+        {178, 178},
+        {178, 179},
+        {179, 178},
+        {179, 179},
+        {180, 180},
+        {180, 181},
+        {181, 180},
+        {181, 181},
+        {182, 182},
+        {182, 183},
+        {183, 182},
+        {183, 183},
+        {184, 184},
+        {184, 185},
+        {185, 184},
+        {185, 185},
+        {186, 186},
+        {186, 187},
+        {187, 186},
+        {187, 187},
+        {188, 188},
+        {188, 189},
+        {189, 188},
+        {189, 189},
+        {190, 190},
+        {190, 191},
+        {191, 190},
+        {191, 191},
+        {192, 192},
+        {192, 193},
+        {193, 192},
+        {193, 193},
+        {194, 194},
+        {194, 195},
+        {195, 194},
+        {195, 195},
+        {196, 196},
+        {196, 197},
+        {197, 196},
+        {197, 197},
+        {198, 198},
+        {198, 199},
+        {199, 198},
+        {199, 199},
+        {200, 200},
+        {200, 201},
+        {201, 200},
+        {201, 201},
+        {202, 202},
+        {202, 203},
+        {203, 202},
+        {203, 203},
+        {204, 204},
+        {204, 205},
+        {205, 204},
+        {205, 205},
+        {205, 206},
+        {206, 205},
+        {206, 206},
+        {206, 207},
+        {207, 206},
+        {207, 207},
+        {208, 208},
+        {208, 209},
+        {209, 208},
+        {209, 209},
+        {209, 210},
+        {210, 209},
+        {210, 210},
+        {210, 211},
+        {211, 210},
+        {211, 211},
+        {212, 212},
+        {212, 213},
+        {213, 212},
+        {213, 213},
+        {213, 214},
+        {214, 213},
+        {214, 214},
+        {214, 215},
+        {215, 214},
+        {215, 215},
+        {216, 216},
+        {216, 217},
+        {217, 216},
+        {217, 217},
+        {217, 218},
+        {218, 217},
+        {218, 218},
+        {218, 219},
+        {219, 218},
+        {219, 219},
+        {220, 220},
+        {221, 221},
+        {222, 222},
+        {223, 223},
+        {224, 224},
+        {225, 225},
+        {226, 226},
+        {227, 227},
+        {228, 228},
+        {229, 229},
+        {230, 230},
+        {230, 231},
+        {231, 230},
+        {231, 231},
+        {231, 232},
+        {232, 231},
+        {232, 232},
+        {233, 233},
+        {233, 234},
+        {234, 233},
+        {234, 234},
+        {234, 235},
+        {235, 234},
+        {235, 235},
+        {236, 236},
+        {236, 237},
+        {237, 236},
+        {237, 237},
+        {237, 238},
+        {238, 237},
+        {238, 238},
+        {239, 239},
+        {239, 240},
+        {240, 239},
+        {240, 240},
+        {240, 241},
+        {241, 240},
+        {241, 241},
+        {242, 242},
+        {242, 243},
+        {243, 242},
+        {243, 243},
+        {243, 244},
+        {244, 243},
+        {244, 244},
+        {245, 245},
+        {245, 246},
+        {246, 245},
+        {246, 246},
+        {246, 247},
+        {247, 246},
+        {247, 247},
+        {248, 248},
+        {248, 249},
+        {249, 248},
+        {249, 249},
+        {250, 250},
+        {250, 251},
+        {251, 250},
+        {251, 251},
+        {252, 252},
+        {252, 253},
+        {253, 252},
+        {253, 253},
+        {254, 254},
+        {254, 255},
+        {255, 254},
+        {255, 255},
+        {256, 256}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 2: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 3: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 4: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 5: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 6: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 7: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 8: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 9: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 10: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 11: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 12: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 13: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 14: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 15: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 16: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 17: return 1;
+          case 18: return 1;
+          case 19: return 1;
+          case 20: return 1;
+          case 21: return 1;
+          case 22: return 1;
+          case 23: return 1;
+          case 24: return 1;
+          case 25: return 1;
+          case 26: return 1;
+          case 27: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 28: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 29: return -(1/S(ss1));
+          case 30: return 1 - 1/S(ss1) + 1/(1 + S(ss1));
+          case 31: return 1/(1 + S(ss1));
+          case 32: return -(sqrt(3 + 4*S(ss1)*(2 + S(ss1)))/((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 33: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 34: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 35: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 36: return -(1/S(ss1));
+          case 37: return 1 - 1/S(ss1) + 1/(1 + S(ss1));
+          case 38: return 1/(1 + S(ss1));
+          case 39: return -(sqrt(3 + 4*S(ss1)*(2 + S(ss1)))/((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 40: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 41: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 42: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 43: return -(1/S(ss1));
+          case 44: return 1 - 1/S(ss1) + 1/(1 + S(ss1));
+          case 45: return 1/(1 + S(ss1));
+          case 46: return -(sqrt(3 + 4*S(ss1)*(2 + S(ss1)))/((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 47: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 48: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 49: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 50: return -(1/S(ss1));
+          case 51: return 1 - 1/S(ss1) + 1/(1 + S(ss1));
+          case 52: return 1/(1 + S(ss1));
+          case 53: return -(sqrt(3 + 4*S(ss1)*(2 + S(ss1)))/((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 54: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 55: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 56: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 57: return -(1/S(ss1));
+          case 58: return 1 - 1/S(ss1) + 1/(1 + S(ss1));
+          case 59: return 1/(1 + S(ss1));
+          case 60: return -(sqrt(3 + 4*S(ss1)*(2 + S(ss1)))/((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 61: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 62: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 63: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 64: return -(1/S(ss1));
+          case 65: return 1 - 1/S(ss1) + 1/(1 + S(ss1));
+          case 66: return 1/(1 + S(ss1));
+          case 67: return -(sqrt(3 + 4*S(ss1)*(2 + S(ss1)))/((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 68: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 69: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 70: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 71: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 72: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 73: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 74: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 75: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 76: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 77: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 78: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 79: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 80: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 81: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 82: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 83: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 84: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 85: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 86: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 87: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 88: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 89: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 90: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 91: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 92: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 93: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 94: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 95: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 96: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 97: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 98: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 99: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 100: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 101: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 102: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 103: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 104: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 105: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 106: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 107: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 108: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 109: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 110: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 111: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 112: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 113: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 114: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 115: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 116: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 117: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 118: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 119: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 120: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 121: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 122: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 123: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 124: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 125: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 126: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 127: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 128: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 129: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 130: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 131: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 132: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 133: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 134: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 135: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 136: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 137: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 138: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 139: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 140: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 141: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 142: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 143: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 144: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 145: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 146: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 147: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 148: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 149: return sqrt(1 + 6/(1 - 2*S(ss1)) + 3/S(ss1));
+          case 150: return (sqrt(3)*sqrt((-1 + S(ss1))/(-1 + 2*S(ss1))))/S(ss1);
+          case 151: return -(sqrt(3)/sqrt(S(ss1)*(-1 + 2*S(ss1))));
+          case 152: return (-4 + S(ss1) + 2*Power(S(ss1),2))/sqrt(S(ss1)*(1 + S(ss1))*(-1 + 4*Power(S(ss1),2)));
+          case 153: return (3*sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(-1 + 4*Power(S(ss1),2))) - 10*S(ss1)*sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(-1 + 4*Power(S(ss1),2))) + 8*Power(S(ss1),2)*sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(-1 + 4*Power(S(ss1),2))) + 9*(1 + S(ss1))*sqrt((S(ss1)*(-3 + 4*S(ss1)*(1 + S(ss1))))/((1 + S(ss1))*(1 + 2*S(ss1)))))/(2.*S(ss1)*Power(1 + S(ss1),1.5)*(3 + 2*S(ss1)));
+          case 154: return (-5*sqrt((Power(S(ss1),3)*(3 + 2*S(ss1)))/(1 + 2*S(ss1))) - 4*sqrt((Power(S(ss1),5)*(3 + 2*S(ss1)))/(1 + 2*S(ss1))) + 4*sqrt((Power(S(ss1),7)*(3 + 2*S(ss1)))/(1 + 2*S(ss1))) + sqrt(Power(S(ss1),3)*(3 + 4*S(ss1)*(2 + S(ss1)))) - 2*sqrt(Power(S(ss1),5)*(3 + 4*S(ss1)*(2 + S(ss1)))) + 3*sqrt(S(ss1) + (2*S(ss1))/(1 + 2*S(ss1))))/(S(ss1)*(3 + 2*S(ss1))*sqrt(S(ss1)*(-1 + S(ss1) + 2*Power(S(ss1),2))));
+          case 155: return (-3 + S(ss1)*(3 + 2*S(ss1)))/sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 156: return sqrt(3)/sqrt((1 + S(ss1))*(3 + 2*S(ss1)));
+          case 157: return -0.5*(sqrt(-9 + 6*S(ss1) + 15/(2 + S(ss1)))*(-3*sqrt(-3 + S(ss1) + 4*Power(S(ss1),2)*(2 + S(ss1))) + 9*sqrt(3 + S(ss1) + 6/(-1 + 2*S(ss1))) + 4*S(ss1)*(5 + S(ss1))*sqrt(3 + S(ss1) + 6/(-1 + 2*S(ss1)))))/(Power(1 + S(ss1),2)*Power(3 + 2*S(ss1),2));
+          case 158: return (5 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 2*S(ss1))*(5 + 2*S(ss1)))/S(ss1));
+          case 159: return sqrt(1 + 6/(1 - 2*S(ss1)) + 3/S(ss1));
+          case 160: return (sqrt(3)*sqrt((-1 + S(ss1))/(-1 + 2*S(ss1))))/S(ss1);
+          case 161: return -(sqrt(3)/sqrt(S(ss1)*(-1 + 2*S(ss1))));
+          case 162: return (-4 + S(ss1) + 2*Power(S(ss1),2))/sqrt(S(ss1)*(1 + S(ss1))*(-1 + 4*Power(S(ss1),2)));
+          case 163: return (3*sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(-1 + 4*Power(S(ss1),2))) - 10*S(ss1)*sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(-1 + 4*Power(S(ss1),2))) + 8*Power(S(ss1),2)*sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(-1 + 4*Power(S(ss1),2))) + 9*(1 + S(ss1))*sqrt((S(ss1)*(-3 + 4*S(ss1)*(1 + S(ss1))))/((1 + S(ss1))*(1 + 2*S(ss1)))))/(2.*S(ss1)*Power(1 + S(ss1),1.5)*(3 + 2*S(ss1)));
+          case 164: return (-5*sqrt((Power(S(ss1),3)*(3 + 2*S(ss1)))/(1 + 2*S(ss1))) - 4*sqrt((Power(S(ss1),5)*(3 + 2*S(ss1)))/(1 + 2*S(ss1))) + 4*sqrt((Power(S(ss1),7)*(3 + 2*S(ss1)))/(1 + 2*S(ss1))) + sqrt(Power(S(ss1),3)*(3 + 4*S(ss1)*(2 + S(ss1)))) - 2*sqrt(Power(S(ss1),5)*(3 + 4*S(ss1)*(2 + S(ss1)))) + 3*sqrt(S(ss1) + (2*S(ss1))/(1 + 2*S(ss1))))/(S(ss1)*(3 + 2*S(ss1))*sqrt(S(ss1)*(-1 + S(ss1) + 2*Power(S(ss1),2))));
+          case 165: return (-3 + S(ss1)*(3 + 2*S(ss1)))/sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 166: return sqrt(3)/sqrt((1 + S(ss1))*(3 + 2*S(ss1)));
+          case 167: return -0.5*(sqrt(-9 + 6*S(ss1) + 15/(2 + S(ss1)))*(-3*sqrt(-3 + S(ss1) + 4*Power(S(ss1),2)*(2 + S(ss1))) + 9*sqrt(3 + S(ss1) + 6/(-1 + 2*S(ss1))) + 4*S(ss1)*(5 + S(ss1))*sqrt(3 + S(ss1) + 6/(-1 + 2*S(ss1)))))/(Power(1 + S(ss1),2)*Power(3 + 2*S(ss1),2));
+          case 168: return (5 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 2*S(ss1))*(5 + 2*S(ss1)))/S(ss1));
+          case 169: return sqrt(1 + 6/(1 - 2*S(ss1)) + 3/S(ss1));
+          case 170: return (sqrt(3)*sqrt((-1 + S(ss1))/(-1 + 2*S(ss1))))/S(ss1);
+          case 171: return -(sqrt(3)/sqrt(S(ss1)*(-1 + 2*S(ss1))));
+          case 172: return (-4 + S(ss1) + 2*Power(S(ss1),2))/sqrt(S(ss1)*(1 + S(ss1))*(-1 + 4*Power(S(ss1),2)));
+          case 173: return (3*sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(-1 + 4*Power(S(ss1),2))) - 10*S(ss1)*sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(-1 + 4*Power(S(ss1),2))) + 8*Power(S(ss1),2)*sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(-1 + 4*Power(S(ss1),2))) + 9*(1 + S(ss1))*sqrt((S(ss1)*(-3 + 4*S(ss1)*(1 + S(ss1))))/((1 + S(ss1))*(1 + 2*S(ss1)))))/(2.*S(ss1)*Power(1 + S(ss1),1.5)*(3 + 2*S(ss1)));
+          case 174: return (-5*sqrt((Power(S(ss1),3)*(3 + 2*S(ss1)))/(1 + 2*S(ss1))) - 4*sqrt((Power(S(ss1),5)*(3 + 2*S(ss1)))/(1 + 2*S(ss1))) + 4*sqrt((Power(S(ss1),7)*(3 + 2*S(ss1)))/(1 + 2*S(ss1))) + sqrt(Power(S(ss1),3)*(3 + 4*S(ss1)*(2 + S(ss1)))) - 2*sqrt(Power(S(ss1),5)*(3 + 4*S(ss1)*(2 + S(ss1)))) + 3*sqrt(S(ss1) + (2*S(ss1))/(1 + 2*S(ss1))))/(S(ss1)*(3 + 2*S(ss1))*sqrt(S(ss1)*(-1 + S(ss1) + 2*Power(S(ss1),2))));
+          case 175: return (-3 + S(ss1)*(3 + 2*S(ss1)))/sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 176: return sqrt(3)/sqrt((1 + S(ss1))*(3 + 2*S(ss1)));
+          case 177: return -0.5*(sqrt(-9 + 6*S(ss1) + 15/(2 + S(ss1)))*(-3*sqrt(-3 + S(ss1) + 4*Power(S(ss1),2)*(2 + S(ss1))) + 9*sqrt(3 + S(ss1) + 6/(-1 + 2*S(ss1))) + 4*S(ss1)*(5 + S(ss1))*sqrt(3 + S(ss1) + 6/(-1 + 2*S(ss1)))))/(Power(1 + S(ss1),2)*Power(3 + 2*S(ss1),2));
+          case 178: return (5 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 2*S(ss1))*(5 + 2*S(ss1)))/S(ss1));
+          case 179: return sqrt(1 + 6/(1 - 2*S(ss1)) + 3/S(ss1));
+          case 180: return (sqrt(3)*sqrt((-1 + S(ss1))/(-1 + 2*S(ss1))))/S(ss1);
+          case 181: return -(sqrt(3)/sqrt(S(ss1)*(-1 + 2*S(ss1))));
+          case 182: return (-4 + S(ss1) + 2*Power(S(ss1),2))/sqrt(S(ss1)*(1 + S(ss1))*(-1 + 4*Power(S(ss1),2)));
+          case 183: return (3*sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(-1 + 4*Power(S(ss1),2))) - 10*S(ss1)*sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(-1 + 4*Power(S(ss1),2))) + 8*Power(S(ss1),2)*sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(-1 + 4*Power(S(ss1),2))) + 9*(1 + S(ss1))*sqrt((S(ss1)*(-3 + 4*S(ss1)*(1 + S(ss1))))/((1 + S(ss1))*(1 + 2*S(ss1)))))/(2.*S(ss1)*Power(1 + S(ss1),1.5)*(3 + 2*S(ss1)));
+          case 184: return (-5*sqrt((Power(S(ss1),3)*(3 + 2*S(ss1)))/(1 + 2*S(ss1))) - 4*sqrt((Power(S(ss1),5)*(3 + 2*S(ss1)))/(1 + 2*S(ss1))) + 4*sqrt((Power(S(ss1),7)*(3 + 2*S(ss1)))/(1 + 2*S(ss1))) + sqrt(Power(S(ss1),3)*(3 + 4*S(ss1)*(2 + S(ss1)))) - 2*sqrt(Power(S(ss1),5)*(3 + 4*S(ss1)*(2 + S(ss1)))) + 3*sqrt(S(ss1) + (2*S(ss1))/(1 + 2*S(ss1))))/(S(ss1)*(3 + 2*S(ss1))*sqrt(S(ss1)*(-1 + S(ss1) + 2*Power(S(ss1),2))));
+          case 185: return (-3 + S(ss1)*(3 + 2*S(ss1)))/sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 186: return sqrt(3)/sqrt((1 + S(ss1))*(3 + 2*S(ss1)));
+          case 187: return -0.5*(sqrt(-9 + 6*S(ss1) + 15/(2 + S(ss1)))*(-3*sqrt(-3 + S(ss1) + 4*Power(S(ss1),2)*(2 + S(ss1))) + 9*sqrt(3 + S(ss1) + 6/(-1 + 2*S(ss1))) + 4*S(ss1)*(5 + S(ss1))*sqrt(3 + S(ss1) + 6/(-1 + 2*S(ss1)))))/(Power(1 + S(ss1),2)*Power(3 + 2*S(ss1),2));
+          case 188: return (5 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 2*S(ss1))*(5 + 2*S(ss1)))/S(ss1));
+          case 189: return 1;
+          case 190: return 1;
+          case 191: return 1;
+          case 192: return 1;
+          case 193: return 1;
+          case 194: return 1;
+          case 195: return 1;
+          case 196: return 1;
+          case 197: return 1;
+          case 198: return 1;
+          case 199: return 1;
+          case 200: return 1;
+          case 201: return 1;
+          case 202: return 1;
+          case 203: return 1;
+          case 204: return 1;
+          case 205: return 1;
+          case 206: return 1;
+          case 207: return 1;
+          case 208: return 1;
+          case 209: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 210: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 211: return -(1/S(ss1));
+          case 212: return 1 - 1/S(ss1) + 1/(1 + S(ss1));
+          case 213: return 1/(1 + S(ss1));
+          case 214: return -(sqrt(3 + 4*S(ss1)*(2 + S(ss1)))/((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 215: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 216: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 217: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 218: return -(1/S(ss1));
+          case 219: return 1 - 1/S(ss1) + 1/(1 + S(ss1));
+          case 220: return 1/(1 + S(ss1));
+          case 221: return -(sqrt(3 + 4*S(ss1)*(2 + S(ss1)))/((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 222: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 223: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 224: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 225: return -(1/S(ss1));
+          case 226: return 1 - 1/S(ss1) + 1/(1 + S(ss1));
+          case 227: return 1/(1 + S(ss1));
+          case 228: return -(sqrt(3 + 4*S(ss1)*(2 + S(ss1)))/((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 229: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 230: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 231: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 232: return -(1/S(ss1));
+          case 233: return 1 - 1/S(ss1) + 1/(1 + S(ss1));
+          case 234: return 1/(1 + S(ss1));
+          case 235: return -(sqrt(3 + 4*S(ss1)*(2 + S(ss1)))/((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 236: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 237: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 238: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 239: return -(1/S(ss1));
+          case 240: return 1 - 1/S(ss1) + 1/(1 + S(ss1));
+          case 241: return 1/(1 + S(ss1));
+          case 242: return -(sqrt(3 + 4*S(ss1)*(2 + S(ss1)))/((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 243: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 244: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 245: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 246: return -(1/S(ss1));
+          case 247: return 1 - 1/S(ss1) + 1/(1 + S(ss1));
+          case 248: return 1/(1 + S(ss1));
+          case 249: return -(sqrt(3 + 4*S(ss1)*(2 + S(ss1)))/((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 250: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 251: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 252: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 253: return -(1/S(ss1));
+          case 254: return 1 - 1/S(ss1) + 1/(1 + S(ss1));
+          case 255: return 1/(1 + S(ss1));
+          case 256: return -(sqrt(3 + 4*S(ss1)*(2 + S(ss1)))/((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 257: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 258: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 259: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 260: return -(1/S(ss1));
+          case 261: return 1 - 1/S(ss1) + 1/(1 + S(ss1));
+          case 262: return 1/(1 + S(ss1));
+          case 263: return -(sqrt(3 + 4*S(ss1)*(2 + S(ss1)))/((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 264: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 265: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 266: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 267: return -(1/S(ss1));
+          case 268: return 1 - 1/S(ss1) + 1/(1 + S(ss1));
+          case 269: return 1/(1 + S(ss1));
+          case 270: return -(sqrt(3 + 4*S(ss1)*(2 + S(ss1)))/((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 271: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 272: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 273: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 274: return -(1/S(ss1));
+          case 275: return 1 - 1/S(ss1) + 1/(1 + S(ss1));
+          case 276: return 1/(1 + S(ss1));
+          case 277: return -(sqrt(3 + 4*S(ss1)*(2 + S(ss1)))/((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 278: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 279: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 280: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 281: return -(1/S(ss1));
+          case 282: return 1 - 1/S(ss1) + 1/(1 + S(ss1));
+          case 283: return 1/(1 + S(ss1));
+          case 284: return -(sqrt(3 + 4*S(ss1)*(2 + S(ss1)))/((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 285: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 286: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 287: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 288: return -(1/S(ss1));
+          case 289: return 1 - 1/S(ss1) + 1/(1 + S(ss1));
+          case 290: return 1/(1 + S(ss1));
+          case 291: return -(sqrt(3 + 4*S(ss1)*(2 + S(ss1)))/((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 292: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 293: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 294: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 295: return -(1/S(ss1));
+          case 296: return 1 - 1/S(ss1) + 1/(1 + S(ss1));
+          case 297: return 1/(1 + S(ss1));
+          case 298: return -(sqrt(3 + 4*S(ss1)*(2 + S(ss1)))/((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 299: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 300: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 301: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 302: return -(1/S(ss1));
+          case 303: return 1 - 1/S(ss1) + 1/(1 + S(ss1));
+          case 304: return 1/(1 + S(ss1));
+          case 305: return -(sqrt(3 + 4*S(ss1)*(2 + S(ss1)))/((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 306: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 307: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 308: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 309: return -(1/S(ss1));
+          case 310: return 1 - 1/S(ss1) + 1/(1 + S(ss1));
+          case 311: return 1/(1 + S(ss1));
+          case 312: return -(sqrt(3 + 4*S(ss1)*(2 + S(ss1)))/((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 313: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 314: return sqrt(1 - 2/(-1 + S(ss1)) + 2/S(ss1));
+          case 315: return sqrt((-6 + 4*S(ss1))/(S(ss1) - 3*Power(S(ss1),2) + 2*Power(S(ss1),3)));
+          case 316: return -(sqrt(2)/sqrt((-1 + S(ss1))*S(ss1)));
+          case 317: return (-3 + Power(S(ss1),2))/(S(ss1)*sqrt(-1 + Power(S(ss1),2)));
+          case 318: return (sqrt(3)*(-3 + S(ss1) + 2*Power(S(ss1),2)))/(S(ss1)*sqrt((-1 + S(ss1))*(1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))));
+          case 319: return -((sqrt(3)*(-3 + S(ss1) + 2*Power(S(ss1),2)))/(S(ss1)*sqrt((1 + S(ss1))*(3 - 7*S(ss1) + 4*Power(S(ss1),3)))));
+          case 320: return 1 - 3/S(ss1) + 3/(1 + S(ss1));
+          case 321: return (sqrt(3)*sqrt(5 - 6/S(ss1) + 4*S(ss1)*(3 + S(ss1))))/((1 + S(ss1))*(3 + 2*S(ss1)));
+          case 322: return -((sqrt(3)*sqrt(-1 - 2/S(ss1) + 8*S(ss1) + 4*Power(S(ss1),2)))/(1 + 3*S(ss1) + 2*Power(S(ss1),2)));
+          case 323: return (-2 + S(ss1)*(2 + S(ss1)))/((1 + S(ss1))*sqrt(S(ss1)*(2 + S(ss1))));
+          case 324: return sqrt(2)/sqrt((1 + S(ss1))*(2 + S(ss1)));
+          case 325: return -((sqrt(2)*(5 + 2*S(ss1)))/sqrt((1 + S(ss1))*(2 + S(ss1))*(3 + 2*S(ss1))*(5 + 2*S(ss1))));
+          case 326: return (3 + S(ss1))/sqrt(((1 + S(ss1))*(2 + S(ss1))*(3 + S(ss1)))/S(ss1));
+          case 327: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 328: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 329: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 330: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 331: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 332: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 333: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 334: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 335: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 336: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 337: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 338: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 339: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 340: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 341: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 342: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 343: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 344: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 345: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 346: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 347: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 348: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 349: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 350: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 351: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 352: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 353: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 354: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 355: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 356: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 357: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 358: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 359: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 360: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 361: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 362: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 363: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 364: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 365: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 366: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 367: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 368: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 369: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 370: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 371: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 372: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 373: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 374: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 375: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 376: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 377: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 378: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 379: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 380: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 381: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 382: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 383: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 384: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 385: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 386: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 387: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 388: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 389: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 390: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 391: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 392: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 393: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 394: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 395: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 396: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 397: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 398: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 399: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 400: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 401: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 402: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 403: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 404: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 405: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 406: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 407: return sqrt(1 + 6/(1 - 2*S(ss1)) + 3/S(ss1));
+          case 408: return (sqrt(3)*sqrt((-1 + S(ss1))/(-1 + 2*S(ss1))))/S(ss1);
+          case 409: return -(sqrt(3)/sqrt(S(ss1)*(-1 + 2*S(ss1))));
+          case 410: return (-4 + S(ss1) + 2*Power(S(ss1),2))/sqrt(S(ss1)*(1 + S(ss1))*(-1 + 4*Power(S(ss1),2)));
+          case 411: return (3*sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(-1 + 4*Power(S(ss1),2))) - 10*S(ss1)*sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(-1 + 4*Power(S(ss1),2))) + 8*Power(S(ss1),2)*sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(-1 + 4*Power(S(ss1),2))) + 9*(1 + S(ss1))*sqrt((S(ss1)*(-3 + 4*S(ss1)*(1 + S(ss1))))/((1 + S(ss1))*(1 + 2*S(ss1)))))/(2.*S(ss1)*Power(1 + S(ss1),1.5)*(3 + 2*S(ss1)));
+          case 412: return (-5*sqrt((Power(S(ss1),3)*(3 + 2*S(ss1)))/(1 + 2*S(ss1))) - 4*sqrt((Power(S(ss1),5)*(3 + 2*S(ss1)))/(1 + 2*S(ss1))) + 4*sqrt((Power(S(ss1),7)*(3 + 2*S(ss1)))/(1 + 2*S(ss1))) + sqrt(Power(S(ss1),3)*(3 + 4*S(ss1)*(2 + S(ss1)))) - 2*sqrt(Power(S(ss1),5)*(3 + 4*S(ss1)*(2 + S(ss1)))) + 3*sqrt(S(ss1) + (2*S(ss1))/(1 + 2*S(ss1))))/(S(ss1)*(3 + 2*S(ss1))*sqrt(S(ss1)*(-1 + S(ss1) + 2*Power(S(ss1),2))));
+          case 413: return (-3 + S(ss1)*(3 + 2*S(ss1)))/sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 414: return sqrt(3)/sqrt((1 + S(ss1))*(3 + 2*S(ss1)));
+          case 415: return -0.5*(sqrt(-9 + 6*S(ss1) + 15/(2 + S(ss1)))*(-3*sqrt(-3 + S(ss1) + 4*Power(S(ss1),2)*(2 + S(ss1))) + 9*sqrt(3 + S(ss1) + 6/(-1 + 2*S(ss1))) + 4*S(ss1)*(5 + S(ss1))*sqrt(3 + S(ss1) + 6/(-1 + 2*S(ss1)))))/(Power(1 + S(ss1),2)*Power(3 + 2*S(ss1),2));
+          case 416: return (5 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 2*S(ss1))*(5 + 2*S(ss1)))/S(ss1));
+          case 417: return sqrt(1 + 6/(1 - 2*S(ss1)) + 3/S(ss1));
+          case 418: return (sqrt(3)*sqrt((-1 + S(ss1))/(-1 + 2*S(ss1))))/S(ss1);
+          case 419: return -(sqrt(3)/sqrt(S(ss1)*(-1 + 2*S(ss1))));
+          case 420: return (-4 + S(ss1) + 2*Power(S(ss1),2))/sqrt(S(ss1)*(1 + S(ss1))*(-1 + 4*Power(S(ss1),2)));
+          case 421: return (3*sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(-1 + 4*Power(S(ss1),2))) - 10*S(ss1)*sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(-1 + 4*Power(S(ss1),2))) + 8*Power(S(ss1),2)*sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(-1 + 4*Power(S(ss1),2))) + 9*(1 + S(ss1))*sqrt((S(ss1)*(-3 + 4*S(ss1)*(1 + S(ss1))))/((1 + S(ss1))*(1 + 2*S(ss1)))))/(2.*S(ss1)*Power(1 + S(ss1),1.5)*(3 + 2*S(ss1)));
+          case 422: return (-5*sqrt((Power(S(ss1),3)*(3 + 2*S(ss1)))/(1 + 2*S(ss1))) - 4*sqrt((Power(S(ss1),5)*(3 + 2*S(ss1)))/(1 + 2*S(ss1))) + 4*sqrt((Power(S(ss1),7)*(3 + 2*S(ss1)))/(1 + 2*S(ss1))) + sqrt(Power(S(ss1),3)*(3 + 4*S(ss1)*(2 + S(ss1)))) - 2*sqrt(Power(S(ss1),5)*(3 + 4*S(ss1)*(2 + S(ss1)))) + 3*sqrt(S(ss1) + (2*S(ss1))/(1 + 2*S(ss1))))/(S(ss1)*(3 + 2*S(ss1))*sqrt(S(ss1)*(-1 + S(ss1) + 2*Power(S(ss1),2))));
+          case 423: return (-3 + S(ss1)*(3 + 2*S(ss1)))/sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 424: return sqrt(3)/sqrt((1 + S(ss1))*(3 + 2*S(ss1)));
+          case 425: return -0.5*(sqrt(-9 + 6*S(ss1) + 15/(2 + S(ss1)))*(-3*sqrt(-3 + S(ss1) + 4*Power(S(ss1),2)*(2 + S(ss1))) + 9*sqrt(3 + S(ss1) + 6/(-1 + 2*S(ss1))) + 4*S(ss1)*(5 + S(ss1))*sqrt(3 + S(ss1) + 6/(-1 + 2*S(ss1)))))/(Power(1 + S(ss1),2)*Power(3 + 2*S(ss1),2));
+          case 426: return (5 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 2*S(ss1))*(5 + 2*S(ss1)))/S(ss1));
+          case 427: return sqrt(1 + 6/(1 - 2*S(ss1)) + 3/S(ss1));
+          case 428: return (sqrt(3)*sqrt((-1 + S(ss1))/(-1 + 2*S(ss1))))/S(ss1);
+          case 429: return -(sqrt(3)/sqrt(S(ss1)*(-1 + 2*S(ss1))));
+          case 430: return (-4 + S(ss1) + 2*Power(S(ss1),2))/sqrt(S(ss1)*(1 + S(ss1))*(-1 + 4*Power(S(ss1),2)));
+          case 431: return (3*sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(-1 + 4*Power(S(ss1),2))) - 10*S(ss1)*sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(-1 + 4*Power(S(ss1),2))) + 8*Power(S(ss1),2)*sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(-1 + 4*Power(S(ss1),2))) + 9*(1 + S(ss1))*sqrt((S(ss1)*(-3 + 4*S(ss1)*(1 + S(ss1))))/((1 + S(ss1))*(1 + 2*S(ss1)))))/(2.*S(ss1)*Power(1 + S(ss1),1.5)*(3 + 2*S(ss1)));
+          case 432: return (-5*sqrt((Power(S(ss1),3)*(3 + 2*S(ss1)))/(1 + 2*S(ss1))) - 4*sqrt((Power(S(ss1),5)*(3 + 2*S(ss1)))/(1 + 2*S(ss1))) + 4*sqrt((Power(S(ss1),7)*(3 + 2*S(ss1)))/(1 + 2*S(ss1))) + sqrt(Power(S(ss1),3)*(3 + 4*S(ss1)*(2 + S(ss1)))) - 2*sqrt(Power(S(ss1),5)*(3 + 4*S(ss1)*(2 + S(ss1)))) + 3*sqrt(S(ss1) + (2*S(ss1))/(1 + 2*S(ss1))))/(S(ss1)*(3 + 2*S(ss1))*sqrt(S(ss1)*(-1 + S(ss1) + 2*Power(S(ss1),2))));
+          case 433: return (-3 + S(ss1)*(3 + 2*S(ss1)))/sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 434: return sqrt(3)/sqrt((1 + S(ss1))*(3 + 2*S(ss1)));
+          case 435: return -0.5*(sqrt(-9 + 6*S(ss1) + 15/(2 + S(ss1)))*(-3*sqrt(-3 + S(ss1) + 4*Power(S(ss1),2)*(2 + S(ss1))) + 9*sqrt(3 + S(ss1) + 6/(-1 + 2*S(ss1))) + 4*S(ss1)*(5 + S(ss1))*sqrt(3 + S(ss1) + 6/(-1 + 2*S(ss1)))))/(Power(1 + S(ss1),2)*Power(3 + 2*S(ss1),2));
+          case 436: return (5 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 2*S(ss1))*(5 + 2*S(ss1)))/S(ss1));
+          case 437: return sqrt(1 + 6/(1 - 2*S(ss1)) + 3/S(ss1));
+          case 438: return (sqrt(3)*sqrt((-1 + S(ss1))/(-1 + 2*S(ss1))))/S(ss1);
+          case 439: return -(sqrt(3)/sqrt(S(ss1)*(-1 + 2*S(ss1))));
+          case 440: return (-4 + S(ss1) + 2*Power(S(ss1),2))/sqrt(S(ss1)*(1 + S(ss1))*(-1 + 4*Power(S(ss1),2)));
+          case 441: return (3*sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(-1 + 4*Power(S(ss1),2))) - 10*S(ss1)*sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(-1 + 4*Power(S(ss1),2))) + 8*Power(S(ss1),2)*sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(-1 + 4*Power(S(ss1),2))) + 9*(1 + S(ss1))*sqrt((S(ss1)*(-3 + 4*S(ss1)*(1 + S(ss1))))/((1 + S(ss1))*(1 + 2*S(ss1)))))/(2.*S(ss1)*Power(1 + S(ss1),1.5)*(3 + 2*S(ss1)));
+          case 442: return (-5*sqrt((Power(S(ss1),3)*(3 + 2*S(ss1)))/(1 + 2*S(ss1))) - 4*sqrt((Power(S(ss1),5)*(3 + 2*S(ss1)))/(1 + 2*S(ss1))) + 4*sqrt((Power(S(ss1),7)*(3 + 2*S(ss1)))/(1 + 2*S(ss1))) + sqrt(Power(S(ss1),3)*(3 + 4*S(ss1)*(2 + S(ss1)))) - 2*sqrt(Power(S(ss1),5)*(3 + 4*S(ss1)*(2 + S(ss1)))) + 3*sqrt(S(ss1) + (2*S(ss1))/(1 + 2*S(ss1))))/(S(ss1)*(3 + 2*S(ss1))*sqrt(S(ss1)*(-1 + S(ss1) + 2*Power(S(ss1),2))));
+          case 443: return (-3 + S(ss1)*(3 + 2*S(ss1)))/sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 444: return sqrt(3)/sqrt((1 + S(ss1))*(3 + 2*S(ss1)));
+          case 445: return -0.5*(sqrt(-9 + 6*S(ss1) + 15/(2 + S(ss1)))*(-3*sqrt(-3 + S(ss1) + 4*Power(S(ss1),2)*(2 + S(ss1))) + 9*sqrt(3 + S(ss1) + 6/(-1 + 2*S(ss1))) + 4*S(ss1)*(5 + S(ss1))*sqrt(3 + S(ss1) + 6/(-1 + 2*S(ss1)))))/(Power(1 + S(ss1),2)*Power(3 + 2*S(ss1),2));
+          case 446: return (5 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 2*S(ss1))*(5 + 2*S(ss1)))/S(ss1));
+          case 447: return 1;
+          case 448: return 1;
+          case 449: return 1;
+          case 450: return 1;
+          case 451: return 1;
+          case 452: return 1;
+          case 453: return 1;
+          case 454: return 1;
+          case 455: return 1;
+          case 456: return 1;
+          case 457: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 458: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 459: return -(1/S(ss1));
+          case 460: return 1 - 1/S(ss1) + 1/(1 + S(ss1));
+          case 461: return 1/(1 + S(ss1));
+          case 462: return -(sqrt(3 + 4*S(ss1)*(2 + S(ss1)))/((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 463: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 464: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 465: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 466: return -(1/S(ss1));
+          case 467: return 1 - 1/S(ss1) + 1/(1 + S(ss1));
+          case 468: return 1/(1 + S(ss1));
+          case 469: return -(sqrt(3 + 4*S(ss1)*(2 + S(ss1)))/((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 470: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 471: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 472: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 473: return -(1/S(ss1));
+          case 474: return 1 - 1/S(ss1) + 1/(1 + S(ss1));
+          case 475: return 1/(1 + S(ss1));
+          case 476: return -(sqrt(3 + 4*S(ss1)*(2 + S(ss1)))/((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 477: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 478: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 479: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 480: return -(1/S(ss1));
+          case 481: return 1 - 1/S(ss1) + 1/(1 + S(ss1));
+          case 482: return 1/(1 + S(ss1));
+          case 483: return -(sqrt(3 + 4*S(ss1)*(2 + S(ss1)))/((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 484: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 485: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 486: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 487: return -(1/S(ss1));
+          case 488: return 1 - 1/S(ss1) + 1/(1 + S(ss1));
+          case 489: return 1/(1 + S(ss1));
+          case 490: return -(sqrt(3 + 4*S(ss1)*(2 + S(ss1)))/((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 491: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 492: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 493: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 494: return -(1/S(ss1));
+          case 495: return 1 - 1/S(ss1) + 1/(1 + S(ss1));
+          case 496: return 1/(1 + S(ss1));
+          case 497: return -(sqrt(3 + 4*S(ss1)*(2 + S(ss1)))/((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 498: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 499: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 500: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 501: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 502: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 503: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 504: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 505: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 506: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 507: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 508: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 509: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 510: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 511: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 512: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 513: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 514: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 515: return 1;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(0, 3));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(0, 3));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -576,10 +4022,24 @@ MatrixElements<SC> SymmetryQS<SC>::recalc_triplet(const DiagInfo<SC> &diag, cons
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "qs/qs-1ch-tripletp.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 2},
+        {3, 3},
+        {4, 4}
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(0, 3));
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 2: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 3: return 1;
+          case 4: return 1;
+          default: my_assert_not_reached();
+        }
+      };
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(0, 3));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -589,10 +4049,60 @@ MatrixElements<SC> SymmetryQS<SC>::recalc_triplet(const DiagInfo<SC> &diag, cons
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "qs/qs-2ch-tripletp.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 2},
+        {3, 3},
+        {4, 4},
+        {5, 4},
+        {5, 5},
+        {6, 6},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {10, 9},
+        {10, 10},
+        {11, 9},
+        {11, 10},
+        {11, 11},
+        {12, 12},
+        {13, 12},
+        {13, 13},
+        {14, 14},
+        {15, 14},
+        {15, 15},
+        {16, 16}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 2: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 3: return 1;
+          case 4: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 5: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 6: return 1;
+          case 7: return 1;
+          case 8: return 1;
+          case 9: return 1;
+          case 10: return sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 11: return -(sqrt(1 + 2/(1 + 2*S(ss1)))/(1 + S(ss1)));
+          case 12: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 13: return 1/(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 14: return -(1/(1 + S(ss1)));
+          case 15: return 1;
+          case 16: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 17: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 18: return 1;
+          case 19: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 20: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 21: return 1;
+          case 22: return 1;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(0, 3));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(0, 3));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -602,10 +4112,216 @@ MatrixElements<SC> SymmetryQS<SC>::recalc_triplet(const DiagInfo<SC> &diag, cons
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "qs/qs-3ch-tripletp.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 2},
+        {3, 3},
+        {4, 4},
+        {5, 4},
+        {5, 5},
+        {6, 6},
+        {7, 6},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {10, 10},
+        {11, 11},
+        {12, 12},
+        {13, 13},
+        {14, 14},
+        {15, 14},
+        {15, 15},
+        {16, 14},
+        {16, 15},
+        {16, 16},
+        {17, 17},
+        {18, 17},
+        {18, 18},
+        {19, 17},
+        {19, 18},
+        {19, 19},
+        {20, 20},
+        {21, 20},
+        {21, 21},
+        {22, 20},
+        {22, 21},
+        {22, 22},
+        {23, 23},
+        {24, 23},
+        {24, 24},
+        {25, 25},
+        {26, 25},
+        {26, 26},
+        {27, 27},
+        {28, 27},
+        {28, 28},
+        {29, 29},
+        {30, 29},
+        {30, 30},
+        {31, 31},
+        {32, 31},
+        {32, 32},
+        {33, 33},
+        {34, 33},
+        {34, 34},
+        {35, 35},
+        {36, 35},
+        {36, 36},
+        {37, 37},
+        {38, 37},
+        {38, 38},
+        {39, 39},
+        {40, 39},
+        {40, 40},
+        {41, 39},
+        {41, 40},
+        {41, 41},
+        {42, 40},
+        {42, 41},
+        {42, 42},
+        {43, 43},
+        {44, 44},
+        {45, 45},
+        {46, 46},
+        {47, 47},
+        {48, 48},
+        {49, 49},
+        {50, 49},
+        {50, 50},
+        {51, 49},
+        {51, 50},
+        {51, 51},
+        {52, 52},
+        {53, 52},
+        {53, 53},
+        {54, 52},
+        {54, 53},
+        {54, 54},
+        {55, 55},
+        {56, 55},
+        {56, 56},
+        {57, 55},
+        {57, 56},
+        {57, 57},
+        {58, 58},
+        {59, 58},
+        {59, 59},
+        {60, 60},
+        {61, 60},
+        {61, 61},
+        {62, 62},
+        {63, 62},
+        {63, 63},
+        {64, 64}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 2: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 3: return 1;
+          case 4: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 5: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 6: return 1;
+          case 7: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 8: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 9: return 1;
+          case 10: return 1;
+          case 11: return 1;
+          case 12: return 1;
+          case 13: return 1;
+          case 14: return 1;
+          case 15: return 1;
+          case 16: return sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 17: return -(sqrt(1 + 2/(1 + 2*S(ss1)))/(1 + S(ss1)));
+          case 18: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 19: return 1/(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 20: return -(1/(1 + S(ss1)));
+          case 21: return 1;
+          case 22: return sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 23: return -(sqrt(1 + 2/(1 + 2*S(ss1)))/(1 + S(ss1)));
+          case 24: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 25: return 1/(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 26: return -(1/(1 + S(ss1)));
+          case 27: return 1;
+          case 28: return sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 29: return -(sqrt(1 + 2/(1 + 2*S(ss1)))/(1 + S(ss1)));
+          case 30: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 31: return 1/(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 32: return -(1/(1 + S(ss1)));
+          case 33: return 1;
+          case 34: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 35: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 36: return 1;
+          case 37: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 38: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 39: return 1;
+          case 40: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 41: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 42: return 1;
+          case 43: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 44: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 45: return 1;
+          case 46: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 47: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 48: return 1;
+          case 49: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 50: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 51: return 1;
+          case 52: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 53: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 54: return 1;
+          case 55: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 56: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 57: return 1;
+          case 58: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-3 + S(ss1) + 2*Power(S(ss1),2)));
+          case 59: return -(sqrt(9 + 15*S(ss1) + 6*Power(S(ss1),2))/((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 60: return sqrt(S(ss1)*(2 + S(ss1))*(-1 + 2*S(ss1))*(3 + 2*S(ss1)))/((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 61: return sqrt(3)/(sqrt(S(ss1)*(1 + S(ss1)))*(1 + 2*S(ss1)));
+          case 62: return (-4*sqrt(S(ss1)*(1 + S(ss1))*(2 + S(ss1))*(3 + 2*S(ss1))))/((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))));
+          case 63: return ((5 + 2*S(ss1))*sqrt((S(ss1)*(1 + S(ss1)))/(15 + 16*S(ss1) + 4*Power(S(ss1),2))))/(1 + S(ss1));
+          case 64: return sqrt(3)/((1 + S(ss1))*sqrt(3 + 4*S(ss1)*(2 + S(ss1))));
+          case 65: return -(sqrt(3)/sqrt((1 + S(ss1))*(3 + 2*S(ss1))));
+          case 66: return 1;
+          case 67: return 1;
+          case 68: return 1;
+          case 69: return 1;
+          case 70: return 1;
+          case 71: return 1;
+          case 72: return 1;
+          case 73: return sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 74: return -(sqrt(1 + 2/(1 + 2*S(ss1)))/(1 + S(ss1)));
+          case 75: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 76: return 1/(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 77: return -(1/(1 + S(ss1)));
+          case 78: return 1;
+          case 79: return sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 80: return -(sqrt(1 + 2/(1 + 2*S(ss1)))/(1 + S(ss1)));
+          case 81: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 82: return 1/(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 83: return -(1/(1 + S(ss1)));
+          case 84: return 1;
+          case 85: return sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 86: return -(sqrt(1 + 2/(1 + 2*S(ss1)))/(1 + S(ss1)));
+          case 87: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 88: return 1/(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 89: return -(1/(1 + S(ss1)));
+          case 90: return 1;
+          case 91: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 92: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 93: return 1;
+          case 94: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 95: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 96: return 1;
+          case 97: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 98: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 99: return 1;
+          case 100: return 1;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(0, 3));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(0, 3));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -615,10 +4331,878 @@ MatrixElements<SC> SymmetryQS<SC>::recalc_triplet(const DiagInfo<SC> &diag, cons
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "qs/qs-4ch-tripletp.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 2},
+        {3, 3},
+        {4, 4},
+        {5, 4},
+        {5, 5},
+        {6, 6},
+        {7, 6},
+        {7, 7},
+        {8, 8},
+        {9, 8},
+        {9, 9},
+        {10, 10},
+        {11, 11},
+        {12, 12},
+        {13, 13},
+        {14, 14},
+        {15, 15},
+        {16, 16},
+        {17, 17},
+        {18, 18},
+        {19, 19},
+        {20, 20},
+        {21, 20},
+        {21, 21},
+        {22, 20},
+        {22, 21},
+        {22, 22},
+        {23, 23},
+        {24, 23},
+        {24, 24},
+        {25, 23},
+        {25, 24},
+        {25, 25},
+        {26, 26},
+        {27, 26},
+        {27, 27},
+        {28, 26},
+        {28, 27},
+        {28, 28},
+        {29, 29},
+        {30, 29},
+        {30, 30},
+        {31, 29},
+        {31, 30},
+        {31, 31},
+        {32, 32},
+        {33, 32},
+        {33, 33},
+        {34, 32},
+        {34, 33},
+        {34, 34},
+        {35, 35},
+        {36, 35},
+        {36, 36},
+        {37, 35},
+        {37, 36},
+        {37, 37},
+        {38, 38},
+        {39, 38},
+        {39, 39},
+        {40, 40},
+        {41, 40},
+        {41, 41},
+        {42, 42},
+        {43, 42},
+        {43, 43},
+        {44, 44},
+        {45, 44},
+        {45, 45},
+        {46, 46},
+        {47, 46},
+        {47, 47},
+        {48, 48},
+        {49, 48},
+        {49, 49},
+        {50, 50},
+        {51, 50},
+        {51, 51},
+        {52, 52},
+        {53, 52},
+        {53, 53},
+        {54, 54},
+        {55, 54},
+        {55, 55},
+        {56, 56},
+        {57, 56},
+        {57, 57},
+        {58, 58},
+        {59, 58},
+        {59, 59},
+        {60, 60},
+        {61, 60},
+        {61, 61},
+        {62, 62},
+        {63, 62},
+        {63, 63},
+        {64, 64},
+        {65, 64},
+        {65, 65},
+        {66, 66},
+        {67, 66},
+        {67, 67},
+        {68, 68},
+        {69, 68},
+        {69, 69},
+        {70, 70},
+        {71, 70},
+        {71, 71},
+        {72, 72},
+        {73, 72},
+        {73, 73},
+        {74, 74},
+        {75, 74},
+        {75, 75},
+        {76, 76},
+        {77, 76},
+        {77, 77},
+        {78, 78},
+        {79, 78},
+        {79, 79},
+        {80, 78},
+        {80, 79},
+        {80, 80},
+        {81, 79},
+        {81, 80},
+        {81, 81},
+        {82, 82},
+        {83, 82},
+        {83, 83},
+        {84, 82},
+        {84, 83},
+        {84, 84},
+        {85, 83},
+        {85, 84},
+        {85, 85},
+        {86, 86},
+        {87, 86},
+        {87, 87},
+        {88, 86},
+        {88, 87},
+        {88, 88},
+        {89, 87},
+        {89, 88},
+        {89, 89},
+        {90, 90},
+        {91, 90},
+        {91, 91},
+        {92, 90},
+        {92, 91},
+        {92, 92},
+        {93, 91},
+        {93, 92},
+        {93, 93},
+        {94, 94},
+        {95, 95},
+        {96, 96},
+        {97, 97},
+        {98, 98},
+        {99, 99},
+        {100, 100},
+        {101, 101},
+        {102, 102},
+        {103, 103},
+        {104, 104},
+        {105, 105},
+        {106, 106},
+        {107, 107},
+        {108, 108},
+        {109, 109},
+        {110, 110},
+        {111, 111},
+        {112, 112},
+        {113, 113},
+        {114, 114},
+        {115, 114},
+        {115, 115},
+        {116, 114},
+        {116, 115},
+        {116, 116},
+        {117, 117},
+        {118, 117},
+        {118, 118},
+        {119, 117},
+        {119, 118},
+        {119, 119},
+        {120, 120},
+        {121, 120},
+        {121, 121},
+        {122, 120},
+        {122, 121},
+        {122, 122},
+        {123, 123},
+        {124, 123},
+        {124, 124},
+        {125, 123},
+        {125, 124},
+        {125, 125},
+        {126, 126},
+        {127, 126},
+        {127, 127},
+        {128, 126},
+        {128, 127},
+        {128, 128},
+        {129, 129},
+        {130, 129},
+        {130, 130},
+        {131, 129},
+        {131, 130},
+        {131, 131},
+        {132, 132},
+        {133, 132},
+        {133, 133},
+        {134, 132},
+        {134, 133},
+        {134, 134},
+        {135, 135},
+        {136, 135},
+        {136, 136},
+        {137, 135},
+        {137, 136},
+        {137, 137},
+        {138, 138},
+        {139, 138},
+        {139, 139},
+        {140, 138},
+        {140, 139},
+        {140, 140},
+        {141, 141},
+        {142, 141},
+        {142, 142},
+        {143, 141},
+        {143, 142},
+        {143, 143},
+        {144, 144},
+        {145, 144},
+        {145, 145},
+        {146, 144},
+        {146, 145},
+        {146, 146},
+        {147, 147},
+        {148, 147},
+        {148, 148},
+        {149, 147},
+        {149, 148},
+        {149, 149},
+        {150, 150},
+        {151, 150},
+        {151, 151},
+        {152, 150},
+        {152, 151},
+        {152, 152},
+        {153, 153},
+        {154, 153},
+        {154, 154},
+        {155, 153},
+        {155, 154},
+        {155, 155},
+        {156, 156},
+        {157, 156},
+        {157, 157},
+        {158, 156},
+        {158, 157},
+        {158, 158},
+        {159, 159},
+        {160, 159},
+        {160, 160},
+        {161, 159},
+        {161, 160},
+        {161, 161},
+        {162, 160},
+        {162, 161},
+        {162, 162},
+        {163, 161},
+        {163, 162},
+        {163, 163},
+        {164, 164},
+        {165, 164},
+        {165, 165},
+        {166, 166},
+        {167, 166},
+        {167, 167},
+        {168, 168},
+        {169, 168},
+        {169, 169},
+        {170, 170},
+        {171, 170},
+        {171, 171},
+        {172, 172},
+        {173, 172},
+        {173, 173},
+        {174, 174},
+        {175, 174},
+        {175, 175},
+        {176, 176},
+        {177, 176},
+        {177, 177},
+        {178, 178},
+        {179, 178},
+        {179, 179},
+        {180, 180},
+        {181, 180},
+        {181, 181},
+        {182, 182},
+        {183, 182},
+        {183, 183},
+        {184, 184},
+        {185, 184},
+        {185, 185},
+        {186, 186},
+        {187, 186},
+        {187, 187},
+        {188, 188},
+        {189, 188},
+        {189, 189},
+        {190, 190},
+        {191, 190},
+        {191, 191},
+        {192, 192},
+        {193, 192},
+        {193, 193},
+        {194, 194},
+        {195, 194},
+        {195, 195},
+        {196, 196},
+        {197, 196},
+        {197, 197},
+        {198, 198},
+        {199, 198},
+        {199, 199},
+        {200, 200},
+        {201, 200},
+        {201, 201},
+        {202, 202},
+        {203, 202},
+        {203, 203},
+        {204, 204},
+        {205, 204},
+        {205, 205},
+        {206, 204},
+        {206, 205},
+        {206, 206},
+        {207, 205},
+        {207, 206},
+        {207, 207},
+        {208, 208},
+        {209, 208},
+        {209, 209},
+        {210, 208},
+        {210, 209},
+        {210, 210},
+        {211, 209},
+        {211, 210},
+        {211, 211},
+        {212, 212},
+        {213, 212},
+        {213, 213},
+        {214, 212},
+        {214, 213},
+        {214, 214},
+        {215, 213},
+        {215, 214},
+        {215, 215},
+        {216, 216},
+        {217, 216},
+        {217, 217},
+        {218, 216},
+        {218, 217},
+        {218, 218},
+        {219, 217},
+        {219, 218},
+        {219, 219},
+        {220, 220},
+        {221, 221},
+        {222, 222},
+        {223, 223},
+        {224, 224},
+        {225, 225},
+        {226, 226},
+        {227, 227},
+        {228, 228},
+        {229, 229},
+        {230, 230},
+        {231, 230},
+        {231, 231},
+        {232, 230},
+        {232, 231},
+        {232, 232},
+        {233, 233},
+        {234, 233},
+        {234, 234},
+        {235, 233},
+        {235, 234},
+        {235, 235},
+        {236, 236},
+        {237, 236},
+        {237, 237},
+        {238, 236},
+        {238, 237},
+        {238, 238},
+        {239, 239},
+        {240, 239},
+        {240, 240},
+        {241, 239},
+        {241, 240},
+        {241, 241},
+        {242, 242},
+        {243, 242},
+        {243, 243},
+        {244, 242},
+        {244, 243},
+        {244, 244},
+        {245, 245},
+        {246, 245},
+        {246, 246},
+        {247, 245},
+        {247, 246},
+        {247, 247},
+        {248, 248},
+        {249, 248},
+        {249, 249},
+        {250, 250},
+        {251, 250},
+        {251, 251},
+        {252, 252},
+        {253, 252},
+        {253, 253},
+        {254, 254},
+        {255, 254},
+        {255, 255},
+        {256, 256}
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(0, 3));
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 2: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 3: return 1;
+          case 4: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 5: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 6: return 1;
+          case 7: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 8: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 9: return 1;
+          case 10: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 11: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 12: return 1;
+          case 13: return 1;
+          case 14: return 1;
+          case 15: return 1;
+          case 16: return 1;
+          case 17: return 1;
+          case 18: return 1;
+          case 19: return 1;
+          case 20: return 1;
+          case 21: return 1;
+          case 22: return 1;
+          case 23: return sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 24: return -(sqrt(1 + 2/(1 + 2*S(ss1)))/(1 + S(ss1)));
+          case 25: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 26: return 1/(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 27: return -(1/(1 + S(ss1)));
+          case 28: return 1;
+          case 29: return sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 30: return -(sqrt(1 + 2/(1 + 2*S(ss1)))/(1 + S(ss1)));
+          case 31: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 32: return 1/(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 33: return -(1/(1 + S(ss1)));
+          case 34: return 1;
+          case 35: return sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 36: return -(sqrt(1 + 2/(1 + 2*S(ss1)))/(1 + S(ss1)));
+          case 37: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 38: return 1/(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 39: return -(1/(1 + S(ss1)));
+          case 40: return 1;
+          case 41: return sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 42: return -(sqrt(1 + 2/(1 + 2*S(ss1)))/(1 + S(ss1)));
+          case 43: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 44: return 1/(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 45: return -(1/(1 + S(ss1)));
+          case 46: return 1;
+          case 47: return sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 48: return -(sqrt(1 + 2/(1 + 2*S(ss1)))/(1 + S(ss1)));
+          case 49: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 50: return 1/(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 51: return -(1/(1 + S(ss1)));
+          case 52: return 1;
+          case 53: return sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 54: return -(sqrt(1 + 2/(1 + 2*S(ss1)))/(1 + S(ss1)));
+          case 55: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 56: return 1/(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 57: return -(1/(1 + S(ss1)));
+          case 58: return 1;
+          case 59: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 60: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 61: return 1;
+          case 62: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 63: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 64: return 1;
+          case 65: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 66: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 67: return 1;
+          case 68: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 69: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 70: return 1;
+          case 71: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 72: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 73: return 1;
+          case 74: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 75: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 76: return 1;
+          case 77: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 78: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 79: return 1;
+          case 80: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 81: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 82: return 1;
+          case 83: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 84: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 85: return 1;
+          case 86: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 87: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 88: return 1;
+          case 89: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 90: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 91: return 1;
+          case 92: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 93: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 94: return 1;
+          case 95: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 96: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 97: return 1;
+          case 98: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 99: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 100: return 1;
+          case 101: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 102: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 103: return 1;
+          case 104: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 105: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 106: return 1;
+          case 107: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 108: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 109: return 1;
+          case 110: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 111: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 112: return 1;
+          case 113: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 114: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 115: return 1;
+          case 116: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 117: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 118: return 1;
+          case 119: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-3 + S(ss1) + 2*Power(S(ss1),2)));
+          case 120: return -(sqrt(9 + 15*S(ss1) + 6*Power(S(ss1),2))/((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 121: return sqrt(S(ss1)*(2 + S(ss1))*(-1 + 2*S(ss1))*(3 + 2*S(ss1)))/((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 122: return sqrt(3)/(sqrt(S(ss1)*(1 + S(ss1)))*(1 + 2*S(ss1)));
+          case 123: return (-4*sqrt(S(ss1)*(1 + S(ss1))*(2 + S(ss1))*(3 + 2*S(ss1))))/((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))));
+          case 124: return ((5 + 2*S(ss1))*sqrt((S(ss1)*(1 + S(ss1)))/(15 + 16*S(ss1) + 4*Power(S(ss1),2))))/(1 + S(ss1));
+          case 125: return sqrt(3)/((1 + S(ss1))*sqrt(3 + 4*S(ss1)*(2 + S(ss1))));
+          case 126: return -(sqrt(3)/sqrt((1 + S(ss1))*(3 + 2*S(ss1))));
+          case 127: return 1;
+          case 128: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-3 + S(ss1) + 2*Power(S(ss1),2)));
+          case 129: return -(sqrt(9 + 15*S(ss1) + 6*Power(S(ss1),2))/((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 130: return sqrt(S(ss1)*(2 + S(ss1))*(-1 + 2*S(ss1))*(3 + 2*S(ss1)))/((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 131: return sqrt(3)/(sqrt(S(ss1)*(1 + S(ss1)))*(1 + 2*S(ss1)));
+          case 132: return (-4*sqrt(S(ss1)*(1 + S(ss1))*(2 + S(ss1))*(3 + 2*S(ss1))))/((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))));
+          case 133: return ((5 + 2*S(ss1))*sqrt((S(ss1)*(1 + S(ss1)))/(15 + 16*S(ss1) + 4*Power(S(ss1),2))))/(1 + S(ss1));
+          case 134: return sqrt(3)/((1 + S(ss1))*sqrt(3 + 4*S(ss1)*(2 + S(ss1))));
+          case 135: return -(sqrt(3)/sqrt((1 + S(ss1))*(3 + 2*S(ss1))));
+          case 136: return 1;
+          case 137: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-3 + S(ss1) + 2*Power(S(ss1),2)));
+          case 138: return -(sqrt(9 + 15*S(ss1) + 6*Power(S(ss1),2))/((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 139: return sqrt(S(ss1)*(2 + S(ss1))*(-1 + 2*S(ss1))*(3 + 2*S(ss1)))/((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 140: return sqrt(3)/(sqrt(S(ss1)*(1 + S(ss1)))*(1 + 2*S(ss1)));
+          case 141: return (-4*sqrt(S(ss1)*(1 + S(ss1))*(2 + S(ss1))*(3 + 2*S(ss1))))/((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))));
+          case 142: return ((5 + 2*S(ss1))*sqrt((S(ss1)*(1 + S(ss1)))/(15 + 16*S(ss1) + 4*Power(S(ss1),2))))/(1 + S(ss1));
+          case 143: return sqrt(3)/((1 + S(ss1))*sqrt(3 + 4*S(ss1)*(2 + S(ss1))));
+          case 144: return -(sqrt(3)/sqrt((1 + S(ss1))*(3 + 2*S(ss1))));
+          case 145: return 1;
+          case 146: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-3 + S(ss1) + 2*Power(S(ss1),2)));
+          case 147: return -(sqrt(9 + 15*S(ss1) + 6*Power(S(ss1),2))/((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 148: return sqrt(S(ss1)*(2 + S(ss1))*(-1 + 2*S(ss1))*(3 + 2*S(ss1)))/((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 149: return sqrt(3)/(sqrt(S(ss1)*(1 + S(ss1)))*(1 + 2*S(ss1)));
+          case 150: return (-4*sqrt(S(ss1)*(1 + S(ss1))*(2 + S(ss1))*(3 + 2*S(ss1))))/((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))));
+          case 151: return ((5 + 2*S(ss1))*sqrt((S(ss1)*(1 + S(ss1)))/(15 + 16*S(ss1) + 4*Power(S(ss1),2))))/(1 + S(ss1));
+          case 152: return sqrt(3)/((1 + S(ss1))*sqrt(3 + 4*S(ss1)*(2 + S(ss1))));
+          case 153: return -(sqrt(3)/sqrt((1 + S(ss1))*(3 + 2*S(ss1))));
+          case 154: return 1;
+          case 155: return 1;
+          case 156: return 1;
+          case 157: return 1;
+          case 158: return 1;
+          case 159: return 1;
+          case 160: return 1;
+          case 161: return 1;
+          case 162: return 1;
+          case 163: return 1;
+          case 164: return 1;
+          case 165: return 1;
+          case 166: return 1;
+          case 167: return 1;
+          case 168: return 1;
+          case 169: return 1;
+          case 170: return 1;
+          case 171: return 1;
+          case 172: return 1;
+          case 173: return 1;
+          case 174: return 1;
+          case 175: return sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 176: return -(sqrt(1 + 2/(1 + 2*S(ss1)))/(1 + S(ss1)));
+          case 177: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 178: return 1/(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 179: return -(1/(1 + S(ss1)));
+          case 180: return 1;
+          case 181: return sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 182: return -(sqrt(1 + 2/(1 + 2*S(ss1)))/(1 + S(ss1)));
+          case 183: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 184: return 1/(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 185: return -(1/(1 + S(ss1)));
+          case 186: return 1;
+          case 187: return sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 188: return -(sqrt(1 + 2/(1 + 2*S(ss1)))/(1 + S(ss1)));
+          case 189: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 190: return 1/(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 191: return -(1/(1 + S(ss1)));
+          case 192: return 1;
+          case 193: return sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 194: return -(sqrt(1 + 2/(1 + 2*S(ss1)))/(1 + S(ss1)));
+          case 195: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 196: return 1/(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 197: return -(1/(1 + S(ss1)));
+          case 198: return 1;
+          case 199: return sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 200: return -(sqrt(1 + 2/(1 + 2*S(ss1)))/(1 + S(ss1)));
+          case 201: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 202: return 1/(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 203: return -(1/(1 + S(ss1)));
+          case 204: return 1;
+          case 205: return sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 206: return -(sqrt(1 + 2/(1 + 2*S(ss1)))/(1 + S(ss1)));
+          case 207: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 208: return 1/(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 209: return -(1/(1 + S(ss1)));
+          case 210: return 1;
+          case 211: return sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 212: return -(sqrt(1 + 2/(1 + 2*S(ss1)))/(1 + S(ss1)));
+          case 213: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 214: return 1/(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 215: return -(1/(1 + S(ss1)));
+          case 216: return 1;
+          case 217: return sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 218: return -(sqrt(1 + 2/(1 + 2*S(ss1)))/(1 + S(ss1)));
+          case 219: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 220: return 1/(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 221: return -(1/(1 + S(ss1)));
+          case 222: return 1;
+          case 223: return sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 224: return -(sqrt(1 + 2/(1 + 2*S(ss1)))/(1 + S(ss1)));
+          case 225: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 226: return 1/(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 227: return -(1/(1 + S(ss1)));
+          case 228: return 1;
+          case 229: return sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 230: return -(sqrt(1 + 2/(1 + 2*S(ss1)))/(1 + S(ss1)));
+          case 231: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 232: return 1/(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 233: return -(1/(1 + S(ss1)));
+          case 234: return 1;
+          case 235: return sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 236: return -(sqrt(1 + 2/(1 + 2*S(ss1)))/(1 + S(ss1)));
+          case 237: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 238: return 1/(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 239: return -(1/(1 + S(ss1)));
+          case 240: return 1;
+          case 241: return sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 242: return -(sqrt(1 + 2/(1 + 2*S(ss1)))/(1 + S(ss1)));
+          case 243: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 244: return 1/(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 245: return -(1/(1 + S(ss1)));
+          case 246: return 1;
+          case 247: return sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 248: return -(sqrt(1 + 2/(1 + 2*S(ss1)))/(1 + S(ss1)));
+          case 249: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 250: return 1/(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 251: return -(1/(1 + S(ss1)));
+          case 252: return 1;
+          case 253: return sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 254: return -(sqrt(1 + 2/(1 + 2*S(ss1)))/(1 + S(ss1)));
+          case 255: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 256: return 1/(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 257: return -(1/(1 + S(ss1)));
+          case 258: return 1;
+          case 259: return sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 260: return -(sqrt(1 + 2/(1 + 2*S(ss1)))/(1 + S(ss1)));
+          case 261: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 262: return 1/(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 263: return -(1/(1 + S(ss1)));
+          case 264: return 1;
+          case 265: return sqrt((9 - 4*Power(S(ss1),2))/(1 - 4*Power(S(ss1),2)));
+          case 266: return -(sqrt(22 + 6/S(ss1) + 8*S(ss1)*(3 + S(ss1)))/((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 267: return sqrt(((-2 + S(ss1) + Power(S(ss1),2))*(-3 + S(ss1) + 4*Power(S(ss1),2)*(2 + S(ss1))))/S(ss1))/((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 268: return sqrt(6)/sqrt(S(ss1)*(1 + 2*S(ss1))*(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 269: return sqrt(3)*sqrt((1 + S(ss1))*(3 + 2*S(ss1)))*((-2*(-1 + S(ss1))*S(ss1)*(-1 + 2*S(ss1)))/(Power(1 + S(ss1),1.5)*sqrt(S(ss1)*(2 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)))) + (Power(1 - 2*S(ss1),2)*(-4 + S(ss1)))/((1 + S(ss1))*sqrt(S(ss1)*(1 + S(ss1))*(2 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)))) + 6*sqrt((Power(-1 + S(ss1),2)*(-1 + 2*S(ss1)))/(S(ss1)*Power(1 + S(ss1),3)*(6 + 19*S(ss1) + 16*Power(S(ss1),2) + 4*Power(S(ss1),3)))));
+          case 270: return sqrt((1 + S(ss1))*(3 + 2*S(ss1)))*((9*(3 + 4*(-2 + S(ss1))*S(ss1)))/sqrt((Power(1 + S(ss1),3)*(2 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))*Power(3 + 2*S(ss1),2)*(5 + 2*S(ss1)))/S(ss1)) + (36*sqrt((S(ss1)*(-1 + 2*S(ss1)))/(10 + 39*S(ss1) + 49*Power(S(ss1),2) + 24*Power(S(ss1),3) + 4*Power(S(ss1),4))))/(3 + 5*S(ss1) + 2*Power(S(ss1),2)) + (S(ss1)*(-1 + 2*S(ss1))*(1 + S(ss1)*(-9 + 2*S(ss1))))/sqrt(S(ss1)*Power(1 + S(ss1),3)*(2 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))*Power(3 + 2*S(ss1),2)*(5 + 2*S(ss1))));
+          case 271: return 3/(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 272: return -((sqrt(3)*(5 + 2*S(ss1))*sqrt(S(ss1)/(10 + 29*S(ss1) + 20*Power(S(ss1),2) + 4*Power(S(ss1),3))))/(1 + S(ss1)));
+          case 273: return ((3 + S(ss1))*sqrt((S(ss1)*(1 + S(ss1)))/(6 + 5*S(ss1) + Power(S(ss1),2))))/(1 + S(ss1));
+          case 274: return sqrt(6)/sqrt((1 + S(ss1))*(2 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 275: return -(sqrt(2)/sqrt((1 + S(ss1))*(2 + S(ss1))));
+          case 276: return 1;
+          case 277: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 278: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 279: return 1;
+          case 280: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 281: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 282: return 1;
+          case 283: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 284: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 285: return 1;
+          case 286: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 287: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 288: return 1;
+          case 289: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 290: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 291: return 1;
+          case 292: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 293: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 294: return 1;
+          case 295: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 296: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 297: return 1;
+          case 298: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 299: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 300: return 1;
+          case 301: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 302: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 303: return 1;
+          case 304: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 305: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 306: return 1;
+          case 307: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 308: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 309: return 1;
+          case 310: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 311: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 312: return 1;
+          case 313: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 314: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 315: return 1;
+          case 316: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 317: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 318: return 1;
+          case 319: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 320: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 321: return 1;
+          case 322: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 323: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 324: return 1;
+          case 325: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 326: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 327: return 1;
+          case 328: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 329: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 330: return 1;
+          case 331: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 332: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 333: return 1;
+          case 334: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 335: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 336: return 1;
+          case 337: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-3 + S(ss1) + 2*Power(S(ss1),2)));
+          case 338: return -(sqrt(9 + 15*S(ss1) + 6*Power(S(ss1),2))/((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 339: return sqrt(S(ss1)*(2 + S(ss1))*(-1 + 2*S(ss1))*(3 + 2*S(ss1)))/((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 340: return sqrt(3)/(sqrt(S(ss1)*(1 + S(ss1)))*(1 + 2*S(ss1)));
+          case 341: return (-4*sqrt(S(ss1)*(1 + S(ss1))*(2 + S(ss1))*(3 + 2*S(ss1))))/((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))));
+          case 342: return ((5 + 2*S(ss1))*sqrt((S(ss1)*(1 + S(ss1)))/(15 + 16*S(ss1) + 4*Power(S(ss1),2))))/(1 + S(ss1));
+          case 343: return sqrt(3)/((1 + S(ss1))*sqrt(3 + 4*S(ss1)*(2 + S(ss1))));
+          case 344: return -(sqrt(3)/sqrt((1 + S(ss1))*(3 + 2*S(ss1))));
+          case 345: return 1;
+          case 346: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-3 + S(ss1) + 2*Power(S(ss1),2)));
+          case 347: return -(sqrt(9 + 15*S(ss1) + 6*Power(S(ss1),2))/((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 348: return sqrt(S(ss1)*(2 + S(ss1))*(-1 + 2*S(ss1))*(3 + 2*S(ss1)))/((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 349: return sqrt(3)/(sqrt(S(ss1)*(1 + S(ss1)))*(1 + 2*S(ss1)));
+          case 350: return (-4*sqrt(S(ss1)*(1 + S(ss1))*(2 + S(ss1))*(3 + 2*S(ss1))))/((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))));
+          case 351: return ((5 + 2*S(ss1))*sqrt((S(ss1)*(1 + S(ss1)))/(15 + 16*S(ss1) + 4*Power(S(ss1),2))))/(1 + S(ss1));
+          case 352: return sqrt(3)/((1 + S(ss1))*sqrt(3 + 4*S(ss1)*(2 + S(ss1))));
+          case 353: return -(sqrt(3)/sqrt((1 + S(ss1))*(3 + 2*S(ss1))));
+          case 354: return 1;
+          case 355: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-3 + S(ss1) + 2*Power(S(ss1),2)));
+          case 356: return -(sqrt(9 + 15*S(ss1) + 6*Power(S(ss1),2))/((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 357: return sqrt(S(ss1)*(2 + S(ss1))*(-1 + 2*S(ss1))*(3 + 2*S(ss1)))/((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 358: return sqrt(3)/(sqrt(S(ss1)*(1 + S(ss1)))*(1 + 2*S(ss1)));
+          case 359: return (-4*sqrt(S(ss1)*(1 + S(ss1))*(2 + S(ss1))*(3 + 2*S(ss1))))/((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))));
+          case 360: return ((5 + 2*S(ss1))*sqrt((S(ss1)*(1 + S(ss1)))/(15 + 16*S(ss1) + 4*Power(S(ss1),2))))/(1 + S(ss1));
+          case 361: return sqrt(3)/((1 + S(ss1))*sqrt(3 + 4*S(ss1)*(2 + S(ss1))));
+          case 362: return -(sqrt(3)/sqrt((1 + S(ss1))*(3 + 2*S(ss1))));
+          case 363: return 1;
+          case 364: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-3 + S(ss1) + 2*Power(S(ss1),2)));
+          case 365: return -(sqrt(9 + 15*S(ss1) + 6*Power(S(ss1),2))/((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 366: return sqrt(S(ss1)*(2 + S(ss1))*(-1 + 2*S(ss1))*(3 + 2*S(ss1)))/((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 367: return sqrt(3)/(sqrt(S(ss1)*(1 + S(ss1)))*(1 + 2*S(ss1)));
+          case 368: return (-4*sqrt(S(ss1)*(1 + S(ss1))*(2 + S(ss1))*(3 + 2*S(ss1))))/((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))));
+          case 369: return ((5 + 2*S(ss1))*sqrt((S(ss1)*(1 + S(ss1)))/(15 + 16*S(ss1) + 4*Power(S(ss1),2))))/(1 + S(ss1));
+          case 370: return sqrt(3)/((1 + S(ss1))*sqrt(3 + 4*S(ss1)*(2 + S(ss1))));
+          case 371: return -(sqrt(3)/sqrt((1 + S(ss1))*(3 + 2*S(ss1))));
+          case 372: return 1;
+          case 373: return 1;
+          case 374: return 1;
+          case 375: return 1;
+          case 376: return 1;
+          case 377: return 1;
+          case 378: return 1;
+          case 379: return 1;
+          case 380: return 1;
+          case 381: return 1;
+          case 382: return 1;
+          case 383: return sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 384: return -(sqrt(1 + 2/(1 + 2*S(ss1)))/(1 + S(ss1)));
+          case 385: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 386: return 1/(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 387: return -(1/(1 + S(ss1)));
+          case 388: return 1;
+          case 389: return sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 390: return -(sqrt(1 + 2/(1 + 2*S(ss1)))/(1 + S(ss1)));
+          case 391: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 392: return 1/(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 393: return -(1/(1 + S(ss1)));
+          case 394: return 1;
+          case 395: return sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 396: return -(sqrt(1 + 2/(1 + 2*S(ss1)))/(1 + S(ss1)));
+          case 397: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 398: return 1/(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 399: return -(1/(1 + S(ss1)));
+          case 400: return 1;
+          case 401: return sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 402: return -(sqrt(1 + 2/(1 + 2*S(ss1)))/(1 + S(ss1)));
+          case 403: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 404: return 1/(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 405: return -(1/(1 + S(ss1)));
+          case 406: return 1;
+          case 407: return sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 408: return -(sqrt(1 + 2/(1 + 2*S(ss1)))/(1 + S(ss1)));
+          case 409: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 410: return 1/(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 411: return -(1/(1 + S(ss1)));
+          case 412: return 1;
+          case 413: return sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 414: return -(sqrt(1 + 2/(1 + 2*S(ss1)))/(1 + S(ss1)));
+          case 415: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 416: return 1/(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 417: return -(1/(1 + S(ss1)));
+          case 418: return 1;
+          case 419: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 420: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 421: return 1;
+          case 422: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 423: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 424: return 1;
+          case 425: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 426: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 427: return 1;
+          case 428: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 429: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 430: return 1;
+          case 431: return 1;
+          default: my_assert_not_reached();
+        }
+      };
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(0, 3));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -633,10 +5217,24 @@ MatrixElements<SC> SymmetryQS<SC>::recalc_triplet(const DiagInfo<SC> &diag, cons
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "qs/qs-1ch-tripletm.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {2, 3},
+        {3, 3},
+        {4, 4}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 3: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 4: return 1;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(0, 3));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(0, 3));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -646,10 +5244,60 @@ MatrixElements<SC> SymmetryQS<SC>::recalc_triplet(const DiagInfo<SC> &diag, cons
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "qs/qs-2ch-tripletm.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {2, 3},
+        {3, 3},
+        {4, 4},
+        {4, 5},
+        {5, 5},
+        {6, 6},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {9, 10},
+        {9, 11},
+        {10, 10},
+        {10, 11},
+        {11, 11},
+        {12, 12},
+        {12, 13},
+        {13, 13},
+        {14, 14},
+        {14, 15},
+        {15, 15},
+        {16, 16}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 3: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 4: return 1;
+          case 5: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 6: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 7: return 1;
+          case 8: return 1;
+          case 9: return 1;
+          case 10: return 1;
+          case 11: return 1/S(ss1);
+          case 12: return 1/(S(ss1) + 2*Power(S(ss1),2));
+          case 13: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 14: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 15: return (sqrt(S(ss1)*(1 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))) + sqrt((S(ss1)*(-1 + 2*S(ss1)))/(1 + 3*S(ss1) + 2*Power(S(ss1),2))) + sqrt((S(ss1)*(-1 + 4*Power(S(ss1),2)))/(1 + S(ss1))))/sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 16: return 1;
+          case 17: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 18: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 19: return 1;
+          case 20: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 21: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 22: return 1;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(0, 3));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(0, 3));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -659,10 +5307,216 @@ MatrixElements<SC> SymmetryQS<SC>::recalc_triplet(const DiagInfo<SC> &diag, cons
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "qs/qs-3ch-tripletm.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {2, 3},
+        {3, 3},
+        {4, 4},
+        {4, 5},
+        {5, 5},
+        {6, 6},
+        {6, 7},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {10, 10},
+        {11, 11},
+        {12, 12},
+        {13, 13},
+        {14, 14},
+        {14, 15},
+        {14, 16},
+        {15, 15},
+        {15, 16},
+        {16, 16},
+        {17, 17},
+        {17, 18},
+        {17, 19},
+        {18, 18},
+        {18, 19},
+        {19, 19},
+        {20, 20},
+        {20, 21},
+        {20, 22},
+        {21, 21},
+        {21, 22},
+        {22, 22},
+        {23, 23},
+        {23, 24},
+        {24, 24},
+        {25, 25},
+        {25, 26},
+        {26, 26},
+        {27, 27},
+        {27, 28},
+        {28, 28},
+        {29, 29},
+        {29, 30},
+        {30, 30},
+        {31, 31},
+        {31, 32},
+        {32, 32},
+        {33, 33},
+        {33, 34},
+        {34, 34},
+        {35, 35},
+        {35, 36},
+        {36, 36},
+        {37, 37},
+        {37, 38},
+        {38, 38},
+        {39, 39},
+        {39, 40},
+        {39, 41},
+        {40, 40},
+        {40, 41},
+        {40, 42},
+        {41, 41},
+        {41, 42},
+        {42, 42},
+        {43, 43},
+        {44, 44},
+        {45, 45},
+        {46, 46},
+        {47, 47},
+        {48, 48},
+        {49, 49},
+        {49, 50},
+        {49, 51},
+        {50, 50},
+        {50, 51},
+        {51, 51},
+        {52, 52},
+        {52, 53},
+        {52, 54},
+        {53, 53},
+        {53, 54},
+        {54, 54},
+        {55, 55},
+        {55, 56},
+        {55, 57},
+        {56, 56},
+        {56, 57},
+        {57, 57},
+        {58, 58},
+        {58, 59},
+        {59, 59},
+        {60, 60},
+        {60, 61},
+        {61, 61},
+        {62, 62},
+        {62, 63},
+        {63, 63},
+        {64, 64}
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(0, 3));
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 3: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 4: return 1;
+          case 5: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 6: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 7: return 1;
+          case 8: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 9: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 10: return 1;
+          case 11: return 1;
+          case 12: return 1;
+          case 13: return 1;
+          case 14: return 1;
+          case 15: return 1;
+          case 16: return 1;
+          case 17: return 1/S(ss1);
+          case 18: return 1/(S(ss1) + 2*Power(S(ss1),2));
+          case 19: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 20: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 21: return (sqrt(S(ss1)*(1 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))) + sqrt((S(ss1)*(-1 + 2*S(ss1)))/(1 + 3*S(ss1) + 2*Power(S(ss1),2))) + sqrt((S(ss1)*(-1 + 4*Power(S(ss1),2)))/(1 + S(ss1))))/sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 22: return 1;
+          case 23: return 1/S(ss1);
+          case 24: return 1/(S(ss1) + 2*Power(S(ss1),2));
+          case 25: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 26: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 27: return (sqrt(S(ss1)*(1 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))) + sqrt((S(ss1)*(-1 + 2*S(ss1)))/(1 + 3*S(ss1) + 2*Power(S(ss1),2))) + sqrt((S(ss1)*(-1 + 4*Power(S(ss1),2)))/(1 + S(ss1))))/sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 28: return 1;
+          case 29: return 1/S(ss1);
+          case 30: return 1/(S(ss1) + 2*Power(S(ss1),2));
+          case 31: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 32: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 33: return (sqrt(S(ss1)*(1 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))) + sqrt((S(ss1)*(-1 + 2*S(ss1)))/(1 + 3*S(ss1) + 2*Power(S(ss1),2))) + sqrt((S(ss1)*(-1 + 4*Power(S(ss1),2)))/(1 + S(ss1))))/sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 34: return 1;
+          case 35: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 36: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 37: return 1;
+          case 38: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 39: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 40: return 1;
+          case 41: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 42: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 43: return 1;
+          case 44: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 45: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 46: return 1;
+          case 47: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 48: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 49: return 1;
+          case 50: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 51: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 52: return 1;
+          case 53: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 54: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 55: return 1;
+          case 56: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 57: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 58: return 1;
+          case 59: return sqrt(3)/sqrt(S(ss1)*(-1 + 2*S(ss1)));
+          case 60: return sqrt(3)/(S(ss1)*sqrt(-1 + 4*Power(S(ss1),2)));
+          case 61: return sqrt(1 + 6/(1 - 2*S(ss1)) + 3/S(ss1));
+          case 62: return (2*(sqrt(-((1 + S(ss1))/(1 + S(ss1) - 2*Power(S(ss1),2)))) + S(ss1)*(-3 + 2*S(ss1))*sqrt(-((1 + S(ss1))/(1 + S(ss1) - 2*Power(S(ss1),2)))) + 3*sqrt((-1 + Power(S(ss1),2))/(1 + 2*S(ss1)))))/((1 + S(ss1))*sqrt(S(ss1)*(-1 + 4*Power(S(ss1),2))));
+          case 63: return sqrt(3)/(sqrt(S(ss1)*(1 + S(ss1)))*(1 + 2*S(ss1)));
+          case 64: return (3*sqrt(3/(1 + 2*S(ss1)) + S(ss1)*(-4 + S(ss1) + 2*Power(S(ss1),2))) + (-1 + S(ss1))*S(ss1)*(sqrt(((1 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)))/(-1 + S(ss1))) + 4*sqrt((-3 + S(ss1) + 4*Power(S(ss1),2)*(2 + S(ss1)))/((-1 + S(ss1))*(1 + 2*S(ss1))))))/(S(ss1)*(1 + S(ss1))*sqrt(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 65: return (sqrt(3)*(sqrt(Power(S(ss1),3)*(1 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))) + 3*sqrt((S(ss1)*(-1 + S(ss1) + 2*Power(S(ss1),2)))/(1 + 2*S(ss1))) + 4*S(ss1)*sqrt((S(ss1)*(-1 + S(ss1) + 2*Power(S(ss1),2)))/(1 + 2*S(ss1)))))/(S(ss1)*Power(1 + S(ss1),1.5)*sqrt(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 66: return (3*(1 + 2*S(ss1))*sqrt((S(ss1)*(-1 + S(ss1) + 2*Power(S(ss1),2)))/(3 + 2*S(ss1))) + 3*sqrt((S(ss1)*(-1 + 2*S(ss1)))/(3 + 5*S(ss1) + 2*Power(S(ss1),2))) + 3*(1 + 2*S(ss1))*sqrt((S(ss1)*(-1 + 2*S(ss1)))/(3 + 5*S(ss1) + 2*Power(S(ss1),2))) + (1 + 2*S(ss1))*sqrt(S(ss1)*(-3 + S(ss1) + 4*Power(S(ss1),2)*(2 + S(ss1)))))/(2.*(1 + S(ss1))*sqrt(S(ss1)*(2 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))));
+          case 67: return 1;
+          case 68: return 1;
+          case 69: return 1;
+          case 70: return 1;
+          case 71: return 1;
+          case 72: return 1;
+          case 73: return 1;
+          case 74: return 1/S(ss1);
+          case 75: return 1/(S(ss1) + 2*Power(S(ss1),2));
+          case 76: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 77: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 78: return (sqrt(S(ss1)*(1 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))) + sqrt((S(ss1)*(-1 + 2*S(ss1)))/(1 + 3*S(ss1) + 2*Power(S(ss1),2))) + sqrt((S(ss1)*(-1 + 4*Power(S(ss1),2)))/(1 + S(ss1))))/sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 79: return 1;
+          case 80: return 1/S(ss1);
+          case 81: return 1/(S(ss1) + 2*Power(S(ss1),2));
+          case 82: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 83: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 84: return (sqrt(S(ss1)*(1 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))) + sqrt((S(ss1)*(-1 + 2*S(ss1)))/(1 + 3*S(ss1) + 2*Power(S(ss1),2))) + sqrt((S(ss1)*(-1 + 4*Power(S(ss1),2)))/(1 + S(ss1))))/sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 85: return 1;
+          case 86: return 1/S(ss1);
+          case 87: return 1/(S(ss1) + 2*Power(S(ss1),2));
+          case 88: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 89: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 90: return (sqrt(S(ss1)*(1 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))) + sqrt((S(ss1)*(-1 + 2*S(ss1)))/(1 + 3*S(ss1) + 2*Power(S(ss1),2))) + sqrt((S(ss1)*(-1 + 4*Power(S(ss1),2)))/(1 + S(ss1))))/sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 91: return 1;
+          case 92: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 93: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 94: return 1;
+          case 95: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 96: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 97: return 1;
+          case 98: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 99: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 100: return 1;
+          default: my_assert_not_reached();
+        }
+      };
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(0, 3));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -672,10 +5526,878 @@ MatrixElements<SC> SymmetryQS<SC>::recalc_triplet(const DiagInfo<SC> &diag, cons
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "qs/qs-4ch-tripletm.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {2, 3},
+        {3, 3},
+        {4, 4},
+        {4, 5},
+        {5, 5},
+        {6, 6},
+        {6, 7},
+        {7, 7},
+        {8, 8},
+        {8, 9},
+        {9, 9},
+        {10, 10},
+        {11, 11},
+        {12, 12},
+        {13, 13},
+        {14, 14},
+        {15, 15},
+        {16, 16},
+        {17, 17},
+        {18, 18},
+        {19, 19},
+        {20, 20},
+        {20, 21},
+        {20, 22},
+        {21, 21},
+        {21, 22},
+        {22, 22},
+        {23, 23},
+        {23, 24},
+        {23, 25},
+        {24, 24},
+        {24, 25},
+        {25, 25},
+        {26, 26},
+        {26, 27},
+        {26, 28},
+        {27, 27},
+        {27, 28},
+        {28, 28},
+        {29, 29},
+        {29, 30},
+        {29, 31},
+        {30, 30},
+        {30, 31},
+        {31, 31},
+        {32, 32},
+        {32, 33},
+        {32, 34},
+        {33, 33},
+        {33, 34},
+        {34, 34},
+        {35, 35},
+        {35, 36},
+        {35, 37},
+        {36, 36},
+        {36, 37},
+        {37, 37},
+        {38, 38},
+        {38, 39},
+        {39, 39},
+        {40, 40},
+        {40, 41},
+        {41, 41},
+        {42, 42},
+        {42, 43},
+        {43, 43},
+        {44, 44},
+        {44, 45},
+        {45, 45},
+        {46, 46},
+        {46, 47},
+        {47, 47},
+        {48, 48},
+        {48, 49},
+        {49, 49},
+        {50, 50},
+        {50, 51},
+        {51, 51},
+        {52, 52},
+        {52, 53},
+        {53, 53},
+        {54, 54},
+        {54, 55},
+        {55, 55},
+        {56, 56},
+        {56, 57},
+        {57, 57},
+        {58, 58},
+        {58, 59},
+        {59, 59},
+        {60, 60},
+        {60, 61},
+        {61, 61},
+        {62, 62},
+        {62, 63},
+        {63, 63},
+        {64, 64},
+        {64, 65},
+        {65, 65},
+        {66, 66},
+        {66, 67},
+        {67, 67},
+        {68, 68},
+        {68, 69},
+        {69, 69},
+        {70, 70},
+        {70, 71},
+        {71, 71},
+        {72, 72},
+        {72, 73},
+        {73, 73},
+        {74, 74},
+        {74, 75},
+        {75, 75},
+        {76, 76},
+        {76, 77},
+        {77, 77},
+        {78, 78},
+        {78, 79},
+        {78, 80},
+        {79, 79},
+        {79, 80},
+        {79, 81},
+        {80, 80},
+        {80, 81},
+        {81, 81},
+        {82, 82},
+        {82, 83},
+        {82, 84},
+        {83, 83},
+        {83, 84},
+        {83, 85},
+        {84, 84},
+        {84, 85},
+        {85, 85},
+        {86, 86},
+        {86, 87},
+        {86, 88},
+        {87, 87},
+        {87, 88},
+        {87, 89},
+        {88, 88},
+        {88, 89},
+        {89, 89},
+        {90, 90},
+        {90, 91},
+        {90, 92},
+        {91, 91},
+        {91, 92},
+        {91, 93},
+        {92, 92},
+        {92, 93},
+        {93, 93},
+        {94, 94},
+        {95, 95},
+        {96, 96},
+        {97, 97},
+        {98, 98},
+        {99, 99},
+        {100, 100},
+        {101, 101},
+        {102, 102},
+        {103, 103},
+        {104, 104},
+        {105, 105},
+        {106, 106},
+        {107, 107},
+        {108, 108},
+        {109, 109},
+        {110, 110},
+        {111, 111},
+        {112, 112},
+        {113, 113},
+        {114, 114},
+        {114, 115},
+        {114, 116},
+        {115, 115},
+        {115, 116},
+        {116, 116},
+        {117, 117},
+        {117, 118},
+        {117, 119},
+        {118, 118},
+        {118, 119},
+        {119, 119},
+        {120, 120},
+        {120, 121},
+        {120, 122},
+        {121, 121},
+        {121, 122},
+        {122, 122},
+        {123, 123},
+        {123, 124},
+        {123, 125},
+        {124, 124},
+        {124, 125},
+        {125, 125},
+        {126, 126},
+        {126, 127},
+        {126, 128},
+        {127, 127},
+        {127, 128},
+        {128, 128},
+        {129, 129},
+        {129, 130},
+        {129, 131},
+        {130, 130},
+        {130, 131},
+        {131, 131},
+        {132, 132},
+        {132, 133},
+        {132, 134},
+        {133, 133},
+        {133, 134},
+        {134, 134},
+        {135, 135},
+        {135, 136},
+        {135, 137},
+        {136, 136},
+        {136, 137},
+        {137, 137},
+        {138, 138},
+        {138, 139},
+        {138, 140},
+        {139, 139},
+        {139, 140},
+        {140, 140},
+        {141, 141},
+        {141, 142},
+        {141, 143},
+        {142, 142},
+        {142, 143},
+        {143, 143},
+        {144, 144},
+        {144, 145},
+        {144, 146},
+        {145, 145},
+        {145, 146},
+        {146, 146},
+        {147, 147},
+        {147, 148},
+        {147, 149},
+        {148, 148},
+        {148, 149},
+        {149, 149},
+        {150, 150},
+        {150, 151},
+        {150, 152},
+        {151, 151},
+        {151, 152},
+        {152, 152},
+        {153, 153},
+        {153, 154},
+        {153, 155},
+        {154, 154},
+        {154, 155},
+        {155, 155},
+        {156, 156},
+        {156, 157},
+        {156, 158},
+        {157, 157},
+        {157, 158},
+        {158, 158},
+        {159, 159},
+        {159, 160},
+        {159, 161},
+        {160, 160},
+        {160, 161},
+        {160, 162},
+        {161, 161},
+        {161, 162},
+        {161, 163},
+        {162, 162},
+        {162, 163},
+        {163, 163},
+        {164, 164},
+        {164, 165},
+        {165, 165},
+        {166, 166},
+        {166, 167},
+        {167, 167},
+        {168, 168},
+        {168, 169},
+        {169, 169},
+        {170, 170},
+        {170, 171},
+        {171, 171},
+        {172, 172},
+        {172, 173},
+        {173, 173},
+        {174, 174},
+        {174, 175},
+        {175, 175},
+        {176, 176},
+        {176, 177},
+        {177, 177},
+        {178, 178},
+        {178, 179},
+        {179, 179},
+        {180, 180},
+        {180, 181},
+        {181, 181},
+        {182, 182},
+        {182, 183},
+        {183, 183},
+        {184, 184},
+        {184, 185},
+        {185, 185},
+        {186, 186},
+        {186, 187},
+        {187, 187},
+        {188, 188},
+        {188, 189},
+        {189, 189},
+        {190, 190},
+        {190, 191},
+        {191, 191},
+        {192, 192},
+        {192, 193},
+        {193, 193},
+        {194, 194},
+        {194, 195},
+        {195, 195},
+        {196, 196},
+        {196, 197},
+        {197, 197},
+        {198, 198},
+        {198, 199},
+        {199, 199},
+        {200, 200},
+        {200, 201},
+        {201, 201},
+        {202, 202},
+        {202, 203},
+        {203, 203},
+        {204, 204},
+        {204, 205},
+        {204, 206},
+        {205, 205},
+        {205, 206},
+        {205, 207},
+        {206, 206},
+        {206, 207},
+        {207, 207},
+        {208, 208},
+        {208, 209},
+        {208, 210},
+        {209, 209},
+        {209, 210},
+        {209, 211},
+        {210, 210},
+        {210, 211},
+        {211, 211},
+        {212, 212},
+        {212, 213},
+        {212, 214},
+        {213, 213},
+        {213, 214},
+        {213, 215},
+        {214, 214},
+        {214, 215},
+        {215, 215},
+        {216, 216},
+        {216, 217},
+        {216, 218},
+        {217, 217},
+        {217, 218},
+        {217, 219},
+        {218, 218},
+        {218, 219},
+        {219, 219},
+        {220, 220},
+        {221, 221},
+        {222, 222},
+        {223, 223},
+        {224, 224},
+        {225, 225},
+        {226, 226},
+        {227, 227},
+        {228, 228},
+        {229, 229},
+        {230, 230},
+        {230, 231},
+        {230, 232},
+        {231, 231},
+        {231, 232},
+        {232, 232},
+        {233, 233},
+        {233, 234},
+        {233, 235},
+        {234, 234},
+        {234, 235},
+        {235, 235},
+        {236, 236},
+        {236, 237},
+        {236, 238},
+        {237, 237},
+        {237, 238},
+        {238, 238},
+        {239, 239},
+        {239, 240},
+        {239, 241},
+        {240, 240},
+        {240, 241},
+        {241, 241},
+        {242, 242},
+        {242, 243},
+        {242, 244},
+        {243, 243},
+        {243, 244},
+        {244, 244},
+        {245, 245},
+        {245, 246},
+        {245, 247},
+        {246, 246},
+        {246, 247},
+        {247, 247},
+        {248, 248},
+        {248, 249},
+        {249, 249},
+        {250, 250},
+        {250, 251},
+        {251, 251},
+        {252, 252},
+        {252, 253},
+        {253, 253},
+        {254, 254},
+        {254, 255},
+        {255, 255},
+        {256, 256}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 3: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 4: return 1;
+          case 5: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 6: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 7: return 1;
+          case 8: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 9: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 10: return 1;
+          case 11: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 12: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 13: return 1;
+          case 14: return 1;
+          case 15: return 1;
+          case 16: return 1;
+          case 17: return 1;
+          case 18: return 1;
+          case 19: return 1;
+          case 20: return 1;
+          case 21: return 1;
+          case 22: return 1;
+          case 23: return 1;
+          case 24: return 1/S(ss1);
+          case 25: return 1/(S(ss1) + 2*Power(S(ss1),2));
+          case 26: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 27: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 28: return (sqrt(S(ss1)*(1 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))) + sqrt((S(ss1)*(-1 + 2*S(ss1)))/(1 + 3*S(ss1) + 2*Power(S(ss1),2))) + sqrt((S(ss1)*(-1 + 4*Power(S(ss1),2)))/(1 + S(ss1))))/sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 29: return 1;
+          case 30: return 1/S(ss1);
+          case 31: return 1/(S(ss1) + 2*Power(S(ss1),2));
+          case 32: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 33: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 34: return (sqrt(S(ss1)*(1 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))) + sqrt((S(ss1)*(-1 + 2*S(ss1)))/(1 + 3*S(ss1) + 2*Power(S(ss1),2))) + sqrt((S(ss1)*(-1 + 4*Power(S(ss1),2)))/(1 + S(ss1))))/sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 35: return 1;
+          case 36: return 1/S(ss1);
+          case 37: return 1/(S(ss1) + 2*Power(S(ss1),2));
+          case 38: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 39: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 40: return (sqrt(S(ss1)*(1 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))) + sqrt((S(ss1)*(-1 + 2*S(ss1)))/(1 + 3*S(ss1) + 2*Power(S(ss1),2))) + sqrt((S(ss1)*(-1 + 4*Power(S(ss1),2)))/(1 + S(ss1))))/sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 41: return 1;
+          case 42: return 1/S(ss1);
+          case 43: return 1/(S(ss1) + 2*Power(S(ss1),2));
+          case 44: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 45: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 46: return (sqrt(S(ss1)*(1 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))) + sqrt((S(ss1)*(-1 + 2*S(ss1)))/(1 + 3*S(ss1) + 2*Power(S(ss1),2))) + sqrt((S(ss1)*(-1 + 4*Power(S(ss1),2)))/(1 + S(ss1))))/sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 47: return 1;
+          case 48: return 1/S(ss1);
+          case 49: return 1/(S(ss1) + 2*Power(S(ss1),2));
+          case 50: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 51: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 52: return (sqrt(S(ss1)*(1 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))) + sqrt((S(ss1)*(-1 + 2*S(ss1)))/(1 + 3*S(ss1) + 2*Power(S(ss1),2))) + sqrt((S(ss1)*(-1 + 4*Power(S(ss1),2)))/(1 + S(ss1))))/sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 53: return 1;
+          case 54: return 1/S(ss1);
+          case 55: return 1/(S(ss1) + 2*Power(S(ss1),2));
+          case 56: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 57: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 58: return (sqrt(S(ss1)*(1 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))) + sqrt((S(ss1)*(-1 + 2*S(ss1)))/(1 + 3*S(ss1) + 2*Power(S(ss1),2))) + sqrt((S(ss1)*(-1 + 4*Power(S(ss1),2)))/(1 + S(ss1))))/sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 59: return 1;
+          case 60: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 61: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 62: return 1;
+          case 63: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 64: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 65: return 1;
+          case 66: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 67: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 68: return 1;
+          case 69: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 70: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 71: return 1;
+          case 72: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 73: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 74: return 1;
+          case 75: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 76: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 77: return 1;
+          case 78: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 79: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 80: return 1;
+          case 81: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 82: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 83: return 1;
+          case 84: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 85: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 86: return 1;
+          case 87: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 88: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 89: return 1;
+          case 90: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 91: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 92: return 1;
+          case 93: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 94: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 95: return 1;
+          case 96: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 97: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 98: return 1;
+          case 99: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 100: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 101: return 1;
+          case 102: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 103: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 104: return 1;
+          case 105: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 106: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 107: return 1;
+          case 108: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 109: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 110: return 1;
+          case 111: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 112: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 113: return 1;
+          case 114: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 115: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 116: return 1;
+          case 117: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 118: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 119: return 1;
+          case 120: return sqrt(3)/sqrt(S(ss1)*(-1 + 2*S(ss1)));
+          case 121: return sqrt(3)/(S(ss1)*sqrt(-1 + 4*Power(S(ss1),2)));
+          case 122: return sqrt(1 + 6/(1 - 2*S(ss1)) + 3/S(ss1));
+          case 123: return (2*(sqrt(-((1 + S(ss1))/(1 + S(ss1) - 2*Power(S(ss1),2)))) + S(ss1)*(-3 + 2*S(ss1))*sqrt(-((1 + S(ss1))/(1 + S(ss1) - 2*Power(S(ss1),2)))) + 3*sqrt((-1 + Power(S(ss1),2))/(1 + 2*S(ss1)))))/((1 + S(ss1))*sqrt(S(ss1)*(-1 + 4*Power(S(ss1),2))));
+          case 124: return sqrt(3)/(sqrt(S(ss1)*(1 + S(ss1)))*(1 + 2*S(ss1)));
+          case 125: return (3*sqrt(3/(1 + 2*S(ss1)) + S(ss1)*(-4 + S(ss1) + 2*Power(S(ss1),2))) + (-1 + S(ss1))*S(ss1)*(sqrt(((1 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)))/(-1 + S(ss1))) + 4*sqrt((-3 + S(ss1) + 4*Power(S(ss1),2)*(2 + S(ss1)))/((-1 + S(ss1))*(1 + 2*S(ss1))))))/(S(ss1)*(1 + S(ss1))*sqrt(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 126: return (sqrt(3)*(sqrt(Power(S(ss1),3)*(1 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))) + 3*sqrt((S(ss1)*(-1 + S(ss1) + 2*Power(S(ss1),2)))/(1 + 2*S(ss1))) + 4*S(ss1)*sqrt((S(ss1)*(-1 + S(ss1) + 2*Power(S(ss1),2)))/(1 + 2*S(ss1)))))/(S(ss1)*Power(1 + S(ss1),1.5)*sqrt(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 127: return (3*(1 + 2*S(ss1))*sqrt((S(ss1)*(-1 + S(ss1) + 2*Power(S(ss1),2)))/(3 + 2*S(ss1))) + 3*sqrt((S(ss1)*(-1 + 2*S(ss1)))/(3 + 5*S(ss1) + 2*Power(S(ss1),2))) + 3*(1 + 2*S(ss1))*sqrt((S(ss1)*(-1 + 2*S(ss1)))/(3 + 5*S(ss1) + 2*Power(S(ss1),2))) + (1 + 2*S(ss1))*sqrt(S(ss1)*(-3 + S(ss1) + 4*Power(S(ss1),2)*(2 + S(ss1)))))/(2.*(1 + S(ss1))*sqrt(S(ss1)*(2 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))));
+          case 128: return 1;
+          case 129: return sqrt(3)/sqrt(S(ss1)*(-1 + 2*S(ss1)));
+          case 130: return sqrt(3)/(S(ss1)*sqrt(-1 + 4*Power(S(ss1),2)));
+          case 131: return sqrt(1 + 6/(1 - 2*S(ss1)) + 3/S(ss1));
+          case 132: return (2*(sqrt(-((1 + S(ss1))/(1 + S(ss1) - 2*Power(S(ss1),2)))) + S(ss1)*(-3 + 2*S(ss1))*sqrt(-((1 + S(ss1))/(1 + S(ss1) - 2*Power(S(ss1),2)))) + 3*sqrt((-1 + Power(S(ss1),2))/(1 + 2*S(ss1)))))/((1 + S(ss1))*sqrt(S(ss1)*(-1 + 4*Power(S(ss1),2))));
+          case 133: return sqrt(3)/(sqrt(S(ss1)*(1 + S(ss1)))*(1 + 2*S(ss1)));
+          case 134: return (3*sqrt(3/(1 + 2*S(ss1)) + S(ss1)*(-4 + S(ss1) + 2*Power(S(ss1),2))) + (-1 + S(ss1))*S(ss1)*(sqrt(((1 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)))/(-1 + S(ss1))) + 4*sqrt((-3 + S(ss1) + 4*Power(S(ss1),2)*(2 + S(ss1)))/((-1 + S(ss1))*(1 + 2*S(ss1))))))/(S(ss1)*(1 + S(ss1))*sqrt(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 135: return (sqrt(3)*(sqrt(Power(S(ss1),3)*(1 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))) + 3*sqrt((S(ss1)*(-1 + S(ss1) + 2*Power(S(ss1),2)))/(1 + 2*S(ss1))) + 4*S(ss1)*sqrt((S(ss1)*(-1 + S(ss1) + 2*Power(S(ss1),2)))/(1 + 2*S(ss1)))))/(S(ss1)*Power(1 + S(ss1),1.5)*sqrt(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 136: return (3*(1 + 2*S(ss1))*sqrt((S(ss1)*(-1 + S(ss1) + 2*Power(S(ss1),2)))/(3 + 2*S(ss1))) + 3*sqrt((S(ss1)*(-1 + 2*S(ss1)))/(3 + 5*S(ss1) + 2*Power(S(ss1),2))) + 3*(1 + 2*S(ss1))*sqrt((S(ss1)*(-1 + 2*S(ss1)))/(3 + 5*S(ss1) + 2*Power(S(ss1),2))) + (1 + 2*S(ss1))*sqrt(S(ss1)*(-3 + S(ss1) + 4*Power(S(ss1),2)*(2 + S(ss1)))))/(2.*(1 + S(ss1))*sqrt(S(ss1)*(2 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))));
+          case 137: return 1;
+          case 138: return sqrt(3)/sqrt(S(ss1)*(-1 + 2*S(ss1)));
+          case 139: return sqrt(3)/(S(ss1)*sqrt(-1 + 4*Power(S(ss1),2)));
+          case 140: return sqrt(1 + 6/(1 - 2*S(ss1)) + 3/S(ss1));
+          case 141: return (2*(sqrt(-((1 + S(ss1))/(1 + S(ss1) - 2*Power(S(ss1),2)))) + S(ss1)*(-3 + 2*S(ss1))*sqrt(-((1 + S(ss1))/(1 + S(ss1) - 2*Power(S(ss1),2)))) + 3*sqrt((-1 + Power(S(ss1),2))/(1 + 2*S(ss1)))))/((1 + S(ss1))*sqrt(S(ss1)*(-1 + 4*Power(S(ss1),2))));
+          case 142: return sqrt(3)/(sqrt(S(ss1)*(1 + S(ss1)))*(1 + 2*S(ss1)));
+          case 143: return (3*sqrt(3/(1 + 2*S(ss1)) + S(ss1)*(-4 + S(ss1) + 2*Power(S(ss1),2))) + (-1 + S(ss1))*S(ss1)*(sqrt(((1 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)))/(-1 + S(ss1))) + 4*sqrt((-3 + S(ss1) + 4*Power(S(ss1),2)*(2 + S(ss1)))/((-1 + S(ss1))*(1 + 2*S(ss1))))))/(S(ss1)*(1 + S(ss1))*sqrt(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 144: return (sqrt(3)*(sqrt(Power(S(ss1),3)*(1 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))) + 3*sqrt((S(ss1)*(-1 + S(ss1) + 2*Power(S(ss1),2)))/(1 + 2*S(ss1))) + 4*S(ss1)*sqrt((S(ss1)*(-1 + S(ss1) + 2*Power(S(ss1),2)))/(1 + 2*S(ss1)))))/(S(ss1)*Power(1 + S(ss1),1.5)*sqrt(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 145: return (3*(1 + 2*S(ss1))*sqrt((S(ss1)*(-1 + S(ss1) + 2*Power(S(ss1),2)))/(3 + 2*S(ss1))) + 3*sqrt((S(ss1)*(-1 + 2*S(ss1)))/(3 + 5*S(ss1) + 2*Power(S(ss1),2))) + 3*(1 + 2*S(ss1))*sqrt((S(ss1)*(-1 + 2*S(ss1)))/(3 + 5*S(ss1) + 2*Power(S(ss1),2))) + (1 + 2*S(ss1))*sqrt(S(ss1)*(-3 + S(ss1) + 4*Power(S(ss1),2)*(2 + S(ss1)))))/(2.*(1 + S(ss1))*sqrt(S(ss1)*(2 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))));
+          case 146: return 1;
+          case 147: return sqrt(3)/sqrt(S(ss1)*(-1 + 2*S(ss1)));
+          case 148: return sqrt(3)/(S(ss1)*sqrt(-1 + 4*Power(S(ss1),2)));
+          case 149: return sqrt(1 + 6/(1 - 2*S(ss1)) + 3/S(ss1));
+          case 150: return (2*(sqrt(-((1 + S(ss1))/(1 + S(ss1) - 2*Power(S(ss1),2)))) + S(ss1)*(-3 + 2*S(ss1))*sqrt(-((1 + S(ss1))/(1 + S(ss1) - 2*Power(S(ss1),2)))) + 3*sqrt((-1 + Power(S(ss1),2))/(1 + 2*S(ss1)))))/((1 + S(ss1))*sqrt(S(ss1)*(-1 + 4*Power(S(ss1),2))));
+          case 151: return sqrt(3)/(sqrt(S(ss1)*(1 + S(ss1)))*(1 + 2*S(ss1)));
+          case 152: return (3*sqrt(3/(1 + 2*S(ss1)) + S(ss1)*(-4 + S(ss1) + 2*Power(S(ss1),2))) + (-1 + S(ss1))*S(ss1)*(sqrt(((1 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)))/(-1 + S(ss1))) + 4*sqrt((-3 + S(ss1) + 4*Power(S(ss1),2)*(2 + S(ss1)))/((-1 + S(ss1))*(1 + 2*S(ss1))))))/(S(ss1)*(1 + S(ss1))*sqrt(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 153: return (sqrt(3)*(sqrt(Power(S(ss1),3)*(1 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))) + 3*sqrt((S(ss1)*(-1 + S(ss1) + 2*Power(S(ss1),2)))/(1 + 2*S(ss1))) + 4*S(ss1)*sqrt((S(ss1)*(-1 + S(ss1) + 2*Power(S(ss1),2)))/(1 + 2*S(ss1)))))/(S(ss1)*Power(1 + S(ss1),1.5)*sqrt(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 154: return (3*(1 + 2*S(ss1))*sqrt((S(ss1)*(-1 + S(ss1) + 2*Power(S(ss1),2)))/(3 + 2*S(ss1))) + 3*sqrt((S(ss1)*(-1 + 2*S(ss1)))/(3 + 5*S(ss1) + 2*Power(S(ss1),2))) + 3*(1 + 2*S(ss1))*sqrt((S(ss1)*(-1 + 2*S(ss1)))/(3 + 5*S(ss1) + 2*Power(S(ss1),2))) + (1 + 2*S(ss1))*sqrt(S(ss1)*(-3 + S(ss1) + 4*Power(S(ss1),2)*(2 + S(ss1)))))/(2.*(1 + S(ss1))*sqrt(S(ss1)*(2 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))));
+          case 155: return 1;
+          case 156: return 1;
+          case 157: return 1;
+          case 158: return 1;
+          case 159: return 1;
+          case 160: return 1;
+          case 161: return 1;
+          case 162: return 1;
+          case 163: return 1;
+          case 164: return 1;
+          case 165: return 1;
+          case 166: return 1;
+          case 167: return 1;
+          case 168: return 1;
+          case 169: return 1;
+          case 170: return 1;
+          case 171: return 1;
+          case 172: return 1;
+          case 173: return 1;
+          case 174: return 1;
+          case 175: return 1;
+          case 176: return 1/S(ss1);
+          case 177: return 1/(S(ss1) + 2*Power(S(ss1),2));
+          case 178: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 179: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 180: return (sqrt(S(ss1)*(1 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))) + sqrt((S(ss1)*(-1 + 2*S(ss1)))/(1 + 3*S(ss1) + 2*Power(S(ss1),2))) + sqrt((S(ss1)*(-1 + 4*Power(S(ss1),2)))/(1 + S(ss1))))/sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 181: return 1;
+          case 182: return 1/S(ss1);
+          case 183: return 1/(S(ss1) + 2*Power(S(ss1),2));
+          case 184: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 185: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 186: return (sqrt(S(ss1)*(1 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))) + sqrt((S(ss1)*(-1 + 2*S(ss1)))/(1 + 3*S(ss1) + 2*Power(S(ss1),2))) + sqrt((S(ss1)*(-1 + 4*Power(S(ss1),2)))/(1 + S(ss1))))/sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 187: return 1;
+          case 188: return 1/S(ss1);
+          case 189: return 1/(S(ss1) + 2*Power(S(ss1),2));
+          case 190: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 191: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 192: return (sqrt(S(ss1)*(1 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))) + sqrt((S(ss1)*(-1 + 2*S(ss1)))/(1 + 3*S(ss1) + 2*Power(S(ss1),2))) + sqrt((S(ss1)*(-1 + 4*Power(S(ss1),2)))/(1 + S(ss1))))/sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 193: return 1;
+          case 194: return 1/S(ss1);
+          case 195: return 1/(S(ss1) + 2*Power(S(ss1),2));
+          case 196: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 197: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 198: return (sqrt(S(ss1)*(1 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))) + sqrt((S(ss1)*(-1 + 2*S(ss1)))/(1 + 3*S(ss1) + 2*Power(S(ss1),2))) + sqrt((S(ss1)*(-1 + 4*Power(S(ss1),2)))/(1 + S(ss1))))/sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 199: return 1;
+          case 200: return 1/S(ss1);
+          case 201: return 1/(S(ss1) + 2*Power(S(ss1),2));
+          case 202: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 203: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 204: return (sqrt(S(ss1)*(1 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))) + sqrt((S(ss1)*(-1 + 2*S(ss1)))/(1 + 3*S(ss1) + 2*Power(S(ss1),2))) + sqrt((S(ss1)*(-1 + 4*Power(S(ss1),2)))/(1 + S(ss1))))/sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 205: return 1;
+          case 206: return 1/S(ss1);
+          case 207: return 1/(S(ss1) + 2*Power(S(ss1),2));
+          case 208: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 209: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 210: return (sqrt(S(ss1)*(1 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))) + sqrt((S(ss1)*(-1 + 2*S(ss1)))/(1 + 3*S(ss1) + 2*Power(S(ss1),2))) + sqrt((S(ss1)*(-1 + 4*Power(S(ss1),2)))/(1 + S(ss1))))/sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 211: return 1;
+          case 212: return 1/S(ss1);
+          case 213: return 1/(S(ss1) + 2*Power(S(ss1),2));
+          case 214: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 215: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 216: return (sqrt(S(ss1)*(1 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))) + sqrt((S(ss1)*(-1 + 2*S(ss1)))/(1 + 3*S(ss1) + 2*Power(S(ss1),2))) + sqrt((S(ss1)*(-1 + 4*Power(S(ss1),2)))/(1 + S(ss1))))/sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 217: return 1;
+          case 218: return 1/S(ss1);
+          case 219: return 1/(S(ss1) + 2*Power(S(ss1),2));
+          case 220: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 221: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 222: return (sqrt(S(ss1)*(1 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))) + sqrt((S(ss1)*(-1 + 2*S(ss1)))/(1 + 3*S(ss1) + 2*Power(S(ss1),2))) + sqrt((S(ss1)*(-1 + 4*Power(S(ss1),2)))/(1 + S(ss1))))/sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 223: return 1;
+          case 224: return 1/S(ss1);
+          case 225: return 1/(S(ss1) + 2*Power(S(ss1),2));
+          case 226: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 227: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 228: return (sqrt(S(ss1)*(1 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))) + sqrt((S(ss1)*(-1 + 2*S(ss1)))/(1 + 3*S(ss1) + 2*Power(S(ss1),2))) + sqrt((S(ss1)*(-1 + 4*Power(S(ss1),2)))/(1 + S(ss1))))/sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 229: return 1;
+          case 230: return 1/S(ss1);
+          case 231: return 1/(S(ss1) + 2*Power(S(ss1),2));
+          case 232: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 233: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 234: return (sqrt(S(ss1)*(1 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))) + sqrt((S(ss1)*(-1 + 2*S(ss1)))/(1 + 3*S(ss1) + 2*Power(S(ss1),2))) + sqrt((S(ss1)*(-1 + 4*Power(S(ss1),2)))/(1 + S(ss1))))/sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 235: return 1;
+          case 236: return 1/S(ss1);
+          case 237: return 1/(S(ss1) + 2*Power(S(ss1),2));
+          case 238: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 239: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 240: return (sqrt(S(ss1)*(1 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))) + sqrt((S(ss1)*(-1 + 2*S(ss1)))/(1 + 3*S(ss1) + 2*Power(S(ss1),2))) + sqrt((S(ss1)*(-1 + 4*Power(S(ss1),2)))/(1 + S(ss1))))/sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 241: return 1;
+          case 242: return 1/S(ss1);
+          case 243: return 1/(S(ss1) + 2*Power(S(ss1),2));
+          case 244: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 245: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 246: return (sqrt(S(ss1)*(1 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))) + sqrt((S(ss1)*(-1 + 2*S(ss1)))/(1 + 3*S(ss1) + 2*Power(S(ss1),2))) + sqrt((S(ss1)*(-1 + 4*Power(S(ss1),2)))/(1 + S(ss1))))/sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 247: return 1;
+          case 248: return 1/S(ss1);
+          case 249: return 1/(S(ss1) + 2*Power(S(ss1),2));
+          case 250: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 251: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 252: return (sqrt(S(ss1)*(1 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))) + sqrt((S(ss1)*(-1 + 2*S(ss1)))/(1 + 3*S(ss1) + 2*Power(S(ss1),2))) + sqrt((S(ss1)*(-1 + 4*Power(S(ss1),2)))/(1 + S(ss1))))/sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 253: return 1;
+          case 254: return 1/S(ss1);
+          case 255: return 1/(S(ss1) + 2*Power(S(ss1),2));
+          case 256: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 257: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 258: return (sqrt(S(ss1)*(1 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))) + sqrt((S(ss1)*(-1 + 2*S(ss1)))/(1 + 3*S(ss1) + 2*Power(S(ss1),2))) + sqrt((S(ss1)*(-1 + 4*Power(S(ss1),2)))/(1 + S(ss1))))/sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 259: return 1;
+          case 260: return 1/S(ss1);
+          case 261: return 1/(S(ss1) + 2*Power(S(ss1),2));
+          case 262: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 263: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 264: return (sqrt(S(ss1)*(1 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))) + sqrt((S(ss1)*(-1 + 2*S(ss1)))/(1 + 3*S(ss1) + 2*Power(S(ss1),2))) + sqrt((S(ss1)*(-1 + 4*Power(S(ss1),2)))/(1 + S(ss1))))/sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 265: return 1;
+          case 266: return sqrt(2)/sqrt((-1 + S(ss1))*S(ss1));
+          case 267: return sqrt(6)/sqrt((-1 + S(ss1))*S(ss1)*(-1 + 2*S(ss1))*(1 + 2*S(ss1)));
+          case 268: return sqrt(1 - 2/(-1 + S(ss1)) + 2/S(ss1));
+          case 269: return ((-3 + 2*S(ss1))*sqrt((3 + 9*S(ss1) + 6*Power(S(ss1),2))/(3 - 5*S(ss1) + 2*Power(S(ss1),2))))/(S(ss1)*(1 + 2*S(ss1)));
+          case 270: return 3/(S(ss1) + 2*Power(S(ss1),2));
+          case 271: return (9 - 13*Power(S(ss1),2) + 4*Power(S(ss1),4))/(S(ss1)*sqrt(-9 + Power(S(ss1),2)*Power(7 - 4*Power(S(ss1),2),2)));
+          case 272: return sqrt(3)*(((-1 + S(ss1))*(-1 + 2*S(ss1)))/(Power(1 + S(ss1),1.5)*sqrt((-1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)))) + (3 - 9*S(ss1) + 6*Power(S(ss1),2))/(S(ss1)*(1 + S(ss1))*sqrt((-1 + S(ss1))*(1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)))) + (6*sqrt((-1 + S(ss1))/(Power(1 + S(ss1),3)*(3 + 4*S(ss1)*(2 + S(ss1))))))/S(ss1));
+          case 273: return sqrt(6)/sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 274: return (-1 + S(ss1))*sqrt((S(ss1)*(-1 + 2*S(ss1)))/((-1 + Power(S(ss1),2))*(6 + 7*S(ss1) + 2*Power(S(ss1),2)))) + 3*(-1 + S(ss1))*S(ss1)*sqrt((-1 + 2*S(ss1))/(S(ss1)*Power(1 + S(ss1),3)*(-6 - S(ss1) + 5*Power(S(ss1),2) + 2*Power(S(ss1),3)))) + (6*sqrt((1 - 3*S(ss1) + 2*Power(S(ss1),2))/(S(ss1)*(6 + 13*S(ss1) + 9*Power(S(ss1),2) + 2*Power(S(ss1),3)))))/(1 + 3*S(ss1) + 2*Power(S(ss1),2)) + (9*(-1 + S(ss1))*sqrt((S(ss1)*(-1 + 2*S(ss1)))/(Power(1 + 2*S(ss1),2)*(-6 - 7*S(ss1) + 4*Power(S(ss1),2) + 7*Power(S(ss1),3) + 2*Power(S(ss1),4)))))/(1 + S(ss1));
+          case 275: return (sqrt(2)*(6*sqrt(S(ss1)*(-3 + 4*S(ss1)*(1 + S(ss1)))) + 7*sqrt(Power(S(ss1),3)*(-3 + 4*S(ss1)*(1 + S(ss1)))) + 2*sqrt(Power(S(ss1),5)*(-3 + 4*S(ss1)*(1 + S(ss1))))))/(S(ss1)*(2 + S(ss1))*(3 + 2*S(ss1))*sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))));
+          case 276: return (sqrt(S(ss1)*(2 + S(ss1))*(-1 + 2*S(ss1))*(3 + 2*S(ss1))) + 18*sqrt((S(ss1)*(-1 + 2*S(ss1)))/(6 + 7*S(ss1) + 2*Power(S(ss1),2))) + 2*sqrt((S(ss1)*(-3 + 4*S(ss1)*(1 + S(ss1))))/(2 + S(ss1))) + 2*S(ss1)*(sqrt(S(ss1)*(2 + S(ss1))*(-1 + 2*S(ss1))*(3 + 2*S(ss1))) + 6*sqrt((S(ss1)*(-1 + 2*S(ss1)))/(6 + 7*S(ss1) + 2*Power(S(ss1),2))) + 2*sqrt((S(ss1)*(-3 + 4*S(ss1)*(1 + S(ss1))))/(2 + S(ss1)))))/((3 + 2*S(ss1))*sqrt(S(ss1)*(2 + S(ss1))*(1 + 2*S(ss1))*(5 + 2*S(ss1))));
+          case 277: return 1;
+          case 278: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 279: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 280: return 1;
+          case 281: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 282: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 283: return 1;
+          case 284: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 285: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 286: return 1;
+          case 287: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 288: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 289: return 1;
+          case 290: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 291: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 292: return 1;
+          case 293: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 294: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 295: return 1;
+          case 296: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 297: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 298: return 1;
+          case 299: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 300: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 301: return 1;
+          case 302: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 303: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 304: return 1;
+          case 305: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 306: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 307: return 1;
+          case 308: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 309: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 310: return 1;
+          case 311: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 312: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 313: return 1;
+          case 314: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 315: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 316: return 1;
+          case 317: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 318: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 319: return 1;
+          case 320: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 321: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 322: return 1;
+          case 323: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 324: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 325: return 1;
+          case 326: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 327: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 328: return 1;
+          case 329: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 330: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 331: return 1;
+          case 332: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 333: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 334: return 1;
+          case 335: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 336: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 337: return 1;
+          case 338: return sqrt(3)/sqrt(S(ss1)*(-1 + 2*S(ss1)));
+          case 339: return sqrt(3)/(S(ss1)*sqrt(-1 + 4*Power(S(ss1),2)));
+          case 340: return sqrt(1 + 6/(1 - 2*S(ss1)) + 3/S(ss1));
+          case 341: return (2*(sqrt(-((1 + S(ss1))/(1 + S(ss1) - 2*Power(S(ss1),2)))) + S(ss1)*(-3 + 2*S(ss1))*sqrt(-((1 + S(ss1))/(1 + S(ss1) - 2*Power(S(ss1),2)))) + 3*sqrt((-1 + Power(S(ss1),2))/(1 + 2*S(ss1)))))/((1 + S(ss1))*sqrt(S(ss1)*(-1 + 4*Power(S(ss1),2))));
+          case 342: return sqrt(3)/(sqrt(S(ss1)*(1 + S(ss1)))*(1 + 2*S(ss1)));
+          case 343: return (3*sqrt(3/(1 + 2*S(ss1)) + S(ss1)*(-4 + S(ss1) + 2*Power(S(ss1),2))) + (-1 + S(ss1))*S(ss1)*(sqrt(((1 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)))/(-1 + S(ss1))) + 4*sqrt((-3 + S(ss1) + 4*Power(S(ss1),2)*(2 + S(ss1)))/((-1 + S(ss1))*(1 + 2*S(ss1))))))/(S(ss1)*(1 + S(ss1))*sqrt(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 344: return (sqrt(3)*(sqrt(Power(S(ss1),3)*(1 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))) + 3*sqrt((S(ss1)*(-1 + S(ss1) + 2*Power(S(ss1),2)))/(1 + 2*S(ss1))) + 4*S(ss1)*sqrt((S(ss1)*(-1 + S(ss1) + 2*Power(S(ss1),2)))/(1 + 2*S(ss1)))))/(S(ss1)*Power(1 + S(ss1),1.5)*sqrt(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 345: return (3*(1 + 2*S(ss1))*sqrt((S(ss1)*(-1 + S(ss1) + 2*Power(S(ss1),2)))/(3 + 2*S(ss1))) + 3*sqrt((S(ss1)*(-1 + 2*S(ss1)))/(3 + 5*S(ss1) + 2*Power(S(ss1),2))) + 3*(1 + 2*S(ss1))*sqrt((S(ss1)*(-1 + 2*S(ss1)))/(3 + 5*S(ss1) + 2*Power(S(ss1),2))) + (1 + 2*S(ss1))*sqrt(S(ss1)*(-3 + S(ss1) + 4*Power(S(ss1),2)*(2 + S(ss1)))))/(2.*(1 + S(ss1))*sqrt(S(ss1)*(2 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))));
+          case 346: return 1;
+          case 347: return sqrt(3)/sqrt(S(ss1)*(-1 + 2*S(ss1)));
+          case 348: return sqrt(3)/(S(ss1)*sqrt(-1 + 4*Power(S(ss1),2)));
+          case 349: return sqrt(1 + 6/(1 - 2*S(ss1)) + 3/S(ss1));
+          case 350: return (2*(sqrt(-((1 + S(ss1))/(1 + S(ss1) - 2*Power(S(ss1),2)))) + S(ss1)*(-3 + 2*S(ss1))*sqrt(-((1 + S(ss1))/(1 + S(ss1) - 2*Power(S(ss1),2)))) + 3*sqrt((-1 + Power(S(ss1),2))/(1 + 2*S(ss1)))))/((1 + S(ss1))*sqrt(S(ss1)*(-1 + 4*Power(S(ss1),2))));
+          case 351: return sqrt(3)/(sqrt(S(ss1)*(1 + S(ss1)))*(1 + 2*S(ss1)));
+          case 352: return (3*sqrt(3/(1 + 2*S(ss1)) + S(ss1)*(-4 + S(ss1) + 2*Power(S(ss1),2))) + (-1 + S(ss1))*S(ss1)*(sqrt(((1 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)))/(-1 + S(ss1))) + 4*sqrt((-3 + S(ss1) + 4*Power(S(ss1),2)*(2 + S(ss1)))/((-1 + S(ss1))*(1 + 2*S(ss1))))))/(S(ss1)*(1 + S(ss1))*sqrt(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 353: return (sqrt(3)*(sqrt(Power(S(ss1),3)*(1 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))) + 3*sqrt((S(ss1)*(-1 + S(ss1) + 2*Power(S(ss1),2)))/(1 + 2*S(ss1))) + 4*S(ss1)*sqrt((S(ss1)*(-1 + S(ss1) + 2*Power(S(ss1),2)))/(1 + 2*S(ss1)))))/(S(ss1)*Power(1 + S(ss1),1.5)*sqrt(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 354: return (3*(1 + 2*S(ss1))*sqrt((S(ss1)*(-1 + S(ss1) + 2*Power(S(ss1),2)))/(3 + 2*S(ss1))) + 3*sqrt((S(ss1)*(-1 + 2*S(ss1)))/(3 + 5*S(ss1) + 2*Power(S(ss1),2))) + 3*(1 + 2*S(ss1))*sqrt((S(ss1)*(-1 + 2*S(ss1)))/(3 + 5*S(ss1) + 2*Power(S(ss1),2))) + (1 + 2*S(ss1))*sqrt(S(ss1)*(-3 + S(ss1) + 4*Power(S(ss1),2)*(2 + S(ss1)))))/(2.*(1 + S(ss1))*sqrt(S(ss1)*(2 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))));
+          case 355: return 1;
+          case 356: return sqrt(3)/sqrt(S(ss1)*(-1 + 2*S(ss1)));
+          case 357: return sqrt(3)/(S(ss1)*sqrt(-1 + 4*Power(S(ss1),2)));
+          case 358: return sqrt(1 + 6/(1 - 2*S(ss1)) + 3/S(ss1));
+          case 359: return (2*(sqrt(-((1 + S(ss1))/(1 + S(ss1) - 2*Power(S(ss1),2)))) + S(ss1)*(-3 + 2*S(ss1))*sqrt(-((1 + S(ss1))/(1 + S(ss1) - 2*Power(S(ss1),2)))) + 3*sqrt((-1 + Power(S(ss1),2))/(1 + 2*S(ss1)))))/((1 + S(ss1))*sqrt(S(ss1)*(-1 + 4*Power(S(ss1),2))));
+          case 360: return sqrt(3)/(sqrt(S(ss1)*(1 + S(ss1)))*(1 + 2*S(ss1)));
+          case 361: return (3*sqrt(3/(1 + 2*S(ss1)) + S(ss1)*(-4 + S(ss1) + 2*Power(S(ss1),2))) + (-1 + S(ss1))*S(ss1)*(sqrt(((1 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)))/(-1 + S(ss1))) + 4*sqrt((-3 + S(ss1) + 4*Power(S(ss1),2)*(2 + S(ss1)))/((-1 + S(ss1))*(1 + 2*S(ss1))))))/(S(ss1)*(1 + S(ss1))*sqrt(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 362: return (sqrt(3)*(sqrt(Power(S(ss1),3)*(1 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))) + 3*sqrt((S(ss1)*(-1 + S(ss1) + 2*Power(S(ss1),2)))/(1 + 2*S(ss1))) + 4*S(ss1)*sqrt((S(ss1)*(-1 + S(ss1) + 2*Power(S(ss1),2)))/(1 + 2*S(ss1)))))/(S(ss1)*Power(1 + S(ss1),1.5)*sqrt(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 363: return (3*(1 + 2*S(ss1))*sqrt((S(ss1)*(-1 + S(ss1) + 2*Power(S(ss1),2)))/(3 + 2*S(ss1))) + 3*sqrt((S(ss1)*(-1 + 2*S(ss1)))/(3 + 5*S(ss1) + 2*Power(S(ss1),2))) + 3*(1 + 2*S(ss1))*sqrt((S(ss1)*(-1 + 2*S(ss1)))/(3 + 5*S(ss1) + 2*Power(S(ss1),2))) + (1 + 2*S(ss1))*sqrt(S(ss1)*(-3 + S(ss1) + 4*Power(S(ss1),2)*(2 + S(ss1)))))/(2.*(1 + S(ss1))*sqrt(S(ss1)*(2 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))));
+          case 364: return 1;
+          case 365: return sqrt(3)/sqrt(S(ss1)*(-1 + 2*S(ss1)));
+          case 366: return sqrt(3)/(S(ss1)*sqrt(-1 + 4*Power(S(ss1),2)));
+          case 367: return sqrt(1 + 6/(1 - 2*S(ss1)) + 3/S(ss1));
+          case 368: return (2*(sqrt(-((1 + S(ss1))/(1 + S(ss1) - 2*Power(S(ss1),2)))) + S(ss1)*(-3 + 2*S(ss1))*sqrt(-((1 + S(ss1))/(1 + S(ss1) - 2*Power(S(ss1),2)))) + 3*sqrt((-1 + Power(S(ss1),2))/(1 + 2*S(ss1)))))/((1 + S(ss1))*sqrt(S(ss1)*(-1 + 4*Power(S(ss1),2))));
+          case 369: return sqrt(3)/(sqrt(S(ss1)*(1 + S(ss1)))*(1 + 2*S(ss1)));
+          case 370: return (3*sqrt(3/(1 + 2*S(ss1)) + S(ss1)*(-4 + S(ss1) + 2*Power(S(ss1),2))) + (-1 + S(ss1))*S(ss1)*(sqrt(((1 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)))/(-1 + S(ss1))) + 4*sqrt((-3 + S(ss1) + 4*Power(S(ss1),2)*(2 + S(ss1)))/((-1 + S(ss1))*(1 + 2*S(ss1))))))/(S(ss1)*(1 + S(ss1))*sqrt(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 371: return (sqrt(3)*(sqrt(Power(S(ss1),3)*(1 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))) + 3*sqrt((S(ss1)*(-1 + S(ss1) + 2*Power(S(ss1),2)))/(1 + 2*S(ss1))) + 4*S(ss1)*sqrt((S(ss1)*(-1 + S(ss1) + 2*Power(S(ss1),2)))/(1 + 2*S(ss1)))))/(S(ss1)*Power(1 + S(ss1),1.5)*sqrt(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 372: return (3*(1 + 2*S(ss1))*sqrt((S(ss1)*(-1 + S(ss1) + 2*Power(S(ss1),2)))/(3 + 2*S(ss1))) + 3*sqrt((S(ss1)*(-1 + 2*S(ss1)))/(3 + 5*S(ss1) + 2*Power(S(ss1),2))) + 3*(1 + 2*S(ss1))*sqrt((S(ss1)*(-1 + 2*S(ss1)))/(3 + 5*S(ss1) + 2*Power(S(ss1),2))) + (1 + 2*S(ss1))*sqrt(S(ss1)*(-3 + S(ss1) + 4*Power(S(ss1),2)*(2 + S(ss1)))))/(2.*(1 + S(ss1))*sqrt(S(ss1)*(2 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))));
+          case 373: return 1;
+          case 374: return 1;
+          case 375: return 1;
+          case 376: return 1;
+          case 377: return 1;
+          case 378: return 1;
+          case 379: return 1;
+          case 380: return 1;
+          case 381: return 1;
+          case 382: return 1;
+          case 383: return 1;
+          case 384: return 1/S(ss1);
+          case 385: return 1/(S(ss1) + 2*Power(S(ss1),2));
+          case 386: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 387: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 388: return (sqrt(S(ss1)*(1 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))) + sqrt((S(ss1)*(-1 + 2*S(ss1)))/(1 + 3*S(ss1) + 2*Power(S(ss1),2))) + sqrt((S(ss1)*(-1 + 4*Power(S(ss1),2)))/(1 + S(ss1))))/sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 389: return 1;
+          case 390: return 1/S(ss1);
+          case 391: return 1/(S(ss1) + 2*Power(S(ss1),2));
+          case 392: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 393: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 394: return (sqrt(S(ss1)*(1 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))) + sqrt((S(ss1)*(-1 + 2*S(ss1)))/(1 + 3*S(ss1) + 2*Power(S(ss1),2))) + sqrt((S(ss1)*(-1 + 4*Power(S(ss1),2)))/(1 + S(ss1))))/sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 395: return 1;
+          case 396: return 1/S(ss1);
+          case 397: return 1/(S(ss1) + 2*Power(S(ss1),2));
+          case 398: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 399: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 400: return (sqrt(S(ss1)*(1 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))) + sqrt((S(ss1)*(-1 + 2*S(ss1)))/(1 + 3*S(ss1) + 2*Power(S(ss1),2))) + sqrt((S(ss1)*(-1 + 4*Power(S(ss1),2)))/(1 + S(ss1))))/sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 401: return 1;
+          case 402: return 1/S(ss1);
+          case 403: return 1/(S(ss1) + 2*Power(S(ss1),2));
+          case 404: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 405: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 406: return (sqrt(S(ss1)*(1 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))) + sqrt((S(ss1)*(-1 + 2*S(ss1)))/(1 + 3*S(ss1) + 2*Power(S(ss1),2))) + sqrt((S(ss1)*(-1 + 4*Power(S(ss1),2)))/(1 + S(ss1))))/sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 407: return 1;
+          case 408: return 1/S(ss1);
+          case 409: return 1/(S(ss1) + 2*Power(S(ss1),2));
+          case 410: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 411: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 412: return (sqrt(S(ss1)*(1 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))) + sqrt((S(ss1)*(-1 + 2*S(ss1)))/(1 + 3*S(ss1) + 2*Power(S(ss1),2))) + sqrt((S(ss1)*(-1 + 4*Power(S(ss1),2)))/(1 + S(ss1))))/sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 413: return 1;
+          case 414: return 1/S(ss1);
+          case 415: return 1/(S(ss1) + 2*Power(S(ss1),2));
+          case 416: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 417: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 418: return (sqrt(S(ss1)*(1 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))) + sqrt((S(ss1)*(-1 + 2*S(ss1)))/(1 + 3*S(ss1) + 2*Power(S(ss1),2))) + sqrt((S(ss1)*(-1 + 4*Power(S(ss1),2)))/(1 + S(ss1))))/sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 419: return 1;
+          case 420: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 421: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 422: return 1;
+          case 423: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 424: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 425: return 1;
+          case 426: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 427: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 428: return 1;
+          case 429: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 430: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 431: return 1;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(0, 3));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(0, 3));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -164,6 +164,7 @@ Opch<SC> SymmetryQSLR<SC>::recalc_irreduc(const Step &step, const DiagInfo<SC> &
 template<typename SC>
 MatrixElements<SC> SymmetryQSLR<SC>::recalc_doublet(const DiagInfo<SC> &diag, const SubspaceStructure &substruct, const MatrixElements<SC> &cold) const {
   MatrixElements<SC> cnew;
+  const auto blocks = std::make_shared<const BlockIndex<SC>>(cold, substruct);
   for(const auto &[I1, eig]: diag) {
     int q1 = I1.get("Q");
     int ss1 = I1.get("SS");
@@ -176,10 +177,58 @@ MatrixElements<SC> SymmetryQSLR<SC>::recalc_doublet(const DiagInfo<SC> &diag, co
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "qslr/qslr-2ch-doubletp.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 2},
+        {3, 3},
+        {4, 4},
+        {5, 4},
+        {5, 5},
+        {6, 6},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {10, 9},
+        {10, 10},
+        {11, 10},
+        {11, 11},
+        {12, 12},
+        {13, 12},
+        {13, 13},
+        {14, 14},
+        {15, 14},
+        {15, 15},
+        {16, 16}
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(1, 2, +1));
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 2: return 1/(1 + 2*S(ss1));
+          case 3: return -1;
+          case 4: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 5: return 1/(1 + 2*S(ss1));
+          case 6: return -1;
+          case 7: return 1;
+          case 8: return 1;
+          case 9: return 1;
+          case 10: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 11: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 12: return (S(ss1)*(3 + 2*S(ss1)))/sqrt(S(ss1)*(1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))));
+          case 13: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 14: return 1;
+          case 15: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 16: return 1/(1 + 2*S(ss1));
+          case 17: return -1;
+          case 18: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 19: return 1/(1 + 2*S(ss1));
+          case 20: return -1;
+          case 21: return 1;
+          default: my_assert_not_reached();
+        }
+      };
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(1, 2, +1));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -191,10 +240,58 @@ MatrixElements<SC> SymmetryQSLR<SC>::recalc_doublet(const DiagInfo<SC> &diag, co
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "qslr/qslr-2ch-doubletm.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {2, 3},
+        {3, 3},
+        {4, 4},
+        {4, 5},
+        {5, 5},
+        {6, 6},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {9, 10},
+        {10, 10},
+        {10, 11},
+        {11, 11},
+        {12, 12},
+        {12, 13},
+        {13, 13},
+        {14, 14},
+        {14, 15},
+        {15, 15},
+        {16, 16}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return -1;
+          case 2: return 1/(-1 - 2*S(ss1));
+          case 3: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 4: return -1;
+          case 5: return 1/(-1 - 2*S(ss1));
+          case 6: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 7: return 1;
+          case 8: return 1;
+          case 9: return 1;
+          case 10: return 1;
+          case 11: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 12: return (-1 + S(ss1) + 2*Power(S(ss1),2))/sqrt(S(ss1)*(1 + S(ss1))*(-1 + 4*Power(S(ss1),2)));
+          case 13: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 14: return sqrt((S(ss1)*(1 + 2*S(ss1)))/(Power(1 + S(ss1),3)*(3 + 2*S(ss1)))) + sqrt(S(ss1)/(Power(1 + S(ss1),3)*(3 + 4*S(ss1)*(2 + S(ss1))))) + sqrt(1 + 1/(1 + S(ss1)) - 6/(3 + 2*S(ss1)));
+          case 15: return -1;
+          case 16: return 1/(-1 - 2*S(ss1));
+          case 17: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 18: return -1;
+          case 19: return 1/(-1 - 2*S(ss1));
+          case 20: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 21: return 1;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(1, 2, +1));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(1, 2, +1));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -207,6 +304,7 @@ MatrixElements<SC> SymmetryQSLR<SC>::recalc_doublet(const DiagInfo<SC> &diag, co
 template<typename SC>
 MatrixElements<SC> SymmetryQSLR<SC>::recalc_triplet(const DiagInfo<SC> &diag, const SubspaceStructure &substruct, const MatrixElements<SC> &cold) const {
   MatrixElements<SC> cnew;
+  const auto blocks = std::make_shared<const BlockIndex<SC>>(cold, substruct);
   for(const auto &[I1, eig]: diag) {
     int q1 = I1.get("Q");
     int ss1 = I1.get("SS");
@@ -219,10 +317,70 @@ MatrixElements<SC> SymmetryQSLR<SC>::recalc_triplet(const DiagInfo<SC> &diag, co
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "qslr/qslr-2ch-triplets.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {2, 3},
+        {3, 2},
+        {3, 3},
+        {4, 4},
+        {4, 5},
+        {5, 4},
+        {5, 5},
+        {6, 6},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {9, 10},
+        {10, 9},
+        {10, 10},
+        {10, 11},
+        {11, 10},
+        {11, 11},
+        {12, 12},
+        {12, 13},
+        {13, 12},
+        {13, 13},
+        {14, 14},
+        {14, 15},
+        {15, 14},
+        {15, 15},
+        {16, 16}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 2: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 3: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 4: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 5: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 6: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 7: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 8: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 9: return 1;
+          case 10: return 1;
+          case 11: return 1;
+          case 12: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 13: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 14: return -(1/S(ss1));
+          case 15: return 1 - 1/S(ss1) + 1/(1 + S(ss1));
+          case 16: return 1/(1 + S(ss1));
+          case 17: return -((3 + 2*S(ss1))/((1 + S(ss1))*sqrt(3 + 4*S(ss1)*(2 + S(ss1)))));
+          case 18: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 19: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 20: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 21: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 22: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 23: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 24: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 25: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 26: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 27: return 1;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(0, 3, +1));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(0, 3, +1));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -234,10 +392,60 @@ MatrixElements<SC> SymmetryQSLR<SC>::recalc_triplet(const DiagInfo<SC> &diag, co
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "qslr/qslr-2ch-tripletp.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 2},
+        {3, 3},
+        {4, 4},
+        {5, 4},
+        {5, 5},
+        {6, 6},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {10, 9},
+        {10, 10},
+        {11, 9},
+        {11, 10},
+        {11, 11},
+        {12, 12},
+        {13, 12},
+        {13, 13},
+        {14, 14},
+        {15, 14},
+        {15, 15},
+        {16, 16}
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(0, 3, +1));
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 2: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 3: return 1;
+          case 4: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 5: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 6: return 1;
+          case 7: return 1;
+          case 8: return 1;
+          case 9: return 1;
+          case 10: return sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 11: return -(sqrt(3 + 4*S(ss1)*(2 + S(ss1)))/((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 12: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 13: return 1/(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 14: return -(1/(1 + S(ss1)));
+          case 15: return 1;
+          case 16: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 17: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 18: return 1;
+          case 19: return sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 20: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 21: return 1;
+          case 22: return 1;
+          default: my_assert_not_reached();
+        }
+      };
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(0, 3, +1));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -249,10 +457,60 @@ MatrixElements<SC> SymmetryQSLR<SC>::recalc_triplet(const DiagInfo<SC> &diag, co
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "qslr/qslr-2ch-tripletm.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {2, 3},
+        {3, 3},
+        {4, 4},
+        {4, 5},
+        {5, 5},
+        {6, 6},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {9, 10},
+        {9, 11},
+        {10, 10},
+        {10, 11},
+        {11, 11},
+        {12, 12},
+        {12, 13},
+        {13, 13},
+        {14, 14},
+        {14, 15},
+        {15, 15},
+        {16, 16}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 3: return (1/sqrt((S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1)))/(-1 + 2*S(ss1))) + 1/sqrt((S(ss1)*(1 + S(ss1)))/(-1 + 4*Power(S(ss1),2))))/2.;
+          case 4: return 1;
+          case 5: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 6: return (1/sqrt((S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1)))/(-1 + 2*S(ss1))) + 1/sqrt((S(ss1)*(1 + S(ss1)))/(-1 + 4*Power(S(ss1),2))))/2.;
+          case 7: return 1;
+          case 8: return 1;
+          case 9: return 1;
+          case 10: return 1;
+          case 11: return 1/S(ss1);
+          case 12: return 1/(S(ss1) + 2*Power(S(ss1),2));
+          case 13: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 14: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 15: return sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 16: return 1;
+          case 17: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 18: return (1/sqrt((S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1)))/(-1 + 2*S(ss1))) + 1/sqrt((S(ss1)*(1 + S(ss1)))/(-1 + 4*Power(S(ss1),2))))/2.;
+          case 19: return 1;
+          case 20: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 21: return (1/sqrt((S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1)))/(-1 + 2*S(ss1))) + 1/sqrt((S(ss1)*(1 + S(ss1)))/(-1 + 4*Power(S(ss1),2))))/2.;
+          case 22: return 1;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(0, 3, +1));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(0, 3, +1));
       if (cn) cnew[II] = *cn;
     }
   }
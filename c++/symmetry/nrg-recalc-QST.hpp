@@ -32,6 +32,7 @@ namespace NRG {
 template<typename SC>
 MatrixElements<SC> SymmetryQST<SC>::recalc_doublet(const DiagInfo<SC> &diag, const SubspaceStructure &substruct, const MatrixElements<SC> &cold) const {
   MatrixElements<SC> cnew;
+  const auto blocks = std::make_shared<const BlockIndex<SC>>(cold, substruct);
   for(const auto &[I1, eig]: diag) {
     int q1  = I1.get("Q");
     int ss1  = I1.get("SS");
@@ -51,10 +52,384 @@ MatrixElements<SC> SymmetryQST<SC>::recalc_doublet(const DiagInfo<SC> &diag, con
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "qst/qst-doubletp-1.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {2, 3},
+        {2, 4},
+        {3, 3},
+        {3, 4},
+        {4, 4},
+        {5, 2},
+        {5, 3},
+        {5, 4},
+        {5, 5},
+        {5, 6},
+        {5, 7},
+        {6, 3},
+        {6, 4},
+        {6, 6},
+        {6, 7},
+        {7, 4},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {9, 10},
+        {9, 11},
+        {10, 10},
+        {10, 11},
+        {10, 12},
+        {11, 11},
+        {11, 12},
+        {11, 13},
+        {12, 12},
+        {12, 13},
+        {13, 13},
+        {14, 14},
+        {14, 15},
+        {14, 16},
+        {15, 15},
+        {15, 16},
+        {16, 16},
+        {17, 14},
+        {17, 15},
+        {17, 16},
+        {17, 17},
+        {17, 18},
+        {17, 19},
+        {18, 15},
+        {18, 16},
+        {18, 18},
+        {18, 19},
+        {19, 16},
+        {19, 19},
+        {20, 17},
+        {20, 18},
+        {20, 19},
+        {20, 20},
+        {20, 21},
+        {20, 22},
+        {21, 18},
+        {21, 19},
+        {21, 21},
+        {21, 22},
+        {22, 19},
+        {22, 22},
+        {23, 23},
+        {23, 24},
+        {23, 25},
+        {24, 24},
+        {24, 25},
+        {25, 25},
+        {26, 23},
+        {26, 24},
+        {26, 25},
+        {26, 26},
+        {26, 27},
+        {26, 28},
+        {27, 24},
+        {27, 25},
+        {27, 27},
+        {27, 28},
+        {28, 25},
+        {28, 28},
+        {29, 29},
+        {29, 30},
+        {29, 31},
+        {30, 30},
+        {30, 31},
+        {30, 32},
+        {31, 31},
+        {31, 32},
+        {31, 33},
+        {32, 32},
+        {32, 33},
+        {33, 33},
+        {34, 29},
+        {34, 30},
+        {34, 31},
+        {34, 34},
+        {34, 35},
+        {34, 36},
+        {35, 30},
+        {35, 31},
+        {35, 32},
+        {35, 35},
+        {35, 36},
+        {35, 37},
+        {36, 31},
+        {36, 32},
+        {36, 33},
+        {36, 36},
+        {36, 37},
+        {36, 38},
+        {37, 32},
+        {37, 33},
+        {37, 37},
+        {37, 38},
+        {38, 33},
+        {38, 38},
+        {39, 39},
+        {40, 39},
+        {40, 40},
+        {41, 40},
+        {41, 41},
+        {42, 41},
+        {42, 42},
+        {43, 43},
+        {44, 44},
+        {44, 45},
+        {44, 46},
+        {45, 45},
+        {45, 46},
+        {45, 47},
+        {46, 46},
+        {46, 47},
+        {46, 48},
+        {47, 47},
+        {47, 48},
+        {48, 48},
+        {49, 49},
+        {49, 50},
+        {49, 51},
+        {50, 50},
+        {50, 51},
+        {51, 51},
+        {52, 49},
+        {52, 50},
+        {52, 51},
+        {52, 52},
+        {52, 53},
+        {52, 54},
+        {53, 50},
+        {53, 51},
+        {53, 53},
+        {53, 54},
+        {54, 51},
+        {54, 54},
+        {55, 52},
+        {55, 53},
+        {55, 54},
+        {55, 55},
+        {55, 56},
+        {55, 57},
+        {56, 53},
+        {56, 54},
+        {56, 56},
+        {56, 57},
+        {57, 54},
+        {57, 57},
+        {58, 58},
+        {58, 59},
+        {58, 60},
+        {59, 59},
+        {59, 60},
+        {60, 60},
+        {61, 58},
+        {61, 59},
+        {61, 60},
+        {61, 61},
+        {61, 62},
+        {61, 63},
+        {62, 59},
+        {62, 60},
+        {62, 62},
+        {62, 63},
+        {63, 60},
+        {63, 63},
+        {64, 64}
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(1, 2, 1));
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1 ;
+          case 1: return (-2*sqrt(S*(1 + S)))/(1 + 2*S) ;
+          case 2: return (-2*sqrt(S*(1 + S)))/(T + 2*S*T) ;
+          case 3: return (-2*sqrt(S*(1 + S)))/((1 + 2*T)*(T + 2*S*T)) ;
+          case 4: return -2*sqrt((1 + S)/(1 + 2*S + T + 2*S*T))*(-sqrt(S/((1 + 2*S)*(-1 + T))) + sqrt((S*(-1 + T))/((1 + 2*S)*Power(T,2))) + sqrt(S/((1 + 2*S)*(-1 + T)))*T) ;
+          case 5: return (-2*sqrt((S*(1 + S)*(-1 + 2*T))/(1 + 2*T)))/(T + 2*S*T) ;
+          case 6: return (-2*(sqrt((S*(-1 + 2*T))/((1 + 2*S)*(1 + T))) + sqrt((S*(-1 + 2*T))/((1 + 2*S)*(1 + T)*Power(1 + 2*T,2))) + sqrt((S*(-1 + T + 2*Power(T,2)))/(1 + 2*S))))/sqrt(((1 + 2*S)*(1 + T)*(3 + 2*T))/(1 + S)) ;
+          case 7: return 1/(1 + 2*S) ;
+          case 8: return 1/(T + 2*S*T) ;
+          case 9: return 1/((1 + 2*T)*(T + 2*S*T)) ;
+          case 10: return -1 ;
+          case 11: return -(1/T) ;
+          case 12: return -(1/(T + 2*Power(T,2))) ;
+          case 13: return sqrt(-1 + Power(T,2))/(T + 2*S*T) ;
+          case 14: return sqrt(1 - 2/(1 + 2*T))/(T + 2*S*T) ;
+          case 15: return -(sqrt(-1 + Power(T,2))/T) ;
+          case 16: return -(sqrt(1 - 2/(1 + 2*T))/T) ;
+          case 17: return sqrt(-3 + 4*T*(1 + T))/((1 + 2*S)*(1 + 2*T)) ;
+          case 18: return -(sqrt(-3 + 4*T*(1 + T))/(1 + 2*T)) ;
+          case 19: return 1 ;
+          case 20: return 1 ;
+          case 21: return sqrt(2)/sqrt((-1 + T)*T) ;
+          case 22: return sqrt(6)/sqrt((-1 + T)*T*(-1 + 2*T)*(1 + 2*T)) ;
+          case 23: return ((1 + T)*sqrt(((-2 + T)*T)/(-1 + Power(T,2))))/T ;
+          case 24: return ((1 + T)*sqrt(3 - 30/(1 + T) + 36/(1 + 2*T)))/((-1 + T)*T) ;
+          case 25: return 3/(T + 2*Power(T,2)) ;
+          case 26: return (9 - 13*Power(T,2) + 4*Power(T,4))/(T*sqrt(-9 + Power(T,2)*Power(7 - 4*Power(T,2),2))) ;
+          case 27: return (sqrt(3)*(-3 + T + 2*Power(T,2)))/(T*sqrt((-1 + T)*(1 + T)*(1 + 2*T)*(3 + 2*T))) ;
+          case 28: return sqrt(6)/sqrt(T*(1 + T)*(1 + 2*T)*(3 + 2*T)) ;
+          case 29: return (6*sqrt(((-1 + T)*T*(2 + T)*(-1 + 2*T)*(3 + 2*T))/(1 + 2*T)) - 9*sqrt((Power(T,3)*(2 + T)*(-1 + 2*T)*(3 + 2*T))/((-1 + T)*(1 + 2*T))) + 9*sqrt((Power(T,5)*(2 + T)*(-1 + 2*T)*(3 + 2*T))/((-1 + T)*(1 + 2*T))) - 4*sqrt((Power(T,3)*(2 + T)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T))/(-1 + T)) + 3*sqrt((Power(T,5)*(2 + T)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T))/(-1 + T)) + sqrt((Power(T,7)*(2 + T)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T))/(-1 + T)))/(T*Power(1 + T,1.5)*(2 + T)*sqrt(1 + 2*T)*(3 + 2*T)) ;
+          case 30: return sqrt((-2 + 4*T)/(T + 3*Power(T,2) + 2*Power(T,3))) ;
+          case 31: return (5 + 2*T)*sqrt((-1 + 2*T)/(15 + 46*T + 36*Power(T,2) + 8*Power(T,3))) ;
+          case 32: return (-1 + 2*S)*sqrt(-((1 + S)/(S - 4*Power(S,3)))) ;
+          case 33: return ((-1 + 2*S)*sqrt(-((1 + S)/(S - 4*Power(S,3)))))/T ;
+          case 34: return 1/sqrt((S*(1 + 2*S)*Power(T + 2*Power(T,2),2))/(-1 + S + 2*Power(S,2))) ;
+          case 35: return sqrt(((-1 + S + 2*Power(S,2))*(-1 + Power(T,2)))/(S*(1 + 2*S)))/T ;
+          case 36: return ((-1 + 2*S)*sqrt(((1 + S)*(-1 + 2*T))/((-S + 4*Power(S,3))*(1 + 2*T))))/T ;
+          case 37: return (2*sqrt((T*(-1 + 2*T))/(1 + T)) + 2*T*sqrt((T*(-1 + 2*T))/(1 + T)) + sqrt(T*(-1 + T + 2*Power(T,2))) + 2*sqrt(Power(T,3)*(-1 + T + 2*Power(T,2))))/((1 + 2*T)*sqrt((S*(1 + 2*S)*T*(1 + T)*(3 + 2*T))/(-1 + S + 2*Power(S,2)))) ;
+          case 38: return -(1/sqrt(S*(1 + 2*S))) ;
+          case 39: return -(1/(sqrt(S*(1 + 2*S))*T)) ;
+          case 40: return -(1/(sqrt(S*(1 + 2*S))*T*(1 + 2*T))) ;
+          case 41: return (3 + 2*S)*sqrt(S/(3 + 11*S + 12*Power(S,2) + 4*Power(S,3))) ;
+          case 42: return (3 + 2*S)*sqrt(S/((3 + 11*S + 12*Power(S,2) + 4*Power(S,3))*Power(T,2))) ;
+          case 43: return (3 + 2*S)*sqrt(S/((3 + 11*S + 12*Power(S,2) + 4*Power(S,3))*Power(T + 2*Power(T,2),2))) ;
+          case 44: return -(sqrt((-1 + Power(T,2))/(S*(1 + 2*S)))/T) ;
+          case 45: return -((-((1 + S)*(-1 + 2*S)*Power(T,2.5)*Power(1 + T,2)*sqrt(S*(1 + S)*(-1 + 4*Power(T,2)))) - (1 + S)*(-1 + 2*S)*T*Power(1 + T,2)*sqrt(S*(1 + S)*T*(-1 + 4*Power(T,2))) + 2*S*sqrt(S*Power(1 + S,3)*Power(T,3)*Power(1 + T,4)*(-1 + 4*Power(T,2))) + 2*S*T*sqrt(S*Power(1 + S,3)*Power(T,3)*Power(1 + T,4)*(-1 + 4*Power(T,2))))/(Power(1 + S,1.5)*sqrt(1 + 2*S)*Power(T,2.5)*Power(1 + T,3)*(S + 2*S*T))) ;
+          case 46: return (sqrt(-1 + T)*(S*(3 + 2*S)*T*sqrt(S*(1 + S)*(1 + 2*S)*(3 + 2*S)*(1 + T)) + 3*sqrt(Power(S,3)*(1 + S)*(1 + 2*S)*(3 + 2*S)*(1 + T)) + 2*sqrt(Power(S,5)*(1 + S)*(1 + 2*S)*(3 + 2*S)*(1 + T))))/(S*(1 + S)*(3 + 4*S*(2 + S))*T*(1 + T)) ;
+          case 47: return (3*sqrt((Power(S,3)*(1 + S)*(-1 + 2*T))/((3 + 4*S*(2 + S))*(1 + 2*T))) + 2*sqrt((Power(S,5)*(1 + S)*(-1 + 2*T))/((3 + 4*S*(2 + S))*(1 + 2*T))))/(S*(1 + S)*T) ;
+          case 48: return -(sqrt((-3 + 4*T*(1 + T))/(S*(1 + 2*S)))/(1 + 2*T)) ;
+          case 49: return ((4*S*sqrt((S*(-1 + T + 2*Power(T,2)))/(3 + 4*S*(2 + S))))/(1 + 2*T) + 2*sqrt((Power(S,3)*(-1 + T + 2*Power(T,2)))/(3 + 4*S*(2 + S))) + 3*(sqrt((S*(-1 + 2*T))/((3 + 4*S*(2 + S))*(1 + T))) + sqrt((S*(-1 + 2*T))/((3 + 4*S*(2 + S))*(1 + T)*Power(1 + 2*T,2))) + sqrt((S*(-1 + T + 2*Power(T,2)))/(3 + 4*S*(2 + S)))))/sqrt((1 + S)*(1 + T)*(3 + 2*T)) ;
+          case 50: return -(1/sqrt((1 + S)*(1 + 2*S))) ;
+          case 51: return (-sqrt(((3 + 2*S)*T)/(1 + S)) - 2*sqrt((1 + S)*(3 + 2*S)*T) + 4*S*(sqrt(((3 + 2*S)*T)/(1 + S)) + S*sqrt(((3 + 2*S)*T)/(1 + S)) - sqrt((1 + S)*(3 + 2*S)*T)))/(Power(3 + 2*S,1.5)*T*sqrt(T + 2*S*T)) ;
+          case 52: return -(1/(sqrt(1 + 3*S + 2*Power(S,2))*(T + 2*Power(T,2)))) ;
+          case 53: return 1 ;
+          case 54: return 1/T ;
+          case 55: return 1/(T + 2*Power(T,2)) ;
+          case 56: return ((4*S*sqrt((-1 + T)/(1 + 2*S)) - 3*sqrt((1 + 2*S)*(-1 + T)))*(1 + T))/((3 + 2*S)*T*sqrt((1 + S)*(1 + T))) ;
+          case 57: return -(sqrt((-1 + 2*T)/((1 + 3*S + 2*Power(S,2))*(1 + 2*T)))/T) ;
+          case 58: return sqrt(-1 + Power(T,2))/T ;
+          case 59: return sqrt(-1 + 4*Power(T,2))/(T + 2*Power(T,2)) ;
+          case 60: return -(sqrt((-3 + 4*T*(1 + T))/((1 + S)*(1 + 2*S)))/(1 + 2*T)) ;
+          case 61: return (sqrt((3 + 2*S)*(1 + T)*(-1 + 2*T)*(1 + 2*T)) + 2*sqrt(((3 + 2*S)*(-1 + 4*Power(T,2)))/(1 + T)) + 2*T*(sqrt((3 + 2*S)*(1 + T)*(-1 + 2*T)*(1 + 2*T)) + sqrt(((3 + 2*S)*(-1 + 4*Power(T,2)))/(1 + T))))/((1 + 2*T)*sqrt((3 + 2*S)*(1 + T)*(1 + 2*T)*(3 + 2*T))) ;
+          case 62: return (-2*sqrt(S*(1 + S)))/(1 + 2*S) ;
+          case 63: return (-2*sqrt(S*(1 + S)))/(T + 2*S*T) ;
+          case 64: return (-2*sqrt(S*(1 + S)))/((1 + 2*T)*(T + 2*S*T)) ;
+          case 65: return -2*sqrt((1 + S)/(1 + 2*S + T + 2*S*T))*(-sqrt(S/((1 + 2*S)*(-1 + T))) + sqrt((S*(-1 + T))/((1 + 2*S)*Power(T,2))) + sqrt(S/((1 + 2*S)*(-1 + T)))*T) ;
+          case 66: return (-2*sqrt((S*(1 + S)*(-1 + 2*T))/(1 + 2*T)))/(T + 2*S*T) ;
+          case 67: return (-2*(sqrt((S*(-1 + 2*T))/((1 + 2*S)*(1 + T))) + sqrt((S*(-1 + 2*T))/((1 + 2*S)*(1 + T)*Power(1 + 2*T,2))) + sqrt((S*(-1 + T + 2*Power(T,2)))/(1 + 2*S))))/sqrt(((1 + 2*S)*(1 + T)*(3 + 2*T))/(1 + S)) ;
+          case 68: return 1/(1 + 2*S) ;
+          case 69: return 1/(T + 2*S*T) ;
+          case 70: return 1/((1 + 2*T)*(T + 2*S*T)) ;
+          case 71: return -1 ;
+          case 72: return -(1/T) ;
+          case 73: return -(1/(T + 2*Power(T,2))) ;
+          case 74: return sqrt(-1 + Power(T,2))/(T + 2*S*T) ;
+          case 75: return sqrt(1 - 2/(1 + 2*T))/(T + 2*S*T) ;
+          case 76: return -(sqrt(-1 + Power(T,2))/T) ;
+          case 77: return -(sqrt(1 - 2/(1 + 2*T))/T) ;
+          case 78: return sqrt(-3 + 4*T*(1 + T))/((1 + 2*S)*(1 + 2*T)) ;
+          case 79: return -(sqrt(-3 + 4*T*(1 + T))/(1 + 2*T)) ;
+          case 80: return (-2*sqrt(S*(1 + S)))/(1 + 2*S) ;
+          case 81: return (-2*sqrt(2)*sqrt((S*(1 + S))/((-1 + T)*T)))/(1 + 2*S) ;
+          case 82: return -2*sqrt(6)*sqrt((S*(1 + S))/(Power(1 + 2*S,2)*(T - Power(T,2) - 4*Power(T,3) + 4*Power(T,4)))) ;
+          case 83: return -2*sqrt(((1 + S)*(-1 + 2*T))/((1 + 2*S)*(1 + T)))*((-3 + T)*T*sqrt(S/((1 + 2*S)*T*(-2 + 7*T - 7*Power(T,2) + 2*Power(T,3)))) + 2*(sqrt(S/((1 + 2*S)*T*(-2 + 7*T - 7*Power(T,2) + 2*Power(T,3)))) + sqrt((S*(-2 + T))/((1 + 2*S)*(T - 3*Power(T,2) + 2*Power(T,3)))))) ;
+          case 84: return (-2*sqrt(3)*sqrt(((1 + S)*(-1 + 2*T))/((1 + 2*S)*(1 + T)))*(2*sqrt((S*(-3 + 2*T))/((1 + 2*S)*(1 - T - 4*Power(T,2) + 4*Power(T,3)))) + 3*sqrt(S/((1 + 2*S)*(-3 + 5*T + 10*Power(T,2) - 20*Power(T,3) + 8*Power(T,4)))) + T*(-5 + 2*T)*sqrt(S/((1 + 2*S)*(-3 + 5*T + 10*Power(T,2) - 20*Power(T,3) + 8*Power(T,4))))))/T ;
+          case 85: return (-6*sqrt(S*(1 + S)))/((1 + 2*S)*(T + 2*Power(T,2))) ;
+          case 86: return -2*sqrt((1 + S)/(1 + 2*S))*((6*sqrt((S*(3 - 5*T + 2*Power(T,2)))/((1 + 2*S)*(-3 - 5*T + 10*Power(T,2) + 20*Power(T,3) + 8*Power(T,4)))))/T + 3*(3 + 4*(-2 + T)*T)*sqrt((S*(-1 + T))/((1 + 2*S)*Power(T,2)*(9 + 9*T - 40*Power(T,2) - 40*Power(T,3) + 16*Power(T,4) + 16*Power(T,5)))) + (-1 + T)*(-3 + 2*T)*(-1 + 2*T)*sqrt(S/((1 + 2*S)*(-9 + Power(T,2)*Power(7 - 4*Power(T,2),2))))) ;
+          case 87: return (-2*sqrt(3)*(-3 + T + 2*Power(T,2))*sqrt((S*(1 + S))/(Power(1 + 2*S,2)*(-3 - 8*T - Power(T,2) + 8*Power(T,3) + 4*Power(T,4)))))/T ;
+          case 88: return (-2*sqrt(3 + 3/(1 + 2*S))*(-sqrt((S*T)/(1 + 2*S + 2*T + 4*S*T)) + 3*sqrt(S/((1 + 2*S)*(T + 2*Power(T,2)))) + 2*T*(sqrt((S*T)/(1 + 2*S + 2*T + 4*S*T)) + 3*sqrt(S/((1 + 2*S)*(T + 2*Power(T,2)))))))/Power((1 + T)*(3 + 2*T),1.5) ;
+          case 89: return (-2*sqrt((1 + S)/(T + 2*S*T))*(6*sqrt((S*(-1 + T)*(2 + T)*(-1 + 2*T)*(3 + 2*T))/((1 + 2*S)*(1 + T))) + (-1 + T)*T*(sqrt((S*(1 + T)*(2 + T)*(-1 + 2*T)*(3 + 2*T))/((1 + 2*S)*(-1 + T))) + 12*sqrt((S*(2 + T)*(-1 + 2*T)*(3 + 2*T))/((1 + 2*S)*(-1 + Power(T,2)))) + 2*T*(sqrt((S*(1 + T)*(2 + T)*(-1 + 2*T)*(3 + 2*T))/((1 + 2*S)*(-1 + T))) + 3*sqrt((S*(2 + T)*(-1 + 2*T)*(3 + 2*T))/((1 + 2*S)*(-1 + Power(T,2))))))))/((1 + T)*(2 + T)*(1 + 2*T)*(3 + 2*T)) ;
+          case 90: return -2*sqrt(2)*sqrt((1 + S)/(Power(2 + T,3)*(T + 2*S*T)*Power(3 + 5*T + 2*Power(T,2),2)))*(6*sqrt((S*(2 + T)*(-1 + 2*T))/((1 + 2*S)*(1 + T)*(1 + 2*T))) + T*(9*sqrt((S*(2 + T)*(-1 + 2*T))/((1 + 2*S)*(1 + T)*(1 + 2*T))) + 3*sqrt((S*(2 + T)*(-1 + 2*T)*(1 + 2*T))/((1 + 2*S)*(1 + T))) + sqrt((S*(1 + T)*(2 + T)*(-1 + 2*T)*(1 + 2*T))/(1 + 2*S)))) ;
+          case 91: return (-2*(2*sqrt((S*(1 + T)*(-1 + 2*T)*(1 + 2*T))/((1 + 2*S)*(2 + T))) + sqrt((S*(1 + T)*(2 + T)*(-1 + 2*T)*(1 + 2*T))/(1 + 2*S)) + (6*sqrt((S*(1 + T)*(-1 + 2*T)*(1 + 2*T))/((1 + 2*S)*(2 + T))))/(3 + 2*T) + (6*sqrt((S*(-1 + 4*Power(T,2)))/((1 + 2*S)*(2 + 3*T + Power(T,2)))))/(3 + 2*T) + (6*sqrt((S*(-1 + 2*T))/((1 + 2*S)*(2 + 7*T + 7*Power(T,2) + 2*Power(T,3)))))/(3 + 2*T)))/sqrt(((1 + 2*S)*(1 + T)*(2 + T)*(3 + 2*T)*(5 + 2*T))/(1 + S)) ;
+          case 92: return 1/(1 + 2*S) ;
+          case 93: return sqrt(2)/((1 + 2*S)*sqrt((-1 + T)*T)) ;
+          case 94: return sqrt(6)/((1 + 2*S)*sqrt((-1 + T)*T*(-1 + 2*T)*(1 + 2*T))) ;
+          case 95: return -1 ;
+          case 96: return -(sqrt(2)/sqrt((-1 + T)*T)) ;
+          case 97: return -((sqrt((6 + 12*S)/(1 - 3*T + 2*Power(T,2)))*(2*sqrt(((3 + 2*S)*T*(1 + 2*T))/(1 + 2*S)) + sqrt((3 + 4*S*(2 + S))*T*(1 + 2*T))))/(Power(3 + 2*S,1.5)*T*(1 + 2*T))) ;
+          case 98: return ((-2 + T)*(1 + T))/((1 + 2*S)*sqrt((-2 + T)*(-1 + T)*T*(1 + T))) ;
+          case 99: return (sqrt(3)*(1 + T)*(-3 + 2*T))/(sqrt((-1 + T)*(1 + T)*(-3 + 2*T)*(1 + 2*T))*(T + 2*S*T)) ;
+          case 100: return 3/((1 + 2*S)*(T + 2*Power(T,2))) ;
+          case 101: return -(sqrt(((-2 + T)*(-1 + T)*(1 + T))/T)/(-1 + T)) ;
+          case 102: return (sqrt(3)*(3 + T - 2*Power(T,2)))/(T*sqrt((-1 + T)*(1 + T)*(-3 + 2*T)*(1 + 2*T))) ;
+          case 103: return -3/(T + 2*Power(T,2)) ;
+          case 104: return (9 - 13*Power(T,2) + 4*Power(T,4))/((T + 2*S*T)*sqrt(-9 + Power(T,2)*Power(7 - 4*Power(T,2),2))) ;
+          case 105: return sqrt(3)*sqrt(1 + S)*((-12*S)/((1 + 2*S)*T*(1 + T)*sqrt(((1 + S)*(1 + T)*(1 + 2*T)*(3 + 2*T))/(-1 + T))) - (6*S*(-1 + T)*(-1 + 2*T))/((1 + 2*S)*T*(1 + T)*sqrt((1 + S)*(-1 + T)*(1 + T)*(1 + 2*T)*(3 + 2*T))) - (2*S*(-1 + T)*T*(-1 + 2*T))/((1 + 2*S)*sqrt((1 + S)*(-1 + T)*Power(T,2)*Power(1 + T,3)*(1 + 2*T)*(3 + 2*T))) + (-1 + T)*(-1 + 2*T)*sqrt(1/((1 + S)*Power(1 + T,3)*(-3 - 5*T + 4*Power(T,2) + 4*Power(T,3)))) + 3*(-1 + T)*(-1 + 2*T)*sqrt(1/((1 + S)*Power(T,2)*Power(1 + T,3)*(-3 - 5*T + 4*Power(T,2) + 4*Power(T,3)))) + (6*sqrt((-1 + T)/((1 + S)*(3 + 11*T + 12*Power(T,2) + 4*Power(T,3)))))/(T + Power(T,2))) ;
+          case 106: return sqrt(6)/((1 + 2*S)*sqrt(T*(1 + T)*(1 + 2*T)*(3 + 2*T))) ;
+          case 107: return -(((1 + T)*(3 + 2*T)*sqrt((3 - 5*T + 2*Power(T,2))/(-3 - 5*T + 10*Power(T,2) + 20*Power(T,3) + 8*Power(T,4))))/T) ;
+          case 108: return -((sqrt(3)*(-1 + T)*(3 + 2*T))/(T*sqrt((-1 + T)*(1 + T)*(1 + 2*T)*(3 + 2*T)))) ;
+          case 109: return -((sqrt(6)*(6*sqrt((3 + 2*S)*(1 + T)*(3 + 2*T)) - 9*sqrt((3 + 2*S)/(3 + 5*T + 2*Power(T,2))) + T*(-sqrt((3 + 2*S)*(1 + T)*(3 + 2*T)) + 3*sqrt((3 + 2*S)/(3 + 5*T + 2*Power(T,2))) + 2*T*(sqrt((3 + 2*S)*(1 + T)*(3 + 2*T)) + 12*sqrt((3 + 2*S)/(3 + 5*T + 2*Power(T,2))) + 6*T*sqrt((3 + 2*S)/(3 + 5*T + 2*Power(T,2)))))))/(Power(1 + T,2)*sqrt((3 + 2*S)*T*(1 + 2*T))*Power(3 + 2*T,2))) ;
+          case 110: return sqrt(2)*sqrt(1 + S)*(((-1 + T)*T)/(sqrt(2)*sqrt(((1 + S)*(-1 + T)*T*(1 + T)*(2 + T)*(3 + 2*T))/(-1 + 2*T))) + (3*(-1 + T)*T)/(sqrt(2)*sqrt(((1 + S)*(-1 + T)*T*Power(1 + T,3)*(2 + T)*(3 + 2*T))/(-1 + 2*T))) + (9*(-1 + T))/(sqrt(2)*(1 + T)*sqrt(((1 + S)*(-1 + T)*(1 + T)*(2 + T)*Power(1 + 2*T,2)*(3 + 2*T))/(T*(-1 + 2*T)))) - (6*sqrt(2)*S*sqrt(-3 + 1/T + 2*T))/((1 + 2*S)*(1 + T)*(1 + 2*T)*sqrt((1 + S)*(1 + T)*(2 + T)*(3 + 2*T))) - (S*(-1 + T)*T)/((1 + 2*S)*sqrt(((1 + S)*T*(2 + T)*(3 + 2*T)*(-1 + Power(T,2)))/(-2 + 4*T))) - (9*S*T)/((1 + 2*S)*(1 + T)*(1 + 2*T)*sqrt(((1 + S)*T*(1 + T)*(2 + T)*(3 + 2*T))/(2 - 6*T + 4*Power(T,2)))) + (3*sqrt((2 - 6*T + 4*Power(T,2))/((1 + S)*T*(1 + T)*Power(1 + 2*T,2)*(6 + 7*T + 2*Power(T,2)))))/(1 + T) - 3*sqrt(2)*(-1 + T)*T*sqrt((Power(S,2)*(-1 + 2*T))/((1 + S)*Power(1 + 2*S,2)*T*Power(1 + T,3)*(-6 - T + 5*Power(T,2) + 2*Power(T,3))))) ;
+          case 111: return (sqrt(2)*(-1 + 2*T))/((1 + 2*S)*sqrt(T*(1 + T)*(-1 + 2*T)*(1 + 2*T))) ;
+          case 112: return (-6*sqrt(-2 + T + 3/(1 + 2*T)) - (-1 + T)*T*(4*sqrt(4 + 3/(-1 + T) + 4*T) + T*sqrt(4 + 3/(-1 + T) + 4*T) + 9*sqrt((1 - 2*T)/(1 + T - 2*Power(T,2)))))/((1 + T)*sqrt(T*(1 + T)*(2 + T)*(1 + 2*T)*(3 + 2*T))) ;
+          case 113: return -sqrt((-2 + 4*T)/(T + 3*Power(T,2) + 2*Power(T,3))) ;
+          case 114: return (-12*S*sqrt(((1 + S)*T*(-1 + 2*T)*(1 + 2*T)*(5 + 2*T))/((1 + 2*S)*(2 + T)*(3 + 2*T))) - 12*S*(1 + T)*sqrt(((1 + S)*T*(-1 + 2*T)*(1 + 2*T)*(5 + 2*T))/((1 + 2*S)*(2 + T)*(3 + 2*T))) + 6*sqrt(((1 + S)*(1 + 2*S)*T*(-1 + 2*T)*(1 + 2*T)*(5 + 2*T))/((2 + T)*(3 + 2*T))) + 6*(1 + T)*sqrt(((1 + S)*(1 + 2*S)*T*(-1 + 2*T)*(1 + 2*T)*(5 + 2*T))/((2 + T)*(3 + 2*T))) - 4*S*(1 + T)*sqrt(((1 + S)*T*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T)*(5 + 2*T))/((1 + 2*S)*(2 + T))) + 2*(1 + T)*sqrt(((1 + S)*(1 + 2*S)*T*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T)*(5 + 2*T))/(2 + T)) - 2*S*sqrt(((1 + S)*T*(2 + T)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T)*(5 + 2*T))/(1 + 2*S)) - 2*S*T*sqrt(((1 + S)*T*(2 + T)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T)*(5 + 2*T))/(1 + 2*S)) + (1 + T)*sqrt((1 + S)*(1 + 2*S)*T*(2 + T)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T)*(5 + 2*T)) - 12*S*sqrt(((1 + S)*T*(-5 + 8*T + 4*Power(T,2)))/((1 + 2*S)*(6 + 19*T + 16*Power(T,2) + 4*Power(T,3)))) + 6*sqrt(((1 + S)*(1 + 2*S)*T*(-5 + 4*T*(2 + T)))/((2 + T)*(1 + 2*T)*(3 + 2*T))))/((1 + T)*sqrt((1 + S)*(1 + 2*S)*T*(2 + T))*(3 + 2*T)*(5 + 2*T)) ;
+          case 115: return -sqrt((-5 + 4*T*(2 + T))/(3 + 4*T*(2 + T))) ;
+          case 116: return -2*sqrt((-1 + Power(S,2))/(-1 + 4*Power(S,2))) ;
+          case 117: return sqrt(3)/sqrt(-1 + 4*Power(S,2)) ;
+          case 118: return -(sqrt(-3 + 4*S*(1 + S))/(1 + 2*S)) ;
+          case 119: return 2/(1 + 2*S) ;
+          case 120: return (-2*sqrt((S*(2 + S)*(3 + 2*S))/(1 + 2*S)))/(3 + 2*S) ;
+          case 121: return sqrt(3 + 6/(1 + 2*S))/(3 + 2*S) ;
+          case 122: return -1 ;
+          case 123: return 1 ;
+          case 124: return 1 ;
+          case 125: return sqrt(2)/sqrt((-1 + T)*T) ;
+          case 126: return sqrt(6)/sqrt((-1 + T)*T*(-1 + 2*T)*(1 + 2*T)) ;
+          case 127: return ((1 + T)*sqrt(((-2 + T)*T)/(-1 + Power(T,2))))/T ;
+          case 128: return ((1 + T)*sqrt(3 - 30/(1 + T) + 36/(1 + 2*T)))/((-1 + T)*T) ;
+          case 129: return 3/(T + 2*Power(T,2)) ;
+          case 130: return (9 - 13*Power(T,2) + 4*Power(T,4))/(T*sqrt(-9 + Power(T,2)*Power(7 - 4*Power(T,2),2))) ;
+          case 131: return (sqrt(3)*(-3 + T + 2*Power(T,2)))/(T*sqrt((-1 + T)*(1 + T)*(1 + 2*T)*(3 + 2*T))) ;
+          case 132: return sqrt(6)/sqrt(T*(1 + T)*(1 + 2*T)*(3 + 2*T)) ;
+          case 133: return (6*sqrt(((-1 + T)*T*(2 + T)*(-1 + 2*T)*(3 + 2*T))/(1 + 2*T)) - 9*sqrt((Power(T,3)*(2 + T)*(-1 + 2*T)*(3 + 2*T))/((-1 + T)*(1 + 2*T))) + 9*sqrt((Power(T,5)*(2 + T)*(-1 + 2*T)*(3 + 2*T))/((-1 + T)*(1 + 2*T))) - 4*sqrt((Power(T,3)*(2 + T)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T))/(-1 + T)) + 3*sqrt((Power(T,5)*(2 + T)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T))/(-1 + T)) + sqrt((Power(T,7)*(2 + T)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T))/(-1 + T)))/(T*Power(1 + T,1.5)*(2 + T)*sqrt(1 + 2*T)*(3 + 2*T)) ;
+          case 134: return sqrt((-2 + 4*T)/(T + 3*Power(T,2) + 2*Power(T,3))) ;
+          case 135: return (5 + 2*T)*sqrt((-1 + 2*T)/(15 + 46*T + 36*Power(T,2) + 8*Power(T,3))) ;
+          case 136: return (-1 + 2*S)*sqrt(-((1 + S)/(S - 4*Power(S,3)))) ;
+          case 137: return ((-1 + 2*S)*sqrt(-((1 + S)/(S - 4*Power(S,3)))))/T ;
+          case 138: return 1/sqrt((S*(1 + 2*S)*Power(T + 2*Power(T,2),2))/(-1 + S + 2*Power(S,2))) ;
+          case 139: return sqrt(((-1 + S + 2*Power(S,2))*(-1 + Power(T,2)))/(S*(1 + 2*S)))/T ;
+          case 140: return ((-1 + 2*S)*sqrt(((1 + S)*(-1 + 2*T))/((-S + 4*Power(S,3))*(1 + 2*T))))/T ;
+          case 141: return (2*sqrt((T*(-1 + 2*T))/(1 + T)) + 2*T*sqrt((T*(-1 + 2*T))/(1 + T)) + sqrt(T*(-1 + T + 2*Power(T,2))) + 2*sqrt(Power(T,3)*(-1 + T + 2*Power(T,2))))/((1 + 2*T)*sqrt((S*(1 + 2*S)*T*(1 + T)*(3 + 2*T))/(-1 + S + 2*Power(S,2)))) ;
+          case 142: return -(1/sqrt(S*(1 + 2*S))) ;
+          case 143: return -(1/(sqrt(S*(1 + 2*S))*T)) ;
+          case 144: return -(1/(sqrt(S*(1 + 2*S))*T*(1 + 2*T))) ;
+          case 145: return (3 + 2*S)*sqrt(S/(3 + 11*S + 12*Power(S,2) + 4*Power(S,3))) ;
+          case 146: return (3 + 2*S)*sqrt(S/((3 + 11*S + 12*Power(S,2) + 4*Power(S,3))*Power(T,2))) ;
+          case 147: return (3 + 2*S)*sqrt(S/((3 + 11*S + 12*Power(S,2) + 4*Power(S,3))*Power(T + 2*Power(T,2),2))) ;
+          case 148: return -(sqrt((-1 + Power(T,2))/(S*(1 + 2*S)))/T) ;
+          case 149: return -((-((1 + S)*(-1 + 2*S)*Power(T,2.5)*Power(1 + T,2)*sqrt(S*(1 + S)*(-1 + 4*Power(T,2)))) - (1 + S)*(-1 + 2*S)*T*Power(1 + T,2)*sqrt(S*(1 + S)*T*(-1 + 4*Power(T,2))) + 2*S*sqrt(S*Power(1 + S,3)*Power(T,3)*Power(1 + T,4)*(-1 + 4*Power(T,2))) + 2*S*T*sqrt(S*Power(1 + S,3)*Power(T,3)*Power(1 + T,4)*(-1 + 4*Power(T,2))))/(Power(1 + S,1.5)*sqrt(1 + 2*S)*Power(T,2.5)*Power(1 + T,3)*(S + 2*S*T))) ;
+          case 150: return (sqrt(-1 + T)*(S*(3 + 2*S)*T*sqrt(S*(1 + S)*(1 + 2*S)*(3 + 2*S)*(1 + T)) + 3*sqrt(Power(S,3)*(1 + S)*(1 + 2*S)*(3 + 2*S)*(1 + T)) + 2*sqrt(Power(S,5)*(1 + S)*(1 + 2*S)*(3 + 2*S)*(1 + T))))/(S*(1 + S)*(3 + 4*S*(2 + S))*T*(1 + T)) ;
+          case 151: return (3*sqrt((Power(S,3)*(1 + S)*(-1 + 2*T))/((3 + 4*S*(2 + S))*(1 + 2*T))) + 2*sqrt((Power(S,5)*(1 + S)*(-1 + 2*T))/((3 + 4*S*(2 + S))*(1 + 2*T))))/(S*(1 + S)*T) ;
+          case 152: return -(sqrt((-3 + 4*T*(1 + T))/(S*(1 + 2*S)))/(1 + 2*T)) ;
+          case 153: return ((4*S*sqrt((S*(-1 + T + 2*Power(T,2)))/(3 + 4*S*(2 + S))))/(1 + 2*T) + 2*sqrt((Power(S,3)*(-1 + T + 2*Power(T,2)))/(3 + 4*S*(2 + S))) + 3*(sqrt((S*(-1 + 2*T))/((3 + 4*S*(2 + S))*(1 + T))) + sqrt((S*(-1 + 2*T))/((3 + 4*S*(2 + S))*(1 + T)*Power(1 + 2*T,2))) + sqrt((S*(-1 + T + 2*Power(T,2)))/(3 + 4*S*(2 + S)))))/sqrt((1 + S)*(1 + T)*(3 + 2*T)) ;
+          case 154: return -(1/sqrt((1 + S)*(1 + 2*S))) ;
+          case 155: return (-sqrt(((3 + 2*S)*T)/(1 + S)) - 2*sqrt((1 + S)*(3 + 2*S)*T) + 4*S*(sqrt(((3 + 2*S)*T)/(1 + S)) + S*sqrt(((3 + 2*S)*T)/(1 + S)) - sqrt((1 + S)*(3 + 2*S)*T)))/(Power(3 + 2*S,1.5)*T*sqrt(T + 2*S*T)) ;
+          case 156: return -(1/(sqrt(1 + 3*S + 2*Power(S,2))*(T + 2*Power(T,2)))) ;
+          case 157: return 1 ;
+          case 158: return 1/T ;
+          case 159: return 1/(T + 2*Power(T,2)) ;
+          case 160: return ((4*S*sqrt((-1 + T)/(1 + 2*S)) - 3*sqrt((1 + 2*S)*(-1 + T)))*(1 + T))/((3 + 2*S)*T*sqrt((1 + S)*(1 + T))) ;
+          case 161: return -(sqrt((-1 + 2*T)/((1 + 3*S + 2*Power(S,2))*(1 + 2*T)))/T) ;
+          case 162: return sqrt(-1 + Power(T,2))/T ;
+          case 163: return sqrt(-1 + 4*Power(T,2))/(T + 2*Power(T,2)) ;
+          case 164: return -(sqrt((-3 + 4*T*(1 + T))/((1 + S)*(1 + 2*S)))/(1 + 2*T)) ;
+          case 165: return (sqrt((3 + 2*S)*(1 + T)*(-1 + 2*T)*(1 + 2*T)) + 2*sqrt(((3 + 2*S)*(-1 + 4*Power(T,2)))/(1 + T)) + 2*T*(sqrt((3 + 2*S)*(1 + T)*(-1 + 2*T)*(1 + 2*T)) + sqrt(((3 + 2*S)*(-1 + 4*Power(T,2)))/(1 + T))))/((1 + 2*T)*sqrt((3 + 2*S)*(1 + T)*(1 + 2*T)*(3 + 2*T))) ;
+          case 166: return (-2*sqrt(S*(1 + S)))/(1 + 2*S) ;
+          case 167: return (-2*sqrt(S*(1 + S)))/(T + 2*S*T) ;
+          case 168: return (-2*sqrt(S*(1 + S)))/((1 + 2*T)*(T + 2*S*T)) ;
+          case 169: return -2*sqrt((1 + S)/(1 + 2*S + T + 2*S*T))*(-sqrt(S/((1 + 2*S)*(-1 + T))) + sqrt((S*(-1 + T))/((1 + 2*S)*Power(T,2))) + sqrt(S/((1 + 2*S)*(-1 + T)))*T) ;
+          case 170: return (-2*sqrt((S*(1 + S)*(-1 + 2*T))/(1 + 2*T)))/(T + 2*S*T) ;
+          case 171: return (-2*(sqrt((S*(-1 + 2*T))/((1 + 2*S)*(1 + T))) + sqrt((S*(-1 + 2*T))/((1 + 2*S)*(1 + T)*Power(1 + 2*T,2))) + sqrt((S*(-1 + T + 2*Power(T,2)))/(1 + 2*S))))/sqrt(((1 + 2*S)*(1 + T)*(3 + 2*T))/(1 + S)) ;
+          case 172: return 1/(1 + 2*S) ;
+          case 173: return 1/(T + 2*S*T) ;
+          case 174: return 1/((1 + 2*T)*(T + 2*S*T)) ;
+          case 175: return -1 ;
+          case 176: return -(1/T) ;
+          case 177: return -(1/(T + 2*Power(T,2))) ;
+          case 178: return sqrt(-1 + Power(T,2))/(T + 2*S*T) ;
+          case 179: return sqrt(1 - 2/(1 + 2*T))/(T + 2*S*T) ;
+          case 180: return -(sqrt(-1 + Power(T,2))/T) ;
+          case 181: return -(sqrt(1 - 2/(1 + 2*T))/T) ;
+          case 182: return sqrt(-3 + 4*T*(1 + T))/((1 + 2*S)*(1 + 2*T)) ;
+          case 183: return -(sqrt(-3 + 4*T*(1 + T))/(1 + 2*T)) ;
+          case 184: return 1 ;
+          default: my_assert_not_reached();
+        }
+      };
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(1, 2, 1));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -66,10 +441,384 @@ MatrixElements<SC> SymmetryQST<SC>::recalc_doublet(const DiagInfo<SC> &diag, con
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "qst/qst-doubletm-1.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {2, 3},
+        {2, 4},
+        {2, 5},
+        {2, 6},
+        {2, 7},
+        {3, 3},
+        {3, 4},
+        {3, 6},
+        {3, 7},
+        {4, 4},
+        {4, 7},
+        {5, 5},
+        {5, 6},
+        {5, 7},
+        {6, 6},
+        {6, 7},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {9, 10},
+        {9, 11},
+        {10, 10},
+        {10, 11},
+        {10, 12},
+        {11, 11},
+        {11, 12},
+        {11, 13},
+        {12, 12},
+        {12, 13},
+        {13, 13},
+        {14, 14},
+        {14, 15},
+        {14, 16},
+        {14, 17},
+        {14, 18},
+        {14, 19},
+        {15, 15},
+        {15, 16},
+        {15, 18},
+        {15, 19},
+        {16, 16},
+        {16, 19},
+        {17, 17},
+        {17, 18},
+        {17, 19},
+        {17, 20},
+        {17, 21},
+        {17, 22},
+        {18, 18},
+        {18, 19},
+        {18, 21},
+        {18, 22},
+        {19, 19},
+        {19, 22},
+        {20, 20},
+        {20, 21},
+        {20, 22},
+        {21, 21},
+        {21, 22},
+        {22, 22},
+        {23, 23},
+        {23, 24},
+        {23, 25},
+        {23, 26},
+        {23, 27},
+        {23, 28},
+        {24, 24},
+        {24, 25},
+        {24, 27},
+        {24, 28},
+        {25, 25},
+        {25, 28},
+        {26, 26},
+        {26, 27},
+        {26, 28},
+        {27, 27},
+        {27, 28},
+        {28, 28},
+        {29, 29},
+        {29, 30},
+        {29, 31},
+        {29, 34},
+        {29, 35},
+        {29, 36},
+        {30, 30},
+        {30, 31},
+        {30, 32},
+        {30, 35},
+        {30, 36},
+        {30, 37},
+        {31, 31},
+        {31, 32},
+        {31, 33},
+        {31, 36},
+        {31, 37},
+        {31, 38},
+        {32, 32},
+        {32, 33},
+        {32, 37},
+        {32, 38},
+        {33, 33},
+        {33, 38},
+        {34, 34},
+        {34, 35},
+        {34, 36},
+        {35, 35},
+        {35, 36},
+        {35, 37},
+        {36, 36},
+        {36, 37},
+        {36, 38},
+        {37, 37},
+        {37, 38},
+        {38, 38},
+        {39, 39},
+        {39, 40},
+        {40, 40},
+        {40, 41},
+        {41, 41},
+        {41, 42},
+        {42, 42},
+        {43, 43},
+        {44, 44},
+        {44, 45},
+        {44, 46},
+        {45, 45},
+        {45, 46},
+        {45, 47},
+        {46, 46},
+        {46, 47},
+        {46, 48},
+        {47, 47},
+        {47, 48},
+        {48, 48},
+        {49, 49},
+        {49, 50},
+        {49, 51},
+        {49, 52},
+        {49, 53},
+        {49, 54},
+        {50, 50},
+        {50, 51},
+        {50, 53},
+        {50, 54},
+        {51, 51},
+        {51, 54},
+        {52, 52},
+        {52, 53},
+        {52, 54},
+        {52, 55},
+        {52, 56},
+        {52, 57},
+        {53, 53},
+        {53, 54},
+        {53, 56},
+        {53, 57},
+        {54, 54},
+        {54, 57},
+        {55, 55},
+        {55, 56},
+        {55, 57},
+        {56, 56},
+        {56, 57},
+        {57, 57},
+        {58, 58},
+        {58, 59},
+        {58, 60},
+        {58, 61},
+        {58, 62},
+        {58, 63},
+        {59, 59},
+        {59, 60},
+        {59, 62},
+        {59, 63},
+        {60, 60},
+        {60, 63},
+        {61, 61},
+        {61, 62},
+        {61, 63},
+        {62, 62},
+        {62, 63},
+        {63, 63},
+        {64, 64}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1 ;
+          case 1: return -1 ;
+          case 2: return -(1/T) ;
+          case 3: return -(1/(T + 2*Power(T,2))) ;
+          case 4: return 1/(-1 - 2*S) ;
+          case 5: return -(1/(T + 2*S*T)) ;
+          case 6: return -(1/((1 + 2*T)*(T + 2*S*T))) ;
+          case 7: return -(sqrt(-1 + Power(T,2))/T) ;
+          case 8: return -(sqrt(1 - 2/(1 + 2*T))/T) ;
+          case 9: return -(sqrt(-1 + Power(T,2))/(T + 2*S*T)) ;
+          case 10: return -(sqrt(1 - 2/(1 + 2*T))/(T + 2*S*T)) ;
+          case 11: return -((sqrt(T*(1 + T)*(-1 + 2*T)*(1 + 2*T)) + sqrt((T*(-1 + 2*T))/(1 + 3*T + 2*Power(T,2))) + sqrt((T*(-1 + 4*Power(T,2)))/(1 + T)))/sqrt(T*(1 + T)*(1 + 2*T)*(3 + 2*T))) ;
+          case 12: return (-sqrt(T*(1 + T)*(-1 + 2*T)*(1 + 2*T)) - sqrt((T*(-1 + 2*T))/(1 + 3*T + 2*Power(T,2))) - sqrt((T*(-1 + 4*Power(T,2)))/(1 + T)))/((1 + 2*S)*sqrt(T*(1 + T)*(1 + 2*T)*(3 + 2*T))) ;
+          case 13: return (-2*sqrt(S*(1 + S)))/(1 + 2*S) ;
+          case 14: return (-2*sqrt(S*(1 + S)))/(T + 2*S*T) ;
+          case 15: return (-2*sqrt(S*(1 + S)))/((1 + 2*S)*(T + 2*Power(T,2))) ;
+          case 16: return (-2*sqrt((1 + S)/(1 + T))*(-(T*sqrt((S*T)/(-1 + T))) + sqrt(S*(-1 + T)*T) + sqrt((S*Power(T,5))/(-1 + T))))/((1 + 2*S)*Power(T,1.5)) ;
+          case 17: return (-2*sqrt(S*(1 + S)*(-1 + 4*Power(T,2))))/((1 + 2*S)*(T + 2*Power(T,2))) ;
+          case 18: return -((sqrt(S)*(2*S*(1 + T)*(2*sqrt(((1 + S)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T))/(1 + T)) + sqrt((1 + S)*(1 + T)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T)) + 2*T*(sqrt(((1 + S)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T))/(1 + T)) + sqrt((1 + S)*(1 + T)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T)))) + (3 + 2*T)*(sqrt(((1 + S)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T))/(1 + T)) + sqrt((1 + S)*(1 + T)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T)) + T*(sqrt(((1 + S)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T))/(1 + T)) + 2*sqrt((1 + S)*(1 + T)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T))))))/((1 + S)*(1 + 2*S)*Power((1 + T)*(1 + 2*T),1.5)*(3 + 2*T))) ;
+          case 19: return 1 ;
+          case 20: return 1 ;
+          case 21: return sqrt(2)/sqrt((-1 + T)*T) ;
+          case 22: return sqrt(6)/sqrt((-1 + T)*T*(-1 + 2*T)*(1 + 2*T)) ;
+          case 23: return ((1 + T)*sqrt(((-2 + T)*T)/(-1 + Power(T,2))))/T ;
+          case 24: return ((1 + T)*sqrt(3 - 30/(1 + T) + 36/(1 + 2*T)))/((-1 + T)*T) ;
+          case 25: return 3/(T + 2*Power(T,2)) ;
+          case 26: return (9 - 13*Power(T,2) + 4*Power(T,4))/(T*sqrt(-9 + Power(T,2)*Power(7 - 4*Power(T,2),2))) ;
+          case 27: return (sqrt(3)*(-3 + T + 2*Power(T,2)))/(T*sqrt((-1 + T)*(1 + T)*(1 + 2*T)*(3 + 2*T))) ;
+          case 28: return sqrt(6)/sqrt(T*(1 + T)*(1 + 2*T)*(3 + 2*T)) ;
+          case 29: return (6*sqrt(((-1 + T)*T*(2 + T)*(-1 + 2*T)*(3 + 2*T))/(1 + 2*T)) - 9*sqrt((Power(T,3)*(2 + T)*(-1 + 2*T)*(3 + 2*T))/((-1 + T)*(1 + 2*T))) + 9*sqrt((Power(T,5)*(2 + T)*(-1 + 2*T)*(3 + 2*T))/((-1 + T)*(1 + 2*T))) - 4*sqrt((Power(T,3)*(2 + T)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T))/(-1 + T)) + 3*sqrt((Power(T,5)*(2 + T)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T))/(-1 + T)) + sqrt((Power(T,7)*(2 + T)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T))/(-1 + T)))/(T*Power(1 + T,1.5)*(2 + T)*sqrt(1 + 2*T)*(3 + 2*T)) ;
+          case 30: return sqrt((-2 + 4*T)/(T + 3*Power(T,2) + 2*Power(T,3))) ;
+          case 31: return (5 + 2*T)*sqrt((-1 + 2*T)/(15 + 46*T + 36*Power(T,2) + 8*Power(T,3))) ;
+          case 32: return 1 ;
+          case 33: return 1/T ;
+          case 34: return 1/(T + 2*Power(T,2)) ;
+          case 35: return 1/sqrt(S*(1 + 2*S)) ;
+          case 36: return 1/(sqrt(S*(1 + 2*S))*T) ;
+          case 37: return 1/(sqrt(S*(1 + 2*S))*(T + 2*Power(T,2))) ;
+          case 38: return sqrt(-1 + Power(T,2))/T ;
+          case 39: return sqrt(1 - 2/(1 + 2*T))/T ;
+          case 40: return 1/(T*sqrt((S*(1 + 2*S))/(-1 + Power(T,2)))) ;
+          case 41: return sqrt((-1 + 2*T)/((S + 2*Power(S,2))*(1 + 2*T)))/T ;
+          case 42: return (sqrt(T*(1 + T)*(-1 + 2*T)*(1 + 2*T)) + sqrt((T*(-1 + 2*T))/(1 + 3*T + 2*Power(T,2))) + sqrt((T*(-1 + 4*Power(T,2)))/(1 + T)))/sqrt(T*(1 + T)*(1 + 2*T)*(3 + 2*T)) ;
+          case 43: return (sqrt(T*(1 + T)*(-1 + 2*T)*(1 + 2*T)) + sqrt((T*(-1 + 2*T))/(1 + 3*T + 2*Power(T,2))) + sqrt((T*(-1 + 4*Power(T,2)))/(1 + T)))/sqrt(S*(1 + 2*S)*T*(1 + T)*(1 + 2*T)*(3 + 2*T)) ;
+          case 44: return ((1 + S)*sqrt((S*(-1 + 2*S))/(1 + 3*S + 2*Power(S,2))))/S ;
+          case 45: return ((1 + S)*sqrt((S*(-1 + 2*S))/(1 + 3*S + 2*Power(S,2))))/(S*T) ;
+          case 46: return ((1 + S)*sqrt((S*(-1 + 2*S))/(1 + 3*S + 2*Power(S,2))))/(S*T*(1 + 2*T)) ;
+          case 47: return 1/sqrt((1 + S)*(1 + 2*S)) ;
+          case 48: return 1/(sqrt((1 + S)*(1 + 2*S))*T) ;
+          case 49: return 1/(sqrt(1 + 3*S + 2*Power(S,2))*(T + 2*Power(T,2))) ;
+          case 50: return sqrt(((-1 + 2*S)*(-1 + T))/(S*(1 + 3*S + 2*Power(S,2))*Power(T,2)*(1 + T))) + (S*(-1 + 2*S)*(-1 + T))/sqrt(S*(1 + S)*(-1 + 4*Power(S,2))*(-1 + T)*(1 + T)) + (S*(-1 + 2*S))/sqrt((S*(1 + S)*(-1 + 4*Power(S,2))*Power(T,2)*(1 + T))/(-1 + T)) + (-1 + T)/sqrt((S*(1 + S)*(1 + 2*S)*(-1 + Power(T,2)))/(-1 + 2*S)) ;
+          case 51: return (-(S*(1 + S)*Power(1 + T,2)*sqrt((S*(1 + S)*(-1 + 2*T))/(-1 + 2*S))) + 2*Power(S,2)*(1 + S)*Power(1 + T,2)*sqrt((S*(1 + S)*(-1 + 2*T))/(-1 + 2*S)) + (1 + S)*Power(1 + T,2)*sqrt(S*(-1 + S + 2*Power(S,2))*(-1 + 2*T)) - S*sqrt((S*Power(1 + S,3)*Power(T,2)*Power(1 + T,4)*(-1 + 2*T))/(-1 + 2*S)) + 2*Power(S,2)*sqrt((S*Power(1 + S,3)*Power(T,2)*Power(1 + T,4)*(-1 + 2*T))/(-1 + 2*S)) + sqrt(S*Power(1 + S,3)*(-1 + 2*S)*Power(T,2)*Power(1 + T,4)*(-1 + 2*T)))/(S*Power(1 + S,2)*T*Power(1 + T,3)*sqrt((1 + 2*S)*(1 + 2*T))) ;
+          case 52: return (-sqrt(((1 + S)*Power(T,3)*(1 + T))/(-1 + T)) + sqrt(((1 + S)*Power(T,5)*(1 + T))/(-1 + T)) + sqrt((1 + S)*T*(-1 + Power(T,2))))/((1 + S)*sqrt(1 + 2*S)*Power(T,1.5)*(1 + T)) ;
+          case 53: return sqrt((-1 + 4*Power(T,2))/(1 + 3*S + 2*Power(S,2)))/(T + 2*Power(T,2)) ;
+          case 54: return (-sqrt((S*T*(1 + T)*(-1 + 2*T)*(1 + 2*T))/(-1 + 2*S)) + 2*sqrt((Power(S,3)*T*(1 + T)*(-1 + 2*T)*(1 + 2*T))/(-1 + 2*S)) + sqrt(((-1 + 2*S)*T*(1 + T)*(-1 + 2*T)*(1 + 2*T))/S) - sqrt((S*T*(-1 + 2*T))/((-1 + 2*S)*(1 + 3*T + 2*Power(T,2)))) + 2*sqrt((Power(S,3)*T*(-1 + 2*T))/((-1 + 2*S)*(1 + 3*T + 2*Power(T,2)))) + sqrt(((-1 + 2*S)*T*(-1 + 2*T))/(S*(1 + 3*T + 2*Power(T,2)))) - sqrt((S*T*(-1 + 4*Power(T,2)))/((-1 + 2*S)*(1 + T))) + 2*S*sqrt((S*T*(-1 + 4*Power(T,2)))/((-1 + 2*S)*(1 + T))) + sqrt(((-1 + 2*S)*T*(-1 + 4*Power(T,2)))/(S*(1 + T))))/sqrt((1 + S)*(1 + 2*S)*T*(1 + T)*(1 + 2*T)*(3 + 2*T)) ;
+          case 55: return (sqrt(S/(3 + 5*T + 2*Power(T,2)))*(T*sqrt(((1 + S)*(1 + 2*S)*(-1 + 2*T))/(S*(1 + T))) + T*sqrt((S*(1 + S)*(1 + 2*S)*(-1 + 2*T))/(1 + T)) + T*sqrt(((1 + S)*(1 + 2*S)*(-1 + 2*T))/(S*(1 + T)))*(1 + 2*T) + T*sqrt((S*(1 + S)*(1 + 2*S)*(-1 + 2*T))/(1 + T))*(1 + 2*T) + T*(1 + 2*T)*sqrt(((1 + S)*(1 + 2*S)*(-1 + T + 2*Power(T,2)))/S) + S*T*(1 + 2*T)*sqrt(((1 + S)*(1 + 2*S)*(-1 + T + 2*Power(T,2)))/S)))/(Power(1 + S,2)*(1 + 2*S)*T*(1 + 2*T)) ;
+          case 56: return ((3 + 2*S)*sqrt((S*(1 + S))/(3 + 4*S*(2 + S))))/(1 + S) ;
+          case 57: return ((3 + 2*S)*sqrt((S*(1 + S))/(3 + 4*S*(2 + S))))/((1 + S)*T) ;
+          case 58: return sqrt((S*(3 + 4*S*(2 + S)))/(1 + S))/((1 + 2*S)*T*(1 + 2*T)) ;
+          case 59: return (sqrt((S*(-1 + T))/((1 + S)*T)) + (1 + 2*S)*sqrt((S*(-1 + T))/((1 + S)*T)) + (1 + 2*S)*sqrt((S*(1 + S)*(-1 + T))/T) - (1 + 2*S)*sqrt((S*(1 + S))/((-1 + T)*T))*T + (1 + 2*S)*sqrt((S*(1 + S))/((-1 + T)*T))*Power(T,2) - sqrt((S*T)/((1 + S)*(-1 + T))) - (1 + 2*S)*sqrt((S*T)/((1 + S)*(-1 + T))) + (1 + 2*S)*T*sqrt((S*T)/((1 + S)*(-1 + T))) + sqrt((S*Power(T,3))/((1 + S)*(-1 + T))))/((1 + S)*sqrt((3 + 4*S*(2 + S))*T*(1 + T))) ;
+          case 60: return (sqrt((1 + 2*S)*T*(1 + T)*(-1 + 2*T)*(1 + 2*T)) + sqrt(Power(1 + 2*S,3)*T*(1 + T)*(-1 + 2*T)*(1 + 2*T)) + sqrt(Power(1 + S,2)*Power(1 + 2*S,3)*T*(1 + T)*(-1 + 2*T)*(1 + 2*T)) + T*sqrt(Power(1 + S,2)*Power(1 + 2*S,3)*T*(1 + T)*(-1 + 2*T)*(1 + 2*T)) + sqrt((1 + 2*S)*Power(T,3)*(1 + T)*(-1 + 2*T)*(1 + 2*T)) + sqrt((1 + T)*(-1 + 2*T)*(1 + 2*T)*Power(T + 2*S*T,3)))/sqrt((Power(1 + S,3)*Power(1 + 2*S,2)*(3 + 2*S)*Power(1 + 2*T,2)*Power(T + Power(T,2),3))/S) ;
+          case 61: return ((3 + 2*S)*(sqrt((1 + T)*(-1 + 2*T)*(1 + 2*T)) + 2*sqrt(-4 + 4*T + 3/(1 + T)) + 2*T*(sqrt((1 + T)*(-1 + 2*T)*(1 + 2*T)) + sqrt(-4 + 4*T + 3/(1 + T)))))/((1 + 2*T)*sqrt(((1 + S)*(1 + 2*S)*(3 + 2*S)*(1 + T)*(1 + 2*T)*(3 + 2*T))/S)) ;
+          case 62: return -1 ;
+          case 63: return -(1/T) ;
+          case 64: return -(1/(T + 2*Power(T,2))) ;
+          case 65: return 1/(-1 - 2*S) ;
+          case 66: return -(1/(T + 2*S*T)) ;
+          case 67: return -(1/((1 + 2*T)*(T + 2*S*T))) ;
+          case 68: return -(sqrt(-1 + Power(T,2))/T) ;
+          case 69: return -(sqrt(1 - 2/(1 + 2*T))/T) ;
+          case 70: return -(sqrt(-1 + Power(T,2))/(T + 2*S*T)) ;
+          case 71: return -(sqrt(1 - 2/(1 + 2*T))/(T + 2*S*T)) ;
+          case 72: return -((sqrt(T*(1 + T)*(-1 + 2*T)*(1 + 2*T)) + sqrt((T*(-1 + 2*T))/(1 + 3*T + 2*Power(T,2))) + sqrt((T*(-1 + 4*Power(T,2)))/(1 + T)))/sqrt(T*(1 + T)*(1 + 2*T)*(3 + 2*T))) ;
+          case 73: return (-sqrt(T*(1 + T)*(-1 + 2*T)*(1 + 2*T)) - sqrt((T*(-1 + 2*T))/(1 + 3*T + 2*Power(T,2))) - sqrt((T*(-1 + 4*Power(T,2)))/(1 + T)))/((1 + 2*S)*sqrt(T*(1 + T)*(1 + 2*T)*(3 + 2*T))) ;
+          case 74: return (-2*sqrt(S*(1 + S)))/(1 + 2*S) ;
+          case 75: return (-2*sqrt(S*(1 + S)))/(T + 2*S*T) ;
+          case 76: return (-2*sqrt(S*(1 + S)))/((1 + 2*S)*(T + 2*Power(T,2))) ;
+          case 77: return (-2*sqrt((1 + S)/(1 + T))*(-(T*sqrt((S*T)/(-1 + T))) + sqrt(S*(-1 + T)*T) + sqrt((S*Power(T,5))/(-1 + T))))/((1 + 2*S)*Power(T,1.5)) ;
+          case 78: return (-2*sqrt(S*(1 + S)*(-1 + 4*Power(T,2))))/((1 + 2*S)*(T + 2*Power(T,2))) ;
+          case 79: return -((sqrt(S)*(2*S*(1 + T)*(2*sqrt(((1 + S)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T))/(1 + T)) + sqrt((1 + S)*(1 + T)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T)) + 2*T*(sqrt(((1 + S)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T))/(1 + T)) + sqrt((1 + S)*(1 + T)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T)))) + (3 + 2*T)*(sqrt(((1 + S)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T))/(1 + T)) + sqrt((1 + S)*(1 + T)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T)) + T*(sqrt(((1 + S)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T))/(1 + T)) + 2*sqrt((1 + S)*(1 + T)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T))))))/((1 + S)*(1 + 2*S)*Power((1 + T)*(1 + 2*T),1.5)*(3 + 2*T))) ;
+          case 80: return -1 ;
+          case 81: return -(sqrt(2)/sqrt((-1 + T)*T)) ;
+          case 82: return -(sqrt(6)/sqrt((-1 + T)*T*(-1 + 2*T)*(1 + 2*T))) ;
+          case 83: return 1/(-1 - 2*S) ;
+          case 84: return -(sqrt(2)/((1 + 2*S)*sqrt((-1 + T)*T))) ;
+          case 85: return -(sqrt(6)/((1 + 2*S)*sqrt((-1 + T)*T*(-1 + 2*T)*(1 + 2*T)))) ;
+          case 86: return -(((1 + T)*sqrt(((-2 + T)*T)/(-1 + Power(T,2))))/T) ;
+          case 87: return -(((1 + T)*sqrt(3 - 30/(1 + T) + 36/(1 + 2*T)))/((-1 + T)*T)) ;
+          case 88: return -3/(T + 2*Power(T,2)) ;
+          case 89: return (2 + T - Power(T,2))/((1 + 2*S)*sqrt((-2 + T)*(-1 + T)*T*(1 + T))) ;
+          case 90: return -(((1 + T)*sqrt(3 - 30/(1 + T) + 36/(1 + 2*T)))/((1 + 2*S)*(-1 + T)*T)) ;
+          case 91: return -3/((1 + 2*S)*(T + 2*Power(T,2))) ;
+          case 92: return (-9 + 13*Power(T,2) - 4*Power(T,4))/(T*sqrt(-9 + Power(T,2)*Power(7 - 4*Power(T,2),2))) ;
+          case 93: return -((sqrt(3)*(-3 + T + 2*Power(T,2)))/(T*sqrt((-1 + T)*(1 + T)*(1 + 2*T)*(3 + 2*T)))) ;
+          case 94: return -(sqrt(6)/sqrt(T*(1 + T)*(1 + 2*T)*(3 + 2*T))) ;
+          case 95: return ((-3*(3 + 4*(-2 + T)*T))/sqrt(((1 + 2*S)*Power(T,2)*(1 + T)*(-3 + 2*T)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T))/(-1 + T)) - (6*sqrt((3 - 5*T + 2*Power(T,2))/((1 + 2*S)*(-3 - 5*T + 10*Power(T,2) + 20*Power(T,3) + 8*Power(T,4)))))/T - ((-1 + T)*(-3 + 2*T)*(-1 + 2*T))/sqrt((1 + 2*S)*(-9 + Power(T,2)*Power(7 - 4*Power(T,2),2))))/sqrt(1 + 2*S) ;
+          case 96: return (sqrt(3)*((-1 + (3 - 2*T)*T)/(Power(1 + T,1.5)*sqrt((1 + 2*S)*(-1 + T)*(1 + 2*T)*(3 + 2*T))) + (-3 + 9*T - 6*Power(T,2))/sqrt((1 + 2*S)*(-1 + T)*Power(T,2)*Power(1 + T,3)*(1 + 2*T)*(3 + 2*T)) - (6*sqrt((-1 + T)/((1 + 2*S)*Power(1 + T,3)*(3 + 4*T*(2 + T)))))/T))/sqrt(1 + 2*S) ;
+          case 97: return -(sqrt(6)/((1 + 2*S)*sqrt(T*(1 + T)*(1 + 2*T)*(3 + 2*T)))) ;
+          case 98: return (-6*sqrt(((-1 + T)*T*(2 + T)*(-1 + 2*T)*(3 + 2*T))/(1 + 2*T)) + 9*sqrt((Power(T,3)*(2 + T)*(-1 + 2*T)*(3 + 2*T))/((-1 + T)*(1 + 2*T))) - 9*sqrt((Power(T,5)*(2 + T)*(-1 + 2*T)*(3 + 2*T))/((-1 + T)*(1 + 2*T))) + 4*sqrt((Power(T,3)*(2 + T)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T))/(-1 + T)) - 3*sqrt((Power(T,5)*(2 + T)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T))/(-1 + T)) - sqrt((Power(T,7)*(2 + T)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T))/(-1 + T)))/(T*Power(1 + T,1.5)*(2 + T)*sqrt(1 + 2*T)*(3 + 2*T)) ;
+          case 99: return -sqrt((-2 + 4*T)/(T + 3*Power(T,2) + 2*Power(T,3))) ;
+          case 100: return (-6*sqrt(((-1 + T)*T*(2 + T)*(-1 + 2*T)*(3 + 2*T))/(1 + 2*T)) + 9*sqrt((Power(T,3)*(2 + T)*(-1 + 2*T)*(3 + 2*T))/((-1 + T)*(1 + 2*T))) - 9*sqrt((Power(T,5)*(2 + T)*(-1 + 2*T)*(3 + 2*T))/((-1 + T)*(1 + 2*T))) + 4*sqrt((Power(T,3)*(2 + T)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T))/(-1 + T)) - 3*sqrt((Power(T,5)*(2 + T)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T))/(-1 + T)) - sqrt((Power(T,7)*(2 + T)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T))/(-1 + T)))/((1 + 2*S)*T*Power(1 + T,1.5)*(2 + T)*sqrt(1 + 2*T)*(3 + 2*T)) ;
+          case 101: return -(sqrt(2 - 6/(1 + T) + 4/(1 + 2*T))/(T + 2*S*T)) ;
+          case 102: return (-sqrt(T*(2 + T)*(-1 + 2*T)*(3 + 2*T)) - 2*sqrt(Power(T,3)*(2 + T)*(-1 + 2*T)*(3 + 2*T)) - 18*sqrt((T*(-1 + 2*T))/(6 + 7*T + 2*Power(T,2))) - 2*sqrt((T*(-3 + 4*T*(1 + T)))/(2 + T)) - 4*T*(3*sqrt((T*(-1 + 2*T))/(6 + 7*T + 2*Power(T,2))) + sqrt((T*(-3 + 4*T*(1 + T)))/(2 + T))))/((3 + 2*T)*sqrt(T*(2 + T)*(1 + 2*T)*(5 + 2*T))) ;
+          case 103: return (-sqrt(T*(2 + T)*(-1 + 2*T)*(3 + 2*T)) - 2*sqrt(Power(T,3)*(2 + T)*(-1 + 2*T)*(3 + 2*T)) - 18*sqrt((T*(-1 + 2*T))/(6 + 7*T + 2*Power(T,2))) - 2*sqrt((T*(-3 + 4*T*(1 + T)))/(2 + T)) - 4*T*(3*sqrt((T*(-1 + 2*T))/(6 + 7*T + 2*Power(T,2))) + sqrt((T*(-3 + 4*T*(1 + T)))/(2 + T))))/((1 + 2*S)*(3 + 2*T)*sqrt(T*(2 + T)*(1 + 2*T)*(5 + 2*T))) ;
+          case 104: return (-2*sqrt(S*(1 + S)))/(1 + 2*S) ;
+          case 105: return (-2*sqrt(2)*sqrt((S*(1 + S)*T)/(-1 + T)))/(T + 2*S*T) ;
+          case 106: return (-2*sqrt(6)*sqrt((S + Power(S,2))/(T - Power(T,2) - 4*Power(T,3) + 4*Power(T,4))))/(1 + 2*S) ;
+          case 107: return -((sqrt(S/((1 + 2*S)*(-1 + Power(T,2))))*(2*sqrt(((1 + S)*T)/((1 + 2*S)*(-2 + T))) + 2*sqrt(((1 + S)*(1 + 2*S)*T)/(-2 + T)) - sqrt(((1 + S)*Power(T,3))/((1 + 2*S)*(-2 + T))) - sqrt(((1 + S)*(1 + 2*S)*Power(T,3))/(-2 + T)) - 2*sqrt(((1 + S)*Power(T,5))/((1 + 2*S)*(-2 + T))) - 2*sqrt(((1 + S)*(1 + 2*S)*Power(T,5))/(-2 + T)) + sqrt(((1 + S)*Power(T,7))/((1 + 2*S)*(-2 + T))) + sqrt(((1 + S)*(1 + 2*S)*Power(T,7))/(-2 + T)) + 4*sqrt(((1 + S)*(-2 + T)*T*Power(1 + T,2))/(1 + 2*S)) + 4*S*sqrt(((1 + S)*(-2 + T)*T*Power(1 + T,2))/(1 + 2*S))))/((1 + S)*T*(1 + T))) ;
+          case 108: return (2*sqrt(3)*(3 + T - 2*Power(T,2))*sqrt((S*(1 + S))/(3 + 4*T - 7*Power(T,2) - 4*Power(T,3) + 4*Power(T,4))))/(T + 2*S*T) ;
+          case 109: return (-6*sqrt(S*(1 + S)))/((1 + 2*S)*(T + 2*Power(T,2))) ;
+          case 110: return (-2*(1 + S)*(9*sqrt((-1 + T)/(3 - 2*T - 12*Power(T,2) + 8*Power(T,3))) + 6*sqrt(-1 + T*(-3 + 2*T) + 2/(-1 + 2*T)) + T*(-3*(sqrt((1 + 2*T)/(-3 + 11*T - 12*Power(T,2) + 4*Power(T,3))) + 2*sqrt((-1 + T)/(3 - 2*T - 12*Power(T,2) + 8*Power(T,3)))) + T*(11*sqrt((1 + 2*T)/(-3 + 11*T - 12*Power(T,2) + 4*Power(T,3))) - 36*sqrt((-1 + T)/(3 - 2*T - 12*Power(T,2) + 8*Power(T,3))) + 4*T*(-3*sqrt((1 + 2*T)/(-3 + 11*T - 12*Power(T,2) + 4*Power(T,3))) + T*sqrt((1 + 2*T)/(-3 + 11*T - 12*Power(T,2) + 4*Power(T,3))) + 6*sqrt((-1 + T)/(3 - 2*T - 12*Power(T,2) + 8*Power(T,3))))))))/((1 + 2*S)*T*(1 + 2*T)*sqrt(((1 + S)*(1 + T)*(3 + 2*T))/S)) ;
+          case 111: return (-2*sqrt(3)*(1 + S)*(3*(sqrt(S/((1 + S)*Power(1 + T,3)*(-3 - 5*T + 4*Power(T,2) + 4*Power(T,3)))) + 2*sqrt((S*(-1 + T))/((1 + S)*(3 + 11*T + 12*Power(T,2) + 4*Power(T,3))))) + T*sqrt(S/((1 + S)*Power(1 + T,3)*(-3 - 5*T + 4*Power(T,2) + 4*Power(T,3))))*(-5 + T*(-5 + T*(5 + 2*T)))))/((1 + 2*S)*T*(1 + T)) ;
+          case 112: return (-2*sqrt(6 + 6/S)*S*(3*sqrt(T*(1 + T)*(1 + 2*T)*(3 + 2*T)) + 5*sqrt(Power(T,3)*(1 + T)*(1 + 2*T)*(3 + 2*T)) + 2*sqrt(Power(T,5)*(1 + T)*(1 + 2*T)*(3 + 2*T))))/((1 + 2*S)*T*Power(1 + T,2)*(1 + 2*T)*Power(3 + 2*T,2)) ;
+          case 113: return (-2*sqrt(S*(1 + S)*(-1 + T)*T*(1 + T)*(2 + T)*(-1 + 2*T)*(3 + 2*T)))/((1 + 2*S)*T*(1 + T)*(1 + 2*T)) ;
+          case 114: return (-2*sqrt(2)*sqrt((S*(1 + S)*T*(-1 + T + 2*Power(T,2)))/(1 + 2*T)))/(T + 2*S*T + Power(T,2) + 2*S*Power(T,2)) ;
+          case 115: return (-2*sqrt((S + 2*S*T)/(6 + 13*T + 9*Power(T,2) + 2*Power(T,3)))*(8*sqrt(((1 + S)*(1 + T)*(-1 + 2*T)*(5 + 2*T))/(2 + T)) + sqrt((1 + S)*(1 + T)*(2 + T)*(-1 + 2*T)*(5 + 2*T)) + 2*T*(2*sqrt(((1 + S)*(1 + T)*(-1 + 2*T)*(5 + 2*T))/(2 + T)) + sqrt((1 + S)*(1 + T)*(2 + T)*(-1 + 2*T)*(5 + 2*T)))))/((1 + 2*S)*(1 + 2*T)*(5 + 2*T)) ;
+          case 116: return -1 ;
+          case 117: return -(sqrt(3)/sqrt(-1 + 4*Power(S,2))) ;
+          case 118: return (-2*(-1 + Power(S,2)))/sqrt(1 - 5*Power(S,2) + 4*Power(S,4)) ;
+          case 119: return -2/(1 + 2*S) ;
+          case 120: return (sqrt((Power(S,3)*(1 + S)*(1 + 2*S)*(3 + 2*S))/(-1 + 2*S)) - 2*sqrt((Power(S,5)*(1 + S)*(1 + 2*S)*(3 + 2*S))/(-1 + 2*S)) + 4*S*sqrt((S*(1 + S)*(3 + 2*S))/(-1 + 4*Power(S,2))) - 8*sqrt((Power(S,5)*(1 + S)*(3 + 2*S))/(-1 + 4*Power(S,2))) - 3*sqrt((S*(-3 + S*(1 + 4*S*(2 + S))))/(1 + 2*S)))/sqrt(S*Power(1 + S,3)*(1 + 2*S)*Power(3 + 2*S,2)) ;
+          case 121: return -((sqrt(3)*(3*sqrt(S*(1 + S)*(3 + 2*S)) + 5*sqrt(Power(S,3)*(1 + S)*(3 + 2*S)) + 2*sqrt(Power(S,5)*(1 + S)*(3 + 2*S))))/sqrt(S*Power(1 + S,3)*(1 + 2*S)*Power(3 + 2*S,4))) ;
+          case 122: return -2*(2 + S)*sqrt(S/(6 + 19*S + 16*Power(S,2) + 4*Power(S,3))) ;
+          case 123: return 1 ;
+          case 124: return 1 ;
+          case 125: return sqrt(2)/sqrt((-1 + T)*T) ;
+          case 126: return sqrt(6)/sqrt((-1 + T)*T*(-1 + 2*T)*(1 + 2*T)) ;
+          case 127: return ((1 + T)*sqrt(((-2 + T)*T)/(-1 + Power(T,2))))/T ;
+          case 128: return ((1 + T)*sqrt(3 - 30/(1 + T) + 36/(1 + 2*T)))/((-1 + T)*T) ;
+          case 129: return 3/(T + 2*Power(T,2)) ;
+          case 130: return (9 - 13*Power(T,2) + 4*Power(T,4))/(T*sqrt(-9 + Power(T,2)*Power(7 - 4*Power(T,2),2))) ;
+          case 131: return (sqrt(3)*(-3 + T + 2*Power(T,2)))/(T*sqrt((-1 + T)*(1 + T)*(1 + 2*T)*(3 + 2*T))) ;
+          case 132: return sqrt(6)/sqrt(T*(1 + T)*(1 + 2*T)*(3 + 2*T)) ;
+          case 133: return (6*sqrt(((-1 + T)*T*(2 + T)*(-1 + 2*T)*(3 + 2*T))/(1 + 2*T)) - 9*sqrt((Power(T,3)*(2 + T)*(-1 + 2*T)*(3 + 2*T))/((-1 + T)*(1 + 2*T))) + 9*sqrt((Power(T,5)*(2 + T)*(-1 + 2*T)*(3 + 2*T))/((-1 + T)*(1 + 2*T))) - 4*sqrt((Power(T,3)*(2 + T)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T))/(-1 + T)) + 3*sqrt((Power(T,5)*(2 + T)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T))/(-1 + T)) + sqrt((Power(T,7)*(2 + T)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T))/(-1 + T)))/(T*Power(1 + T,1.5)*(2 + T)*sqrt(1 + 2*T)*(3 + 2*T)) ;
+          case 134: return sqrt((-2 + 4*T)/(T + 3*Power(T,2) + 2*Power(T,3))) ;
+          case 135: return (5 + 2*T)*sqrt((-1 + 2*T)/(15 + 46*T + 36*Power(T,2) + 8*Power(T,3))) ;
+          case 136: return 1 ;
+          case 137: return 1/T ;
+          case 138: return 1/(T + 2*Power(T,2)) ;
+          case 139: return 1/sqrt(S*(1 + 2*S)) ;
+          case 140: return 1/(sqrt(S*(1 + 2*S))*T) ;
+          case 141: return 1/(sqrt(S*(1 + 2*S))*(T + 2*Power(T,2))) ;
+          case 142: return sqrt(-1 + Power(T,2))/T ;
+          case 143: return sqrt(1 - 2/(1 + 2*T))/T ;
+          case 144: return 1/(T*sqrt((S*(1 + 2*S))/(-1 + Power(T,2)))) ;
+          case 145: return sqrt((-1 + 2*T)/((S + 2*Power(S,2))*(1 + 2*T)))/T ;
+          case 146: return (sqrt(T*(1 + T)*(-1 + 2*T)*(1 + 2*T)) + sqrt((T*(-1 + 2*T))/(1 + 3*T + 2*Power(T,2))) + sqrt((T*(-1 + 4*Power(T,2)))/(1 + T)))/sqrt(T*(1 + T)*(1 + 2*T)*(3 + 2*T)) ;
+          case 147: return (sqrt(T*(1 + T)*(-1 + 2*T)*(1 + 2*T)) + sqrt((T*(-1 + 2*T))/(1 + 3*T + 2*Power(T,2))) + sqrt((T*(-1 + 4*Power(T,2)))/(1 + T)))/sqrt(S*(1 + 2*S)*T*(1 + T)*(1 + 2*T)*(3 + 2*T)) ;
+          case 148: return ((1 + S)*sqrt((S*(-1 + 2*S))/(1 + 3*S + 2*Power(S,2))))/S ;
+          case 149: return ((1 + S)*sqrt((S*(-1 + 2*S))/(1 + 3*S + 2*Power(S,2))))/(S*T) ;
+          case 150: return ((1 + S)*sqrt((S*(-1 + 2*S))/(1 + 3*S + 2*Power(S,2))))/(S*T*(1 + 2*T)) ;
+          case 151: return 1/sqrt((1 + S)*(1 + 2*S)) ;
+          case 152: return 1/(sqrt((1 + S)*(1 + 2*S))*T) ;
+          case 153: return 1/(sqrt(1 + 3*S + 2*Power(S,2))*(T + 2*Power(T,2))) ;
+          case 154: return sqrt(((-1 + 2*S)*(-1 + T))/(S*(1 + 3*S + 2*Power(S,2))*Power(T,2)*(1 + T))) + (S*(-1 + 2*S)*(-1 + T))/sqrt(S*(1 + S)*(-1 + 4*Power(S,2))*(-1 + T)*(1 + T)) + (S*(-1 + 2*S))/sqrt((S*(1 + S)*(-1 + 4*Power(S,2))*Power(T,2)*(1 + T))/(-1 + T)) + (-1 + T)/sqrt((S*(1 + S)*(1 + 2*S)*(-1 + Power(T,2)))/(-1 + 2*S)) ;
+          case 155: return (-(S*(1 + S)*Power(1 + T,2)*sqrt((S*(1 + S)*(-1 + 2*T))/(-1 + 2*S))) + 2*Power(S,2)*(1 + S)*Power(1 + T,2)*sqrt((S*(1 + S)*(-1 + 2*T))/(-1 + 2*S)) + (1 + S)*Power(1 + T,2)*sqrt(S*(-1 + S + 2*Power(S,2))*(-1 + 2*T)) - S*sqrt((S*Power(1 + S,3)*Power(T,2)*Power(1 + T,4)*(-1 + 2*T))/(-1 + 2*S)) + 2*Power(S,2)*sqrt((S*Power(1 + S,3)*Power(T,2)*Power(1 + T,4)*(-1 + 2*T))/(-1 + 2*S)) + sqrt(S*Power(1 + S,3)*(-1 + 2*S)*Power(T,2)*Power(1 + T,4)*(-1 + 2*T)))/(S*Power(1 + S,2)*T*Power(1 + T,3)*sqrt((1 + 2*S)*(1 + 2*T))) ;
+          case 156: return (-sqrt(((1 + S)*Power(T,3)*(1 + T))/(-1 + T)) + sqrt(((1 + S)*Power(T,5)*(1 + T))/(-1 + T)) + sqrt((1 + S)*T*(-1 + Power(T,2))))/((1 + S)*sqrt(1 + 2*S)*Power(T,1.5)*(1 + T)) ;
+          case 157: return sqrt((-1 + 4*Power(T,2))/(1 + 3*S + 2*Power(S,2)))/(T + 2*Power(T,2)) ;
+          case 158: return (-sqrt((S*T*(1 + T)*(-1 + 2*T)*(1 + 2*T))/(-1 + 2*S)) + 2*sqrt((Power(S,3)*T*(1 + T)*(-1 + 2*T)*(1 + 2*T))/(-1 + 2*S)) + sqrt(((-1 + 2*S)*T*(1 + T)*(-1 + 2*T)*(1 + 2*T))/S) - sqrt((S*T*(-1 + 2*T))/((-1 + 2*S)*(1 + 3*T + 2*Power(T,2)))) + 2*sqrt((Power(S,3)*T*(-1 + 2*T))/((-1 + 2*S)*(1 + 3*T + 2*Power(T,2)))) + sqrt(((-1 + 2*S)*T*(-1 + 2*T))/(S*(1 + 3*T + 2*Power(T,2)))) - sqrt((S*T*(-1 + 4*Power(T,2)))/((-1 + 2*S)*(1 + T))) + 2*S*sqrt((S*T*(-1 + 4*Power(T,2)))/((-1 + 2*S)*(1 + T))) + sqrt(((-1 + 2*S)*T*(-1 + 4*Power(T,2)))/(S*(1 + T))))/sqrt((1 + S)*(1 + 2*S)*T*(1 + T)*(1 + 2*T)*(3 + 2*T)) ;
+          case 159: return (sqrt(S/(3 + 5*T + 2*Power(T,2)))*(T*sqrt(((1 + S)*(1 + 2*S)*(-1 + 2*T))/(S*(1 + T))) + T*sqrt((S*(1 + S)*(1 + 2*S)*(-1 + 2*T))/(1 + T)) + T*sqrt(((1 + S)*(1 + 2*S)*(-1 + 2*T))/(S*(1 + T)))*(1 + 2*T) + T*sqrt((S*(1 + S)*(1 + 2*S)*(-1 + 2*T))/(1 + T))*(1 + 2*T) + T*(1 + 2*T)*sqrt(((1 + S)*(1 + 2*S)*(-1 + T + 2*Power(T,2)))/S) + S*T*(1 + 2*T)*sqrt(((1 + S)*(1 + 2*S)*(-1 + T + 2*Power(T,2)))/S)))/(Power(1 + S,2)*(1 + 2*S)*T*(1 + 2*T)) ;
+          case 160: return ((3 + 2*S)*sqrt((S*(1 + S))/(3 + 4*S*(2 + S))))/(1 + S) ;
+          case 161: return ((3 + 2*S)*sqrt((S*(1 + S))/(3 + 4*S*(2 + S))))/((1 + S)*T) ;
+          case 162: return sqrt((S*(3 + 4*S*(2 + S)))/(1 + S))/((1 + 2*S)*T*(1 + 2*T)) ;
+          case 163: return (sqrt((S*(-1 + T))/((1 + S)*T)) + (1 + 2*S)*sqrt((S*(-1 + T))/((1 + S)*T)) + (1 + 2*S)*sqrt((S*(1 + S)*(-1 + T))/T) - (1 + 2*S)*sqrt((S*(1 + S))/((-1 + T)*T))*T + (1 + 2*S)*sqrt((S*(1 + S))/((-1 + T)*T))*Power(T,2) - sqrt((S*T)/((1 + S)*(-1 + T))) - (1 + 2*S)*sqrt((S*T)/((1 + S)*(-1 + T))) + (1 + 2*S)*T*sqrt((S*T)/((1 + S)*(-1 + T))) + sqrt((S*Power(T,3))/((1 + S)*(-1 + T))))/((1 + S)*sqrt((3 + 4*S*(2 + S))*T*(1 + T))) ;
+          case 164: return (sqrt((1 + 2*S)*T*(1 + T)*(-1 + 2*T)*(1 + 2*T)) + sqrt(Power(1 + 2*S,3)*T*(1 + T)*(-1 + 2*T)*(1 + 2*T)) + sqrt(Power(1 + S,2)*Power(1 + 2*S,3)*T*(1 + T)*(-1 + 2*T)*(1 + 2*T)) + T*sqrt(Power(1 + S,2)*Power(1 + 2*S,3)*T*(1 + T)*(-1 + 2*T)*(1 + 2*T)) + sqrt((1 + 2*S)*Power(T,3)*(1 + T)*(-1 + 2*T)*(1 + 2*T)) + sqrt((1 + T)*(-1 + 2*T)*(1 + 2*T)*Power(T + 2*S*T,3)))/sqrt((Power(1 + S,3)*Power(1 + 2*S,2)*(3 + 2*S)*Power(1 + 2*T,2)*Power(T + Power(T,2),3))/S) ;
+          case 165: return ((3 + 2*S)*(sqrt((1 + T)*(-1 + 2*T)*(1 + 2*T)) + 2*sqrt(-4 + 4*T + 3/(1 + T)) + 2*T*(sqrt((1 + T)*(-1 + 2*T)*(1 + 2*T)) + sqrt(-4 + 4*T + 3/(1 + T)))))/((1 + 2*T)*sqrt(((1 + S)*(1 + 2*S)*(3 + 2*S)*(1 + T)*(1 + 2*T)*(3 + 2*T))/S)) ;
+          case 166: return -1 ;
+          case 167: return -(1/T) ;
+          case 168: return -(1/(T + 2*Power(T,2))) ;
+          case 169: return 1/(-1 - 2*S) ;
+          case 170: return -(1/(T + 2*S*T)) ;
+          case 171: return -(1/((1 + 2*T)*(T + 2*S*T))) ;
+          case 172: return -(sqrt(-1 + Power(T,2))/T) ;
+          case 173: return -(sqrt(1 - 2/(1 + 2*T))/T) ;
+          case 174: return -(sqrt(-1 + Power(T,2))/(T + 2*S*T)) ;
+          case 175: return -(sqrt(1 - 2/(1 + 2*T))/(T + 2*S*T)) ;
+          case 176: return -((sqrt(T*(1 + T)*(-1 + 2*T)*(1 + 2*T)) + sqrt((T*(-1 + 2*T))/(1 + 3*T + 2*Power(T,2))) + sqrt((T*(-1 + 4*Power(T,2)))/(1 + T)))/sqrt(T*(1 + T)*(1 + 2*T)*(3 + 2*T))) ;
+          case 177: return (-sqrt(T*(1 + T)*(-1 + 2*T)*(1 + 2*T)) - sqrt((T*(-1 + 2*T))/(1 + 3*T + 2*Power(T,2))) - sqrt((T*(-1 + 4*Power(T,2)))/(1 + T)))/((1 + 2*S)*sqrt(T*(1 + T)*(1 + 2*T)*(3 + 2*T))) ;
+          case 178: return (-2*sqrt(S*(1 + S)))/(1 + 2*S) ;
+          case 179: return (-2*sqrt(S*(1 + S)))/(T + 2*S*T) ;
+          case 180: return (-2*sqrt(S*(1 + S)))/((1 + 2*S)*(T + 2*Power(T,2))) ;
+          case 181: return (-2*sqrt((1 + S)/(1 + T))*(-(T*sqrt((S*T)/(-1 + T))) + sqrt(S*(-1 + T)*T) + sqrt((S*Power(T,5))/(-1 + T))))/((1 + 2*S)*Power(T,1.5)) ;
+          case 182: return (-2*sqrt(S*(1 + S)*(-1 + 4*Power(T,2))))/((1 + 2*S)*(T + 2*Power(T,2))) ;
+          case 183: return -((sqrt(S)*(2*S*(1 + T)*(2*sqrt(((1 + S)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T))/(1 + T)) + sqrt((1 + S)*(1 + T)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T)) + 2*T*(sqrt(((1 + S)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T))/(1 + T)) + sqrt((1 + S)*(1 + T)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T)))) + (3 + 2*T)*(sqrt(((1 + S)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T))/(1 + T)) + sqrt((1 + S)*(1 + T)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T)) + T*(sqrt(((1 + S)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T))/(1 + T)) + 2*sqrt((1 + S)*(1 + T)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T))))))/((1 + S)*(1 + 2*S)*Power((1 + T)*(1 + 2*T),1.5)*(3 + 2*T))) ;
+          case 184: return 1 ;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(1, 2, 1));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(1, 2, 1));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -81,10 +830,432 @@ MatrixElements<SC> SymmetryQST<SC>::recalc_doublet(const DiagInfo<SC> &diag, con
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "qst/qst-doubletp0.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {2, 3},
+        {3, 2},
+        {3, 3},
+        {3, 4},
+        {4, 3},
+        {4, 4},
+        {5, 2},
+        {5, 3},
+        {5, 5},
+        {5, 6},
+        {6, 2},
+        {6, 3},
+        {6, 4},
+        {6, 5},
+        {6, 6},
+        {6, 7},
+        {7, 3},
+        {7, 4},
+        {7, 6},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {9, 10},
+        {10, 9},
+        {10, 10},
+        {10, 11},
+        {11, 10},
+        {11, 11},
+        {11, 12},
+        {12, 11},
+        {12, 12},
+        {12, 13},
+        {13, 12},
+        {13, 13},
+        {14, 14},
+        {14, 15},
+        {15, 14},
+        {15, 15},
+        {15, 16},
+        {16, 15},
+        {16, 16},
+        {17, 14},
+        {17, 15},
+        {17, 17},
+        {17, 18},
+        {18, 14},
+        {18, 15},
+        {18, 16},
+        {18, 17},
+        {18, 18},
+        {18, 19},
+        {19, 15},
+        {19, 16},
+        {19, 18},
+        {19, 19},
+        {20, 17},
+        {20, 18},
+        {20, 20},
+        {20, 21},
+        {21, 17},
+        {21, 18},
+        {21, 19},
+        {21, 20},
+        {21, 21},
+        {21, 22},
+        {22, 18},
+        {22, 19},
+        {22, 21},
+        {22, 22},
+        {23, 23},
+        {23, 24},
+        {24, 23},
+        {24, 24},
+        {24, 25},
+        {25, 24},
+        {25, 25},
+        {26, 23},
+        {26, 24},
+        {26, 26},
+        {26, 27},
+        {27, 23},
+        {27, 24},
+        {27, 25},
+        {27, 26},
+        {27, 27},
+        {27, 28},
+        {28, 24},
+        {28, 25},
+        {28, 27},
+        {28, 28},
+        {29, 29},
+        {29, 30},
+        {30, 29},
+        {30, 30},
+        {30, 31},
+        {31, 30},
+        {31, 31},
+        {31, 32},
+        {32, 31},
+        {32, 32},
+        {32, 33},
+        {33, 32},
+        {33, 33},
+        {34, 29},
+        {34, 30},
+        {34, 34},
+        {34, 35},
+        {35, 29},
+        {35, 30},
+        {35, 31},
+        {35, 34},
+        {35, 35},
+        {35, 36},
+        {36, 30},
+        {36, 31},
+        {36, 32},
+        {36, 35},
+        {36, 36},
+        {36, 37},
+        {37, 31},
+        {37, 32},
+        {37, 33},
+        {37, 36},
+        {37, 37},
+        {37, 38},
+        {38, 32},
+        {38, 33},
+        {38, 37},
+        {38, 38},
+        {39, 39},
+        {40, 39},
+        {40, 40},
+        {41, 40},
+        {41, 41},
+        {42, 41},
+        {42, 42},
+        {43, 43},
+        {44, 44},
+        {44, 45},
+        {45, 44},
+        {45, 45},
+        {45, 46},
+        {46, 45},
+        {46, 46},
+        {46, 47},
+        {47, 46},
+        {47, 47},
+        {47, 48},
+        {48, 47},
+        {48, 48},
+        {49, 49},
+        {49, 50},
+        {50, 49},
+        {50, 50},
+        {50, 51},
+        {51, 50},
+        {51, 51},
+        {52, 49},
+        {52, 50},
+        {52, 52},
+        {52, 53},
+        {53, 49},
+        {53, 50},
+        {53, 51},
+        {53, 52},
+        {53, 53},
+        {53, 54},
+        {54, 50},
+        {54, 51},
+        {54, 53},
+        {54, 54},
+        {55, 52},
+        {55, 53},
+        {55, 55},
+        {55, 56},
+        {56, 52},
+        {56, 53},
+        {56, 54},
+        {56, 55},
+        {56, 56},
+        {56, 57},
+        {57, 53},
+        {57, 54},
+        {57, 56},
+        {57, 57},
+        {58, 58},
+        {58, 59},
+        {59, 58},
+        {59, 59},
+        {59, 60},
+        {60, 59},
+        {60, 60},
+        {61, 58},
+        {61, 59},
+        {61, 61},
+        {61, 62},
+        {62, 58},
+        {62, 59},
+        {62, 60},
+        {62, 61},
+        {62, 62},
+        {62, 63},
+        {63, 59},
+        {63, 60},
+        {63, 62},
+        {63, 63},
+        {64, 64}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1 ;
+          case 1: return (-2*sqrt(S*(1 + S)*(-1 + Power(T,2))))/(T + 2*S*T) ;
+          case 2: return (-2*sqrt((S*(1 + S)*(-1 + 2*T))/(1 + 2*T)))/(T + 2*S*T) ;
+          case 3: return (2*sqrt(S*(1 + S)))/(T + 2*S*T) ;
+          case 4: return (-2*sqrt(S*(1 + S))*(-1 + T + Power(T,2)))/((1 + 2*S)*T*(1 + T)) ;
+          case 5: return (-2*sqrt(S*(1 + S)))/(1 + 2*S + T + 2*S*T) ;
+          case 6: return (2*(1 + S)*(2*sqrt((S + 2*S*T)/(1 + 2*S)) + sqrt(S/(1 + 2*S + 2*T + 4*S*T)) - 2*T*sqrt(S/(1 + 2*S + 2*T + 4*S*T))))/((1 + T)*sqrt((1 + S)*(1 + 2*S)*(3 + 2*T))) ;
+          case 7: return (-2*sqrt((1 + S)/((1 + 2*S)*(6 + 7*T + 2*Power(T,2))))*(6*sqrt((S*T)/(3 + 6*S + 2*T + 4*S*T)) + 7*sqrt((S*Power(T,3))/(3 + 6*S + 2*T + 4*S*T)) + 2*sqrt((S*Power(T,5))/(3 + 6*S + 2*T + 4*S*T))))/(1 + T) ;
+          case 8: return sqrt(-1 + Power(T,2))/(T + 2*S*T) ;
+          case 9: return sqrt(1 - 2/(1 + 2*T))/(T + 2*S*T) ;
+          case 10: return -sqrt(1 - Power(T,-2)) ;
+          case 11: return -(sqrt(1 - 2/(1 + 2*T))/T) ;
+          case 12: return -(1/(T + 2*S*T)) ;
+          case 13: return (-1 + T + Power(T,2))/((1 + 2*S)*(T + Power(T,2))) ;
+          case 14: return 1/(1 + 2*S + T + 2*S*T) ;
+          case 15: return 1/T ;
+          case 16: return -1 + 1/T - 1/(1 + T) ;
+          case 17: return -(((1 + 2*S)*(27*(sqrt(Power(1 + S,3)*(3 + 2*S)*T*Power(1 + T,4)*(3 + 2*T)) + 2*sqrt((Power(1 + S,3)*(3 + 2*S)*T*Power(1 + T,4)*(3 + 2*T))/Power(1 + 2*S,2))) + 2*S*(1 + T)*(3 + 2*T)*(3*sqrt(Power(1 + S,3)*(3 + 2*S)*T*Power(1 + T,4)*(3 + 2*T)) + 6*sqrt((Power(1 + S,3)*(3 + 2*S)*T*Power(1 + T,4)*(3 + 2*T))/Power(1 + 2*S,2)) + 4*T*sqrt((Power(1 + S,3)*(3 + 2*S)*T*Power(1 + T,4)*(3 + 2*T))/Power(1 + 2*S,2))) + T*(45*sqrt(Power(1 + S,3)*(3 + 2*S)*T*Power(1 + T,4)*(3 + 2*T)) + 126*sqrt((Power(1 + S,3)*(3 + 2*S)*T*Power(1 + T,4)*(3 + 2*T))/Power(1 + 2*S,2)) + 2*sqrt(Power(1 + S,3)*Power(3 + 2*S,3)*T*Power(1 + T,6)*Power(3 + 2*T,3)) + 6*T*(3*sqrt(Power(1 + S,3)*(3 + 2*S)*T*Power(1 + T,4)*(3 + 2*T)) + 16*sqrt((Power(1 + S,3)*(3 + 2*S)*T*Power(1 + T,4)*(3 + 2*T))/Power(1 + 2*S,2)) + 4*T*sqrt((Power(1 + S,3)*(3 + 2*S)*T*Power(1 + T,4)*(3 + 2*T))/Power(1 + 2*S,2))))))/(Power(1 + S,1.5)*sqrt(T)*Power(1 + T,4)*Power((3 + 2*S)*(3 + 2*T),2.5))) ;
+          case 18: return (sqrt(2 - 1/(1 + S))*(1 + 2*T)*(-sqrt(((1 + S)*(3 + 2*T))/((1 + 2*S)*Power(1 + 2*T,3))) + 2*T*sqrt(((1 + S)*(3 + 2*T))/((1 + 2*S)*Power(1 + 2*T,3))) - 2*sqrt(((1 + S)*(3 + 2*T))/((1 + 2*S)*(1 + 2*T))) + 2*S*(sqrt(((1 + S)*(3 + 2*T))/(Power(1 + 2*S,3)*Power(1 + 2*T,3))) - 2*T*sqrt(((1 + S)*(3 + 2*T))/(Power(1 + 2*S,3)*Power(1 + 2*T,3))) + 2*sqrt(((1 + S)*(3 + 2*T))/(Power(1 + 2*S,3)*(1 + 2*T))))))/((1 + T)*(3 + 2*T)) ;
+          case 19: return (T*(18*sqrt(((1 + S)*(3 + 2*T))/T) + 51*sqrt((1 + S)*T*(3 + 2*T)) + 53*sqrt((1 + S)*Power(T,3)*(3 + 2*T)) + 24*sqrt((1 + S)*Power(T,5)*(3 + 2*T)) + 4*sqrt((1 + S)*Power(T,7)*(3 + 2*T))))/((1 + 2*S)*Power(1 + T,2)*sqrt((1 + S)*(2 + T))*Power(3 + 2*T,2.5)) ;
+          case 20: return (81*sqrt((3 + 2*S)*T*(1 + 2*T)) + 165*sqrt((3 + 2*S)*Power(T,3)*(1 + 2*T)) + 188*sqrt((3 + 2*S)*Power(T,5)*(1 + 2*T)) + 84*sqrt((3 + 2*S)*Power(T,7)*(1 + 2*T)) + 16*sqrt((3 + 2*S)*Power(T,9)*(1 + 2*T)) + 2*S*(27*sqrt((3 + 2*S)*T*(1 + 2*T)) + 81*sqrt((3 + 2*S)*Power(T,3)*(1 + 2*T)) + 90*sqrt((3 + 2*S)*Power(T,5)*(1 + 2*T)) + 44*sqrt((3 + 2*S)*Power(T,7)*(1 + 2*T)) + 8*sqrt((3 + 2*S)*Power(T,9)*(1 + 2*T))) + 2*T*sqrt((3 + 2*S)*T*(1 + 2*T))*(39 + T*(41 + 4*T*(6 + T))))/(Power(3 + 2*S,1.5)*sqrt(T)*Power(1 + T,2)*(1 + 2*T)*Power(3 + 2*T,2.5)) ;
+          case 21: return -(sqrt(T*(2 + T))/(1 + T)) ;
+          case 22: return 1 ;
+          case 23: return sqrt(1 - 2/(-1 + T) + 2/T) ;
+          case 24: return sqrt((-6 + 4*T)/(T - 3*Power(T,2) + 2*Power(T,3))) ;
+          case 25: return -(sqrt(2)/sqrt((-1 + T)*T)) ;
+          case 26: return (-3 + Power(T,2))/sqrt(Power(T,2)*(-1 + Power(T,2))) ;
+          case 27: return (sqrt(3)*(-3 + T + 2*Power(T,2)))/(T*sqrt((-1 + T)*(1 + T)*(1 + 2*T)*(3 + 2*T))) ;
+          case 28: return -((sqrt(3)*(-3 + T + 2*Power(T,2)))/(T*sqrt((1 + T)*(3 - 7*T + 4*Power(T,3))))) ;
+          case 29: return 1 - 3/T + 3/(1 + T) ;
+          case 30: return 1/((1 + T)*sqrt((T*(3 + 2*T))/(-6 + 9*T + 6*Power(T,2)))) ;
+          case 31: return sqrt(3)*sqrt(1 + T)*((-3 + T)*T*(-1 + 2*T)*sqrt((1 + 2*T)/(T*Power(1 + T,3)*Power(3 + 2*T,2)*(-2 + 3*T + 2*Power(T,2)))) + 6*sqrt((Power(-1 + T,2)*(-1 + 2*T))/(T*Power(1 + T,3)*Power(3 + 2*T,2)*(2 + 5*T + 2*Power(T,2)))) + (1 - 2*T)*sqrt((T*(1 + 2*T))/(Power(3 + 2*T,2)*(-2 + T + 5*Power(T,2) + 2*Power(T,3)))) + (3*(-3 + 2*T)*sqrt((T*(-1 + 2*T))/(2 + 7*T + 7*Power(T,2) + 2*Power(T,3))))/(3 + 5*T + 2*Power(T,2))) ;
+          case 32: return (-2 + T*(2 + T))/((1 + T)*sqrt(T*(2 + T))) ;
+          case 33: return (sqrt(2 + 2/T)*(45*T*sqrt(T*(1 + T)*(2 + T)*(3 + 2*T)) + 2*(15*sqrt(T*(1 + T)*(2 + T)*(3 + 2*T)) + 9*sqrt(Power(T,5)*(1 + T)*(2 + T)*(3 + 2*T)) + sqrt(Power(T,3)*Power(1 + T,3)*(2 + T)*Power(1 + 2*T,2)*(3 + 2*T)))))/(Power(2 + T,2)*Power((1 + T)*(3 + 2*T),1.5)*(5 + 2*T)) ;
+          case 34: return -((sqrt(2)*(30*sqrt(T*(1 + T)*(2 + T)*(3 + 2*T)) + 47*sqrt(Power(T,3)*(1 + T)*(2 + T)*(3 + 2*T)) + 24*sqrt(Power(T,5)*(1 + T)*(2 + T)*(3 + 2*T)) + 4*sqrt(Power(T,7)*(1 + T)*(2 + T)*(3 + 2*T))))/((1 + T)*Power(2 + T,2)*Power(3 + 2*T,2)*sqrt(T*(5 + 2*T)))) ;
+          case 35: return ((3 + T)*sqrt((T*(1 + T))/(6 + 5*T + Power(T,2))))/(1 + T) ;
+          case 36: return (-1 + 2*S)*sqrt(((1 + S)*(-1 + Power(T,2)))/((-S + 4*Power(S,3))*Power(T,2))) ;
+          case 37: return (-1 + 2*S)*(-1 + 2*T)*sqrt((1 + S)/((-S + 4*Power(S,3))*Power(T,2)*(-1 + 4*Power(T,2)))) ;
+          case 38: return ((1 - 2*S)*sqrt(-((1 + S)/(S - 4*Power(S,3)))))/T ;
+          case 39: return (-1 + 2*S)*(-1 + T + Power(T,2))*sqrt((1 + S)/(S*(-1 + 4*Power(S,2))*Power(T + Power(T,2),2))) ;
+          case 40: return 1/(sqrt((S*(1 + 2*S))/(-1 + S + 2*Power(S,2)))*(1 + T)) ;
+          case 41: return -((-1 + 2*S)*(3 + 2*T)*sqrt((1 + S)/(S*(-1 + 4*Power(S,2))*Power(1 + T,2)*(3 + 4*T*(2 + T))))) ;
+          case 42: return sqrt(((-1 + S + 2*Power(S,2))*T*(2 + T))/(S*(1 + 2*S)))/(1 + T) ;
+          case 43: return -(1/sqrt((S*(1 + 2*S)*Power(T,2))/(-1 + Power(T,2)))) ;
+          case 44: return (1 - 2*T)/(T*sqrt(S*(1 + 2*S)*(-1 + 4*Power(T,2)))) ;
+          case 45: return (3 + 2*S)*sqrt((S*(-1 + Power(T,2)))/((3 + 11*S + 12*Power(S,2) + 4*Power(S,3))*Power(T,2))) ;
+          case 46: return (3 + 2*S)*sqrt((S*(-1 + 2*T))/((3 + 11*S + 12*Power(S,2) + 4*Power(S,3))*Power(T,2)*(1 + 2*T))) ;
+          case 47: return (-((-1 + T)*T*sqrt(S*(1 + S)*T*(1 + T))) + sqrt(Power(S,3)*(1 + S)*Power(T,3)*(1 + T)) + sqrt(S*(1 + S)*Power(T,5)*(1 + T)))/(S*Power(1 + S,1.5)*Power(T,2.5)*sqrt((1 + 2*S)*(1 + T))) ;
+          case 48: return (1 - T*(1 + T))/(sqrt(S*(1 + 2*S))*T*(1 + T)) ;
+          case 49: return -(1/(sqrt(S*(1 + 2*S))*(1 + T))) ;
+          case 50: return (-3*S*(1 + S)*sqrt(S*(1 + S)*(1 + T)) + T*(-(Power(S,2)*sqrt(S*(1 + S)*(1 + T))) + sqrt(Power(S,5)*(1 + S)*(1 + T))) - 2*(sqrt(Power(S,5)*(1 + S)*(1 + T)) + sqrt(Power(S,7)*(1 + S)*(1 + T))))/(S*Power(1 + S,2)*T*sqrt((3 + 4*S*(2 + S))*(1 + T))) ;
+          case 51: return ((3*sqrt(S*(1 + S)) + 2*sqrt(Power(S,3)*(1 + S)))*(-1 + T + Power(T,2)))/((1 + S)*sqrt(3 + 4*S*(2 + S))*T*(1 + T)) ;
+          case 52: return (3 + 2*S)/(sqrt(((1 + S)*(1 + 2*S)*(3 + 2*S))/S)*(1 + T)) ;
+          case 53: return (2*sqrt(((1 + 2*S)*T*(1 + 2*T))/S) - 2*sqrt(((1 + 2*S)*Power(T,3))/(S + 2*S*T)) + sqrt((T + 2*S*T)/(S + 2*S*T)))/((1 + 2*S)*(1 + T)*sqrt(T*(3 + 2*T))) ;
+          case 54: return -(sqrt((T*(2 + T))/(S*(1 + 2*S)))/(1 + T)) ;
+          case 55: return (-3*sqrt((S*(3 + 4*S*(2 + S))*T)/(1 + 2*T)) - 4*S*sqrt((S*(3 + 4*S*(2 + S))*T)/(1 + 2*T)) + 6*sqrt((S*(3 + 4*S*(2 + S))*Power(T,3))/(1 + 2*T)) - 6*sqrt(S*(3 + 4*S*(2 + S))*T*(1 + 2*T)) - 2*sqrt(Power(S,3)*(3 + 4*S*(2 + S))*T*(1 + 2*T)))/((3 + 4*S*(2 + S))*(1 + T)*sqrt((1 + S)*T*(3 + 2*T))) ;
+          case 56: return (34*sqrt((S*(1 + S)*T*(2 + T))/(1 + T)) + 12*S*sqrt((S*(1 + S)*T*(2 + T))/(1 + T)) + 83*sqrt((S*(1 + S)*Power(T,3)*(2 + T))/(1 + T)) + 18*sqrt((Power(S,3)*(1 + S)*Power(T,3)*(2 + T))/(1 + T)) + 65*sqrt((S*(1 + S)*Power(T,5)*(2 + T))/(1 + T)) + 6*sqrt((Power(S,3)*(1 + S)*Power(T,5)*(2 + T))/(1 + T)) + 16*sqrt((S*(1 + S)*Power(T,7)*(2 + T))/(1 + T)) + 2*sqrt(S*(1 + S)*T*(1 + T)*(2 + T)) + 12*sqrt(Power(S,3)*(1 + S)*T*(1 + T)*(2 + T)) + 34*sqrt(Power(S,3)*(1 + S)*Power(T,3)*(1 + T)*(2 + T)) + 22*sqrt(Power(S,3)*(1 + S)*Power(T,5)*(1 + T)*(2 + T)) + 4*sqrt(Power(S,3)*(1 + S)*Power(T,7)*(1 + T)*(2 + T)) + T*(1 + T)*sqrt(S*(1 + S)*T*(1 + T)*(2 + T))*(11 + 6*T))/((1 + S)*sqrt(3 + 4*S*(2 + S))*Power(1 + T,1.5)*Power(2 + T,2)*(3 + 2*T)) ;
+          case 57: return (2*S*(sqrt(((1 + 2*S)*(-1 + T))/((3 + 5*S + 2*Power(S,2))*T)) + 2*sqrt((-1 + T)/((3 + 11*S + 12*Power(S,2) + 4*Power(S,3))*T))) - 2*sqrt(((1 + S)*(1 + 2*S)*(-1 + T))/((3 + 2*S)*T)) - sqrt(((1 + 2*S)*(-1 + T))/((3 + 5*S + 2*Power(S,2))*T)))*sqrt((1 + T)/(3*T + 2*S*T)) ;
+          case 58: return sqrt((1 + T)/((3 + 2*S)*(T + 2*Power(T,2))))*(-2*sqrt(((1 + S)*(1 + 2*S)*(-1 + 2*T))/((3 + 2*S)*T*(1 + T))) - sqrt(((1 + 2*S)*(-1 + 2*T))/((3 + 5*S + 2*Power(S,2))*T*(1 + T))) + 2*S*(sqrt(((1 + 2*S)*(-1 + 2*T))/((3 + 5*S + 2*Power(S,2))*T*(1 + T))) + 2*sqrt((-1 + 2*T)/((3 + 11*S + 12*Power(S,2) + 4*Power(S,3))*T*(1 + T))))) ;
+          case 59: return sqrt(-1 + Power(T,2))/T ;
+          case 60: return sqrt(1 - 2/(1 + 2*T))/T ;
+          case 61: return 1/(sqrt((1 + S)*(1 + 2*S))*T) ;
+          case 62: return (1 - T*(1 + T))/(sqrt((1 + S)*(1 + 2*S))*T*(1 + T)) ;
+          case 63: return -(1/(sqrt((1 + S)*(1 + 2*S))*(1 + T))) ;
+          case 64: return -(1/T) ;
+          case 65: return 1 - 1/T + 1/(1 + T) ;
+          case 66: return 1/(1 + T) ;
+          case 67: return (3 + 2*T)/((1 + T)*sqrt((1 + S)*(1 + 2*S)*(3 + 4*T*(2 + T)))) ;
+          case 68: return (-9*(2*sqrt(((3 + 4*S*(2 + S))*T*(1 + T)*(3 + 2*T))/(2 + T)) + sqrt((3 + 4*S*(2 + S))*T*(1 + T)*(2 + T)*(3 + 2*T))) - 3*T*(3*sqrt(((3 + 4*S*(2 + S))*T*(1 + T)*(3 + 2*T))/(2 + T)) + 7*sqrt((3 + 4*S*(2 + S))*T*(1 + T)*(2 + T)*(3 + 2*T)) + 2*T*sqrt((3 + 4*S*(2 + S))*T*(1 + T)*(2 + T)*(3 + 2*T))) + 2*S*(-6*sqrt(((3 + 4*S*(2 + S))*T*(1 + T)*(3 + 2*T))/(2 + T)) + 6*sqrt(((3 + 4*S*(2 + S))*Power(T,3)*(1 + T)*(3 + 2*T))/(2 + T)) - 3*sqrt((3 + 4*S*(2 + S))*T*(1 + T)*(2 + T)*(3 + 2*T)) - T*(9*sqrt(((3 + 4*S*(2 + S))*T*(1 + T)*(3 + 2*T))/(2 + T)) + 7*sqrt((3 + 4*S*(2 + S))*T*(1 + T)*(2 + T)*(3 + 2*T)) + 2*T*sqrt((3 + 4*S*(2 + S))*T*(1 + T)*(2 + T)*(3 + 2*T)))))/((2 + T)*sqrt((1 + S)*Power(1 + 2*S,2)*Power(3 + 2*S,3)*Power(1 + T,3)*Power(3 + 2*T,3))) ;
+          case 69: return (-2*sqrt(((2 + S)*(1 + 2*S))/(1 + T)) - sqrt((2 + S)*(1 + 2*S)*(1 + T)) + T*(sqrt(((2 + S)*(1 + 2*S))/(1 + T)) + 2*T*sqrt(((2 + S)*(1 + 2*S))/(1 + T)) - 2*sqrt((2 + S)*(1 + 2*S)*(1 + T))))/sqrt((2 + S)*(1 + 2*S)*(1 + T)*(1 + 2*T)*(3 + 2*T)) ;
+          case 70: return sqrt((1 + 2*T)/(Power(2 + S,6)*Power(1 + 2*S,2)*(3 + 2*S)*Power(1 + T,2)*Power(2 + T,4)*(3 + 2*T)))*(6*sqrt((Power(2 + S,4)*Power(1 + 2*S,2)*T*Power(2 + T,3)*(1 + 2*T))/((3 + 2*S)*(3 + 2*T))) + 4*sqrt((Power(2 + S,4)*Power(1 + 2*S,4)*T*Power(2 + T,3)*(1 + 2*T))/((3 + 2*S)*(3 + 2*T))) + 2*sqrt((Power(1 + S,2)*Power(2 + S,4)*Power(1 + 2*S,4)*T*Power(2 + T,3)*(1 + 2*T))/((3 + 2*S)*(3 + 2*T))) + 2*sqrt((Power(2 + S,4)*Power(1 + 2*S,4)*T*Power(1 + T,2)*Power(2 + T,3)*(1 + 2*T))/((3 + 2*S)*(3 + 2*T))) + sqrt((Power(1 + S,2)*Power(2 + S,4)*Power(1 + 2*S,4)*T*Power(1 + T,2)*Power(2 + T,3)*(1 + 2*T))/((3 + 2*S)*(3 + 2*T))) + 3*Power(2 + S,2.5)*(1 + 2*S)*Power((1 + T)*(2 + T),1.5)*sqrt((T*(1 + 2*T))/((6 + 7*S + 2*Power(S,2))*(3 + 5*T + 2*Power(T,2)))) + 9*Power(2 + S,2.5)*(1 + 2*S)*Power(2 + T,2)*sqrt(T/((6 + 7*S + 2*Power(S,2))*(6 + 19*T + 16*Power(T,2) + 4*Power(T,3)))) + 6*Power(2 + S,2.5)*Power(1 + 2*S,2)*Power(2 + T,2)*sqrt(T/((6 + 7*S + 2*Power(S,2))*(6 + 19*T + 16*Power(T,2) + 4*Power(T,3)))) + 3*sqrt((Power(1 + S,2)*Power(2 + S,4)*Power(1 + 2*S,4)*T*Power(2 + T,3))/((3 + 2*S)*(3 + 4*T*(2 + T))))) ;
+          case 71: return (-2*sqrt(S*(1 + S)*(-1 + Power(T,2))))/(T + 2*S*T) ;
+          case 72: return (-2*sqrt((S*(1 + S)*(-1 + 2*T))/(1 + 2*T)))/(T + 2*S*T) ;
+          case 73: return (2*sqrt(S*(1 + S)))/(T + 2*S*T) ;
+          case 74: return (-2*sqrt(S*(1 + S))*(-1 + T + Power(T,2)))/((1 + 2*S)*T*(1 + T)) ;
+          case 75: return (-2*sqrt(S*(1 + S)))/(1 + 2*S + T + 2*S*T) ;
+          case 76: return (2*(1 + S)*(2*sqrt((S + 2*S*T)/(1 + 2*S)) + sqrt(S/(1 + 2*S + 2*T + 4*S*T)) - 2*T*sqrt(S/(1 + 2*S + 2*T + 4*S*T))))/((1 + T)*sqrt((1 + S)*(1 + 2*S)*(3 + 2*T))) ;
+          case 77: return (-2*sqrt((1 + S)/((1 + 2*S)*(6 + 7*T + 2*Power(T,2))))*(6*sqrt((S*T)/(3 + 6*S + 2*T + 4*S*T)) + 7*sqrt((S*Power(T,3))/(3 + 6*S + 2*T + 4*S*T)) + 2*sqrt((S*Power(T,5))/(3 + 6*S + 2*T + 4*S*T))))/(1 + T) ;
+          case 78: return sqrt(-1 + Power(T,2))/(T + 2*S*T) ;
+          case 79: return sqrt(1 - 2/(1 + 2*T))/(T + 2*S*T) ;
+          case 80: return -sqrt(1 - Power(T,-2)) ;
+          case 81: return -(sqrt(1 - 2/(1 + 2*T))/T) ;
+          case 82: return -(1/(T + 2*S*T)) ;
+          case 83: return (-1 + T + Power(T,2))/((1 + 2*S)*(T + Power(T,2))) ;
+          case 84: return 1/(1 + 2*S + T + 2*S*T) ;
+          case 85: return 1/T ;
+          case 86: return -1 + 1/T - 1/(1 + T) ;
+          case 87: return -(((1 + 2*S)*(27*(sqrt(Power(1 + S,3)*(3 + 2*S)*T*Power(1 + T,4)*(3 + 2*T)) + 2*sqrt((Power(1 + S,3)*(3 + 2*S)*T*Power(1 + T,4)*(3 + 2*T))/Power(1 + 2*S,2))) + 2*S*(1 + T)*(3 + 2*T)*(3*sqrt(Power(1 + S,3)*(3 + 2*S)*T*Power(1 + T,4)*(3 + 2*T)) + 6*sqrt((Power(1 + S,3)*(3 + 2*S)*T*Power(1 + T,4)*(3 + 2*T))/Power(1 + 2*S,2)) + 4*T*sqrt((Power(1 + S,3)*(3 + 2*S)*T*Power(1 + T,4)*(3 + 2*T))/Power(1 + 2*S,2))) + T*(45*sqrt(Power(1 + S,3)*(3 + 2*S)*T*Power(1 + T,4)*(3 + 2*T)) + 126*sqrt((Power(1 + S,3)*(3 + 2*S)*T*Power(1 + T,4)*(3 + 2*T))/Power(1 + 2*S,2)) + 2*sqrt(Power(1 + S,3)*Power(3 + 2*S,3)*T*Power(1 + T,6)*Power(3 + 2*T,3)) + 6*T*(3*sqrt(Power(1 + S,3)*(3 + 2*S)*T*Power(1 + T,4)*(3 + 2*T)) + 16*sqrt((Power(1 + S,3)*(3 + 2*S)*T*Power(1 + T,4)*(3 + 2*T))/Power(1 + 2*S,2)) + 4*T*sqrt((Power(1 + S,3)*(3 + 2*S)*T*Power(1 + T,4)*(3 + 2*T))/Power(1 + 2*S,2))))))/(Power(1 + S,1.5)*sqrt(T)*Power(1 + T,4)*Power((3 + 2*S)*(3 + 2*T),2.5))) ;
+          case 88: return (sqrt(2 - 1/(1 + S))*(1 + 2*T)*(-sqrt(((1 + S)*(3 + 2*T))/((1 + 2*S)*Power(1 + 2*T,3))) + 2*T*sqrt(((1 + S)*(3 + 2*T))/((1 + 2*S)*Power(1 + 2*T,3))) - 2*sqrt(((1 + S)*(3 + 2*T))/((1 + 2*S)*(1 + 2*T))) + 2*S*(sqrt(((1 + S)*(3 + 2*T))/(Power(1 + 2*S,3)*Power(1 + 2*T,3))) - 2*T*sqrt(((1 + S)*(3 + 2*T))/(Power(1 + 2*S,3)*Power(1 + 2*T,3))) + 2*sqrt(((1 + S)*(3 + 2*T))/(Power(1 + 2*S,3)*(1 + 2*T))))))/((1 + T)*(3 + 2*T)) ;
+          case 89: return (T*(18*sqrt(((1 + S)*(3 + 2*T))/T) + 51*sqrt((1 + S)*T*(3 + 2*T)) + 53*sqrt((1 + S)*Power(T,3)*(3 + 2*T)) + 24*sqrt((1 + S)*Power(T,5)*(3 + 2*T)) + 4*sqrt((1 + S)*Power(T,7)*(3 + 2*T))))/((1 + 2*S)*Power(1 + T,2)*sqrt((1 + S)*(2 + T))*Power(3 + 2*T,2.5)) ;
+          case 90: return (81*sqrt((3 + 2*S)*T*(1 + 2*T)) + 165*sqrt((3 + 2*S)*Power(T,3)*(1 + 2*T)) + 188*sqrt((3 + 2*S)*Power(T,5)*(1 + 2*T)) + 84*sqrt((3 + 2*S)*Power(T,7)*(1 + 2*T)) + 16*sqrt((3 + 2*S)*Power(T,9)*(1 + 2*T)) + 2*S*(27*sqrt((3 + 2*S)*T*(1 + 2*T)) + 81*sqrt((3 + 2*S)*Power(T,3)*(1 + 2*T)) + 90*sqrt((3 + 2*S)*Power(T,5)*(1 + 2*T)) + 44*sqrt((3 + 2*S)*Power(T,7)*(1 + 2*T)) + 8*sqrt((3 + 2*S)*Power(T,9)*(1 + 2*T))) + 2*T*sqrt((3 + 2*S)*T*(1 + 2*T))*(39 + T*(41 + 4*T*(6 + T))))/(Power(3 + 2*S,1.5)*sqrt(T)*Power(1 + T,2)*(1 + 2*T)*Power(3 + 2*T,2.5)) ;
+          case 91: return -(sqrt(T*(2 + T))/(1 + T)) ;
+          case 92: return (-2*sqrt((S*(1 + S)*(-2 + T)*(1 + T))/((-1 + T)*T)))/(1 + 2*S) ;
+          case 93: return (2*sqrt(2)*(3 - 2*T)*sqrt((S*(1 + S))/(T*(-3 + 11*T - 12*Power(T,2) + 4*Power(T,3)))))/(1 + 2*S) ;
+          case 94: return (2*sqrt(2)*sqrt((S*(1 + S))/((-1 + T)*T)))/(1 + 2*S) ;
+          case 95: return (-2*(-3 + Power(T,2))*sqrt((S*(1 + S))/(Power(1 + 2*S,2)*(-1 + Power(T,2)))))/T ;
+          case 96: return -2*sqrt(3)*sqrt((1 + S)/((1 + 2*S)*(T + 2*Power(T,2))))*(T*(-5 + 2*T)*sqrt(S/((1 + 2*S)*T*(-3 - 2*T + 3*Power(T,2) + 2*Power(T,3)))) + 3*(sqrt(S/((1 + 2*S)*T*(-3 - 2*T + 3*Power(T,2) + 2*Power(T,3)))) + 2*sqrt((S*(-1 + T))/((1 + 2*S)*(3*T + 5*Power(T,2) + 2*Power(T,3)))))) ;
+          case 97: return (2*sqrt(3)*sqrt(((1 + S)*(1 + T))/(1 + 2*S))*((-1 + T)*(-1 + 2*T)*sqrt(S/((1 + 2*S)*(3 - 7*T + 4*Power(T,3)))) + (2*(3 - 2*T)*sqrt((S*(-1 + T))/((1 + 2*S)*(-3 + 4*T*(1 + T)))))/T - ((-3 + T)*(-1 + 2*T)*sqrt((S*(-1 + T))/((1 + 2*S)*(-3 + 4*T*(1 + T)))))/T))/(1 + T) ;
+          case 98: return (-2*sqrt(S*(1 + S))*(-3 + T + Power(T,2)))/((1 + 2*S)*T*(1 + T)) ;
+          case 99: return (-2*sqrt(3)*sqrt(((1 + S)*(1 + T))/(1 + 2*S))*(3*T*(-7*sqrt(S/((1 + 2*S)*T*(-2 + 3*T + 2*Power(T,2)))) + 6*T*sqrt(S/((1 + 2*S)*T*(-2 + 3*T + 2*Power(T,2)))) - 2*sqrt((S*T)/((1 + 2*S)*(-2 + 3*T + 2*Power(T,2))))) + 2*(6*sqrt((S*(-1 + 2*T))/((1 + 2*S)*T*(2 + T))) + 3*sqrt(S/((1 + 2*S)*T*(-2 + 3*T + 2*Power(T,2)))) + sqrt((S*T)/((1 + 2*S)*(-2 + 3*T + 2*Power(T,2)))) + 2*sqrt((S*Power(T,5))/((1 + 2*S)*(-2 + 3*T + 2*Power(T,2)))))))/Power((1 + T)*(3 + 2*T),1.5) ;
+          case 100: return 2*sqrt(3)*sqrt(((1 + S)*(1 + T))/(1 + 2*S))*(T*(-3 + (7 - 2*T)*T)*sqrt((S*(1 + 2*T))/((1 + 2*S)*T*Power(1 + T,3)*Power(3 + 2*T,2)*(-2 + 3*T + 2*Power(T,2)))) + 3*(3 - 2*T)*T*sqrt((S*(-1 + 2*T))/((1 + 2*S)*T*Power(1 + T,3)*Power(3 + 2*T,2)*(2 + 5*T + 2*Power(T,2)))) - 6*sqrt((S*Power(-1 + T,2)*(-1 + 2*T))/((1 + 2*S)*T*Power(1 + T,3)*Power(3 + 2*T,2)*(2 + 5*T + 2*Power(T,2)))) + (-1 + 2*T)*sqrt((S*T*(1 + 2*T))/((1 + 2*S)*Power(3 + 2*T,2)*(-2 + T + 5*Power(T,2) + 2*Power(T,3))))) ;
+          case 101: return -2*sqrt((1 + S)/((1 + 2*S)*Power(2 + T,3)*Power(3 + 2*T,2)*(T + Power(T,2))))*(-12*sqrt(S/(1 + 2*S + T + 2*S*T)) + T*(-2*sqrt((S*(1 + T))/(1 + 2*S)) + T*(-3*sqrt((S*(1 + T))/(1 + 2*S)) + 21*sqrt(S/(1 + 2*S + T + 2*S*T)) + 2*T*(sqrt((S*(1 + T))/(1 + 2*S)) + 6*sqrt(S/(1 + 2*S + T + 2*S*T)))))) ;
+          case 102: return (-2*sqrt(2)*sqrt(((1 + S)*(1 + T))/((1 + 2*S)*(10*T + 9*Power(T,2) + 2*Power(T,3))))*(30*sqrt((S*T)/((1 + 2*S)*(5 + 2*T))) + 47*sqrt((S*Power(T,3))/((1 + 2*S)*(5 + 2*T))) + 24*sqrt((S*Power(T,5))/((1 + 2*S)*(5 + 2*T))) + 4*sqrt((S*Power(T,7))/((1 + 2*S)*(5 + 2*T)))))/(6 + 13*T + 9*Power(T,2) + 2*Power(T,3)) ;
+          case 103: return (2*sqrt(2)*sqrt((1 + S)/((1 + 2*S)*(30 + 47*T + 24*Power(T,2) + 4*Power(T,3))))*(6*(3*sqrt((S*(1 + T))/(1 + 2*S)) + 2*sqrt(S/(1 + 2*S + T + 2*S*T))) + T*(38*sqrt((S*(1 + T))/(1 + 2*S)) + 4*T*sqrt((S*(1 + T))/(1 + 2*S)) - 9*sqrt(S/(1 + 2*S + T + 2*S*T)) - 18*T*sqrt(S/(1 + 2*S + T + 2*S*T)))))/((2 + T)*(3 + 2*T)) ;
+          case 104: return (-2*sqrt((1 + S)/((1 + 2*S)*(3 + T)*(30 + 47*T + 24*Power(T,2) + 4*Power(T,3))))*(4*(1 + 2*T)*sqrt((S*T*(1 + T)*(3 + 2*T))/((1 + 2*S)*(5 + 2*T))) + (2 + T)*(1 + 2*T)*sqrt((S*T*(1 + T)*(3 + 2*T))/((1 + 2*S)*(5 + 2*T))) + 18*(1 + 2*T)*sqrt((S*T*(1 + T))/((1 + 2*S)*(15 + 16*T + 4*Power(T,2)))) + 30*sqrt((S*T)/((1 + 2*S)*(15 + 31*T + 20*Power(T,2) + 4*Power(T,3)))) + 24*(1 + 2*T)*sqrt((S*T)/((1 + 2*S)*(15 + 31*T + 20*Power(T,2) + 4*Power(T,3))))))/(2 + T) ;
+          case 105: return sqrt((-2 + T)*(1 + T))/((1 + 2*S)*sqrt((-1 + T)*T)) ;
+          case 106: return sqrt(2)/((1 + 2*S)*sqrt(T*(T + 1/(-3 + 2*T)))) ;
+          case 107: return -(sqrt((-2 + T)*(1 + T))/sqrt((-1 + T)*T)) ;
+          case 108: return -sqrt((-6 + 4*T)/(T - 3*Power(T,2) + 2*Power(T,3))) ;
+          case 109: return -(sqrt(2)/((1 + 2*S)*sqrt((-1 + T)*T))) ;
+          case 110: return (-3 + Power(T,2))/((T + 2*S*T)*sqrt(-1 + Power(T,2))) ;
+          case 111: return (sqrt(3)*(T*sqrt(((1 + S)*(1 + T))/(-1 + T))*(-5 + 2*T) + 3*(sqrt(((1 + S)*(1 + T))/(-1 + T)) + 2*sqrt((1 + S)*(-1 + Power(T,2))))))/((1 + 2*S)*T*(1 + T)*sqrt((1 + S)*(3 + 4*T*(2 + T)))) ;
+          case 112: return (sqrt(2)*sqrt(((1 + S)*(1 + 2*S)*(-1 + T + 2*Power(T,2)))/T)*(-2*(1 + T)*sqrt((1 + S)/((1 + 2*S)*(-1 + 2*T)*(-1 + Power(T,2)))) + 2*T*(1 + T)*sqrt((1 + S)/((1 + 2*S)*(-1 + 2*T)*(-1 + Power(T,2)))) - 2*(-2 + T)*sqrt(((1 + S)*(1 + T))/((1 + 2*S)*(1 - 3*T + 2*Power(T,2)))) - (-2 + T)*sqrt(((1 + S)*(1 + 2*S)*(1 + T))/(1 - 3*T + 2*Power(T,2))) - (1 + T)*sqrt(((1 + S)*(1 + 2*S))/(1 - 2*T - Power(T,2) + 2*Power(T,3))) + T*(1 + T)*sqrt(((1 + S)*(1 + 2*S))/(1 - 2*T - Power(T,2) + 2*Power(T,3)))))/((1 + S)*(3 + 2*S)*(1 + T)) ;
+          case 113: return -((sqrt((1 + 2*S)/((1 + S)*(-T + Power(T,3))))*(-3*sqrt(((1 + S)*(1 + 2*S))/T) - 6*sqrt(((1 + S)*T)/(1 + 2*S)) - 3*sqrt((1 + S)*(1 + 2*S)*T) + 2*sqrt(((1 + S)*Power(T,3))/(1 + 2*S)) + sqrt((1 + S)*(1 + 2*S)*Power(T,3)) + 2*sqrt(((1 + S)*Power(T,5))/(1 + 2*S)) + sqrt((1 + S)*(1 + 2*S)*Power(T,5)) - 6*sqrt((1 + S)/(T + 2*S*T))))/((3 + 2*S)*(1 + T))) ;
+          case 114: return sqrt((3 + 6*S)/((1 + S)*Power(3 + 2*S,2)*Power(T,2)*Power(1 + T,2)*(3 + 4*T*(2 + T))))*(-(T*(-5 + 2*T)*(2*sqrt(((1 + S)*(1 + T))/((1 + 2*S)*(-1 + T))) + sqrt(((1 + S)*(1 + 2*S)*(1 + T))/(-1 + T)))) - 3*(2*sqrt(((1 + S)*(1 + T))/((1 + 2*S)*(-1 + T))) + sqrt(((1 + S)*(1 + 2*S)*(1 + T))/(-1 + T)) + 4*sqrt(((1 + S)*(-1 + Power(T,2)))/(1 + 2*S)) + 2*sqrt((1 + S)*(1 + 2*S)*(-1 + Power(T,2))))) ;
+          case 115: return -((sqrt(3)*(-3 + T + 2*Power(T,2)))/((T + 2*S*T)*sqrt((1 + T)*(3 - 7*T + 4*Power(T,3))))) ;
+          case 116: return (-3 + T + Power(T,2))/((1 + T)*(T + 2*S*T)) ;
+          case 117: return (sqrt(3)*(T*(-19 + 4*T*(3 + T))*sqrt(9 + T*(5 + T) + 15/(-1 + 2*T)) + 6*(2*sqrt((1 + T)*(2 + T)*(-1 + 2*T)*(3 + 2*T)) + sqrt(9 + T*(5 + T) + 15/(-1 + 2*T)))))/((1 + 2*S)*sqrt(T)*Power(1 + T,1.5)*(2 + T)*Power(3 + 2*T,2)) ;
+          case 118: return (sqrt(3)*(-3 + T + 2*Power(T,2)))/(T*sqrt((-1 + T)*(1 + T)*(-1 + 2*T)*(3 + 2*T))) ;
+          case 119: return -1 + 3/T - 3/(1 + T) ;
+          case 120: return -(1/((1 + T)*sqrt((T*(3 + 2*T))/(-6 + 9*T + 6*Power(T,2))))) ;
+          case 121: return sqrt(3)*sqrt((1 + S)*(1 + T))*((2*(2 + 9*S)*T)/((1 + 2*S)*(1 + T)*sqrt((1 + S)*T*(1 + T)*(2 + T)*(-1 + 2*T)*(1 + 2*T))*(3 + 2*T)) + (6*(-1 + 2*S)*Power(T,2))/((1 + 2*S)*(1 + T)*sqrt((1 + S)*T*(1 + T)*(2 + T)*(-1 + 2*T)*(1 + 2*T))*(3 + 2*T)) + (2*Power(T,2)*(-(sqrt((T*(1 + T)*(2 + T)*(-1 + 2*T)*(1 + 2*T))/(1 + S))/((2 + T)*(1 + 2*T))) - (4*(1 + S)*T*(1 + T))/((1 + 2*S)*sqrt((1 + S)*T*(1 + T)*(2 + T)*(-1 + 2*T)*(1 + 2*T))) + ((1 + T)*sqrt(((1 + S)*T*(1 + 2*T))/(-2 + T + 5*Power(T,2) + 2*Power(T,3))))/(1 + S)))/(Power(1 + T,2)*(3 + 2*T)) + 3*((-4*S)/((1 + 2*S)*(1 + T)*sqrt((1 + S)*T*(1 + T)*(2 + T)*(-1 + 2*T)*(1 + 2*T))*(3 + 2*T)) + 2*sqrt((Power(-1 + T,2)*(-1 + 2*T))/((1 + S)*T*Power(1 + T,3)*Power(3 + 2*T,2)*(2 + 5*T + 2*Power(T,2)))) - (3*sqrt((T*(-1 + 2*T))/((1 + S)*(2 + 7*T + 7*Power(T,2) + 2*Power(T,3)))))/(3 + 5*T + 2*Power(T,2)))) ;
+          case 122: return (-2 + T*(2 + T))/((1 + 2*S)*(1 + T)*sqrt(T*(2 + T))) ;
+          case 123: return sqrt(2)/((1 + 2*S)*sqrt((1 + T)*(2 + T))) ;
+          case 124: return -(sqrt(3)*sqrt(((1 + S)*(1 + T))/(3 + 2*S))*(-(((1 + 2*S)*T*(-1 + 2*T))/(sqrt(((1 + S)*(3 + 2*S)*T*(1 + T)*(2 + T)*(-1 + 2*T))/(1 + 2*T))*(3 + 2*T))) + (2*(1 - 2*T)*T)/sqrt(((1 + S)*(3 + 2*S)*T*(1 + T)*(2 + T)*(-1 + 2*T)*Power(3 + 2*T,2))/(1 + 2*T)) + (6*(1 + 2*S)*(-1 + T))/((1 + T)*sqrt(((1 + S)*(3 + 2*S)*T*(1 + T)*(2 + T)*(1 + 2*T)*Power(3 + 2*T,2))/(-1 + 2*T))) + 2*(-3 + T)*T*(-1 + 2*T)*sqrt((1 + 2*T)/((3 + 5*S + 2*Power(S,2))*T*Power(1 + T,3)*Power(3 + 2*T,2)*(-2 + 3*T + 2*Power(T,2)))) + (-3 + T)*T*(-1 + 2*T)*sqrt((Power(1 + 2*S,2)*(1 + 2*T))/((3 + 5*S + 2*Power(S,2))*T*Power(1 + T,3)*Power(3 + 2*T,2)*(-2 + 3*T + 2*Power(T,2)))) + 3*T*(-3 + 2*T)*sqrt((Power(1 + 2*S,2)*(-1 + 2*T))/((3 + 5*S + 2*Power(S,2))*T*Power(1 + T,3)*Power(3 + 2*T,2)*(2 + 5*T + 2*Power(T,2)))) + 12*sqrt((Power(-1 + T,2)*(-1 + 2*T))/((3 + 5*S + 2*Power(S,2))*T*Power(1 + T,3)*Power(3 + 2*T,2)*(2 + 5*T + 2*Power(T,2)))) + (6*(-3 + 2*T)*sqrt((T*(-1 + 2*T))/((3 + 5*S + 2*Power(S,2))*(2 + 7*T + 7*Power(T,2) + 2*Power(T,3)))))/(3 + 5*T + 2*Power(T,2)))) ;
+          case 125: return (2 - T*(2 + T))/((1 + T)*sqrt(T*(2 + T))) ;
+          case 126: return -((sqrt(2)*(30*sqrt(T*(1 + T)*(3 + 2*T)) + 47*T*sqrt(T*(1 + T)*(3 + 2*T)) + 24*sqrt(Power(T,5)*(1 + T)*(3 + 2*T)) + 4*sqrt(Power(T,7)*(1 + T)*(3 + 2*T))))/(sqrt(T)*(1 + T)*Power((2 + T)*(3 + 2*T),1.5)*(5 + 2*T))) ;
+          case 127: return (sqrt((2 + 4*T)/((1 + S)*Power(1 + 2*S,2)*T*Power(1 + T,2)*Power(6 + 7*T + 2*Power(T,2),3)))*(-(T*sqrt((1 + S)*T*(1 + T)*(1 + 2*T)*(5 + 2*T))*(11 + 2*T)) + 6*(sqrt(((1 + S)*Power(1 - 2*T,2)*T*(1 + T)*(5 + 2*T))/(1 + 2*T)) - 4*sqrt((1 + S)*T*(1 + T)*(1 + 2*T)*(5 + 2*T)))))/(5 + 2*T) ;
+          case 128: return (sqrt((1 + 2*T)/((1 + 3*S + 2*Power(S,2))*Power(6 + 7*T + 2*Power(T,2),2)*(15 + 26*T + 13*Power(T,2) + 2*Power(T,3))))*(3*(10*sqrt(((1 + S)*(1 + 2*S)*T*(5 + 2*T))/((2 + T)*(1 + 2*T))) + 18*sqrt(((1 + S)*(1 + 2*S)*T*(1 + 2*T)*(5 + 2*T))/(2 + T)) + sqrt((1 + S)*(1 + 2*S)*T*(2 + T)*(1 + 2*T)*(5 + 2*T))) + T*(38*sqrt(((1 + S)*(1 + 2*S)*T*(1 + 2*T)*(5 + 2*T))/(2 + T)) + 5*sqrt((1 + S)*(1 + 2*S)*T*(2 + T)*(1 + 2*T)*(5 + 2*T)) + 2*T*(4*sqrt(((1 + S)*(1 + 2*S)*T*(1 + 2*T)*(5 + 2*T))/(2 + T)) + sqrt((1 + S)*(1 + 2*S)*T*(2 + T)*(1 + 2*T)*(5 + 2*T)))) - 2*S*(3*(18*sqrt(((1 + S)*T*(1 + 2*T)*(5 + 2*T))/((1 + 2*S)*(2 + T))) + sqrt(((1 + S)*T*(2 + T)*(1 + 2*T)*(5 + 2*T))/(1 + 2*S)) + 10*sqrt(((1 + S)*T*(5 + 2*T))/((1 + 2*S)*(2 + 5*T + 2*Power(T,2))))) + T*(38*sqrt(((1 + S)*T*(1 + 2*T)*(5 + 2*T))/((1 + 2*S)*(2 + T))) + 5*sqrt(((1 + S)*T*(2 + T)*(1 + 2*T)*(5 + 2*T))/(1 + 2*S)) + 2*T*(4*sqrt(((1 + S)*T*(1 + 2*T)*(5 + 2*T))/((1 + 2*S)*(2 + T))) + sqrt(((1 + S)*T*(2 + T)*(1 + 2*T)*(5 + 2*T))/(1 + 2*S)))))))/(5 + 2*T) ;
+          case 129: return -(((3 + 2*S)*sqrt((2 + 4*T)/((1 + S)*Power(3 + 2*S,3)*T*Power(1 + T,2)*Power(2 + T,4)*Power(3 + 2*T,3)))*(-6*(sqrt(((1 + S)*(3 + 2*S)*T*(1 + T)*(2 + T)*(5 + 2*T))/(1 + 2*T)) + 4*sqrt((1 + S)*(3 + 2*S)*T*(1 + T)*(2 + T)*(1 + 2*T)*(5 + 2*T))) + T*(12*sqrt(((1 + S)*(3 + 2*S)*T*(1 + T)*(2 + T)*(5 + 2*T))/(1 + 2*T)) - 11*sqrt((1 + S)*(3 + 2*S)*T*(1 + T)*(2 + T)*(1 + 2*T)*(5 + 2*T)) - 2*T*sqrt((1 + S)*(3 + 2*S)*T*(1 + T)*(2 + T)*(1 + 2*T)*(5 + 2*T)))))/(5 + 2*T)) ;
+          case 130: return (-6*(15*sqrt((T*(1 + T)*(2 + T)*(3 + 2*T))/(3 + T)) + 17*sqrt((Power(T,5)*(1 + T)*(2 + T)*(3 + 2*T))/(3 + T))) - T*(171*sqrt((T*(1 + T)*(2 + T)*(3 + 2*T))/(3 + T)) + T*sqrt((T*(1 + T)*(2 + T)*Power(1 + 2*T,2)*(3 + 2*T))/(3 + T))*(17 + 2*T)))/((1 + T)*Power(2 + T,2)*Power(3 + 2*T,1.5)*(5 + 2*T)) ;
+          case 131: return -2*sqrt((-1 + Power(S,2))/(-1 + 4*Power(S,2))) ;
+          case 132: return sqrt(3)/sqrt(-1 + 4*Power(S,2)) ;
+          case 133: return -(sqrt(-3 + 4*S*(1 + S))/(1 + 2*S)) ;
+          case 134: return 2/(1 + 2*S) ;
+          case 135: return (-2*sqrt((S*(2 + S)*(3 + 2*S))/(1 + 2*S)))/(3 + 2*S) ;
+          case 136: return sqrt(3 + 6/(1 + 2*S))/(3 + 2*S) ;
+          case 137: return -1 ;
+          case 138: return 1 ;
+          case 139: return sqrt(1 - 2/(-1 + T) + 2/T) ;
+          case 140: return sqrt((-6 + 4*T)/(T - 3*Power(T,2) + 2*Power(T,3))) ;
+          case 141: return -(sqrt(2)/sqrt((-1 + T)*T)) ;
+          case 142: return (-3 + Power(T,2))/sqrt(Power(T,2)*(-1 + Power(T,2))) ;
+          case 143: return (sqrt(3)*(-3 + T + 2*Power(T,2)))/(T*sqrt((-1 + T)*(1 + T)*(1 + 2*T)*(3 + 2*T))) ;
+          case 144: return -((sqrt(3)*(-3 + T + 2*Power(T,2)))/(T*sqrt((1 + T)*(3 - 7*T + 4*Power(T,3))))) ;
+          case 145: return 1 - 3/T + 3/(1 + T) ;
+          case 146: return 1/((1 + T)*sqrt((T*(3 + 2*T))/(-6 + 9*T + 6*Power(T,2)))) ;
+          case 147: return sqrt(3)*sqrt(1 + T)*((-3 + T)*T*(-1 + 2*T)*sqrt((1 + 2*T)/(T*Power(1 + T,3)*Power(3 + 2*T,2)*(-2 + 3*T + 2*Power(T,2)))) + 6*sqrt((Power(-1 + T,2)*(-1 + 2*T))/(T*Power(1 + T,3)*Power(3 + 2*T,2)*(2 + 5*T + 2*Power(T,2)))) + (1 - 2*T)*sqrt((T*(1 + 2*T))/(Power(3 + 2*T,2)*(-2 + T + 5*Power(T,2) + 2*Power(T,3)))) + (3*(-3 + 2*T)*sqrt((T*(-1 + 2*T))/(2 + 7*T + 7*Power(T,2) + 2*Power(T,3))))/(3 + 5*T + 2*Power(T,2))) ;
+          case 148: return (-2 + T*(2 + T))/((1 + T)*sqrt(T*(2 + T))) ;
+          case 149: return (sqrt(2 + 2/T)*(45*T*sqrt(T*(1 + T)*(2 + T)*(3 + 2*T)) + 2*(15*sqrt(T*(1 + T)*(2 + T)*(3 + 2*T)) + 9*sqrt(Power(T,5)*(1 + T)*(2 + T)*(3 + 2*T)) + sqrt(Power(T,3)*Power(1 + T,3)*(2 + T)*Power(1 + 2*T,2)*(3 + 2*T)))))/(Power(2 + T,2)*Power((1 + T)*(3 + 2*T),1.5)*(5 + 2*T)) ;
+          case 150: return -((sqrt(2)*(30*sqrt(T*(1 + T)*(2 + T)*(3 + 2*T)) + 47*sqrt(Power(T,3)*(1 + T)*(2 + T)*(3 + 2*T)) + 24*sqrt(Power(T,5)*(1 + T)*(2 + T)*(3 + 2*T)) + 4*sqrt(Power(T,7)*(1 + T)*(2 + T)*(3 + 2*T))))/((1 + T)*Power(2 + T,2)*Power(3 + 2*T,2)*sqrt(T*(5 + 2*T)))) ;
+          case 151: return ((3 + T)*sqrt((T*(1 + T))/(6 + 5*T + Power(T,2))))/(1 + T) ;
+          case 152: return (-1 + 2*S)*sqrt(((1 + S)*(-1 + Power(T,2)))/((-S + 4*Power(S,3))*Power(T,2))) ;
+          case 153: return (-1 + 2*S)*(-1 + 2*T)*sqrt((1 + S)/((-S + 4*Power(S,3))*Power(T,2)*(-1 + 4*Power(T,2)))) ;
+          case 154: return ((1 - 2*S)*sqrt(-((1 + S)/(S - 4*Power(S,3)))))/T ;
+          case 155: return (-1 + 2*S)*(-1 + T + Power(T,2))*sqrt((1 + S)/(S*(-1 + 4*Power(S,2))*Power(T + Power(T,2),2))) ;
+          case 156: return 1/(sqrt((S*(1 + 2*S))/(-1 + S + 2*Power(S,2)))*(1 + T)) ;
+          case 157: return -((-1 + 2*S)*(3 + 2*T)*sqrt((1 + S)/(S*(-1 + 4*Power(S,2))*Power(1 + T,2)*(3 + 4*T*(2 + T))))) ;
+          case 158: return sqrt(((-1 + S + 2*Power(S,2))*T*(2 + T))/(S*(1 + 2*S)))/(1 + T) ;
+          case 159: return -(1/sqrt((S*(1 + 2*S)*Power(T,2))/(-1 + Power(T,2)))) ;
+          case 160: return (1 - 2*T)/(T*sqrt(S*(1 + 2*S)*(-1 + 4*Power(T,2)))) ;
+          case 161: return (3 + 2*S)*sqrt((S*(-1 + Power(T,2)))/((3 + 11*S + 12*Power(S,2) + 4*Power(S,3))*Power(T,2))) ;
+          case 162: return (3 + 2*S)*sqrt((S*(-1 + 2*T))/((3 + 11*S + 12*Power(S,2) + 4*Power(S,3))*Power(T,2)*(1 + 2*T))) ;
+          case 163: return (-((-1 + T)*T*sqrt(S*(1 + S)*T*(1 + T))) + sqrt(Power(S,3)*(1 + S)*Power(T,3)*(1 + T)) + sqrt(S*(1 + S)*Power(T,5)*(1 + T)))/(S*Power(1 + S,1.5)*Power(T,2.5)*sqrt((1 + 2*S)*(1 + T))) ;
+          case 164: return (1 - T*(1 + T))/(sqrt(S*(1 + 2*S))*T*(1 + T)) ;
+          case 165: return -(1/(sqrt(S*(1 + 2*S))*(1 + T))) ;
+          case 166: return (-3*S*(1 + S)*sqrt(S*(1 + S)*(1 + T)) + T*(-(Power(S,2)*sqrt(S*(1 + S)*(1 + T))) + sqrt(Power(S,5)*(1 + S)*(1 + T))) - 2*(sqrt(Power(S,5)*(1 + S)*(1 + T)) + sqrt(Power(S,7)*(1 + S)*(1 + T))))/(S*Power(1 + S,2)*T*sqrt((3 + 4*S*(2 + S))*(1 + T))) ;
+          case 167: return ((3*sqrt(S*(1 + S)) + 2*sqrt(Power(S,3)*(1 + S)))*(-1 + T + Power(T,2)))/((1 + S)*sqrt(3 + 4*S*(2 + S))*T*(1 + T)) ;
+          case 168: return (3 + 2*S)/(sqrt(((1 + S)*(1 + 2*S)*(3 + 2*S))/S)*(1 + T)) ;
+          case 169: return (2*sqrt(((1 + 2*S)*T*(1 + 2*T))/S) - 2*sqrt(((1 + 2*S)*Power(T,3))/(S + 2*S*T)) + sqrt((T + 2*S*T)/(S + 2*S*T)))/((1 + 2*S)*(1 + T)*sqrt(T*(3 + 2*T))) ;
+          case 170: return -(sqrt((T*(2 + T))/(S*(1 + 2*S)))/(1 + T)) ;
+          case 171: return (-3*sqrt((S*(3 + 4*S*(2 + S))*T)/(1 + 2*T)) - 4*S*sqrt((S*(3 + 4*S*(2 + S))*T)/(1 + 2*T)) + 6*sqrt((S*(3 + 4*S*(2 + S))*Power(T,3))/(1 + 2*T)) - 6*sqrt(S*(3 + 4*S*(2 + S))*T*(1 + 2*T)) - 2*sqrt(Power(S,3)*(3 + 4*S*(2 + S))*T*(1 + 2*T)))/((3 + 4*S*(2 + S))*(1 + T)*sqrt((1 + S)*T*(3 + 2*T))) ;
+          case 172: return (34*sqrt((S*(1 + S)*T*(2 + T))/(1 + T)) + 12*S*sqrt((S*(1 + S)*T*(2 + T))/(1 + T)) + 83*sqrt((S*(1 + S)*Power(T,3)*(2 + T))/(1 + T)) + 18*sqrt((Power(S,3)*(1 + S)*Power(T,3)*(2 + T))/(1 + T)) + 65*sqrt((S*(1 + S)*Power(T,5)*(2 + T))/(1 + T)) + 6*sqrt((Power(S,3)*(1 + S)*Power(T,5)*(2 + T))/(1 + T)) + 16*sqrt((S*(1 + S)*Power(T,7)*(2 + T))/(1 + T)) + 2*sqrt(S*(1 + S)*T*(1 + T)*(2 + T)) + 12*sqrt(Power(S,3)*(1 + S)*T*(1 + T)*(2 + T)) + 34*sqrt(Power(S,3)*(1 + S)*Power(T,3)*(1 + T)*(2 + T)) + 22*sqrt(Power(S,3)*(1 + S)*Power(T,5)*(1 + T)*(2 + T)) + 4*sqrt(Power(S,3)*(1 + S)*Power(T,7)*(1 + T)*(2 + T)) + T*(1 + T)*sqrt(S*(1 + S)*T*(1 + T)*(2 + T))*(11 + 6*T))/((1 + S)*sqrt(3 + 4*S*(2 + S))*Power(1 + T,1.5)*Power(2 + T,2)*(3 + 2*T)) ;
+          case 173: return (2*S*(sqrt(((1 + 2*S)*(-1 + T))/((3 + 5*S + 2*Power(S,2))*T)) + 2*sqrt((-1 + T)/((3 + 11*S + 12*Power(S,2) + 4*Power(S,3))*T))) - 2*sqrt(((1 + S)*(1 + 2*S)*(-1 + T))/((3 + 2*S)*T)) - sqrt(((1 + 2*S)*(-1 + T))/((3 + 5*S + 2*Power(S,2))*T)))*sqrt((1 + T)/(3*T + 2*S*T)) ;
+          case 174: return sqrt((1 + T)/((3 + 2*S)*(T + 2*Power(T,2))))*(-2*sqrt(((1 + S)*(1 + 2*S)*(-1 + 2*T))/((3 + 2*S)*T*(1 + T))) - sqrt(((1 + 2*S)*(-1 + 2*T))/((3 + 5*S + 2*Power(S,2))*T*(1 + T))) + 2*S*(sqrt(((1 + 2*S)*(-1 + 2*T))/((3 + 5*S + 2*Power(S,2))*T*(1 + T))) + 2*sqrt((-1 + 2*T)/((3 + 11*S + 12*Power(S,2) + 4*Power(S,3))*T*(1 + T))))) ;
+          case 175: return sqrt(-1 + Power(T,2))/T ;
+          case 176: return sqrt(1 - 2/(1 + 2*T))/T ;
+          case 177: return 1/(sqrt((1 + S)*(1 + 2*S))*T) ;
+          case 178: return (1 - T*(1 + T))/(sqrt((1 + S)*(1 + 2*S))*T*(1 + T)) ;
+          case 179: return -(1/(sqrt((1 + S)*(1 + 2*S))*(1 + T))) ;
+          case 180: return -(1/T) ;
+          case 181: return 1 - 1/T + 1/(1 + T) ;
+          case 182: return 1/(1 + T) ;
+          case 183: return (3 + 2*T)/((1 + T)*sqrt((1 + S)*(1 + 2*S)*(3 + 4*T*(2 + T)))) ;
+          case 184: return (-9*(2*sqrt(((3 + 4*S*(2 + S))*T*(1 + T)*(3 + 2*T))/(2 + T)) + sqrt((3 + 4*S*(2 + S))*T*(1 + T)*(2 + T)*(3 + 2*T))) - 3*T*(3*sqrt(((3 + 4*S*(2 + S))*T*(1 + T)*(3 + 2*T))/(2 + T)) + 7*sqrt((3 + 4*S*(2 + S))*T*(1 + T)*(2 + T)*(3 + 2*T)) + 2*T*sqrt((3 + 4*S*(2 + S))*T*(1 + T)*(2 + T)*(3 + 2*T))) + 2*S*(-6*sqrt(((3 + 4*S*(2 + S))*T*(1 + T)*(3 + 2*T))/(2 + T)) + 6*sqrt(((3 + 4*S*(2 + S))*Power(T,3)*(1 + T)*(3 + 2*T))/(2 + T)) - 3*sqrt((3 + 4*S*(2 + S))*T*(1 + T)*(2 + T)*(3 + 2*T)) - T*(9*sqrt(((3 + 4*S*(2 + S))*T*(1 + T)*(3 + 2*T))/(2 + T)) + 7*sqrt((3 + 4*S*(2 + S))*T*(1 + T)*(2 + T)*(3 + 2*T)) + 2*T*sqrt((3 + 4*S*(2 + S))*T*(1 + T)*(2 + T)*(3 + 2*T)))))/((2 + T)*sqrt((1 + S)*Power(1 + 2*S,2)*Power(3 + 2*S,3)*Power(1 + T,3)*Power(3 + 2*T,3))) ;
+          case 185: return (-2*sqrt(((2 + S)*(1 + 2*S))/(1 + T)) - sqrt((2 + S)*(1 + 2*S)*(1 + T)) + T*(sqrt(((2 + S)*(1 + 2*S))/(1 + T)) + 2*T*sqrt(((2 + S)*(1 + 2*S))/(1 + T)) - 2*sqrt((2 + S)*(1 + 2*S)*(1 + T))))/sqrt((2 + S)*(1 + 2*S)*(1 + T)*(1 + 2*T)*(3 + 2*T)) ;
+          case 186: return sqrt((1 + 2*T)/(Power(2 + S,6)*Power(1 + 2*S,2)*(3 + 2*S)*Power(1 + T,2)*Power(2 + T,4)*(3 + 2*T)))*(6*sqrt((Power(2 + S,4)*Power(1 + 2*S,2)*T*Power(2 + T,3)*(1 + 2*T))/((3 + 2*S)*(3 + 2*T))) + 4*sqrt((Power(2 + S,4)*Power(1 + 2*S,4)*T*Power(2 + T,3)*(1 + 2*T))/((3 + 2*S)*(3 + 2*T))) + 2*sqrt((Power(1 + S,2)*Power(2 + S,4)*Power(1 + 2*S,4)*T*Power(2 + T,3)*(1 + 2*T))/((3 + 2*S)*(3 + 2*T))) + 2*sqrt((Power(2 + S,4)*Power(1 + 2*S,4)*T*Power(1 + T,2)*Power(2 + T,3)*(1 + 2*T))/((3 + 2*S)*(3 + 2*T))) + sqrt((Power(1 + S,2)*Power(2 + S,4)*Power(1 + 2*S,4)*T*Power(1 + T,2)*Power(2 + T,3)*(1 + 2*T))/((3 + 2*S)*(3 + 2*T))) + 3*Power(2 + S,2.5)*(1 + 2*S)*Power((1 + T)*(2 + T),1.5)*sqrt((T*(1 + 2*T))/((6 + 7*S + 2*Power(S,2))*(3 + 5*T + 2*Power(T,2)))) + 9*Power(2 + S,2.5)*(1 + 2*S)*Power(2 + T,2)*sqrt(T/((6 + 7*S + 2*Power(S,2))*(6 + 19*T + 16*Power(T,2) + 4*Power(T,3)))) + 6*Power(2 + S,2.5)*Power(1 + 2*S,2)*Power(2 + T,2)*sqrt(T/((6 + 7*S + 2*Power(S,2))*(6 + 19*T + 16*Power(T,2) + 4*Power(T,3)))) + 3*sqrt((Power(1 + S,2)*Power(2 + S,4)*Power(1 + 2*S,4)*T*Power(2 + T,3))/((3 + 2*S)*(3 + 4*T*(2 + T))))) ;
+          case 187: return (-2*sqrt(S*(1 + S)*(-1 + Power(T,2))))/(T + 2*S*T) ;
+          case 188: return (-2*sqrt((S*(1 + S)*(-1 + 2*T))/(1 + 2*T)))/(T + 2*S*T) ;
+          case 189: return (2*sqrt(S*(1 + S)))/(T + 2*S*T) ;
+          case 190: return (-2*sqrt(S*(1 + S))*(-1 + T + Power(T,2)))/((1 + 2*S)*T*(1 + T)) ;
+          case 191: return (-2*sqrt(S*(1 + S)))/(1 + 2*S + T + 2*S*T) ;
+          case 192: return (2*(1 + S)*(2*sqrt((S + 2*S*T)/(1 + 2*S)) + sqrt(S/(1 + 2*S + 2*T + 4*S*T)) - 2*T*sqrt(S/(1 + 2*S + 2*T + 4*S*T))))/((1 + T)*sqrt((1 + S)*(1 + 2*S)*(3 + 2*T))) ;
+          case 193: return (-2*sqrt((1 + S)/((1 + 2*S)*(6 + 7*T + 2*Power(T,2))))*(6*sqrt((S*T)/(3 + 6*S + 2*T + 4*S*T)) + 7*sqrt((S*Power(T,3))/(3 + 6*S + 2*T + 4*S*T)) + 2*sqrt((S*Power(T,5))/(3 + 6*S + 2*T + 4*S*T))))/(1 + T) ;
+          case 194: return sqrt(-1 + Power(T,2))/(T + 2*S*T) ;
+          case 195: return sqrt(1 - 2/(1 + 2*T))/(T + 2*S*T) ;
+          case 196: return -sqrt(1 - Power(T,-2)) ;
+          case 197: return -(sqrt(1 - 2/(1 + 2*T))/T) ;
+          case 198: return -(1/(T + 2*S*T)) ;
+          case 199: return (-1 + T + Power(T,2))/((1 + 2*S)*(T + Power(T,2))) ;
+          case 200: return 1/(1 + 2*S + T + 2*S*T) ;
+          case 201: return 1/T ;
+          case 202: return -1 + 1/T - 1/(1 + T) ;
+          case 203: return -(((1 + 2*S)*(27*(sqrt(Power(1 + S,3)*(3 + 2*S)*T*Power(1 + T,4)*(3 + 2*T)) + 2*sqrt((Power(1 + S,3)*(3 + 2*S)*T*Power(1 + T,4)*(3 + 2*T))/Power(1 + 2*S,2))) + 2*S*(1 + T)*(3 + 2*T)*(3*sqrt(Power(1 + S,3)*(3 + 2*S)*T*Power(1 + T,4)*(3 + 2*T)) + 6*sqrt((Power(1 + S,3)*(3 + 2*S)*T*Power(1 + T,4)*(3 + 2*T))/Power(1 + 2*S,2)) + 4*T*sqrt((Power(1 + S,3)*(3 + 2*S)*T*Power(1 + T,4)*(3 + 2*T))/Power(1 + 2*S,2))) + T*(45*sqrt(Power(1 + S,3)*(3 + 2*S)*T*Power(1 + T,4)*(3 + 2*T)) + 126*sqrt((Power(1 + S,3)*(3 + 2*S)*T*Power(1 + T,4)*(3 + 2*T))/Power(1 + 2*S,2)) + 2*sqrt(Power(1 + S,3)*Power(3 + 2*S,3)*T*Power(1 + T,6)*Power(3 + 2*T,3)) + 6*T*(3*sqrt(Power(1 + S,3)*(3 + 2*S)*T*Power(1 + T,4)*(3 + 2*T)) + 16*sqrt((Power(1 + S,3)*(3 + 2*S)*T*Power(1 + T,4)*(3 + 2*T))/Power(1 + 2*S,2)) + 4*T*sqrt((Power(1 + S,3)*(3 + 2*S)*T*Power(1 + T,4)*(3 + 2*T))/Power(1 + 2*S,2))))))/(Power(1 + S,1.5)*sqrt(T)*Power(1 + T,4)*Power((3 + 2*S)*(3 + 2*T),2.5))) ;
+          case 204: return (sqrt(2 - 1/(1 + S))*(1 + 2*T)*(-sqrt(((1 + S)*(3 + 2*T))/((1 + 2*S)*Power(1 + 2*T,3))) + 2*T*sqrt(((1 + S)*(3 + 2*T))/((1 + 2*S)*Power(1 + 2*T,3))) - 2*sqrt(((1 + S)*(3 + 2*T))/((1 + 2*S)*(1 + 2*T))) + 2*S*(sqrt(((1 + S)*(3 + 2*T))/(Power(1 + 2*S,3)*Power(1 + 2*T,3))) - 2*T*sqrt(((1 + S)*(3 + 2*T))/(Power(1 + 2*S,3)*Power(1 + 2*T,3))) + 2*sqrt(((1 + S)*(3 + 2*T))/(Power(1 + 2*S,3)*(1 + 2*T))))))/((1 + T)*(3 + 2*T)) ;
+          case 205: return (T*(18*sqrt(((1 + S)*(3 + 2*T))/T) + 51*sqrt((1 + S)*T*(3 + 2*T)) + 53*sqrt((1 + S)*Power(T,3)*(3 + 2*T)) + 24*sqrt((1 + S)*Power(T,5)*(3 + 2*T)) + 4*sqrt((1 + S)*Power(T,7)*(3 + 2*T))))/((1 + 2*S)*Power(1 + T,2)*sqrt((1 + S)*(2 + T))*Power(3 + 2*T,2.5)) ;
+          case 206: return (81*sqrt((3 + 2*S)*T*(1 + 2*T)) + 165*sqrt((3 + 2*S)*Power(T,3)*(1 + 2*T)) + 188*sqrt((3 + 2*S)*Power(T,5)*(1 + 2*T)) + 84*sqrt((3 + 2*S)*Power(T,7)*(1 + 2*T)) + 16*sqrt((3 + 2*S)*Power(T,9)*(1 + 2*T)) + 2*S*(27*sqrt((3 + 2*S)*T*(1 + 2*T)) + 81*sqrt((3 + 2*S)*Power(T,3)*(1 + 2*T)) + 90*sqrt((3 + 2*S)*Power(T,5)*(1 + 2*T)) + 44*sqrt((3 + 2*S)*Power(T,7)*(1 + 2*T)) + 8*sqrt((3 + 2*S)*Power(T,9)*(1 + 2*T))) + 2*T*sqrt((3 + 2*S)*T*(1 + 2*T))*(39 + T*(41 + 4*T*(6 + T))))/(Power(3 + 2*S,1.5)*sqrt(T)*Power(1 + T,2)*(1 + 2*T)*Power(3 + 2*T,2.5)) ;
+          case 207: return -(sqrt(T*(2 + T))/(1 + T)) ;
+          case 208: return 1 ;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(1, 2, 1));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(1, 2, 1));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -96,10 +1267,432 @@ MatrixElements<SC> SymmetryQST<SC>::recalc_doublet(const DiagInfo<SC> &diag, con
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "qst/qst-doubletm0.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {2, 3},
+        {2, 5},
+        {2, 6},
+        {3, 2},
+        {3, 3},
+        {3, 4},
+        {3, 5},
+        {3, 6},
+        {3, 7},
+        {4, 3},
+        {4, 4},
+        {4, 6},
+        {4, 7},
+        {5, 5},
+        {5, 6},
+        {6, 5},
+        {6, 6},
+        {6, 7},
+        {7, 6},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {9, 10},
+        {10, 9},
+        {10, 10},
+        {10, 11},
+        {11, 10},
+        {11, 11},
+        {11, 12},
+        {12, 11},
+        {12, 12},
+        {12, 13},
+        {13, 12},
+        {13, 13},
+        {14, 14},
+        {14, 15},
+        {14, 17},
+        {14, 18},
+        {15, 14},
+        {15, 15},
+        {15, 16},
+        {15, 17},
+        {15, 18},
+        {15, 19},
+        {16, 15},
+        {16, 16},
+        {16, 18},
+        {16, 19},
+        {17, 17},
+        {17, 18},
+        {17, 20},
+        {17, 21},
+        {18, 17},
+        {18, 18},
+        {18, 19},
+        {18, 20},
+        {18, 21},
+        {18, 22},
+        {19, 18},
+        {19, 19},
+        {19, 21},
+        {19, 22},
+        {20, 20},
+        {20, 21},
+        {21, 20},
+        {21, 21},
+        {21, 22},
+        {22, 21},
+        {22, 22},
+        {23, 23},
+        {23, 24},
+        {23, 26},
+        {23, 27},
+        {24, 23},
+        {24, 24},
+        {24, 25},
+        {24, 26},
+        {24, 27},
+        {24, 28},
+        {25, 24},
+        {25, 25},
+        {25, 27},
+        {25, 28},
+        {26, 26},
+        {26, 27},
+        {27, 26},
+        {27, 27},
+        {27, 28},
+        {28, 27},
+        {28, 28},
+        {29, 29},
+        {29, 30},
+        {29, 34},
+        {29, 35},
+        {30, 29},
+        {30, 30},
+        {30, 31},
+        {30, 34},
+        {30, 35},
+        {30, 36},
+        {31, 30},
+        {31, 31},
+        {31, 32},
+        {31, 35},
+        {31, 36},
+        {31, 37},
+        {32, 31},
+        {32, 32},
+        {32, 33},
+        {32, 36},
+        {32, 37},
+        {32, 38},
+        {33, 32},
+        {33, 33},
+        {33, 37},
+        {33, 38},
+        {34, 34},
+        {34, 35},
+        {35, 34},
+        {35, 35},
+        {35, 36},
+        {36, 35},
+        {36, 36},
+        {36, 37},
+        {37, 36},
+        {37, 37},
+        {37, 38},
+        {38, 37},
+        {38, 38},
+        {39, 39},
+        {39, 40},
+        {40, 40},
+        {40, 41},
+        {41, 41},
+        {41, 42},
+        {42, 42},
+        {43, 43},
+        {44, 44},
+        {44, 45},
+        {45, 44},
+        {45, 45},
+        {45, 46},
+        {46, 45},
+        {46, 46},
+        {46, 47},
+        {47, 46},
+        {47, 47},
+        {47, 48},
+        {48, 47},
+        {48, 48},
+        {49, 49},
+        {49, 50},
+        {49, 52},
+        {49, 53},
+        {50, 49},
+        {50, 50},
+        {50, 51},
+        {50, 52},
+        {50, 53},
+        {50, 54},
+        {51, 50},
+        {51, 51},
+        {51, 53},
+        {51, 54},
+        {52, 52},
+        {52, 53},
+        {52, 55},
+        {52, 56},
+        {53, 52},
+        {53, 53},
+        {53, 54},
+        {53, 55},
+        {53, 56},
+        {53, 57},
+        {54, 53},
+        {54, 54},
+        {54, 56},
+        {54, 57},
+        {55, 55},
+        {55, 56},
+        {56, 55},
+        {56, 56},
+        {56, 57},
+        {57, 56},
+        {57, 57},
+        {58, 58},
+        {58, 59},
+        {58, 61},
+        {58, 62},
+        {59, 58},
+        {59, 59},
+        {59, 60},
+        {59, 61},
+        {59, 62},
+        {59, 63},
+        {60, 59},
+        {60, 60},
+        {60, 62},
+        {60, 63},
+        {61, 61},
+        {61, 62},
+        {62, 61},
+        {62, 62},
+        {62, 63},
+        {63, 62},
+        {63, 63},
+        {64, 64}
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(1, 2, 1));
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1 ;
+          case 1: return -(sqrt(-1 + Power(T,2))/T) ;
+          case 2: return (1 - 2*T)/(T*sqrt(-1 + 4*Power(T,2))) ;
+          case 3: return -(sqrt(-1 + Power(T,2))/(T + 2*S*T)) ;
+          case 4: return -(sqrt(1 - 2/(1 + 2*T))/(T + 2*S*T)) ;
+          case 5: return 1/T ;
+          case 6: return -1 + 1/T - 1/(1 + T) ;
+          case 7: return -(1/(1 + T)) ;
+          case 8: return 1/(T + 2*S*T) ;
+          case 9: return -((-1 + T + Power(T,2))/((1 + 2*S)*T*(1 + T))) ;
+          case 10: return -(1/(1 + 2*S + T + 2*S*T)) ;
+          case 11: return sqrt(1 + 2/(1 + 2*T))/(1 + T) ;
+          case 12: return -(sqrt(T*(2 + T))/(1 + T)) ;
+          case 13: return (2*sqrt((1 + 2*S)*T*(1 + 2*T)) + (1 - 2*T)*sqrt((T + 2*S*T)/(1 + 2*T)))/(Power(1 + 2*S,1.5)*(1 + T)*sqrt(T*(3 + 2*T))) ;
+          case 14: return -(sqrt(T*(2 + T))/(1 + 2*S + T + 2*S*T)) ;
+          case 15: return (-2*sqrt(S*(1 + S)*(-1 + Power(T,2))))/(T + 2*S*T) ;
+          case 16: return (-2*sqrt((S*(1 + S)*(-1 + 2*T))/(1 + 2*T)))/(T + 2*S*T) ;
+          case 17: return (sqrt(1 + 2*S)*(-((-1 + T)*sqrt((S*T)/(1 + 2*S))*Power((1 + S)*(1 + T),1.5)) + T*sqrt((S*Power(1 + S,3)*T*Power(1 + T,3))/Power(1 + 2*S,3)) + T*sqrt((S*Power(1 + S,3)*T*Power(1 + T,3))/(1 + 2*S)) - ((1 + S)*sqrt(S*(1 + S)*T*(1 + T))*(-1 + Power(T,2)))/Power(1 + 2*S,1.5)))/(Power(1 + S,2)*Power(T*(1 + T),1.5)) ;
+          case 18: return (-2*sqrt(S*(1 + S))*(-1 + T + Power(T,2)))/((1 + 2*S)*T*(1 + T)) ;
+          case 19: return (-2*sqrt(S*(1 + S)))/(1 + 2*S + T + 2*S*T) ;
+          case 20: return -((sqrt(1 + 2*S)*(1 + 2*T)*((4*(1 + S)*T*sqrt(S*(1 + S)*(3 + 2*T)))/Power((1 + 2*S)*(1 + 2*T),1.5) - sqrt((S*(1 + S)*(3 + 2*T))/(Power(1 + 2*S,3)*Power(1 + 2*T,3))) - sqrt((S*(1 + S)*(3 + 2*T))/((1 + 2*S)*Power(1 + 2*T,3))) - 2*sqrt((S*(1 + S)*(3 + 2*T))/(Power(1 + 2*S,3)*(1 + 2*T))) - 2*sqrt((S*(1 + S)*(3 + 2*T))/((1 + 2*S)*(1 + 2*T)))))/((1 + S)*(1 + T)*(3 + 2*T))) ;
+          case 21: return (-2*sqrt(S*(1 + S)*T*(2 + T)))/(1 + 2*S + T + 2*S*T) ;
+          case 22: return 1 ;
+          case 23: return sqrt(1 - 2/(-1 + T) + 2/T) ;
+          case 24: return sqrt((-6 + 4*T)/(T - 3*Power(T,2) + 2*Power(T,3))) ;
+          case 25: return -(sqrt(2)/sqrt((-1 + T)*T)) ;
+          case 26: return (-3 + Power(T,2))/sqrt(Power(T,2)*(-1 + Power(T,2))) ;
+          case 27: return (sqrt(3)*(-3 + T + 2*Power(T,2)))/(T*sqrt((-1 + T)*(1 + T)*(1 + 2*T)*(3 + 2*T))) ;
+          case 28: return -((sqrt(3)*(-3 + T + 2*Power(T,2)))/(T*sqrt((1 + T)*(3 - 7*T + 4*Power(T,3))))) ;
+          case 29: return 1 - 3/T + 3/(1 + T) ;
+          case 30: return 1/((1 + T)*sqrt((T*(3 + 2*T))/(-6 + 9*T + 6*Power(T,2)))) ;
+          case 31: return sqrt(3)*sqrt(1 + T)*((-3 + T)*T*(-1 + 2*T)*sqrt((1 + 2*T)/(T*Power(1 + T,3)*Power(3 + 2*T,2)*(-2 + 3*T + 2*Power(T,2)))) + 6*sqrt((Power(-1 + T,2)*(-1 + 2*T))/(T*Power(1 + T,3)*Power(3 + 2*T,2)*(2 + 5*T + 2*Power(T,2)))) + (1 - 2*T)*sqrt((T*(1 + 2*T))/(Power(3 + 2*T,2)*(-2 + T + 5*Power(T,2) + 2*Power(T,3)))) + (3*(-3 + 2*T)*sqrt((T*(-1 + 2*T))/(2 + 7*T + 7*Power(T,2) + 2*Power(T,3))))/(3 + 5*T + 2*Power(T,2))) ;
+          case 32: return (-2 + T*(2 + T))/((1 + T)*sqrt(T*(2 + T))) ;
+          case 33: return (sqrt(2 + 2/T)*(45*T*sqrt(T*(1 + T)*(2 + T)*(3 + 2*T)) + 2*(15*sqrt(T*(1 + T)*(2 + T)*(3 + 2*T)) + 9*sqrt(Power(T,5)*(1 + T)*(2 + T)*(3 + 2*T)) + sqrt(Power(T,3)*Power(1 + T,3)*(2 + T)*Power(1 + 2*T,2)*(3 + 2*T)))))/(Power(2 + T,2)*Power((1 + T)*(3 + 2*T),1.5)*(5 + 2*T)) ;
+          case 34: return -((sqrt(2)*(30*sqrt(T*(1 + T)*(2 + T)*(3 + 2*T)) + 47*sqrt(Power(T,3)*(1 + T)*(2 + T)*(3 + 2*T)) + 24*sqrt(Power(T,5)*(1 + T)*(2 + T)*(3 + 2*T)) + 4*sqrt(Power(T,7)*(1 + T)*(2 + T)*(3 + 2*T))))/((1 + T)*Power(2 + T,2)*Power(3 + 2*T,2)*sqrt(T*(5 + 2*T)))) ;
+          case 35: return ((3 + T)*sqrt((T*(1 + T))/(6 + 5*T + Power(T,2))))/(1 + T) ;
+          case 36: return sqrt(-1 + Power(T,2))/T ;
+          case 37: return (-1 + 2*T)/(T*sqrt(-1 + 4*Power(T,2))) ;
+          case 38: return sqrt((-1 + Power(T,2))/((S + 2*Power(S,2))*Power(T,2))) ;
+          case 39: return (-1 + 2*T)/(T*sqrt(S*(1 + 2*S)*(-1 + 4*Power(T,2)))) ;
+          case 40: return -(1/T) ;
+          case 41: return 1 - 1/T + 1/(1 + T) ;
+          case 42: return 1/(1 + T) ;
+          case 43: return -(1/(sqrt(S*(1 + 2*S))*T)) ;
+          case 44: return (-1 + T + Power(T,2))/(sqrt(S*(1 + 2*S))*(T + Power(T,2))) ;
+          case 45: return 1/(sqrt(S*(1 + 2*S))*(1 + T)) ;
+          case 46: return -(sqrt(1 + 2/(1 + 2*T))/(1 + T)) ;
+          case 47: return sqrt(T*(2 + T))/(1 + T) ;
+          case 48: return (-2*sqrt((1 + 2*S)*T*(1 + 2*T)) + (-1 + 2*T)*sqrt((T + 2*S*T)/(1 + 2*T)))/((1 + 2*S)*(1 + T)*sqrt(S*T*(3 + 2*T))) ;
+          case 49: return (T*(2 + T))/((1 + T)*sqrt(S*(1 + 2*S)*T*(2 + T))) ;
+          case 50: return sqrt((1 + T)/(T + S*T))*(sqrt(((2 - 1/S)*(-1 + T))/(T + 2*S*T)) - sqrt((S - S*T)/(T - 4*Power(S,2)*T)) + 2*S*sqrt((S - S*T)/(T - 4*Power(S,2)*T))) ;
+          case 51: return sqrt((1 + T)/((1 + S)*(T + 2*Power(T,2))))*(-sqrt((S*(-1 + 2*T))/((-1 + 4*Power(S,2))*T*(1 + T))) + 2*S*sqrt((S*(-1 + 2*T))/((-1 + 4*Power(S,2))*T*(1 + T))) + sqrt(((2 - 1/S)*(-1 + 2*T))/((1 + 2*S)*(T + Power(T,2))))) ;
+          case 52: return sqrt((-1 + Power(T,2))/((1 + 3*S + 2*Power(S,2))*Power(T,2))) ;
+          case 53: return sqrt((-1 + 2*T)/((1 + 3*S + 2*Power(S,2))*Power(T,2)*(1 + 2*T))) ;
+          case 54: return ((1 + 2*S)*(-sqrt(S*(-1 + S + 2*Power(S,2))*T*(1 + T)) - sqrt(Power(S,3)*(-1 + S + 2*Power(S,2))*T*(1 + T)) + sqrt(S*(-1 + S + 2*Power(S,2))*Power(T,5)*(1 + T)) + sqrt(Power(S,3)*(-1 + S + 2*Power(S,2))*Power(T,5)*(1 + T)) + S*T*sqrt((S*Power(1 + S,3)*T*Power(1 + T,3))/(-1 + 2*S)) - T*sqrt(S*Power(1 + S,3)*(-1 + 2*S)*T*Power(1 + T,3)) - S*sqrt((S*Power(1 + S,3)*Power(-1 + T,2)*T*Power(1 + T,3))/(-1 + 2*S)) + 2*Power(S,2)*(-(T*sqrt((S*Power(1 + S,3)*T*Power(1 + T,3))/(-1 + 2*S))) + sqrt((S*Power(1 + S,3)*Power(-1 + T,2)*T*Power(1 + T,3))/(-1 + 2*S)))))/(S*Power(1 + S,2)*Power((1 + 2*S)*T*(1 + T),1.5)) ;
+          case 55: return (-(S*(1 + S)*(1 + T)*sqrt(S*(1 + S)*(1 + 2*S)*Power(1 - 2*T,2)*T*Power(1 + T,3))) + 2*Power(S,2)*(1 + S)*(1 + T)*sqrt(S*(1 + S)*(1 + 2*S)*Power(1 - 2*T,2)*T*Power(1 + T,3)) - (1 + S)*(1 + T)*sqrt(Power(1 - 2*S,2)*S*(1 + S)*(1 + 2*S)*Power(T,3)*Power(1 + T,3)) + (1 + S)*T*(1 + T)*sqrt(Power(1 - 2*S,2)*S*(1 + S)*(1 + 2*S)*Power(T,3)*Power(1 + T,3)) + S*sqrt(S*Power(1 + S,3)*(1 + 2*S)*Power(T,3)*Power(1 + T,5)) - 2*Power(S,2)*sqrt(S*Power(1 + S,3)*(1 + 2*S)*Power(T,3)*Power(1 + T,5)) - S*T*sqrt(S*Power(1 + S,3)*(1 + 2*S)*Power(T,3)*Power(1 + T,5)) + 2*Power(S,2)*T*sqrt(S*Power(1 + S,3)*(1 + 2*S)*Power(T,3)*Power(1 + T,5)) + (1 + S)*(-1 + 2*S)*sqrt(S*(1 + S)*(1 + 2*S)*T)*Power(1 + T,2.5)*(-1 + 2*T))/(S*Power(1 + S,2)*sqrt(-1 + 2*S)*(1 + 2*S)*Power(T,1.5)*Power(1 + T,3.5)) ;
+          case 56: return (-sqrt((Power(S,3)*(1 + S)*(1 + T))/(-1 + 2*S)) + 2*sqrt((Power(S,5)*(1 + S)*(1 + T))/(-1 + 2*S)) + sqrt(S*(1 + S)*(-1 + 2*S)*(1 + T)))/(S*(1 + S)*sqrt(1 + 2*S)*Power(1 + T,1.5)) ;
+          case 57: return -(1/(sqrt((1 + S)*(1 + 2*S))*T)) ;
+          case 58: return (-1 + T + Power(T,2))/(sqrt(1 + 3*S + 2*Power(S,2))*(T + Power(T,2))) ;
+          case 59: return 1/(sqrt((1 + S)*(1 + 2*S))*(1 + T)) ;
+          case 60: return -(((1 + S)*(-1 + 2*S)*(3 + 2*T))/((1 + T)*sqrt(S*(1 + S)*(-1 + 2*S)*(1 + 2*S)*(3 + 4*T*(2 + T))))) ;
+          case 61: return (sqrt((1 + T)/((1 + 3*S + 2*Power(S,2))*(2 + T)))*(-5*sqrt((S*T)/((-1 + 2*S)*(1 + T))) - 4*T*sqrt((S*T)/((-1 + 2*S)*(1 + T))) + 2*Power(S,2)*sqrt((T*(1 + T))/(S*(-1 + 2*S)))*(1 + 2*T) + sqrt(((-1 + 2*S)*T*(1 + T))/S)*(1 + 2*T) + 5*sqrt(-((T - 2*S*T)/(S + S*T))) + 4*T*sqrt(-((T - 2*S*T)/(S + S*T))) + S*(6*sqrt((S*T)/((-1 + 2*S)*(1 + T))) + 4*sqrt((S*T)/((-1 + 2*S)*(1 + T)))*(1 + 2*T) - sqrt((T*(1 + T))/(S*(-1 + 2*S)))*(1 + 2*T))))/(3 + 5*T + 2*Power(T,2)) ;
+          case 62: return (-3 - 2*T)/((1 + T)*sqrt((1 + S)*(1 + 2*S)*(3 + 4*T*(2 + T)))) ;
+          case 63: return sqrt((T*(2 + T))/(1 + 3*S + 2*Power(S,2)))/(1 + T) ;
+          case 64: return sqrt((1 + T)/(3*T + 5*S*T + 2*Power(S,2)*T))*(sqrt((S*(1 + 2*S)*(-1 + T))/T) + sqrt((S*(1 + 2*S)*(-1 + T))/(Power(1 + S,2)*T)) + sqrt((S*(-1 + T))/(Power(1 + S,2)*(T + 2*S*T)))) ;
+          case 65: return (3 + 2*S)/sqrt(((1 + S)*(1 + 2*S)*(3 + 2*S)*Power(T,2)*(1 + 2*T))/(S*(-1 + 2*T))) ;
+          case 66: return (-3 - 2*S)/sqrt(((1 + S)*(1 + 2*S)*(3 + 2*S)*Power(T,2))/S) ;
+          case 67: return (sqrt((S*(1 + S)*(3 + 2*S))/(1 + 2*S))*(-1 + T + Power(T,2)))/((1 + S)*T*(1 + T)) ;
+          case 68: return sqrt(1 + 1/(1 + S) - 2/(1 + 2*S))/(1 + T) ;
+          case 69: return -(((3 + 2*T)*(sqrt((S*(1 + S)*(1 + 2*S))/(1 + T)) + 2*sqrt((Power(S,3)*(1 + S)*(1 + 2*S))/(1 + T)) + 2*sqrt((S + 2*Power(S,2))/(1 + S + T + S*T)) + 2*sqrt((Power(S,3) + 2*Power(S,4))/(1 + S + T + S*T))))/((1 + S)*(1 + 2*S)*sqrt((3 + 2*S)*(1 + T)*(1 + 2*T)*(3 + 2*T)))) ;
+          case 70: return sqrt((S*(3 + 2*S)*T*(2 + T))/(1 + 3*S + 2*Power(S,2)))/(1 + T) ;
+          case 71: return -(sqrt(-1 + Power(T,2))/T) ;
+          case 72: return (1 - 2*T)/(T*sqrt(-1 + 4*Power(T,2))) ;
+          case 73: return -(sqrt(-1 + Power(T,2))/(T + 2*S*T)) ;
+          case 74: return -(sqrt(1 - 2/(1 + 2*T))/(T + 2*S*T)) ;
+          case 75: return 1/T ;
+          case 76: return -1 + 1/T - 1/(1 + T) ;
+          case 77: return -(1/(1 + T)) ;
+          case 78: return 1/(T + 2*S*T) ;
+          case 79: return -((-1 + T + Power(T,2))/((1 + 2*S)*T*(1 + T))) ;
+          case 80: return -(1/(1 + 2*S + T + 2*S*T)) ;
+          case 81: return sqrt(1 + 2/(1 + 2*T))/(1 + T) ;
+          case 82: return -(sqrt(T*(2 + T))/(1 + T)) ;
+          case 83: return (2*sqrt((1 + 2*S)*T*(1 + 2*T)) + (1 - 2*T)*sqrt((T + 2*S*T)/(1 + 2*T)))/(Power(1 + 2*S,1.5)*(1 + T)*sqrt(T*(3 + 2*T))) ;
+          case 84: return -(sqrt(T*(2 + T))/(1 + 2*S + T + 2*S*T)) ;
+          case 85: return (-2*sqrt(S*(1 + S)*(-1 + Power(T,2))))/(T + 2*S*T) ;
+          case 86: return (-2*sqrt((S*(1 + S)*(-1 + 2*T))/(1 + 2*T)))/(T + 2*S*T) ;
+          case 87: return (sqrt(1 + 2*S)*(-((-1 + T)*sqrt((S*T)/(1 + 2*S))*Power((1 + S)*(1 + T),1.5)) + T*sqrt((S*Power(1 + S,3)*T*Power(1 + T,3))/Power(1 + 2*S,3)) + T*sqrt((S*Power(1 + S,3)*T*Power(1 + T,3))/(1 + 2*S)) - ((1 + S)*sqrt(S*(1 + S)*T*(1 + T))*(-1 + Power(T,2)))/Power(1 + 2*S,1.5)))/(Power(1 + S,2)*Power(T*(1 + T),1.5)) ;
+          case 88: return (-2*sqrt(S*(1 + S))*(-1 + T + Power(T,2)))/((1 + 2*S)*T*(1 + T)) ;
+          case 89: return (-2*sqrt(S*(1 + S)))/(1 + 2*S + T + 2*S*T) ;
+          case 90: return -((sqrt(1 + 2*S)*(1 + 2*T)*((4*(1 + S)*T*sqrt(S*(1 + S)*(3 + 2*T)))/Power((1 + 2*S)*(1 + 2*T),1.5) - sqrt((S*(1 + S)*(3 + 2*T))/(Power(1 + 2*S,3)*Power(1 + 2*T,3))) - sqrt((S*(1 + S)*(3 + 2*T))/((1 + 2*S)*Power(1 + 2*T,3))) - 2*sqrt((S*(1 + S)*(3 + 2*T))/(Power(1 + 2*S,3)*(1 + 2*T))) - 2*sqrt((S*(1 + S)*(3 + 2*T))/((1 + 2*S)*(1 + 2*T)))))/((1 + S)*(1 + T)*(3 + 2*T))) ;
+          case 91: return (-2*sqrt(S*(1 + S)*T*(2 + T)))/(1 + 2*S + T + 2*S*T) ;
+          case 92: return -(sqrt((-2 + T)*(1 + T))/sqrt((-1 + T)*T)) ;
+          case 93: return -sqrt((-6 + 4*T)/(T - 3*Power(T,2) + 2*Power(T,3))) ;
+          case 94: return -(sqrt((-2 + T)*(1 + T))/((1 + 2*S)*sqrt((-1 + T)*T))) ;
+          case 95: return (sqrt(2)*(3 - 2*T))/((1 + 2*S)*sqrt((-1 + T)*T*(-3 + 2*T)*(-1 + 2*T))) ;
+          case 96: return sqrt(2)/sqrt((-1 + T)*T) ;
+          case 97: return (3 - Power(T,2))/sqrt(Power(T,2)*(-1 + Power(T,2))) ;
+          case 98: return -((sqrt(3)*(-3 + T + 2*Power(T,2)))/(T*sqrt((-1 + T)*(1 + T)*(1 + 2*T)*(3 + 2*T)))) ;
+          case 99: return sqrt(2)/((1 + 2*S)*sqrt((-1 + T)*T)) ;
+          case 100: return (3 - Power(T,2))/((T + 2*S*T)*sqrt(-1 + Power(T,2))) ;
+          case 101: return -((sqrt(3)*(-3 + T + 2*Power(T,2)))/(sqrt((-1 + T)*(1 + T)*(1 + 2*T)*(3 + 2*T))*(T + 2*S*T))) ;
+          case 102: return (sqrt(3)*(-3 + T + 2*Power(T,2)))/(T*sqrt((1 + T)*(3 - 7*T + 4*Power(T,3)))) ;
+          case 103: return -1 + 3/T - 3/(1 + T) ;
+          case 104: return -(1/((1 + T)*sqrt((T*(3 + 2*T))/(-6 + 9*T + 6*Power(T,2))))) ;
+          case 105: return (sqrt(3)*(-3 + T + 2*Power(T,2)))/(sqrt((-1 + T)*(1 + T)*(-1 + 2*T)*(3 + 2*T))*(T + 2*S*T)) ;
+          case 106: return -((-3 + T + Power(T,2))/((1 + T)*(T + 2*S*T))) ;
+          case 107: return -((sqrt(3)*T*sqrt(1 + T)*(T*sqrt(((1 + 2*S)*(2 + T))/(-1 + 2*T))*(-19 + 4*T*(3 + T)) + 6*(sqrt(((1 + 2*S)*(2 + T))/(-1 + 2*T)) + 2*sqrt((1 + 2*S)*(2 + T)*(-1 + 2*T)))))/((2 + T)*Power((1 + 2*S)*T*(1 + T)*(3 + 2*T),1.5))) ;
+          case 108: return -(sqrt(3)*sqrt(1 + T)*((-3 + T)*T*(-1 + 2*T)*sqrt((1 + 2*T)/(T*Power(1 + T,3)*Power(3 + 2*T,2)*(-2 + 3*T + 2*Power(T,2)))) + 6*sqrt((Power(-1 + T,2)*(-1 + 2*T))/(T*Power(1 + T,3)*Power(3 + 2*T,2)*(2 + 5*T + 2*Power(T,2)))) + (1 - 2*T)*sqrt((T*(1 + 2*T))/(Power(3 + 2*T,2)*(-2 + T + 5*Power(T,2) + 2*Power(T,3)))) + (3*(-3 + 2*T)*sqrt((T*(-1 + 2*T))/(2 + 7*T + 7*Power(T,2) + 2*Power(T,3))))/(3 + 5*T + 2*Power(T,2)))) ;
+          case 109: return (2 - T*(2 + T))/((1 + T)*sqrt(T*(2 + T))) ;
+          case 110: return -((sqrt(2 + 2/T)*(45*T*sqrt(T*(1 + T)*(2 + T)*(3 + 2*T)) + 2*(15*sqrt(T*(1 + T)*(2 + T)*(3 + 2*T)) + 9*sqrt(Power(T,5)*(1 + T)*(2 + T)*(3 + 2*T)) + sqrt(Power(T,3)*Power(1 + T,3)*(2 + T)*Power(1 + 2*T,2)*(3 + 2*T)))))/(Power(2 + T,2)*Power((1 + T)*(3 + 2*T),1.5)*(5 + 2*T))) ;
+          case 111: return (sqrt(3)*(2 + T)*(-1 + 2*T))/((1 + 2*S)*(1 + T)*sqrt(T*(2 + T)*(-1 + 2*T)*(1 + 2*T))) ;
+          case 112: return (2 - T*(2 + T))/((1 + 2*S)*(1 + T)*sqrt(T*(2 + T))) ;
+          case 113: return -(sqrt(2)/((1 + 2*S)*sqrt((1 + T)*(2 + T)))) ;
+          case 114: return sqrt(2)*sqrt(1/(T*Power(1 + T,2)*(5 + 2*T)*Power(6 + 7*T + 2*Power(T,2),3)))*(30*sqrt(T*(1 + T)) + 47*sqrt(Power(T,3)*(1 + T)) + 24*sqrt(Power(T,5)*(1 + T)) + 4*sqrt(Power(T,7)*(1 + T))) ;
+          case 115: return -((T*(3 + T))/sqrt(T*(1 + T)*(2 + T)*(3 + T))) ;
+          case 116: return sqrt(2)*sqrt(1/(Power(1 + 2*S,3)*T*Power(1 + T,2)*(5 + 2*T)*Power(6 + 7*T + 2*Power(T,2),3)))*(30*sqrt((1 + 2*S)*T*(1 + T)) - 9*sqrt((1 + 2*S)*Power(T,3)*(1 + T)) - 29*sqrt((1 + 2*S)*Power(T,5)*(1 + T)) - 24*sqrt((1 + 2*S)*Power(T,7)*(1 + T)) - 4*sqrt((1 + 2*S)*Power(T,9)*(1 + T)) + T*sqrt((1 + 2*S)*T*(1 + T))*(56 + T*(53 + 4*T*(7 + T)))) ;
+          case 117: return -(sqrt((T*(1 + T)*(3 + T))/(2 + T))/((1 + 2*S)*(1 + T))) ;
+          case 118: return (-2*sqrt((S*(1 + S)*(-2 + T)*(1 + T))/((-1 + T)*T)))/(1 + 2*S) ;
+          case 119: return -((sqrt(2)*(sqrt((S*(-3 + 2*T))/(1 + 2*S)) + sqrt(S*(1 + 2*S)*(-3 + 2*T))))/sqrt((1 + S)*(1 + 2*S)*(-1 + T)*T*(-1 + 2*T))) ;
+          case 120: return (2*sqrt(2)*sqrt((S*(1 + S))/((-1 + T)*T)))/(1 + 2*S) ;
+          case 121: return (-2*(-3 + Power(T,2))*sqrt((S*(1 + S))/(-1 + Power(T,2))))/(T + 2*S*T) ;
+          case 122: return (-2*sqrt(3)*(T*sqrt((S*(1 + S)*(1 + T))/(-1 + T))*(-5 + 2*T) + 3*(sqrt((S*(1 + S)*(1 + T))/(-1 + T)) + 2*sqrt(S*(1 + S)*(-1 + Power(T,2))))))/((1 + 2*S)*T*(1 + T)*sqrt(3 + 4*T*(2 + T))) ;
+          case 123: return (sqrt(3)*(3*sqrt((S*(-1 + T))/((1 + 2*S)*T*(-1 + 2*T))) + (3 - 2*T)*T*sqrt((S*(-1 + T))/((1 + 2*S)*T*(-1 + 2*T))) + 3*sqrt((S*(1 + 2*S)*(-1 + T))/(T*(-1 + 2*T))) + 3*sqrt((S*(1 + 2*S)*(-1 + T)*T)/(-1 + 2*T)) - 2*sqrt((S*(1 + 2*S)*(-1 + T)*Power(T,3))/(-1 + 2*T)) + sqrt((S*T)/((1 + 2*S)*(1 - 3*T + 2*Power(T,2)))) + sqrt((S*(1 + 2*S)*T)/(1 - 3*T + 2*Power(T,2))) - 3*sqrt((S*Power(T,3))/((1 + 2*S)*(1 - 3*T + 2*Power(T,2)))) - 3*sqrt((S*(1 + 2*S)*Power(T,3))/(1 - 3*T + 2*Power(T,2))) + 2*sqrt((S*Power(T,5))/((1 + 2*S)*(1 - 3*T + 2*Power(T,2)))) + 2*sqrt((S*(1 + 2*S)*Power(T,5))/(1 - 3*T + 2*Power(T,2)))))/sqrt((1 + S)*(1 + 2*S)*T*(1 + T)*(3 + 2*T)) ;
+          case 124: return (-2*sqrt(S*(1 + S))*(-3 + T + Power(T,2)))/((1 + T)*(T + 2*S*T)) ;
+          case 125: return (-2*(1 + S)*sqrt((3 + 3*T)/(T + S*T))*(T*sqrt((S*(1 + T)*(2 + T)*(3 + 2*T))/(-1 + 2*T))*(-19 + 4*T*(3 + T)) + 6*(sqrt((S*(1 + T)*(2 + T)*(3 + 2*T))/(-1 + 2*T)) + 2*sqrt(S*(1 + T)*(2 + T)*(-1 + 2*T)*(3 + 2*T)))))/((1 + 2*S)*Power(1 + T,2)*(2 + T)*Power(3 + 2*T,2)) ;
+          case 126: return -(sqrt(3)*sqrt(1 + T)*((-3 + T)*T*(-1 + 2*T)*sqrt((S*(1 + 2*T))/((1 + S)*T*Power(1 + T,3)*Power(3 + 2*T,2)*(-2 + 3*T + 2*Power(T,2)))) + (-3 + T)*T*(-1 + 2*T)*sqrt((S*(1 + 2*T))/((1 + S)*Power(1 + 2*S,2)*T*Power(1 + T,3)*Power(3 + 2*T,2)*(-2 + 3*T + 2*Power(T,2)))) + 3*T*(-3 + 2*T)*sqrt((S*(-1 + 2*T))/((1 + S)*T*Power(1 + T,3)*Power(3 + 2*T,2)*(2 + 5*T + 2*Power(T,2)))) + 6*sqrt((S*Power(-1 + T,2)*(-1 + 2*T))/((1 + S)*T*Power(1 + T,3)*Power(3 + 2*T,2)*(2 + 5*T + 2*Power(T,2)))) + 6*sqrt((S*Power(-1 + T,2)*(-1 + 2*T))/((1 + S)*Power(1 + 2*S,2)*T*Power(1 + T,3)*Power(3 + 2*T,2)*(2 + 5*T + 2*Power(T,2)))) + (1 - 2*T)*T*sqrt((S*(1 + 2*T))/((1 + S)*T*Power(3 + 2*T,2)*(-2 + T + 5*Power(T,2) + 2*Power(T,3)))) + (1 - 2*T)*T*sqrt((S*(1 + 2*T))/((1 + S)*Power(1 + 2*S,2)*T*Power(3 + 2*T,2)*(-2 + T + 5*Power(T,2) + 2*Power(T,3)))) + (3*(-3 + 2*T)*sqrt((S*T*(-1 + 2*T))/((1 + S)*Power(1 + 2*S,2)*(2 + 7*T + 7*Power(T,2) + 2*Power(T,3)))))/(3 + 5*T + 2*Power(T,2)))) ;
+          case 127: return -((T*(1 + 2*T)*((6*sqrt(S)*(1 + S)*T*(1 + T)*Power((2 + T)*(3 + 2*T),2.5)*(-4 + Power(T,2)*(7 + 4*T)))/((1 + 2*S)*(1 + 2*T)) + (12*Power(S,1.5)*(1 + S)*T*(1 + T)*Power((2 + T)*(3 + 2*T),2.5)*(-4 + Power(T,2)*(7 + 4*T)))/((1 + 2*S)*(1 + 2*T)) + (6*(1 + S)*T*(1 + T)*Power(S*(2 + T)*(3 + 2*T),2.5)*(-4 + Power(T,2)*(7 + 4*T)))/((1 + 2*S)*(1 + 2*T)) + (-2 + T)*(sqrt(S*Power(1 + S,4)*Power(T + Power(T,2),4)*Power(6 + 7*T + 2*Power(T,2),5)) + sqrt((S*Power(1 + S,4)*Power(T + Power(T,2),4)*Power(6 + 7*T + 2*Power(T,2),5))/Power(1 + 2*S,2)))))/(Power((1 + S)*T,2.5)*Power(1 + T,2)*Power(2 + T,4)*Power(3 + 2*T,3.5))) ;
+          case 128: return (-2*sqrt(2)*sqrt((S*(1 + S))/(2 + 3*T + Power(T,2))))/(1 + 2*S) ;
+          case 129: return (2*T*(11*T*sqrt(S*(1 + S)*T*(1 + T)*(1 + 2*T)*(5 + 2*T)) + 2*Power(T,2)*sqrt(S*(1 + S)*T*(1 + T)*(1 + 2*T)*(5 + 2*T)) - 3*((1 + 2*S)*(-1 + 2*T)*sqrt((S*(1 + S)*T*(1 + T)*(5 + 2*T))/(1 + 2*T)) + sqrt((S*(1 + S)*Power(1 - 2*T,2)*T*(1 + T)*(5 + 2*T))/(1 + 2*T)) - 8*sqrt(S*(1 + S)*T*(1 + T)*(1 + 2*T)*(5 + 2*T))) + S*sqrt(S*(1 + S)*T*(1 + T)*(1 + 2*T)*(5 + 2*T))*(24 + T*(11 + 2*T))))/((1 + S)*(1 + 2*S)*(1 + T)*(5 + 2*T)*Power((T*(2 + T)*(3 + 2*T))/(2 + 4*T),1.5)*(2 + 4*T)) ;
+          case 130: return (-2*(54*sqrt((S*(1 + S)*T*(1 + 2*T)*(5 + 2*T))/(2 + T)) + 19*sqrt((S*(1 + S)*Power(T,3)*(1 + 2*T)*(5 + 2*T))/(2 + T)) + 4*sqrt((S*(1 + S)*Power(T,5)*(1 + 2*T)*(5 + 2*T))/(2 + T)) + 3*sqrt(S*(1 + S)*T*(2 + T)*(1 + 2*T)*(5 + 2*T)) + 30*sqrt((S*(1 + S)*T*(5 + 2*T))/(2 + 5*T + 2*Power(T,2))) + S*(54*sqrt((S*(1 + S)*T*(1 + 2*T)*(5 + 2*T))/(2 + T)) + 38*sqrt((S*(1 + S)*Power(T,3)*(1 + 2*T)*(5 + 2*T))/(2 + T)) + 8*sqrt((S*(1 + S)*Power(T,5)*(1 + 2*T)*(5 + 2*T))/(2 + T)) + 3*sqrt(S*(1 + S)*T*(2 + T)*(1 + 2*T)*(5 + 2*T)) + T*(5 + 2*T)*sqrt(S*(1 + S)*T*(2 + T)*(1 + 2*T)*(5 + 2*T)) + 30*sqrt((S*(1 + S)*T*(5 + 2*T))/(2 + 5*T + 2*Power(T,2)))) + T*(19*sqrt((S*(1 + S)*T*(1 + 2*T)*(5 + 2*T))/(2 + T)) + 5*sqrt(S*(1 + S)*T*(2 + T)*(1 + 2*T)*(5 + 2*T)) + 2*T*(2*sqrt((S*(1 + S)*T*(1 + 2*T)*(5 + 2*T))/(2 + T)) + sqrt(S*(1 + S)*T*(2 + T)*(1 + 2*T)*(5 + 2*T))))))/((1 + S)*(1 + 2*S)*(2 + T)*(3 + 2*T)*(5 + 2*T)*sqrt(T*(6 + T) + 5*(2 + 1/(1 + 2*T)))) ;
+          case 131: return -1 ;
+          case 132: return -(sqrt(3)/sqrt(-1 + 4*Power(S,2))) ;
+          case 133: return (-2*(-1 + Power(S,2)))/sqrt(1 - 5*Power(S,2) + 4*Power(S,4)) ;
+          case 134: return -2/(1 + 2*S) ;
+          case 135: return (sqrt((Power(S,3)*(1 + S)*(1 + 2*S)*(3 + 2*S))/(-1 + 2*S)) - 2*sqrt((Power(S,5)*(1 + S)*(1 + 2*S)*(3 + 2*S))/(-1 + 2*S)) + 4*S*sqrt((S*(1 + S)*(3 + 2*S))/(-1 + 4*Power(S,2))) - 8*sqrt((Power(S,5)*(1 + S)*(3 + 2*S))/(-1 + 4*Power(S,2))) - 3*sqrt((S*(-3 + S*(1 + 4*S*(2 + S))))/(1 + 2*S)))/sqrt(S*Power(1 + S,3)*(1 + 2*S)*Power(3 + 2*S,2)) ;
+          case 136: return -((sqrt(3)*(3*sqrt(S*(1 + S)*(3 + 2*S)) + 5*sqrt(Power(S,3)*(1 + S)*(3 + 2*S)) + 2*sqrt(Power(S,5)*(1 + S)*(3 + 2*S))))/sqrt(S*Power(1 + S,3)*(1 + 2*S)*Power(3 + 2*S,4))) ;
+          case 137: return -2*(2 + S)*sqrt(S/(6 + 19*S + 16*Power(S,2) + 4*Power(S,3))) ;
+          case 138: return 1 ;
+          case 139: return sqrt(1 - 2/(-1 + T) + 2/T) ;
+          case 140: return sqrt((-6 + 4*T)/(T - 3*Power(T,2) + 2*Power(T,3))) ;
+          case 141: return -(sqrt(2)/sqrt((-1 + T)*T)) ;
+          case 142: return (-3 + Power(T,2))/sqrt(Power(T,2)*(-1 + Power(T,2))) ;
+          case 143: return (sqrt(3)*(-3 + T + 2*Power(T,2)))/(T*sqrt((-1 + T)*(1 + T)*(1 + 2*T)*(3 + 2*T))) ;
+          case 144: return -((sqrt(3)*(-3 + T + 2*Power(T,2)))/(T*sqrt((1 + T)*(3 - 7*T + 4*Power(T,3))))) ;
+          case 145: return 1 - 3/T + 3/(1 + T) ;
+          case 146: return 1/((1 + T)*sqrt((T*(3 + 2*T))/(-6 + 9*T + 6*Power(T,2)))) ;
+          case 147: return sqrt(3)*sqrt(1 + T)*((-3 + T)*T*(-1 + 2*T)*sqrt((1 + 2*T)/(T*Power(1 + T,3)*Power(3 + 2*T,2)*(-2 + 3*T + 2*Power(T,2)))) + 6*sqrt((Power(-1 + T,2)*(-1 + 2*T))/(T*Power(1 + T,3)*Power(3 + 2*T,2)*(2 + 5*T + 2*Power(T,2)))) + (1 - 2*T)*sqrt((T*(1 + 2*T))/(Power(3 + 2*T,2)*(-2 + T + 5*Power(T,2) + 2*Power(T,3)))) + (3*(-3 + 2*T)*sqrt((T*(-1 + 2*T))/(2 + 7*T + 7*Power(T,2) + 2*Power(T,3))))/(3 + 5*T + 2*Power(T,2))) ;
+          case 148: return (-2 + T*(2 + T))/((1 + T)*sqrt(T*(2 + T))) ;
+          case 149: return (sqrt(2 + 2/T)*(45*T*sqrt(T*(1 + T)*(2 + T)*(3 + 2*T)) + 2*(15*sqrt(T*(1 + T)*(2 + T)*(3 + 2*T)) + 9*sqrt(Power(T,5)*(1 + T)*(2 + T)*(3 + 2*T)) + sqrt(Power(T,3)*Power(1 + T,3)*(2 + T)*Power(1 + 2*T,2)*(3 + 2*T)))))/(Power(2 + T,2)*Power((1 + T)*(3 + 2*T),1.5)*(5 + 2*T)) ;
+          case 150: return -((sqrt(2)*(30*sqrt(T*(1 + T)*(2 + T)*(3 + 2*T)) + 47*sqrt(Power(T,3)*(1 + T)*(2 + T)*(3 + 2*T)) + 24*sqrt(Power(T,5)*(1 + T)*(2 + T)*(3 + 2*T)) + 4*sqrt(Power(T,7)*(1 + T)*(2 + T)*(3 + 2*T))))/((1 + T)*Power(2 + T,2)*Power(3 + 2*T,2)*sqrt(T*(5 + 2*T)))) ;
+          case 151: return ((3 + T)*sqrt((T*(1 + T))/(6 + 5*T + Power(T,2))))/(1 + T) ;
+          case 152: return sqrt(-1 + Power(T,2))/T ;
+          case 153: return (-1 + 2*T)/(T*sqrt(-1 + 4*Power(T,2))) ;
+          case 154: return sqrt((-1 + Power(T,2))/((S + 2*Power(S,2))*Power(T,2))) ;
+          case 155: return (-1 + 2*T)/(T*sqrt(S*(1 + 2*S)*(-1 + 4*Power(T,2)))) ;
+          case 156: return -(1/T) ;
+          case 157: return 1 - 1/T + 1/(1 + T) ;
+          case 158: return 1/(1 + T) ;
+          case 159: return -(1/(sqrt(S*(1 + 2*S))*T)) ;
+          case 160: return (-1 + T + Power(T,2))/(sqrt(S*(1 + 2*S))*(T + Power(T,2))) ;
+          case 161: return 1/(sqrt(S*(1 + 2*S))*(1 + T)) ;
+          case 162: return -(sqrt(1 + 2/(1 + 2*T))/(1 + T)) ;
+          case 163: return sqrt(T*(2 + T))/(1 + T) ;
+          case 164: return (-2*sqrt((1 + 2*S)*T*(1 + 2*T)) + (-1 + 2*T)*sqrt((T + 2*S*T)/(1 + 2*T)))/((1 + 2*S)*(1 + T)*sqrt(S*T*(3 + 2*T))) ;
+          case 165: return (T*(2 + T))/((1 + T)*sqrt(S*(1 + 2*S)*T*(2 + T))) ;
+          case 166: return sqrt((1 + T)/(T + S*T))*(sqrt(((2 - 1/S)*(-1 + T))/(T + 2*S*T)) - sqrt((S - S*T)/(T - 4*Power(S,2)*T)) + 2*S*sqrt((S - S*T)/(T - 4*Power(S,2)*T))) ;
+          case 167: return sqrt((1 + T)/((1 + S)*(T + 2*Power(T,2))))*(-sqrt((S*(-1 + 2*T))/((-1 + 4*Power(S,2))*T*(1 + T))) + 2*S*sqrt((S*(-1 + 2*T))/((-1 + 4*Power(S,2))*T*(1 + T))) + sqrt(((2 - 1/S)*(-1 + 2*T))/((1 + 2*S)*(T + Power(T,2))))) ;
+          case 168: return sqrt((-1 + Power(T,2))/((1 + 3*S + 2*Power(S,2))*Power(T,2))) ;
+          case 169: return sqrt((-1 + 2*T)/((1 + 3*S + 2*Power(S,2))*Power(T,2)*(1 + 2*T))) ;
+          case 170: return -(sqrt(-1 - 1/S + 4*S + 4*Power(S,2))/(T + 2*S*T)) ;
+          case 171: return (-(S*(1 + S)*(1 + T)*sqrt(S*(1 + S)*(1 + 2*S)*Power(1 - 2*T,2)*T*Power(1 + T,3))) + 2*Power(S,2)*(1 + S)*(1 + T)*sqrt(S*(1 + S)*(1 + 2*S)*Power(1 - 2*T,2)*T*Power(1 + T,3)) - (1 + S)*(1 + T)*sqrt(Power(1 - 2*S,2)*S*(1 + S)*(1 + 2*S)*Power(T,3)*Power(1 + T,3)) + (1 + S)*T*(1 + T)*sqrt(Power(1 - 2*S,2)*S*(1 + S)*(1 + 2*S)*Power(T,3)*Power(1 + T,3)) + S*sqrt(S*Power(1 + S,3)*(1 + 2*S)*Power(T,3)*Power(1 + T,5)) - 2*Power(S,2)*sqrt(S*Power(1 + S,3)*(1 + 2*S)*Power(T,3)*Power(1 + T,5)) - S*T*sqrt(S*Power(1 + S,3)*(1 + 2*S)*Power(T,3)*Power(1 + T,5)) + 2*Power(S,2)*T*sqrt(S*Power(1 + S,3)*(1 + 2*S)*Power(T,3)*Power(1 + T,5)) + (1 + S)*(-1 + 2*S)*sqrt(S*(1 + S)*(1 + 2*S)*T)*Power(1 + T,2.5)*(-1 + 2*T))/(S*Power(1 + S,2)*sqrt(-1 + 2*S)*(1 + 2*S)*Power(T,1.5)*Power(1 + T,3.5)) ;
+          case 172: return (-sqrt((Power(S,3)*(1 + S)*(1 + T))/(-1 + 2*S)) + 2*sqrt((Power(S,5)*(1 + S)*(1 + T))/(-1 + 2*S)) + sqrt(S*(1 + S)*(-1 + 2*S)*(1 + T)))/(S*(1 + S)*sqrt(1 + 2*S)*Power(1 + T,1.5)) ;
+          case 173: return -(1/(sqrt((1 + S)*(1 + 2*S))*T)) ;
+          case 174: return (-1 + T + Power(T,2))/(sqrt(1 + 3*S + 2*Power(S,2))*(T + Power(T,2))) ;
+          case 175: return 1/(sqrt((1 + S)*(1 + 2*S))*(1 + T)) ;
+          case 176: return -(((1 + S)*(-1 + 2*S)*(3 + 2*T))/((1 + T)*sqrt(S*(1 + S)*(-1 + 2*S)*(1 + 2*S)*(3 + 4*T*(2 + T))))) ;
+          case 177: return (sqrt((1 + T)/((1 + 3*S + 2*Power(S,2))*(2 + T)))*(-5*sqrt((S*T)/((-1 + 2*S)*(1 + T))) - 4*T*sqrt((S*T)/((-1 + 2*S)*(1 + T))) + 2*Power(S,2)*sqrt((T*(1 + T))/(S*(-1 + 2*S)))*(1 + 2*T) + sqrt(((-1 + 2*S)*T*(1 + T))/S)*(1 + 2*T) + 5*sqrt(-((T - 2*S*T)/(S + S*T))) + 4*T*sqrt(-((T - 2*S*T)/(S + S*T))) + S*(6*sqrt((S*T)/((-1 + 2*S)*(1 + T))) + 4*sqrt((S*T)/((-1 + 2*S)*(1 + T)))*(1 + 2*T) - sqrt((T*(1 + T))/(S*(-1 + 2*S)))*(1 + 2*T))))/(3 + 5*T + 2*Power(T,2)) ;
+          case 178: return (-3 - 2*T)/((1 + T)*sqrt((1 + S)*(1 + 2*S)*(3 + 4*T*(2 + T)))) ;
+          case 179: return sqrt((T*(2 + T))/(1 + 3*S + 2*Power(S,2)))/(1 + T) ;
+          case 180: return sqrt((1 + T)/(3*T + 5*S*T + 2*Power(S,2)*T))*(sqrt((S*(1 + 2*S)*(-1 + T))/T) + sqrt((S*(1 + 2*S)*(-1 + T))/(Power(1 + S,2)*T)) + sqrt((S*(-1 + T))/(Power(1 + S,2)*(T + 2*S*T)))) ;
+          case 181: return (3 + 2*S)/sqrt(((1 + S)*(1 + 2*S)*(3 + 2*S)*Power(T,2)*(1 + 2*T))/(S*(-1 + 2*T))) ;
+          case 182: return (-3 - 2*S)/sqrt(((1 + S)*(1 + 2*S)*(3 + 2*S)*Power(T,2))/S) ;
+          case 183: return (sqrt((S*(1 + S)*(3 + 2*S))/(1 + 2*S))*(-1 + T + Power(T,2)))/((1 + S)*T*(1 + T)) ;
+          case 184: return sqrt(1 + 1/(1 + S) - 2/(1 + 2*S))/(1 + T) ;
+          case 185: return -(((3 + 2*T)*(sqrt((S*(1 + S)*(1 + 2*S))/(1 + T)) + 2*sqrt((Power(S,3)*(1 + S)*(1 + 2*S))/(1 + T)) + 2*sqrt((S + 2*Power(S,2))/(1 + S + T + S*T)) + 2*sqrt((Power(S,3) + 2*Power(S,4))/(1 + S + T + S*T))))/((1 + S)*(1 + 2*S)*sqrt((3 + 2*S)*(1 + T)*(1 + 2*T)*(3 + 2*T)))) ;
+          case 186: return sqrt((S*(3 + 2*S)*T*(2 + T))/(1 + 3*S + 2*Power(S,2)))/(1 + T) ;
+          case 187: return -(sqrt(-1 + Power(T,2))/T) ;
+          case 188: return (1 - 2*T)/(T*sqrt(-1 + 4*Power(T,2))) ;
+          case 189: return -(sqrt(-1 + Power(T,2))/(T + 2*S*T)) ;
+          case 190: return -(sqrt(1 - 2/(1 + 2*T))/(T + 2*S*T)) ;
+          case 191: return 1/T ;
+          case 192: return -1 + 1/T - 1/(1 + T) ;
+          case 193: return -(1/(1 + T)) ;
+          case 194: return 1/(T + 2*S*T) ;
+          case 195: return -((-1 + T + Power(T,2))/((1 + 2*S)*T*(1 + T))) ;
+          case 196: return -(1/(1 + 2*S + T + 2*S*T)) ;
+          case 197: return sqrt(1 + 2/(1 + 2*T))/(1 + T) ;
+          case 198: return -(sqrt(T*(2 + T))/(1 + T)) ;
+          case 199: return (2*sqrt((1 + 2*S)*T*(1 + 2*T)) + (1 - 2*T)*sqrt((T + 2*S*T)/(1 + 2*T)))/(Power(1 + 2*S,1.5)*(1 + T)*sqrt(T*(3 + 2*T))) ;
+          case 200: return -(sqrt(T*(2 + T))/(1 + 2*S + T + 2*S*T)) ;
+          case 201: return (-2*sqrt(S*(1 + S)*(-1 + Power(T,2))))/(T + 2*S*T) ;
+          case 202: return (-2*sqrt((S*(1 + S)*(-1 + 2*T))/(1 + 2*T)))/(T + 2*S*T) ;
+          case 203: return (sqrt(1 + 2*S)*(-((-1 + T)*sqrt((S*T)/(1 + 2*S))*Power((1 + S)*(1 + T),1.5)) + T*sqrt((S*Power(1 + S,3)*T*Power(1 + T,3))/Power(1 + 2*S,3)) + T*sqrt((S*Power(1 + S,3)*T*Power(1 + T,3))/(1 + 2*S)) - ((1 + S)*sqrt(S*(1 + S)*T*(1 + T))*(-1 + Power(T,2)))/Power(1 + 2*S,1.5)))/(Power(1 + S,2)*Power(T*(1 + T),1.5)) ;
+          case 204: return (-2*sqrt(S*(1 + S))*(-1 + T + Power(T,2)))/((1 + 2*S)*T*(1 + T)) ;
+          case 205: return (-2*sqrt(S*(1 + S)))/(1 + 2*S + T + 2*S*T) ;
+          case 206: return -((sqrt(1 + 2*S)*(1 + 2*T)*((4*(1 + S)*T*sqrt(S*(1 + S)*(3 + 2*T)))/Power((1 + 2*S)*(1 + 2*T),1.5) - sqrt((S*(1 + S)*(3 + 2*T))/(Power(1 + 2*S,3)*Power(1 + 2*T,3))) - sqrt((S*(1 + S)*(3 + 2*T))/((1 + 2*S)*Power(1 + 2*T,3))) - 2*sqrt((S*(1 + S)*(3 + 2*T))/(Power(1 + 2*S,3)*(1 + 2*T))) - 2*sqrt((S*(1 + S)*(3 + 2*T))/((1 + 2*S)*(1 + 2*T)))))/((1 + S)*(1 + T)*(3 + 2*T))) ;
+          case 207: return (-2*sqrt(S*(1 + S)*T*(2 + T)))/(1 + 2*S + T + 2*S*T) ;
+          case 208: return 1 ;
+          default: my_assert_not_reached();
+        }
+      };
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(1, 2, 1));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -111,10 +1704,384 @@ MatrixElements<SC> SymmetryQST<SC>::recalc_doublet(const DiagInfo<SC> &diag, con
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "qst/qst-doubletp+1.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 2},
+        {3, 3},
+        {4, 2},
+        {4, 3},
+        {4, 4},
+        {5, 2},
+        {5, 5},
+        {6, 2},
+        {6, 3},
+        {6, 5},
+        {6, 6},
+        {7, 2},
+        {7, 3},
+        {7, 4},
+        {7, 5},
+        {7, 6},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {10, 9},
+        {10, 10},
+        {11, 9},
+        {11, 10},
+        {11, 11},
+        {12, 10},
+        {12, 11},
+        {12, 12},
+        {13, 11},
+        {13, 12},
+        {13, 13},
+        {14, 14},
+        {15, 14},
+        {15, 15},
+        {16, 14},
+        {16, 15},
+        {16, 16},
+        {17, 14},
+        {17, 17},
+        {18, 14},
+        {18, 15},
+        {18, 17},
+        {18, 18},
+        {19, 14},
+        {19, 15},
+        {19, 16},
+        {19, 17},
+        {19, 18},
+        {19, 19},
+        {20, 17},
+        {20, 20},
+        {21, 17},
+        {21, 18},
+        {21, 20},
+        {21, 21},
+        {22, 17},
+        {22, 18},
+        {22, 19},
+        {22, 20},
+        {22, 21},
+        {22, 22},
+        {23, 23},
+        {24, 23},
+        {24, 24},
+        {25, 23},
+        {25, 24},
+        {25, 25},
+        {26, 23},
+        {26, 26},
+        {27, 23},
+        {27, 24},
+        {27, 26},
+        {27, 27},
+        {28, 23},
+        {28, 24},
+        {28, 25},
+        {28, 26},
+        {28, 27},
+        {28, 28},
+        {29, 29},
+        {30, 29},
+        {30, 30},
+        {31, 29},
+        {31, 30},
+        {31, 31},
+        {32, 30},
+        {32, 31},
+        {32, 32},
+        {33, 31},
+        {33, 32},
+        {33, 33},
+        {34, 29},
+        {34, 34},
+        {35, 29},
+        {35, 30},
+        {35, 34},
+        {35, 35},
+        {36, 29},
+        {36, 30},
+        {36, 31},
+        {36, 34},
+        {36, 35},
+        {36, 36},
+        {37, 30},
+        {37, 31},
+        {37, 32},
+        {37, 35},
+        {37, 36},
+        {37, 37},
+        {38, 31},
+        {38, 32},
+        {38, 33},
+        {38, 36},
+        {38, 37},
+        {38, 38},
+        {39, 39},
+        {40, 39},
+        {40, 40},
+        {41, 40},
+        {41, 41},
+        {42, 41},
+        {42, 42},
+        {43, 43},
+        {44, 44},
+        {45, 44},
+        {45, 45},
+        {46, 44},
+        {46, 45},
+        {46, 46},
+        {47, 45},
+        {47, 46},
+        {47, 47},
+        {48, 46},
+        {48, 47},
+        {48, 48},
+        {49, 49},
+        {50, 49},
+        {50, 50},
+        {51, 49},
+        {51, 50},
+        {51, 51},
+        {52, 49},
+        {52, 52},
+        {53, 49},
+        {53, 50},
+        {53, 52},
+        {53, 53},
+        {54, 49},
+        {54, 50},
+        {54, 51},
+        {54, 52},
+        {54, 53},
+        {54, 54},
+        {55, 52},
+        {55, 55},
+        {56, 52},
+        {56, 53},
+        {56, 55},
+        {56, 56},
+        {57, 52},
+        {57, 53},
+        {57, 54},
+        {57, 55},
+        {57, 56},
+        {57, 57},
+        {58, 58},
+        {59, 58},
+        {59, 59},
+        {60, 58},
+        {60, 59},
+        {60, 60},
+        {61, 58},
+        {61, 61},
+        {62, 58},
+        {62, 59},
+        {62, 61},
+        {62, 62},
+        {63, 58},
+        {63, 59},
+        {63, 60},
+        {63, 61},
+        {63, 62},
+        {63, 63},
+        {64, 64}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1 ;
+          case 1: return (-2*sqrt(S*(1 + S)*(-3 + 4*T*(1 + T))))/((1 + 2*S)*(1 + 2*T)) ;
+          case 2: return (2*sqrt((S*(1 + S)*(3 + 2*T))/(1 + 2*T)))/(1 + 2*S + T + 2*S*T) ;
+          case 3: return (-2*(2*sqrt((S*(1 + S)*T)/(2 + T)) + sqrt((S*(1 + S)*Power(T,3))/(2 + T))))/(1 + 2*S + T + 2*S*T) ;
+          case 4: return (-2*sqrt((S*(1 + S))/Power(1 + 2*S,2)))/(1 + 3*T + 2*Power(T,2)) ;
+          case 5: return (2*sqrt(S*(1 + S)))/(1 + 2*S + T + 2*S*T) ;
+          case 6: return (-2*sqrt(S*(1 + S)))/(1 + 2*S) ;
+          case 7: return sqrt(-3 + 4*T*(1 + T))/((1 + 2*S)*(1 + 2*T)) ;
+          case 8: return -(sqrt(-3 + 4*T*(1 + T))/(1 + 2*T)) ;
+          case 9: return (-2*Power(T,2)*sqrt(((1 + S)*T*(1 + T))/(1 + 2*T)) - sqrt(((1 + S)*Power(T,3))/(1 + 3*T + 2*Power(T,2))) + sqrt(((1 + S)*Power(T,5))/(1 + 3*T + 2*Power(T,2))) + 2*sqrt(((1 + S)*Power(T,7))/(1 + 3*T + 2*Power(T,2))))/((1 + 2*S)*Power(T,1.5)*Power(1 + T,2)*sqrt((1 + S)/(3 + 5*T + 2*Power(T,2)))) ;
+          case 10: return (T*sqrt(((1 + S)*T*(3 + 2*T))/(1 + 2*S))*(-1 + Power(T,2)) + 3*(sqrt(((1 + S)*Power(T,3)*(3 + 2*T))/(1 + 2*S)) + sqrt(((1 + S)*Power(T,5)*(3 + 2*T))/(1 + 2*S))) - 2*S*(T*sqrt(((1 + S)*T*(3 + 2*T))/Power(1 + 2*S,3))*(-1 + Power(T,2)) + 3*(sqrt(((1 + S)*Power(T,3)*(3 + 2*T))/Power(1 + 2*S,3)) + sqrt(((1 + S)*Power(T,5)*(3 + 2*T))/Power(1 + 2*S,3)))))/(T*Power(1 + T,2)*sqrt(((1 + S)*(2 + T)*(3 + 2*T))/(1 + 2*S))) ;
+          case 11: return (sqrt((1 + S)*T) + 2*sqrt((1 + S)*Power(T,3)) + sqrt((1 + S)*Power(T,5)))/(Power(1 + T,3)*sqrt(((1 + S)*T*(1 + 2*T))/(3 + 2*T))) ;
+          case 12: return -(((2 + T)*((-1 + T)*T*(2*sqrt((Power(1 + S,3)*(3 + 2*S)*T*Power(1 + T,5)*Power(3 + 2*T,2))/Power(1 + 2*S,3)) + sqrt((Power(1 + S,3)*(3 + 2*S)*T*Power(1 + T,5)*Power(3 + 2*T,2))/(1 + 2*S))) + 3*(2*sqrt((Power(1 + S,3)*(3 + 2*S)*Power(T,3)*Power(1 + T,5)*Power(3 + 2*T,2))/Power(1 + 2*S,3)) + sqrt((Power(1 + S,3)*(3 + 2*S)*Power(T,3)*Power(1 + T,5)*Power(3 + 2*T,2))/(1 + 2*S)))))/(T*Power(1 + T,3.5)*Power(((1 + S)*(3 + 2*S)*(2 + T))/(1 + 2*S),1.5)*(3 + 2*T))) ;
+          case 13: return 1/((1 + 2*S)*(1 + 3*T + 2*Power(T,2))) ;
+          case 14: return -(1/(1 + 2*S + T + 2*S*T)) ;
+          case 15: return 1/(1 + 2*S) ;
+          case 16: return 1/(-1 - 3*T - 2*Power(T,2)) ;
+          case 17: return 1/(1 + T) ;
+          case 18: return -1 ;
+          case 19: return 1 ;
+          case 20: return sqrt((9 - 4*Power(T,2))/(1 - 4*Power(T,2))) ;
+          case 21: return -(1/sqrt((T*(1 + T)*(1 + 2*T))/(6 + 4*T))) ;
+          case 22: return (-2 + T + Power(T,2))/sqrt(((-1 + T)*T*(1 + T)*(2 + T)*Power(1 + 2*T,2))/(-3 + 4*T*(1 + T))) ;
+          case 23: return sqrt(6)/sqrt(T*(1 + T)*(-1 + 2*T)*(1 + 2*T)) ;
+          case 24: return -(((2 + T)*sqrt((-3 + 6*T)/(T*(2 + 5*T + 2*Power(T,2)))))/(1 + T)) ;
+          case 25: return ((2 + T)*(-1 + 2*T)*(5 + 2*T))/((1 + T)*sqrt(((2 + T)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T)*(5 + 2*T))/T)) ;
+          case 26: return 3/(1 + 3*T + 2*Power(T,2)) ;
+          case 27: return (sqrt(3)*T*(2*(-60*sqrt((3 + 2*T)/((1 + T)*(2 + T)*(5 + 2*T))) + sqrt((1 + T)*(2 + T)*(3 + 2*T)*(5 + 2*T))) + T*(-6*(43*sqrt((3 + 2*T)/((1 + T)*(2 + T)*(5 + 2*T))) + sqrt((1 + T)*(2 + T)*(3 + 2*T)*(5 + 2*T))) + T*(-9*sqrt((3 + 2*T)/((1 + T)*(2 + T)*(5 + 2*T))) - 20*sqrt((1 + T)*(2 + T)*(3 + 2*T)*(5 + 2*T)) + 3*T*sqrt((3 + 2*T)/((1 + T)*(2 + T)*(5 + 2*T)))*(95 + 4*T*(16 + 3*T))))))/((1 + T)*Power(2 + T,2)*sqrt(T*(1 + T)*(1 + 2*T)*(3 + 2*T))*(5 + 2*T)) ;
+          case 28: return (T*(3 + T))/sqrt(T*(1 + T)*(2 + T)*(3 + T)) ;
+          case 29: return sqrt(6)/sqrt((1 + T)*(2 + T)*(1 + 2*T)*(3 + 2*T)) ;
+          case 30: return -(sqrt(2)/sqrt((1 + T)*(2 + T))) ;
+          case 31: return 1 ;
+          case 32: return sqrt(((-1 + S + 2*Power(S,2))*(-3 + 4*T*(1 + T)))/(S*(1 + 2*S)))/(1 + 2*T) ;
+          case 33: return -(sqrt(((-1 + S + 2*Power(S,2))*(3 + 2*T))/((S + 2*Power(S,2))*(1 + 2*T)))/(1 + T)) ;
+          case 34: return sqrt(((-1 + S + 2*Power(S,2))*T*(2 + T))/(S*(1 + 2*S)))/(1 + T) ;
+          case 35: return 1/(sqrt((S*(1 + 2*S))/(-1 + S + 2*Power(S,2)))*(1 + 3*T + 2*Power(T,2))) ;
+          case 36: return -(1/(sqrt((S*(1 + 2*S))/(-1 + S + 2*Power(S,2)))*(1 + T))) ;
+          case 37: return 1/sqrt((S*(1 + 2*S))/(-1 + S + 2*Power(S,2))) ;
+          case 38: return -(sqrt((-3 + 4*T*(1 + T))/(S*(1 + 2*S)))/(1 + 2*T)) ;
+          case 39: return (sqrt(1 + 3/T - 2/(1 + 2*T))*(4*sqrt((S*(1 + S)*T*(-1 + 2*T))/((3 + 4*S*(2 + S))*(1 + T)*(1 + 2*T))) - sqrt((S*T*(-1 + 2*T))/((3 + 11*S + 12*Power(S,2) + 4*Power(S,3))*(1 + 3*T + 2*Power(T,2)))) + sqrt((Power(S,3)*T*(-1 + 2*T))/((3 + 11*S + 12*Power(S,2) + 4*Power(S,3))*(1 + 3*T + 2*Power(T,2)))) + 2*sqrt((Power(S,5)*T*(-1 + 2*T))/((3 + 11*S + 12*Power(S,2) + 4*Power(S,3))*(1 + 3*T + 2*Power(T,2))))))/(1 + S) ;
+          case 40: return (sqrt((1 + T)*(3 + 2*T))*((-2*Power(S*(1 + S)*T,1.5)*Power(1 + T,2)*(-1 + 2*T))/sqrt((1 + 2*S)*(1 + T)*(1 + 2*T)) - (2*Power(1 + S,1.5)*(-1 + 2*S)*Power(T,2.5)*Power(1 + T,2))/sqrt(((1 + 2*S)*(1 + T)*(1 + 2*T))/S) + ((-1 + 2*S)*Power((1 + S)*T,1.5)*Power(1 + T,2)*(-1 + 2*T))/sqrt(((1 + 2*S)*(1 + T)*(1 + 2*T))/S) + 4*S*T*sqrt((S*Power(1 + S,3)*Power(T + Power(T,2),3))/((1 + 2*S)*(1 + 2*T)))))/(S*Power((1 + S)*T,1.5)*Power(1 + T,3)) ;
+          case 41: return (-2*T*(1 + T)*sqrt((1 + S)*T*(1 + T)) - sqrt((1 + S)*Power(T,5)*(1 + T)) - sqrt((1 + S)*Power(T,7)*(1 + T)) + 2*S*(-(T*(1 + T)*sqrt((1 + S)*T*(1 + T))) + sqrt((1 + S)*Power(T,3)*(1 + T)) + sqrt((1 + S)*Power(T,5)*(1 + T))))/(T*Power(1 + T,2.5)*sqrt(S*(1 + S)*(1 + 2*S)*(2 + T))) ;
+          case 42: return (-3*sqrt(S*(1 + S)*(1 + 2*S)*(3 + 2*S)*T*(1 + T)*(1 + 2*T)) - 2*sqrt(Power(S,3)*(1 + S)*(1 + 2*S)*(3 + 2*S)*T*(1 + T)*(1 + 2*T)))/((1 + S)*(3 + 4*S*(2 + S))*Power(1 + T,2)*(1 + 2*T)*sqrt(T/(3 + 5*T + 2*Power(T,2)))) ;
+          case 43: return (6*sqrt(S*T*(3 + 2*T)) - 3*sqrt(S*Power(T,3)*(3 + 2*T)) + sqrt(S*T*(3 + 2*T))*(2*S*(1 + T)*(2 + T) + 3*T*(4 + T)))/(Power(1 + T,2)*sqrt((1 + S)*(3 + 4*S*(2 + S))*(2 + T)*(3 + 2*T))) ;
+          case 44: return -(1/(sqrt(S*(1 + 2*S))*(1 + T)*(1 + 2*T))) ;
+          case 45: return 1/(sqrt(S*(1 + 2*S))*(1 + T)) ;
+          case 46: return -(1/sqrt(S*(1 + 2*S))) ;
+          case 47: return (3*sqrt(S*(1 + S)*(1 + T)*(1 + 2*T)) + 2*sqrt(Power(S,3)*(1 + S)*(1 + T)*(1 + 2*T)) + T*(-6*sqrt((S*(1 + S)*(1 + 2*T))/(1 + T)) - 4*sqrt((Power(S,3)*(1 + S)*(1 + 2*T))/(1 + T)) - 3*sqrt((S*(1 + S))/(1 + 3*T + 2*Power(T,2))) + 6*T*sqrt((S*(1 + S))/(1 + 3*T + 2*Power(T,2))) - 2*sqrt((Power(S,3)*(1 + S))/(1 + 3*T + 2*Power(T,2))) + 4*T*sqrt((Power(S,3)*(1 + S))/(1 + 3*T + 2*Power(T,2)))))/((1 + S)*sqrt((3 + 4*S*(2 + S))*(1 + T)*(1 + 2*T))) ;
+          case 48: return (-3*sqrt(S*(2 + T)) - 2*sqrt(Power(S,3)*(2 + T)))/((1 + S)*(1 + T)*sqrt(((3 + 4*S*(2 + S))*(2 + T))/(1 + S))) ;
+          case 49: return (27*sqrt((S*(1 + S))/(1 + T)) + 18*sqrt((Power(S,3)*(1 + S))/(1 + T)) + 3*sqrt(S*(1 + S)*(1 + T)) + 2*sqrt(Power(S,3)*(1 + S)*(1 + T)) + 2*T*(9*sqrt((S*(1 + S))/(1 + T)) + 6*sqrt((Power(S,3)*(1 + S))/(1 + T)) + 3*sqrt(S*(1 + S)*(1 + T)) + 2*sqrt(Power(S,3)*(1 + S)*(1 + T))))/((1 + S)*sqrt((3 + 4*S*(2 + S))/(1 + T))*(2 + T)*(5 + 2*T)) ;
+          case 50: return (4*S*sqrt(((1 + S)*(-3 + 4*T*(1 + T)))/(1 + 2*S)) - 3*sqrt((1 + S)*(1 + 2*S)*(-3 + 4*T*(1 + T))))/((1 + S)*(3 + 2*S)*(1 + 2*T)) ;
+          case 51: return sqrt(-3 + 4*T*(1 + T))/(1 + 2*T) ;
+          case 52: return 1/((1 + T)*sqrt(((1 + S)*(1 + 2*S)*(1 + 2*T))/(3 + 2*T))) ;
+          case 53: return -(sqrt((T*(2 + T))/(1 + 3*S + 2*Power(S,2)))/(1 + T)) ;
+          case 54: return -(sqrt(3 + 4*T*(2 + T))/((1 + T)*(1 + 2*T))) ;
+          case 55: return sqrt(T*(2 + T))/(1 + T) ;
+          case 56: return -(1/(sqrt(1 + 3*S + 2*Power(S,2))*(1 + 3*T + 2*Power(T,2)))) ;
+          case 57: return 1/(sqrt((1 + S)*(1 + 2*S))*(1 + T)) ;
+          case 58: return -(1/sqrt((1 + S)*(1 + 2*S))) ;
+          case 59: return 1/(1 + 3*T + 2*Power(T,2)) ;
+          case 60: return -(1/(1 + T)) ;
+          case 61: return 1 ;
+          case 62: return (-2*sqrt(S*(1 + S)*(-3 + 4*T*(1 + T))))/((1 + 2*S)*(1 + 2*T)) ;
+          case 63: return (2*sqrt((S*(1 + S)*(3 + 2*T))/(1 + 2*T)))/(1 + 2*S + T + 2*S*T) ;
+          case 64: return (-2*(2*sqrt((S*(1 + S)*T)/(2 + T)) + sqrt((S*(1 + S)*Power(T,3))/(2 + T))))/(1 + 2*S + T + 2*S*T) ;
+          case 65: return (-2*sqrt((S*(1 + S))/Power(1 + 2*S,2)))/(1 + 3*T + 2*Power(T,2)) ;
+          case 66: return (2*sqrt(S*(1 + S)))/(1 + 2*S + T + 2*S*T) ;
+          case 67: return (-2*sqrt(S*(1 + S)))/(1 + 2*S) ;
+          case 68: return sqrt(-3 + 4*T*(1 + T))/((1 + 2*S)*(1 + 2*T)) ;
+          case 69: return -(sqrt(-3 + 4*T*(1 + T))/(1 + 2*T)) ;
+          case 70: return (-2*Power(T,2)*sqrt(((1 + S)*T*(1 + T))/(1 + 2*T)) - sqrt(((1 + S)*Power(T,3))/(1 + 3*T + 2*Power(T,2))) + sqrt(((1 + S)*Power(T,5))/(1 + 3*T + 2*Power(T,2))) + 2*sqrt(((1 + S)*Power(T,7))/(1 + 3*T + 2*Power(T,2))))/((1 + 2*S)*Power(T,1.5)*Power(1 + T,2)*sqrt((1 + S)/(3 + 5*T + 2*Power(T,2)))) ;
+          case 71: return (T*sqrt(((1 + S)*T*(3 + 2*T))/(1 + 2*S))*(-1 + Power(T,2)) + 3*(sqrt(((1 + S)*Power(T,3)*(3 + 2*T))/(1 + 2*S)) + sqrt(((1 + S)*Power(T,5)*(3 + 2*T))/(1 + 2*S))) - 2*S*(T*sqrt(((1 + S)*T*(3 + 2*T))/Power(1 + 2*S,3))*(-1 + Power(T,2)) + 3*(sqrt(((1 + S)*Power(T,3)*(3 + 2*T))/Power(1 + 2*S,3)) + sqrt(((1 + S)*Power(T,5)*(3 + 2*T))/Power(1 + 2*S,3)))))/(T*Power(1 + T,2)*sqrt(((1 + S)*(2 + T)*(3 + 2*T))/(1 + 2*S))) ;
+          case 72: return (sqrt((1 + S)*T) + 2*sqrt((1 + S)*Power(T,3)) + sqrt((1 + S)*Power(T,5)))/(Power(1 + T,3)*sqrt(((1 + S)*T*(1 + 2*T))/(3 + 2*T))) ;
+          case 73: return -(((2 + T)*((-1 + T)*T*(2*sqrt((Power(1 + S,3)*(3 + 2*S)*T*Power(1 + T,5)*Power(3 + 2*T,2))/Power(1 + 2*S,3)) + sqrt((Power(1 + S,3)*(3 + 2*S)*T*Power(1 + T,5)*Power(3 + 2*T,2))/(1 + 2*S))) + 3*(2*sqrt((Power(1 + S,3)*(3 + 2*S)*Power(T,3)*Power(1 + T,5)*Power(3 + 2*T,2))/Power(1 + 2*S,3)) + sqrt((Power(1 + S,3)*(3 + 2*S)*Power(T,3)*Power(1 + T,5)*Power(3 + 2*T,2))/(1 + 2*S)))))/(T*Power(1 + T,3.5)*Power(((1 + S)*(3 + 2*S)*(2 + T))/(1 + 2*S),1.5)*(3 + 2*T))) ;
+          case 74: return 1/((1 + 2*S)*(1 + 3*T + 2*Power(T,2))) ;
+          case 75: return -(1/(1 + 2*S + T + 2*S*T)) ;
+          case 76: return 1/(1 + 2*S) ;
+          case 77: return 1/(-1 - 3*T - 2*Power(T,2)) ;
+          case 78: return 1/(1 + T) ;
+          case 79: return -1 ;
+          case 80: return (-2*sqrt((S*(1 + S)*(-9 + 4*Power(T,2)))/(-1 + 4*Power(T,2))))/(1 + 2*S) ;
+          case 81: return 2*sqrt(2)*sqrt(((1 + S)*(-3 + 4*T*(1 + T)))/(1 + 2*S))*(sqrt(S/((1 + 2*S)*T*(-1 - T + 4*Power(T,2) + 4*Power(T,3)))) - 2*T*sqrt(S/((1 + 2*S)*T*(-1 - T + 4*Power(T,2) + 4*Power(T,3)))) + 2*sqrt((S*T)/((1 + 2*S)*(-1 - T + 4*Power(T,2) + 4*Power(T,3))))) ;
+          case 82: return -2*sqrt(((1 + S)*(3 + 2*T))/((1 + 2*S)*(T + 2*Power(T,2))))*(6*sqrt((S*(1 - 3*T + 2*Power(T,2)))/((1 + 2*S)*(2 + 7*T + 7*Power(T,2) + 2*Power(T,3)))) + 4*sqrt((S*(-1 + 2*T))/((1 + 2*S)*(-2 - 5*T + 5*Power(T,3) + 2*Power(T,4)))) + (-5 + T)*T*sqrt((S*(-1 + 2*T))/((1 + 2*S)*(-2 - 5*T + 5*Power(T,3) + 2*Power(T,4))))) ;
+          case 83: return (-2*sqrt(6)*sqrt(-((S*(1 + S))/(T + Power(T,2) - 4*Power(T,3) - 4*Power(T,4)))))/(1 + 2*S) ;
+          case 84: return -2*sqrt(3)*sqrt(((1 + S)*(1 + T)*(3 + 2*T))/(1 + 2*S))*(((-4 + T)*Power(-1 + 2*T,1.5))/((1 + T)*sqrt(((1 + 2*S)*T*(1 + T)*(2 + T)*(1 + 2*T)*(3 + 2*T))/S)) + 6*sqrt((S*Power(-1 + T,2)*(-1 + 2*T))/((1 + 2*S)*T*Power(1 + T,3)*(6 + 19*T + 16*Power(T,2) + 4*Power(T,3)))) - 2*(-1 + T)*(-1 + 2*T)*sqrt((S*T)/((1 + 2*S)*Power(1 + T,3)*(-6 - 7*T + 22*Power(T,2) + 28*Power(T,3) + 8*Power(T,4))))) ;
+          case 85: return (-2*sqrt((1 + S)/(1 + 2*S))*(36*sqrt((S*T*(-1 + 2*T))/((1 + 2*S)*(30 + 107*T + 118*Power(T,2) + 52*Power(T,3) + 8*Power(T,4)))) + 26*sqrt((S*T)/((1 + 2*S)*(-30 - 47*T + 96*Power(T,2) + 184*Power(T,3) + 96*Power(T,4) + 16*Power(T,5)))) + T*sqrt((S*T)/((1 + 2*S)*(-30 - 47*T + 96*Power(T,2) + 184*Power(T,3) + 96*Power(T,4) + 16*Power(T,5))))*(-61 + 4*T*(4 + T))))/(1 + T) ;
+          case 86: return (-6*sqrt(S*(1 + S)))/((1 + 2*S)*(1 + 3*T + 2*Power(T,2))) ;
+          case 87: return -2*sqrt(3)*T*sqrt((1 + S)/((1 + 2*S)*T*Power(2 + T,3)*(3 + 5*T + 2*Power(T,2))))*(sqrt((S*(1 + T)*(1 + 2*T)*(3 + 2*T))/((1 + 2*S)*(5 + 2*T))) - 12*sqrt((S*(3 + 2*T))/((1 + 2*S)*(5 + 17*T + 16*Power(T,2) + 4*Power(T,3)))) + sqrt((S*(3 + 4*T*(2 + T)))/((1 + 2*S)*(1 + T)*(5 + 2*T))) + T*(-2*sqrt((S*(1 + T)*(1 + 2*T)*(3 + 2*T))/((1 + 2*S)*(5 + 2*T))) - 3*sqrt((S*(3 + 2*T))/((1 + 2*S)*(5 + 17*T + 16*Power(T,2) + 4*Power(T,3)))) - 9*sqrt((S*(3 + 4*T*(2 + T)))/((1 + 2*S)*(1 + T)*(5 + 2*T))) + 2*T*(9*sqrt((S*(3 + 2*T))/((1 + 2*S)*(5 + 17*T + 16*Power(T,2) + 4*Power(T,3)))) + sqrt((S*(3 + 4*T*(2 + T)))/((1 + 2*S)*(1 + T)*(5 + 2*T)))))) ;
+          case 88: return (-2*S*(1 + S)*T*(3 + T))/((1 + 2*S)*sqrt(S*(1 + S)*T*(1 + T)*(2 + T)*(3 + T))) ;
+          case 89: return (-2*sqrt(6)*sqrt((S*(1 + S))/(6 + 25*T + 35*Power(T,2) + 20*Power(T,3) + 4*Power(T,4))))/(1 + 2*S) ;
+          case 90: return (2*sqrt(2)*sqrt(((1 + S)*(1 + T)*(3 + 2*T))/((1 + 2*S)*(3 + T)))*(5*(sqrt((S*(3 + 2*T))/((1 + 2*S)*(3 + T))) + 3*sqrt(S/((1 + 2*S)*(9 + 9*T + 2*Power(T,2))))) + T*(15*sqrt((S*(3 + 2*T))/((1 + 2*S)*(3 + T))) + 10*T*sqrt((S*(3 + 2*T))/((1 + 2*S)*(3 + T))) - 18*sqrt(S/((1 + 2*S)*(9 + 9*T + 2*Power(T,2)))) - 45*T*sqrt(S/((1 + 2*S)*(9 + 9*T + 2*Power(T,2)))) - 18*Power(T,2)*sqrt(S/((1 + 2*S)*(9 + 9*T + 2*Power(T,2)))))))/((1 + T)*Power(2 + T,1.5)*(5 + 2*T)) ;
+          case 91: return -2*sqrt((1 + S)/(Power(1 + 2*S,2)*(2 + T)*Power(3 + T,2)*Power(5 + 2*T,2)*Power(7 + 2*T,2)))*(3*(68*sqrt(S/(2 + T)) + sqrt(S*(2 + T))) + T*(294*sqrt(S/(2 + T)) + 11*sqrt(S*(2 + T)) + 4*T*(36*sqrt(S/(2 + T)) + 3*sqrt(S*(2 + T)) + T*(6*sqrt(S/(2 + T)) + sqrt(S*(2 + T)))))) ;
+          case 92: return sqrt((9 - 4*Power(T,2))/(1 - 4*Power(T,2)))/(1 + 2*S) ;
+          case 93: return -sqrt((9 - 4*Power(T,2))/(1 - 4*Power(T,2))) ;
+          case 94: return -(sqrt(2 + 6/T - 4/(1 + 2*T))/((1 + 2*S)*(1 + T))) ;
+          case 95: return ((-2 + T + Power(T,2))*(-2*S*sqrt((1 + S)/(Power(1 + 2*S,3)*(2 + 5*T + 2*Power(T,2)))) + sqrt((1 + S)/((1 + 2*S)*(2 + 5*T + 2*Power(T,2)))))*sqrt(((1 + S)*(1 + 2*S)*(-3 + T*(1 + 4*T*(2 + T))))/((-1 + T)*T*(1 + 2*T))))/((1 + S)*(1 + T)) ;
+          case 96: return (sqrt(2)*(3 + 2*T))/sqrt(T*(1 + T)*(1 + 2*T)*(3 + 2*T)) ;
+          case 97: return -(((-2 + T + Power(T,2))*(sqrt(((1 + S)*(1 + 2*S))/((3 + 2*S)*(2 + T)*(1 + 2*T))) + 2*sqrt((1 + S)/((3 + 4*S*(2 + S))*(2 + T)*(1 + 2*T))))*sqrt(((1 + S)*(1 + 2*S)*(-3 + T*(1 + 4*T*(2 + T))))/((3 + 2*S)*(-1 + T)*T*(1 + 2*T))))/((1 + S)*(1 + T))) ;
+          case 98: return sqrt(6)/((1 + 2*S)*sqrt(T*(1 + T)*(-1 + 2*T)*(1 + 2*T))) ;
+          case 99: return sqrt(2)*sqrt((1 + S)*(1 + T)*(3 + 2*T))*((sqrt(1.5)*(-4 + T)*(-1 + 2*T))/((1 + T)*sqrt(((1 + S)*T*(1 + T)*(2 + T)*(1 + 2*T)*(3 + 2*T))/(-1 + 2*T))) - (sqrt(6)*(-1 + T)*T*(-1 + 2*T))/sqrt((1 + S)*T*Power(1 + T,3)*(2 + T)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T)) + (3*sqrt(6)*sqrt((Power(-1 + T,2)*(-1 + 2*T))/((1 + S)*T*Power(1 + T,3)*(6 + 19*T + 16*Power(T,2) + 4*Power(T,3)))))/(1 + 2*S) + sqrt(6)*sqrt(S/(1 + 2*S))*(-1 + 2*T)*((4 - T)/((1 + T)*sqrt(((1 + S)*(1 + 2*S)*T*(1 + T)*(2 + T)*(1 + 2*T)*(3 + 2*T))/(S*(-1 + 2*T)))) + 2*(-1 + T)*T*sqrt(S/((1 + 3*S + 2*Power(S,2))*T*Power(1 + T,3)*(-6 - 7*T + 22*Power(T,2) + 28*Power(T,3) + 8*Power(T,4)))))) ;
+          case 100: return (T*(-9 + 2*T)*sqrt((1 + S)*T*(1 + T)*(2 + T)*(-1 + 2*T)*(1 + 2*T)*(5 + 2*T)) + 2*(5*sqrt((1 + S)*T*(1 + T)*(2 + T)*(-1 + 2*T)*(1 + 2*T)*(5 + 2*T)) + 9*sqrt((1 + S)*Power(T,3)*(1 + T)*(2 + T)*(-1 + 2*T)*(1 + 2*T)*(5 + 2*T))))/((1 + 2*S)*(1 + T)*(2 + T)*(1 + 2*T)*sqrt((1 + S)*(1 + T)*(3 + 2*T))*(5 + 2*T)) ;
+          case 101: return -(sqrt(6)/sqrt(T*(1 + T)*(-1 + 4*Power(T,2)))) ;
+          case 102: return (sqrt(3)*sqrt(-1 - 2/T + 8*T + 4*Power(T,2)))/(1 + 3*T + 2*Power(T,2)) ;
+          case 103: return (-80*sqrt(((3 + 2*S)*T)/(-1 + 2*T)) + 205*sqrt(((3 + 2*S)*Power(T,3))/(-1 + 2*T)) - 88*sqrt(((3 + 2*S)*Power(T,5))/(-1 + 2*T)) - 4*sqrt(((3 + 2*S)*Power(T,7))/(-1 + 2*T)) - 110*sqrt((3 + 2*S)*T*(-1 + 2*T)) + 2*(9 - 2*T)*T*sqrt((3 + 2*S)*T*(-1 + 2*T)) - 2*S*(26*sqrt(((3 + 2*S)*T)/(-1 + 2*T)) - 61*sqrt(((3 + 2*S)*Power(T,3))/(-1 + 2*T)) + 16*sqrt(((3 + 2*S)*Power(T,5))/(-1 + 2*T)) + 4*sqrt(((3 + 2*S)*Power(T,7))/(-1 + 2*T)) + 36*sqrt((3 + 2*S)*T*(-1 + 2*T))))/(Power(3 + 2*S,1.5)*(1 + T)*sqrt((2 + T)*(1 + 2*T)*(3 + 2*T)*(5 + 2*T))) ;
+          case 104: return 3/((1 + 2*S)*(1 + 3*T + 2*Power(T,2))) ;
+          case 105: return -((sqrt(3)*(5 + 2*T)*sqrt(T/(10 + 29*T + 20*Power(T,2) + 4*Power(T,3))))/((1 + 2*S)*(1 + T))) ;
+          case 106: return sqrt((T*(3 + T))/(2 + 3*T + Power(T,2)))/(1 + 2*S) ;
+          case 107: return -3/(1 + 3*T + 2*Power(T,2)) ;
+          case 108: return (sqrt(3)*(1800*sqrt(Power(T,3)*(2 + T)*(5 + 2*T)) + 8340*sqrt(Power(T,5)*(2 + T)*(5 + 2*T)) + 16658*sqrt(Power(T,7)*(2 + T)*(5 + 2*T)) + 18759*sqrt(Power(T,9)*(2 + T)*(5 + 2*T)) + 13041*sqrt(Power(T,11)*(2 + T)*(5 + 2*T)) + 5736*sqrt(Power(T,13)*(2 + T)*(5 + 2*T)) + 1560*sqrt(Power(T,15)*(2 + T)*(5 + 2*T)) + 240*sqrt(Power(T,17)*(2 + T)*(5 + 2*T)) + 16*sqrt(Power(T,19)*(2 + T)*(5 + 2*T))))/(T*Power(1 + T,2)*Power(2 + T,4)*sqrt(1 + 2*T)*Power(3 + 2*T,2)*Power(5 + 2*T,2)) ;
+          case 109: return -sqrt((T*(3 + T))/(2 + 3*T + Power(T,2))) ;
+          case 110: return sqrt(6)/((1 + 2*S)*sqrt((1 + T)*(2 + T)*(1 + 2*T)*(3 + 2*T))) ;
+          case 111: return (sqrt(2)*(300*S*sqrt(((1 + S)*(1 + 2*T))/((1 + 2*S)*(2 + T)*(3 + T)*(5 + 2*T))) + 2*Power(T,3)*(2*S*sqrt(((1 + S)*(1 + 2*T))/((1 + 2*S)*(2 + T)*(3 + T)*(5 + 2*T))) + sqrt(((1 + S)*(1 + 2*S)*(1 + 2*T)*(5 + 2*T))/((2 + T)*(3 + T)))) + T*(150*sqrt(((1 + S)*(1 + 2*S))/((2 + T)*(3 + T)*(1 + 2*T)*(5 + 2*T))) + 190*S*sqrt(((1 + S)*(1 + 2*T))/((1 + 2*S)*(2 + T)*(3 + T)*(5 + 2*T))) - 60*S*sqrt(((1 + S)*(5 + 2*T))/((1 + 2*S)*(2 + T)*(3 + T)*(1 + 2*T))) + 6*sqrt(((1 + S)*(1 + 2*S)*(1 + 2*T)*(5 + 2*T))/((2 + T)*(3 + T))) - 5*sqrt(((1 + S)*(1 + 2*S)*(2 + T)*(1 + 2*T)*(5 + 2*T))/(3 + T))) + Power(T,2)*(60*sqrt(((1 + S)*(1 + 2*S))/((2 + T)*(3 + T)*(1 + 2*T)*(5 + 2*T))) + 38*S*sqrt(((1 + S)*(1 + 2*T))/((1 + 2*S)*(2 + T)*(3 + T)*(5 + 2*T))) + 8*sqrt(((1 + S)*(1 + 2*S)*(1 + 2*T)*(5 + 2*T))/((2 + T)*(3 + T))) - 2*sqrt(((1 + S)*(1 + 2*S)*(2 + T)*(1 + 2*T)*(5 + 2*T))/(3 + T))) - 3*(8*sqrt(((1 + S)*(1 + 2*S)*(1 + 2*T)*(5 + 2*T))/((2 + T)*(3 + T))) + sqrt(((1 + S)*(1 + 2*S)*(2 + T)*(1 + 2*T)*(5 + 2*T))/(3 + T)))))/sqrt(((1 + S)*(1 + 2*S)*(1 + T)*Power(2 + T,2)*(3 + T)*Power(5 + 2*T,3))/(1 + 2*T)) ;
+          case 112: return (30*(-40*S*sqrt(((1 + S)*(1 + 2*T))/((1 + 2*S)*(3 + T)*(5 + 2*T)*(7 + 2*T))) + 3*sqrt(((1 + S)*(1 + 2*S)*(5 + 2*T))/((3 + T)*(1 + 2*T)*(7 + 2*T))) + 4*sqrt(((1 + S)*(1 + 2*S)*(1 + 2*T)*(5 + 2*T))/((3 + T)*(7 + 2*T))) - 6*S*sqrt(((1 + S)*(5 + 2*T))/((1 + 2*S)*(21 + 55*T + 28*Power(T,2) + 4*Power(T,3))))) + T*(-1270*S*sqrt(((1 + S)*(1 + 2*T))/((1 + 2*S)*(3 + T)*(5 + 2*T)*(7 + 2*T))) + 79*sqrt(((1 + S)*(1 + 2*S)*(1 + 2*T)*(5 + 2*T))/((3 + T)*(7 + 2*T))) + T*(-526*S*sqrt(((1 + S)*(1 + 2*T))/((1 + 2*S)*(3 + T)*(5 + 2*T)*(7 + 2*T))) + 21*sqrt(((1 + S)*(1 + 2*S)*(1 + 2*T)*(5 + 2*T))/((3 + T)*(7 + 2*T))) + 2*T*(-4*S*(13 + T)*sqrt(((1 + S)*(1 + 2*T))/((1 + 2*S)*(3 + T)*(5 + 2*T)*(7 + 2*T))) + sqrt(((1 + S)*(1 + 2*S)*(1 + 2*T)*(5 + 2*T))/((3 + T)*(7 + 2*T)))))))/sqrt(((1 + S)*(1 + 2*S)*Power(2 + T,2)*(3 + T)*Power(5 + 2*T,3)*(7 + 2*T))/(1 + 2*T)) ;
+          case 113: return -(sqrt(6)/sqrt((1 + T)*(2 + T)*(1 + 2*T)*(3 + 2*T))) ;
+          case 114: return (sqrt(2)*(15*(3*sqrt((1 + S)/(3 + 2*T)) + sqrt((1 + S)*(3 + 2*T))) + T*(3*(65*sqrt((1 + S)/(3 + 2*T)) - 6*sqrt((1 + S)*(3 + 2*T))) + T*(5*(58*sqrt((1 + S)/(3 + 2*T)) - 9*sqrt((1 + S)*(3 + 2*T))) + 2*T*(90*sqrt((1 + S)/(3 + 2*T)) + 20*T*sqrt((1 + S)/(3 + 2*T)) - 9*sqrt((1 + S)*(3 + 2*T)))))))/(Power(2 + T,1.5)*(3 + T)*sqrt((1 + S)*(1 + T)*(3 + 2*T))*(5 + 2*T)) ;
+          case 115: return -1 ;
+          case 116: return -2*sqrt((-1 + Power(S,2))/(-1 + 4*Power(S,2))) ;
+          case 117: return sqrt(3)/sqrt(-1 + 4*Power(S,2)) ;
+          case 118: return -(sqrt(-3 + 4*S*(1 + S))/(1 + 2*S)) ;
+          case 119: return 2/(1 + 2*S) ;
+          case 120: return -2*sqrt((S*(2 + S))/(3 + 4*S*(2 + S))) ;
+          case 121: return sqrt(3)/sqrt(3 + 4*S*(2 + S)) ;
+          case 122: return -1 ;
+          case 123: return 1 ;
+          case 124: return sqrt((9 - 4*Power(T,2))/(1 - 4*Power(T,2))) ;
+          case 125: return -(1/sqrt((T*(1 + T)*(1 + 2*T))/(6 + 4*T))) ;
+          case 126: return (-2 + T + Power(T,2))/sqrt(((-1 + T)*T*(1 + T)*(2 + T)*Power(1 + 2*T,2))/(-3 + 4*T*(1 + T))) ;
+          case 127: return sqrt(6)/sqrt(T*(1 + T)*(-1 + 2*T)*(1 + 2*T)) ;
+          case 128: return -(((2 + T)*sqrt((-3 + 6*T)/(T*(2 + 5*T + 2*Power(T,2)))))/(1 + T)) ;
+          case 129: return ((2 + T)*(-1 + 2*T)*(5 + 2*T))/((1 + T)*sqrt(((2 + T)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T)*(5 + 2*T))/T)) ;
+          case 130: return 3/(1 + 3*T + 2*Power(T,2)) ;
+          case 131: return (sqrt(3)*T*(2*(-60*sqrt((3 + 2*T)/((1 + T)*(2 + T)*(5 + 2*T))) + sqrt((1 + T)*(2 + T)*(3 + 2*T)*(5 + 2*T))) + T*(-6*(43*sqrt((3 + 2*T)/((1 + T)*(2 + T)*(5 + 2*T))) + sqrt((1 + T)*(2 + T)*(3 + 2*T)*(5 + 2*T))) + T*(-9*sqrt((3 + 2*T)/((1 + T)*(2 + T)*(5 + 2*T))) - 20*sqrt((1 + T)*(2 + T)*(3 + 2*T)*(5 + 2*T)) + 3*T*sqrt((3 + 2*T)/((1 + T)*(2 + T)*(5 + 2*T)))*(95 + 4*T*(16 + 3*T))))))/((1 + T)*Power(2 + T,2)*sqrt(T*(1 + T)*(1 + 2*T)*(3 + 2*T))*(5 + 2*T)) ;
+          case 132: return (T*(3 + T))/sqrt(T*(1 + T)*(2 + T)*(3 + T)) ;
+          case 133: return sqrt(6)/sqrt((1 + T)*(2 + T)*(1 + 2*T)*(3 + 2*T)) ;
+          case 134: return -(sqrt(2)/sqrt((1 + T)*(2 + T))) ;
+          case 135: return 1 ;
+          case 136: return sqrt(((-1 + S + 2*Power(S,2))*(-3 + 4*T*(1 + T)))/(S*(1 + 2*S)))/(1 + 2*T) ;
+          case 137: return -(sqrt(((-1 + S + 2*Power(S,2))*(3 + 2*T))/((S + 2*Power(S,2))*(1 + 2*T)))/(1 + T)) ;
+          case 138: return sqrt(((-1 + S + 2*Power(S,2))*T*(2 + T))/(S*(1 + 2*S)))/(1 + T) ;
+          case 139: return 1/(sqrt((S*(1 + 2*S))/(-1 + S + 2*Power(S,2)))*(1 + 3*T + 2*Power(T,2))) ;
+          case 140: return -(1/(sqrt((S*(1 + 2*S))/(-1 + S + 2*Power(S,2)))*(1 + T))) ;
+          case 141: return 1/sqrt((S*(1 + 2*S))/(-1 + S + 2*Power(S,2))) ;
+          case 142: return -(sqrt((-3 + 4*T*(1 + T))/(S*(1 + 2*S)))/(1 + 2*T)) ;
+          case 143: return (sqrt(1 + 3/T - 2/(1 + 2*T))*(4*sqrt((S*(1 + S)*T*(-1 + 2*T))/((3 + 4*S*(2 + S))*(1 + T)*(1 + 2*T))) - sqrt((S*T*(-1 + 2*T))/((3 + 11*S + 12*Power(S,2) + 4*Power(S,3))*(1 + 3*T + 2*Power(T,2)))) + sqrt((Power(S,3)*T*(-1 + 2*T))/((3 + 11*S + 12*Power(S,2) + 4*Power(S,3))*(1 + 3*T + 2*Power(T,2)))) + 2*sqrt((Power(S,5)*T*(-1 + 2*T))/((3 + 11*S + 12*Power(S,2) + 4*Power(S,3))*(1 + 3*T + 2*Power(T,2))))))/(1 + S) ;
+          case 144: return (sqrt((1 + T)*(3 + 2*T))*((-2*Power(S*(1 + S)*T,1.5)*Power(1 + T,2)*(-1 + 2*T))/sqrt((1 + 2*S)*(1 + T)*(1 + 2*T)) - (2*Power(1 + S,1.5)*(-1 + 2*S)*Power(T,2.5)*Power(1 + T,2))/sqrt(((1 + 2*S)*(1 + T)*(1 + 2*T))/S) + ((-1 + 2*S)*Power((1 + S)*T,1.5)*Power(1 + T,2)*(-1 + 2*T))/sqrt(((1 + 2*S)*(1 + T)*(1 + 2*T))/S) + 4*S*T*sqrt((S*Power(1 + S,3)*Power(T + Power(T,2),3))/((1 + 2*S)*(1 + 2*T)))))/(S*Power((1 + S)*T,1.5)*Power(1 + T,3)) ;
+          case 145: return (-2*T*(1 + T)*sqrt((1 + S)*T*(1 + T)) - sqrt((1 + S)*Power(T,5)*(1 + T)) - sqrt((1 + S)*Power(T,7)*(1 + T)) + 2*S*(-(T*(1 + T)*sqrt((1 + S)*T*(1 + T))) + sqrt((1 + S)*Power(T,3)*(1 + T)) + sqrt((1 + S)*Power(T,5)*(1 + T))))/(T*Power(1 + T,2.5)*sqrt(S*(1 + S)*(1 + 2*S)*(2 + T))) ;
+          case 146: return (-3*sqrt(S*(1 + S)*(1 + 2*S)*(3 + 2*S)*T*(1 + T)*(1 + 2*T)) - 2*sqrt(Power(S,3)*(1 + S)*(1 + 2*S)*(3 + 2*S)*T*(1 + T)*(1 + 2*T)))/((1 + S)*(3 + 4*S*(2 + S))*Power(1 + T,2)*(1 + 2*T)*sqrt(T/(3 + 5*T + 2*Power(T,2)))) ;
+          case 147: return (6*sqrt(S*T*(3 + 2*T)) - 3*sqrt(S*Power(T,3)*(3 + 2*T)) + sqrt(S*T*(3 + 2*T))*(2*S*(1 + T)*(2 + T) + 3*T*(4 + T)))/(Power(1 + T,2)*sqrt((1 + S)*(3 + 4*S*(2 + S))*(2 + T)*(3 + 2*T))) ;
+          case 148: return -(1/(sqrt(S*(1 + 2*S))*(1 + T)*(1 + 2*T))) ;
+          case 149: return 1/(sqrt(S*(1 + 2*S))*(1 + T)) ;
+          case 150: return -(1/sqrt(S*(1 + 2*S))) ;
+          case 151: return (3*sqrt(S*(1 + S)*(1 + T)*(1 + 2*T)) + 2*sqrt(Power(S,3)*(1 + S)*(1 + T)*(1 + 2*T)) + T*(-6*sqrt((S*(1 + S)*(1 + 2*T))/(1 + T)) - 4*sqrt((Power(S,3)*(1 + S)*(1 + 2*T))/(1 + T)) - 3*sqrt((S*(1 + S))/(1 + 3*T + 2*Power(T,2))) + 6*T*sqrt((S*(1 + S))/(1 + 3*T + 2*Power(T,2))) - 2*sqrt((Power(S,3)*(1 + S))/(1 + 3*T + 2*Power(T,2))) + 4*T*sqrt((Power(S,3)*(1 + S))/(1 + 3*T + 2*Power(T,2)))))/((1 + S)*sqrt((3 + 4*S*(2 + S))*(1 + T)*(1 + 2*T))) ;
+          case 152: return (-3*sqrt(S*(2 + T)) - 2*sqrt(Power(S,3)*(2 + T)))/((1 + S)*(1 + T)*sqrt(((3 + 4*S*(2 + S))*(2 + T))/(1 + S))) ;
+          case 153: return (27*sqrt((S*(1 + S))/(1 + T)) + 18*sqrt((Power(S,3)*(1 + S))/(1 + T)) + 3*sqrt(S*(1 + S)*(1 + T)) + 2*sqrt(Power(S,3)*(1 + S)*(1 + T)) + 2*T*(9*sqrt((S*(1 + S))/(1 + T)) + 6*sqrt((Power(S,3)*(1 + S))/(1 + T)) + 3*sqrt(S*(1 + S)*(1 + T)) + 2*sqrt(Power(S,3)*(1 + S)*(1 + T))))/((1 + S)*sqrt((3 + 4*S*(2 + S))/(1 + T))*(2 + T)*(5 + 2*T)) ;
+          case 154: return (4*S*sqrt(((1 + S)*(-3 + 4*T*(1 + T)))/(1 + 2*S)) - 3*sqrt((1 + S)*(1 + 2*S)*(-3 + 4*T*(1 + T))))/((1 + S)*(3 + 2*S)*(1 + 2*T)) ;
+          case 155: return sqrt(-3 + 4*T*(1 + T))/(1 + 2*T) ;
+          case 156: return 1/((1 + T)*sqrt(((1 + S)*(1 + 2*S)*(1 + 2*T))/(3 + 2*T))) ;
+          case 157: return -(sqrt((T*(2 + T))/(1 + 3*S + 2*Power(S,2)))/(1 + T)) ;
+          case 158: return -(sqrt(3 + 4*T*(2 + T))/((1 + T)*(1 + 2*T))) ;
+          case 159: return sqrt(T*(2 + T))/(1 + T) ;
+          case 160: return -(1/(sqrt(1 + 3*S + 2*Power(S,2))*(1 + 3*T + 2*Power(T,2)))) ;
+          case 161: return 1/(sqrt((1 + S)*(1 + 2*S))*(1 + T)) ;
+          case 162: return -(1/sqrt((1 + S)*(1 + 2*S))) ;
+          case 163: return 1/(1 + 3*T + 2*Power(T,2)) ;
+          case 164: return -(1/(1 + T)) ;
+          case 165: return 1 ;
+          case 166: return (-2*sqrt(S*(1 + S)*(-3 + 4*T*(1 + T))))/((1 + 2*S)*(1 + 2*T)) ;
+          case 167: return (2*sqrt((S*(1 + S)*(3 + 2*T))/(1 + 2*T)))/(1 + 2*S + T + 2*S*T) ;
+          case 168: return (-2*(2*sqrt((S*(1 + S)*T)/(2 + T)) + sqrt((S*(1 + S)*Power(T,3))/(2 + T))))/(1 + 2*S + T + 2*S*T) ;
+          case 169: return (-2*sqrt((S*(1 + S))/Power(1 + 2*S,2)))/(1 + 3*T + 2*Power(T,2)) ;
+          case 170: return (2*sqrt(S*(1 + S)))/(1 + 2*S + T + 2*S*T) ;
+          case 171: return (-2*sqrt(S*(1 + S)))/(1 + 2*S) ;
+          case 172: return sqrt(-3 + 4*T*(1 + T))/((1 + 2*S)*(1 + 2*T)) ;
+          case 173: return -(sqrt(-3 + 4*T*(1 + T))/(1 + 2*T)) ;
+          case 174: return (-2*Power(T,2)*sqrt(((1 + S)*T*(1 + T))/(1 + 2*T)) - sqrt(((1 + S)*Power(T,3))/(1 + 3*T + 2*Power(T,2))) + sqrt(((1 + S)*Power(T,5))/(1 + 3*T + 2*Power(T,2))) + 2*sqrt(((1 + S)*Power(T,7))/(1 + 3*T + 2*Power(T,2))))/((1 + 2*S)*Power(T,1.5)*Power(1 + T,2)*sqrt((1 + S)/(3 + 5*T + 2*Power(T,2)))) ;
+          case 175: return (T*sqrt(((1 + S)*T*(3 + 2*T))/(1 + 2*S))*(-1 + Power(T,2)) + 3*(sqrt(((1 + S)*Power(T,3)*(3 + 2*T))/(1 + 2*S)) + sqrt(((1 + S)*Power(T,5)*(3 + 2*T))/(1 + 2*S))) - 2*S*(T*sqrt(((1 + S)*T*(3 + 2*T))/Power(1 + 2*S,3))*(-1 + Power(T,2)) + 3*(sqrt(((1 + S)*Power(T,3)*(3 + 2*T))/Power(1 + 2*S,3)) + sqrt(((1 + S)*Power(T,5)*(3 + 2*T))/Power(1 + 2*S,3)))))/(T*Power(1 + T,2)*sqrt(((1 + S)*(2 + T)*(3 + 2*T))/(1 + 2*S))) ;
+          case 176: return (sqrt((1 + S)*T) + 2*sqrt((1 + S)*Power(T,3)) + sqrt((1 + S)*Power(T,5)))/(Power(1 + T,3)*sqrt(((1 + S)*T*(1 + 2*T))/(3 + 2*T))) ;
+          case 177: return -(((2 + T)*((-1 + T)*T*(2*sqrt((Power(1 + S,3)*(3 + 2*S)*T*Power(1 + T,5)*Power(3 + 2*T,2))/Power(1 + 2*S,3)) + sqrt((Power(1 + S,3)*(3 + 2*S)*T*Power(1 + T,5)*Power(3 + 2*T,2))/(1 + 2*S))) + 3*(2*sqrt((Power(1 + S,3)*(3 + 2*S)*Power(T,3)*Power(1 + T,5)*Power(3 + 2*T,2))/Power(1 + 2*S,3)) + sqrt((Power(1 + S,3)*(3 + 2*S)*Power(T,3)*Power(1 + T,5)*Power(3 + 2*T,2))/(1 + 2*S)))))/(T*Power(1 + T,3.5)*Power(((1 + S)*(3 + 2*S)*(2 + T))/(1 + 2*S),1.5)*(3 + 2*T))) ;
+          case 178: return 1/((1 + 2*S)*(1 + 3*T + 2*Power(T,2))) ;
+          case 179: return -(1/(1 + 2*S + T + 2*S*T)) ;
+          case 180: return 1/(1 + 2*S) ;
+          case 181: return 1/(-1 - 3*T - 2*Power(T,2)) ;
+          case 182: return 1/(1 + T) ;
+          case 183: return -1 ;
+          case 184: return 1 ;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(1, 2, 1));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(1, 2, 1));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -126,10 +2093,384 @@ MatrixElements<SC> SymmetryQST<SC>::recalc_doublet(const DiagInfo<SC> &diag, con
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "qst/qst-doubletm+1.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {2, 5},
+        {3, 2},
+        {3, 3},
+        {3, 5},
+        {3, 6},
+        {4, 2},
+        {4, 3},
+        {4, 4},
+        {4, 5},
+        {4, 6},
+        {4, 7},
+        {5, 5},
+        {6, 5},
+        {6, 6},
+        {7, 5},
+        {7, 6},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {10, 9},
+        {10, 10},
+        {11, 9},
+        {11, 10},
+        {11, 11},
+        {12, 10},
+        {12, 11},
+        {12, 12},
+        {13, 11},
+        {13, 12},
+        {13, 13},
+        {14, 14},
+        {14, 17},
+        {15, 14},
+        {15, 15},
+        {15, 17},
+        {15, 18},
+        {16, 14},
+        {16, 15},
+        {16, 16},
+        {16, 17},
+        {16, 18},
+        {16, 19},
+        {17, 17},
+        {17, 20},
+        {18, 17},
+        {18, 18},
+        {18, 20},
+        {18, 21},
+        {19, 17},
+        {19, 18},
+        {19, 19},
+        {19, 20},
+        {19, 21},
+        {19, 22},
+        {20, 20},
+        {21, 20},
+        {21, 21},
+        {22, 20},
+        {22, 21},
+        {22, 22},
+        {23, 23},
+        {23, 26},
+        {24, 23},
+        {24, 24},
+        {24, 26},
+        {24, 27},
+        {25, 23},
+        {25, 24},
+        {25, 25},
+        {25, 26},
+        {25, 27},
+        {25, 28},
+        {26, 26},
+        {27, 26},
+        {27, 27},
+        {28, 26},
+        {28, 27},
+        {28, 28},
+        {29, 29},
+        {29, 34},
+        {30, 29},
+        {30, 30},
+        {30, 34},
+        {30, 35},
+        {31, 29},
+        {31, 30},
+        {31, 31},
+        {31, 34},
+        {31, 35},
+        {31, 36},
+        {32, 30},
+        {32, 31},
+        {32, 32},
+        {32, 35},
+        {32, 36},
+        {32, 37},
+        {33, 31},
+        {33, 32},
+        {33, 33},
+        {33, 36},
+        {33, 37},
+        {33, 38},
+        {34, 34},
+        {35, 34},
+        {35, 35},
+        {36, 34},
+        {36, 35},
+        {36, 36},
+        {37, 35},
+        {37, 36},
+        {37, 37},
+        {38, 36},
+        {38, 37},
+        {38, 38},
+        {39, 39},
+        {39, 40},
+        {40, 40},
+        {40, 41},
+        {41, 41},
+        {41, 42},
+        {42, 42},
+        {43, 43},
+        {44, 44},
+        {45, 44},
+        {45, 45},
+        {46, 44},
+        {46, 45},
+        {46, 46},
+        {47, 45},
+        {47, 46},
+        {47, 47},
+        {48, 46},
+        {48, 47},
+        {48, 48},
+        {49, 49},
+        {49, 52},
+        {50, 49},
+        {50, 50},
+        {50, 52},
+        {50, 53},
+        {51, 49},
+        {51, 50},
+        {51, 51},
+        {51, 52},
+        {51, 53},
+        {51, 54},
+        {52, 52},
+        {52, 55},
+        {53, 52},
+        {53, 53},
+        {53, 55},
+        {53, 56},
+        {54, 52},
+        {54, 53},
+        {54, 54},
+        {54, 55},
+        {54, 56},
+        {54, 57},
+        {55, 55},
+        {56, 55},
+        {56, 56},
+        {57, 55},
+        {57, 56},
+        {57, 57},
+        {58, 58},
+        {58, 61},
+        {59, 58},
+        {59, 59},
+        {59, 61},
+        {59, 62},
+        {60, 58},
+        {60, 59},
+        {60, 60},
+        {60, 61},
+        {60, 62},
+        {60, 63},
+        {61, 61},
+        {62, 61},
+        {62, 62},
+        {63, 61},
+        {63, 62},
+        {63, 63},
+        {64, 64}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1 ;
+          case 1: return -(sqrt(-3 + 4*T*(1 + T))/(1 + 2*T)) ;
+          case 2: return -(sqrt(-3 + 4*T*(1 + T))/((1 + 2*S)*(1 + 2*T))) ;
+          case 3: return sqrt(1 + 2/(1 + 2*T))/(1 + T) ;
+          case 4: return -(sqrt(T*(2 + T))/(1 + T)) ;
+          case 5: return sqrt(1 + 2/(1 + 2*T))/((1 + 2*S)*(1 + T)) ;
+          case 6: return -(sqrt(T*(2 + T))/(1 + 2*S + T + 2*S*T)) ;
+          case 7: return -(1/(1 + 3*T + 2*Power(T,2))) ;
+          case 8: return 1/(1 + T) ;
+          case 9: return -1 ;
+          case 10: return -(1/((1 + 2*S)*(1 + 3*T + 2*Power(T,2)))) ;
+          case 11: return 1/(1 + 2*S + T + 2*S*T) ;
+          case 12: return 1/(-1 - 2*S) ;
+          case 13: return (-2*sqrt(S*(1 + S)*(-3 + 4*T*(1 + T))))/((1 + 2*S)*(1 + 2*T)) ;
+          case 14: return ((1 + 2*S)*sqrt(3 + 2*T)*(2*T*sqrt((S*Power(1 + S,3)*Power(T + Power(T,2),3))/(Power(1 + 2*S,4)*(1 + 2*T))) + 2*T*sqrt((S*Power(1 + S,3)*Power(T + Power(T,2),3))/(Power(1 + 2*S,2)*(1 + 2*T))) - ((1 + S)*T*Power(1 + T,2)*(-1 + 2*T)*sqrt((S*(1 + S)*T)/(1 + 3*T + 2*Power(T,2))))/Power(1 + 2*S,2) - ((1 + S)*T*Power(1 + T,2)*(-1 + 2*T)*sqrt((S*(1 + S)*T)/(1 + 3*T + 2*Power(T,2))))/(1 + 2*S)))/(Power(1 + S,2)*Power(T,1.5)*Power(1 + T,2.5)) ;
+          case 15: return (-2*sqrt(S*(1 + S)*T*(2 + T)))/(1 + 2*S + T + 2*S*T) ;
+          case 16: return (-2*sqrt(S*(1 + S)))/((1 + 2*S)*(1 + 3*T + 2*Power(T,2))) ;
+          case 17: return (2*sqrt(S*(1 + S)))/(1 + 2*S + T + 2*S*T) ;
+          case 18: return (-2*sqrt(S*(1 + S)))/(1 + 2*S) ;
+          case 19: return 1 ;
+          case 20: return sqrt((9 - 4*Power(T,2))/(1 - 4*Power(T,2))) ;
+          case 21: return -(1/sqrt((T*(1 + T)*(1 + 2*T))/(6 + 4*T))) ;
+          case 22: return (-2 + T + Power(T,2))/sqrt(((-1 + T)*T*(1 + T)*(2 + T)*Power(1 + 2*T,2))/(-3 + 4*T*(1 + T))) ;
+          case 23: return sqrt(6)/sqrt(T*(1 + T)*(-1 + 2*T)*(1 + 2*T)) ;
+          case 24: return -(((2 + T)*sqrt((-3 + 6*T)/(T*(2 + 5*T + 2*Power(T,2)))))/(1 + T)) ;
+          case 25: return ((2 + T)*(-1 + 2*T)*(5 + 2*T)*sqrt(T/(-30 - 47*T + 96*Power(T,2) + 184*Power(T,3) + 96*Power(T,4) + 16*Power(T,5))))/(1 + T) ;
+          case 26: return 3/(1 + 3*T + 2*Power(T,2)) ;
+          case 27: return -((sqrt(3)*T*(5 + 2*T))/((1 + T)*sqrt(T*(2 + T)*(1 + 2*T)*(5 + 2*T)))) ;
+          case 28: return sqrt((T*(3 + T))/(2 + 3*T + Power(T,2))) ;
+          case 29: return sqrt(6)/sqrt((1 + T)*(2 + T)*(1 + 2*T)*(3 + 2*T)) ;
+          case 30: return -(sqrt(2)/sqrt((1 + T)*(2 + T))) ;
+          case 31: return 1 ;
+          case 32: return sqrt(-3 + 4*T*(1 + T))/(1 + 2*T) ;
+          case 33: return sqrt((-3 + 4*T*(1 + T))/(S*(1 + 2*S)*Power(1 + 2*T,2))) ;
+          case 34: return -(sqrt(1 + 2/(1 + 2*T))/(1 + T)) ;
+          case 35: return sqrt(T*(2 + T))/(1 + T) ;
+          case 36: return -(sqrt((3 + 2*T)/((S + 2*Power(S,2))*(1 + 2*T)))/(1 + T)) ;
+          case 37: return sqrt((T*(2 + T))/(S*(1 + 2*S)))/(1 + T) ;
+          case 38: return 1/(1 + 3*T + 2*Power(T,2)) ;
+          case 39: return -(1/(1 + T)) ;
+          case 40: return 1 ;
+          case 41: return 1/(sqrt(S*(1 + 2*S))*(1 + 3*T + 2*Power(T,2))) ;
+          case 42: return -(1/(sqrt(S*(1 + 2*S))*(1 + T))) ;
+          case 43: return 1/sqrt(S*(1 + 2*S)) ;
+          case 44: return sqrt(((1 + T)*(3 + 2*T))/((1 + S)*T*(1 + 2*T)))*(sqrt(((2 - 1/S)*T*(-1 + 2*T))/((1 + 2*S)*(1 + 3*T + 2*Power(T,2)))) - sqrt((S*T*(-1 + 2*T))/((-1 + 4*Power(S,2))*(1 + 3*T + 2*Power(T,2)))) + 2*S*sqrt((S*T*(-1 + 2*T))/((-1 + 4*Power(S,2))*(1 + 3*T + 2*Power(T,2))))) ;
+          case 45: return sqrt((-3 + 4*T*(1 + T))/((1 + S)*(1 + 2*S)*Power(1 + 2*T,2))) ;
+          case 46: return (sqrt(3 + 2*T)*(-2*T*sqrt((Power(S,5)*(1 + S)*T*(1 + T))/((-1 + 4*Power(S,2))*(1 + 2*T))) + sqrt((Power(S,3)*(1 + S)*Power(T,3)*(1 + T))/((-1 + 4*Power(S,2))*(1 + 2*T))) - 2*sqrt((S*(-1 + S + 2*Power(S,2))*Power(T,5)*(1 + T))/((1 + 2*S)*(1 + 2*T))) - sqrt((S*(-1 + S + 2*Power(S,2))*Power(T,3))/((1 + 2*S)*(1 + 3*T + 2*Power(T,2)))) + sqrt((S*(-1 + S + 2*Power(S,2))*Power(T,5))/((1 + 2*S)*(1 + 3*T + 2*Power(T,2)))) + 2*sqrt((S*(-1 + S + 2*Power(S,2))*Power(T,7))/((1 + 2*S)*(1 + 3*T + 2*Power(T,2))))))/(S*(1 + S)*Power(T*(1 + T),1.5)) ;
+          case 47: return ((-1 + T)*T*(S*(-1 + 2*S)*sqrt(S*Power(1 + S,3)*(1 + 2*S)*T*Power(1 + T,4)*(2 + T)) + sqrt(Power(1 - 2*S,2)*S*Power(1 + S,3)*(1 + 2*S)*T*Power(1 + T,4)*(2 + T))) + 3*(S*(-1 + 2*S)*sqrt(S*Power(1 + S,3)*(1 + 2*S)*Power(T,3)*Power(1 + T,4)*(2 + T)) + sqrt(Power(1 - 2*S,2)*S*Power(1 + S,3)*(1 + 2*S)*Power(T,3)*Power(1 + T,4)*(2 + T))))/(S*Power(1 + S,2)*sqrt(-1 + 2*S)*(1 + 2*S)*T*Power(1 + T,3)*(2 + T)) ;
+          case 48: return -(1/((1 + T)*sqrt(((1 + S)*(1 + 2*S)*(1 + 2*T))/(3 + 2*T)))) ;
+          case 49: return (2*sqrt(T*(3 + 2*T)) + sqrt(Power(T,3)*(3 + 2*T)))/((1 + T)*sqrt((1 + S)*(1 + 2*S)*(2 + T)*(3 + 2*T))) ;
+          case 50: return (-1 + S + 2*Power(S,2))/(sqrt(S*(1 + S)*(-1 + 2*S)*(1 + 2*S))*(1 + T)*(1 + 2*T)) ;
+          case 51: return -(((1 + S)*(-1 + 2*S))/(sqrt(S*(1 + S)*(-1 + 2*S)*(1 + 2*S))*(1 + T))) ;
+          case 52: return (-1 + S + 2*Power(S,2))/sqrt(S*(1 + S)*(-1 + 2*S)*(1 + 2*S)) ;
+          case 53: return 1/(sqrt(1 + 3*S + 2*Power(S,2))*(1 + 3*T + 2*Power(T,2))) ;
+          case 54: return -(1/(sqrt((1 + S)*(1 + 2*S))*(1 + T))) ;
+          case 55: return 1/sqrt((1 + S)*(1 + 2*S)) ;
+          case 56: return (3 + 2*S)*sqrt((S*(-3 + 4*T*(1 + T)))/((1 + S)*(1 + 2*S)*(3 + 2*S)*Power(1 + 2*T,2))) ;
+          case 57: return -(((1 + S)*sqrt((S*(1 + 2*S)*T)/(1 + 2*T)) + S*(1 + S)*sqrt((S*(1 + 2*S)*T)/(1 + 2*T)) + 2*(1 + S)*sqrt((S*(1 + 2*S)*Power(T,3))/(1 + 2*T)) + 4*Power(S,1.5)*(1 - 2*T)*sqrt(T/(1 + 2*S + 2*T + 4*S*T)) + 2*Power(S,2.5)*(1 - 2*T)*sqrt(T/(1 + 2*S + 2*T + 4*S*T)) + 2*(1 - 2*T)*sqrt((S*T)/(1 + 2*S + 2*T + 4*S*T)) + 2*(1 + S)*sqrt((S*Power(T,3))/(1 + 2*S + 2*T + 4*S*T)))/(Power(1 + S,2)*sqrt(((1 + S)*(3 + 2*S)*T*Power(1 + T,2))/(3 + 2*T)))) ;
+          case 58: return (4*sqrt((S*T*(1 + T)*(3 + 2*T))/(1 + S)) + 2*T*sqrt((S*T*(1 + T)*(3 + 2*T))/(1 + S)) + 2*sqrt(S*(1 + S)*T*(1 + T)*(3 + 2*T)) + sqrt(S*(1 + S)*Power(T,3)*(1 + T)*(3 + 2*T)) + 2*S*(2*sqrt((S*T*(1 + T)*(3 + 2*T))/(1 + S)) + T*sqrt((S*T*(1 + T)*(3 + 2*T))/(1 + S)) + 2*sqrt(S*(1 + S)*T*(1 + T)*(3 + 2*T)) + sqrt(S*(1 + S)*Power(T,3)*(1 + T)*(3 + 2*T))))/sqrt(Power(1 + S,2)*(3 + 4*S*(2 + S))*Power(1 + T,3)*(2 + T)*(3 + 2*T)) ;
+          case 59: return (2*sqrt(S*(1 + 2*S)*(1 + T)) + S*(3 + 2*S)*sqrt(S*(1 + 2*S)*(1 + T)) + sqrt(S*Power(1 + 2*S,3)*(1 + T)*Power(1 + 2*T,2)) - T*(9*sqrt((S*(1 + 2*S))/(1 + T)) + 15*sqrt((Power(S,3)*(1 + 2*S))/(1 + T)) + 6*sqrt((Power(S,5)*(1 + 2*S))/(1 + T)) - 4*sqrt(S*(1 + 2*S)*(1 + T)) - 2*S*(3 + 2*S)*sqrt(S*(1 + 2*S)*(1 + T)) + 2*T*(3*sqrt((S*(1 + 2*S))/(1 + T)) + 5*sqrt((Power(S,3)*(1 + 2*S))/(1 + T)) + 2*sqrt((Power(S,5)*(1 + 2*S))/(1 + T)))))/(Power(1 + S,1.5)*(1 + 2*S)*sqrt((3 + 2*S)*(1 + T))*(1 + 2*T)) ;
+          case 60: return ((3 + 2*S)*(-2*(1 + S)*(3 + 2*S)*sqrt(S*(1 + 2*S)*(2 + T)) + 3*Power(T,2)*(3*sqrt((S*(1 + 2*S))/(2 + T)) + 5*S*sqrt((S*(1 + 2*S))/(2 + T)) + 2*sqrt((Power(S,5)*(1 + 2*S))/(2 + T))) + 2*T*(9*sqrt((S*(1 + 2*S))/(2 + T)) + 6*sqrt((Power(S,5)*(1 + 2*S))/(2 + T)) - 6*sqrt(S*(1 + 2*S)*(2 + T)) + S*(15*sqrt((S*(1 + 2*S))/(2 + T)) - 10*sqrt(S*(1 + 2*S)*(2 + T)) - 4*S*sqrt(S*(1 + 2*S)*(2 + T))))))/((1 + 2*S)*(1 + T)*Power((1 + S)*(3 + 2*S)*(2 + T),1.5)) ;
+          case 61: return sqrt(1 + 1/(1 + S) - 2/(1 + 2*S)) ;
+          case 62: return -(sqrt(-3 + 4*T*(1 + T))/(1 + 2*T)) ;
+          case 63: return -(sqrt(-3 + 4*T*(1 + T))/((1 + 2*S)*(1 + 2*T))) ;
+          case 64: return sqrt(1 + 2/(1 + 2*T))/(1 + T) ;
+          case 65: return -(sqrt(T*(2 + T))/(1 + T)) ;
+          case 66: return sqrt(1 + 2/(1 + 2*T))/((1 + 2*S)*(1 + T)) ;
+          case 67: return -(sqrt(T*(2 + T))/(1 + 2*S + T + 2*S*T)) ;
+          case 68: return -(1/(1 + 3*T + 2*Power(T,2))) ;
+          case 69: return 1/(1 + T) ;
+          case 70: return -1 ;
+          case 71: return -(1/((1 + 2*S)*(1 + 3*T + 2*Power(T,2)))) ;
+          case 72: return 1/(1 + 2*S + T + 2*S*T) ;
+          case 73: return 1/(-1 - 2*S) ;
+          case 74: return (-2*sqrt(S*(1 + S)*(-3 + 4*T*(1 + T))))/((1 + 2*S)*(1 + 2*T)) ;
+          case 75: return ((1 + 2*S)*sqrt(3 + 2*T)*(2*T*sqrt((S*Power(1 + S,3)*Power(T + Power(T,2),3))/(Power(1 + 2*S,4)*(1 + 2*T))) + 2*T*sqrt((S*Power(1 + S,3)*Power(T + Power(T,2),3))/(Power(1 + 2*S,2)*(1 + 2*T))) - ((1 + S)*T*Power(1 + T,2)*(-1 + 2*T)*sqrt((S*(1 + S)*T)/(1 + 3*T + 2*Power(T,2))))/Power(1 + 2*S,2) - ((1 + S)*T*Power(1 + T,2)*(-1 + 2*T)*sqrt((S*(1 + S)*T)/(1 + 3*T + 2*Power(T,2))))/(1 + 2*S)))/(Power(1 + S,2)*Power(T,1.5)*Power(1 + T,2.5)) ;
+          case 76: return (-2*sqrt(S*(1 + S)*T*(2 + T)))/(1 + 2*S + T + 2*S*T) ;
+          case 77: return (-2*sqrt(S*(1 + S)))/((1 + 2*S)*(1 + 3*T + 2*Power(T,2))) ;
+          case 78: return (2*sqrt(S*(1 + S)))/(1 + 2*S + T + 2*S*T) ;
+          case 79: return (-2*sqrt(S*(1 + S)))/(1 + 2*S) ;
+          case 80: return -sqrt((9 - 4*Power(T,2))/(1 - 4*Power(T,2))) ;
+          case 81: return -(sqrt((9 - 4*Power(T,2))/(1 - 4*Power(T,2)))/(1 + 2*S)) ;
+          case 82: return 1/sqrt((T*(1 + T)*(1 + 2*T))/(6 + 4*T)) ;
+          case 83: return -(((-1 + T)*(2 + T))/sqrt(((-1 + T)*T*(1 + T)*(2 + T)*Power(1 + 2*T,2))/(-3 + 4*T*(1 + T)))) ;
+          case 84: return sqrt((6 + 4*T)/(T + 3*Power(T,2) + 2*Power(T,3)))/(1 + 2*S) ;
+          case 85: return -(sqrt((3 + 2*T)/((1 + 2*S)*(T + 2*Power(T,2))))*(6*sqrt((1 - 3*T + 2*Power(T,2))/((1 + 2*S)*(2 + 7*T + 7*Power(T,2) + 2*Power(T,3)))) + 4*sqrt((-1 + 2*T)/((1 + 2*S)*(-2 - 5*T + 5*Power(T,3) + 2*Power(T,4)))) + (-5 + T)*T*sqrt((-1 + 2*T)/((1 + 2*S)*(-2 - 5*T + 5*Power(T,3) + 2*Power(T,4)))))) ;
+          case 86: return -(sqrt(6)/sqrt(T*(1 + T)*(-1 + 2*T)*(1 + 2*T))) ;
+          case 87: return ((2 + T)*sqrt((-3 + 6*T)/(T*(2 + 5*T + 2*Power(T,2)))))/(1 + T) ;
+          case 88: return -(((2 + T)*(-1 + 2*T)*(5 + 2*T)*sqrt(T/(-30 - 47*T + 96*Power(T,2) + 184*Power(T,3) + 96*Power(T,4) + 16*Power(T,5))))/(1 + T)) ;
+          case 89: return -(sqrt(6)/((1 + 2*S)*sqrt(T*(1 + T)*(-1 + 2*T)*(1 + 2*T)))) ;
+          case 90: return (sqrt(3)*(2 + T)*(-1 + 2*T))/((1 + 2*S)*(1 + T)*sqrt(T*(2 + T)*(-1 + 2*T)*(1 + 2*T))) ;
+          case 91: return -(((2 + T)*(-1 + 2*T)*(5 + 2*T)*sqrt(T/(-30 - 47*T + 96*Power(T,2) + 184*Power(T,3) + 96*Power(T,4) + 16*Power(T,5))))/((1 + 2*S)*(1 + T))) ;
+          case 92: return -3/(1 + 3*T + 2*Power(T,2)) ;
+          case 93: return (sqrt(3)*T*(5 + 2*T))/((1 + T)*sqrt(T*(2 + T)*(1 + 2*T)*(5 + 2*T))) ;
+          case 94: return -sqrt((T*(3 + T))/(2 + 3*T + Power(T,2))) ;
+          case 95: return -3/((1 + 2*S)*(1 + 3*T + 2*Power(T,2))) ;
+          case 96: return (sqrt(3)*T*(5 + 2*T))/((1 + 2*S)*(1 + T)*sqrt(T*(2 + T)*(1 + 2*T)*(5 + 2*T))) ;
+          case 97: return -((sqrt(1 + 1/(2 + T) - 6/(5 + 2*T))*(30*sqrt((1 + 2*S)*T*(3 + T)*(3 + 2*T)*(5 + 2*T)) + 63*sqrt((1 + 2*S)*Power(T,3)*(3 + T)*(3 + 2*T)*(5 + 2*T)) + 18*sqrt((1 + 2*S)*Power(T,5)*(3 + T)*(3 + 2*T)*(5 + 2*T)) + T*sqrt((1 + 2*S)*T*(3 + T)*(3 + 2*T)*(5 + 2*T))*(-26 + T*(-3 + 2*T))))/(Power(1 + 2*S,1.5)*(1 + T)*(2 + T)*(3 + T)*(3 + 2*T)*(5 + 2*T))) ;
+          case 98: return -(sqrt(6)/sqrt((1 + T)*(2 + T)*(1 + 2*T)*(3 + 2*T))) ;
+          case 99: return sqrt(2)/sqrt((1 + T)*(2 + T)) ;
+          case 100: return -1 ;
+          case 101: return -(sqrt(6)/((1 + 2*S)*sqrt((1 + T)*(2 + T)*(3 + 4*T*(2 + T))))) ;
+          case 102: return sqrt(2)/((1 + 2*S)*sqrt((1 + T)*(2 + T))) ;
+          case 103: return 1/(-1 - 2*S) ;
+          case 104: return (-2*sqrt((S*(1 + S)*(-9 + 4*Power(T,2)))/(-1 + 4*Power(T,2))))/(1 + 2*S) ;
+          case 105: return (2*sqrt(2)*(sqrt(-((S*(1 + S))/(T - 4*Power(T,3)))) + sqrt(-((Power(S,3)*(1 + S))/(T - 4*Power(T,3)))))*sqrt(-3 + T*(1 + 4*T*(2 + T))))/((1 + S)*(1 + 2*S)*(1 + T)) ;
+          case 106: return -((sqrt(((1 + 2*S)*(1 + T)*(3 + 2*T))/(T*(1 + 2*T)))*(6*sqrt((S*(1 + S)*(-1 + T)*(-1 + 2*T))/(Power(1 + 2*S,3)*(2 + T)*(1 + 2*T))) + 6*sqrt((S*(1 + S)*(-1 + T)*(-1 + 2*T))/((1 + 2*S)*(2 + T)*(1 + 2*T))) + (2*(1 + S)*(-5 + T)*T*sqrt((S*(1 + S)*(-1 + 2*T))/((1 + 2*S)*(-1 + T)*(2 + 5*T + 2*Power(T,2)))))/(1 + 2*S) + 4*sqrt((S*(1 + S)*(-1 + 2*T))/(Power(1 + 2*S,3)*(-2 - 3*T + 3*Power(T,2) + 2*Power(T,3)))) + 4*sqrt((S*(1 + S)*(-1 + 2*T))/((1 + 2*S)*(-2 - 3*T + 3*Power(T,2) + 2*Power(T,3))))))/((1 + S)*(1 + T))) ;
+          case 107: return (-2*sqrt(6)*(1 + S))/sqrt(((1 + S)*Power(1 + 2*S,2)*T*(1 + T)*(-1 + 2*T)*(1 + 2*T))/S) ;
+          case 108: return -(sqrt(3)*sqrt((1 + T)*(3 + 2*T))*(((-4 + T)*Power(-1 + 2*T,1.5))/((1 + 2*S)*(1 + T)*sqrt(((1 + S)*T*(1 + T)*(2 + T)*(1 + 2*T)*(3 + 2*T))/S)) + (-4 + T)*(-1 + 2*T)*sqrt((S*(-1 + 2*T))/((1 + S)*T*Power(1 + T,3)*(6 + 19*T + 16*Power(T,2) + 4*Power(T,3)))) + 6*sqrt((S*Power(-1 + T,2)*(-1 + 2*T))/((1 + S)*T*Power(1 + T,3)*(6 + 19*T + 16*Power(T,2) + 4*Power(T,3)))) + 6*sqrt((S*Power(-1 + T,2)*(-1 + 2*T))/((1 + S)*Power(1 + 2*S,2)*T*Power(1 + T,3)*(6 + 19*T + 16*Power(T,2) + 4*Power(T,3)))) - 2*(-1 + T)*T*(-1 + 2*T)*sqrt(S/((1 + S)*T*Power(1 + T,3)*(-6 - 7*T + 22*Power(T,2) + 28*Power(T,3) + 8*Power(T,4)))) - 2*(-1 + T)*T*(-1 + 2*T)*sqrt(S/((1 + S)*Power(1 + 2*S,2)*T*Power(1 + T,3)*(-6 - 7*T + 22*Power(T,2) + 28*Power(T,3) + 8*Power(T,4)))))) ;
+          case 109: return (-27*sqrt((S*T)/((1 + 2*S)*(-1 + 2*T))) - 26*sqrt((S*(1 + 2*S)*T)/(-1 + 2*T)) + 72*sqrt((S*Power(T,3))/((1 + 2*S)*(-1 + 2*T))) + 61*sqrt((S*(1 + 2*S)*Power(T,3))/(-1 + 2*T)) - 36*sqrt((S*Power(T,5))/((1 + 2*S)*(-1 + 2*T))) - 16*sqrt((S*(1 + 2*S)*Power(T,5))/(-1 + 2*T)) - 4*sqrt((S*(1 + 2*S)*Power(T,7))/(-1 + 2*T)) - 36*sqrt((S*T*(-1 + 2*T))/(1 + 2*S)) - 36*sqrt(S*(1 + 2*S)*T*(-1 + 2*T)) + T*sqrt(S/((1 + 2*S)*T*(-1 + 2*T)))*(1 + T*(-11 - 4*(-5 + T)*T)))/((1 + T)*sqrt((1 + S)*(1 + 2*S)*(2 + T)*(1 + 2*T)*(3 + 2*T)*(5 + 2*T))) ;
+          case 110: return (-6*sqrt(S*(1 + S)))/((1 + 2*S)*(1 + 3*T + 2*Power(T,2))) ;
+          case 111: return (2*sqrt(3)*sqrt((S*(1 + S))/(5 + 12*T + 4*Power(T,2)))*(10*sqrt(T*(2 + T)) + 9*sqrt(Power(T,3)*(2 + T)) + 2*sqrt(Power(T,5)*(2 + T))))/((1 + 2*S)*(1 + T)*Power(2 + T,2)) ;
+          case 112: return (-2*S*(1 + S)*T*(3 + T))/((1 + 2*S)*sqrt(S*(1 + S)*T*(1 + T)*(2 + T)*(3 + T))) ;
+          case 113: return (-2*sqrt(6)*(sqrt((S*(1 + S)*(1 + T))/(3 + 2*T)) + 3*sqrt(S*(1 + S)*(1 + T)*(3 + 2*T)) + T*(-7*sqrt((S*(1 + S)*(1 + T))/(3 + 2*T)) + 5*sqrt(S*(1 + S)*(1 + T)*(3 + 2*T)) - 15*sqrt((S*(1 + S))/(3 + 5*T + 2*Power(T,2))) - 2*T*(8*sqrt((S*(1 + S)*(1 + T))/(3 + 2*T)) + sqrt(S*(1 + S)*(1 + T)*(3 + 2*T))) + 4*Power(T,2)*(sqrt((S*(1 + S)*(1 + T))/(3 + 2*T)) + 3*sqrt((S*(1 + S))/(3 + 5*T + 2*Power(T,2)))))))/((1 + 2*S)*Power(2 + T,1.5)*sqrt(1 + 2*T)*(5 + 2*T)) ;
+          case 114: return (2*sqrt(2 + 4*T)*(15*(sqrt((S*(1 + S)*(1 + 2*T))/(1 + T)) + sqrt(S*(1 + S)*(1 + T)*(1 + 2*T))) - T*(18*sqrt((S*(1 + S)*(1 + 2*T))/(1 + T)) + 9*T*sqrt((S*(1 + S)*(1 + 2*T))/(1 + T)) - 10*sqrt(S*(1 + S)*(1 + T)*(1 + 2*T)) + 30*sqrt((S*(1 + S))/(1 + 3*T + 2*Power(T,2))))))/((1 + 2*S)*Power(2 + T,1.5)*(3 + T)*(5 + 2*T)) ;
+          case 115: return (-2*sqrt(S*(1 + S)))/(1 + 2*S) ;
+          case 116: return -1 ;
+          case 117: return -(sqrt(3)/sqrt(-1 + 4*Power(S,2))) ;
+          case 118: return (-2*(-1 + Power(S,2)))/sqrt(1 - 5*Power(S,2) + 4*Power(S,4)) ;
+          case 119: return -2/(1 + 2*S) ;
+          case 120: return (sqrt((Power(S,3)*(1 + S)*(1 + 2*S)*(3 + 2*S))/(-1 + 2*S)) - 2*sqrt((Power(S,5)*(1 + S)*(1 + 2*S)*(3 + 2*S))/(-1 + 2*S)) + 4*S*sqrt((S*(1 + S)*(3 + 2*S))/(-1 + 4*Power(S,2))) - 8*sqrt((Power(S,5)*(1 + S)*(3 + 2*S))/(-1 + 4*Power(S,2))) - 3*sqrt((S*(-3 + S*(1 + 4*S*(2 + S))))/(1 + 2*S)))/sqrt(S*Power(1 + S,3)*(1 + 2*S)*Power(3 + 2*S,2)) ;
+          case 121: return -((sqrt(3)*(3*sqrt(S*(1 + S)*(3 + 2*S)) + 5*sqrt(Power(S,3)*(1 + S)*(3 + 2*S)) + 2*sqrt(Power(S,5)*(1 + S)*(3 + 2*S))))/sqrt(S*Power(1 + S,3)*(1 + 2*S)*Power(3 + 2*S,4))) ;
+          case 122: return -2*(2 + S)*sqrt(S/(6 + 19*S + 16*Power(S,2) + 4*Power(S,3))) ;
+          case 123: return 1 ;
+          case 124: return sqrt((9 - 4*Power(T,2))/(1 - 4*Power(T,2))) ;
+          case 125: return -(1/sqrt((T*(1 + T)*(1 + 2*T))/(6 + 4*T))) ;
+          case 126: return (-2 + T + Power(T,2))/sqrt(((-1 + T)*T*(1 + T)*(2 + T)*Power(1 + 2*T,2))/(-3 + 4*T*(1 + T))) ;
+          case 127: return sqrt(6)/sqrt(T*(1 + T)*(-1 + 2*T)*(1 + 2*T)) ;
+          case 128: return -(((2 + T)*sqrt((-3 + 6*T)/(T*(2 + 5*T + 2*Power(T,2)))))/(1 + T)) ;
+          case 129: return ((2 + T)*(-1 + 2*T)*(5 + 2*T)*sqrt(T/(-30 - 47*T + 96*Power(T,2) + 184*Power(T,3) + 96*Power(T,4) + 16*Power(T,5))))/(1 + T) ;
+          case 130: return 3/(1 + 3*T + 2*Power(T,2)) ;
+          case 131: return -((sqrt(3)*T*(5 + 2*T))/((1 + T)*sqrt(T*(2 + T)*(1 + 2*T)*(5 + 2*T)))) ;
+          case 132: return sqrt((T*(3 + T))/(2 + 3*T + Power(T,2))) ;
+          case 133: return sqrt(6)/sqrt((1 + T)*(2 + T)*(1 + 2*T)*(3 + 2*T)) ;
+          case 134: return -(sqrt(2)/sqrt((1 + T)*(2 + T))) ;
+          case 135: return 1 ;
+          case 136: return sqrt(-3 + 4*T*(1 + T))/(1 + 2*T) ;
+          case 137: return sqrt((-3 + 4*T*(1 + T))/(S*(1 + 2*S)*Power(1 + 2*T,2))) ;
+          case 138: return -(sqrt(1 + 2/(1 + 2*T))/(1 + T)) ;
+          case 139: return sqrt(T*(2 + T))/(1 + T) ;
+          case 140: return -(sqrt((3 + 2*T)/((S + 2*Power(S,2))*(1 + 2*T)))/(1 + T)) ;
+          case 141: return sqrt((T*(2 + T))/(S*(1 + 2*S)))/(1 + T) ;
+          case 142: return 1/(1 + 3*T + 2*Power(T,2)) ;
+          case 143: return -(1/(1 + T)) ;
+          case 144: return 1 ;
+          case 145: return 1/(sqrt(S*(1 + 2*S))*(1 + 3*T + 2*Power(T,2))) ;
+          case 146: return -(1/(sqrt(S*(1 + 2*S))*(1 + T))) ;
+          case 147: return 1/sqrt(S*(1 + 2*S)) ;
+          case 148: return sqrt(((1 + T)*(3 + 2*T))/((1 + S)*T*(1 + 2*T)))*(sqrt(((2 - 1/S)*T*(-1 + 2*T))/((1 + 2*S)*(1 + 3*T + 2*Power(T,2)))) - sqrt((S*T*(-1 + 2*T))/((-1 + 4*Power(S,2))*(1 + 3*T + 2*Power(T,2)))) + 2*S*sqrt((S*T*(-1 + 2*T))/((-1 + 4*Power(S,2))*(1 + 3*T + 2*Power(T,2))))) ;
+          case 149: return sqrt((-3 + 4*T*(1 + T))/((1 + S)*(1 + 2*S)*Power(1 + 2*T,2))) ;
+          case 150: return (sqrt(3 + 2*T)*(-2*T*sqrt((Power(S,5)*(1 + S)*T*(1 + T))/((-1 + 4*Power(S,2))*(1 + 2*T))) + sqrt((Power(S,3)*(1 + S)*Power(T,3)*(1 + T))/((-1 + 4*Power(S,2))*(1 + 2*T))) - 2*sqrt((S*(-1 + S + 2*Power(S,2))*Power(T,5)*(1 + T))/((1 + 2*S)*(1 + 2*T))) - sqrt((S*(-1 + S + 2*Power(S,2))*Power(T,3))/((1 + 2*S)*(1 + 3*T + 2*Power(T,2)))) + sqrt((S*(-1 + S + 2*Power(S,2))*Power(T,5))/((1 + 2*S)*(1 + 3*T + 2*Power(T,2)))) + 2*sqrt((S*(-1 + S + 2*Power(S,2))*Power(T,7))/((1 + 2*S)*(1 + 3*T + 2*Power(T,2))))))/(S*(1 + S)*Power(T*(1 + T),1.5)) ;
+          case 151: return ((-1 + T)*T*(S*(-1 + 2*S)*sqrt(S*Power(1 + S,3)*(1 + 2*S)*T*Power(1 + T,4)*(2 + T)) + sqrt(Power(1 - 2*S,2)*S*Power(1 + S,3)*(1 + 2*S)*T*Power(1 + T,4)*(2 + T))) + 3*(S*(-1 + 2*S)*sqrt(S*Power(1 + S,3)*(1 + 2*S)*Power(T,3)*Power(1 + T,4)*(2 + T)) + sqrt(Power(1 - 2*S,2)*S*Power(1 + S,3)*(1 + 2*S)*Power(T,3)*Power(1 + T,4)*(2 + T))))/(S*Power(1 + S,2)*sqrt(-1 + 2*S)*(1 + 2*S)*T*Power(1 + T,3)*(2 + T)) ;
+          case 152: return -(1/((1 + T)*sqrt(((1 + S)*(1 + 2*S)*(1 + 2*T))/(3 + 2*T)))) ;
+          case 153: return (2*sqrt(T*(3 + 2*T)) + sqrt(Power(T,3)*(3 + 2*T)))/((1 + T)*sqrt((1 + S)*(1 + 2*S)*(2 + T)*(3 + 2*T))) ;
+          case 154: return (-1 + S + 2*Power(S,2))/(sqrt(S*(1 + S)*(-1 + 2*S)*(1 + 2*S))*(1 + T)*(1 + 2*T)) ;
+          case 155: return -(((1 + S)*(-1 + 2*S))/(sqrt(S*(1 + S)*(-1 + 2*S)*(1 + 2*S))*(1 + T))) ;
+          case 156: return (-1 + S + 2*Power(S,2))/sqrt(S*(1 + S)*(-1 + 2*S)*(1 + 2*S)) ;
+          case 157: return 1/(sqrt(1 + 3*S + 2*Power(S,2))*(1 + 3*T + 2*Power(T,2))) ;
+          case 158: return -(1/(sqrt((1 + S)*(1 + 2*S))*(1 + T))) ;
+          case 159: return 1/sqrt((1 + S)*(1 + 2*S)) ;
+          case 160: return (3 + 2*S)*sqrt((S*(-3 + 4*T*(1 + T)))/((1 + S)*(1 + 2*S)*(3 + 2*S)*Power(1 + 2*T,2))) ;
+          case 161: return -(((1 + S)*sqrt((S*(1 + 2*S)*T)/(1 + 2*T)) + S*(1 + S)*sqrt((S*(1 + 2*S)*T)/(1 + 2*T)) + 2*(1 + S)*sqrt((S*(1 + 2*S)*Power(T,3))/(1 + 2*T)) + 4*Power(S,1.5)*(1 - 2*T)*sqrt(T/(1 + 2*S + 2*T + 4*S*T)) + 2*Power(S,2.5)*(1 - 2*T)*sqrt(T/(1 + 2*S + 2*T + 4*S*T)) + 2*(1 - 2*T)*sqrt((S*T)/(1 + 2*S + 2*T + 4*S*T)) + 2*(1 + S)*sqrt((S*Power(T,3))/(1 + 2*S + 2*T + 4*S*T)))/(Power(1 + S,2)*sqrt(((1 + S)*(3 + 2*S)*T*Power(1 + T,2))/(3 + 2*T)))) ;
+          case 162: return (4*sqrt((S*T*(1 + T)*(3 + 2*T))/(1 + S)) + 2*T*sqrt((S*T*(1 + T)*(3 + 2*T))/(1 + S)) + 2*sqrt(S*(1 + S)*T*(1 + T)*(3 + 2*T)) + sqrt(S*(1 + S)*Power(T,3)*(1 + T)*(3 + 2*T)) + 2*S*(2*sqrt((S*T*(1 + T)*(3 + 2*T))/(1 + S)) + T*sqrt((S*T*(1 + T)*(3 + 2*T))/(1 + S)) + 2*sqrt(S*(1 + S)*T*(1 + T)*(3 + 2*T)) + sqrt(S*(1 + S)*Power(T,3)*(1 + T)*(3 + 2*T))))/sqrt(Power(1 + S,2)*(3 + 4*S*(2 + S))*Power(1 + T,3)*(2 + T)*(3 + 2*T)) ;
+          case 163: return (2*sqrt(S*(1 + 2*S)*(1 + T)) + S*(3 + 2*S)*sqrt(S*(1 + 2*S)*(1 + T)) + sqrt(S*Power(1 + 2*S,3)*(1 + T)*Power(1 + 2*T,2)) - T*(9*sqrt((S*(1 + 2*S))/(1 + T)) + 15*sqrt((Power(S,3)*(1 + 2*S))/(1 + T)) + 6*sqrt((Power(S,5)*(1 + 2*S))/(1 + T)) - 4*sqrt(S*(1 + 2*S)*(1 + T)) - 2*S*(3 + 2*S)*sqrt(S*(1 + 2*S)*(1 + T)) + 2*T*(3*sqrt((S*(1 + 2*S))/(1 + T)) + 5*sqrt((Power(S,3)*(1 + 2*S))/(1 + T)) + 2*sqrt((Power(S,5)*(1 + 2*S))/(1 + T)))))/(Power(1 + S,1.5)*(1 + 2*S)*sqrt((3 + 2*S)*(1 + T))*(1 + 2*T)) ;
+          case 164: return ((3 + 2*S)*(-2*(1 + S)*(3 + 2*S)*sqrt(S*(1 + 2*S)*(2 + T)) + 3*Power(T,2)*(3*sqrt((S*(1 + 2*S))/(2 + T)) + 5*S*sqrt((S*(1 + 2*S))/(2 + T)) + 2*sqrt((Power(S,5)*(1 + 2*S))/(2 + T))) + 2*T*(9*sqrt((S*(1 + 2*S))/(2 + T)) + 6*sqrt((Power(S,5)*(1 + 2*S))/(2 + T)) - 6*sqrt(S*(1 + 2*S)*(2 + T)) + S*(15*sqrt((S*(1 + 2*S))/(2 + T)) - 10*sqrt(S*(1 + 2*S)*(2 + T)) - 4*S*sqrt(S*(1 + 2*S)*(2 + T))))))/((1 + 2*S)*(1 + T)*Power((1 + S)*(3 + 2*S)*(2 + T),1.5)) ;
+          case 165: return sqrt(1 + 1/(1 + S) - 2/(1 + 2*S)) ;
+          case 166: return -(sqrt(-3 + 4*T*(1 + T))/(1 + 2*T)) ;
+          case 167: return -(sqrt(-3 + 4*T*(1 + T))/((1 + 2*S)*(1 + 2*T))) ;
+          case 168: return sqrt(1 + 2/(1 + 2*T))/(1 + T) ;
+          case 169: return -(sqrt(T*(2 + T))/(1 + T)) ;
+          case 170: return sqrt(1 + 2/(1 + 2*T))/((1 + 2*S)*(1 + T)) ;
+          case 171: return -(sqrt(T*(2 + T))/(1 + 2*S + T + 2*S*T)) ;
+          case 172: return -(1/(1 + 3*T + 2*Power(T,2))) ;
+          case 173: return 1/(1 + T) ;
+          case 174: return -1 ;
+          case 175: return -(1/((1 + 2*S)*(1 + 3*T + 2*Power(T,2)))) ;
+          case 176: return 1/(1 + 2*S + T + 2*S*T) ;
+          case 177: return 1/(-1 - 2*S) ;
+          case 178: return (-2*sqrt(S*(1 + S)*(-3 + 4*T*(1 + T))))/((1 + 2*S)*(1 + 2*T)) ;
+          case 179: return ((1 + 2*S)*sqrt(3 + 2*T)*(2*T*sqrt((S*Power(1 + S,3)*Power(T + Power(T,2),3))/(Power(1 + 2*S,4)*(1 + 2*T))) + 2*T*sqrt((S*Power(1 + S,3)*Power(T + Power(T,2),3))/(Power(1 + 2*S,2)*(1 + 2*T))) - ((1 + S)*T*Power(1 + T,2)*(-1 + 2*T)*sqrt((S*(1 + S)*T)/(1 + 3*T + 2*Power(T,2))))/Power(1 + 2*S,2) - ((1 + S)*T*Power(1 + T,2)*(-1 + 2*T)*sqrt((S*(1 + S)*T)/(1 + 3*T + 2*Power(T,2))))/(1 + 2*S)))/(Power(1 + S,2)*Power(T,1.5)*Power(1 + T,2.5)) ;
+          case 180: return (-2*sqrt(S*(1 + S)*T*(2 + T)))/(1 + 2*S + T + 2*S*T) ;
+          case 181: return (-2*sqrt(S*(1 + S)))/((1 + 2*S)*(1 + 3*T + 2*Power(T,2))) ;
+          case 182: return (2*sqrt(S*(1 + S)))/(1 + 2*S + T + 2*S*T) ;
+          case 183: return (-2*sqrt(S*(1 + S)))/(1 + 2*S) ;
+          case 184: return 1 ;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(1, 2, 1));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(1, 2, 1));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -249,6 +2590,7 @@ Opch<SC> SymmetryQST<SC>::recalc_irreduc(const Step &step, const DiagInfo<SC> &d
 template<typename SC>
 MatrixElements<SC> SymmetryQST<SC>::recalc_triplet(const DiagInfo<SC> &diag, const SubspaceStructure &substruct, const MatrixElements<SC> &cold) const {
   MatrixElements<SC> cnew;
+  const auto blocks = std::make_shared<const BlockIndex<SC>>(cold, substruct);
   for(const auto &[I1, eig]: diag) {
     int q1  = I1.get("Q");
     int ss1  = I1.get("SS");
@@ -263,10 +2605,258 @@ MatrixElements<SC> SymmetryQST<SC>::recalc_triplet(const DiagInfo<SC> &diag, con
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "qst/qst-triplets.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {2, 5},
+        {3, 3},
+        {3, 6},
+        {4, 4},
+        {4, 7},
+        {5, 2},
+        {5, 5},
+        {6, 3},
+        {6, 6},
+        {7, 4},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {10, 10},
+        {11, 11},
+        {12, 12},
+        {13, 13},
+        {14, 14},
+        {14, 17},
+        {15, 15},
+        {15, 18},
+        {16, 16},
+        {16, 19},
+        {17, 14},
+        {17, 17},
+        {17, 20},
+        {18, 15},
+        {18, 18},
+        {18, 21},
+        {19, 16},
+        {19, 19},
+        {19, 22},
+        {20, 17},
+        {20, 20},
+        {21, 18},
+        {21, 21},
+        {22, 19},
+        {22, 22},
+        {23, 23},
+        {23, 26},
+        {24, 24},
+        {24, 27},
+        {25, 25},
+        {25, 28},
+        {26, 23},
+        {26, 26},
+        {27, 24},
+        {27, 27},
+        {28, 25},
+        {28, 28},
+        {29, 29},
+        {29, 34},
+        {30, 30},
+        {30, 35},
+        {31, 31},
+        {31, 36},
+        {32, 32},
+        {32, 37},
+        {33, 33},
+        {33, 38},
+        {34, 29},
+        {34, 34},
+        {35, 30},
+        {35, 35},
+        {36, 31},
+        {36, 36},
+        {37, 32},
+        {37, 37},
+        {38, 33},
+        {38, 38},
+        {39, 39},
+        {39, 40},
+        {40, 39},
+        {40, 40},
+        {40, 41},
+        {41, 40},
+        {41, 41},
+        {41, 42},
+        {42, 41},
+        {42, 42},
+        {43, 43},
+        {44, 44},
+        {45, 45},
+        {46, 46},
+        {47, 47},
+        {48, 48},
+        {49, 49},
+        {49, 52},
+        {50, 50},
+        {50, 53},
+        {51, 51},
+        {51, 54},
+        {52, 49},
+        {52, 52},
+        {52, 55},
+        {53, 50},
+        {53, 53},
+        {53, 56},
+        {54, 51},
+        {54, 54},
+        {54, 57},
+        {55, 52},
+        {55, 55},
+        {56, 53},
+        {56, 56},
+        {57, 54},
+        {57, 57},
+        {58, 58},
+        {58, 61},
+        {59, 59},
+        {59, 62},
+        {60, 60},
+        {60, 63},
+        {61, 58},
+        {61, 61},
+        {62, 59},
+        {62, 62},
+        {63, 60},
+        {63, 63},
+        {64, 64}
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(0, 3, 0));
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1 ;
+          case 1: return 1/sqrt((S*(1 + 2*S))/(-1 + S + 2*Power(S,2))) ;
+          case 2: return 1/sqrt((1 + S)*(1 + 2*S)) ;
+          case 3: return 1/sqrt((S*(1 + 2*S))/(-1 + S + 2*Power(S,2))) ;
+          case 4: return 1/sqrt((1 + S)*(1 + 2*S)) ;
+          case 5: return (sqrt(((-1 + 2*S)*(1 + T)*Power(1 + 2*T,2))/(S*(3 + 2*T))) + sqrt((-1 + 2*S)/(S*(3 + 5*T + 2*Power(T,2)))) + sqrt(((-1 + 2*S)*Power(1 + 2*T,2))/(S*(3 + 5*T + 2*Power(T,2)))))/sqrt(((1 + 2*S)*(1 + T)*(3 + 2*T))/(1 + S)) ;
+          case 6: return 1/sqrt((1 + S)*(1 + 2*S)) ;
+          case 7: return -(1/sqrt(S*(1 + 2*S))) ;
+          case 8: return (3 + 2*S)*sqrt(S/(3 + 11*S + 12*Power(S,2) + 4*Power(S,3))) ;
+          case 9: return ((1 + 2*S)*(-sqrt((S*(1 + S)*Power(T,3))/Power(1 + 2*S,3)) + 2*S*sqrt((S*(1 + S)*Power(T,3))/Power(1 + 2*S,3)) - sqrt((S*(1 + S)*Power(T,3))/(1 + 2*S)) + sqrt((Power(1 - 2*S,2)*S*(1 + S)*Power(T,5))/Power(1 + 2*S,3)) - sqrt((S*(1 + S)*Power(T,5))/(1 + 2*S))))/(2.*S*sqrt(1 + S)*Power(T,1.5)*(1 + T)) ;
+          case 10: return (3*sqrt(S*T) + 4*S*sqrt(S*T) + 2*T*sqrt(S*T) + 2*S*Power(S*T,1.5) + sqrt(Power(S,3)*T) + 2*sqrt(Power(S,5)*T) + sqrt(S*Power(T,3)) + 5*S*sqrt(S*Power(T,3)))/((1 + S)*sqrt((1 + S)*(3 + 4*S*(2 + S))*T)*(1 + T)) ;
+          case 11: return -(1/sqrt(S*(1 + 2*S))) ;
+          case 12: return sqrt(1 + 1/(1 + S) - 2/(1 + 2*S)) ;
+          case 13: return 1 ;
+          case 14: return 1 ;
+          case 15: return 1 ;
+          case 16: return 1 ;
+          case 17: return 1 ;
+          case 18: return 1 ;
+          case 19: return sqrt(-1 + Power(S,2))/S ;
+          case 20: return (-1 + 2*S)/(S*sqrt(-1 + 4*Power(S,2))) ;
+          case 21: return sqrt(-1 + Power(S,2))/S ;
+          case 22: return sqrt(1 - 2/(1 + 2*S))/S ;
+          case 23: return sqrt((1 + S)/(3*S + 5*S*T + 2*S*Power(T,2)))*((1 + 2*T)*sqrt(((-1 + S)*(1 + T))/(S*(3 + 2*T))) + sqrt((-1 + S)/(S*(3 + 5*T + 2*Power(T,2)))) + (1 + 2*T)*sqrt((-1 + S)/(S*(3 + 5*T + 2*Power(T,2))))) ;
+          case 24: return sqrt((1 + S)/(S*(1 + 2*S)*(3 + 5*T + 2*Power(T,2))))*((1 + 2*T)*sqrt(((-1 + 2*S)*(1 + T))/((S + Power(S,2))*(3 + 2*T))) + sqrt((-1 + 2*S)/(S*(1 + S)*(3 + 5*T + 2*Power(T,2)))) + (1 + 2*T)*sqrt((-1 + 2*S)/(S*(1 + S)*(3 + 5*T + 2*Power(T,2))))) ;
+          case 25: return -(1/S) ;
+          case 26: return 1 - 1/S + 1/(1 + S) ;
+          case 27: return 1/(1 + S) ;
+          case 28: return -(1/S) ;
+          case 29: return 1 - 1/S + 1/(1 + S) ;
+          case 30: return 1/(1 + S) ;
+          case 31: return -(1/S) ;
+          case 32: return 1 - 1/S + 1/(1 + S) ;
+          case 33: return 1/(1 + S) ;
+          case 34: return -(sqrt(1 + 2/(1 + 2*S))/(1 + S)) ;
+          case 35: return sqrt(S*(2 + S))/(1 + S) ;
+          case 36: return -(sqrt(1 + 2/(1 + 2*S))/(1 + S)) ;
+          case 37: return sqrt(S*(2 + S))/(1 + S) ;
+          case 38: return -(sqrt(1 + 2/(1 + 2*S))/(1 + S)) ;
+          case 39: return sqrt(S*(2 + S))/(1 + S) ;
+          case 40: return 1/sqrt((S*(1 + 2*S))/(-1 + S + 2*Power(S,2))) ;
+          case 41: return 1/sqrt((1 + S)*(1 + 2*S)) ;
+          case 42: return 1/sqrt((S*(1 + 2*S))/(-1 + S + 2*Power(S,2))) ;
+          case 43: return 1/sqrt((1 + S)*(1 + 2*S)) ;
+          case 44: return (sqrt(((-1 + 2*S)*(1 + T)*Power(1 + 2*T,2))/(S*(3 + 2*T))) + sqrt((-1 + 2*S)/(S*(3 + 5*T + 2*Power(T,2)))) + sqrt(((-1 + 2*S)*Power(1 + 2*T,2))/(S*(3 + 5*T + 2*Power(T,2)))))/sqrt(((1 + 2*S)*(1 + T)*(3 + 2*T))/(1 + S)) ;
+          case 45: return 1/sqrt((1 + S)*(1 + 2*S)) ;
+          case 46: return -(1/sqrt(S*(1 + 2*S))) ;
+          case 47: return (3 + 2*S)*sqrt(S/(3 + 11*S + 12*Power(S,2) + 4*Power(S,3))) ;
+          case 48: return ((1 + 2*S)*(-sqrt((S*(1 + S)*Power(T,3))/Power(1 + 2*S,3)) + 2*S*sqrt((S*(1 + S)*Power(T,3))/Power(1 + 2*S,3)) - sqrt((S*(1 + S)*Power(T,3))/(1 + 2*S)) + sqrt((Power(1 - 2*S,2)*S*(1 + S)*Power(T,5))/Power(1 + 2*S,3)) - sqrt((S*(1 + S)*Power(T,5))/(1 + 2*S))))/(2.*S*sqrt(1 + S)*Power(T,1.5)*(1 + T)) ;
+          case 49: return (3*sqrt(S*T) + 4*S*sqrt(S*T) + 2*T*sqrt(S*T) + 2*S*Power(S*T,1.5) + sqrt(Power(S,3)*T) + 2*sqrt(Power(S,5)*T) + sqrt(S*Power(T,3)) + 5*S*sqrt(S*Power(T,3)))/((1 + S)*sqrt((1 + S)*(3 + 4*S*(2 + S))*T)*(1 + T)) ;
+          case 50: return -(1/sqrt(S*(1 + 2*S))) ;
+          case 51: return sqrt(1 + 1/(1 + S) - 2/(1 + 2*S)) ;
+          case 52: return 1/sqrt((S*(1 + 2*S))/(-1 + S + 2*Power(S,2))) ;
+          case 53: return 1/sqrt((1 + S)*(1 + 2*S)) ;
+          case 54: return 1/sqrt((S*(1 + 2*S))/(-1 + S + 2*Power(S,2))) ;
+          case 55: return 1/sqrt((1 + S)*(1 + 2*S)) ;
+          case 56: return (sqrt((1 + S)/(1 + 2*S))*(-3*sqrt(((-1 + 2*S)*(1 + T)*(3 + 2*T))/S) + 18*sqrt((-1 + 2*S)/(S*(3 + 5*T + 2*Power(T,2)))) + T*(5 + 2*T)*(sqrt(((-1 + 2*S)*(1 + T)*(3 + 2*T))/S) + 6*sqrt((-1 + 2*S)/(S*(3 + 5*T + 2*Power(T,2)))))))/Power((1 + T)*(3 + 2*T),1.5) ;
+          case 57: return 1/sqrt((1 + S)*(1 + 2*S)) ;
+          case 58: return (sqrt((1 + S)/(T + 2*S*T))*(6*sqrt((2 - 1/S)*T) + 13*sqrt(((-1 + 2*S)*Power(T,3))/S) + 9*sqrt(((-1 + 2*S)*Power(T,5))/S) + 2*sqrt(((-1 + 2*S)*Power(T,7))/S)))/((1 + T)*(2 + T)*(3 + 2*T)) ;
+          case 59: return 1/sqrt((1 + S)*(1 + 2*S)) ;
+          case 60: return sqrt((1 + S)/((1 + 2*S)*(30 + 77*T + 71*Power(T,2) + 28*Power(T,3) + 4*Power(T,4))))*(2*(1 + 2*T)*sqrt(((-1 + 2*S)*(1 + T)*(3 + 2*T))/(S*(2 + T)*(5 + 2*T))) + (1 + 2*T)*sqrt(((-1 + 2*S)*(1 + T)*(2 + T)*(3 + 2*T))/(S*(5 + 2*T))) + 6*(1 + 2*T)*sqrt(((-1 + 2*S)*(1 + T))/(S*(30 + 47*T + 24*Power(T,2) + 4*Power(T,3)))) + 6*sqrt((-1 + 2*S)/(S*(30 + 77*T + 71*Power(T,2) + 28*Power(T,3) + 4*Power(T,4)))) + 6*(1 + 2*T)*sqrt((-1 + 2*S)/(S*(30 + 77*T + 71*Power(T,2) + 28*Power(T,3) + 4*Power(T,4))))) ;
+          case 61: return 1/sqrt((1 + S)*(1 + 2*S)) ;
+          case 62: return -(1/sqrt(S*(1 + 2*S))) ;
+          case 63: return (3 + 2*S)*sqrt(S/(3 + 11*S + 12*Power(S,2) + 4*Power(S,3))) ;
+          case 64: return -(1/sqrt(S*(1 + 2*S))) ;
+          case 65: return (S*(3 + 2*S))/sqrt(S*(1 + S)*(1 + 2*S)*(3 + 2*S)) ;
+          case 66: return -(1/sqrt(S*(1 + 2*S))) ;
+          case 67: return (3 + 2*S)*sqrt(S/(3 + 11*S + 12*Power(S,2) + 4*Power(S,3))) ;
+          case 68: return -(1/sqrt(S*(1 + 2*S))) ;
+          case 69: return (3 + 2*S)*sqrt(S/(3 + 11*S + 12*Power(S,2) + 4*Power(S,3))) ;
+          case 70: return -(1/sqrt(S*(1 + 2*S))) ;
+          case 71: return (3 + 2*S)/sqrt(((1 + S)*(1 + 2*S)*(3 + 2*S))/S) ;
+          case 72: return sqrt(1 + 6/(1 - 2*S) + 3/S) ;
+          case 73: return sqrt(3 - 9*S + 6*Power(S,2))/(S*(-1 + 2*S)) ;
+          case 74: return -(sqrt(3)/sqrt(S*(-1 + 2*S))) ;
+          case 75: return (-4 + S + 2*Power(S,2))/sqrt(S*(1 + S)*(-1 + 2*S)*(1 + 2*S)) ;
+          case 76: return sqrt(-2 - 3/S + 12*S + 8*Power(S,2))/(1 + 3*S + 2*Power(S,2)) ;
+          case 77: return -(1/(S*sqrt(((1 + S)*(1 + 2*S))/(-3 + 4*S*(1 + S))))) ;
+          case 78: return (-3 + S*(3 + 2*S))/sqrt(S*(1 + S)*(1 + 2*S)*(3 + 2*S)) ;
+          case 79: return (sqrt(3)*(6*sqrt(S*(1 + S)*(3 + 2*S)) + 7*sqrt(Power(S,3)*(1 + S)*(3 + 2*S)) + 2*sqrt(Power(S,5)*(1 + S)*(3 + 2*S))))/(sqrt(S)*(1 + S)*(2 + S)*Power(3 + 2*S,2)) ;
+          case 80: return -(sqrt((6 + 3*S)/(3 + 2*S))/(1 + S)) ;
+          case 81: return ((5 + 2*S)*sqrt((S*(1 + S))/(15 + 16*S + 4*Power(S,2))))/(1 + S) ;
+          case 82: return 1 ;
+          case 83: return 1 ;
+          case 84: return 1 ;
+          case 85: return 1 ;
+          case 86: return 1 ;
+          case 87: return 1 ;
+          case 88: return sqrt(-1 + Power(S,2))/S ;
+          case 89: return (-1 + 2*S)/(S*sqrt(-1 + 4*Power(S,2))) ;
+          case 90: return sqrt(-1 + Power(S,2))/S ;
+          case 91: return sqrt(1 - 2/(1 + 2*S))/S ;
+          case 92: return sqrt((1 + S)/(3*S + 5*S*T + 2*S*Power(T,2)))*((1 + 2*T)*sqrt(((-1 + S)*(1 + T))/(S*(3 + 2*T))) + sqrt((-1 + S)/(S*(3 + 5*T + 2*Power(T,2)))) + (1 + 2*T)*sqrt((-1 + S)/(S*(3 + 5*T + 2*Power(T,2))))) ;
+          case 93: return sqrt((1 + S)/(S*(1 + 2*S)*(3 + 5*T + 2*Power(T,2))))*((1 + 2*T)*sqrt(((-1 + 2*S)*(1 + T))/((S + Power(S,2))*(3 + 2*T))) + sqrt((-1 + 2*S)/(S*(1 + S)*(3 + 5*T + 2*Power(T,2)))) + (1 + 2*T)*sqrt((-1 + 2*S)/(S*(1 + S)*(3 + 5*T + 2*Power(T,2))))) ;
+          case 94: return -(1/S) ;
+          case 95: return 1 - 1/S + 1/(1 + S) ;
+          case 96: return 1/(1 + S) ;
+          case 97: return -(1/S) ;
+          case 98: return 1 - 1/S + 1/(1 + S) ;
+          case 99: return 1/(1 + S) ;
+          case 100: return -(1/S) ;
+          case 101: return 1 - 1/S + 1/(1 + S) ;
+          case 102: return 1/(1 + S) ;
+          case 103: return -(sqrt(1 + 2/(1 + 2*S))/(1 + S)) ;
+          case 104: return sqrt(S*(2 + S))/(1 + S) ;
+          case 105: return -(sqrt(1 + 2/(1 + 2*S))/(1 + S)) ;
+          case 106: return sqrt(S*(2 + S))/(1 + S) ;
+          case 107: return -(sqrt(1 + 2/(1 + 2*S))/(1 + S)) ;
+          case 108: return sqrt(S*(2 + S))/(1 + S) ;
+          case 109: return 1/sqrt((S*(1 + 2*S))/(-1 + S + 2*Power(S,2))) ;
+          case 110: return 1/sqrt((1 + S)*(1 + 2*S)) ;
+          case 111: return 1/sqrt((S*(1 + 2*S))/(-1 + S + 2*Power(S,2))) ;
+          case 112: return 1/sqrt((1 + S)*(1 + 2*S)) ;
+          case 113: return (sqrt(((-1 + 2*S)*(1 + T)*Power(1 + 2*T,2))/(S*(3 + 2*T))) + sqrt((-1 + 2*S)/(S*(3 + 5*T + 2*Power(T,2)))) + sqrt(((-1 + 2*S)*Power(1 + 2*T,2))/(S*(3 + 5*T + 2*Power(T,2)))))/sqrt(((1 + 2*S)*(1 + T)*(3 + 2*T))/(1 + S)) ;
+          case 114: return 1/sqrt((1 + S)*(1 + 2*S)) ;
+          case 115: return -(1/sqrt(S*(1 + 2*S))) ;
+          case 116: return (3 + 2*S)*sqrt(S/(3 + 11*S + 12*Power(S,2) + 4*Power(S,3))) ;
+          case 117: return ((1 + 2*S)*(-sqrt((S*(1 + S)*Power(T,3))/Power(1 + 2*S,3)) + 2*S*sqrt((S*(1 + S)*Power(T,3))/Power(1 + 2*S,3)) - sqrt((S*(1 + S)*Power(T,3))/(1 + 2*S)) + sqrt((Power(1 - 2*S,2)*S*(1 + S)*Power(T,5))/Power(1 + 2*S,3)) - sqrt((S*(1 + S)*Power(T,5))/(1 + 2*S))))/(2.*S*sqrt(1 + S)*Power(T,1.5)*(1 + T)) ;
+          case 118: return (3*sqrt(S*T) + 4*S*sqrt(S*T) + 2*T*sqrt(S*T) + 2*S*Power(S*T,1.5) + sqrt(Power(S,3)*T) + 2*sqrt(Power(S,5)*T) + sqrt(S*Power(T,3)) + 5*S*sqrt(S*Power(T,3)))/((1 + S)*sqrt((1 + S)*(3 + 4*S*(2 + S))*T)*(1 + T)) ;
+          case 119: return -(1/sqrt(S*(1 + 2*S))) ;
+          case 120: return sqrt(1 + 1/(1 + S) - 2/(1 + 2*S)) ;
+          case 121: return 1 ;
+          default: my_assert_not_reached();
+        }
+      };
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(0, 3, 0));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -278,10 +2868,216 @@ MatrixElements<SC> SymmetryQST<SC>::recalc_triplet(const DiagInfo<SC> &diag, con
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "qst/qst-tripletp.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {4, 4},
+        {5, 2},
+        {5, 5},
+        {6, 3},
+        {6, 6},
+        {7, 4},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {10, 10},
+        {11, 11},
+        {12, 12},
+        {13, 13},
+        {14, 14},
+        {15, 15},
+        {16, 16},
+        {17, 14},
+        {17, 17},
+        {18, 15},
+        {18, 18},
+        {19, 16},
+        {19, 19},
+        {20, 14},
+        {20, 17},
+        {20, 20},
+        {21, 15},
+        {21, 18},
+        {21, 21},
+        {22, 16},
+        {22, 19},
+        {22, 22},
+        {23, 23},
+        {24, 24},
+        {25, 25},
+        {26, 23},
+        {26, 26},
+        {27, 24},
+        {27, 27},
+        {28, 25},
+        {28, 28},
+        {29, 29},
+        {30, 30},
+        {31, 31},
+        {32, 32},
+        {33, 33},
+        {34, 29},
+        {34, 34},
+        {35, 30},
+        {35, 35},
+        {36, 31},
+        {36, 36},
+        {37, 32},
+        {37, 37},
+        {38, 33},
+        {38, 38},
+        {39, 39},
+        {40, 39},
+        {40, 40},
+        {41, 39},
+        {41, 40},
+        {41, 41},
+        {42, 40},
+        {42, 41},
+        {42, 42},
+        {43, 43},
+        {44, 44},
+        {45, 45},
+        {46, 46},
+        {47, 47},
+        {48, 48},
+        {49, 49},
+        {50, 50},
+        {51, 51},
+        {52, 49},
+        {52, 52},
+        {53, 50},
+        {53, 53},
+        {54, 51},
+        {54, 54},
+        {55, 49},
+        {55, 52},
+        {55, 55},
+        {56, 50},
+        {56, 53},
+        {56, 56},
+        {57, 51},
+        {57, 54},
+        {57, 57},
+        {58, 58},
+        {59, 59},
+        {60, 60},
+        {61, 58},
+        {61, 61},
+        {62, 59},
+        {62, 62},
+        {63, 60},
+        {63, 63},
+        {64, 64}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1 ;
+          case 1: return sqrt(1 + 1/(1 + S) - 2/(1 + 2*S)) ;
+          case 2: return sqrt(1 + 1/(1 + S) - 2/(1 + 2*S)) ;
+          case 3: return sqrt((3 + 2*S)/((1 + 2*S)*(3 + 5*T + 2*Power(T,2))))*((1 + 2*T)*sqrt((S*(1 + T))/((1 + S)*(3 + 2*T))) + sqrt(S/((1 + S)*(3 + 5*T + 2*Power(T,2)))) + (1 + 2*T)*sqrt(S/((1 + S)*(3 + 5*T + 2*Power(T,2))))) ;
+          case 4: return -(1/sqrt((1 + S)*(1 + 2*S))) ;
+          case 5: return 1 ;
+          case 6: return -(1/sqrt((1 + S)*(1 + 2*S))) ;
+          case 7: return 1 ;
+          case 8: return -(1/sqrt((1 + S)*(1 + 2*S))) ;
+          case 9: return 1 ;
+          case 10: return 1 ;
+          case 11: return 1 ;
+          case 12: return 1 ;
+          case 13: return 1 ;
+          case 14: return 1 ;
+          case 15: return 1 ;
+          case 16: return sqrt(-3 + 4*S*(1 + S))/(1 + 2*S) ;
+          case 17: return sqrt(-3 + 4*S*(1 + S))/(1 + 2*S) ;
+          case 18: return sqrt(((1 + S)*(3 + 2*S))/(S*(1 + 2*S)*(1 + T)*(3 + 2*T)))*((1 + 2*T)*sqrt((S*(-1 + 2*S)*(1 + T))/((1 + 3*S + 2*Power(S,2))*(3 + 2*T))) + sqrt((S*(-1 + 2*S))/((1 + 3*S + 2*Power(S,2))*(3 + 5*T + 2*Power(T,2)))) + (1 + 2*T)*sqrt((S*(-1 + 2*S))/((1 + 3*S + 2*Power(S,2))*(3 + 5*T + 2*Power(T,2))))) ;
+          case 19: return -(sqrt(1 + 2/(1 + 2*S))/(1 + S)) ;
+          case 20: return sqrt(S*(2 + S))/(1 + S) ;
+          case 21: return -(sqrt(1 + 2/(1 + 2*S))/(1 + S)) ;
+          case 22: return (3*(1 + T)*sqrt(Power(S,3)*Power(1 + S,4)*(2 + S)*Power(T,3)*Power(1 + T,4)) - S*(Power(T,2)*sqrt(S*Power(1 + S,4)*(2 + S)*T*Power(1 + T,4)) + sqrt(S*Power(1 + S,4)*(2 + S)*Power(T,3)*Power(1 + T,4))) + Power(S,2)*(Power(T,2)*sqrt(S*Power(1 + S,4)*(2 + S)*T*Power(1 + T,4)) + sqrt(S*Power(1 + S,4)*(2 + S)*Power(T,3)*Power(1 + T,4))))/(S*Power(1 + S,3)*(2 + S)*Power(T,1.5)*Power(1 + T,3)) ;
+          case 23: return -(sqrt(3 + 4*S*(2 + S))/((1 + S)*(1 + 2*S))) ;
+          case 24: return (3*sqrt((S*(3 + 2*S))/(1 + S)) + 3*sqrt((Power(S,3)*(3 + 2*S))/(1 + S)) - sqrt(S*(1 + S)*(3 + 2*S)) + sqrt(Power(S,3)*(1 + S)*(3 + 2*S)))/(Power(1 + S,1.5)*sqrt((2 + S)*(3 + 2*S))) ;
+          case 25: return 1/(1 + 3*S + 2*Power(S,2)) ;
+          case 26: return -(1/(1 + S)) ;
+          case 27: return 1 ;
+          case 28: return 1/(1 + 3*S + 2*Power(S,2)) ;
+          case 29: return -(1/(1 + S)) ;
+          case 30: return 1 ;
+          case 31: return 1/(1 + 3*S + 2*Power(S,2)) ;
+          case 32: return -(1/(1 + S)) ;
+          case 33: return 1 ;
+          case 34: return sqrt(1 + 1/(1 + S) - 2/(1 + 2*S)) ;
+          case 35: return sqrt(1 + 1/(1 + S) - 2/(1 + 2*S)) ;
+          case 36: return sqrt((3 + 2*S)/((1 + 2*S)*(3 + 5*T + 2*Power(T,2))))*((1 + 2*T)*sqrt((S*(1 + T))/((1 + S)*(3 + 2*T))) + sqrt(S/((1 + S)*(3 + 5*T + 2*Power(T,2)))) + (1 + 2*T)*sqrt(S/((1 + S)*(3 + 5*T + 2*Power(T,2))))) ;
+          case 37: return -(1/sqrt((1 + S)*(1 + 2*S))) ;
+          case 38: return 1 ;
+          case 39: return -(1/sqrt((1 + S)*(1 + 2*S))) ;
+          case 40: return 1 ;
+          case 41: return -(1/sqrt((1 + S)*(1 + 2*S))) ;
+          case 42: return 1 ;
+          case 43: return sqrt(1 + 1/(1 + S) - 2/(1 + 2*S)) ;
+          case 44: return sqrt(1 + 1/(1 + S) - 2/(1 + 2*S)) ;
+          case 45: return sqrt(1 + 1/(1 + S) - 2/(1 + 2*S)) ;
+          case 46: return (sqrt((3 + 2*S)/(T + 2*S*T))*(6*sqrt((S*T)/(1 + S)) + 13*sqrt((S*Power(T,3))/(1 + S)) + 9*sqrt((S*Power(T,5))/(1 + S)) + 2*sqrt((S*Power(T,7))/(1 + S))))/(6 + 13*T + 9*Power(T,2) + 2*Power(T,3)) ;
+          case 47: return sqrt((3 + 2*S)/((1 + 2*S)*(30 + 77*T + 71*Power(T,2) + 28*Power(T,3) + 4*Power(T,4))))*(2*(1 + 2*T)*sqrt((S*(1 + T)*(3 + 2*T))/((1 + S)*(2 + T)*(5 + 2*T))) + (1 + 2*T)*sqrt((S*(1 + T)*(2 + T)*(3 + 2*T))/((1 + S)*(5 + 2*T))) + 6*(1 + 2*T)*sqrt((S*(1 + T))/((1 + S)*(30 + 47*T + 24*Power(T,2) + 4*Power(T,3)))) + 6*sqrt(S/((1 + S)*(30 + 77*T + 71*Power(T,2) + 28*Power(T,3) + 4*Power(T,4)))) + 6*(1 + 2*T)*sqrt(S/((1 + S)*(30 + 77*T + 71*Power(T,2) + 28*Power(T,3) + 4*Power(T,4))))) ;
+          case 48: return -(1/sqrt((1 + S)*(1 + 2*S))) ;
+          case 49: return 1 ;
+          case 50: return -(1/sqrt((1 + S)*(1 + 2*S))) ;
+          case 51: return 1 ;
+          case 52: return -(1/sqrt((1 + S)*(1 + 2*S))) ;
+          case 53: return 1 ;
+          case 54: return -(1/sqrt((1 + S)*(1 + 2*S))) ;
+          case 55: return 1 ;
+          case 56: return -(1/sqrt((1 + S)*(1 + 2*S))) ;
+          case 57: return 1 ;
+          case 58: return 1/sqrt((S*(1 + 2*S))/(-3 + S + 2*Power(S,2))) ;
+          case 59: return -(sqrt(9 + 15*S + 6*Power(S,2))/(1 + 3*S + 2*Power(S,2))) ;
+          case 60: return sqrt(S*(2 + S)*(-1 + 2*S)*(3 + 2*S))/((1 + S)*(1 + 2*S)) ;
+          case 61: return sqrt(3)/(sqrt(S*(1 + S))*(1 + 2*S)) ;
+          case 62: return (-4*(2*sqrt(S*(2 + S)*(3 + 2*S)) + sqrt(Power(S,3)*(2 + S)*(3 + 2*S))))/(sqrt(1 + S)*(2 + S)*(1 + 2*S)*(3 + 2*S)) ;
+          case 63: return sqrt((S*(5 + 2*S))/(3 + 5*S + 2*Power(S,2))) ;
+          case 64: return sqrt(3)/((1 + S)*sqrt(3 + 4*S*(2 + S))) ;
+          case 65: return -(sqrt(3)/sqrt((1 + S)*(3 + 2*S))) ;
+          case 66: return 1 ;
+          case 67: return 1 ;
+          case 68: return 1 ;
+          case 69: return 1 ;
+          case 70: return 1 ;
+          case 71: return 1 ;
+          case 72: return 1 ;
+          case 73: return sqrt(-3 + 4*S*(1 + S))/(1 + 2*S) ;
+          case 74: return sqrt(-3 + 4*S*(1 + S))/(1 + 2*S) ;
+          case 75: return sqrt(((1 + S)*(3 + 2*S))/(S*(1 + 2*S)*(1 + T)*(3 + 2*T)))*((1 + 2*T)*sqrt((S*(-1 + 2*S)*(1 + T))/((1 + 3*S + 2*Power(S,2))*(3 + 2*T))) + sqrt((S*(-1 + 2*S))/((1 + 3*S + 2*Power(S,2))*(3 + 5*T + 2*Power(T,2)))) + (1 + 2*T)*sqrt((S*(-1 + 2*S))/((1 + 3*S + 2*Power(S,2))*(3 + 5*T + 2*Power(T,2))))) ;
+          case 76: return -(sqrt(1 + 2/(1 + 2*S))/(1 + S)) ;
+          case 77: return sqrt(S*(2 + S))/(1 + S) ;
+          case 78: return -(sqrt(1 + 2/(1 + 2*S))/(1 + S)) ;
+          case 79: return (3*(1 + T)*sqrt(Power(S,3)*Power(1 + S,4)*(2 + S)*Power(T,3)*Power(1 + T,4)) - S*(Power(T,2)*sqrt(S*Power(1 + S,4)*(2 + S)*T*Power(1 + T,4)) + sqrt(S*Power(1 + S,4)*(2 + S)*Power(T,3)*Power(1 + T,4))) + Power(S,2)*(Power(T,2)*sqrt(S*Power(1 + S,4)*(2 + S)*T*Power(1 + T,4)) + sqrt(S*Power(1 + S,4)*(2 + S)*Power(T,3)*Power(1 + T,4))))/(S*Power(1 + S,3)*(2 + S)*Power(T,1.5)*Power(1 + T,3)) ;
+          case 80: return -(sqrt(3 + 4*S*(2 + S))/((1 + S)*(1 + 2*S))) ;
+          case 81: return (3*sqrt((S*(3 + 2*S))/(1 + S)) + 3*sqrt((Power(S,3)*(3 + 2*S))/(1 + S)) - sqrt(S*(1 + S)*(3 + 2*S)) + sqrt(Power(S,3)*(1 + S)*(3 + 2*S)))/(Power(1 + S,1.5)*sqrt((2 + S)*(3 + 2*S))) ;
+          case 82: return 1/(1 + 3*S + 2*Power(S,2)) ;
+          case 83: return -(1/(1 + S)) ;
+          case 84: return 1 ;
+          case 85: return 1/(1 + 3*S + 2*Power(S,2)) ;
+          case 86: return -(1/(1 + S)) ;
+          case 87: return 1 ;
+          case 88: return 1/(1 + 3*S + 2*Power(S,2)) ;
+          case 89: return -(1/(1 + S)) ;
+          case 90: return 1 ;
+          case 91: return sqrt(1 + 1/(1 + S) - 2/(1 + 2*S)) ;
+          case 92: return sqrt(1 + 1/(1 + S) - 2/(1 + 2*S)) ;
+          case 93: return sqrt((3 + 2*S)/((1 + 2*S)*(3 + 5*T + 2*Power(T,2))))*((1 + 2*T)*sqrt((S*(1 + T))/((1 + S)*(3 + 2*T))) + sqrt(S/((1 + S)*(3 + 5*T + 2*Power(T,2)))) + (1 + 2*T)*sqrt(S/((1 + S)*(3 + 5*T + 2*Power(T,2))))) ;
+          case 94: return -(1/sqrt((1 + S)*(1 + 2*S))) ;
+          case 95: return 1 ;
+          case 96: return -(1/sqrt((1 + S)*(1 + 2*S))) ;
+          case 97: return 1 ;
+          case 98: return -(1/sqrt((1 + S)*(1 + 2*S))) ;
+          case 99: return 1 ;
+          case 100: return 1 ;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(0, 3, 0));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(0, 3, 0));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -293,10 +3089,216 @@ MatrixElements<SC> SymmetryQST<SC>::recalc_triplet(const DiagInfo<SC> &diag, con
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "qst/qst-tripletm.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {2, 5},
+        {3, 3},
+        {3, 6},
+        {4, 4},
+        {4, 7},
+        {5, 5},
+        {6, 6},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {10, 10},
+        {11, 11},
+        {12, 12},
+        {13, 13},
+        {14, 14},
+        {14, 17},
+        {14, 20},
+        {15, 15},
+        {15, 18},
+        {15, 21},
+        {16, 16},
+        {16, 19},
+        {16, 22},
+        {17, 17},
+        {17, 20},
+        {18, 18},
+        {18, 21},
+        {19, 19},
+        {19, 22},
+        {20, 20},
+        {21, 21},
+        {22, 22},
+        {23, 23},
+        {23, 26},
+        {24, 24},
+        {24, 27},
+        {25, 25},
+        {25, 28},
+        {26, 26},
+        {27, 27},
+        {28, 28},
+        {29, 29},
+        {29, 34},
+        {30, 30},
+        {30, 35},
+        {31, 31},
+        {31, 36},
+        {32, 32},
+        {32, 37},
+        {33, 33},
+        {33, 38},
+        {34, 34},
+        {35, 35},
+        {36, 36},
+        {37, 37},
+        {38, 38},
+        {39, 39},
+        {39, 40},
+        {39, 41},
+        {40, 40},
+        {40, 41},
+        {40, 42},
+        {41, 41},
+        {41, 42},
+        {42, 42},
+        {43, 43},
+        {44, 44},
+        {45, 45},
+        {46, 46},
+        {47, 47},
+        {48, 48},
+        {49, 49},
+        {49, 52},
+        {49, 55},
+        {50, 50},
+        {50, 53},
+        {50, 56},
+        {51, 51},
+        {51, 54},
+        {51, 57},
+        {52, 52},
+        {52, 55},
+        {53, 53},
+        {53, 56},
+        {54, 54},
+        {54, 57},
+        {55, 55},
+        {56, 56},
+        {57, 57},
+        {58, 58},
+        {58, 61},
+        {59, 59},
+        {59, 62},
+        {60, 60},
+        {60, 63},
+        {61, 61},
+        {62, 62},
+        {63, 63},
+        {64, 64}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1 ;
+          case 1: return 1 ;
+          case 2: return 1/sqrt(S*(1 + 2*S)) ;
+          case 3: return 1 ;
+          case 4: return 1/sqrt(S*(1 + 2*S)) ;
+          case 5: return 1 ;
+          case 6: return 1/sqrt(S*(1 + 2*S)) ;
+          case 7: return 1/sqrt((S*(1 + 2*S))/(-1 + S + 2*Power(S,2))) ;
+          case 8: return sqrt(S*(1 + S)*(-1 + 4*Power(S,2)))/(S*(1 + 2*S)) ;
+          case 9: return 1/sqrt((S*(1 + 2*S))/(-1 + S + 2*Power(S,2))) ;
+          case 10: return 1 ;
+          case 11: return 1 ;
+          case 12: return 1 ;
+          case 13: return 1 ;
+          case 14: return 1 ;
+          case 15: return 1 ;
+          case 16: return 1 ;
+          case 17: return 1/S ;
+          case 18: return 1/(S + 2*Power(S,2)) ;
+          case 19: return 1 ;
+          case 20: return 1/S ;
+          case 21: return 1/(S + 2*Power(S,2)) ;
+          case 22: return 1 ;
+          case 23: return 1/S ;
+          case 24: return 1/(S + 2*Power(S,2)) ;
+          case 25: return sqrt(-1 + Power(S,2))/S ;
+          case 26: return sqrt(1 - 2/(1 + 2*S))/S ;
+          case 27: return sqrt(-1 + Power(S,2))/S ;
+          case 28: return sqrt(1 - 2/(1 + 2*S))/S ;
+          case 29: return sqrt(-1 + Power(S,2))/S ;
+          case 30: return (sqrt(1 + 2*T)*(sqrt((S*(1 + S)*(-1 + 2*S)*(1 + 2*S)*(1 + T)*(3 + 2*T))/(1 + 2*T)) + sqrt((Power(S,3)*(1 + S)*(-1 + 2*S)*(1 + 2*S)*(1 + T)*(3 + 2*T))/(1 + 2*T)) + sqrt(S*(1 + S)*(-1 + 2*S)*(1 + 2*S)*(1 + T)*(1 + 2*T)*(3 + 2*T)) + sqrt(Power(S,3)*(1 + S)*(-1 + 2*S)*(1 + 2*S)*(1 + T)*(1 + 2*T)*(3 + 2*T)) + sqrt(S*(1 + S)*(-1 + 2*S)*(1 + 2*S)*Power(1 + T,3)*(3 + 4*T*(2 + T))) + S*sqrt(S*(1 + S)*(-1 + 2*S)*(1 + 2*S)*Power(1 + T,3)*(3 + 4*T*(2 + T)))))/((1 + 2*S)*Power(S*(1 + S)*(1 + T)*(3 + 2*T),1.5)) ;
+          case 31: return (sqrt(S*(1 + S)*(-1 + 2*S)*(1 + 2*S)) + sqrt((S*(-1 + 2*S))/(1 + 3*S + 2*Power(S,2))) + sqrt((S*(-1 + 4*Power(S,2)))/(1 + S)))/sqrt(S*(1 + S)*(1 + 2*S)*(3 + 2*S)) ;
+          case 32: return (sqrt(S*(1 + S)*(-1 + 2*S)*(1 + 2*S)) + sqrt((S*(-1 + 2*S))/(1 + 3*S + 2*Power(S,2))) + sqrt((S*(-1 + 4*Power(S,2)))/(1 + S)))/sqrt(S*(1 + S)*(1 + 2*S)*(3 + 2*S)) ;
+          case 33: return sqrt(-3 + 4*S*(1 + S))/(1 + 2*S) ;
+          case 34: return 1 ;
+          case 35: return 1/sqrt(S*(1 + 2*S)) ;
+          case 36: return 1 ;
+          case 37: return 1/sqrt(S*(1 + 2*S)) ;
+          case 38: return 1 ;
+          case 39: return 1/sqrt(S*(1 + 2*S)) ;
+          case 40: return 1/sqrt((S*(1 + 2*S))/(-1 + S + 2*Power(S,2))) ;
+          case 41: return sqrt(S*(1 + S)*(-1 + 4*Power(S,2)))/(S*(1 + 2*S)) ;
+          case 42: return 1/sqrt((S*(1 + 2*S))/(-1 + S + 2*Power(S,2))) ;
+          case 43: return 1 ;
+          case 44: return 1/sqrt(S*(1 + 2*S)) ;
+          case 45: return 1 ;
+          case 46: return 1/sqrt(S*(1 + 2*S)) ;
+          case 47: return 1 ;
+          case 48: return 1/sqrt(S*(1 + 2*S)) ;
+          case 49: return 1 ;
+          case 50: return (T*sqrt(Power(S,2)*Power(T,3)*Power(1 + T,4)*Power(2 + T,3)*(1 + 2*T)*Power(3 + 2*T,3)) + (6*S*T*(1 + T)*(2 + T)*(3 + 2*T)*(sqrt(T*(2 + T)*(3 + 2*T)) + 2*sqrt(Power(T,3)*(2 + T)*(3 + 2*T)) + sqrt(Power(T,5)*(2 + T)*(3 + 2*T))))/sqrt(1 + 2*T))/sqrt((Power(S,3)*(1 + 2*S)*Power(T,3)*Power(1 + T,4)*Power(2 + T,5)*Power(3 + 2*T,5))/(1 + 2*T)) ;
+          case 51: return 1 ;
+          case 52: return (sqrt((1 + 2*T)/(1 + 2*S))*(T*sqrt(S*(1 + 2*T)*(5 + 2*T))*(29 + T*(13 + 2*T)) + 6*(4*sqrt(S*(1 + 2*T)*(5 + 2*T)) + sqrt(S + (4*S)/(1 + 2*T)))))/(S*(1 + T)*(2 + T)*(3 + 2*T)*Power(5 + 2*T,1.5)) ;
+          case 53: return 1/sqrt((S*(1 + 2*S))/(-1 + S + 2*Power(S,2))) ;
+          case 54: return 1/sqrt((S*(1 + 2*S))/(-1 + S + 2*Power(S,2))) ;
+          case 55: return 1/sqrt((S*(1 + 2*S))/(-1 + S + 2*Power(S,2))) ;
+          case 56: return (1 + S)*sqrt((-1 + 2*S)/(S + 3*Power(S,2) + 2*Power(S,3))) ;
+          case 57: return 1/sqrt((S*(1 + 2*S))/(-1 + S + 2*Power(S,2))) ;
+          case 58: return 1 ;
+          case 59: return sqrt(3)/sqrt(S*(-1 + 2*S)) ;
+          case 60: return sqrt(3)/(S*sqrt(-1 + 4*Power(S,2))) ;
+          case 61: return (1 + S)/sqrt((S*(-1 + S + 2*Power(S,2)))/(-3 + 2*S)) ;
+          case 62: return (4*sqrt(-2 + 1/S - S + 2*Power(S,2)))/(-1 + 4*Power(S,2)) ;
+          case 63: return sqrt(3)/(sqrt(S*(1 + S))*(1 + 2*S)) ;
+          case 64: return (3*sqrt(3/(1 + 2*S) + S*(-4 + S + 2*Power(S,2))) + (-1 + S)*S*(sqrt(((1 + S)*(-1 + 2*S)*(1 + 2*S)*(3 + 2*S))/(-1 + S)) + 4*sqrt(5 + 10/(3.*(-1 + S)) + 2*S + 4/(3 + 6*S))))/(S*(1 + S)*sqrt(1 + 2*S)*(3 + 2*S)) ;
+          case 65: return (sqrt(3)*(sqrt(Power(S,3)*(1 + S)*(-1 + 2*S)*(1 + 2*S)*(3 + 2*S)) + 3*sqrt((S*(-3 + S*(1 + 4*S*(2 + S))))/(1 + 2*S)) + 4*S*sqrt((S*(-3 + S*(1 + 4*S*(2 + S))))/(1 + 2*S))))/(S*sqrt(1 + 2*S)*Power((1 + S)*(3 + 2*S),1.5)) ;
+          case 66: return (3*sqrt((S*(-1 + S + 2*Power(S,2)))/(3 + 2*S)) + 6*S*sqrt((S*(-1 + S + 2*Power(S,2)))/(3 + 2*S)) + 3*sqrt((S*(-1 + 2*S))/(3 + 5*S + 2*Power(S,2))) + 3*(1 + 2*S)*sqrt((S*(-1 + 2*S))/(3 + 5*S + 2*Power(S,2))) + (1 + 2*S)*sqrt(S*(-3 + S*(1 + 4*S*(2 + S)))))/(2.*(1 + S)*sqrt(S*(2 + S)*(1 + 2*S)*(3 + 2*S))) ;
+          case 67: return 1 ;
+          case 68: return 1 ;
+          case 69: return 1 ;
+          case 70: return 1 ;
+          case 71: return 1 ;
+          case 72: return 1 ;
+          case 73: return 1 ;
+          case 74: return 1/S ;
+          case 75: return 1/(S + 2*Power(S,2)) ;
+          case 76: return 1 ;
+          case 77: return 1/S ;
+          case 78: return 1/(S + 2*Power(S,2)) ;
+          case 79: return 1 ;
+          case 80: return 1/S ;
+          case 81: return 1/(S + 2*Power(S,2)) ;
+          case 82: return sqrt(-1 + Power(S,2))/S ;
+          case 83: return sqrt(1 - 2/(1 + 2*S))/S ;
+          case 84: return sqrt(-1 + Power(S,2))/S ;
+          case 85: return sqrt(1 - 2/(1 + 2*S))/S ;
+          case 86: return sqrt(-1 + Power(S,2))/S ;
+          case 87: return (sqrt(1 + 2*T)*(sqrt((S*(1 + S)*(-1 + 2*S)*(1 + 2*S)*(1 + T)*(3 + 2*T))/(1 + 2*T)) + sqrt((Power(S,3)*(1 + S)*(-1 + 2*S)*(1 + 2*S)*(1 + T)*(3 + 2*T))/(1 + 2*T)) + sqrt(S*(1 + S)*(-1 + 2*S)*(1 + 2*S)*(1 + T)*(1 + 2*T)*(3 + 2*T)) + sqrt(Power(S,3)*(1 + S)*(-1 + 2*S)*(1 + 2*S)*(1 + T)*(1 + 2*T)*(3 + 2*T)) + sqrt(S*(1 + S)*(-1 + 2*S)*(1 + 2*S)*Power(1 + T,3)*(3 + 4*T*(2 + T))) + S*sqrt(S*(1 + S)*(-1 + 2*S)*(1 + 2*S)*Power(1 + T,3)*(3 + 4*T*(2 + T)))))/((1 + 2*S)*Power(S*(1 + S)*(1 + T)*(3 + 2*T),1.5)) ;
+          case 88: return (sqrt(S*(1 + S)*(-1 + 2*S)*(1 + 2*S)) + sqrt((S*(-1 + 2*S))/(1 + 3*S + 2*Power(S,2))) + sqrt((S*(-1 + 4*Power(S,2)))/(1 + S)))/sqrt(S*(1 + S)*(1 + 2*S)*(3 + 2*S)) ;
+          case 89: return (sqrt(S*(1 + S)*(-1 + 2*S)*(1 + 2*S)) + sqrt((S*(-1 + 2*S))/(1 + 3*S + 2*Power(S,2))) + sqrt((S*(-1 + 4*Power(S,2)))/(1 + S)))/sqrt(S*(1 + S)*(1 + 2*S)*(3 + 2*S)) ;
+          case 90: return sqrt(-3 + 4*S*(1 + S))/(1 + 2*S) ;
+          case 91: return 1 ;
+          case 92: return 1/sqrt(S*(1 + 2*S)) ;
+          case 93: return 1 ;
+          case 94: return 1/sqrt(S*(1 + 2*S)) ;
+          case 95: return 1 ;
+          case 96: return 1/sqrt(S*(1 + 2*S)) ;
+          case 97: return 1/sqrt((S*(1 + 2*S))/(-1 + S + 2*Power(S,2))) ;
+          case 98: return sqrt(S*(1 + S)*(-1 + 4*Power(S,2)))/(S*(1 + 2*S)) ;
+          case 99: return 1/sqrt((S*(1 + 2*S))/(-1 + S + 2*Power(S,2))) ;
+          case 100: return 1 ;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(0, 3, 0));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(0, 3, 0));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -309,6 +3311,7 @@ MatrixElements<SC> SymmetryQST<SC>::recalc_triplet(const DiagInfo<SC> &diag, con
 template<typename SC>
 MatrixElements<SC> SymmetryQST<SC>::recalc_orb_triplet(const DiagInfo<SC> &diag, const SubspaceStructure &substruct, const MatrixElements<SC> &cold) const {
   MatrixElements<SC> cnew;
+  const auto blocks = std::make_shared<const BlockIndex<SC>>(cold, substruct);
   for(const auto &[I1, eig]: diag) {
     int q1  = I1.get("Q");
     int ss1  = I1.get("SS");
@@ -327,10 +3330,302 @@ MatrixElements<SC> SymmetryQST<SC>::recalc_orb_triplet(const DiagInfo<SC> &diag,
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "qst/qst-orb-triplets.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {2, 3},
+        {3, 2},
+        {3, 3},
+        {3, 4},
+        {4, 3},
+        {4, 4},
+        {5, 5},
+        {5, 6},
+        {6, 5},
+        {6, 6},
+        {6, 7},
+        {7, 6},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {9, 10},
+        {10, 9},
+        {10, 10},
+        {10, 11},
+        {11, 10},
+        {11, 11},
+        {11, 12},
+        {12, 11},
+        {12, 12},
+        {12, 13},
+        {13, 12},
+        {13, 13},
+        {14, 14},
+        {14, 15},
+        {15, 14},
+        {15, 15},
+        {15, 16},
+        {16, 15},
+        {16, 16},
+        {17, 17},
+        {17, 18},
+        {18, 17},
+        {18, 18},
+        {18, 19},
+        {19, 18},
+        {19, 19},
+        {20, 20},
+        {20, 21},
+        {21, 20},
+        {21, 21},
+        {21, 22},
+        {22, 21},
+        {22, 22},
+        {23, 23},
+        {23, 24},
+        {24, 23},
+        {24, 24},
+        {24, 25},
+        {25, 24},
+        {25, 25},
+        {26, 26},
+        {26, 27},
+        {27, 26},
+        {27, 27},
+        {27, 28},
+        {28, 27},
+        {28, 28},
+        {29, 29},
+        {29, 30},
+        {30, 29},
+        {30, 30},
+        {30, 31},
+        {31, 30},
+        {31, 31},
+        {31, 32},
+        {32, 31},
+        {32, 32},
+        {32, 33},
+        {33, 32},
+        {33, 33},
+        {34, 34},
+        {34, 35},
+        {35, 34},
+        {35, 35},
+        {35, 36},
+        {36, 35},
+        {36, 36},
+        {36, 37},
+        {37, 36},
+        {37, 37},
+        {37, 38},
+        {38, 37},
+        {38, 38},
+        {39, 39},
+        {40, 40},
+        {41, 41},
+        {42, 42},
+        {43, 43},
+        {44, 44},
+        {44, 45},
+        {45, 44},
+        {45, 45},
+        {45, 46},
+        {46, 45},
+        {46, 46},
+        {46, 47},
+        {47, 46},
+        {47, 47},
+        {47, 48},
+        {48, 47},
+        {48, 48},
+        {49, 49},
+        {49, 50},
+        {50, 49},
+        {50, 50},
+        {50, 51},
+        {51, 50},
+        {51, 51},
+        {52, 52},
+        {52, 53},
+        {53, 52},
+        {53, 53},
+        {53, 54},
+        {54, 53},
+        {54, 54},
+        {55, 55},
+        {55, 56},
+        {56, 55},
+        {56, 56},
+        {56, 57},
+        {57, 56},
+        {57, 57},
+        {58, 58},
+        {58, 59},
+        {59, 58},
+        {59, 59},
+        {59, 60},
+        {60, 59},
+        {60, 60},
+        {61, 61},
+        {61, 62},
+        {62, 61},
+        {62, 62},
+        {62, 63},
+        {63, 62},
+        {63, 63},
+        {64, 64}
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(0, 1, 1));
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1 ;
+          case 1: return sqrt(-1 + Power(T,2))/T ;
+          case 2: return (-1 + 2*T)/(T*sqrt(-1 + 4*Power(T,2))) ;
+          case 3: return -(1/T) ;
+          case 4: return 1 - 1/T + 1/(1 + T) ;
+          case 5: return 1/(1 + T) ;
+          case 6: return -(sqrt(1 + 2/(1 + 2*T))/(1 + T)) ;
+          case 7: return sqrt(T*(2 + T))/(1 + T) ;
+          case 8: return sqrt(-1 + Power(T,2))/T ;
+          case 9: return sqrt(1 - 2/(1 + 2*T))/T ;
+          case 10: return -(1/T) ;
+          case 11: return 1 - 1/T + 1/(1 + T) ;
+          case 12: return 1/(1 + T) ;
+          case 13: return -(sqrt(1 + 2/(1 + 2*T))/(1 + T)) ;
+          case 14: return sqrt(T*(2 + T))/(1 + T) ;
+          case 15: return 1 ;
+          case 16: return sqrt(1 - 2/(-1 + T) + 2/T) ;
+          case 17: return sqrt((-6 + 4*T)/(T - 3*Power(T,2) + 2*Power(T,3))) ;
+          case 18: return -(sqrt(2)/sqrt((-1 + T)*T)) ;
+          case 19: return (-3 + Power(T,2))/sqrt(Power(T,2)*(-1 + Power(T,2))) ;
+          case 20: return (sqrt(3)*(-3 + T + 2*Power(T,2)))/(T*sqrt((-1 + T)*(1 + T)*(1 + 2*T)*(3 + 2*T))) ;
+          case 21: return -((sqrt(3)*(-3 + T + 2*Power(T,2)))/(T*sqrt((1 + T)*(3 - 7*T + 4*Power(T,3))))) ;
+          case 22: return 1 - 3/T + 3/(1 + T) ;
+          case 23: return 1/((1 + T)*sqrt((T*(3 + 2*T))/(-6 + 9*T + 6*Power(T,2)))) ;
+          case 24: return sqrt(3)*sqrt(1 + T)*((-3 + T)*T*(-1 + 2*T)*sqrt((1 + 2*T)/(T*Power(1 + T,3)*Power(3 + 2*T,2)*(-2 + 3*T + 2*Power(T,2)))) + 6*sqrt((Power(-1 + T,2)*(-1 + 2*T))/(T*Power(1 + T,3)*Power(3 + 2*T,2)*(2 + 5*T + 2*Power(T,2)))) + (1 - 2*T)*sqrt((T*(1 + 2*T))/(Power(3 + 2*T,2)*(-2 + T + 5*Power(T,2) + 2*Power(T,3)))) + (3*(-3 + 2*T)*sqrt((T*(-1 + 2*T))/(2 + 7*T + 7*Power(T,2) + 2*Power(T,3))))/(3 + 5*T + 2*Power(T,2))) ;
+          case 25: return (-2 + T*(2 + T))/((1 + T)*sqrt(T*(2 + T))) ;
+          case 26: return (sqrt(2 + 2/T)*(45*T*sqrt(T*(1 + T)*(2 + T)*(3 + 2*T)) + 2*(15*sqrt(T*(1 + T)*(2 + T)*(3 + 2*T)) + 9*sqrt(Power(T,5)*(1 + T)*(2 + T)*(3 + 2*T)) + sqrt(Power(T,3)*Power(1 + T,3)*(2 + T)*Power(1 + 2*T,2)*(3 + 2*T)))))/(Power(2 + T,2)*Power((1 + T)*(3 + 2*T),1.5)*(5 + 2*T)) ;
+          case 27: return -((sqrt(2)*(30*sqrt(T*(1 + T)*(2 + T)*(3 + 2*T)) + 47*sqrt(Power(T,3)*(1 + T)*(2 + T)*(3 + 2*T)) + 24*sqrt(Power(T,5)*(1 + T)*(2 + T)*(3 + 2*T)) + 4*sqrt(Power(T,7)*(1 + T)*(2 + T)*(3 + 2*T))))/((1 + T)*Power(2 + T,2)*Power(3 + 2*T,2)*sqrt(T*(5 + 2*T)))) ;
+          case 28: return ((3 + T)*sqrt((T*(1 + T))/(6 + 5*T + Power(T,2))))/(1 + T) ;
+          case 29: return sqrt(-1 + Power(T,2))/T ;
+          case 30: return (-1 + 2*T)/(T*sqrt(-1 + 4*Power(T,2))) ;
+          case 31: return -(1/T) ;
+          case 32: return 1 - 1/T + 1/(1 + T) ;
+          case 33: return 1/(1 + T) ;
+          case 34: return -(sqrt(1 + 2/(1 + 2*T))/(1 + T)) ;
+          case 35: return sqrt(T*(2 + T))/(1 + T) ;
+          case 36: return sqrt(-1 + Power(T,2))/T ;
+          case 37: return sqrt(1 - 2/(1 + 2*T))/T ;
+          case 38: return -(1/T) ;
+          case 39: return 1 - 1/T + 1/(1 + T) ;
+          case 40: return 1/(1 + T) ;
+          case 41: return -(sqrt(1 + 2/(1 + 2*T))/(1 + T)) ;
+          case 42: return (18*sqrt(S*(1 + S)*T*(3 + 2*T)) + 12*T*(3 + T)*sqrt(S*(1 + S)*T*(3 + 2*T)) + 36*sqrt(Power(S,3)*(1 + S)*T*(3 + 2*T)) + 18*sqrt(Power(S,5)*(1 + S)*T*(3 + 2*T)) + 15*sqrt(S*(1 + S)*Power(T,3)*(3 + 2*T)) + 102*sqrt(Power(S,3)*(1 + S)*Power(T,3)*(3 + 2*T)) + 51*sqrt(Power(S,5)*(1 + S)*Power(T,3)*(3 + 2*T)) + 41*sqrt(S*(1 + S)*Power(T,5)*(3 + 2*T)) + 106*sqrt(Power(S,3)*(1 + S)*Power(T,5)*(3 + 2*T)) + 53*sqrt(Power(S,5)*(1 + S)*Power(T,5)*(3 + 2*T)) + 24*sqrt(S*(1 + S)*Power(T,7)*(3 + 2*T)) + 48*sqrt(Power(S,3)*(1 + S)*Power(T,7)*(3 + 2*T)) + 24*sqrt(Power(S,5)*(1 + S)*Power(T,7)*(3 + 2*T)) + 4*sqrt(S*(1 + S)*Power(T,9)*(3 + 2*T)) + 8*sqrt(Power(S,3)*(1 + S)*Power(T,9)*(3 + 2*T)) + 4*sqrt(Power(S,5)*(1 + S)*Power(T,9)*(3 + 2*T)))/(Power(1 + T,2)*sqrt(S*(2 + T))*Power((1 + S)*(3 + 2*T),2.5)) ;
+          case 43: return ((1 + 2*S)*sqrt(((1 + S)*(-1 + T))/((3 + 2*S)*T)) + sqrt((-1 + T)/((3 + 5*S + 2*Power(S,2))*T)) + (1 + 2*S)*sqrt((-1 + T)/((3 + 5*S + 2*Power(S,2))*T)))*sqrt((1 + T)/(3*T + 5*S*T + 2*Power(S,2)*T)) ;
+          case 44: return sqrt((1 + T)/((3 + 5*S + 2*Power(S,2))*T*(1 + 2*T)))*(sqrt((-1 + 2*T)/((3 + 5*S + 2*Power(S,2))*T*(1 + T))) + (1 + 2*S)*sqrt((-1 + 2*T)/((3 + 5*S + 2*Power(S,2))*T*(1 + T))) + (1 + 2*S)*sqrt(((1 + S)*(-1 + 2*T))/((3 + 2*S)*(T + Power(T,2))))) ;
+          case 45: return -(1/T) ;
+          case 46: return 1 - 1/T + 1/(1 + T) ;
+          case 47: return 1/(1 + T) ;
+          case 48: return -(sqrt(1 + 2/(1 + 2*T))/(1 + T)) ;
+          case 49: return sqrt(T*(2 + T))/(1 + T) ;
+          case 50: return sqrt(-1 + Power(T,2))/T ;
+          case 51: return (-1 + 2*T)/(T*sqrt(-1 + 4*Power(T,2))) ;
+          case 52: return -(1/T) ;
+          case 53: return 1 - 1/T + 1/(1 + T) ;
+          case 54: return 1/(1 + T) ;
+          case 55: return -(sqrt(1 + 2/(1 + 2*T))/(1 + T)) ;
+          case 56: return sqrt(T*(2 + T))/(1 + T) ;
+          case 57: return sqrt(-1 + Power(T,2))/T ;
+          case 58: return sqrt(1 - 2/(1 + 2*T))/T ;
+          case 59: return -(1/T) ;
+          case 60: return 1 - 1/T + 1/(1 + T) ;
+          case 61: return 1/(1 + T) ;
+          case 62: return -(sqrt(1 + 2/(1 + 2*T))/(1 + T)) ;
+          case 63: return sqrt(T*(2 + T))/(1 + T) ;
+          case 64: return sqrt(1 - 2/(-1 + T) + 2/T) ;
+          case 65: return sqrt((-6 + 4*T)/(T - 3*Power(T,2) + 2*Power(T,3))) ;
+          case 66: return -(sqrt(2)/sqrt((-1 + T)*T)) ;
+          case 67: return (-3 + Power(T,2))/sqrt(Power(T,2)*(-1 + Power(T,2))) ;
+          case 68: return (sqrt(3)*(-3 + T + 2*Power(T,2)))/(T*sqrt((-1 + T)*(1 + T)*(1 + 2*T)*(3 + 2*T))) ;
+          case 69: return -((sqrt(3)*(-3 + T + 2*Power(T,2)))/(T*sqrt((1 + T)*(3 - 7*T + 4*Power(T,3))))) ;
+          case 70: return 1 - 3/T + 3/(1 + T) ;
+          case 71: return 1/((1 + T)*sqrt((T*(3 + 2*T))/(-6 + 9*T + 6*Power(T,2)))) ;
+          case 72: return sqrt(3)*sqrt(1 + T)*((-3 + T)*T*(-1 + 2*T)*sqrt((1 + 2*T)/(T*Power(1 + T,3)*Power(3 + 2*T,2)*(-2 + 3*T + 2*Power(T,2)))) + 6*sqrt((Power(-1 + T,2)*(-1 + 2*T))/(T*Power(1 + T,3)*Power(3 + 2*T,2)*(2 + 5*T + 2*Power(T,2)))) + (1 - 2*T)*sqrt((T*(1 + 2*T))/(Power(3 + 2*T,2)*(-2 + T + 5*Power(T,2) + 2*Power(T,3)))) + (3*(-3 + 2*T)*sqrt((T*(-1 + 2*T))/(2 + 7*T + 7*Power(T,2) + 2*Power(T,3))))/(3 + 5*T + 2*Power(T,2))) ;
+          case 73: return (-2 + T*(2 + T))/((1 + T)*sqrt(T*(2 + T))) ;
+          case 74: return (sqrt(2 + 2/T)*(45*T*sqrt(T*(1 + T)*(2 + T)*(3 + 2*T)) + 2*(15*sqrt(T*(1 + T)*(2 + T)*(3 + 2*T)) + 9*sqrt(Power(T,5)*(1 + T)*(2 + T)*(3 + 2*T)) + sqrt(Power(T,3)*Power(1 + T,3)*(2 + T)*Power(1 + 2*T,2)*(3 + 2*T)))))/(Power(2 + T,2)*Power((1 + T)*(3 + 2*T),1.5)*(5 + 2*T)) ;
+          case 75: return -(sqrt(2)*sqrt(1/(T*Power(1 + T,2)*(5 + 2*T)*Power(6 + 7*T + 2*Power(T,2),3)))*(30*sqrt(T*(1 + T)) + 47*sqrt(Power(T,3)*(1 + T)) + 24*sqrt(Power(T,5)*(1 + T)) + 4*sqrt(Power(T,7)*(1 + T)))) ;
+          case 76: return (T*(3 + T))/sqrt(T*(1 + T)*(2 + T)*(3 + T)) ;
+          case 77: return sqrt(1 - 2/(-1 + T) + 2/T) ;
+          case 78: return (sqrt(2)*(-3 + 2*T))/sqrt((-1 + T)*T*(-3 + 2*T)*(-1 + 2*T)) ;
+          case 79: return -(sqrt(2)/sqrt((-1 + T)*T)) ;
+          case 80: return (-3 + Power(T,2))/(T*sqrt(-1 + Power(T,2))) ;
+          case 81: return (sqrt((3 + 6*S)/(Power(1 + S,3)*Power(T,2)*Power(1 + T,2)*(3 + 4*T*(2 + T))))*(T*(-5 + 2*T)*(sqrt(((1 + S)*(1 + T))/((1 + 2*S)*(-1 + T))) + sqrt(((1 + S)*(1 + 2*S)*(1 + T))/(-1 + T))) + 3*(sqrt(((1 + S)*(1 + T))/((1 + 2*S)*(-1 + T))) + sqrt(((1 + S)*(1 + 2*S)*(1 + T))/(-1 + T)) + 2*sqrt(((1 + S)*(-1 + Power(T,2)))/(1 + 2*S)) + 2*sqrt((1 + S)*(1 + 2*S)*(-1 + Power(T,2))))))/2. ;
+          case 82: return -((sqrt(3)*(-3 + T + 2*Power(T,2)))/(T*sqrt((1 + T)*(3 - 7*T + 4*Power(T,3))))) ;
+          case 83: return 1 - 3/T + 3/(1 + T) ;
+          case 84: return (sqrt((3 + 3*T)/(T + S*T))*(T*sqrt(((1 + S)*(1 + T)*(2 + T)*(3 + 2*T))/(-1 + 2*T))*(-19 + 4*T*(3 + T)) + 6*(sqrt(((1 + S)*(1 + T)*(2 + T)*(3 + 2*T))/(-1 + 2*T)) + 2*sqrt((1 + S)*(1 + T)*(2 + T)*(-1 + 2*T)*(3 + 2*T)))))/(Power(1 + T,2)*(2 + T)*Power(3 + 2*T,2)) ;
+          case 85: return (sqrt(3)*sqrt(1 + T)*(((1 + 2*S)*(-3 + T)*T*(-1 + 2*T))/((1 + S)*Power(1 + T,1.5)*sqrt((T*(2 + T)*(-1 + 2*T))/(1 + 2*T))*(3 + 2*T)) - ((1 + 2*S)*T*(-1 + 2*T))/((1 + S)*sqrt((T*(1 + T)*(2 + T)*(-1 + 2*T))/(1 + 2*T))*(3 + 2*T)) + (3*(1 + 2*S)*T*(-3 + 2*T))/((1 + S)*Power(1 + T,1.5)*sqrt((T*(2 + T)*(1 + 2*T))/(-1 + 2*T))*(3 + 2*T)) + (6*(1 + 2*S)*(-1 + T))/((1 + S)*(1 + T)*sqrt((T*(1 + T)*(2 + T)*(1 + 2*T))/(-1 + 2*T))*(3 + 2*T)) + (-3 + T)*T*(-1 + 2*T)*sqrt((1 + 2*T)/(Power(1 + S,2)*T*Power(1 + T,3)*Power(3 + 2*T,2)*(-2 + 3*T + 2*Power(T,2)))) + ((1 - 2*T)*T*sqrt((1 + 2*T)/(T*(-2 + T + 5*Power(T,2) + 2*Power(T,3)))))/((1 + S)*(3 + 2*T)) + (6*(-1 + T)*sqrt((-1 + 2*T)/(T*(2 + 7*T + 7*Power(T,2) + 2*Power(T,3)))))/((1 + S)*(3 + 5*T + 2*Power(T,2))) + (3*(-3 + 2*T)*sqrt((T*(-1 + 2*T))/(2 + 7*T + 7*Power(T,2) + 2*Power(T,3))))/((1 + S)*(3 + 5*T + 2*Power(T,2)))))/2. ;
+          case 86: return (-2 + T*(2 + T))/((1 + T)*sqrt(T*(2 + T))) ;
+          case 87: return (30*(sqrt((Power(1 + S,5)*(5 + 2*T)*Power(T + Power(T,2),3)*Power(6 + 7*T + 2*Power(T,2),5))/Power(1 + 2*T,2)) + sqrt((Power(1 + S,5)*(5 + 2*T)*Power(T + Power(T,2),3)*Power(6 + 7*T + 2*Power(T,2),5))/(Power(1 + 2*S,2)*Power(1 + 2*T,2)))) + T*(2*sqrt(Power(1 + S,5)*Power(T,3)*Power(1 + T,5)*Power(2 + T,5)*Power(3 + 2*T,5)*(5 + 2*T)) + 2*sqrt((Power(1 + S,5)*Power(T,3)*Power(1 + T,5)*Power(2 + T,5)*Power(3 + 2*T,5)*(5 + 2*T))/Power(1 + 2*S,2)) + 9*sqrt(Power(1 + S,5)*(5 + 2*T)*Power(T + Power(T,2),3)*Power(6 + 7*T + 2*Power(T,2),5)) + 9*sqrt((Power(1 + S,5)*(5 + 2*T)*Power(T + Power(T,2),3)*Power(6 + 7*T + 2*Power(T,2),5))/Power(1 + 2*S,2)) + 36*sqrt((Power(1 + S,5)*(5 + 2*T)*Power(T + Power(T,2),3)*Power(6 + 7*T + 2*Power(T,2),5))/Power(1 + 2*T,2)) + 36*sqrt((Power(1 + S,5)*(5 + 2*T)*Power(T + Power(T,2),3)*Power(6 + 7*T + 2*Power(T,2),5))/(Power(1 + 2*S,2)*Power(1 + 2*T,2)))))/(sqrt(2)*sqrt((Power(1 + S,7)*Power(T,3)*Power(1 + T,4)*Power(2 + T,8)*Power(3 + 2*T,7)*Power(5 + 2*T,3))/(Power(1 + 2*S,2)*Power(1 + 2*T,2)))) ;
+          case 88: return (sqrt((2 + 4*T)/(6 + 7*T + 2*Power(T,2)))*(-6*(3*sqrt((1 + T)*(1 + 2*T)*(5 + 2*T)) + sqrt((5 + 2*T)/(1 + 3*T + 2*Power(T,2))) + sqrt(8 + 4*T - 3/(1 + T))) + T*(-2*sqrt((1 + T)*(1 + 2*T)*(5 + 2*T)) + 12*sqrt((5 + 2*T)/(1 + 3*T + 2*Power(T,2))) + 9*sqrt(8 + 4*T - 3/(1 + T)))))/((2 + T)*(3 + 2*T)*(5 + 2*T)) ;
+          case 89: return (3*(18*sqrt(((1 + S)*T*(1 + 2*T)*(5 + 2*T))/(2 + T)) + 3*sqrt(((1 + S)*Power(T,3)*(1 + 2*T)*(5 + 2*T))/(2 + T)) + sqrt((1 + S)*T*(2 + T)*(1 + 2*T)*(5 + 2*T)) + 10*sqrt(((1 + S)*T*(5 + 2*T))/(2 + 5*T + 2*Power(T,2)))) + T*(29*sqrt(((1 + S)*T*(1 + 2*T)*(5 + 2*T))/(2 + T)) + 5*sqrt((1 + S)*T*(2 + T)*(1 + 2*T)*(5 + 2*T)) + 2*T*(4*sqrt(((1 + S)*T*(1 + 2*T)*(5 + 2*T))/(2 + T)) + sqrt((1 + S)*T*(2 + T)*(1 + 2*T)*(5 + 2*T)))) + S*(T*(5 + 2*T)*(4*sqrt(((1 + S)*T*(1 + 2*T)*(5 + 2*T))/(2 + T)) + sqrt((1 + S)*T*(2 + T)*(1 + 2*T)*(5 + 2*T))) + 3*(18*sqrt(((1 + S)*T*(1 + 2*T)*(5 + 2*T))/(2 + T)) + 6*sqrt(((1 + S)*Power(T,3)*(1 + 2*T)*(5 + 2*T))/(2 + T)) + sqrt((1 + S)*T*(2 + T)*(1 + 2*T)*(5 + 2*T)) + 10*sqrt(((1 + S)*T*(5 + 2*T))/(2 + 5*T + 2*Power(T,2))))))/((1 + S)*(2 + T)*(3 + 2*T)*(5 + 2*T)*sqrt(((1 + S)*(1 + T)*(3 + T)*(5 + 2*T))/(1 + 2*T))) ;
+          case 90: return 1 ;
+          case 91: return 1 ;
+          case 92: return 1 ;
+          case 93: return 1 ;
+          case 94: return 1 ;
+          case 95: return sqrt(1 - 2/(-1 + T) + 2/T) ;
+          case 96: return sqrt((-6 + 4*T)/(T - 3*Power(T,2) + 2*Power(T,3))) ;
+          case 97: return -(sqrt(2)/sqrt((-1 + T)*T)) ;
+          case 98: return (-3 + Power(T,2))/sqrt(Power(T,2)*(-1 + Power(T,2))) ;
+          case 99: return (sqrt(3)*(-3 + T + 2*Power(T,2)))/(T*sqrt((-1 + T)*(1 + T)*(1 + 2*T)*(3 + 2*T))) ;
+          case 100: return -((sqrt(3)*(-3 + T + 2*Power(T,2)))/(T*sqrt((1 + T)*(3 - 7*T + 4*Power(T,3))))) ;
+          case 101: return 1 - 3/T + 3/(1 + T) ;
+          case 102: return 1/((1 + T)*sqrt((T*(3 + 2*T))/(-6 + 9*T + 6*Power(T,2)))) ;
+          case 103: return sqrt(3)*sqrt(1 + T)*((-3 + T)*T*(-1 + 2*T)*sqrt((1 + 2*T)/(T*Power(1 + T,3)*Power(3 + 2*T,2)*(-2 + 3*T + 2*Power(T,2)))) + 6*sqrt((Power(-1 + T,2)*(-1 + 2*T))/(T*Power(1 + T,3)*Power(3 + 2*T,2)*(2 + 5*T + 2*Power(T,2)))) + (1 - 2*T)*sqrt((T*(1 + 2*T))/(Power(3 + 2*T,2)*(-2 + T + 5*Power(T,2) + 2*Power(T,3)))) + (3*(-3 + 2*T)*sqrt((T*(-1 + 2*T))/(2 + 7*T + 7*Power(T,2) + 2*Power(T,3))))/(3 + 5*T + 2*Power(T,2))) ;
+          case 104: return (-2 + T*(2 + T))/((1 + T)*sqrt(T*(2 + T))) ;
+          case 105: return (sqrt(2 + 2/T)*(45*T*sqrt(T*(1 + T)*(2 + T)*(3 + 2*T)) + 2*(15*sqrt(T*(1 + T)*(2 + T)*(3 + 2*T)) + 9*sqrt(Power(T,5)*(1 + T)*(2 + T)*(3 + 2*T)) + sqrt(Power(T,3)*Power(1 + T,3)*(2 + T)*Power(1 + 2*T,2)*(3 + 2*T)))))/(Power(2 + T,2)*Power((1 + T)*(3 + 2*T),1.5)*(5 + 2*T)) ;
+          case 106: return -((sqrt(2)*(30*sqrt(T*(1 + T)*(2 + T)*(3 + 2*T)) + 47*sqrt(Power(T,3)*(1 + T)*(2 + T)*(3 + 2*T)) + 24*sqrt(Power(T,5)*(1 + T)*(2 + T)*(3 + 2*T)) + 4*sqrt(Power(T,7)*(1 + T)*(2 + T)*(3 + 2*T))))/((1 + T)*Power(2 + T,2)*Power(3 + 2*T,2)*sqrt(T*(5 + 2*T)))) ;
+          case 107: return ((3 + T)*sqrt((T*(1 + T))/(6 + 5*T + Power(T,2))))/(1 + T) ;
+          case 108: return sqrt(-1 + Power(T,2))/T ;
+          case 109: return (-1 + 2*T)/(T*sqrt(-1 + 4*Power(T,2))) ;
+          case 110: return -(1/T) ;
+          case 111: return 1 - 1/T + 1/(1 + T) ;
+          case 112: return 1/(1 + T) ;
+          case 113: return -(sqrt(1 + 2/(1 + 2*T))/(1 + T)) ;
+          case 114: return sqrt(T*(2 + T))/(1 + T) ;
+          case 115: return sqrt(-1 + Power(T,2))/T ;
+          case 116: return sqrt(1 - 2/(1 + 2*T))/T ;
+          case 117: return -(1/T) ;
+          case 118: return 1 - 1/T + 1/(1 + T) ;
+          case 119: return 1/(1 + T) ;
+          case 120: return -(sqrt(1 + 2/(1 + 2*T))/(1 + T)) ;
+          case 121: return (18*sqrt(S*(1 + S)*T*(3 + 2*T)) + 12*T*(3 + T)*sqrt(S*(1 + S)*T*(3 + 2*T)) + 36*sqrt(Power(S,3)*(1 + S)*T*(3 + 2*T)) + 18*sqrt(Power(S,5)*(1 + S)*T*(3 + 2*T)) + 15*sqrt(S*(1 + S)*Power(T,3)*(3 + 2*T)) + 102*sqrt(Power(S,3)*(1 + S)*Power(T,3)*(3 + 2*T)) + 51*sqrt(Power(S,5)*(1 + S)*Power(T,3)*(3 + 2*T)) + 41*sqrt(S*(1 + S)*Power(T,5)*(3 + 2*T)) + 106*sqrt(Power(S,3)*(1 + S)*Power(T,5)*(3 + 2*T)) + 53*sqrt(Power(S,5)*(1 + S)*Power(T,5)*(3 + 2*T)) + 24*sqrt(S*(1 + S)*Power(T,7)*(3 + 2*T)) + 48*sqrt(Power(S,3)*(1 + S)*Power(T,7)*(3 + 2*T)) + 24*sqrt(Power(S,5)*(1 + S)*Power(T,7)*(3 + 2*T)) + 4*sqrt(S*(1 + S)*Power(T,9)*(3 + 2*T)) + 8*sqrt(Power(S,3)*(1 + S)*Power(T,9)*(3 + 2*T)) + 4*sqrt(Power(S,5)*(1 + S)*Power(T,9)*(3 + 2*T)))/(Power(1 + T,2)*sqrt(S*(2 + T))*Power((1 + S)*(3 + 2*T),2.5)) ;
+          case 122: return ((1 + 2*S)*sqrt(((1 + S)*(-1 + T))/((3 + 2*S)*T)) + sqrt((-1 + T)/((3 + 5*S + 2*Power(S,2))*T)) + (1 + 2*S)*sqrt((-1 + T)/((3 + 5*S + 2*Power(S,2))*T)))*sqrt((1 + T)/(3*T + 5*S*T + 2*Power(S,2)*T)) ;
+          case 123: return sqrt((1 + T)/((3 + 5*S + 2*Power(S,2))*T*(1 + 2*T)))*(sqrt((-1 + 2*T)/((3 + 5*S + 2*Power(S,2))*T*(1 + T))) + (1 + 2*S)*sqrt((-1 + 2*T)/((3 + 5*S + 2*Power(S,2))*T*(1 + T))) + (1 + 2*S)*sqrt(((1 + S)*(-1 + 2*T))/((3 + 2*S)*(T + Power(T,2))))) ;
+          case 124: return -(1/T) ;
+          case 125: return 1 - 1/T + 1/(1 + T) ;
+          case 126: return 1/(1 + T) ;
+          case 127: return -(sqrt(1 + 2/(1 + 2*T))/(1 + T)) ;
+          case 128: return sqrt(T*(2 + T))/(1 + T) ;
+          case 129: return sqrt(-1 + Power(T,2))/T ;
+          case 130: return (-1 + 2*T)/(T*sqrt(-1 + 4*Power(T,2))) ;
+          case 131: return -(1/T) ;
+          case 132: return 1 - 1/T + 1/(1 + T) ;
+          case 133: return 1/(1 + T) ;
+          case 134: return -(sqrt(1 + 2/(1 + 2*T))/(1 + T)) ;
+          case 135: return sqrt(T*(2 + T))/(1 + T) ;
+          case 136: return sqrt(-1 + Power(T,2))/T ;
+          case 137: return sqrt(1 - 2/(1 + 2*T))/T ;
+          case 138: return -(1/T) ;
+          case 139: return 1 - 1/T + 1/(1 + T) ;
+          case 140: return 1/(1 + T) ;
+          case 141: return -(sqrt(1 + 2/(1 + 2*T))/(1 + T)) ;
+          case 142: return sqrt(T*(2 + T))/(1 + T) ;
+          case 143: return 1 ;
+          default: my_assert_not_reached();
+        }
+      };
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(0, 1, 1));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -342,10 +3637,270 @@ MatrixElements<SC> SymmetryQST<SC>::recalc_orb_triplet(const DiagInfo<SC> &diag,
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "qst/qst-orb-tripletp.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 2},
+        {3, 3},
+        {4, 2},
+        {4, 3},
+        {4, 4},
+        {5, 5},
+        {6, 5},
+        {6, 6},
+        {7, 5},
+        {7, 6},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {10, 9},
+        {10, 10},
+        {11, 9},
+        {11, 10},
+        {11, 11},
+        {12, 10},
+        {12, 11},
+        {12, 12},
+        {13, 11},
+        {13, 12},
+        {13, 13},
+        {14, 14},
+        {15, 14},
+        {15, 15},
+        {16, 14},
+        {16, 15},
+        {16, 16},
+        {17, 17},
+        {18, 17},
+        {18, 18},
+        {19, 17},
+        {19, 18},
+        {19, 19},
+        {20, 20},
+        {21, 20},
+        {21, 21},
+        {22, 20},
+        {22, 21},
+        {22, 22},
+        {23, 23},
+        {24, 23},
+        {24, 24},
+        {25, 23},
+        {25, 24},
+        {25, 25},
+        {26, 26},
+        {27, 26},
+        {27, 27},
+        {28, 26},
+        {28, 27},
+        {28, 28},
+        {29, 29},
+        {30, 29},
+        {30, 30},
+        {31, 29},
+        {31, 30},
+        {31, 31},
+        {32, 30},
+        {32, 31},
+        {32, 32},
+        {33, 31},
+        {33, 32},
+        {33, 33},
+        {34, 34},
+        {35, 34},
+        {35, 35},
+        {36, 34},
+        {36, 35},
+        {36, 36},
+        {37, 35},
+        {37, 36},
+        {37, 37},
+        {38, 36},
+        {38, 37},
+        {38, 38},
+        {39, 39},
+        {40, 40},
+        {41, 41},
+        {42, 42},
+        {43, 43},
+        {44, 44},
+        {45, 44},
+        {45, 45},
+        {46, 44},
+        {46, 45},
+        {46, 46},
+        {47, 45},
+        {47, 46},
+        {47, 47},
+        {48, 46},
+        {48, 47},
+        {48, 48},
+        {49, 49},
+        {50, 49},
+        {50, 50},
+        {51, 49},
+        {51, 50},
+        {51, 51},
+        {52, 52},
+        {53, 52},
+        {53, 53},
+        {54, 52},
+        {54, 53},
+        {54, 54},
+        {55, 55},
+        {56, 55},
+        {56, 56},
+        {57, 55},
+        {57, 56},
+        {57, 57},
+        {58, 58},
+        {59, 58},
+        {59, 59},
+        {60, 58},
+        {60, 59},
+        {60, 60},
+        {61, 61},
+        {62, 61},
+        {62, 62},
+        {63, 61},
+        {63, 62},
+        {63, 63},
+        {64, 64}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1 ;
+          case 1: return sqrt(-3 + 4*T*(1 + T))/(1 + 2*T) ;
+          case 2: return -(sqrt(1 + 2/(1 + 2*T))/(1 + T)) ;
+          case 3: return sqrt(T*(2 + T))/(1 + T) ;
+          case 4: return 1/(1 + 3*T + 2*Power(T,2)) ;
+          case 5: return -(1/(1 + T)) ;
+          case 6: return 1 ;
+          case 7: return sqrt(-3 + 4*T*(1 + T))/(1 + 2*T) ;
+          case 8: return -(sqrt(1 + 2/(1 + 2*T))/(1 + T)) ;
+          case 9: return sqrt(T*(2 + T))/(1 + T) ;
+          case 10: return 1/(1 + 3*T + 2*Power(T,2)) ;
+          case 11: return -(1/(1 + T)) ;
+          case 12: return 1 ;
+          case 13: return 1 ;
+          case 14: return sqrt((9 - 4*Power(T,2))/(1 - 4*Power(T,2))) ;
+          case 15: return -(1/sqrt((T*(1 + T)*(1 + 2*T))/(6 + 4*T))) ;
+          case 16: return (-2 + T + Power(T,2))/sqrt(((-1 + T)*T*(1 + T)*(2 + T)*Power(1 + 2*T,2))/(-3 + 4*T*(1 + T))) ;
+          case 17: return sqrt(6)/sqrt(T*(1 + T)*(-1 + 2*T)*(1 + 2*T)) ;
+          case 18: return -(((2 + T)*sqrt((-3 + 6*T)/(T*(2 + 5*T + 2*Power(T,2)))))/(1 + T)) ;
+          case 19: return ((2 + T)*(-1 + 2*T)*(5 + 2*T))/((1 + T)*sqrt(((2 + T)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T)*(5 + 2*T))/T)) ;
+          case 20: return 3/(1 + 3*T + 2*Power(T,2)) ;
+          case 21: return (sqrt(3)*T*(2*(-60*sqrt((3 + 2*T)/((1 + T)*(2 + T)*(5 + 2*T))) + sqrt((1 + T)*(2 + T)*(3 + 2*T)*(5 + 2*T))) + T*(-6*(43*sqrt((3 + 2*T)/((1 + T)*(2 + T)*(5 + 2*T))) + sqrt((1 + T)*(2 + T)*(3 + 2*T)*(5 + 2*T))) + T*(-9*sqrt((3 + 2*T)/((1 + T)*(2 + T)*(5 + 2*T))) - 20*sqrt((1 + T)*(2 + T)*(3 + 2*T)*(5 + 2*T)) + 3*T*sqrt((3 + 2*T)/((1 + T)*(2 + T)*(5 + 2*T)))*(95 + 4*T*(16 + 3*T))))))/((1 + T)*Power(2 + T,2)*sqrt(T*(1 + T)*(1 + 2*T)*(3 + 2*T))*(5 + 2*T)) ;
+          case 22: return (T*(3 + T))/sqrt(T*(1 + T)*(2 + T)*(3 + T)) ;
+          case 23: return sqrt(6)/sqrt((1 + T)*(2 + T)*(1 + 2*T)*(3 + 2*T)) ;
+          case 24: return -(sqrt(2)/sqrt((1 + T)*(2 + T))) ;
+          case 25: return 1 ;
+          case 26: return sqrt(-3 + 4*T*(1 + T))/(1 + 2*T) ;
+          case 27: return -(sqrt(1 + 2/(1 + 2*T))/(1 + T)) ;
+          case 28: return sqrt(T*(2 + T))/(1 + T) ;
+          case 29: return 1/(1 + 3*T + 2*Power(T,2)) ;
+          case 30: return -(1/(1 + T)) ;
+          case 31: return 1 ;
+          case 32: return sqrt(-3 + 4*T*(1 + T))/(1 + 2*T) ;
+          case 33: return -(sqrt(1 + 2/(1 + 2*T))/(1 + T)) ;
+          case 34: return (3*(1 + S)*sqrt(Power(S,3)*Power(1 + S,4)*Power(T,3)*Power(1 + T,4)*(2 + T)) + (-1 + T)*T*(Power(S,2)*sqrt(S*Power(1 + S,4)*T*Power(1 + T,4)*(2 + T)) + sqrt(Power(S,3)*Power(1 + S,4)*T*Power(1 + T,4)*(2 + T))))/(Power(S,1.5)*Power(1 + S,3)*T*Power(1 + T,3)*(2 + T)) ;
+          case 35: return 1/(1 + 3*T + 2*Power(T,2)) ;
+          case 36: return (-2*(1 + S)*sqrt(S*(1 + S)*(2 + T)) + T*(-sqrt(S*(1 + S)*(2 + T)) - 4*S*sqrt(S*(1 + S)*(2 + T)) + 3*sqrt(Power(S,3)*(1 + S)*(2 + T))))/sqrt(S*Power(1 + S,3)*Power(1 + T,2)*Power(2 + T,3)) ;
+          case 37: return 1 ;
+          case 38: return sqrt(((1 + T)*(3 + 2*T))/((1 + S)*(3 + 2*S)*T*(1 + 2*T)))*((1 + 2*S)*sqrt(((1 + S)*T*(-1 + 2*T))/((3 + 2*S)*(1 + 3*T + 2*Power(T,2)))) + sqrt((T*(-1 + 2*T))/((3 + 5*S + 2*Power(S,2))*(1 + 3*T + 2*Power(T,2)))) + (1 + 2*S)*sqrt((T*(-1 + 2*T))/((3 + 5*S + 2*Power(S,2))*(1 + 3*T + 2*Power(T,2))))) ;
+          case 39: return -(sqrt(3 + 4*T*(2 + T))/((1 + T)*(1 + 2*T))) ;
+          case 40: return (3*sqrt((T*(3 + 2*T))/(1 + T)) + 3*sqrt((Power(T,3)*(3 + 2*T))/(1 + T)) - sqrt(T*(1 + T)*(3 + 2*T)) + sqrt(Power(T,3)*(1 + T)*(3 + 2*T)))/(Power(1 + T,1.5)*sqrt((2 + T)*(3 + 2*T))) ;
+          case 41: return 1/(1 + 3*T + 2*Power(T,2)) ;
+          case 42: return -(1/(1 + T)) ;
+          case 43: return 1 ;
+          case 44: return sqrt(-3 + 4*T*(1 + T))/(1 + 2*T) ;
+          case 45: return -(sqrt(1 + 2/(1 + 2*T))/(1 + T)) ;
+          case 46: return sqrt(T*(2 + T))/(1 + T) ;
+          case 47: return 1/(1 + 3*T + 2*Power(T,2)) ;
+          case 48: return -(1/(1 + T)) ;
+          case 49: return 1 ;
+          case 50: return sqrt(-3 + 4*T*(1 + T))/(1 + 2*T) ;
+          case 51: return -(sqrt(1 + 2/(1 + 2*T))/(1 + T)) ;
+          case 52: return sqrt(T*(2 + T))/(1 + T) ;
+          case 53: return 1/(1 + 3*T + 2*Power(T,2)) ;
+          case 54: return -(1/(1 + T)) ;
+          case 55: return 1 ;
+          case 56: return sqrt((9 - 4*Power(T,2))/(1 - 4*Power(T,2))) ;
+          case 57: return -(1/sqrt((T*(1 + T)*(1 + 2*T))/(6 + 4*T))) ;
+          case 58: return (-2 + T + Power(T,2))/sqrt(((-1 + T)*T*(1 + T)*(2 + T)*Power(1 + 2*T,2))/(-3 + 4*T*(1 + T))) ;
+          case 59: return sqrt(6)/sqrt(T*(1 + T)*(-1 + 2*T)*(1 + 2*T)) ;
+          case 60: return -(((2 + T)*sqrt((-3 + 6*T)/(T*(2 + 5*T + 2*Power(T,2)))))/(1 + T)) ;
+          case 61: return ((2 + T)*(-1 + 2*T)*(5 + 2*T)*sqrt(T/(-30 - 47*T + 96*Power(T,2) + 184*Power(T,3) + 96*Power(T,4) + 16*Power(T,5))))/(1 + T) ;
+          case 62: return 3/(1 + 3*T + 2*Power(T,2)) ;
+          case 63: return -((sqrt(3)*T*(5 + 2*T))/((1 + T)*sqrt(T*(2 + T)*(1 + 2*T)*(5 + 2*T)))) ;
+          case 64: return sqrt((T*(3 + T))/(2 + 3*T + Power(T,2))) ;
+          case 65: return sqrt(6)/sqrt((1 + T)*(2 + T)*(1 + 2*T)*(3 + 2*T)) ;
+          case 66: return -(sqrt(2)/sqrt((1 + T)*(2 + T))) ;
+          case 67: return 1 ;
+          case 68: return sqrt((9 - 4*Power(T,2))/(1 - 4*Power(T,2))) ;
+          case 69: return -(sqrt(2 + 6/T - 4/(1 + 2*T))/(1 + T)) ;
+          case 70: return (sqrt((3 + 2*T)/(2*T + Power(T,2)))*(6*sqrt((-1 + T)*(1 + T)*(-1 + 2*T)) + 4*sqrt(3 + 2/(-1 + T) + 2*T) + (-5 + T)*T*sqrt(3 + 2/(-1 + T) + 2*T)))/((1 + T)*(1 + 2*T)) ;
+          case 71: return sqrt(6)/sqrt(T*(1 + T)*(-1 + 4*Power(T,2))) ;
+          case 72: return -((sqrt(3)*sqrt(-1 - 2/T + 8*T + 4*Power(T,2)))/(1 + 3*T + 2*Power(T,2))) ;
+          case 73: return (sqrt((1 + 2*S)*(1 + T)*(3 + 2*T))*((2*S*(2 + T)*(1 + 2*T)*(5 + 2*T)*sqrt((T*(-1 + T + 2*Power(T,2)))/((1 + 2*S)*(10 + 29*T + 20*Power(T,2) + 4*Power(T,3))))*(1 + T*(-9 + 2*T)))/((1 + T)*(3 + 2*T)) + (9*sqrt(T*(1 + T))*Power((1 + 2*S)*(2 + T)*(-1 + 2*T)*(1 + 2*T)*(5 + 2*T),1.5) + 121*Power(T,1.5)*sqrt((1 + 2*S)*(1 + T)*(2 + T)*(-1 + 2*T)*(1 + 2*T)*(5 + 2*T)) + 136*Power(T,2.5)*sqrt((1 + 2*S)*(1 + T)*(2 + T)*(-1 + 2*T)*(1 + 2*T)*(5 + 2*T)) + 88*Power(T,3.5)*sqrt((1 + 2*S)*(1 + T)*(2 + T)*(-1 + 2*T)*(1 + 2*T)*(5 + 2*T)) + 64*Power(T,4.5)*sqrt((1 + 2*S)*(1 + T)*(2 + T)*(-1 + 2*T)*(1 + 2*T)*(5 + 2*T)) + 16*Power(T,5.5)*sqrt((1 + 2*S)*(1 + T)*(2 + T)*(-1 + 2*T)*(1 + 2*T)*(5 + 2*T)) - 110*sqrt((1 + 2*S)*T*(1 + T)*(2 + T)*(-1 + 2*T)*(1 + 2*T)*(5 + 2*T)))/((1 + 2*S)*(1 + T)*(2 + T)*(-1 + 2*T)*(3 + 2*T)*(5 + 2*T))))/(2.*(1 + S)*(1 + T)*(2 + T)*(1 + 2*T)*(5 + 2*T)) ;
+          case 74: return 3/(1 + 3*T + 2*Power(T,2)) ;
+          case 75: return -((sqrt(3)*(10*sqrt(T*(1 + T)*(2 + T)*(1 + 2*T)*(3 + 2*T)*(5 + 2*T)) + 9*sqrt(Power(T,3)*(1 + T)*(2 + T)*(1 + 2*T)*(3 + 2*T)*(5 + 2*T)) + 2*sqrt(Power(T,5)*(1 + T)*(2 + T)*(1 + 2*T)*(3 + 2*T)*(5 + 2*T))))/(Power(1 + T,1.5)*Power(2 + T,2)*(1 + 2*T)*sqrt(3 + 2*T)*(5 + 2*T))) ;
+          case 76: return (600*sqrt(T*(3 + T)*(3 + 2*T)) + 2180*sqrt(Power(T,3)*(3 + T)*(3 + 2*T)) + 3306*sqrt(Power(T,5)*(3 + T)*(3 + 2*T)) + 2727*sqrt(Power(T,7)*(3 + T)*(3 + 2*T)) + 1326*sqrt(Power(T,9)*(3 + T)*(3 + 2*T)) + 381*sqrt(Power(T,11)*(3 + T)*(3 + 2*T)) + 60*sqrt(Power(T,13)*(3 + T)*(3 + 2*T)) + 4*sqrt(Power(T,15)*(3 + T)*(3 + 2*T)))/(Power(1 + T,1.5)*Power(2 + T,3.5)*(3 + T)*sqrt(3 + 2*T)*Power(5 + 2*T,2)) ;
+          case 77: return sqrt(6)/sqrt((1 + T)*(2 + T)*(1 + 2*T)*(3 + 2*T)) ;
+          case 78: return -(sqrt(2)/sqrt((1 + T)*(2 + T))) ;
+          case 79: return 1 ;
+          case 80: return 1 ;
+          case 81: return 1 ;
+          case 82: return 1 ;
+          case 83: return 1 ;
+          case 84: return 1 ;
+          case 85: return sqrt((9 - 4*Power(T,2))/(1 - 4*Power(T,2))) ;
+          case 86: return -(1/sqrt((T*(1 + T)*(1 + 2*T))/(6 + 4*T))) ;
+          case 87: return (-2 + T + Power(T,2))/sqrt(((-1 + T)*T*(1 + T)*(2 + T)*Power(1 + 2*T,2))/(-3 + 4*T*(1 + T))) ;
+          case 88: return sqrt(6)/sqrt(T*(1 + T)*(-1 + 2*T)*(1 + 2*T)) ;
+          case 89: return -(((2 + T)*sqrt((-3 + 6*T)/(T*(2 + 5*T + 2*Power(T,2)))))/(1 + T)) ;
+          case 90: return ((2 + T)*(-1 + 2*T)*(5 + 2*T))/((1 + T)*sqrt(((2 + T)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T)*(5 + 2*T))/T)) ;
+          case 91: return 3/(1 + 3*T + 2*Power(T,2)) ;
+          case 92: return (sqrt(3)*T*(2*(-60*sqrt((3 + 2*T)/((1 + T)*(2 + T)*(5 + 2*T))) + sqrt((1 + T)*(2 + T)*(3 + 2*T)*(5 + 2*T))) + T*(-6*(43*sqrt((3 + 2*T)/((1 + T)*(2 + T)*(5 + 2*T))) + sqrt((1 + T)*(2 + T)*(3 + 2*T)*(5 + 2*T))) + T*(-9*sqrt((3 + 2*T)/((1 + T)*(2 + T)*(5 + 2*T))) - 20*sqrt((1 + T)*(2 + T)*(3 + 2*T)*(5 + 2*T)) + 3*T*sqrt((3 + 2*T)/((1 + T)*(2 + T)*(5 + 2*T)))*(95 + 4*T*(16 + 3*T))))))/((1 + T)*Power(2 + T,2)*sqrt(T*(1 + T)*(1 + 2*T)*(3 + 2*T))*(5 + 2*T)) ;
+          case 93: return (T*(3 + T))/sqrt(T*(1 + T)*(2 + T)*(3 + T)) ;
+          case 94: return sqrt(6)/sqrt((1 + T)*(2 + T)*(1 + 2*T)*(3 + 2*T)) ;
+          case 95: return -(sqrt(2)/sqrt((1 + T)*(2 + T))) ;
+          case 96: return 1 ;
+          case 97: return sqrt(-3 + 4*T*(1 + T))/(1 + 2*T) ;
+          case 98: return -(sqrt(1 + 2/(1 + 2*T))/(1 + T)) ;
+          case 99: return sqrt(T*(2 + T))/(1 + T) ;
+          case 100: return 1/(1 + 3*T + 2*Power(T,2)) ;
+          case 101: return -(1/(1 + T)) ;
+          case 102: return 1 ;
+          case 103: return sqrt(-3 + 4*T*(1 + T))/(1 + 2*T) ;
+          case 104: return -(sqrt(1 + 2/(1 + 2*T))/(1 + T)) ;
+          case 105: return (3*(1 + S)*sqrt(Power(S,3)*Power(1 + S,4)*Power(T,3)*Power(1 + T,4)*(2 + T)) + (-1 + T)*T*(Power(S,2)*sqrt(S*Power(1 + S,4)*T*Power(1 + T,4)*(2 + T)) + sqrt(Power(S,3)*Power(1 + S,4)*T*Power(1 + T,4)*(2 + T))))/(Power(S,1.5)*Power(1 + S,3)*T*Power(1 + T,3)*(2 + T)) ;
+          case 106: return 1/(1 + 3*T + 2*Power(T,2)) ;
+          case 107: return (-2*(1 + S)*sqrt(S*(1 + S)*(2 + T)) + T*(-sqrt(S*(1 + S)*(2 + T)) - 4*S*sqrt(S*(1 + S)*(2 + T)) + 3*sqrt(Power(S,3)*(1 + S)*(2 + T))))/sqrt(S*Power(1 + S,3)*Power(1 + T,2)*Power(2 + T,3)) ;
+          case 108: return 1 ;
+          case 109: return sqrt(((1 + T)*(3 + 2*T))/((1 + S)*(3 + 2*S)*T*(1 + 2*T)))*((1 + 2*S)*sqrt(((1 + S)*T*(-1 + 2*T))/((3 + 2*S)*(1 + 3*T + 2*Power(T,2)))) + sqrt((T*(-1 + 2*T))/((3 + 5*S + 2*Power(S,2))*(1 + 3*T + 2*Power(T,2)))) + (1 + 2*S)*sqrt((T*(-1 + 2*T))/((3 + 5*S + 2*Power(S,2))*(1 + 3*T + 2*Power(T,2))))) ;
+          case 110: return -(sqrt(3 + 4*T*(2 + T))/((1 + T)*(1 + 2*T))) ;
+          case 111: return (3*sqrt((T*(3 + 2*T))/(1 + T)) + 3*sqrt((Power(T,3)*(3 + 2*T))/(1 + T)) - sqrt(T*(1 + T)*(3 + 2*T)) + sqrt(Power(T,3)*(1 + T)*(3 + 2*T)))/(Power(1 + T,1.5)*sqrt((2 + T)*(3 + 2*T))) ;
+          case 112: return 1/(1 + 3*T + 2*Power(T,2)) ;
+          case 113: return -(1/(1 + T)) ;
+          case 114: return 1 ;
+          case 115: return sqrt(-3 + 4*T*(1 + T))/(1 + 2*T) ;
+          case 116: return -(sqrt(1 + 2/(1 + 2*T))/(1 + T)) ;
+          case 117: return sqrt(T*(2 + T))/(1 + T) ;
+          case 118: return 1/(1 + 3*T + 2*Power(T,2)) ;
+          case 119: return -(1/(1 + T)) ;
+          case 120: return 1 ;
+          case 121: return sqrt(-3 + 4*T*(1 + T))/(1 + 2*T) ;
+          case 122: return -(sqrt(1 + 2/(1 + 2*T))/(1 + T)) ;
+          case 123: return sqrt(T*(2 + T))/(1 + T) ;
+          case 124: return 1/(1 + 3*T + 2*Power(T,2)) ;
+          case 125: return -(1/(1 + T)) ;
+          case 126: return 1 ;
+          case 127: return 1 ;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(0, 1, 1));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(0, 1, 1));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -357,10 +3912,270 @@ MatrixElements<SC> SymmetryQST<SC>::recalc_orb_triplet(const DiagInfo<SC> &diag,
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "qst/qst-orb-tripletm.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {2, 3},
+        {2, 4},
+        {3, 3},
+        {3, 4},
+        {4, 4},
+        {5, 5},
+        {5, 6},
+        {5, 7},
+        {6, 6},
+        {6, 7},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {9, 10},
+        {9, 11},
+        {10, 10},
+        {10, 11},
+        {10, 12},
+        {11, 11},
+        {11, 12},
+        {11, 13},
+        {12, 12},
+        {12, 13},
+        {13, 13},
+        {14, 14},
+        {14, 15},
+        {14, 16},
+        {15, 15},
+        {15, 16},
+        {16, 16},
+        {17, 17},
+        {17, 18},
+        {17, 19},
+        {18, 18},
+        {18, 19},
+        {19, 19},
+        {20, 20},
+        {20, 21},
+        {20, 22},
+        {21, 21},
+        {21, 22},
+        {22, 22},
+        {23, 23},
+        {23, 24},
+        {23, 25},
+        {24, 24},
+        {24, 25},
+        {25, 25},
+        {26, 26},
+        {26, 27},
+        {26, 28},
+        {27, 27},
+        {27, 28},
+        {28, 28},
+        {29, 29},
+        {29, 30},
+        {29, 31},
+        {30, 30},
+        {30, 31},
+        {30, 32},
+        {31, 31},
+        {31, 32},
+        {31, 33},
+        {32, 32},
+        {32, 33},
+        {33, 33},
+        {34, 34},
+        {34, 35},
+        {34, 36},
+        {35, 35},
+        {35, 36},
+        {35, 37},
+        {36, 36},
+        {36, 37},
+        {36, 38},
+        {37, 37},
+        {37, 38},
+        {38, 38},
+        {39, 39},
+        {40, 40},
+        {41, 41},
+        {42, 42},
+        {43, 43},
+        {44, 44},
+        {44, 45},
+        {44, 46},
+        {45, 45},
+        {45, 46},
+        {45, 47},
+        {46, 46},
+        {46, 47},
+        {46, 48},
+        {47, 47},
+        {47, 48},
+        {48, 48},
+        {49, 49},
+        {49, 50},
+        {49, 51},
+        {50, 50},
+        {50, 51},
+        {51, 51},
+        {52, 52},
+        {52, 53},
+        {52, 54},
+        {53, 53},
+        {53, 54},
+        {54, 54},
+        {55, 55},
+        {55, 56},
+        {55, 57},
+        {56, 56},
+        {56, 57},
+        {57, 57},
+        {58, 58},
+        {58, 59},
+        {58, 60},
+        {59, 59},
+        {59, 60},
+        {60, 60},
+        {61, 61},
+        {61, 62},
+        {61, 63},
+        {62, 62},
+        {62, 63},
+        {63, 63},
+        {64, 64}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1 ;
+          case 1: return 1 ;
+          case 2: return 1/T ;
+          case 3: return 1/(T + 2*Power(T,2)) ;
+          case 4: return sqrt(-1 + Power(T,2))/T ;
+          case 5: return sqrt(1 - 2/(1 + 2*T))/T ;
+          case 6: return (sqrt(T*(1 + T)*(-1 + 2*T)*(1 + 2*T)) + sqrt((T*(-1 + 2*T))/(1 + 3*T + 2*Power(T,2))) + sqrt((T*(-1 + 4*Power(T,2)))/(1 + T)))/sqrt(T*(1 + T)*(1 + 2*T)*(3 + 2*T)) ;
+          case 7: return 1 ;
+          case 8: return 1/T ;
+          case 9: return 1/(T + 2*Power(T,2)) ;
+          case 10: return sqrt(-1 + Power(T,2))/T ;
+          case 11: return sqrt(-1 + 4*Power(T,2))/(T + 2*Power(T,2)) ;
+          case 12: return sqrt(-3 + 4*T*(1 + T))/(1 + 2*T) ;
+          case 13: return 1 ;
+          case 14: return 1 ;
+          case 15: return sqrt(2)/sqrt((-1 + T)*T) ;
+          case 16: return sqrt(6)/sqrt((-1 + T)*T*(-1 + 2*T)*(1 + 2*T)) ;
+          case 17: return ((1 + T)*sqrt(((-2 + T)*T)/(-1 + Power(T,2))))/T ;
+          case 18: return ((1 + T)*sqrt(3 - 30/(1 + T) + 36/(1 + 2*T)))/((-1 + T)*T) ;
+          case 19: return 3/(T + 2*Power(T,2)) ;
+          case 20: return (9 - 13*Power(T,2) + 4*Power(T,4))/(T*sqrt(-9 + Power(T,2)*Power(7 - 4*Power(T,2),2))) ;
+          case 21: return (sqrt(3)*(-3 + T + 2*Power(T,2)))/(T*sqrt((-1 + T)*(1 + T)*(1 + 2*T)*(3 + 2*T))) ;
+          case 22: return sqrt(6)/sqrt(T*(1 + T)*(1 + 2*T)*(3 + 2*T)) ;
+          case 23: return (6*sqrt(((-1 + T)*T*(2 + T)*(-1 + 2*T)*(3 + 2*T))/(1 + 2*T)) - 9*sqrt((Power(T,3)*(2 + T)*(-1 + 2*T)*(3 + 2*T))/((-1 + T)*(1 + 2*T))) + 9*sqrt((Power(T,5)*(2 + T)*(-1 + 2*T)*(3 + 2*T))/((-1 + T)*(1 + 2*T))) - 4*sqrt((Power(T,3)*(2 + T)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T))/(-1 + T)) + 3*sqrt((Power(T,5)*(2 + T)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T))/(-1 + T)) + sqrt((Power(T,7)*(2 + T)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T))/(-1 + T)))/(T*Power(1 + T,1.5)*(2 + T)*sqrt(1 + 2*T)*(3 + 2*T)) ;
+          case 24: return sqrt((-2 + 4*T)/(T + 3*Power(T,2) + 2*Power(T,3))) ;
+          case 25: return (5 + 2*T)*sqrt((-1 + 2*T)/(15 + 46*T + 36*Power(T,2) + 8*Power(T,3))) ;
+          case 26: return 1 ;
+          case 27: return 1/T ;
+          case 28: return 1/(T + 2*Power(T,2)) ;
+          case 29: return sqrt(-1 + Power(T,2))/T ;
+          case 30: return sqrt(1 - 2/(1 + 2*T))/T ;
+          case 31: return (sqrt(T*(1 + T)*(-1 + 2*T)*(1 + 2*T)) + sqrt((T*(-1 + 2*T))/(1 + 3*T + 2*Power(T,2))) + sqrt((T*(-1 + 4*Power(T,2)))/(1 + T)))/sqrt(T*(1 + T)*(1 + 2*T)*(3 + 2*T)) ;
+          case 32: return 1 ;
+          case 33: return 1/T ;
+          case 34: return 1/(T + 2*Power(T,2)) ;
+          case 35: return ((-1 + T)*(-sqrt((1 + S)*T*(1 + T)) + sqrt((1 + S)*Power(T,5)*(1 + T)) + S*sqrt((1 + S)*T*(1 + T))*(-1 + Power(T,2))))/(Power((1 + S)*(-1 + T)*T,1.5)*(1 + T)) ;
+          case 36: return (Power(S,1.5)*Power(1 + S,2)*Power(T,2.5)*Power(1 + T,2)*sqrt(-1 + 4*Power(T,2)) + sqrt(S*Power(1 + S,4)*Power(T,3)*Power(1 + T,4)*(-1 + 4*Power(T,2))) + S*sqrt(S*Power(1 + S,4)*Power(T,3)*Power(1 + T,4)*(-1 + 4*Power(T,2))) + T*sqrt(S*Power(1 + S,4)*Power(T,3)*Power(1 + T,4)*(-1 + 4*Power(T,2))))/(sqrt(S)*Power(1 + S,3)*Power(T,2.5)*Power(1 + T,3)*(1 + 2*T)) ;
+          case 37: return (sqrt(S/(3 + 5*T + 2*Power(T,2)))*(sqrt(((1 + S)*(-1 + 2*T))/(S*(1 + T))) + sqrt((S*(1 + S)*(-1 + 2*T))/(1 + T)) + sqrt(((1 + S)*(-1 + 2*T))/(S*(1 + T)))*(1 + 2*T) + S*sqrt(((1 + S)*(-1 + 2*T))/(S*(1 + T)))*(1 + 2*T) + (1 + 2*T)*sqrt(((1 + S)*(-1 + T + 2*Power(T,2)))/S) + (1 + 2*T)*sqrt(S*(1 + S)*(-1 + T + 2*Power(T,2)))))/(Power(1 + S,1.5)*(1 + 2*T)) ;
+          case 38: return 1 ;
+          case 39: return 1/T ;
+          case 40: return 1/(T + 2*Power(T,2)) ;
+          case 41: return sqrt(-1 + Power(T,2))/T ;
+          case 42: return (sqrt(1 + 2*S)*(sqrt(((1 + S)*(3 + 2*S)*T*(1 + T)*(-1 + 2*T)*(1 + 2*T))/(1 + 2*S)) + sqrt((1 + S)*(1 + 2*S)*(3 + 2*S)*T*(1 + T)*(-1 + 2*T)*(1 + 2*T)) + sqrt(Power(1 + S,3)*(3 + 4*S*(2 + S))*T*(1 + T)*(-1 + 2*T)*(1 + 2*T)) + T*sqrt(Power(1 + S,3)*(3 + 4*S*(2 + S))*T*(1 + T)*(-1 + 2*T)*(1 + 2*T)) + sqrt(((1 + S)*(3 + 2*S)*Power(T,3)*(1 + T)*(-1 + 2*T)*(1 + 2*T))/(1 + 2*S)) + sqrt((1 + S)*(1 + 2*S)*(3 + 2*S)*Power(T,3)*(1 + T)*(-1 + 2*T)*(1 + 2*T))))/(Power((1 + S)*(3 + 2*S)*T*(1 + T),1.5)*(1 + 2*T)) ;
+          case 43: return sqrt(-3 + 4*T*(1 + T))/(1 + 2*T) ;
+          case 44: return 1 ;
+          case 45: return 1/T ;
+          case 46: return 1/(T + 2*Power(T,2)) ;
+          case 47: return sqrt(-1 + Power(T,2))/T ;
+          case 48: return sqrt(1 - 2/(1 + 2*T))/T ;
+          case 49: return (sqrt(T*(1 + T)*(-1 + 2*T)*(1 + 2*T)) + sqrt((T*(-1 + 2*T))/(1 + 3*T + 2*Power(T,2))) + sqrt((T*(-1 + 4*Power(T,2)))/(1 + T)))/sqrt(T*(1 + T)*(1 + 2*T)*(3 + 2*T)) ;
+          case 50: return 1 ;
+          case 51: return 1/T ;
+          case 52: return 1/(T + 2*Power(T,2)) ;
+          case 53: return sqrt(-1 + Power(T,2))/T ;
+          case 54: return sqrt(-1 + 4*Power(T,2))/(T + 2*Power(T,2)) ;
+          case 55: return sqrt(-3 + 4*T*(1 + T))/(1 + 2*T) ;
+          case 56: return 1 ;
+          case 57: return sqrt(2)/sqrt((-1 + T)*T) ;
+          case 58: return sqrt(6)/sqrt((-1 + T)*T*(-1 + 2*T)*(1 + 2*T)) ;
+          case 59: return ((1 + T)*sqrt(((-2 + T)*T)/(-1 + Power(T,2))))/T ;
+          case 60: return ((1 + T)*sqrt(3 - 30/(1 + T) + 36/(1 + 2*T)))/((-1 + T)*T) ;
+          case 61: return 3/(T + 2*Power(T,2)) ;
+          case 62: return (9 - 13*Power(T,2) + 4*Power(T,4))/(T*sqrt(-9 + Power(T,2)*Power(7 - 4*Power(T,2),2))) ;
+          case 63: return (sqrt(3)*(-3 + T + 2*Power(T,2)))/(T*sqrt((-1 + T)*(1 + T)*(1 + 2*T)*(3 + 2*T))) ;
+          case 64: return sqrt(6)/sqrt(T*(1 + T)*(1 + 2*T)*(3 + 2*T)) ;
+          case 65: return (6*sqrt(((-1 + T)*T*(2 + T)*(-1 + 2*T)*(3 + 2*T))/(1 + 2*T)) - 9*sqrt((Power(T,3)*(2 + T)*(-1 + 2*T)*(3 + 2*T))/((-1 + T)*(1 + 2*T))) + 9*sqrt((Power(T,5)*(2 + T)*(-1 + 2*T)*(3 + 2*T))/((-1 + T)*(1 + 2*T))) - 4*sqrt((Power(T,3)*(2 + T)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T))/(-1 + T)) + 3*sqrt((Power(T,5)*(2 + T)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T))/(-1 + T)) + sqrt((Power(T,7)*(2 + T)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T))/(-1 + T)))/(T*Power(1 + T,1.5)*(2 + T)*sqrt(1 + 2*T)*(3 + 2*T)) ;
+          case 66: return sqrt((-2 + 4*T)/(T + 3*Power(T,2) + 2*Power(T,3))) ;
+          case 67: return (sqrt(T*(2 + T)*(-1 + 2*T)*(3 + 2*T)) + 2*sqrt(Power(T,3)*(2 + T)*(-1 + 2*T)*(3 + 2*T)) + 18*sqrt((T*(-1 + 2*T))/(6 + 7*T + 2*Power(T,2))) + 2*sqrt((T*(-3 + 4*T*(1 + T)))/(2 + T)) + 4*T*(3*sqrt((T*(-1 + 2*T))/(6 + 7*T + 2*Power(T,2))) + sqrt((T*(-3 + 4*T*(1 + T)))/(2 + T))))/((3 + 2*T)*sqrt(T*(2 + T)*(1 + 2*T)*(5 + 2*T))) ;
+          case 68: return 1 ;
+          case 69: return sqrt(2)/sqrt((-1 + T)*T) ;
+          case 70: return sqrt(6)/sqrt((-1 + T)*T*(-1 + 2*T)*(1 + 2*T)) ;
+          case 71: return ((-2 + T)*(1 + T))/sqrt((-2 + T)*(-1 + T)*T*(1 + T)) ;
+          case 72: return (sqrt(3)*(1 + T)*(-3 + 2*T))/(T*sqrt((-1 + T)*(1 + T)*(-3 + 2*T)*(1 + 2*T))) ;
+          case 73: return 3/(T + 2*Power(T,2)) ;
+          case 74: return (9 - 13*Power(T,2) + 4*Power(T,4))/(T*sqrt(-9 + Power(T,2)*Power(7 - 4*Power(T,2),2))) ;
+          case 75: return (sqrt(3)*(-3 + T + 2*Power(T,2)))/(T*sqrt((-1 + Power(T,2))*(3 + 4*T*(2 + T)))) ;
+          case 76: return sqrt(6)/sqrt(T*(1 + T)*(1 + 2*T)*(3 + 2*T)) ;
+          case 77: return (6*sqrt((-1 + T)*(1 + T)*(-1 + 2*T)) + (-1 + T)*T*sqrt(3 + 2/(-1 + T) + 2*T)*(13 + T*(9 + 2*T)))/(Power(1 + T,2)*(1 + 2*T)*sqrt(T*(2 + T)*(3 + 2*T))) ;
+          case 78: return (sqrt(2)*(-1 + 2*T))/sqrt(T*(1 + T)*(-1 + 2*T)*(1 + 2*T)) ;
+          case 79: return (12*sqrt(((1 + S)*T*(-1 + 2*T)*(1 + 2*T)*(5 + 2*T))/((2 + T)*(3 + 2*T))) + 2*sqrt(((1 + S)*T*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T)*(5 + 2*T))/(2 + T)) + sqrt((1 + S)*T*(2 + T)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T)*(5 + 2*T)) + 6*sqrt(((1 + S)*T*(-5 + 8*T + 4*Power(T,2)))/(6 + 19*T + 16*Power(T,2) + 4*Power(T,3))) + T*(6*sqrt(((1 + S)*T*(-1 + 2*T)*(1 + 2*T)*(5 + 2*T))/((2 + T)*(3 + 2*T))) + 2*sqrt(((1 + S)*T*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T)*(5 + 2*T))/(2 + T)) + sqrt((1 + S)*T*(2 + T)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T)*(5 + 2*T))))/((1 + T)*sqrt((1 + S)*T*(2 + T))*(3 + 2*T)*(5 + 2*T)) ;
+          case 80: return 1 ;
+          case 81: return 1 ;
+          case 82: return 1 ;
+          case 83: return 1 ;
+          case 84: return 1 ;
+          case 85: return 1 ;
+          case 86: return sqrt(2)/sqrt((-1 + T)*T) ;
+          case 87: return sqrt(6)/sqrt((-1 + T)*T*(-1 + 2*T)*(1 + 2*T)) ;
+          case 88: return ((1 + T)*sqrt(((-2 + T)*T)/(-1 + Power(T,2))))/T ;
+          case 89: return ((1 + T)*sqrt(3 - 30/(1 + T) + 36/(1 + 2*T)))/((-1 + T)*T) ;
+          case 90: return 3/(T + 2*Power(T,2)) ;
+          case 91: return (9 - 13*Power(T,2) + 4*Power(T,4))/(T*sqrt(-9 + Power(T,2)*Power(7 - 4*Power(T,2),2))) ;
+          case 92: return (sqrt(3)*(-3 + T + 2*Power(T,2)))/(T*sqrt((-1 + T)*(1 + T)*(1 + 2*T)*(3 + 2*T))) ;
+          case 93: return sqrt(6)/sqrt(T*(1 + T)*(1 + 2*T)*(3 + 2*T)) ;
+          case 94: return (6*sqrt(((-1 + T)*T*(2 + T)*(-1 + 2*T)*(3 + 2*T))/(1 + 2*T)) - 9*sqrt((Power(T,3)*(2 + T)*(-1 + 2*T)*(3 + 2*T))/((-1 + T)*(1 + 2*T))) + 9*sqrt((Power(T,5)*(2 + T)*(-1 + 2*T)*(3 + 2*T))/((-1 + T)*(1 + 2*T))) - 4*sqrt((Power(T,3)*(2 + T)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T))/(-1 + T)) + 3*sqrt((Power(T,5)*(2 + T)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T))/(-1 + T)) + sqrt((Power(T,7)*(2 + T)*(-1 + 2*T)*(1 + 2*T)*(3 + 2*T))/(-1 + T)))/(T*Power(1 + T,1.5)*(2 + T)*sqrt(1 + 2*T)*(3 + 2*T)) ;
+          case 95: return sqrt((-2 + 4*T)/(T + 3*Power(T,2) + 2*Power(T,3))) ;
+          case 96: return (5 + 2*T)*sqrt((-1 + 2*T)/(15 + 46*T + 36*Power(T,2) + 8*Power(T,3))) ;
+          case 97: return 1 ;
+          case 98: return 1/T ;
+          case 99: return 1/(T + 2*Power(T,2)) ;
+          case 100: return sqrt(-1 + Power(T,2))/T ;
+          case 101: return sqrt(1 - 2/(1 + 2*T))/T ;
+          case 102: return (sqrt(T*(1 + T)*(-1 + 2*T)*(1 + 2*T)) + sqrt((T*(-1 + 2*T))/(1 + 3*T + 2*Power(T,2))) + sqrt((T*(-1 + 4*Power(T,2)))/(1 + T)))/sqrt(T*(1 + T)*(1 + 2*T)*(3 + 2*T)) ;
+          case 103: return 1 ;
+          case 104: return 1/T ;
+          case 105: return 1/(T + 2*Power(T,2)) ;
+          case 106: return ((-1 + T)*(-sqrt((1 + S)*T*(1 + T)) + sqrt((1 + S)*Power(T,5)*(1 + T)) + S*sqrt((1 + S)*T*(1 + T))*(-1 + Power(T,2))))/(Power((1 + S)*(-1 + T)*T,1.5)*(1 + T)) ;
+          case 107: return (Power(S,1.5)*Power(1 + S,2)*Power(T,2.5)*Power(1 + T,2)*sqrt(-1 + 4*Power(T,2)) + sqrt(S*Power(1 + S,4)*Power(T,3)*Power(1 + T,4)*(-1 + 4*Power(T,2))) + S*sqrt(S*Power(1 + S,4)*Power(T,3)*Power(1 + T,4)*(-1 + 4*Power(T,2))) + T*sqrt(S*Power(1 + S,4)*Power(T,3)*Power(1 + T,4)*(-1 + 4*Power(T,2))))/(sqrt(S)*Power(1 + S,3)*Power(T,2.5)*Power(1 + T,3)*(1 + 2*T)) ;
+          case 108: return (sqrt(S/(3 + 5*T + 2*Power(T,2)))*(sqrt(((1 + S)*(-1 + 2*T))/(S*(1 + T))) + sqrt((S*(1 + S)*(-1 + 2*T))/(1 + T)) + sqrt(((1 + S)*(-1 + 2*T))/(S*(1 + T)))*(1 + 2*T) + S*sqrt(((1 + S)*(-1 + 2*T))/(S*(1 + T)))*(1 + 2*T) + (1 + 2*T)*sqrt(((1 + S)*(-1 + T + 2*Power(T,2)))/S) + (1 + 2*T)*sqrt(S*(1 + S)*(-1 + T + 2*Power(T,2)))))/(Power(1 + S,1.5)*(1 + 2*T)) ;
+          case 109: return 1 ;
+          case 110: return 1/T ;
+          case 111: return 1/(T + 2*Power(T,2)) ;
+          case 112: return sqrt(-1 + Power(T,2))/T ;
+          case 113: return (sqrt(1 + 2*S)*(sqrt(((1 + S)*(3 + 2*S)*T*(1 + T)*(-1 + 2*T)*(1 + 2*T))/(1 + 2*S)) + sqrt((1 + S)*(1 + 2*S)*(3 + 2*S)*T*(1 + T)*(-1 + 2*T)*(1 + 2*T)) + sqrt(Power(1 + S,3)*(3 + 4*S*(2 + S))*T*(1 + T)*(-1 + 2*T)*(1 + 2*T)) + T*sqrt(Power(1 + S,3)*(3 + 4*S*(2 + S))*T*(1 + T)*(-1 + 2*T)*(1 + 2*T)) + sqrt(((1 + S)*(3 + 2*S)*Power(T,3)*(1 + T)*(-1 + 2*T)*(1 + 2*T))/(1 + 2*S)) + sqrt((1 + S)*(1 + 2*S)*(3 + 2*S)*Power(T,3)*(1 + T)*(-1 + 2*T)*(1 + 2*T))))/(Power((1 + S)*(3 + 2*S)*T*(1 + T),1.5)*(1 + 2*T)) ;
+          case 114: return sqrt(-3 + 4*T*(1 + T))/(1 + 2*T) ;
+          case 115: return 1 ;
+          case 116: return 1/T ;
+          case 117: return 1/(T + 2*Power(T,2)) ;
+          case 118: return sqrt(-1 + Power(T,2))/T ;
+          case 119: return sqrt(1 - 2/(1 + 2*T))/T ;
+          case 120: return (sqrt(T*(1 + T)*(-1 + 2*T)*(1 + 2*T)) + sqrt((T*(-1 + 2*T))/(1 + 3*T + 2*Power(T,2))) + sqrt((T*(-1 + 4*Power(T,2)))/(1 + T)))/sqrt(T*(1 + T)*(1 + 2*T)*(3 + 2*T)) ;
+          case 121: return 1 ;
+          case 122: return 1/T ;
+          case 123: return 1/(T + 2*Power(T,2)) ;
+          case 124: return sqrt(-1 + Power(T,2))/T ;
+          case 125: return sqrt(-1 + 4*Power(T,2))/(T + 2*Power(T,2)) ;
+          case 126: return sqrt(-3 + 4*T*(1 + T))/(1 + 2*T) ;
+          case 127: return 1 ;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(0, 1, 1));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(0, 1, 1));
       if (cn) cnew[II] = *cn;
     }
   }
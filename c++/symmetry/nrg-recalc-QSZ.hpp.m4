@@ -13,6 +13,7 @@ include(recalc-macros.m4)
 template<typename SC>
 MatrixElements<SC> SymmetryQSZ<SC>::recalc_doublet(const DiagInfo<SC> &diag, const SubspaceStructure &substruct, const MatrixElements<SC> &cold) const {
   MatrixElements<SC> cnew;
+  const auto blocks = std::make_shared<const BlockIndex<SC>>(cold, substruct);
   if (!P.substeps) {
     for(const auto &[I1, eig]: diag) {
       int q1   = I1.get("Q");
@@ -105,6 +106,7 @@ OpchChannel<SC> SymmetryQSZ<SC>::recalc_irreduc_substeps(const Step &step, const
 template<typename SC>
 MatrixElements<SC> SymmetryQSZ<SC>::recalc_triplet(const DiagInfo<SC> &diag, const SubspaceStructure &substruct, const MatrixElements<SC> &cold) const {
   MatrixElements<SC> cnew;
+  const auto blocks = std::make_shared<const BlockIndex<SC>>(cold, substruct);
   if (!P.substeps) {
     for(const auto &[I1, eig]: diag) {
       int q1   = I1.get("Q");
@@ -31,6 +31,7 @@ namespace NRG {
 template<typename SC>
 MatrixElements<SC> SymmetryQSZTZ<SC>::recalc_doublet(const DiagInfo<SC> &diag, const SubspaceStructure &substruct, const MatrixElements<SC> &cold) const {
   MatrixElements<SC> cnew;
+  const auto blocks = std::make_shared<const BlockIndex<SC>>(cold, substruct);
   for(const auto &[I1, eig]: diag) {
     int q1   = I1.get("Q");
     int ssz1  = I1.get("SZ");
@@ -46,10 +47,142 @@ MatrixElements<SC> SymmetryQSZTZ<SC>::recalc_doublet(const DiagInfo<SC> &diag, c
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "qsztz/qsztz-doubletp-1.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {4, 4},
+        {5, 5},
+        {6, 6},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {10, 10},
+        {11, 11},
+        {12, 12},
+        {13, 13},
+        {14, 14},
+        {15, 15},
+        {16, 16},
+        {17, 17},
+        {18, 18},
+        {19, 19},
+        {20, 20},
+        {21, 21},
+        {22, 22},
+        {23, 23},
+        {24, 24},
+        {25, 25},
+        {26, 26},
+        {27, 27},
+        {28, 28},
+        {29, 29},
+        {30, 30},
+        {31, 31},
+        {32, 32},
+        {33, 33},
+        {34, 34},
+        {35, 35},
+        {36, 36},
+        {37, 37},
+        {38, 38},
+        {39, 39},
+        {40, 40},
+        {41, 41},
+        {42, 42},
+        {43, 43},
+        {44, 44},
+        {45, 45},
+        {46, 46},
+        {47, 47},
+        {48, 48},
+        {49, 49},
+        {50, 50},
+        {51, 51},
+        {52, 52},
+        {53, 53},
+        {54, 54},
+        {55, 55},
+        {56, 56},
+        {57, 57},
+        {58, 58},
+        {59, 59},
+        {60, 60},
+        {61, 61},
+        {62, 62},
+        {63, 63},
+        {64, 64}
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(1, -1, +1));
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return -1;
+          case 2: return -1;
+          case 3: return -1;
+          case 4: return -1;
+          case 5: return -1;
+          case 6: return -1;
+          case 7: return 1;
+          case 8: return 1;
+          case 9: return 1;
+          case 10: return 1;
+          case 11: return 1;
+          case 12: return 1;
+          case 13: return 1;
+          case 14: return 1;
+          case 15: return 1;
+          case 16: return 1;
+          case 17: return 1;
+          case 18: return 1;
+          case 19: return 1;
+          case 20: return 1;
+          case 21: return 1;
+          case 22: return -1;
+          case 23: return -1;
+          case 24: return -1;
+          case 25: return -1;
+          case 26: return -1;
+          case 27: return -1;
+          case 28: return -1;
+          case 29: return -1;
+          case 30: return -1;
+          case 31: return -1;
+          case 32: return -1;
+          case 33: return -1;
+          case 34: return -1;
+          case 35: return -1;
+          case 36: return -1;
+          case 37: return -1;
+          case 38: return -1;
+          case 39: return -1;
+          case 40: return -1;
+          case 41: return -1;
+          case 42: return 1;
+          case 43: return 1;
+          case 44: return 1;
+          case 45: return 1;
+          case 46: return 1;
+          case 47: return 1;
+          case 48: return 1;
+          case 49: return 1;
+          case 50: return 1;
+          case 51: return 1;
+          case 52: return 1;
+          case 53: return 1;
+          case 54: return 1;
+          case 55: return 1;
+          case 56: return 1;
+          case 57: return -1;
+          case 58: return -1;
+          case 59: return -1;
+          case 60: return -1;
+          case 61: return -1;
+          case 62: return -1;
+          case 63: return 1;
+          default: my_assert_not_reached();
+        }
+      };
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(1, -1, +1));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -61,10 +194,142 @@ MatrixElements<SC> SymmetryQSZTZ<SC>::recalc_doublet(const DiagInfo<SC> &diag, c
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "qsztz/qsztz-doubletm-1.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {4, 4},
+        {5, 5},
+        {6, 6},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {10, 10},
+        {11, 11},
+        {12, 12},
+        {13, 13},
+        {14, 14},
+        {15, 15},
+        {16, 16},
+        {17, 17},
+        {18, 18},
+        {19, 19},
+        {20, 20},
+        {21, 21},
+        {22, 22},
+        {23, 23},
+        {24, 24},
+        {25, 25},
+        {26, 26},
+        {27, 27},
+        {28, 28},
+        {29, 29},
+        {30, 30},
+        {31, 31},
+        {32, 32},
+        {33, 33},
+        {34, 34},
+        {35, 35},
+        {36, 36},
+        {37, 37},
+        {38, 38},
+        {39, 39},
+        {40, 40},
+        {41, 41},
+        {42, 42},
+        {43, 43},
+        {44, 44},
+        {45, 45},
+        {46, 46},
+        {47, 47},
+        {48, 48},
+        {49, 49},
+        {50, 50},
+        {51, 51},
+        {52, 52},
+        {53, 53},
+        {54, 54},
+        {55, 55},
+        {56, 56},
+        {57, 57},
+        {58, 58},
+        {59, 59},
+        {60, 60},
+        {61, 61},
+        {62, 62},
+        {63, 63},
+        {64, 64}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return -1;
+          case 2: return -1;
+          case 3: return -1;
+          case 4: return -1;
+          case 5: return -1;
+          case 6: return -1;
+          case 7: return 1;
+          case 8: return 1;
+          case 9: return 1;
+          case 10: return 1;
+          case 11: return 1;
+          case 12: return 1;
+          case 13: return 1;
+          case 14: return 1;
+          case 15: return 1;
+          case 16: return 1;
+          case 17: return 1;
+          case 18: return 1;
+          case 19: return 1;
+          case 20: return 1;
+          case 21: return 1;
+          case 22: return -1;
+          case 23: return -1;
+          case 24: return -1;
+          case 25: return -1;
+          case 26: return -1;
+          case 27: return -1;
+          case 28: return -1;
+          case 29: return -1;
+          case 30: return -1;
+          case 31: return -1;
+          case 32: return -1;
+          case 33: return -1;
+          case 34: return -1;
+          case 35: return -1;
+          case 36: return -1;
+          case 37: return -1;
+          case 38: return -1;
+          case 39: return -1;
+          case 40: return -1;
+          case 41: return -1;
+          case 42: return 1;
+          case 43: return 1;
+          case 44: return 1;
+          case 45: return 1;
+          case 46: return 1;
+          case 47: return 1;
+          case 48: return 1;
+          case 49: return 1;
+          case 50: return 1;
+          case 51: return 1;
+          case 52: return 1;
+          case 53: return 1;
+          case 54: return 1;
+          case 55: return 1;
+          case 56: return 1;
+          case 57: return -1;
+          case 58: return -1;
+          case 59: return -1;
+          case 60: return -1;
+          case 61: return -1;
+          case 62: return -1;
+          case 63: return 1;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(1, +1, +1));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(1, +1, +1));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -76,10 +341,142 @@ MatrixElements<SC> SymmetryQSZTZ<SC>::recalc_doublet(const DiagInfo<SC> &diag, c
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "qsztz/qsztz-doubletp0.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {4, 4},
+        {5, 5},
+        {6, 6},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {10, 10},
+        {11, 11},
+        {12, 12},
+        {13, 13},
+        {14, 14},
+        {15, 15},
+        {16, 16},
+        {17, 17},
+        {18, 18},
+        {19, 19},
+        {20, 20},
+        {21, 21},
+        {22, 22},
+        {23, 23},
+        {24, 24},
+        {25, 25},
+        {26, 26},
+        {27, 27},
+        {28, 28},
+        {29, 29},
+        {30, 30},
+        {31, 31},
+        {32, 32},
+        {33, 33},
+        {34, 34},
+        {35, 35},
+        {36, 36},
+        {37, 37},
+        {38, 38},
+        {39, 39},
+        {40, 40},
+        {41, 41},
+        {42, 42},
+        {43, 43},
+        {44, 44},
+        {45, 45},
+        {46, 46},
+        {47, 47},
+        {48, 48},
+        {49, 49},
+        {50, 50},
+        {51, 51},
+        {52, 52},
+        {53, 53},
+        {54, 54},
+        {55, 55},
+        {56, 56},
+        {57, 57},
+        {58, 58},
+        {59, 59},
+        {60, 60},
+        {61, 61},
+        {62, 62},
+        {63, 63},
+        {64, 64}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return -1;
+          case 2: return -1;
+          case 3: return -1;
+          case 4: return -1;
+          case 5: return -1;
+          case 6: return -1;
+          case 7: return 1;
+          case 8: return 1;
+          case 9: return 1;
+          case 10: return 1;
+          case 11: return 1;
+          case 12: return 1;
+          case 13: return 1;
+          case 14: return 1;
+          case 15: return 1;
+          case 16: return 1;
+          case 17: return 1;
+          case 18: return 1;
+          case 19: return 1;
+          case 20: return 1;
+          case 21: return 1;
+          case 22: return -1;
+          case 23: return -1;
+          case 24: return -1;
+          case 25: return -1;
+          case 26: return -1;
+          case 27: return -1;
+          case 28: return -1;
+          case 29: return -1;
+          case 30: return -1;
+          case 31: return -1;
+          case 32: return -1;
+          case 33: return -1;
+          case 34: return -1;
+          case 35: return -1;
+          case 36: return -1;
+          case 37: return -1;
+          case 38: return -1;
+          case 39: return -1;
+          case 40: return -1;
+          case 41: return -1;
+          case 42: return 1;
+          case 43: return 1;
+          case 44: return 1;
+          case 45: return 1;
+          case 46: return 1;
+          case 47: return 1;
+          case 48: return 1;
+          case 49: return 1;
+          case 50: return 1;
+          case 51: return 1;
+          case 52: return 1;
+          case 53: return 1;
+          case 54: return 1;
+          case 55: return 1;
+          case 56: return 1;
+          case 57: return -1;
+          case 58: return -1;
+          case 59: return -1;
+          case 60: return -1;
+          case 61: return -1;
+          case 62: return -1;
+          case 63: return 1;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(1, -1, 0));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(1, -1, 0));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -91,10 +488,142 @@ MatrixElements<SC> SymmetryQSZTZ<SC>::recalc_doublet(const DiagInfo<SC> &diag, c
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "qsztz/qsztz-doubletm0.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {4, 4},
+        {5, 5},
+        {6, 6},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {10, 10},
+        {11, 11},
+        {12, 12},
+        {13, 13},
+        {14, 14},
+        {15, 15},
+        {16, 16},
+        {17, 17},
+        {18, 18},
+        {19, 19},
+        {20, 20},
+        {21, 21},
+        {22, 22},
+        {23, 23},
+        {24, 24},
+        {25, 25},
+        {26, 26},
+        {27, 27},
+        {28, 28},
+        {29, 29},
+        {30, 30},
+        {31, 31},
+        {32, 32},
+        {33, 33},
+        {34, 34},
+        {35, 35},
+        {36, 36},
+        {37, 37},
+        {38, 38},
+        {39, 39},
+        {40, 40},
+        {41, 41},
+        {42, 42},
+        {43, 43},
+        {44, 44},
+        {45, 45},
+        {46, 46},
+        {47, 47},
+        {48, 48},
+        {49, 49},
+        {50, 50},
+        {51, 51},
+        {52, 52},
+        {53, 53},
+        {54, 54},
+        {55, 55},
+        {56, 56},
+        {57, 57},
+        {58, 58},
+        {59, 59},
+        {60, 60},
+        {61, 61},
+        {62, 62},
+        {63, 63},
+        {64, 64}
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(1, +1, 0));
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return -1;
+          case 2: return -1;
+          case 3: return -1;
+          case 4: return -1;
+          case 5: return -1;
+          case 6: return -1;
+          case 7: return 1;
+          case 8: return 1;
+          case 9: return 1;
+          case 10: return 1;
+          case 11: return 1;
+          case 12: return 1;
+          case 13: return 1;
+          case 14: return 1;
+          case 15: return 1;
+          case 16: return 1;
+          case 17: return 1;
+          case 18: return 1;
+          case 19: return 1;
+          case 20: return 1;
+          case 21: return 1;
+          case 22: return -1;
+          case 23: return -1;
+          case 24: return -1;
+          case 25: return -1;
+          case 26: return -1;
+          case 27: return -1;
+          case 28: return -1;
+          case 29: return -1;
+          case 30: return -1;
+          case 31: return -1;
+          case 32: return -1;
+          case 33: return -1;
+          case 34: return -1;
+          case 35: return -1;
+          case 36: return -1;
+          case 37: return -1;
+          case 38: return -1;
+          case 39: return -1;
+          case 40: return -1;
+          case 41: return -1;
+          case 42: return 1;
+          case 43: return 1;
+          case 44: return 1;
+          case 45: return 1;
+          case 46: return 1;
+          case 47: return 1;
+          case 48: return 1;
+          case 49: return 1;
+          case 50: return 1;
+          case 51: return 1;
+          case 52: return 1;
+          case 53: return 1;
+          case 54: return 1;
+          case 55: return 1;
+          case 56: return 1;
+          case 57: return -1;
+          case 58: return -1;
+          case 59: return -1;
+          case 60: return -1;
+          case 61: return -1;
+          case 62: return -1;
+          case 63: return 1;
+          default: my_assert_not_reached();
+        }
+      };
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(1, +1, 0));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -106,10 +635,142 @@ MatrixElements<SC> SymmetryQSZTZ<SC>::recalc_doublet(const DiagInfo<SC> &diag, c
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "qsztz/qsztz-doubletp+1.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {4, 4},
+        {5, 5},
+        {6, 6},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {10, 10},
+        {11, 11},
+        {12, 12},
+        {13, 13},
+        {14, 14},
+        {15, 15},
+        {16, 16},
+        {17, 17},
+        {18, 18},
+        {19, 19},
+        {20, 20},
+        {21, 21},
+        {22, 22},
+        {23, 23},
+        {24, 24},
+        {25, 25},
+        {26, 26},
+        {27, 27},
+        {28, 28},
+        {29, 29},
+        {30, 30},
+        {31, 31},
+        {32, 32},
+        {33, 33},
+        {34, 34},
+        {35, 35},
+        {36, 36},
+        {37, 37},
+        {38, 38},
+        {39, 39},
+        {40, 40},
+        {41, 41},
+        {42, 42},
+        {43, 43},
+        {44, 44},
+        {45, 45},
+        {46, 46},
+        {47, 47},
+        {48, 48},
+        {49, 49},
+        {50, 50},
+        {51, 51},
+        {52, 52},
+        {53, 53},
+        {54, 54},
+        {55, 55},
+        {56, 56},
+        {57, 57},
+        {58, 58},
+        {59, 59},
+        {60, 60},
+        {61, 61},
+        {62, 62},
+        {63, 63},
+        {64, 64}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return -1;
+          case 2: return -1;
+          case 3: return -1;
+          case 4: return -1;
+          case 5: return -1;
+          case 6: return -1;
+          case 7: return 1;
+          case 8: return 1;
+          case 9: return 1;
+          case 10: return 1;
+          case 11: return 1;
+          case 12: return 1;
+          case 13: return 1;
+          case 14: return 1;
+          case 15: return 1;
+          case 16: return 1;
+          case 17: return 1;
+          case 18: return 1;
+          case 19: return 1;
+          case 20: return 1;
+          case 21: return 1;
+          case 22: return -1;
+          case 23: return -1;
+          case 24: return -1;
+          case 25: return -1;
+          case 26: return -1;
+          case 27: return -1;
+          case 28: return -1;
+          case 29: return -1;
+          case 30: return -1;
+          case 31: return -1;
+          case 32: return -1;
+          case 33: return -1;
+          case 34: return -1;
+          case 35: return -1;
+          case 36: return -1;
+          case 37: return -1;
+          case 38: return -1;
+          case 39: return -1;
+          case 40: return -1;
+          case 41: return -1;
+          case 42: return 1;
+          case 43: return 1;
+          case 44: return 1;
+          case 45: return 1;
+          case 46: return 1;
+          case 47: return 1;
+          case 48: return 1;
+          case 49: return 1;
+          case 50: return 1;
+          case 51: return 1;
+          case 52: return 1;
+          case 53: return 1;
+          case 54: return 1;
+          case 55: return 1;
+          case 56: return 1;
+          case 57: return -1;
+          case 58: return -1;
+          case 59: return -1;
+          case 60: return -1;
+          case 61: return -1;
+          case 62: return -1;
+          case 63: return 1;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(1, -1, -1));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(1, -1, -1));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -121,10 +782,142 @@ MatrixElements<SC> SymmetryQSZTZ<SC>::recalc_doublet(const DiagInfo<SC> &diag, c
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "qsztz/qsztz-doubletm+1.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {4, 4},
+        {5, 5},
+        {6, 6},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {10, 10},
+        {11, 11},
+        {12, 12},
+        {13, 13},
+        {14, 14},
+        {15, 15},
+        {16, 16},
+        {17, 17},
+        {18, 18},
+        {19, 19},
+        {20, 20},
+        {21, 21},
+        {22, 22},
+        {23, 23},
+        {24, 24},
+        {25, 25},
+        {26, 26},
+        {27, 27},
+        {28, 28},
+        {29, 29},
+        {30, 30},
+        {31, 31},
+        {32, 32},
+        {33, 33},
+        {34, 34},
+        {35, 35},
+        {36, 36},
+        {37, 37},
+        {38, 38},
+        {39, 39},
+        {40, 40},
+        {41, 41},
+        {42, 42},
+        {43, 43},
+        {44, 44},
+        {45, 45},
+        {46, 46},
+        {47, 47},
+        {48, 48},
+        {49, 49},
+        {50, 50},
+        {51, 51},
+        {52, 52},
+        {53, 53},
+        {54, 54},
+        {55, 55},
+        {56, 56},
+        {57, 57},
+        {58, 58},
+        {59, 59},
+        {60, 60},
+        {61, 61},
+        {62, 62},
+        {63, 63},
+        {64, 64}
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(1, +1, -1));
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return -1;
+          case 2: return -1;
+          case 3: return -1;
+          case 4: return -1;
+          case 5: return -1;
+          case 6: return -1;
+          case 7: return 1;
+          case 8: return 1;
+          case 9: return 1;
+          case 10: return 1;
+          case 11: return 1;
+          case 12: return 1;
+          case 13: return 1;
+          case 14: return 1;
+          case 15: return 1;
+          case 16: return 1;
+          case 17: return 1;
+          case 18: return 1;
+          case 19: return 1;
+          case 20: return 1;
+          case 21: return 1;
+          case 22: return -1;
+          case 23: return -1;
+          case 24: return -1;
+          case 25: return -1;
+          case 26: return -1;
+          case 27: return -1;
+          case 28: return -1;
+          case 29: return -1;
+          case 30: return -1;
+          case 31: return -1;
+          case 32: return -1;
+          case 33: return -1;
+          case 34: return -1;
+          case 35: return -1;
+          case 36: return -1;
+          case 37: return -1;
+          case 38: return -1;
+          case 39: return -1;
+          case 40: return -1;
+          case 41: return -1;
+          case 42: return 1;
+          case 43: return 1;
+          case 44: return 1;
+          case 45: return 1;
+          case 46: return 1;
+          case 47: return 1;
+          case 48: return 1;
+          case 49: return 1;
+          case 50: return 1;
+          case 51: return 1;
+          case 52: return 1;
+          case 53: return 1;
+          case 54: return 1;
+          case 55: return 1;
+          case 56: return 1;
+          case 57: return -1;
+          case 58: return -1;
+          case 59: return -1;
+          case 60: return -1;
+          case 61: return -1;
+          case 62: return -1;
+          case 63: return 1;
+          default: my_assert_not_reached();
+        }
+      };
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(1, +1, -1));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -236,6 +1029,7 @@ Opch<SC> SymmetryQSZTZ<SC>::recalc_irreduc(const Step &step, const DiagInfo<SC>
 template<typename SC>
 MatrixElements<SC> SymmetryQSZTZ<SC>::recalc_triplet(const DiagInfo<SC> &diag, const SubspaceStructure &substruct, const MatrixElements<SC> &cold) const {
   MatrixElements<SC> cnew;
+  const auto blocks = std::make_shared<const BlockIndex<SC>>(cold, substruct);
   for(const auto &[I1, eig]: diag) {
     int q1   = I1.get("Q");
     int ssz1  = I1.get("SZ");
@@ -248,10 +1042,142 @@ MatrixElements<SC> SymmetryQSZTZ<SC>::recalc_triplet(const DiagInfo<SC> &diag, c
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "qsztz/qsztz-triplets.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {4, 4},
+        {5, 5},
+        {6, 6},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {10, 10},
+        {11, 11},
+        {12, 12},
+        {13, 13},
+        {14, 14},
+        {15, 15},
+        {16, 16},
+        {17, 17},
+        {18, 18},
+        {19, 19},
+        {20, 20},
+        {21, 21},
+        {22, 22},
+        {23, 23},
+        {24, 24},
+        {25, 25},
+        {26, 26},
+        {27, 27},
+        {28, 28},
+        {29, 29},
+        {30, 30},
+        {31, 31},
+        {32, 32},
+        {33, 33},
+        {34, 34},
+        {35, 35},
+        {36, 36},
+        {37, 37},
+        {38, 38},
+        {39, 39},
+        {40, 40},
+        {41, 41},
+        {42, 42},
+        {43, 43},
+        {44, 44},
+        {45, 45},
+        {46, 46},
+        {47, 47},
+        {48, 48},
+        {49, 49},
+        {50, 50},
+        {51, 51},
+        {52, 52},
+        {53, 53},
+        {54, 54},
+        {55, 55},
+        {56, 56},
+        {57, 57},
+        {58, 58},
+        {59, 59},
+        {60, 60},
+        {61, 61},
+        {62, 62},
+        {63, 63},
+        {64, 64}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return 1;
+          case 3: return 1;
+          case 4: return 1;
+          case 5: return 1;
+          case 6: return 1;
+          case 7: return 1;
+          case 8: return 1;
+          case 9: return 1;
+          case 10: return 1;
+          case 11: return 1;
+          case 12: return 1;
+          case 13: return 1;
+          case 14: return 1;
+          case 15: return 1;
+          case 16: return 1;
+          case 17: return 1;
+          case 18: return 1;
+          case 19: return 1;
+          case 20: return 1;
+          case 21: return 1;
+          case 22: return 1;
+          case 23: return 1;
+          case 24: return 1;
+          case 25: return 1;
+          case 26: return 1;
+          case 27: return 1;
+          case 28: return 1;
+          case 29: return 1;
+          case 30: return 1;
+          case 31: return 1;
+          case 32: return 1;
+          case 33: return 1;
+          case 34: return 1;
+          case 35: return 1;
+          case 36: return 1;
+          case 37: return 1;
+          case 38: return 1;
+          case 39: return 1;
+          case 40: return 1;
+          case 41: return 1;
+          case 42: return 1;
+          case 43: return 1;
+          case 44: return 1;
+          case 45: return 1;
+          case 46: return 1;
+          case 47: return 1;
+          case 48: return 1;
+          case 49: return 1;
+          case 50: return 1;
+          case 51: return 1;
+          case 52: return 1;
+          case 53: return 1;
+          case 54: return 1;
+          case 55: return 1;
+          case 56: return 1;
+          case 57: return 1;
+          case 58: return 1;
+          case 59: return 1;
+          case 60: return 1;
+          case 61: return 1;
+          case 62: return 1;
+          case 63: return 1;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(0, 3, 0));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(0, 3, 0));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -263,10 +1189,142 @@ MatrixElements<SC> SymmetryQSZTZ<SC>::recalc_triplet(const DiagInfo<SC> &diag, c
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "qsztz/qsztz-tripletp.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {4, 4},
+        {5, 5},
+        {6, 6},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {10, 10},
+        {11, 11},
+        {12, 12},
+        {13, 13},
+        {14, 14},
+        {15, 15},
+        {16, 16},
+        {17, 17},
+        {18, 18},
+        {19, 19},
+        {20, 20},
+        {21, 21},
+        {22, 22},
+        {23, 23},
+        {24, 24},
+        {25, 25},
+        {26, 26},
+        {27, 27},
+        {28, 28},
+        {29, 29},
+        {30, 30},
+        {31, 31},
+        {32, 32},
+        {33, 33},
+        {34, 34},
+        {35, 35},
+        {36, 36},
+        {37, 37},
+        {38, 38},
+        {39, 39},
+        {40, 40},
+        {41, 41},
+        {42, 42},
+        {43, 43},
+        {44, 44},
+        {45, 45},
+        {46, 46},
+        {47, 47},
+        {48, 48},
+        {49, 49},
+        {50, 50},
+        {51, 51},
+        {52, 52},
+        {53, 53},
+        {54, 54},
+        {55, 55},
+        {56, 56},
+        {57, 57},
+        {58, 58},
+        {59, 59},
+        {60, 60},
+        {61, 61},
+        {62, 62},
+        {63, 63},
+        {64, 64}
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(0, 3, 0));
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return 1;
+          case 3: return 1;
+          case 4: return 1;
+          case 5: return 1;
+          case 6: return 1;
+          case 7: return 1;
+          case 8: return 1;
+          case 9: return 1;
+          case 10: return 1;
+          case 11: return 1;
+          case 12: return 1;
+          case 13: return 1;
+          case 14: return 1;
+          case 15: return 1;
+          case 16: return 1;
+          case 17: return 1;
+          case 18: return 1;
+          case 19: return 1;
+          case 20: return 1;
+          case 21: return 1;
+          case 22: return 1;
+          case 23: return 1;
+          case 24: return 1;
+          case 25: return 1;
+          case 26: return 1;
+          case 27: return 1;
+          case 28: return 1;
+          case 29: return 1;
+          case 30: return 1;
+          case 31: return 1;
+          case 32: return 1;
+          case 33: return 1;
+          case 34: return 1;
+          case 35: return 1;
+          case 36: return 1;
+          case 37: return 1;
+          case 38: return 1;
+          case 39: return 1;
+          case 40: return 1;
+          case 41: return 1;
+          case 42: return 1;
+          case 43: return 1;
+          case 44: return 1;
+          case 45: return 1;
+          case 46: return 1;
+          case 47: return 1;
+          case 48: return 1;
+          case 49: return 1;
+          case 50: return 1;
+          case 51: return 1;
+          case 52: return 1;
+          case 53: return 1;
+          case 54: return 1;
+          case 55: return 1;
+          case 56: return 1;
+          case 57: return 1;
+          case 58: return 1;
+          case 59: return 1;
+          case 60: return 1;
+          case 61: return 1;
+          case 62: return 1;
+          case 63: return 1;
+          default: my_assert_not_reached();
+        }
+      };
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(0, 3, 0));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -278,10 +1336,142 @@ MatrixElements<SC> SymmetryQSZTZ<SC>::recalc_triplet(const DiagInfo<SC> &diag, c
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "qsztz/qsztz-tripletm.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {4, 4},
+        {5, 5},
+        {6, 6},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {10, 10},
+        {11, 11},
+        {12, 12},
+        {13, 13},
+        {14, 14},
+        {15, 15},
+        {16, 16},
+        {17, 17},
+        {18, 18},
+        {19, 19},
+        {20, 20},
+        {21, 21},
+        {22, 22},
+        {23, 23},
+        {24, 24},
+        {25, 25},
+        {26, 26},
+        {27, 27},
+        {28, 28},
+        {29, 29},
+        {30, 30},
+        {31, 31},
+        {32, 32},
+        {33, 33},
+        {34, 34},
+        {35, 35},
+        {36, 36},
+        {37, 37},
+        {38, 38},
+        {39, 39},
+        {40, 40},
+        {41, 41},
+        {42, 42},
+        {43, 43},
+        {44, 44},
+        {45, 45},
+        {46, 46},
+        {47, 47},
+        {48, 48},
+        {49, 49},
+        {50, 50},
+        {51, 51},
+        {52, 52},
+        {53, 53},
+        {54, 54},
+        {55, 55},
+        {56, 56},
+        {57, 57},
+        {58, 58},
+        {59, 59},
+        {60, 60},
+        {61, 61},
+        {62, 62},
+        {63, 63},
+        {64, 64}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return 1;
+          case 3: return 1;
+          case 4: return 1;
+          case 5: return 1;
+          case 6: return 1;
+          case 7: return 1;
+          case 8: return 1;
+          case 9: return 1;
+          case 10: return 1;
+          case 11: return 1;
+          case 12: return 1;
+          case 13: return 1;
+          case 14: return 1;
+          case 15: return 1;
+          case 16: return 1;
+          case 17: return 1;
+          case 18: return 1;
+          case 19: return 1;
+          case 20: return 1;
+          case 21: return 1;
+          case 22: return 1;
+          case 23: return 1;
+          case 24: return 1;
+          case 25: return 1;
+          case 26: return 1;
+          case 27: return 1;
+          case 28: return 1;
+          case 29: return 1;
+          case 30: return 1;
+          case 31: return 1;
+          case 32: return 1;
+          case 33: return 1;
+          case 34: return 1;
+          case 35: return 1;
+          case 36: return 1;
+          case 37: return 1;
+          case 38: return 1;
+          case 39: return 1;
+          case 40: return 1;
+          case 41: return 1;
+          case 42: return 1;
+          case 43: return 1;
+          case 44: return 1;
+          case 45: return 1;
+          case 46: return 1;
+          case 47: return 1;
+          case 48: return 1;
+          case 49: return 1;
+          case 50: return 1;
+          case 51: return 1;
+          case 52: return 1;
+          case 53: return 1;
+          case 54: return 1;
+          case 55: return 1;
+          case 56: return 1;
+          case 57: return 1;
+          case 58: return 1;
+          case 59: return 1;
+          case 60: return 1;
+          case 61: return 1;
+          case 62: return 1;
+          case 63: return 1;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(0, 3, 0));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(0, 3, 0));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -31,6 +31,7 @@ namespace NRG {
 template<typename SC>
 MatrixElements<SC> SymmetrySPSU2<SC>::recalc_doublet(const DiagInfo<SC> &diag, const SubspaceStructure &substruct, const MatrixElements<SC> &cold) const {
   MatrixElements<SC> cnew;
+  const auto blocks = std::make_shared<const BlockIndex<SC>>(cold, substruct);
   if (!P.substeps) {
     for(const auto &[I1, eig]: diag) {
       int ss1 = I1.get("SS");
@@ -43,10 +44,24 @@ MatrixElements<SC> SymmetrySPSU2<SC>::recalc_doublet(const DiagInfo<SC> &diag, c
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "spsu2/spsu2-1ch-doubletp.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {4, 3},
+        {4, 4}
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(2));
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 3: return 1/(1 + 2*S(ss1));
+          case 4: return -1;
+          default: my_assert_not_reached();
+        }
+      };
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(2));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -56,10 +71,58 @@ MatrixElements<SC> SymmetrySPSU2<SC>::recalc_doublet(const DiagInfo<SC> &diag, c
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "spsu2/spsu2-2ch-doubletp.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {4, 4},
+        {5, 5},
+        {6, 6},
+        {7, 6},
+        {7, 7},
+        {8, 8},
+        {9, 8},
+        {9, 9},
+        {10, 10},
+        {11, 10},
+        {11, 11},
+        {12, 12},
+        {13, 12},
+        {13, 13},
+        {14, 14},
+        {15, 14},
+        {15, 15},
+        {16, 15},
+        {16, 16}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return 1;
+          case 3: return 1;
+          case 4: return 1;
+          case 5: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 6: return 1/(1 + 2*S(ss1));
+          case 7: return -1;
+          case 8: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 9: return 1/(1 + 2*S(ss1));
+          case 10: return -1;
+          case 11: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 12: return 1/(1 + 2*S(ss1));
+          case 13: return -1;
+          case 14: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 15: return 1/(1 + 2*S(ss1));
+          case 16: return -1;
+          case 17: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 18: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 19: return (S(ss1)*(3 + 2*S(ss1)))/sqrt(S(ss1)*(1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))));
+          case 20: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 21: return 1;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(2));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(2));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -69,10 +132,200 @@ MatrixElements<SC> SymmetrySPSU2<SC>::recalc_doublet(const DiagInfo<SC> &diag, c
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "spsu2/spsu2-3ch-doubletp.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {4, 4},
+        {5, 5},
+        {6, 6},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {10, 10},
+        {11, 11},
+        {12, 12},
+        {13, 13},
+        {14, 14},
+        {15, 15},
+        {16, 15},
+        {16, 16},
+        {17, 17},
+        {18, 17},
+        {18, 18},
+        {19, 19},
+        {20, 19},
+        {20, 20},
+        {21, 21},
+        {22, 21},
+        {22, 22},
+        {23, 23},
+        {24, 23},
+        {24, 24},
+        {25, 25},
+        {26, 25},
+        {26, 26},
+        {27, 27},
+        {28, 27},
+        {28, 28},
+        {29, 29},
+        {30, 29},
+        {30, 30},
+        {31, 31},
+        {32, 31},
+        {32, 32},
+        {33, 33},
+        {34, 33},
+        {34, 34},
+        {35, 35},
+        {36, 35},
+        {36, 36},
+        {37, 37},
+        {38, 37},
+        {38, 38},
+        {39, 39},
+        {40, 39},
+        {40, 40},
+        {41, 41},
+        {42, 41},
+        {42, 42},
+        {43, 43},
+        {44, 43},
+        {44, 44},
+        {45, 44},
+        {45, 45},
+        {46, 46},
+        {47, 46},
+        {47, 47},
+        {48, 47},
+        {48, 48},
+        {49, 49},
+        {50, 49},
+        {50, 50},
+        {51, 50},
+        {51, 51},
+        {52, 52},
+        {53, 52},
+        {53, 53},
+        {54, 53},
+        {54, 54},
+        {55, 55},
+        {56, 55},
+        {56, 56},
+        {57, 56},
+        {57, 57},
+        {58, 58},
+        {59, 58},
+        {59, 59},
+        {60, 59},
+        {60, 60},
+        {61, 61},
+        {62, 61},
+        {62, 62},
+        {63, 62},
+        {63, 63},
+        {64, 63},
+        {64, 64}
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(2));
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return 1;
+          case 3: return 1;
+          case 4: return 1;
+          case 5: return 1;
+          case 6: return 1;
+          case 7: return 1;
+          case 8: return 1;
+          case 9: return 1;
+          case 10: return 1;
+          case 11: return 1;
+          case 12: return 1;
+          case 13: return 1;
+          case 14: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 15: return 1/(1 + 2*S(ss1));
+          case 16: return -1;
+          case 17: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 18: return 1/(1 + 2*S(ss1));
+          case 19: return -1;
+          case 20: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 21: return 1/(1 + 2*S(ss1));
+          case 22: return -1;
+          case 23: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 24: return 1/(1 + 2*S(ss1));
+          case 25: return -1;
+          case 26: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 27: return 1/(1 + 2*S(ss1));
+          case 28: return -1;
+          case 29: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 30: return 1/(1 + 2*S(ss1));
+          case 31: return -1;
+          case 32: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 33: return 1/(1 + 2*S(ss1));
+          case 34: return -1;
+          case 35: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 36: return 1/(1 + 2*S(ss1));
+          case 37: return -1;
+          case 38: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 39: return 1/(1 + 2*S(ss1));
+          case 40: return -1;
+          case 41: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 42: return 1/(1 + 2*S(ss1));
+          case 43: return -1;
+          case 44: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 45: return 1/(1 + 2*S(ss1));
+          case 46: return -1;
+          case 47: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 48: return 1/(1 + 2*S(ss1));
+          case 49: return -1;
+          case 50: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 51: return 1/(1 + 2*S(ss1));
+          case 52: return -1;
+          case 53: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 54: return 1/(1 + 2*S(ss1));
+          case 55: return -1;
+          case 56: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 57: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 58: return (S(ss1)*(3 + 2*S(ss1)))/sqrt(S(ss1)*(1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))));
+          case 59: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 60: return 1;
+          case 61: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 62: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 63: return (S(ss1)*(3 + 2*S(ss1)))/sqrt(S(ss1)*(1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))));
+          case 64: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 65: return 1;
+          case 66: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 67: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 68: return (S(ss1)*(3 + 2*S(ss1)))/sqrt(S(ss1)*(1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))));
+          case 69: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 70: return 1;
+          case 71: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 72: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 73: return (S(ss1)*(3 + 2*S(ss1)))/sqrt(S(ss1)*(1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))));
+          case 74: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 75: return 1;
+          case 76: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 77: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 78: return (S(ss1)*(3 + 2*S(ss1)))/sqrt(S(ss1)*(1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))));
+          case 79: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 80: return 1;
+          case 81: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 82: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 83: return (S(ss1)*(3 + 2*S(ss1)))/sqrt(S(ss1)*(1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))));
+          case 84: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 85: return 1;
+          case 86: return -2*sqrt((-1 + Power(S(ss1),2))/(-1 + 4*Power(S(ss1),2)));
+          case 87: return sqrt(3)/sqrt(-1 + 4*Power(S(ss1),2));
+          case 88: return -(sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1)));
+          case 89: return 2/(1 + 2*S(ss1));
+          case 90: return (-2*(2 + S(ss1)))/sqrt(((2 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)))/S(ss1));
+          case 91: return sqrt(3)/sqrt(3 + 4*S(ss1)*(2 + S(ss1)));
+          case 92: return -1;
+          default: my_assert_not_reached();
+        }
+      };
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(2));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -87,10 +340,24 @@ MatrixElements<SC> SymmetrySPSU2<SC>::recalc_doublet(const DiagInfo<SC> &diag, c
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "spsu2/spsu2-1ch-doubletm.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {3, 4},
+        {4, 4}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return -1;
+          case 3: return 1/(-1 - 2*S(ss1));
+          case 4: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(2));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(2));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -100,10 +367,58 @@ MatrixElements<SC> SymmetrySPSU2<SC>::recalc_doublet(const DiagInfo<SC> &diag, c
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "spsu2/spsu2-2ch-doubletm.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {4, 4},
+        {5, 5},
+        {6, 6},
+        {6, 7},
+        {7, 7},
+        {8, 8},
+        {8, 9},
+        {9, 9},
+        {10, 10},
+        {10, 11},
+        {11, 11},
+        {12, 12},
+        {12, 13},
+        {13, 13},
+        {14, 14},
+        {14, 15},
+        {15, 15},
+        {15, 16},
+        {16, 16}
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(2));
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return 1;
+          case 3: return 1;
+          case 4: return 1;
+          case 5: return -1;
+          case 6: return 1/(-1 - 2*S(ss1));
+          case 7: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 8: return -1;
+          case 9: return 1/(-1 - 2*S(ss1));
+          case 10: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 11: return -1;
+          case 12: return 1/(-1 - 2*S(ss1));
+          case 13: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 14: return -1;
+          case 15: return 1/(-1 - 2*S(ss1));
+          case 16: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 17: return 1;
+          case 18: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 19: return (-1 + S(ss1) + 2*Power(S(ss1),2))/sqrt(S(ss1)*(1 + S(ss1))*(-1 + 4*Power(S(ss1),2)));
+          case 20: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 21: return sqrt((S(ss1)*(1 + 2*S(ss1)))/(Power(1 + S(ss1),3)*(3 + 2*S(ss1)))) + sqrt(S(ss1)/(Power(1 + S(ss1),3)*(3 + 4*S(ss1)*(2 + S(ss1))))) + sqrt(1 + 1/(1 + S(ss1)) - 6/(3 + 2*S(ss1)));
+          default: my_assert_not_reached();
+        }
+      };
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(2));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -113,10 +428,200 @@ MatrixElements<SC> SymmetrySPSU2<SC>::recalc_doublet(const DiagInfo<SC> &diag, c
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "spsu2/spsu2-3ch-doubletm.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {4, 4},
+        {5, 5},
+        {6, 6},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {10, 10},
+        {11, 11},
+        {12, 12},
+        {13, 13},
+        {14, 14},
+        {15, 15},
+        {15, 16},
+        {16, 16},
+        {17, 17},
+        {17, 18},
+        {18, 18},
+        {19, 19},
+        {19, 20},
+        {20, 20},
+        {21, 21},
+        {21, 22},
+        {22, 22},
+        {23, 23},
+        {23, 24},
+        {24, 24},
+        {25, 25},
+        {25, 26},
+        {26, 26},
+        {27, 27},
+        {27, 28},
+        {28, 28},
+        {29, 29},
+        {29, 30},
+        {30, 30},
+        {31, 31},
+        {31, 32},
+        {32, 32},
+        {33, 33},
+        {33, 34},
+        {34, 34},
+        {35, 35},
+        {35, 36},
+        {36, 36},
+        {37, 37},
+        {37, 38},
+        {38, 38},
+        {39, 39},
+        {39, 40},
+        {40, 40},
+        {41, 41},
+        {41, 42},
+        {42, 42},
+        {43, 43},
+        {43, 44},
+        {44, 44},
+        {44, 45},
+        {45, 45},
+        {46, 46},
+        {46, 47},
+        {47, 47},
+        {47, 48},
+        {48, 48},
+        {49, 49},
+        {49, 50},
+        {50, 50},
+        {50, 51},
+        {51, 51},
+        {52, 52},
+        {52, 53},
+        {53, 53},
+        {53, 54},
+        {54, 54},
+        {55, 55},
+        {55, 56},
+        {56, 56},
+        {56, 57},
+        {57, 57},
+        {58, 58},
+        {58, 59},
+        {59, 59},
+        {59, 60},
+        {60, 60},
+        {61, 61},
+        {61, 62},
+        {62, 62},
+        {62, 63},
+        {63, 63},
+        {63, 64},
+        {64, 64}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return 1;
+          case 3: return 1;
+          case 4: return 1;
+          case 5: return 1;
+          case 6: return 1;
+          case 7: return 1;
+          case 8: return 1;
+          case 9: return 1;
+          case 10: return 1;
+          case 11: return 1;
+          case 12: return 1;
+          case 13: return 1;
+          case 14: return -1;
+          case 15: return 1/(-1 - 2*S(ss1));
+          case 16: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 17: return -1;
+          case 18: return 1/(-1 - 2*S(ss1));
+          case 19: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 20: return -1;
+          case 21: return 1/(-1 - 2*S(ss1));
+          case 22: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 23: return -1;
+          case 24: return 1/(-1 - 2*S(ss1));
+          case 25: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 26: return -1;
+          case 27: return 1/(-1 - 2*S(ss1));
+          case 28: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 29: return -1;
+          case 30: return 1/(-1 - 2*S(ss1));
+          case 31: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 32: return -1;
+          case 33: return 1/(-1 - 2*S(ss1));
+          case 34: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 35: return -1;
+          case 36: return 1/(-1 - 2*S(ss1));
+          case 37: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 38: return -1;
+          case 39: return 1/(-1 - 2*S(ss1));
+          case 40: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 41: return -1;
+          case 42: return 1/(-1 - 2*S(ss1));
+          case 43: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 44: return -1;
+          case 45: return 1/(-1 - 2*S(ss1));
+          case 46: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 47: return -1;
+          case 48: return 1/(-1 - 2*S(ss1));
+          case 49: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 50: return -1;
+          case 51: return 1/(-1 - 2*S(ss1));
+          case 52: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 53: return -1;
+          case 54: return 1/(-1 - 2*S(ss1));
+          case 55: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 56: return 1;
+          case 57: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 58: return (-1 + S(ss1) + 2*Power(S(ss1),2))/sqrt(S(ss1)*(1 + S(ss1))*(-1 + 4*Power(S(ss1),2)));
+          case 59: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 60: return sqrt((S(ss1)*(1 + 2*S(ss1)))/(Power(1 + S(ss1),3)*(3 + 2*S(ss1)))) + sqrt(S(ss1)/(Power(1 + S(ss1),3)*(3 + 4*S(ss1)*(2 + S(ss1))))) + sqrt(1 + 1/(1 + S(ss1)) - 6/(3 + 2*S(ss1)));
+          case 61: return 1;
+          case 62: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 63: return (-1 + S(ss1) + 2*Power(S(ss1),2))/sqrt(S(ss1)*(1 + S(ss1))*(-1 + 4*Power(S(ss1),2)));
+          case 64: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 65: return sqrt((S(ss1)*(1 + 2*S(ss1)))/(Power(1 + S(ss1),3)*(3 + 2*S(ss1)))) + sqrt(S(ss1)/(Power(1 + S(ss1),3)*(3 + 4*S(ss1)*(2 + S(ss1))))) + sqrt(1 + 1/(1 + S(ss1)) - 6/(3 + 2*S(ss1)));
+          case 66: return 1;
+          case 67: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 68: return (-1 + S(ss1) + 2*Power(S(ss1),2))/sqrt(S(ss1)*(1 + S(ss1))*(-1 + 4*Power(S(ss1),2)));
+          case 69: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 70: return sqrt((S(ss1)*(1 + 2*S(ss1)))/(Power(1 + S(ss1),3)*(3 + 2*S(ss1)))) + sqrt(S(ss1)/(Power(1 + S(ss1),3)*(3 + 4*S(ss1)*(2 + S(ss1))))) + sqrt(1 + 1/(1 + S(ss1)) - 6/(3 + 2*S(ss1)));
+          case 71: return 1;
+          case 72: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 73: return (-1 + S(ss1) + 2*Power(S(ss1),2))/sqrt(S(ss1)*(1 + S(ss1))*(-1 + 4*Power(S(ss1),2)));
+          case 74: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 75: return sqrt((S(ss1)*(1 + 2*S(ss1)))/(Power(1 + S(ss1),3)*(3 + 2*S(ss1)))) + sqrt(S(ss1)/(Power(1 + S(ss1),3)*(3 + 4*S(ss1)*(2 + S(ss1))))) + sqrt(1 + 1/(1 + S(ss1)) - 6/(3 + 2*S(ss1)));
+          case 76: return 1;
+          case 77: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 78: return (-1 + S(ss1) + 2*Power(S(ss1),2))/sqrt(S(ss1)*(1 + S(ss1))*(-1 + 4*Power(S(ss1),2)));
+          case 79: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 80: return sqrt((S(ss1)*(1 + 2*S(ss1)))/(Power(1 + S(ss1),3)*(3 + 2*S(ss1)))) + sqrt(S(ss1)/(Power(1 + S(ss1),3)*(3 + 4*S(ss1)*(2 + S(ss1))))) + sqrt(1 + 1/(1 + S(ss1)) - 6/(3 + 2*S(ss1)));
+          case 81: return 1;
+          case 82: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 83: return (-1 + S(ss1) + 2*Power(S(ss1),2))/sqrt(S(ss1)*(1 + S(ss1))*(-1 + 4*Power(S(ss1),2)));
+          case 84: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 85: return sqrt((S(ss1)*(1 + 2*S(ss1)))/(Power(1 + S(ss1),3)*(3 + 2*S(ss1)))) + sqrt(S(ss1)/(Power(1 + S(ss1),3)*(3 + 4*S(ss1)*(2 + S(ss1))))) + sqrt(1 + 1/(1 + S(ss1)) - 6/(3 + 2*S(ss1)));
+          case 86: return -1;
+          case 87: return -(sqrt(3)/sqrt(-1 + 4*Power(S(ss1),2)));
+          case 88: return (-2*(-1 + Power(S(ss1),2)))/sqrt(1 - 5*Power(S(ss1),2) + 4*Power(S(ss1),4));
+          case 89: return -2/(1 + 2*S(ss1));
+          case 90: return -(sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1)));
+          case 91: return -(sqrt(3)/sqrt(3 + 4*S(ss1)*(2 + S(ss1))));
+          case 92: return -3*sqrt((S(ss1)*(1 + 2*S(ss1)))/((2 + S(ss1))*Power(3 + 2*S(ss1),3))) - (3*sqrt((S(ss1)*(1 + 2*S(ss1)))/((2 + S(ss1))*Power(3 + 2*S(ss1),3))))/(1 + S(ss1)) - sqrt((S(ss1)*(1 + 2*S(ss1)))/(6 + 7*S(ss1) + 2*Power(S(ss1),2))) - (3*sqrt(S(ss1)/(6 + 19*S(ss1) + 16*Power(S(ss1),2) + 4*Power(S(ss1),3))))/(3 + 5*S(ss1) + 2*Power(S(ss1),2));
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(2));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(2));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -135,10 +640,24 @@ MatrixElements<SC> SymmetrySPSU2<SC>::recalc_doublet(const DiagInfo<SC> &diag, c
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "spsu2/spsu2-1ch-doubletp.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {4, 3},
+        {4, 4}
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(2));
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 3: return 1/(1 + 2*S(ss1));
+          case 4: return -1;
+          default: my_assert_not_reached();
+        }
+      };
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(2));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -150,10 +669,24 @@ MatrixElements<SC> SymmetrySPSU2<SC>::recalc_doublet(const DiagInfo<SC> &diag, c
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "spsu2/spsu2-1ch-doubletm.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {3, 4},
+        {4, 4}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return -1;
+          case 3: return 1/(-1 - 2*S(ss1));
+          case 4: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(2));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(2));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -374,6 +907,7 @@ OpchChannel<SC> SymmetrySPSU2<SC>::recalc_irreduc_substeps(const Step &step, con
 template<typename SC>
 MatrixElements<SC> SymmetrySPSU2<SC>::recalc_triplet(const DiagInfo<SC> &diag, const SubspaceStructure &substruct, const MatrixElements<SC> &cold) const {
   MatrixElements<SC> cnew;
+  const auto blocks = std::make_shared<const BlockIndex<SC>>(cold, substruct);
   if (!P.substeps) {
     for(const auto &[I1, eig]: diag) {
       int ss1 = I1.get("SS");
@@ -386,10 +920,26 @@ MatrixElements<SC> SymmetrySPSU2<SC>::recalc_triplet(const DiagInfo<SC> &diag, c
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "spsu2/spsu2-1ch-triplets.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {3, 4},
+        {4, 3},
+        {4, 4}
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(3));
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 3: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 4: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 5: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          default: my_assert_not_reached();
+        }
+      };
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(3));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -399,10 +949,70 @@ MatrixElements<SC> SymmetrySPSU2<SC>::recalc_triplet(const DiagInfo<SC> &diag, c
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "spsu2/spsu2-2ch-triplets.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {4, 4},
+        {5, 5},
+        {6, 6},
+        {6, 7},
+        {7, 6},
+        {7, 7},
+        {8, 8},
+        {8, 9},
+        {9, 8},
+        {9, 9},
+        {10, 10},
+        {10, 11},
+        {11, 10},
+        {11, 11},
+        {12, 12},
+        {12, 13},
+        {13, 12},
+        {13, 13},
+        {14, 14},
+        {14, 15},
+        {15, 14},
+        {15, 15},
+        {15, 16},
+        {16, 15},
+        {16, 16}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return 1;
+          case 3: return 1;
+          case 4: return 1;
+          case 5: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 6: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 7: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 8: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 9: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 10: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 11: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 12: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 13: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 14: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 15: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 16: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 17: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 18: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 19: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 20: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 21: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 22: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 23: return -(1/S(ss1));
+          case 24: return 1 - 1/S(ss1) + 1/(1 + S(ss1));
+          case 25: return 1/(1 + S(ss1));
+          case 26: return -((3 + 2*S(ss1))/((1 + S(ss1))*sqrt(3 + 4*S(ss1)*(2 + S(ss1)))));
+          case 27: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(3));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(3));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -412,10 +1022,258 @@ MatrixElements<SC> SymmetrySPSU2<SC>::recalc_triplet(const DiagInfo<SC> &diag, c
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "spsu2/spsu2-3ch-triplets.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {4, 4},
+        {5, 5},
+        {6, 6},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {10, 10},
+        {11, 11},
+        {12, 12},
+        {13, 13},
+        {14, 14},
+        {15, 15},
+        {15, 16},
+        {16, 15},
+        {16, 16},
+        {17, 17},
+        {17, 18},
+        {18, 17},
+        {18, 18},
+        {19, 19},
+        {19, 20},
+        {20, 19},
+        {20, 20},
+        {21, 21},
+        {21, 22},
+        {22, 21},
+        {22, 22},
+        {23, 23},
+        {23, 24},
+        {24, 23},
+        {24, 24},
+        {25, 25},
+        {25, 26},
+        {26, 25},
+        {26, 26},
+        {27, 27},
+        {27, 28},
+        {28, 27},
+        {28, 28},
+        {29, 29},
+        {29, 30},
+        {30, 29},
+        {30, 30},
+        {31, 31},
+        {31, 32},
+        {32, 31},
+        {32, 32},
+        {33, 33},
+        {33, 34},
+        {34, 33},
+        {34, 34},
+        {35, 35},
+        {35, 36},
+        {36, 35},
+        {36, 36},
+        {37, 37},
+        {37, 38},
+        {38, 37},
+        {38, 38},
+        {39, 39},
+        {39, 40},
+        {40, 39},
+        {40, 40},
+        {41, 41},
+        {41, 42},
+        {42, 41},
+        {42, 42},
+        {43, 43},
+        {43, 44},
+        {44, 43},
+        {44, 44},
+        {44, 45},
+        {45, 44},
+        {45, 45},
+        {46, 46},
+        {46, 47},
+        {47, 46},
+        {47, 47},
+        {47, 48},
+        {48, 47},
+        {48, 48},
+        {49, 49},
+        {49, 50},
+        {50, 49},
+        {50, 50},
+        {50, 51},
+        {51, 50},
+        {51, 51},
+        {52, 52},
+        {52, 53},
+        {53, 52},
+        {53, 53},
+        {53, 54},
+        {54, 53},
+        {54, 54},
+        {55, 55},
+        {55, 56},
+        {56, 55},
+        {56, 56},
+        {56, 57},
+        {57, 56},
+        {57, 57},
+        {58, 58},
+        {58, 59},
+        {59, 58},
+        {59, 59},
+        {59, 60},
+        {60, 59},
+        {60, 60},
+        {61, 61},
+        {61, 62},
+        {62, 61},
+        {62, 62},
+        {62, 63},
+        {63, 62},
+        {63, 63},
+        {63, 64},
+        {64, 63},
+        {64, 64}
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(3));
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return 1;
+          case 3: return 1;
+          case 4: return 1;
+          case 5: return 1;
+          case 6: return 1;
+          case 7: return 1;
+          case 8: return 1;
+          case 9: return 1;
+          case 10: return 1;
+          case 11: return 1;
+          case 12: return 1;
+          case 13: return 1;
+          case 14: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 15: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 16: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 17: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 18: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 19: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 20: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 21: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 22: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 23: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 24: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 25: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 26: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 27: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 28: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 29: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 30: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 31: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 32: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 33: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 34: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 35: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 36: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 37: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 38: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 39: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 40: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 41: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 42: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 43: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 44: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 45: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 46: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 47: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 48: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 49: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 50: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 51: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 52: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 53: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 54: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 55: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 56: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 57: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 58: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 59: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 60: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 61: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 62: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 63: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 64: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 65: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 66: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 67: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 68: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 69: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 4*S(ss1)*(2 + S(ss1))))/S(ss1));
+          case 70: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 71: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 72: return -(1/S(ss1));
+          case 73: return 1 - 1/S(ss1) + 1/(1 + S(ss1));
+          case 74: return 1/(1 + S(ss1));
+          case 75: return -((3 + 2*S(ss1))/((1 + S(ss1))*sqrt(3 + 4*S(ss1)*(2 + S(ss1)))));
+          case 76: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 77: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 78: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 79: return -(1/S(ss1));
+          case 80: return 1 - 1/S(ss1) + 1/(1 + S(ss1));
+          case 81: return 1/(1 + S(ss1));
+          case 82: return -((3 + 2*S(ss1))/((1 + S(ss1))*sqrt(3 + 4*S(ss1)*(2 + S(ss1)))));
+          case 83: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 84: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 85: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 86: return -(1/S(ss1));
+          case 87: return 1 - 1/S(ss1) + 1/(1 + S(ss1));
+          case 88: return 1/(1 + S(ss1));
+          case 89: return -((3 + 2*S(ss1))/((1 + S(ss1))*sqrt(3 + 4*S(ss1)*(2 + S(ss1)))));
+          case 90: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 91: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 92: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 93: return -(1/S(ss1));
+          case 94: return 1 - 1/S(ss1) + 1/(1 + S(ss1));
+          case 95: return 1/(1 + S(ss1));
+          case 96: return -((3 + 2*S(ss1))/((1 + S(ss1))*sqrt(3 + 4*S(ss1)*(2 + S(ss1)))));
+          case 97: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 98: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 99: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 100: return -(1/S(ss1));
+          case 101: return 1 - 1/S(ss1) + 1/(1 + S(ss1));
+          case 102: return 1/(1 + S(ss1));
+          case 103: return -((3 + 2*S(ss1))/((1 + S(ss1))*sqrt(3 + 4*S(ss1)*(2 + S(ss1)))));
+          case 104: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 105: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 106: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 107: return -(1/S(ss1));
+          case 108: return 1 - 1/S(ss1) + 1/(1 + S(ss1));
+          case 109: return 1/(1 + S(ss1));
+          case 110: return -((3 + 2*S(ss1))/((1 + S(ss1))*sqrt(3 + 4*S(ss1)*(2 + S(ss1)))));
+          case 111: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 112: return sqrt(1 + 6/(1 - 2*S(ss1)) + 3/S(ss1));
+          case 113: return sqrt(3 - 3/S(ss1))/sqrt(S(ss1)*(-1 + 2*S(ss1)));
+          case 114: return -(sqrt(3)/sqrt(S(ss1)*(-1 + 2*S(ss1))));
+          case 115: return (-4 + S(ss1) + 2*Power(S(ss1),2))/sqrt(S(ss1)*(1 + S(ss1))*(-1 + 4*Power(S(ss1),2)));
+          case 116: return sqrt(-2 - 3/S(ss1) + 12*S(ss1) + 8*Power(S(ss1),2))/(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 117: return (-3*sqrt((-1 + 2*S(ss1))/(3 + 4*S(ss1)*(2 + S(ss1)))) - S(ss1)*(-1 + 2*S(ss1))*(sqrt((1 + 2*S(ss1))/(-3 + 4*S(ss1)*(1 + S(ss1)))) - sqrt((-1 + 2*S(ss1))/(3 + 4*S(ss1)*(2 + S(ss1))))))/(S(ss1)*sqrt(1 + S(ss1)));
+          case 118: return (-3 + S(ss1)*(3 + 2*S(ss1)))/sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 119: return sqrt(3)/sqrt((1 + S(ss1))*(3 + 2*S(ss1)));
+          case 120: return -(sqrt((6 + 3*S(ss1))/(3 + 2*S(ss1)))/(1 + S(ss1)));
+          case 121: return (5 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 2*S(ss1))*(5 + 2*S(ss1)))/S(ss1));
+          default: my_assert_not_reached();
+        }
+      };
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(3));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -430,10 +1288,24 @@ MatrixElements<SC> SymmetrySPSU2<SC>::recalc_triplet(const DiagInfo<SC> &diag, c
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "spsu2/spsu2-1ch-tripletp.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {4, 3},
+        {4, 4}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return sqrt(1 + 1/(1 + S(ss1)) - 2/(1 + 2*S(ss1)));
+          case 3: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 4: return 1;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(3));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(3));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -443,10 +1315,60 @@ MatrixElements<SC> SymmetrySPSU2<SC>::recalc_triplet(const DiagInfo<SC> &diag, c
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "spsu2/spsu2-2ch-tripletp.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {4, 4},
+        {5, 5},
+        {6, 6},
+        {7, 6},
+        {7, 7},
+        {8, 8},
+        {9, 8},
+        {9, 9},
+        {10, 10},
+        {11, 10},
+        {11, 11},
+        {12, 12},
+        {13, 12},
+        {13, 13},
+        {14, 14},
+        {15, 14},
+        {15, 15},
+        {16, 14},
+        {16, 15},
+        {16, 16}
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(3));
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return 1;
+          case 3: return 1;
+          case 4: return 1;
+          case 5: return sqrt(1 + 1/(1 + S(ss1)) - 2/(1 + 2*S(ss1)));
+          case 6: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 7: return 1;
+          case 8: return sqrt(1 + 1/(1 + S(ss1)) - 2/(1 + 2*S(ss1)));
+          case 9: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 10: return 1;
+          case 11: return sqrt(1 + 1/(1 + S(ss1)) - 2/(1 + 2*S(ss1)));
+          case 12: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 13: return 1;
+          case 14: return sqrt(1 + 1/(1 + S(ss1)) - 2/(1 + 2*S(ss1)));
+          case 15: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 16: return 1;
+          case 17: return sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 18: return -(sqrt(3 + 4*S(ss1)*(2 + S(ss1)))/((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 19: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 20: return 1/(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 21: return -(1/(1 + S(ss1)));
+          case 22: return 1;
+          default: my_assert_not_reached();
+        }
+      };
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(3));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -456,10 +1378,216 @@ MatrixElements<SC> SymmetrySPSU2<SC>::recalc_triplet(const DiagInfo<SC> &diag, c
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "spsu2/spsu2-3ch-tripletp.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {4, 4},
+        {5, 5},
+        {6, 6},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {10, 10},
+        {11, 11},
+        {12, 12},
+        {13, 13},
+        {14, 14},
+        {15, 15},
+        {16, 15},
+        {16, 16},
+        {17, 17},
+        {18, 17},
+        {18, 18},
+        {19, 19},
+        {20, 19},
+        {20, 20},
+        {21, 21},
+        {22, 21},
+        {22, 22},
+        {23, 23},
+        {24, 23},
+        {24, 24},
+        {25, 25},
+        {26, 25},
+        {26, 26},
+        {27, 27},
+        {28, 27},
+        {28, 28},
+        {29, 29},
+        {30, 29},
+        {30, 30},
+        {31, 31},
+        {32, 31},
+        {32, 32},
+        {33, 33},
+        {34, 33},
+        {34, 34},
+        {35, 35},
+        {36, 35},
+        {36, 36},
+        {37, 37},
+        {38, 37},
+        {38, 38},
+        {39, 39},
+        {40, 39},
+        {40, 40},
+        {41, 41},
+        {42, 41},
+        {42, 42},
+        {43, 43},
+        {44, 43},
+        {44, 44},
+        {45, 43},
+        {45, 44},
+        {45, 45},
+        {46, 46},
+        {47, 46},
+        {47, 47},
+        {48, 46},
+        {48, 47},
+        {48, 48},
+        {49, 49},
+        {50, 49},
+        {50, 50},
+        {51, 49},
+        {51, 50},
+        {51, 51},
+        {52, 52},
+        {53, 52},
+        {53, 53},
+        {54, 52},
+        {54, 53},
+        {54, 54},
+        {55, 55},
+        {56, 55},
+        {56, 56},
+        {57, 55},
+        {57, 56},
+        {57, 57},
+        {58, 58},
+        {59, 58},
+        {59, 59},
+        {60, 58},
+        {60, 59},
+        {60, 60},
+        {61, 61},
+        {62, 61},
+        {62, 62},
+        {63, 61},
+        {63, 62},
+        {63, 63},
+        {64, 62},
+        {64, 63},
+        {64, 64}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return 1;
+          case 3: return 1;
+          case 4: return 1;
+          case 5: return 1;
+          case 6: return 1;
+          case 7: return 1;
+          case 8: return 1;
+          case 9: return 1;
+          case 10: return 1;
+          case 11: return 1;
+          case 12: return 1;
+          case 13: return 1;
+          case 14: return sqrt(1 + 1/(1 + S(ss1)) - 2/(1 + 2*S(ss1)));
+          case 15: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 16: return 1;
+          case 17: return sqrt(1 + 1/(1 + S(ss1)) - 2/(1 + 2*S(ss1)));
+          case 18: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 19: return 1;
+          case 20: return sqrt(1 + 1/(1 + S(ss1)) - 2/(1 + 2*S(ss1)));
+          case 21: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 22: return 1;
+          case 23: return sqrt(1 + 1/(1 + S(ss1)) - 2/(1 + 2*S(ss1)));
+          case 24: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 25: return 1;
+          case 26: return sqrt(1 + 1/(1 + S(ss1)) - 2/(1 + 2*S(ss1)));
+          case 27: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 28: return 1;
+          case 29: return sqrt(1 + 1/(1 + S(ss1)) - 2/(1 + 2*S(ss1)));
+          case 30: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 31: return 1;
+          case 32: return sqrt(1 + 1/(1 + S(ss1)) - 2/(1 + 2*S(ss1)));
+          case 33: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 34: return 1;
+          case 35: return sqrt(1 + 1/(1 + S(ss1)) - 2/(1 + 2*S(ss1)));
+          case 36: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 37: return 1;
+          case 38: return sqrt(1 + 1/(1 + S(ss1)) - 2/(1 + 2*S(ss1)));
+          case 39: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 40: return 1;
+          case 41: return sqrt(1 + 1/(1 + S(ss1)) - 2/(1 + 2*S(ss1)));
+          case 42: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 43: return 1;
+          case 44: return sqrt(1 + 1/(1 + S(ss1)) - 2/(1 + 2*S(ss1)));
+          case 45: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 46: return 1;
+          case 47: return sqrt(1 + 1/(1 + S(ss1)) - 2/(1 + 2*S(ss1)));
+          case 48: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 49: return 1;
+          case 50: return sqrt(1 + 1/(1 + S(ss1)) - 2/(1 + 2*S(ss1)));
+          case 51: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 52: return 1;
+          case 53: return sqrt(1 + 1/(1 + S(ss1)) - 2/(1 + 2*S(ss1)));
+          case 54: return (-sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*S(ss1))) + 2*S(ss1)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/((1 + S(ss1))*sqrt(3 + 2*S(ss1)));
+          case 55: return 1;
+          case 56: return sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 57: return -(sqrt(3 + 4*S(ss1)*(2 + S(ss1)))/((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 58: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 59: return 1/(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 60: return -(1/(1 + S(ss1)));
+          case 61: return 1;
+          case 62: return sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 63: return -(sqrt(3 + 4*S(ss1)*(2 + S(ss1)))/((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 64: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 65: return 1/(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 66: return -(1/(1 + S(ss1)));
+          case 67: return 1;
+          case 68: return sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 69: return -(sqrt(3 + 4*S(ss1)*(2 + S(ss1)))/((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 70: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 71: return 1/(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 72: return -(1/(1 + S(ss1)));
+          case 73: return 1;
+          case 74: return sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 75: return -(sqrt(3 + 4*S(ss1)*(2 + S(ss1)))/((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 76: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 77: return 1/(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 78: return -(1/(1 + S(ss1)));
+          case 79: return 1;
+          case 80: return sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 81: return -(sqrt(3 + 4*S(ss1)*(2 + S(ss1)))/((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 82: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 83: return 1/(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 84: return -(1/(1 + S(ss1)));
+          case 85: return 1;
+          case 86: return sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1));
+          case 87: return -(sqrt(3 + 4*S(ss1)*(2 + S(ss1)))/((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 88: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 89: return 1/(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 90: return -(1/(1 + S(ss1)));
+          case 91: return 1;
+          case 92: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-3 + S(ss1) + 2*Power(S(ss1),2)));
+          case 93: return -(sqrt(9 + 15*S(ss1) + 6*Power(S(ss1),2))/(1 + 3*S(ss1) + 2*Power(S(ss1),2)));
+          case 94: return sqrt(S(ss1)*(2 + S(ss1))*(-1 + 2*S(ss1))*(3 + 2*S(ss1)))/((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 95: return sqrt(3)/(sqrt(S(ss1)*(1 + S(ss1)))*(1 + 2*S(ss1)));
+          case 96: return (-4*S(ss1)*(2 + S(ss1)))/((1 + 2*S(ss1))*sqrt(S(ss1)*(1 + S(ss1))*(2 + S(ss1))*(3 + 2*S(ss1))));
+          case 97: return sqrt((S(ss1)*(5 + 2*S(ss1)))/(3 + 5*S(ss1) + 2*Power(S(ss1),2)));
+          case 98: return (sqrt(3)*sqrt(2 + S(ss1) + 1/(1 + 2*S(ss1))))/(Power(1 + S(ss1),1.5)*(3 + 2*S(ss1)));
+          case 99: return -(sqrt(3)/sqrt((1 + S(ss1))*(3 + 2*S(ss1))));
+          case 100: return 1;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(3));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(3));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -474,10 +1602,24 @@ MatrixElements<SC> SymmetrySPSU2<SC>::recalc_triplet(const DiagInfo<SC> &diag, c
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "spsu2/spsu2-1ch-tripletm.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {3, 4},
+        {4, 4}
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(3));
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return 1;
+          case 3: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 4: return (1/sqrt((S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1)))/(-1 + 2*S(ss1))) + 1/sqrt((S(ss1)*(1 + S(ss1)))/(-1 + 4*Power(S(ss1),2))))/2.;
+          default: my_assert_not_reached();
+        }
+      };
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(3));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -487,10 +1629,60 @@ MatrixElements<SC> SymmetrySPSU2<SC>::recalc_triplet(const DiagInfo<SC> &diag, c
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "spsu2/spsu2-2ch-tripletm.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {4, 4},
+        {5, 5},
+        {6, 6},
+        {6, 7},
+        {7, 7},
+        {8, 8},
+        {8, 9},
+        {9, 9},
+        {10, 10},
+        {10, 11},
+        {11, 11},
+        {12, 12},
+        {12, 13},
+        {13, 13},
+        {14, 14},
+        {14, 15},
+        {14, 16},
+        {15, 15},
+        {15, 16},
+        {16, 16}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return 1;
+          case 3: return 1;
+          case 4: return 1;
+          case 5: return 1;
+          case 6: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 7: return (1/sqrt((S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1)))/(-1 + 2*S(ss1))) + 1/sqrt((S(ss1)*(1 + S(ss1)))/(-1 + 4*Power(S(ss1),2))))/2.;
+          case 8: return 1;
+          case 9: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 10: return (1/sqrt((S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1)))/(-1 + 2*S(ss1))) + 1/sqrt((S(ss1)*(1 + S(ss1)))/(-1 + 4*Power(S(ss1),2))))/2.;
+          case 11: return 1;
+          case 12: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 13: return (1/sqrt((S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1)))/(-1 + 2*S(ss1))) + 1/sqrt((S(ss1)*(1 + S(ss1)))/(-1 + 4*Power(S(ss1),2))))/2.;
+          case 14: return 1;
+          case 15: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 16: return (1/sqrt((S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1)))/(-1 + 2*S(ss1))) + 1/sqrt((S(ss1)*(1 + S(ss1)))/(-1 + 4*Power(S(ss1),2))))/2.;
+          case 17: return 1;
+          case 18: return 1/S(ss1);
+          case 19: return 1/(S(ss1) + 2*Power(S(ss1),2));
+          case 20: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 21: return sqrt(1 - 2/(1 + 2*S(ss1)))/S(ss1);
+          case 22: return sqrt(-3 + 4*S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1));
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(3));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(3));
       if (cn) cnew[II] = *cn;
     }
   }
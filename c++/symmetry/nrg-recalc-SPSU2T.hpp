@@ -31,6 +31,7 @@ namespace NRG {
 template<typename SC>
 MatrixElements<SC> SymmetrySPSU2T<SC>::recalc_doublet(const DiagInfo<SC> &diag, const SubspaceStructure &substruct, const MatrixElements<SC> &cold) const {
   MatrixElements<SC> cnew;
+  const auto blocks = std::make_shared<const BlockIndex<SC>>(cold, substruct);
   for(const auto &[I1, eig]: diag) {
     int ss1  = I1.get("SS");
     int t1 = I1.get("T");
@@ -45,10 +46,384 @@ MatrixElements<SC> SymmetrySPSU2T<SC>::recalc_doublet(const DiagInfo<SC> &diag,
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "spsu2t/spsu2t-doubletp-1.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {4, 4},
+        {5, 5},
+        {5, 6},
+        {5, 7},
+        {6, 6},
+        {6, 7},
+        {6, 8},
+        {7, 7},
+        {7, 8},
+        {7, 9},
+        {8, 8},
+        {8, 9},
+        {9, 9},
+        {10, 10},
+        {10, 11},
+        {10, 12},
+        {11, 11},
+        {11, 12},
+        {11, 13},
+        {12, 12},
+        {12, 13},
+        {12, 14},
+        {13, 13},
+        {13, 14},
+        {14, 14},
+        {15, 15},
+        {15, 16},
+        {15, 17},
+        {16, 16},
+        {16, 17},
+        {17, 17},
+        {18, 15},
+        {18, 16},
+        {18, 17},
+        {18, 18},
+        {18, 19},
+        {18, 20},
+        {19, 16},
+        {19, 17},
+        {19, 19},
+        {19, 20},
+        {20, 17},
+        {20, 20},
+        {21, 21},
+        {21, 22},
+        {21, 23},
+        {22, 22},
+        {22, 23},
+        {23, 23},
+        {24, 21},
+        {24, 22},
+        {24, 23},
+        {24, 24},
+        {24, 25},
+        {24, 26},
+        {25, 22},
+        {25, 23},
+        {25, 25},
+        {25, 26},
+        {26, 23},
+        {26, 26},
+        {27, 27},
+        {27, 28},
+        {27, 29},
+        {28, 28},
+        {28, 29},
+        {29, 29},
+        {30, 27},
+        {30, 28},
+        {30, 29},
+        {30, 30},
+        {30, 31},
+        {30, 32},
+        {31, 28},
+        {31, 29},
+        {31, 31},
+        {31, 32},
+        {32, 29},
+        {32, 32},
+        {33, 33},
+        {33, 34},
+        {33, 35},
+        {34, 34},
+        {34, 35},
+        {34, 36},
+        {35, 35},
+        {35, 36},
+        {35, 37},
+        {36, 36},
+        {36, 37},
+        {37, 37},
+        {38, 33},
+        {38, 34},
+        {38, 35},
+        {38, 38},
+        {38, 39},
+        {38, 40},
+        {39, 34},
+        {39, 35},
+        {39, 36},
+        {39, 39},
+        {39, 40},
+        {39, 41},
+        {40, 35},
+        {40, 36},
+        {40, 37},
+        {40, 40},
+        {40, 41},
+        {40, 42},
+        {41, 36},
+        {41, 37},
+        {41, 41},
+        {41, 42},
+        {42, 37},
+        {42, 42},
+        {43, 43},
+        {43, 44},
+        {43, 45},
+        {44, 44},
+        {44, 45},
+        {45, 45},
+        {46, 43},
+        {46, 44},
+        {46, 45},
+        {46, 46},
+        {46, 47},
+        {46, 48},
+        {47, 44},
+        {47, 45},
+        {47, 47},
+        {47, 48},
+        {48, 45},
+        {48, 48},
+        {49, 46},
+        {49, 47},
+        {49, 48},
+        {49, 49},
+        {49, 50},
+        {49, 51},
+        {50, 47},
+        {50, 48},
+        {50, 50},
+        {50, 51},
+        {51, 48},
+        {51, 51},
+        {52, 52},
+        {52, 53},
+        {52, 54},
+        {53, 53},
+        {53, 54},
+        {54, 54},
+        {55, 52},
+        {55, 53},
+        {55, 54},
+        {55, 55},
+        {55, 56},
+        {55, 57},
+        {56, 53},
+        {56, 54},
+        {56, 56},
+        {56, 57},
+        {57, 54},
+        {57, 57},
+        {58, 55},
+        {58, 56},
+        {58, 57},
+        {58, 58},
+        {58, 59},
+        {58, 60},
+        {59, 56},
+        {59, 57},
+        {59, 59},
+        {59, 60},
+        {60, 57},
+        {60, 60},
+        {61, 61},
+        {62, 61},
+        {62, 62},
+        {63, 62},
+        {63, 63},
+        {64, 63},
+        {64, 64}
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(1, 2, 1));
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return 1;
+          case 3: return 1;
+          case 4: return 1;
+          case 5: return sqrt(2)/sqrt((-1 + T)*T);
+          case 6: return sqrt(6)/sqrt(T*(1 + 2*T)*(1 - 3*T + 2*Power(T,2)));
+          case 7: return 1/sqrt(((-1 + T)*T)/(-2 - T + Power(T,2)));
+          case 8: return ((-3 + 2*T)*sqrt((3 + 9*T + 6*Power(T,2))/(3 - 5*T + 2*Power(T,2))))/(T*(1 + 2*T));
+          case 9: return 3/(T + 2*Power(T,2));
+          case 10: return (sqrt((-1 + T)/(3 + 11*T + 12*Power(T,2) + 4*Power(T,3)))*(6*sqrt((3 - 2*T)/(1 - 2*T)) + 3*sqrt(3 - 8*T + 4*Power(T,2)) + T*sqrt(3 - 8*T + 4*Power(T,2))))/T;
+          case 11: return (sqrt(3)*sqrt((-3 + T + 2*Power(T,2))/(1 + 3*T + 2*Power(T,2))))/T;
+          case 12: return sqrt(6)/sqrt(T*(1 + 2*T)*(3 + 5*T + 2*Power(T,2)));
+          case 13: return (sqrt((-1 + T)/T)*(T*Power(1 + T,1.5)*(1 + 2*T)*sqrt(-6 + 5*T + 12*Power(T,2) + 4*Power(T,3)) + 9*Power(T,2)*sqrt((-6 + 5*T + 12*Power(T,2) + 4*Power(T,3))/(1 + T)) + 6*Power(T,3)*sqrt((-6 + 5*T + 12*Power(T,2) + 4*Power(T,3))/(1 + T)) + 6*sqrt(-6 - T + 17*Power(T,2) + 16*Power(T,3) + 4*Power(T,4)) + 3*T*(sqrt((-6 + 5*T + 12*Power(T,2) + 4*Power(T,3))/(1 + T)) + 3*sqrt(-6 - T + 17*Power(T,2) + 16*Power(T,3) + 4*Power(T,4)))))/(Power(1 + T,2)*(6 + 19*T + 16*Power(T,2) + 4*Power(T,3)));
+          case 14: return (sqrt(2)*(6*sqrt(T*(-3 + 4*T + 4*Power(T,2))) + 7*sqrt(Power(T,3)*(-3 + 4*T + 4*Power(T,2))) + 2*sqrt(Power(T,5)*(-3 + 4*T + 4*Power(T,2)))))/(T*(2 + T)*(3 + 2*T)*sqrt((1 + 2*T)*(3 + 5*T + 2*Power(T,2))));
+          case 15: return (18*sqrt((T*(-1 + 2*T))/(6 + 7*T + 2*Power(T,2))) + 2*sqrt((T*(-3 + 4*T + 4*Power(T,2)))/(2 + T)) + sqrt(T*(-6 + 5*T + 12*Power(T,2) + 4*Power(T,3))) + 2*T*(6*sqrt((T*(-1 + 2*T))/(6 + 7*T + 2*Power(T,2))) + 2*sqrt((T*(-3 + 4*T + 4*Power(T,2)))/(2 + T)) + sqrt(T*(-6 + 5*T + 12*Power(T,2) + 4*Power(T,3)))))/((3 + 2*T)*sqrt(T*(10 + 29*T + 20*Power(T,2) + 4*Power(T,3))));
+          case 16: return 1;
+          case 17: return sqrt(2)/sqrt((-1 + T)*T);
+          case 18: return sqrt(6)/sqrt(T*(1 + 2*T)*(1 - 3*T + 2*Power(T,2)));
+          case 19: return 1/sqrt(((-1 + T)*T)/(-2 - T + Power(T,2)));
+          case 20: return ((-3 + 2*T)*sqrt((3 + 9*T + 6*Power(T,2))/(3 - 5*T + 2*Power(T,2))))/(T*(1 + 2*T));
+          case 21: return 3/(T + 2*Power(T,2));
+          case 22: return (sqrt((-1 + T)/(3 + 11*T + 12*Power(T,2) + 4*Power(T,3)))*(6*sqrt((3 - 2*T)/(1 - 2*T)) + 3*sqrt(3 - 8*T + 4*Power(T,2)) + T*sqrt(3 - 8*T + 4*Power(T,2))))/T;
+          case 23: return (sqrt(3)*sqrt((-3 + T + 2*Power(T,2))/(1 + 3*T + 2*Power(T,2))))/T;
+          case 24: return sqrt(6)/sqrt(T*(1 + 2*T)*(3 + 5*T + 2*Power(T,2)));
+          case 25: return (sqrt((-1 + T)/T)*(T*Power(1 + T,1.5)*(1 + 2*T)*sqrt(-6 + 5*T + 12*Power(T,2) + 4*Power(T,3)) + 9*Power(T,2)*sqrt((-6 + 5*T + 12*Power(T,2) + 4*Power(T,3))/(1 + T)) + 6*Power(T,3)*sqrt((-6 + 5*T + 12*Power(T,2) + 4*Power(T,3))/(1 + T)) + 6*sqrt(-6 - T + 17*Power(T,2) + 16*Power(T,3) + 4*Power(T,4)) + 3*T*(sqrt((-6 + 5*T + 12*Power(T,2) + 4*Power(T,3))/(1 + T)) + 3*sqrt(-6 - T + 17*Power(T,2) + 16*Power(T,3) + 4*Power(T,4)))))/(Power(1 + T,2)*(6 + 19*T + 16*Power(T,2) + 4*Power(T,3)));
+          case 26: return (sqrt(2)*(6*sqrt(T*(-3 + 4*T + 4*Power(T,2))) + 7*sqrt(Power(T,3)*(-3 + 4*T + 4*Power(T,2))) + 2*sqrt(Power(T,5)*(-3 + 4*T + 4*Power(T,2)))))/(T*(2 + T)*(3 + 2*T)*sqrt((1 + 2*T)*(3 + 5*T + 2*Power(T,2))));
+          case 27: return (18*sqrt((T*(-1 + 2*T))/(6 + 7*T + 2*Power(T,2))) + 2*sqrt((T*(-3 + 4*T + 4*Power(T,2)))/(2 + T)) + sqrt(T*(-6 + 5*T + 12*Power(T,2) + 4*Power(T,3))) + 2*T*(6*sqrt((T*(-1 + 2*T))/(6 + 7*T + 2*Power(T,2))) + 2*sqrt((T*(-3 + 4*T + 4*Power(T,2)))/(2 + T)) + sqrt(T*(-6 + 5*T + 12*Power(T,2) + 4*Power(T,3)))))/((3 + 2*T)*sqrt(T*(10 + 29*T + 20*Power(T,2) + 4*Power(T,3))));
+          case 28: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 29: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(T + 2*S(ss1)*T);
+          case 30: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/((1 + 2*S(ss1))*(T + 2*Power(T,2)));
+          case 31: return (-2*(-sqrt(S(ss1)/((1 + 2*S(ss1))*(-1 + T))) + sqrt((S(ss1)*(-1 + T))/((1 + 2*S(ss1))*Power(T,2))) + sqrt(S(ss1)/((1 + 2*S(ss1))*(-1 + T)))*T))/sqrt(((1 + 2*S(ss1))*(1 + T))/(1 + S(ss1)));
+          case 32: return (-2*sqrt(S(ss1)*(1 + S(ss1))*(-1 + 4*Power(T,2))))/((1 + 2*S(ss1))*(T + 2*Power(T,2)));
+          case 33: return (-2*(sqrt((S(ss1)*(-1 + 2*T))/((1 + 2*S(ss1))*(1 + T))) + sqrt((S(ss1)*(-1 + 2*T))/((1 + 2*S(ss1))*(1 + T)*Power(1 + 2*T,2))) + sqrt((S(ss1)*(-1 + T + 2*Power(T,2)))/(1 + 2*S(ss1)))))/sqrt(((1 + 2*S(ss1))*(3 + 5*T + 2*Power(T,2)))/(1 + S(ss1)));
+          case 34: return 1/(1 + 2*S(ss1));
+          case 35: return 1/(T + 2*S(ss1)*T);
+          case 36: return 1/((1 + 2*S(ss1))*(T + 2*Power(T,2)));
+          case 37: return -1;
+          case 38: return -(1/T);
+          case 39: return -(1/(T + 2*Power(T,2)));
+          case 40: return sqrt(-1 + Power(T,2))/(T + 2*S(ss1)*T);
+          case 41: return sqrt((-1 + 2*T)/(1 + 2*T))/(T + 2*S(ss1)*T);
+          case 42: return -(sqrt(-1 + Power(T,2))/T);
+          case 43: return -(sqrt((-1 + 2*T)/(1 + 2*T))/T);
+          case 44: return (-2*sqrt((Power(S(ss1),2)*Power(1 + S(ss1),3)*T*Power(3 + 2*T,3)*(-1 + T + 2*Power(T,2)))/(Power(1 + 2*S(ss1),2)*Power(1 + 2*T,3))) + sqrt((Power(1 + S(ss1),3)*T*Power(3 + 2*T,3)*(-1 + T + 2*Power(T,2)))/(1 + 2*T)) - 2*sqrt((Power(S(ss1),2)*Power(1 + S(ss1),3)*T*Power(3 + 2*T,3)*(-1 + T + 2*Power(T,2)))/(Power(1 + 2*S(ss1),2)*(1 + 2*T))) + ((1 + T)*Power((1 + S(ss1))*(3 + 2*T),1.5)*sqrt((T*(-1 + 2*T))/(1 + 3*T + 2*Power(T,2))))/(1 + 2*T) + sqrt((Power(1 + S(ss1),3)*T*(-1 + 2*T)*Power(3 + 5*T + 2*Power(T,2),3))/(1 + 2*T)) - 2*sqrt((Power(S(ss1),2)*Power(1 + S(ss1),3)*T*(-1 + 2*T)*Power(3 + 5*T + 2*Power(T,2),3))/(Power(1 + 2*S(ss1),2)*(1 + 2*T))))/sqrt((Power(1 + S(ss1),3)*T*Power(1 + T,3)*Power(3 + 2*T,4))/(1 + 2*T));
+          case 45: return (-sqrt((Power(1 + S(ss1),3)*(1 + 2*S(ss1))*T*Power(3 + 2*T,3)*(-1 + T + 2*Power(T,2)))/((3 + 2*S(ss1))*Power(1 + 2*T,3))) - sqrt((Power(1 + S(ss1),3)*(1 + 2*S(ss1))*T*Power(3 + 2*T,3)*(-1 + T + 2*Power(T,2)))/((3 + 2*S(ss1))*(1 + 2*T))) - 2*sqrt((Power(1 + S(ss1),3)*T*Power(3 + 2*T,3)*(-1 + T + 2*Power(T,2)))/((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(1 + 2*T))) - sqrt((Power(1 + S(ss1),3)*(1 + 2*S(ss1))*T*(-1 + 2*T)*Power(3 + 5*T + 2*Power(T,2),3))/((3 + 2*S(ss1))*(1 + 2*T))) - 2*sqrt((Power(1 + S(ss1),3)*T*(-1 + 2*T)*Power(3 + 5*T + 2*Power(T,2),3))/((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(1 + 2*T))) - (2*(1 + S(ss1))*(1 + T)*(3 + 2*T)*sqrt(((1 + S(ss1))*T*(-3 + 4*T + 4*Power(T,2)))/((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(1 + 3*T + 2*Power(T,2)))))/(1 + 2*T))/sqrt((Power(1 + S(ss1),3)*(3 + 2*S(ss1))*T*Power(1 + T,3)*Power(3 + 2*T,4))/((1 + 2*S(ss1))*(1 + 2*T)));
+          case 46: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 47: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(T + 2*S(ss1)*T);
+          case 48: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/((1 + 2*S(ss1))*(T + 2*Power(T,2)));
+          case 49: return (-2*(-sqrt(S(ss1)/((1 + 2*S(ss1))*(-1 + T))) + sqrt((S(ss1)*(-1 + T))/((1 + 2*S(ss1))*Power(T,2))) + sqrt(S(ss1)/((1 + 2*S(ss1))*(-1 + T)))*T))/sqrt(((1 + 2*S(ss1))*(1 + T))/(1 + S(ss1)));
+          case 50: return (-2*sqrt(S(ss1)*(1 + S(ss1))*(-1 + 4*Power(T,2))))/((1 + 2*S(ss1))*(T + 2*Power(T,2)));
+          case 51: return (-2*(sqrt((S(ss1)*(-1 + 2*T))/((1 + 2*S(ss1))*(1 + T))) + sqrt((S(ss1)*(-1 + 2*T))/((1 + 2*S(ss1))*(1 + T)*Power(1 + 2*T,2))) + sqrt((S(ss1)*(-1 + T + 2*Power(T,2)))/(1 + 2*S(ss1)))))/sqrt(((1 + 2*S(ss1))*(3 + 5*T + 2*Power(T,2)))/(1 + S(ss1)));
+          case 52: return 1/(1 + 2*S(ss1));
+          case 53: return 1/(T + 2*S(ss1)*T);
+          case 54: return 1/((1 + 2*S(ss1))*(T + 2*Power(T,2)));
+          case 55: return -1;
+          case 56: return -(1/T);
+          case 57: return -(1/(T + 2*Power(T,2)));
+          case 58: return sqrt(-1 + Power(T,2))/(T + 2*S(ss1)*T);
+          case 59: return sqrt((1 + 2*S(ss1))/(Power(1 + S(ss1),3)*Power(T,3)*Power(1 + T,4)*(1 + 2*T)))*(-2*S(ss1)*Power((1 + S(ss1))/(1 + 2*S(ss1)),1.5)*T*(1 + T)*sqrt(T*(-1 + 2*T)) + Power(1 + S(ss1),1.5)*(1 + T)*sqrt((T*(-1 + 2*T))/(1 + 2*S(ss1))) + Power(1 + S(ss1),1.5)*T*(1 + T)*sqrt((T*(-1 + 2*T))/(1 + 2*S(ss1))) - (2*S(ss1)*T)/(sqrt((T*(1 + T))/(-1 + 2*T))*Power((1 + 2*S(ss1))/(1 + S(ss1) + T + S(ss1)*T),1.5)));
+          case 60: return -(sqrt(-1 + Power(T,2))/T);
+          case 61: return -(sqrt((-1 + 2*T)/(1 + 2*T))/T);
+          case 62: return sqrt(-3 + 4*T + 4*Power(T,2))/(1 + 2*S(ss1) + 2*T + 4*S(ss1)*T);
+          case 63: return (sqrt(((1 + 2*S(ss1))*(1 + 2*T))/((3 + 2*S(ss1))*T))*(-(sqrt(((1 + 2*S(ss1))*T*(1 + T)*(-1 + 2*T))/((3 + 2*S(ss1))*(1 + 2*T)))*Power((1 + S(ss1))*(3 + 2*T),1.5)) - sqrt(((1 + 2*S(ss1))*T*(1 + T)*(-1 + 2*T))/(3 + 2*S(ss1)))*Power(((1 + S(ss1))*(3 + 2*T))/(1 + 2*T),1.5) - 2*Power((1 + S(ss1))*(3 + 2*T),1.5)*sqrt((T*(-1 + T + 2*Power(T,2)))/((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(1 + 2*T))) - (2*(1 + S(ss1))*(1 + T)*(3 + 2*T)*sqrt(((1 + S(ss1))*T*(-1 + 2*T)*(3 + 2*T))/((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(1 + 3*T + 2*Power(T,2)))))/(1 + 2*T) - sqrt(((1 + 2*S(ss1))*T*(-1 + 2*T))/((3 + 2*S(ss1))*(1 + 2*T)))*Power((1 + S(ss1))*(3 + 5*T + 2*Power(T,2)),1.5) - 2*sqrt((T*(-1 + 2*T))/((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(1 + 2*T)))*Power((1 + S(ss1))*(3 + 5*T + 2*Power(T,2)),1.5)))/(Power((1 + S(ss1))*(1 + T),1.5)*Power(3 + 2*T,2));
+          case 64: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 65: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(T + 2*S(ss1)*T);
+          case 66: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/((1 + 2*S(ss1))*(T + 2*Power(T,2)));
+          case 67: return (-2*(-sqrt(S(ss1)/((1 + 2*S(ss1))*(-1 + T))) + sqrt((S(ss1)*(-1 + T))/((1 + 2*S(ss1))*Power(T,2))) + sqrt(S(ss1)/((1 + 2*S(ss1))*(-1 + T)))*T))/sqrt(((1 + 2*S(ss1))*(1 + T))/(1 + S(ss1)));
+          case 68: return (-2*sqrt(S(ss1)*(1 + S(ss1))*(-1 + 4*Power(T,2))))/((1 + 2*S(ss1))*(T + 2*Power(T,2)));
+          case 69: return (-2*(sqrt((S(ss1)*(-1 + 2*T))/((1 + 2*S(ss1))*(1 + T))) + sqrt((S(ss1)*(-1 + 2*T))/((1 + 2*S(ss1))*(1 + T)*Power(1 + 2*T,2))) + sqrt((S(ss1)*(-1 + T + 2*Power(T,2)))/(1 + 2*S(ss1)))))/sqrt(((1 + 2*S(ss1))*(3 + 5*T + 2*Power(T,2)))/(1 + S(ss1)));
+          case 70: return 1/(1 + 2*S(ss1));
+          case 71: return 1/(T + 2*S(ss1)*T);
+          case 72: return 1/((1 + 2*S(ss1))*(T + 2*Power(T,2)));
+          case 73: return -1;
+          case 74: return -(1/T);
+          case 75: return -(1/(T + 2*Power(T,2)));
+          case 76: return sqrt(-1 + Power(T,2))/(T + 2*S(ss1)*T);
+          case 77: return sqrt((-1 + 2*T)/(1 + 2*T))/(T + 2*S(ss1)*T);
+          case 78: return -(sqrt(-1 + Power(T,2))/T);
+          case 79: return -(sqrt((-1 + 2*T)/(1 + 2*T))/T);
+          case 80: return (-2*sqrt((Power(S(ss1),2)*Power(1 + S(ss1),3)*T*Power(3 + 2*T,3)*(-1 + T + 2*Power(T,2)))/(Power(1 + 2*S(ss1),2)*Power(1 + 2*T,3))) + sqrt((Power(1 + S(ss1),3)*T*Power(3 + 2*T,3)*(-1 + T + 2*Power(T,2)))/(1 + 2*T)) - 2*sqrt((Power(S(ss1),2)*Power(1 + S(ss1),3)*T*Power(3 + 2*T,3)*(-1 + T + 2*Power(T,2)))/(Power(1 + 2*S(ss1),2)*(1 + 2*T))) + ((1 + T)*Power((1 + S(ss1))*(3 + 2*T),1.5)*sqrt((T*(-1 + 2*T))/(1 + 3*T + 2*Power(T,2))))/(1 + 2*T) + sqrt((Power(1 + S(ss1),3)*T*(-1 + 2*T)*Power(3 + 5*T + 2*Power(T,2),3))/(1 + 2*T)) - 2*sqrt((Power(S(ss1),2)*Power(1 + S(ss1),3)*T*(-1 + 2*T)*Power(3 + 5*T + 2*Power(T,2),3))/(Power(1 + 2*S(ss1),2)*(1 + 2*T))))/sqrt((Power(1 + S(ss1),3)*T*Power(1 + T,3)*Power(3 + 2*T,4))/(1 + 2*T));
+          case 81: return (-sqrt((Power(1 + S(ss1),3)*(1 + 2*S(ss1))*T*Power(3 + 2*T,3)*(-1 + T + 2*Power(T,2)))/((3 + 2*S(ss1))*Power(1 + 2*T,3))) - sqrt((Power(1 + S(ss1),3)*(1 + 2*S(ss1))*T*Power(3 + 2*T,3)*(-1 + T + 2*Power(T,2)))/((3 + 2*S(ss1))*(1 + 2*T))) - 2*sqrt((Power(1 + S(ss1),3)*T*Power(3 + 2*T,3)*(-1 + T + 2*Power(T,2)))/((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(1 + 2*T))) - sqrt((Power(1 + S(ss1),3)*(1 + 2*S(ss1))*T*(-1 + 2*T)*Power(3 + 5*T + 2*Power(T,2),3))/((3 + 2*S(ss1))*(1 + 2*T))) - 2*sqrt((Power(1 + S(ss1),3)*T*(-1 + 2*T)*Power(3 + 5*T + 2*Power(T,2),3))/((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(1 + 2*T))) - (2*(1 + S(ss1))*(1 + T)*(3 + 2*T)*sqrt(((1 + S(ss1))*T*(-3 + 4*T + 4*Power(T,2)))/((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(1 + 3*T + 2*Power(T,2)))))/(1 + 2*T))/sqrt((Power(1 + S(ss1),3)*(3 + 2*S(ss1))*T*Power(1 + T,3)*Power(3 + 2*T,4))/((1 + 2*S(ss1))*(1 + 2*T)));
+          case 82: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 83: return (-2*sqrt(2)*sqrt((S(ss1)*(1 + S(ss1)))/((-1 + T)*T)))/(1 + 2*S(ss1));
+          case 84: return -2*sqrt(6)*sqrt((S(ss1)*(1 + S(ss1)))/(Power(1 + 2*S(ss1),2)*(T - Power(T,2) - 4*Power(T,3) + 4*Power(T,4))));
+          case 85: return (-2*(2*sqrt((S(ss1)*(1 + T))/((1 + 2*S(ss1))*(-2 + T)*T)) - 3*T*sqrt((S(ss1)*(1 + T))/((1 + 2*S(ss1))*(-2 + T)*T)) + Power(T,2)*sqrt((S(ss1)*(1 + T))/((1 + 2*S(ss1))*(-2 + T)*T)) + 2*sqrt((S(ss1)*(-2 + T)*(1 + T))/(T + 2*S(ss1)*T))))/(sqrt(((1 + 2*S(ss1))*(-1 + T))/(1 + S(ss1)))*(1 + T));
+          case 86: return (-2*sqrt(3)*sqrt((1 + S(ss1))/((1 + 2*S(ss1))*(-1 + T)))*(2*sqrt((S(ss1)*(-3 - T + 2*Power(T,2)))/((1 + 2*S(ss1))*(1 + 2*T))) + 3*sqrt((S(ss1)*(1 + T))/((1 + 2*S(ss1))*(-3 - 4*T + 4*Power(T,2)))) - 5*T*sqrt((S(ss1)*(1 + T))/((1 + 2*S(ss1))*(-3 - 4*T + 4*Power(T,2)))) + 2*Power(T,2)*sqrt((S(ss1)*(1 + T))/((1 + 2*S(ss1))*(-3 - 4*T + 4*Power(T,2))))))/(T*(1 + T));
+          case 87: return (-6*sqrt(S(ss1)*(1 + S(ss1))))/((1 + 2*S(ss1))*(T + 2*Power(T,2)));
+          case 88: return (-2*sqrt((1 + S(ss1))/((T + 2*S(ss1)*T)*(3 + 5*T + 2*Power(T,2))))*(9*sqrt((S(ss1)*(1 - 3*T + 2*Power(T,2)))/((1 + 2*S(ss1))*T*(-3 - 4*T + 4*Power(T,2)))) + 6*sqrt((S(ss1)*(-3 + 11*T - 12*Power(T,2) + 4*Power(T,3)))/((1 + 2*S(ss1))*(T + 2*Power(T,2)))) - 12*Power(T,3)*sqrt((S(ss1)*(-1 + 2*T))/((1 + 2*S(ss1))*T*(3 + T - 8*Power(T,2) + 4*Power(T,3)))) + 4*Power(T,4)*sqrt((S(ss1)*(-1 + 2*T))/((1 + 2*S(ss1))*T*(3 + T - 8*Power(T,2) + 4*Power(T,3)))) + Power(T,2)*(12*sqrt((S(ss1)*(1 - 3*T + 2*Power(T,2)))/((1 + 2*S(ss1))*T*(-3 - 4*T + 4*Power(T,2)))) + 11*sqrt((S(ss1)*(-1 + 2*T))/((1 + 2*S(ss1))*T*(3 + T - 8*Power(T,2) + 4*Power(T,3))))) - 3*T*(sqrt((S(ss1)*(-1 + 2*T))/((1 + 2*S(ss1))*T*(3 + T - 8*Power(T,2) + 4*Power(T,3)))) + 8*sqrt((S(ss1)*(1 - 3*T + 2*Power(T,2)))/((1 + 2*S(ss1))*(-3*T - 4*Power(T,2) + 4*Power(T,3)))))))/(-1 + 2*T);
+          case 89: return (-2*sqrt(3)*(-1 + T)*sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*T))/(Power(1 + 2*S(ss1),2)*(-1 - 2*T + Power(T,2) + 2*Power(T,3)))))/T;
+          case 90: return (-2*sqrt(6)*sqrt((S(ss1)*(1 + S(ss1)))/(T*(3 + 11*T + 12*Power(T,2) + 4*Power(T,3)))))/(1 + 2*S(ss1));
+          case 91: return (-2*(-1 + T)*sqrt(-((1 + S(ss1))/(1 + T - 2*Power(T,2))))*(6*sqrt((S(ss1)*T*(-6 + 5*T + 12*Power(T,2) + 4*Power(T,3)))/(1 + 2*T)) + sqrt(S(ss1)*Power(T,3)*(-6 - 7*T + 22*Power(T,2) + 28*Power(T,3) + 8*Power(T,4))) + sqrt(S(ss1)*Power(T,5)*(-6 - 7*T + 22*Power(T,2) + 28*Power(T,3) + 8*Power(T,4))) + 3*T*(3*sqrt((S(ss1)*T*(-6 + 5*T + 12*Power(T,2) + 4*Power(T,3)))/(1 + 2*T)) + sqrt(S(ss1)*T*(-6 - 7*T + 22*Power(T,2) + 28*Power(T,3) + 8*Power(T,4))))))/((1 + 2*S(ss1))*T*Power(1 + T,1.5)*(6 + 7*T + 2*Power(T,2)));
+          case 92: return (-2*sqrt(2)*sqrt((1 + S(ss1))/(T + 2*S(ss1)*T))*(6*sqrt((S(ss1)*(-1 + 2*T))/((1 + 2*S(ss1))*(1 + 3*T + 2*Power(T,2)))) + T*(9*sqrt((S(ss1)*(-1 + 2*T))/((1 + 2*S(ss1))*(1 + 3*T + 2*Power(T,2)))) + 3*sqrt((S(ss1)*(-1 + 4*Power(T,2)))/((1 + 2*S(ss1))*(1 + T))) + sqrt((S(ss1)*(-1 - T + 4*Power(T,2) + 4*Power(T,3)))/(1 + 2*S(ss1))))))/(6 + 13*T + 9*Power(T,2) + 2*Power(T,3));
+          case 93: return (-2*(sqrt((S(ss1)*(-1 + 2*T)*(1 + 2*T)*(2 + 3*T + Power(T,2)))/(1 + 2*S(ss1))) + 6*sqrt((S(ss1)*(-1 + 2*T)*(1 + 3*T + 2*Power(T,2)))/((1 + 2*S(ss1))*(2 + T)*Power(3 + 2*T,2))) + 2*sqrt((S(ss1)*(1 + T)*(-1 + 4*Power(T,2)))/((1 + 2*S(ss1))*(2 + T))) + (6*sqrt((S(ss1)*(-1 + 4*Power(T,2)))/((1 + 2*S(ss1))*(2 + 3*T + Power(T,2)))))/(3 + 2*T) + (6*sqrt((S(ss1)*(-1 + 2*T))/((1 + 2*S(ss1))*(2 + 7*T + 7*Power(T,2) + 2*Power(T,3)))))/(3 + 2*T)))/sqrt(((1 + 2*S(ss1))*(30 + 77*T + 71*Power(T,2) + 28*Power(T,3) + 4*Power(T,4)))/(1 + S(ss1)));
+          case 94: return 1/(1 + 2*S(ss1));
+          case 95: return sqrt(2)/((1 + 2*S(ss1))*sqrt((-1 + T)*T));
+          case 96: return sqrt(6)/((1 + 2*S(ss1))*sqrt(T*(1 + 2*T)*(1 - 3*T + 2*Power(T,2))));
+          case 97: return -1;
+          case 98: return -(sqrt(2)/sqrt((-1 + T)*T));
+          case 99: return -(sqrt(6)/sqrt(T*(1 - T - 4*Power(T,2) + 4*Power(T,3))));
+          case 100: return (-2 - T + Power(T,2))/((1 + 2*S(ss1))*sqrt(T*(2 - T - 2*Power(T,2) + Power(T,3))));
+          case 101: return sqrt(1.5)*sqrt(1 + S(ss1))*(2/sqrt(((1 + S(ss1))*(-1 + T)*Power(T,2)*(1 + T)*(1 + 2*T))/(-6 + 4*T)) - (4*S(ss1))/((T + 2*S(ss1)*T)*sqrt(((1 + S(ss1))*(1 + T)*(1 + T - 2*Power(T,2)))/(6 - 4*T))) - (2*sqrt(2)*S(ss1)*(-1 + T)*(-3 + 2*T))/((1 + 2*S(ss1))*T*sqrt((1 + S(ss1))*(-1 + Power(T,2))*(-3 - 4*T + 4*Power(T,2)))) + (sqrt(2)*(-1 + T)*(-3 + 2*T))/(sqrt(T)*sqrt((1 + S(ss1))*T*(-1 + Power(T,2))*(-3 - 4*T + 4*Power(T,2)))));
+          case 102: return 3/((1 + 2*S(ss1))*(T + 2*Power(T,2)));
+          case 103: return (2 + T - Power(T,2))*sqrt(1/((-2 + T)*T*(-1 + Power(T,2))));
+          case 104: return -(sqrt(1.5)*sqrt(1 + S(ss1))*(4/sqrt(((1 + S(ss1))*Power(3 + 2*S(ss1),2)*(-1 + T)*Power(T,2)*(1 + T)*(1 + 2*T))/(-6 + 4*T)) + (2*sqrt(2)*(-1 + T)*(-3 + 2*T))/((3 + 2*S(ss1))*T*sqrt((1 + S(ss1))*(-1 + Power(T,2))*(-3 - 4*T + 4*Power(T,2)))) + (sqrt(2)*(1 + 2*S(ss1))*(-1 + T)*(-3 + 2*T))/((3 + 2*S(ss1))*T*sqrt((1 + S(ss1))*(-1 + Power(T,2))*(-3 - 4*T + 4*Power(T,2)))) + (2*(1 + 2*S(ss1))*sqrt((-6 + 4*T)/((1 + S(ss1))*Power(T,2)*(-1 - 2*T + Power(T,2) + 2*Power(T,3)))))/(3 + 2*S(ss1))));
+          case 105: return -3/(T + 2*Power(T,2));
+          case 106: return (9 - 13*Power(T,2) + 4*Power(T,4))/((T + 2*S(ss1)*T)*sqrt(-9 + 49*Power(T,2) - 56*Power(T,4) + 16*Power(T,6)));
+          case 107: return sqrt(3)*sqrt(1 + S(ss1))*(3*(-1 + T)*(-1 + 2*T)*sqrt(1/((1 + S(ss1))*Power(T,2)*Power(1 + T,3)*(-3 - 5*T + 4*Power(T,2) + 4*Power(T,3)))) + (6*sqrt((-1 + T)/((1 + S(ss1))*(3 + 11*T + 12*Power(T,2) + 4*Power(T,3)))))/(T + Power(T,2)) - (12*S(ss1))/((1 + 2*S(ss1))*T*(1 + T)*sqrt(((1 + S(ss1))*(3 + 11*T + 12*Power(T,2) + 4*Power(T,3)))/(-1 + T))) + ((-1 + T)*(-1 + 2*T))/((1 + T)*sqrt((1 + S(ss1))*(-3 - 8*T - Power(T,2) + 8*Power(T,3) + 4*Power(T,4)))) - (6*S(ss1)*(-1 + T)*(-1 + 2*T))/((1 + 2*S(ss1))*T*(1 + T)*sqrt((1 + S(ss1))*(-3 - 8*T - Power(T,2) + 8*Power(T,3) + 4*Power(T,4)))) - (2*S(ss1)*(-1 + T)*Power(-1 + 2*T,1.5))/((1 + 2*S(ss1))*(1 + T)*sqrt((1 + S(ss1))*(3 + 2*T - 15*Power(T,2) - 10*Power(T,3) + 12*Power(T,4) + 8*Power(T,5)))));
+          case 108: return -(sqrt(6)*sqrt(1 + S(ss1))*(-6*sqrt(1/((1 + S(ss1))*(T + 2*Power(T,2))*Power(3 + 5*T + 2*Power(T,2),3))) + (3 - 6*T)/(sqrt((1 + S(ss1))*T*(1 + 2*T))*Power(3 + 5*T + 2*Power(T,2),1.5)) + (T - 2*Power(T,2))/sqrt((1 + S(ss1))*T*(1 + 2*T)*Power(3 + 5*T + 2*Power(T,2),3)) + (12*S(ss1)*(1 + S(ss1))*T*(1 + 2*T))/((1 + 2*S(ss1))*Power((1 + S(ss1))*T*(3 + 11*T + 12*Power(T,2) + 4*Power(T,3)),1.5)) + (2*S(ss1)*T*(-1 + 2*T))/((1 + 2*S(ss1))*(3 + 5*T + 2*Power(T,2))*sqrt((1 + S(ss1))*T*(3 + 11*T + 12*Power(T,2) + 4*Power(T,3)))) + (6*S(ss1)*Power(-1 + 2*T,1.5))/((1 + 2*S(ss1))*(3 + 5*T + 2*Power(T,2))*sqrt((1 + S(ss1))*T*(-3 - 5*T + 10*Power(T,2) + 20*Power(T,3) + 8*Power(T,4))))));
+          case 109: return (-9 + 13*Power(T,2) - 4*Power(T,4))/(T*sqrt(-9 + 49*Power(T,2) - 56*Power(T,4) + 16*Power(T,6)));
+          case 110: return -((sqrt(3)*(-3 + T + 2*Power(T,2)))/(T*sqrt(-3 - 8*T - Power(T,2) + 8*Power(T,3) + 4*Power(T,4))));
+          case 111: return -(sqrt(6)*sqrt(1 + S(ss1))*(2*T*(-1 + 2*T)*sqrt(1/((1 + S(ss1))*Power(3 + 2*S(ss1),2)*(T + 2*Power(T,2))*Power(3 + 5*T + 2*Power(T,2),3))) + (6 + 12*S(ss1))/((3 + 2*S(ss1))*sqrt((1 + S(ss1))*T*(1 + 2*T))*Power(3 + 5*T + 2*Power(T,2),1.5)) + (3*(1 + 2*S(ss1))*(-1 + 2*T))/((3 + 2*S(ss1))*sqrt((1 + S(ss1))*T*(1 + 2*T))*Power(3 + 5*T + 2*Power(T,2),1.5)) + 12/((3 + 2*S(ss1))*(3 + 5*T + 2*Power(T,2))*sqrt((1 + S(ss1))*T*(3 + 11*T + 12*Power(T,2) + 4*Power(T,3)))) + (6*Power(-1 + 2*T,1.5))/((3 + 2*S(ss1))*(3 + 5*T + 2*Power(T,2))*sqrt((1 + S(ss1))*T*(-3 - 5*T + 10*Power(T,2) + 20*Power(T,3) + 8*Power(T,4)))) + ((1 + 2*S(ss1))*T*Power(-1 + 2*T,1.5))/((3 + 2*S(ss1))*(3 + 5*T + 2*Power(T,2))*sqrt((1 + S(ss1))*T*(-3 - 5*T + 10*Power(T,2) + 20*Power(T,3) + 8*Power(T,4))))));
+          case 112: return (sqrt(1 + S(ss1))*(3*(-1 + T)*T*sqrt((-2 + 4*T)/((1 + S(ss1))*(-1 + T)*T*Power(1 + T,3)*(6 + 7*T + 2*Power(T,2)))) + ((-1 + T)*T)/sqrt(((1 + S(ss1))*T*(-1 + Power(T,2))*(6 + 7*T + 2*Power(T,2)))/(-2 + 4*T)) - (2*S(ss1)*(-1 + T)*T)/((1 + 2*S(ss1))*sqrt(((1 + S(ss1))*T*(-1 + Power(T,2))*(6 + 7*T + 2*Power(T,2)))/(-2 + 4*T))) + (6*sqrt((2 - 6*T + 4*Power(T,2))/((1 + S(ss1))*T*(1 + T)*Power(1 + 2*T,2)*(6 + 7*T + 2*Power(T,2)))))/(1 + T) - 6*sqrt(2)*(-1 + T)*T*sqrt((Power(S(ss1),2)*(-1 + 2*T))/((1 + S(ss1))*Power(1 + 2*S(ss1),2)*T*Power(1 + T,3)*(-6 - T + 5*Power(T,2) + 2*Power(T,3)))) - (12*S(ss1)*sqrt(-6 + 2/T + 4*T))/((1 + 2*S(ss1))*(1 + 3*T + 2*Power(T,2))*sqrt((1 + S(ss1))*(6 + 13*T + 9*Power(T,2) + 2*Power(T,3)))) - (18*S(ss1)*T*sqrt((-1 + T)*(-2 + 4*T)))/((1 + 2*S(ss1))*(1 + 3*T + 2*Power(T,2))*sqrt((1 + S(ss1))*T*(6 + 13*T + 9*Power(T,2) + 2*Power(T,3)))) + (9*sqrt(2)*(-1 + T)*sqrt((T*(-1 + 2*T))/((1 + S(ss1))*Power(1 + 2*T,2)*(-6 - 7*T + 4*Power(T,2) + 7*Power(T,3) + 2*Power(T,4)))))/(1 + T)))/sqrt(2);
+          case 113: return -((sqrt(2)*T*sqrt((1 + 2*S(ss1))*(1 + 2*T))*((2*S(ss1)*Power(1 + S(ss1),2)*Power(T,2)*sqrt(-1 + 2*T)*Power(3 + 2*T,2))/Power((1 + 2*S(ss1))/(2 + 3*T + Power(T,2)),1.5) - (Power(1 + S(ss1),2)*Power(T,2)*Power(3 + 2*T,2)*Power(2 + 3*T + Power(T,2),1.5))/sqrt((1 + 2*S(ss1))/(-1 + 2*T)) + 6*sqrt((Power(S(ss1),2)*Power(1 + S(ss1),4)*Power(T,4)*Power(2 + T,3)*Power(3 + 2*T,4)*(-1 + T + 2*Power(T,2)))/Power(1 + 2*S(ss1),3)) - 3*sqrt((Power(1 + S(ss1),4)*Power(T,4)*Power(2 + T,3)*Power(3 + 2*T,4)*(-1 + T + 2*Power(T,2)))/(1 + 2*S(ss1))) + 18*sqrt((Power(S(ss1),2)*Power(1 + S(ss1),4)*Power(T,4)*Power(2 + T,3)*Power(3 + 2*T,4)*(-1 + T + 2*Power(T,2)))/(Power(1 + 2*S(ss1),3)*Power(1 + 2*T,2))) - 9*sqrt((Power(1 + S(ss1),4)*Power(T,4)*Power(2 + T,3)*Power(3 + 2*T,4)*(-1 + T + 2*Power(T,2)))/((1 + 2*S(ss1))*Power(1 + 2*T,2))) + (12*S(ss1)*Power(1 + S(ss1),2)*T*(1 + T)*sqrt((-1 + 2*T)/(2 + 3*T + Power(T,2)))*Power(6 + 7*T + 2*Power(T,2),2))/(Power(1 + 2*S(ss1),1.5)*(1 + 2*T)) - (6*Power(1 + S(ss1),2)*T*(1 + T)*Power(6 + 7*T + 2*Power(T,2),2))/((1 + 2*T)*sqrt(((1 + 2*S(ss1))*(2 + 3*T + Power(T,2)))/(-1 + 2*T)))))/(Power(1 + S(ss1),2)*Power(1 + T,2)*Power(T*(2 + T),2.5)*Power(3 + 2*T,3)));
+          case 114: return -((sqrt(1 + S(ss1))*(sqrt(2)*(-1 + T)*T*sqrt((Power(1 + 2*S(ss1),2)*(-1 + 2*T))/((1 + S(ss1))*Power(3 + 2*S(ss1),2)*T*(-1 + Power(T,2))*(6 + 7*T + 2*Power(T,2)))) + (2*(-1 + T)*T)/sqrt(((1 + S(ss1))*Power(3 + 2*S(ss1),2)*T*(-1 + Power(T,2))*(6 + 7*T + 2*Power(T,2)))/(-2 + 4*T)) + (6*(1 + 2*S(ss1))*sqrt((2 - 6*T + 4*Power(T,2))/((1 + S(ss1))*T*(1 + T)*Power(1 + 2*T,2)*(6 + 7*T + 2*Power(T,2)))))/((3 + 2*S(ss1))*(1 + T)) + (12*sqrt((2 - 6*T + 4*Power(T,2))/((1 + S(ss1))*Power(3 + 2*S(ss1),2)*T*(1 + T)*Power(1 + 2*T,2)*(6 + 7*T + 2*Power(T,2)))))/(1 + T) + 3*sqrt(2)*(-1 + T)*T*sqrt((Power(1 + 2*S(ss1),2)*(-1 + 2*T))/((1 + S(ss1))*Power(3 + 2*S(ss1),2)*T*Power(1 + T,3)*(-6 - T + 5*Power(T,2) + 2*Power(T,3)))) + (6*(-1 + T)*T)/sqrt(((1 + S(ss1))*Power(3 + 2*S(ss1),2)*T*Power(1 + T,3)*(-6 - T + 5*Power(T,2) + 2*Power(T,3)))/(-2 + 4*T)) + (9*(1 + 2*S(ss1))*T*sqrt((2 - 6*T + 4*Power(T,2))/((1 + S(ss1))*T*(6 + 13*T + 9*Power(T,2) + 2*Power(T,3)))))/((3 + 2*S(ss1))*(1 + 3*T + 2*Power(T,2))) + (18*sqrt(2)*(-1 + T)*sqrt((T*(-1 + 2*T))/((1 + S(ss1))*Power(3 + 2*S(ss1),2)*Power(1 + 2*T,2)*(-6 - 7*T + 4*Power(T,2) + 7*Power(T,3) + 2*Power(T,4)))))/(1 + T)))/sqrt(2));
+          case 115: return -(1/((1 + 2*T)*sqrt((T*(1 + T))/(-2 + 8*Power(T,2)))));
+          case 116: return -((-6*sqrt(2)*sqrt(((1 + S(ss1))*(1 + 2*S(ss1))*T*(-1 + 2*T)*(5 + 2*T))/((1 + 2*T)*(6 + 7*T + 2*Power(T,2)))) + 12*sqrt(2)*S(ss1)*(1 + T)*sqrt(((1 + S(ss1))*T*(-1 + 2*T)*(1 + 2*T)*(5 + 2*T))/((1 + 2*S(ss1))*(6 + 7*T + 2*Power(T,2)))) - 6*sqrt(2)*sqrt(((1 + S(ss1))*(1 + 2*S(ss1))*T*(-1 + 2*T)*(1 + 2*T)*(5 + 2*T))/(6 + 7*T + 2*Power(T,2))) - 6*sqrt(2)*(1 + T)*sqrt(((1 + S(ss1))*(1 + 2*S(ss1))*T*(-1 + 2*T)*(1 + 2*T)*(5 + 2*T))/(6 + 7*T + 2*Power(T,2))) + 4*sqrt(2)*S(ss1)*(1 + T)*sqrt(((1 + S(ss1))*T*(-1 + 2*T)*(1 + 2*T)*(15 + 16*T + 4*Power(T,2)))/((1 + 2*S(ss1))*(2 + T))) - 2*sqrt(2)*(1 + T)*sqrt(((1 + S(ss1))*(1 + 2*S(ss1))*T*(-1 + 2*T)*(1 + 2*T)*(15 + 16*T + 4*Power(T,2)))/(2 + T)) + 12*sqrt(2)*S(ss1)*sqrt(((1 + S(ss1))*T*(-5 + 8*T + 4*Power(T,2)))/((1 + 2*S(ss1))*(6 + 19*T + 16*Power(T,2) + 4*Power(T,3)))) + 2*sqrt(2)*S(ss1)*(1 + T)*sqrt(((1 + S(ss1))*T*(-1 + 2*T)*(1 + 2*T)*(30 + 47*T + 24*Power(T,2) + 4*Power(T,3)))/(1 + 2*S(ss1))) + 12*sqrt(2)*S(ss1)*sqrt(((1 + S(ss1))*T*(-5 - 2*T + 20*Power(T,2) + 8*Power(T,3)))/((1 + 2*S(ss1))*(6 + 7*T + 2*Power(T,2)))) - sqrt(2)*sqrt((1 + S(ss1))*(1 + 2*S(ss1))*T*(-1 + 2*T)*(1 + 3*T + 2*Power(T,2))*(30 + 77*T + 71*Power(T,2) + 28*Power(T,3) + 4*Power(T,4))))/(sqrt(2)*sqrt((1 + S(ss1))*(1 + 2*S(ss1))*T*(2 + T))*(15 + 31*T + 20*Power(T,2) + 4*Power(T,3))));
+          case 117: return -(((3 + 2*S(ss1))*(6*sqrt(((1 + S(ss1))*T*(-5 + 8*T + 4*Power(T,2)))/((3 + 2*S(ss1))*(6 + 19*T + 16*Power(T,2) + 4*Power(T,3)))) + 12*sqrt(((1 + S(ss1))*T*(-5 - 2*T + 20*Power(T,2) + 8*Power(T,3)))/((3 + 2*S(ss1))*(6 + 7*T + 2*Power(T,2)))) + 2*sqrt(((1 + S(ss1))*T*(-15 - 16*T + 56*Power(T,2) + 64*Power(T,3) + 16*Power(T,4)))/((3 + 2*S(ss1))*(2 + T))) + sqrt(((1 + S(ss1))*T*(-30 - 47*T + 96*Power(T,2) + 184*Power(T,3) + 96*Power(T,4) + 16*Power(T,5)))/(3 + 2*S(ss1))) + T*(6*sqrt(((1 + S(ss1))*T*(-5 - 2*T + 20*Power(T,2) + 8*Power(T,3)))/((3 + 2*S(ss1))*(6 + 7*T + 2*Power(T,2)))) + 2*sqrt(((1 + S(ss1))*T*(-15 - 16*T + 56*Power(T,2) + 64*Power(T,3) + 16*Power(T,4)))/((3 + 2*S(ss1))*(2 + T))) + sqrt(((1 + S(ss1))*T*(-30 - 47*T + 96*Power(T,2) + 184*Power(T,3) + 96*Power(T,4) + 16*Power(T,5)))/(3 + 2*S(ss1))))))/(sqrt((3 + 5*S(ss1) + 2*Power(S(ss1),2))*T*(2 + T))*(15 + 31*T + 20*Power(T,2) + 4*Power(T,3))));
+          case 118: return sqrt((-1 + S(ss1) + 2*Power(S(ss1),2))/(S(ss1)*(1 + 2*S(ss1))));
+          case 119: return sqrt((-1 + S(ss1) + 2*Power(S(ss1),2))/((S(ss1) + 2*Power(S(ss1),2))*Power(T,2)));
+          case 120: return sqrt((-1 + S(ss1) + 2*Power(S(ss1),2))/(S(ss1)*(1 + 2*S(ss1))))/(T + 2*Power(T,2));
+          case 121: return (-sqrt((-1 + 2*S(ss1))/((1 + 2*S(ss1))*(-1 + T))) + sqrt(((-1 + 2*S(ss1))*(-1 + T))/((1 + 2*S(ss1))*Power(T,2))) + sqrt((-1 + 2*S(ss1))/((1 + 2*S(ss1))*(-1 + T)))*T)/sqrt((S(ss1)*(1 + T))/(1 + S(ss1)));
+          case 122: return sqrt(((-1 - S(ss1) + 4*Power(S(ss1),2) + 4*Power(S(ss1),3))*(-1 + 4*Power(T,2)))/S(ss1))/((1 + 2*S(ss1))*(T + 2*Power(T,2)));
+          case 123: return (sqrt(((-1 + 2*S(ss1))*(-1 + 2*T))/((1 + 2*S(ss1))*(1 + T))) + sqrt(((-1 + 2*S(ss1))*(-1 + 2*T))/((1 + 2*S(ss1))*(1 + T)*Power(1 + 2*T,2))) + sqrt(((-1 + 2*S(ss1))*(-1 + T + 2*Power(T,2)))/(1 + 2*S(ss1))))/sqrt((S(ss1)*(3 + 5*T + 2*Power(T,2)))/(1 + S(ss1)));
+          case 124: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 125: return -(1/(sqrt(S(ss1)*(1 + 2*S(ss1)))*T));
+          case 126: return -(1/(sqrt(S(ss1)*(1 + 2*S(ss1)))*T*(1 + 2*T)));
+          case 127: return (3 + 2*S(ss1))/sqrt((1 + 1/S(ss1))*(3 + 8*S(ss1) + 4*Power(S(ss1),2)));
+          case 128: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 8*S(ss1) + 4*Power(S(ss1),2))*Power(T,2))/S(ss1));
+          case 129: return (3 + 2*S(ss1))/sqrt(((3 + 11*S(ss1) + 12*Power(S(ss1),2) + 4*Power(S(ss1),3))*Power(T + 2*Power(T,2),2))/S(ss1));
+          case 130: return -(1/(T*sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + Power(T,2)))));
+          case 131: return -((-(Power(1 + S(ss1),1.5)*(-1 + 2*S(ss1))*(1 + T)*sqrt((T*(-1 + 2*T))/S(ss1))) - Power(1 + S(ss1),1.5)*(-1 + 2*S(ss1))*T*(1 + T)*sqrt((T*(-1 + 2*T))/S(ss1)) + 2*T*sqrt(S(ss1)*Power(1 + S(ss1),3)*T*Power(1 + T,2)*(-1 + 2*T)) + 2*T*Power((1 + S(ss1))*(1 + T),1.5)*sqrt(-((S(ss1) - 2*S(ss1)*T)/(T + Power(T,2)))))/(Power((1 + S(ss1))*T,1.5)*Power(1 + T,2)*sqrt((1 + 2*S(ss1))*(1 + 2*T))));
+          case 132: return sqrt((S(ss1)*(3 + 8*S(ss1) + 4*Power(S(ss1),2))*(-1 + Power(T,2)))/(1 + S(ss1)))/(T + 2*S(ss1)*T);
+          case 133: return (-(S(ss1)*sqrt((-1 + 2*T)/(S(ss1)*(3 + 8*S(ss1) + 4*Power(S(ss1),2))*(1 + 2*T)))) + 2*Power(S(ss1),2)*sqrt((-1 + 2*T)/(S(ss1)*(3 + 8*S(ss1) + 4*Power(S(ss1),2))*(1 + 2*T))) + 4*sqrt((S(ss1)*(-1 + 2*T))/((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(1 + 2*T))) + (3 + 2*S(ss1))*T*sqrt((S(ss1)*(-1 + 2*T))/((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(1 + 2*T))))/(sqrt(1 + S(ss1))*T*(1 + T));
+          case 134: return -((sqrt((T*(-1 + 2*T))/(S(ss1)*(1 + 3*T + 2*Power(T,2)))) + sqrt(-((T - 4*Power(T,3))/(S(ss1) + S(ss1)*T))) + sqrt((T*(-1 - T + 4*Power(T,2) + 4*Power(T,3)))/S(ss1)))/sqrt((1 + 2*S(ss1))*T*(3 + 11*T + 12*Power(T,2) + 4*Power(T,3))));
+          case 135: return (6*sqrt((S(ss1)*(-1 + 2*T))/((3 + 11*S(ss1) + 12*Power(S(ss1),2) + 4*Power(S(ss1),3))*(1 + T))) + 4*sqrt((Power(S(ss1),3)*(-1 + 2*T))/((3 + 11*S(ss1) + 12*Power(S(ss1),2) + 4*Power(S(ss1),3))*(1 + T))) + 3*sqrt((S(ss1)*(-1 + T + 2*Power(T,2)))/(3 + 11*S(ss1) + 12*Power(S(ss1),2) + 4*Power(S(ss1),3))) + 2*sqrt((Power(S(ss1),3)*(-1 + T + 2*Power(T,2)))/(3 + 11*S(ss1) + 12*Power(S(ss1),2) + 4*Power(S(ss1),3))) + T*(6*sqrt((S(ss1)*(-1 + 2*T))/((3 + 11*S(ss1) + 12*Power(S(ss1),2) + 4*Power(S(ss1),3))*(1 + T))) + 4*sqrt((Power(S(ss1),3)*(-1 + 2*T))/((3 + 11*S(ss1) + 12*Power(S(ss1),2) + 4*Power(S(ss1),3))*(1 + T))) + 6*sqrt((S(ss1)*(-1 + T + 2*Power(T,2)))/(3 + 11*S(ss1) + 12*Power(S(ss1),2) + 4*Power(S(ss1),3))) + 4*sqrt((Power(S(ss1),3)*(-1 + T + 2*Power(T,2)))/(3 + 11*S(ss1) + 12*Power(S(ss1),2) + 4*Power(S(ss1),3)))))/((1 + 2*T)*sqrt(3 + 5*T + 2*Power(T,2)));
+          case 136: return -(1/sqrt(1 + 3*S(ss1) + 2*Power(S(ss1),2)));
+          case 137: return -(1/(sqrt((1 + S(ss1))*(1 + 2*S(ss1)))*T));
+          case 138: return -(1/(sqrt(1 + 3*S(ss1) + 2*Power(S(ss1),2))*(T + 2*Power(T,2))));
+          case 139: return 1;
+          case 140: return 1/T;
+          case 141: return 1/(T + 2*Power(T,2));
+          case 142: return -((-2*S(ss1)*Power(3 + 8*S(ss1) + 4*Power(S(ss1),2),1.5)*sqrt((-1 + T)/(1 + S(ss1))) + 2*Power(3 + 8*S(ss1) + 4*Power(S(ss1),2),1.5)*sqrt((1 + S(ss1))*(-1 + T)) - 4*S(ss1)*Power(3 + 2*S(ss1),1.5)*sqrt(((1 + 2*S(ss1))*(-1 + T))/(1 + S(ss1))) + (1 + 2*S(ss1))*(3 + 2*S(ss1))*sqrt(((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(-1 + T))/(1 + S(ss1))) - 2*Power(3 + 8*S(ss1) + 4*Power(S(ss1),2),1.5)*sqrt((1 + S(ss1))/(-1 + T))*T - 4*S(ss1)*Power(3 + 2*S(ss1),1.5)*sqrt(((1 + 2*S(ss1))*(-1 + T))/(1 + S(ss1)))*T + (1 + 2*S(ss1))*Power(3 + 2*S(ss1),1.5)*sqrt(((1 + 2*S(ss1))*(-1 + T))/(1 + S(ss1)))*T - 2*S(ss1)*(1 + 2*S(ss1))*Power(3 + 2*S(ss1),1.5)*sqrt(((1 + 2*S(ss1))*(-1 + T))/(1 + S(ss1)))*T + 2*Power(3 + 8*S(ss1) + 4*Power(S(ss1),2),1.5)*sqrt((1 + S(ss1))/(-1 + T))*Power(T,2))/(Power(3 + 2*S(ss1),2.5)*sqrt(1 + T)*(T + 2*S(ss1)*T)));
+          case 143: return -(1/(T*sqrt(((1 + 3*S(ss1) + 2*Power(S(ss1),2))*(1 + 2*T))/(-1 + 2*T))));
+          case 144: return sqrt(-1 + Power(T,2))/T;
+          case 145: return sqrt((-1 + 2*T)/(1 + 2*T))/T;
+          case 146: return -((sqrt(((1 + 2*S(ss1))*T*(-1 + 2*T))/((1 + S(ss1))*(1 + 3*T + 2*Power(T,2)))) + 2*sqrt(((1 + 3*S(ss1) + 2*Power(S(ss1),2))*T*(-1 + 2*T))/(1 + 3*T + 2*Power(T,2))) + sqrt(((1 + 2*S(ss1))*T*(-1 + 4*Power(T,2)))/((1 + S(ss1))*(1 + T))) + 2*sqrt(((1 + 3*S(ss1) + 2*Power(S(ss1),2))*T*(-1 + 4*Power(T,2)))/(1 + T)) + sqrt(((1 + 2*S(ss1))*T*(-1 - T + 4*Power(T,2) + 4*Power(T,3)))/(1 + S(ss1))) + 2*sqrt((1 + 3*S(ss1) + 2*Power(S(ss1),2))*T*(-1 - T + 4*Power(T,2) + 4*Power(T,3))) - 2*S(ss1)*(sqrt(((1 + 2*S(ss1))*T*(-1 + 2*T))/((1 + S(ss1))*(1 + 3*T + 2*Power(T,2)))) + 2*sqrt((T*(-1 + 2*T))/((1 + 3*S(ss1) + 2*Power(S(ss1),2))*(1 + 3*T + 2*Power(T,2)))) + sqrt(((1 + 2*S(ss1))*T*(-1 + 4*Power(T,2)))/((1 + S(ss1))*(1 + T))) + 2*sqrt((T*(-1 + 4*Power(T,2)))/((1 + 3*S(ss1) + 2*Power(S(ss1),2))*(1 + T))) + sqrt(((1 + 2*S(ss1))*T*(-1 - T + 4*Power(T,2) + 4*Power(T,3)))/(1 + S(ss1))) + 2*sqrt((T*(-1 - T + 4*Power(T,2) + 4*Power(T,3)))/(1 + 3*S(ss1) + 2*Power(S(ss1),2)))))/((3 + 2*S(ss1))*sqrt(T*(3 + 11*T + 12*Power(T,2) + 4*Power(T,3)))));
+          case 147: return ((2 + S(ss1))*(sqrt((T*(-1 + 2*T))/((2 + S(ss1))*(1 + 3*T + 2*Power(T,2)))) + sqrt((T*(-1 + 4*Power(T,2)))/((2 + S(ss1))*(1 + T))) + sqrt((T*(-1 - T + 4*Power(T,2) + 4*Power(T,3)))/(2 + S(ss1)))))/sqrt((2 + S(ss1))*T*(3 + 11*T + 12*Power(T,2) + 4*Power(T,3)));
+          case 148: return sqrt((-1 + S(ss1) + 2*Power(S(ss1),2))/(S(ss1)*(1 + 2*S(ss1))));
+          case 149: return sqrt((-1 + S(ss1) + 2*Power(S(ss1),2))/((S(ss1) + 2*Power(S(ss1),2))*Power(T,2)));
+          case 150: return sqrt((-1 + S(ss1) + 2*Power(S(ss1),2))/(S(ss1)*(1 + 2*S(ss1))))/(T + 2*Power(T,2));
+          case 151: return (-sqrt((-1 + 2*S(ss1))/((1 + 2*S(ss1))*(-1 + T))) + sqrt(((-1 + 2*S(ss1))*(-1 + T))/((1 + 2*S(ss1))*Power(T,2))) + sqrt((-1 + 2*S(ss1))/((1 + 2*S(ss1))*(-1 + T)))*T)/sqrt((S(ss1)*(1 + T))/(1 + S(ss1)));
+          case 152: return sqrt(((-1 - S(ss1) + 4*Power(S(ss1),2) + 4*Power(S(ss1),3))*(-1 + 4*Power(T,2)))/S(ss1))/((1 + 2*S(ss1))*(T + 2*Power(T,2)));
+          case 153: return (sqrt(((-1 + 2*S(ss1))*(-1 + 2*T))/((1 + 2*S(ss1))*(1 + T))) + sqrt(((-1 + 2*S(ss1))*(-1 + 2*T))/((1 + 2*S(ss1))*(1 + T)*Power(1 + 2*T,2))) + sqrt(((-1 + 2*S(ss1))*(-1 + T + 2*Power(T,2)))/(1 + 2*S(ss1))))/sqrt((S(ss1)*(3 + 5*T + 2*Power(T,2)))/(1 + S(ss1)));
+          case 154: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 155: return -(1/(sqrt(S(ss1)*(1 + 2*S(ss1)))*T));
+          case 156: return -(1/(sqrt(S(ss1)*(1 + 2*S(ss1)))*T*(1 + 2*T)));
+          case 157: return (3 + 2*S(ss1))/sqrt((1 + 1/S(ss1))*(3 + 8*S(ss1) + 4*Power(S(ss1),2)));
+          case 158: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 8*S(ss1) + 4*Power(S(ss1),2))*Power(T,2))/S(ss1));
+          case 159: return (3 + 2*S(ss1))/sqrt(((3 + 11*S(ss1) + 12*Power(S(ss1),2) + 4*Power(S(ss1),3))*Power(T + 2*Power(T,2),2))/S(ss1));
+          case 160: return -(1/(T*sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + Power(T,2)))));
+          case 161: return -((-(Power(1 + S(ss1),1.5)*(-1 + 2*S(ss1))*(1 + T)*sqrt((T*(-1 + 2*T))/S(ss1))) - Power(1 + S(ss1),1.5)*(-1 + 2*S(ss1))*T*(1 + T)*sqrt((T*(-1 + 2*T))/S(ss1)) + 2*T*sqrt(S(ss1)*Power(1 + S(ss1),3)*T*Power(1 + T,2)*(-1 + 2*T)) + 2*T*Power((1 + S(ss1))*(1 + T),1.5)*sqrt(-((S(ss1) - 2*S(ss1)*T)/(T + Power(T,2)))))/(Power((1 + S(ss1))*T,1.5)*Power(1 + T,2)*sqrt((1 + 2*S(ss1))*(1 + 2*T))));
+          case 162: return sqrt((S(ss1)*(3 + 8*S(ss1) + 4*Power(S(ss1),2))*(-1 + Power(T,2)))/(1 + S(ss1)))/(T + 2*S(ss1)*T);
+          case 163: return (-(S(ss1)*sqrt((-1 + 2*T)/(S(ss1)*(3 + 8*S(ss1) + 4*Power(S(ss1),2))*(1 + 2*T)))) + 2*Power(S(ss1),2)*sqrt((-1 + 2*T)/(S(ss1)*(3 + 8*S(ss1) + 4*Power(S(ss1),2))*(1 + 2*T))) + 4*sqrt((S(ss1)*(-1 + 2*T))/((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(1 + 2*T))) + (3 + 2*S(ss1))*T*sqrt((S(ss1)*(-1 + 2*T))/((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(1 + 2*T))))/(sqrt(1 + S(ss1))*T*(1 + T));
+          case 164: return -((sqrt((T*(-1 + 2*T))/(S(ss1)*(1 + 3*T + 2*Power(T,2)))) + sqrt(-((T - 4*Power(T,3))/(S(ss1) + S(ss1)*T))) + sqrt((T*(-1 - T + 4*Power(T,2) + 4*Power(T,3)))/S(ss1)))/sqrt((1 + 2*S(ss1))*T*(3 + 11*T + 12*Power(T,2) + 4*Power(T,3))));
+          case 165: return (6*sqrt((S(ss1)*(-1 + 2*T))/((3 + 11*S(ss1) + 12*Power(S(ss1),2) + 4*Power(S(ss1),3))*(1 + T))) + 4*sqrt((Power(S(ss1),3)*(-1 + 2*T))/((3 + 11*S(ss1) + 12*Power(S(ss1),2) + 4*Power(S(ss1),3))*(1 + T))) + 3*sqrt((S(ss1)*(-1 + T + 2*Power(T,2)))/(3 + 11*S(ss1) + 12*Power(S(ss1),2) + 4*Power(S(ss1),3))) + 2*sqrt((Power(S(ss1),3)*(-1 + T + 2*Power(T,2)))/(3 + 11*S(ss1) + 12*Power(S(ss1),2) + 4*Power(S(ss1),3))) + T*(6*sqrt((S(ss1)*(-1 + 2*T))/((3 + 11*S(ss1) + 12*Power(S(ss1),2) + 4*Power(S(ss1),3))*(1 + T))) + 4*sqrt((Power(S(ss1),3)*(-1 + 2*T))/((3 + 11*S(ss1) + 12*Power(S(ss1),2) + 4*Power(S(ss1),3))*(1 + T))) + 6*sqrt((S(ss1)*(-1 + T + 2*Power(T,2)))/(3 + 11*S(ss1) + 12*Power(S(ss1),2) + 4*Power(S(ss1),3))) + 4*sqrt((Power(S(ss1),3)*(-1 + T + 2*Power(T,2)))/(3 + 11*S(ss1) + 12*Power(S(ss1),2) + 4*Power(S(ss1),3)))))/((1 + 2*T)*sqrt(3 + 5*T + 2*Power(T,2)));
+          case 166: return -(1/sqrt(1 + 3*S(ss1) + 2*Power(S(ss1),2)));
+          case 167: return -(1/(sqrt((1 + S(ss1))*(1 + 2*S(ss1)))*T));
+          case 168: return -(1/(sqrt(1 + 3*S(ss1) + 2*Power(S(ss1),2))*(T + 2*Power(T,2))));
+          case 169: return 1;
+          case 170: return 1/T;
+          case 171: return 1/(T + 2*Power(T,2));
+          case 172: return -((-2*S(ss1)*Power(3 + 8*S(ss1) + 4*Power(S(ss1),2),1.5)*sqrt((-1 + T)/(1 + S(ss1))) + 2*Power(3 + 8*S(ss1) + 4*Power(S(ss1),2),1.5)*sqrt((1 + S(ss1))*(-1 + T)) - 4*S(ss1)*Power(3 + 2*S(ss1),1.5)*sqrt(((1 + 2*S(ss1))*(-1 + T))/(1 + S(ss1))) + (1 + 2*S(ss1))*(3 + 2*S(ss1))*sqrt(((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(-1 + T))/(1 + S(ss1))) - 2*Power(3 + 8*S(ss1) + 4*Power(S(ss1),2),1.5)*sqrt((1 + S(ss1))/(-1 + T))*T - 4*S(ss1)*Power(3 + 2*S(ss1),1.5)*sqrt(((1 + 2*S(ss1))*(-1 + T))/(1 + S(ss1)))*T + (1 + 2*S(ss1))*Power(3 + 2*S(ss1),1.5)*sqrt(((1 + 2*S(ss1))*(-1 + T))/(1 + S(ss1)))*T - 2*S(ss1)*(1 + 2*S(ss1))*Power(3 + 2*S(ss1),1.5)*sqrt(((1 + 2*S(ss1))*(-1 + T))/(1 + S(ss1)))*T + 2*Power(3 + 8*S(ss1) + 4*Power(S(ss1),2),1.5)*sqrt((1 + S(ss1))/(-1 + T))*Power(T,2))/(Power(3 + 2*S(ss1),2.5)*sqrt(1 + T)*(T + 2*S(ss1)*T)));
+          case 173: return -(1/(T*sqrt(((1 + 3*S(ss1) + 2*Power(S(ss1),2))*(1 + 2*T))/(-1 + 2*T))));
+          case 174: return sqrt(-1 + Power(T,2))/T;
+          case 175: return sqrt((-1 + 2*T)/(1 + 2*T))/T;
+          case 176: return -((sqrt(((1 + 2*S(ss1))*T*(-1 + 2*T))/((1 + S(ss1))*(1 + 3*T + 2*Power(T,2)))) + 2*sqrt(((1 + 3*S(ss1) + 2*Power(S(ss1),2))*T*(-1 + 2*T))/(1 + 3*T + 2*Power(T,2))) + sqrt(((1 + 2*S(ss1))*T*(-1 + 4*Power(T,2)))/((1 + S(ss1))*(1 + T))) + 2*sqrt(((1 + 3*S(ss1) + 2*Power(S(ss1),2))*T*(-1 + 4*Power(T,2)))/(1 + T)) + sqrt(((1 + 2*S(ss1))*T*(-1 - T + 4*Power(T,2) + 4*Power(T,3)))/(1 + S(ss1))) + 2*sqrt((1 + 3*S(ss1) + 2*Power(S(ss1),2))*T*(-1 - T + 4*Power(T,2) + 4*Power(T,3))) - 2*S(ss1)*(sqrt(((1 + 2*S(ss1))*T*(-1 + 2*T))/((1 + S(ss1))*(1 + 3*T + 2*Power(T,2)))) + 2*sqrt((T*(-1 + 2*T))/((1 + 3*S(ss1) + 2*Power(S(ss1),2))*(1 + 3*T + 2*Power(T,2)))) + sqrt(((1 + 2*S(ss1))*T*(-1 + 4*Power(T,2)))/((1 + S(ss1))*(1 + T))) + 2*sqrt((T*(-1 + 4*Power(T,2)))/((1 + 3*S(ss1) + 2*Power(S(ss1),2))*(1 + T))) + sqrt(((1 + 2*S(ss1))*T*(-1 - T + 4*Power(T,2) + 4*Power(T,3)))/(1 + S(ss1))) + 2*sqrt((T*(-1 - T + 4*Power(T,2) + 4*Power(T,3)))/(1 + 3*S(ss1) + 2*Power(S(ss1),2)))))/((3 + 2*S(ss1))*sqrt(T*(3 + 11*T + 12*Power(T,2) + 4*Power(T,3)))));
+          case 177: return ((2 + S(ss1))*(sqrt((T*(-1 + 2*T))/((2 + S(ss1))*(1 + 3*T + 2*Power(T,2)))) + sqrt((T*(-1 + 4*Power(T,2)))/((2 + S(ss1))*(1 + T))) + sqrt((T*(-1 - T + 4*Power(T,2) + 4*Power(T,3)))/(2 + S(ss1)))))/sqrt((2 + S(ss1))*T*(3 + 11*T + 12*Power(T,2) + 4*Power(T,3)));
+          case 178: return -2*sqrt((-1 + Power(S(ss1),2))/(-1 + 4*Power(S(ss1),2)));
+          case 179: return sqrt(3)/sqrt(-1 + 4*Power(S(ss1),2));
+          case 180: return -(sqrt(-3 + 4*S(ss1) + 4*Power(S(ss1),2))/(1 + 2*S(ss1)));
+          case 181: return 2/(1 + 2*S(ss1));
+          case 182: return (S(ss1)*sqrt((4 + 4*S(ss1))/(S(ss1) + 2*Power(S(ss1),2)))*(sqrt((2 + 3*S(ss1) + Power(S(ss1),2))/(3 + 2*S(ss1)))*(3 + 8*S(ss1) + 4*Power(S(ss1),2)) - S(ss1)*sqrt((2 + 3*S(ss1) + Power(S(ss1),2))/(3 + 2*S(ss1)))*(3 + 8*S(ss1) + 4*Power(S(ss1),2)) - 7*sqrt(6 + 13*S(ss1) + 9*Power(S(ss1),2) + 2*Power(S(ss1),3)) - 8*S(ss1)*sqrt(6 + 13*S(ss1) + 9*Power(S(ss1),2) + 2*Power(S(ss1),3))))/(Power(3 + 2*S(ss1),2)*(2 + 3*S(ss1) + Power(S(ss1),2)));
+          case 183: return sqrt(3)/sqrt(3 + 8*S(ss1) + 4*Power(S(ss1),2));
+          case 184: return -1;
+          default: my_assert_not_reached();
+        }
+      };
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(1, 2, 1));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -60,10 +435,384 @@ MatrixElements<SC> SymmetrySPSU2T<SC>::recalc_doublet(const DiagInfo<SC> &diag,
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "spsu2t/spsu2t-doubletm-1.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {4, 4},
+        {5, 5},
+        {5, 6},
+        {5, 7},
+        {6, 6},
+        {6, 7},
+        {6, 8},
+        {7, 7},
+        {7, 8},
+        {7, 9},
+        {8, 8},
+        {8, 9},
+        {9, 9},
+        {10, 10},
+        {10, 11},
+        {10, 12},
+        {11, 11},
+        {11, 12},
+        {11, 13},
+        {12, 12},
+        {12, 13},
+        {12, 14},
+        {13, 13},
+        {13, 14},
+        {14, 14},
+        {15, 15},
+        {15, 16},
+        {15, 17},
+        {15, 18},
+        {15, 19},
+        {15, 20},
+        {16, 16},
+        {16, 17},
+        {16, 19},
+        {16, 20},
+        {17, 17},
+        {17, 20},
+        {18, 18},
+        {18, 19},
+        {18, 20},
+        {19, 19},
+        {19, 20},
+        {20, 20},
+        {21, 21},
+        {21, 22},
+        {21, 23},
+        {21, 24},
+        {21, 25},
+        {21, 26},
+        {22, 22},
+        {22, 23},
+        {22, 25},
+        {22, 26},
+        {23, 23},
+        {23, 26},
+        {24, 24},
+        {24, 25},
+        {24, 26},
+        {25, 25},
+        {25, 26},
+        {26, 26},
+        {27, 27},
+        {27, 28},
+        {27, 29},
+        {27, 30},
+        {27, 31},
+        {27, 32},
+        {28, 28},
+        {28, 29},
+        {28, 31},
+        {28, 32},
+        {29, 29},
+        {29, 32},
+        {30, 30},
+        {30, 31},
+        {30, 32},
+        {31, 31},
+        {31, 32},
+        {32, 32},
+        {33, 33},
+        {33, 34},
+        {33, 35},
+        {33, 38},
+        {33, 39},
+        {33, 40},
+        {34, 34},
+        {34, 35},
+        {34, 36},
+        {34, 39},
+        {34, 40},
+        {34, 41},
+        {35, 35},
+        {35, 36},
+        {35, 37},
+        {35, 40},
+        {35, 41},
+        {35, 42},
+        {36, 36},
+        {36, 37},
+        {36, 41},
+        {36, 42},
+        {37, 37},
+        {37, 42},
+        {38, 38},
+        {38, 39},
+        {38, 40},
+        {39, 39},
+        {39, 40},
+        {39, 41},
+        {40, 40},
+        {40, 41},
+        {40, 42},
+        {41, 41},
+        {41, 42},
+        {42, 42},
+        {43, 43},
+        {43, 44},
+        {43, 45},
+        {43, 46},
+        {43, 47},
+        {43, 48},
+        {44, 44},
+        {44, 45},
+        {44, 47},
+        {44, 48},
+        {45, 45},
+        {45, 48},
+        {46, 46},
+        {46, 47},
+        {46, 48},
+        {46, 49},
+        {46, 50},
+        {46, 51},
+        {47, 47},
+        {47, 48},
+        {47, 50},
+        {47, 51},
+        {48, 48},
+        {48, 51},
+        {49, 49},
+        {49, 50},
+        {49, 51},
+        {50, 50},
+        {50, 51},
+        {51, 51},
+        {52, 52},
+        {52, 53},
+        {52, 54},
+        {52, 55},
+        {52, 56},
+        {52, 57},
+        {53, 53},
+        {53, 54},
+        {53, 56},
+        {53, 57},
+        {54, 54},
+        {54, 57},
+        {55, 55},
+        {55, 56},
+        {55, 57},
+        {55, 58},
+        {55, 59},
+        {55, 60},
+        {56, 56},
+        {56, 57},
+        {56, 59},
+        {56, 60},
+        {57, 57},
+        {57, 60},
+        {58, 58},
+        {58, 59},
+        {58, 60},
+        {59, 59},
+        {59, 60},
+        {60, 60},
+        {61, 61},
+        {61, 62},
+        {62, 62},
+        {62, 63},
+        {63, 63},
+        {63, 64},
+        {64, 64}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return 1;
+          case 3: return 1;
+          case 4: return 1;
+          case 5: return sqrt(2)/sqrt((-1 + T)*T);
+          case 6: return sqrt(6)/sqrt(T*(1 + 2*T)*(1 - 3*T + 2*Power(T,2)));
+          case 7: return 1/sqrt(((-1 + T)*T)/(-2 - T + Power(T,2)));
+          case 8: return ((-3 + 2*T)*sqrt((3 + 9*T + 6*Power(T,2))/(3 - 5*T + 2*Power(T,2))))/(T*(1 + 2*T));
+          case 9: return 3/(T + 2*Power(T,2));
+          case 10: return (sqrt((-1 + T)/(3 + 11*T + 12*Power(T,2) + 4*Power(T,3)))*(6*sqrt((3 - 2*T)/(1 - 2*T)) + 3*sqrt(3 - 8*T + 4*Power(T,2)) + T*sqrt(3 - 8*T + 4*Power(T,2))))/T;
+          case 11: return (sqrt(3)*sqrt((-3 + T + 2*Power(T,2))/(1 + 3*T + 2*Power(T,2))))/T;
+          case 12: return sqrt(6)/sqrt(T*(1 + 2*T)*(3 + 5*T + 2*Power(T,2)));
+          case 13: return (sqrt((-1 + T)/T)*(T*Power(1 + T,1.5)*(1 + 2*T)*sqrt(-6 + 5*T + 12*Power(T,2) + 4*Power(T,3)) + 9*Power(T,2)*sqrt((-6 + 5*T + 12*Power(T,2) + 4*Power(T,3))/(1 + T)) + 6*Power(T,3)*sqrt((-6 + 5*T + 12*Power(T,2) + 4*Power(T,3))/(1 + T)) + 6*sqrt(-6 - T + 17*Power(T,2) + 16*Power(T,3) + 4*Power(T,4)) + 3*T*(sqrt((-6 + 5*T + 12*Power(T,2) + 4*Power(T,3))/(1 + T)) + 3*sqrt(-6 - T + 17*Power(T,2) + 16*Power(T,3) + 4*Power(T,4)))))/(Power(1 + T,2)*(6 + 19*T + 16*Power(T,2) + 4*Power(T,3)));
+          case 14: return (sqrt(2)*(6*sqrt(T*(-3 + 4*T + 4*Power(T,2))) + 7*sqrt(Power(T,3)*(-3 + 4*T + 4*Power(T,2))) + 2*sqrt(Power(T,5)*(-3 + 4*T + 4*Power(T,2)))))/(T*(2 + T)*(3 + 2*T)*sqrt((1 + 2*T)*(3 + 5*T + 2*Power(T,2))));
+          case 15: return (18*sqrt((T*(-1 + 2*T))/(6 + 7*T + 2*Power(T,2))) + 2*sqrt((T*(-3 + 4*T + 4*Power(T,2)))/(2 + T)) + sqrt(T*(-6 + 5*T + 12*Power(T,2) + 4*Power(T,3))) + 2*T*(6*sqrt((T*(-1 + 2*T))/(6 + 7*T + 2*Power(T,2))) + 2*sqrt((T*(-3 + 4*T + 4*Power(T,2)))/(2 + T)) + sqrt(T*(-6 + 5*T + 12*Power(T,2) + 4*Power(T,3)))))/((3 + 2*T)*sqrt(T*(10 + 29*T + 20*Power(T,2) + 4*Power(T,3))));
+          case 16: return 1;
+          case 17: return sqrt(2)/sqrt((-1 + T)*T);
+          case 18: return sqrt(6)/sqrt(T*(1 + 2*T)*(1 - 3*T + 2*Power(T,2)));
+          case 19: return 1/sqrt(((-1 + T)*T)/(-2 - T + Power(T,2)));
+          case 20: return ((-3 + 2*T)*sqrt((3 + 9*T + 6*Power(T,2))/(3 - 5*T + 2*Power(T,2))))/(T*(1 + 2*T));
+          case 21: return 3/(T + 2*Power(T,2));
+          case 22: return (sqrt((-1 + T)/(3 + 11*T + 12*Power(T,2) + 4*Power(T,3)))*(6*sqrt((3 - 2*T)/(1 - 2*T)) + 3*sqrt(3 - 8*T + 4*Power(T,2)) + T*sqrt(3 - 8*T + 4*Power(T,2))))/T;
+          case 23: return (sqrt(3)*sqrt((-3 + T + 2*Power(T,2))/(1 + 3*T + 2*Power(T,2))))/T;
+          case 24: return sqrt(6)/sqrt(T*(1 + 2*T)*(3 + 5*T + 2*Power(T,2)));
+          case 25: return (sqrt((-1 + T)/T)*(T*Power(1 + T,1.5)*(1 + 2*T)*sqrt(-6 + 5*T + 12*Power(T,2) + 4*Power(T,3)) + 9*Power(T,2)*sqrt((-6 + 5*T + 12*Power(T,2) + 4*Power(T,3))/(1 + T)) + 6*Power(T,3)*sqrt((-6 + 5*T + 12*Power(T,2) + 4*Power(T,3))/(1 + T)) + 6*sqrt(-6 - T + 17*Power(T,2) + 16*Power(T,3) + 4*Power(T,4)) + 3*T*(sqrt((-6 + 5*T + 12*Power(T,2) + 4*Power(T,3))/(1 + T)) + 3*sqrt(-6 - T + 17*Power(T,2) + 16*Power(T,3) + 4*Power(T,4)))))/(Power(1 + T,2)*(6 + 19*T + 16*Power(T,2) + 4*Power(T,3)));
+          case 26: return (sqrt(2)*(6*sqrt(T*(-3 + 4*T + 4*Power(T,2))) + 7*sqrt(Power(T,3)*(-3 + 4*T + 4*Power(T,2))) + 2*sqrt(Power(T,5)*(-3 + 4*T + 4*Power(T,2)))))/(T*(2 + T)*(3 + 2*T)*sqrt((1 + 2*T)*(3 + 5*T + 2*Power(T,2))));
+          case 27: return (18*sqrt((T*(-1 + 2*T))/(6 + 7*T + 2*Power(T,2))) + 2*sqrt((T*(-3 + 4*T + 4*Power(T,2)))/(2 + T)) + sqrt(T*(-6 + 5*T + 12*Power(T,2) + 4*Power(T,3))) + 2*T*(6*sqrt((T*(-1 + 2*T))/(6 + 7*T + 2*Power(T,2))) + 2*sqrt((T*(-3 + 4*T + 4*Power(T,2)))/(2 + T)) + sqrt(T*(-6 + 5*T + 12*Power(T,2) + 4*Power(T,3)))))/((3 + 2*T)*sqrt(T*(10 + 29*T + 20*Power(T,2) + 4*Power(T,3))));
+          case 28: return -1;
+          case 29: return -(1/T);
+          case 30: return -(1/(T + 2*Power(T,2)));
+          case 31: return 1/(-1 - 2*S(ss1));
+          case 32: return -(1/(T + 2*S(ss1)*T));
+          case 33: return -(1/((1 + 2*S(ss1))*(T + 2*Power(T,2))));
+          case 34: return -((sqrt((-1 + T)/T) + sqrt((-1 + T)*T))/sqrt(T*(1 + T)));
+          case 35: return -(sqrt((-1 + 2*T)/(1 + 2*T))/T);
+          case 36: return -(sqrt(-1 + Power(T,2))/(T + 2*S(ss1)*T));
+          case 37: return -(sqrt((-1 + 2*T)/(1 + 2*T))/(T + 2*S(ss1)*T));
+          case 38: return -((sqrt(T*(1 + T)*(-1 + 2*T)*(1 + 2*T)) + sqrt((T*(-1 + 2*T))/(1 + 3*T + 2*Power(T,2))) + sqrt((T*(-1 + 4*Power(T,2)))/(1 + T)))/sqrt(T*(1 + 2*T)*(3 + 5*T + 2*Power(T,2))));
+          case 39: return -((sqrt((T*(-1 + 2*T))/(1 + 3*T + 2*Power(T,2))) + sqrt((T*(-1 + 4*Power(T,2)))/(1 + T)) + sqrt(T*(-1 - T + 4*Power(T,2) + 4*Power(T,3))))/((1 + 2*S(ss1))*sqrt(T*(3 + 11*T + 12*Power(T,2) + 4*Power(T,3)))));
+          case 40: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 41: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(T + 2*S(ss1)*T);
+          case 42: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/((1 + 2*S(ss1))*(T + 2*Power(T,2)));
+          case 43: return (-2*sqrt(S(ss1)*(1 + S(ss1))*(-1 + Power(T,2))))/(T + 2*S(ss1)*T);
+          case 44: return (-2*sqrt((S(ss1)*(1 + S(ss1))*(-1 + 2*T))/(1 + 2*T)))/(T + 2*S(ss1)*T);
+          case 45: return -0.5*(2*sqrt((S(ss1)*Power(1 + S(ss1),3)*T*(1 + T)*(-1 + 2*T)*Power(3 + 2*T,3))/Power(1 + 2*T,3)) + 2*sqrt((S(ss1)*Power(1 + S(ss1),3)*T*(1 + T)*(-1 + 2*T)*Power(3 + 2*T,3))/(1 + 2*T)) + 2*sqrt((S(ss1)*Power(1 + S(ss1),3)*T*(1 + T)*(-1 + 2*T)*Power(3 + 2*T,3))/(Power(1 + 2*S(ss1),2)*(1 + 2*T))) + 2*sqrt((S(ss1)*Power(1 + S(ss1),3)*T*(-1 + 2*T)*Power(3 + 5*T + 2*Power(T,2),3))/(1 + 2*T)) + 2*sqrt((S(ss1)*Power(1 + S(ss1),3)*T*(-1 + 2*T)*Power(3 + 5*T + 2*Power(T,2),3))/(Power(1 + 2*S(ss1),2)*(1 + 2*T))) + (2*Power(1 + S(ss1),1.5)*(1 + T)*(3 + 2*T)*sqrt((S(ss1)*T*(-3 + 4*T + 4*Power(T,2)))/(1 + 3*T + 2*Power(T,2))))/((1 + 2*S(ss1))*(1 + 2*T)))/sqrt((Power(1 + S(ss1),4)*T*Power(1 + T,3)*Power(3 + 2*T,4))/(1 + 2*T));
+          case 46: return -1;
+          case 47: return -(1/T);
+          case 48: return -(1/(T + 2*Power(T,2)));
+          case 49: return 1/(-1 - 2*S(ss1));
+          case 50: return -(1/(T + 2*S(ss1)*T));
+          case 51: return -(1/((1 + 2*S(ss1))*(T + 2*Power(T,2))));
+          case 52: return -((sqrt((-1 + T)/T) + sqrt((-1 + T)*T))/sqrt(T*(1 + T)));
+          case 53: return -(sqrt((-1 + 2*T)/(1 + 2*T))/T);
+          case 54: return -(sqrt(-1 + Power(T,2))/(T + 2*S(ss1)*T));
+          case 55: return -(sqrt((-1 + 2*T)/(1 + 2*T))/(T + 2*S(ss1)*T));
+          case 56: return -((sqrt(T*(1 + T)*(-1 + 2*T)*(1 + 2*T)) + sqrt((T*(-1 + 2*T))/(1 + 3*T + 2*Power(T,2))) + sqrt((T*(-1 + 4*Power(T,2)))/(1 + T)))/sqrt(T*(1 + 2*T)*(3 + 5*T + 2*Power(T,2))));
+          case 57: return -((sqrt((T*(-1 + 2*T))/(1 + 3*T + 2*Power(T,2))) + sqrt((T*(-1 + 4*Power(T,2)))/(1 + T)) + sqrt(T*(-1 - T + 4*Power(T,2) + 4*Power(T,3))))/((1 + 2*S(ss1))*sqrt(T*(3 + 11*T + 12*Power(T,2) + 4*Power(T,3)))));
+          case 58: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 59: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(T + 2*S(ss1)*T);
+          case 60: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/((1 + 2*S(ss1))*(T + 2*Power(T,2)));
+          case 61: return (-2*sqrt(S(ss1)*(1 + S(ss1))*(-1 + Power(T,2))))/(T + 2*S(ss1)*T);
+          case 62: return (-2*sqrt((S(ss1)*(1 + S(ss1))*(-1 + 2*T))/(1 + 2*T)))/(T + 2*S(ss1)*T);
+          case 63: return -((sqrt((S(ss1)*Power(1 + S(ss1),3)*T*Power(3 + 2*T,3)*(-1 + T + 2*Power(T,2)))/Power(1 + 2*T,3)) + sqrt((S(ss1)*Power(1 + S(ss1),3)*T*Power(3 + 2*T,3)*(-1 + T + 2*Power(T,2)))/(1 + 2*T)) + sqrt((S(ss1)*Power(1 + S(ss1),3)*T*Power(3 + 2*T,3)*(-1 + T + 2*Power(T,2)))/(Power(1 + 2*S(ss1),2)*(1 + 2*T))) + sqrt((S(ss1)*Power(1 + S(ss1),3)*T*(-1 + 2*T)*Power(3 + 5*T + 2*Power(T,2),3))/(1 + 2*T)) + sqrt((S(ss1)*Power(1 + S(ss1),3)*T*(-1 + 2*T)*Power(3 + 5*T + 2*Power(T,2),3))/(Power(1 + 2*S(ss1),2)*(1 + 2*T))) + ((1 + S(ss1))*(1 + T)*(3 + 2*T)*sqrt((S(ss1)*(1 + S(ss1))*T*(-3 + 4*T + 4*Power(T,2)))/(Power(1 + 2*S(ss1),2)*(1 + 3*T + 2*Power(T,2)))))/(1 + 2*T))/sqrt((Power(1 + S(ss1),4)*T*Power(1 + T,3)*Power(3 + 2*T,4))/(1 + 2*T)));
+          case 64: return -1;
+          case 65: return -(1/T);
+          case 66: return -(1/(T + 2*Power(T,2)));
+          case 67: return 1/(-1 - 2*S(ss1));
+          case 68: return -(1/(T + 2*S(ss1)*T));
+          case 69: return -(1/((1 + 2*S(ss1))*(T + 2*Power(T,2))));
+          case 70: return -((sqrt((-1 + T)/T) + sqrt((-1 + T)*T))/sqrt(T*(1 + T)));
+          case 71: return -(sqrt((-1 + 2*T)/(1 + 2*T))/T);
+          case 72: return -(sqrt(-1 + Power(T,2))/(T + 2*S(ss1)*T));
+          case 73: return -(sqrt((-1 + 2*T)/(1 + 2*T))/(T + 2*S(ss1)*T));
+          case 74: return -((sqrt(T*(1 + T)*(-1 + 2*T)*(1 + 2*T)) + sqrt((T*(-1 + 2*T))/(1 + 3*T + 2*Power(T,2))) + sqrt((T*(-1 + 4*Power(T,2)))/(1 + T)))/sqrt(T*(1 + 2*T)*(3 + 5*T + 2*Power(T,2))));
+          case 75: return -((sqrt((T*(-1 + 2*T))/(1 + 3*T + 2*Power(T,2))) + sqrt((T*(-1 + 4*Power(T,2)))/(1 + T)) + sqrt(T*(-1 - T + 4*Power(T,2) + 4*Power(T,3))))/((1 + 2*S(ss1))*sqrt(T*(3 + 11*T + 12*Power(T,2) + 4*Power(T,3)))));
+          case 76: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 77: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(T + 2*S(ss1)*T);
+          case 78: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/((1 + 2*S(ss1))*(T + 2*Power(T,2)));
+          case 79: return (-2*sqrt(S(ss1)*(1 + S(ss1))*(-1 + Power(T,2))))/(T + 2*S(ss1)*T);
+          case 80: return (-2*sqrt((S(ss1)*(1 + S(ss1))*(-1 + 2*T))/(1 + 2*T)))/(T + 2*S(ss1)*T);
+          case 81: return -0.5*(2*sqrt((S(ss1)*Power(1 + S(ss1),3)*T*(1 + T)*(-1 + 2*T)*Power(3 + 2*T,3))/Power(1 + 2*T,3)) + 2*sqrt((S(ss1)*Power(1 + S(ss1),3)*T*(1 + T)*(-1 + 2*T)*Power(3 + 2*T,3))/(1 + 2*T)) + 2*sqrt((S(ss1)*Power(1 + S(ss1),3)*T*(1 + T)*(-1 + 2*T)*Power(3 + 2*T,3))/(Power(1 + 2*S(ss1),2)*(1 + 2*T))) + 2*sqrt((S(ss1)*Power(1 + S(ss1),3)*T*(-1 + 2*T)*Power(3 + 5*T + 2*Power(T,2),3))/(1 + 2*T)) + 2*sqrt((S(ss1)*Power(1 + S(ss1),3)*T*(-1 + 2*T)*Power(3 + 5*T + 2*Power(T,2),3))/(Power(1 + 2*S(ss1),2)*(1 + 2*T))) + (2*Power(1 + S(ss1),1.5)*(1 + T)*(3 + 2*T)*sqrt((S(ss1)*T*(-3 + 4*T + 4*Power(T,2)))/(1 + 3*T + 2*Power(T,2))))/((1 + 2*S(ss1))*(1 + 2*T)))/sqrt((Power(1 + S(ss1),4)*T*Power(1 + T,3)*Power(3 + 2*T,4))/(1 + 2*T));
+          case 82: return -1;
+          case 83: return -(sqrt(2)/sqrt((-1 + T)*T));
+          case 84: return -(sqrt(6)/sqrt(T*(1 + 2*T)*(1 - 3*T + 2*Power(T,2))));
+          case 85: return 1/(-1 - 2*S(ss1));
+          case 86: return -(sqrt(2)/((1 + 2*S(ss1))*sqrt((-1 + T)*T)));
+          case 87: return -(sqrt(6)/((1 + 2*S(ss1))*sqrt(T*(1 + 2*T)*(1 - 3*T + 2*Power(T,2)))));
+          case 88: return -(1/sqrt(((-1 + T)*T)/(-2 - T + Power(T,2))));
+          case 89: return ((3 - 2*T)*sqrt((3 + 9*T + 6*Power(T,2))/(3 - 5*T + 2*Power(T,2))))/(T*(1 + 2*T));
+          case 90: return -3/(T + 2*Power(T,2));
+          case 91: return -(((-2 + T)*sqrt((T*(1 + T))/(2 - 3*T + Power(T,2))))/(T + 2*S(ss1)*T));
+          case 92: return ((3 - 2*T)*sqrt((3 + 9*T + 6*Power(T,2))/(3 - 5*T + 2*Power(T,2))))/((1 + 2*S(ss1))*T*(1 + 2*T));
+          case 93: return -3/((1 + 2*S(ss1))*(T + 2*Power(T,2)));
+          case 94: return -((sqrt((-1 + T)/(3 + 11*T + 12*Power(T,2) + 4*Power(T,3)))*(6*sqrt((3 - 2*T)/(1 - 2*T)) + 3*sqrt(3 - 8*T + 4*Power(T,2)) + T*sqrt(3 - 8*T + 4*Power(T,2))))/T);
+          case 95: return -((sqrt(3)*sqrt((-3 + T + 2*Power(T,2))/(1 + 3*T + 2*Power(T,2))))/T);
+          case 96: return -(sqrt(6)/sqrt(T*(1 + 2*T)*(3 + 5*T + 2*Power(T,2))));
+          case 97: return -(((3*(-3 + 2*T)*(-1 + 2*T))/sqrt(((1 + 2*S(ss1))*Power(T,2)*(-3 - 4*T + 4*Power(T,2))*(-3 + T + 8*Power(T,2) + 4*Power(T,3)))/(-1 + T)) + (6*sqrt((3 - 5*T + 2*Power(T,2))/((1 + 2*S(ss1))*(-3 - 5*T + 10*Power(T,2) + 20*Power(T,3) + 8*Power(T,4)))))/T + ((-1 + 2*T)*(3 - 5*T + 2*Power(T,2)))/sqrt((1 + 2*S(ss1))*(-9 + 49*Power(T,2) - 56*Power(T,4) + 16*Power(T,6))))/sqrt(1 + 2*S(ss1)));
+          case 98: return -((sqrt(3)*(-3 + T + 8*Power(T,2) + 4*Power(T,3))*(-3*sqrt((1 + 2*S(ss1))*T*(1 + 2*T)) + 7*T*sqrt((1 + 2*S(ss1))*T*(1 + 2*T)) - 3*Power(T,2)*sqrt((1 + 2*S(ss1))*T*(1 + 2*T)) + 2*Power(T,3)*sqrt((1 + 2*S(ss1))*T*(1 + 2*T)) - 9*sqrt((1 + 2*S(ss1))*Power(T,3)*(1 + 2*T)) + 6*sqrt((1 + 2*S(ss1))*Power(T,5)*(1 + 2*T))))/sqrt(Power(1 + 2*S(ss1),3)*(-1 + T)*Power(T,3)*Power(1 + T,5)*Power(3 + 2*T,3)*Power(1 - 4*Power(T,2),2)));
+          case 99: return -(sqrt(6)/((1 + 2*S(ss1))*sqrt(T*(1 + 2*T)*(3 + 5*T + 2*Power(T,2)))));
+          case 100: return -((sqrt((-1 + T)/T)*(T*Power(1 + T,1.5)*(1 + 2*T)*sqrt(-6 + 5*T + 12*Power(T,2) + 4*Power(T,3)) + 9*Power(T,2)*sqrt((-6 + 5*T + 12*Power(T,2) + 4*Power(T,3))/(1 + T)) + 6*Power(T,3)*sqrt((-6 + 5*T + 12*Power(T,2) + 4*Power(T,3))/(1 + T)) + 6*sqrt(-6 - T + 17*Power(T,2) + 16*Power(T,3) + 4*Power(T,4)) + 3*T*(sqrt((-6 + 5*T + 12*Power(T,2) + 4*Power(T,3))/(1 + T)) + 3*sqrt(-6 - T + 17*Power(T,2) + 16*Power(T,3) + 4*Power(T,4)))))/(Power(1 + T,2)*(6 + 19*T + 16*Power(T,2) + 4*Power(T,3))));
+          case 101: return -((sqrt(2)*(6*sqrt(T*(-3 + 4*T + 4*Power(T,2))) + 7*sqrt(Power(T,3)*(-3 + 4*T + 4*Power(T,2))) + 2*sqrt(Power(T,5)*(-3 + 4*T + 4*Power(T,2)))))/(T*(2 + T)*(3 + 2*T)*sqrt((1 + 2*T)*(3 + 5*T + 2*Power(T,2)))));
+          case 102: return -((sqrt(-1 + T)*T*(6*sqrt(((1 + 2*S(ss1))*(-6 + 5*T + 12*Power(T,2) + 4*Power(T,3)))/(1 + T)) + 3*Power(T,2)*(3*sqrt(((1 + 2*S(ss1))*(-6 + 5*T + 12*Power(T,2) + 4*Power(T,3)))/(1 + T)) + sqrt((1 + 2*S(ss1))*(-6 - T + 17*Power(T,2) + 16*Power(T,3) + 4*Power(T,4)))) + 2*Power(T,3)*(3*sqrt(((1 + 2*S(ss1))*(-6 + 5*T + 12*Power(T,2) + 4*Power(T,3)))/(1 + T)) + sqrt((1 + 2*S(ss1))*(-6 - T + 17*Power(T,2) + 16*Power(T,3) + 4*Power(T,4)))) + T*(9*sqrt(((1 + 2*S(ss1))*(-6 + 5*T + 12*Power(T,2) + 4*Power(T,3)))/(1 + T)) + 10*sqrt((1 + 2*S(ss1))*(-6 - T + 17*Power(T,2) + 16*Power(T,3) + 4*Power(T,4))))))/(Power(1 + T,2)*Power(T + 2*S(ss1)*T,1.5)*(6 + 19*T + 16*Power(T,2) + 4*Power(T,3))));
+          case 103: return -((sqrt(2)*(6*sqrt(T*(-3 + 4*T + 4*Power(T,2))) + 7*sqrt(Power(T,3)*(-3 + 4*T + 4*Power(T,2))) + 2*sqrt(Power(T,5)*(-3 + 4*T + 4*Power(T,2)))))/((1 + 2*S(ss1))*T*(2 + T)*(3 + 2*T)*sqrt(3 + 11*T + 12*Power(T,2) + 4*Power(T,3))));
+          case 104: return -((18*sqrt((T*(-1 + 2*T))/(6 + 7*T + 2*Power(T,2))) + 2*sqrt((T*(-3 + 4*T + 4*Power(T,2)))/(2 + T)) + sqrt(T*(-6 + 5*T + 12*Power(T,2) + 4*Power(T,3))) + 2*T*(6*sqrt((T*(-1 + 2*T))/(6 + 7*T + 2*Power(T,2))) + 2*sqrt((T*(-3 + 4*T + 4*Power(T,2)))/(2 + T)) + sqrt(T*(-6 + 5*T + 12*Power(T,2) + 4*Power(T,3)))))/((3 + 2*T)*sqrt(T*(10 + 29*T + 20*Power(T,2) + 4*Power(T,3)))));
+          case 105: return -((18*sqrt((T*(-1 + 2*T))/(6 + 7*T + 2*Power(T,2))) + 2*sqrt((T*(-3 + 4*T + 4*Power(T,2)))/(2 + T)) + sqrt(T*(-6 + 5*T + 12*Power(T,2) + 4*Power(T,3))) + 2*T*(6*sqrt((T*(-1 + 2*T))/(6 + 7*T + 2*Power(T,2))) + 2*sqrt((T*(-3 + 4*T + 4*Power(T,2)))/(2 + T)) + sqrt(T*(-6 + 5*T + 12*Power(T,2) + 4*Power(T,3)))))/((1 + 2*S(ss1))*(3 + 2*T)*sqrt(T*(10 + 29*T + 20*Power(T,2) + 4*Power(T,3)))));
+          case 106: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 107: return (-2*sqrt(2)*sqrt((S(ss1)*(1 + S(ss1)))/((-1 + T)*T)))/(1 + 2*S(ss1));
+          case 108: return (-2*sqrt(6)*sqrt((S(ss1) + Power(S(ss1),2))/(T - Power(T,2) - 4*Power(T,3) + 4*Power(T,4))))/(1 + 2*S(ss1));
+          case 109: return -(((-2 + T)*(-1 + T))/sqrt(((1 + S(ss1))*(-2 + T)*T*(-1 + Power(T,2)))/S(ss1))) - ((-2 + T)*(-1 + T))/sqrt(((1 + S(ss1))*Power(1 + 2*S(ss1),2)*(-2 + T)*T*(-1 + Power(T,2)))/S(ss1)) - 2*sqrt((S(ss1)*(-2 + T))/((1 + S(ss1))*(-T + Power(T,3)))) - (2*sqrt((S(ss1)*(-2 + T))/((1 + S(ss1))*(-T + Power(T,3)))))/(1 + 2*S(ss1));
+          case 110: return (-2*sqrt(3)*(1 + S(ss1))*(2*sqrt((S(ss1)*(-3 + 2*T))/((1 + S(ss1))*(-1 - 2*T + Power(T,2) + 2*Power(T,3)))) + 3*sqrt(S(ss1)/((1 + S(ss1))*(3 + 4*T - 7*Power(T,2) - 4*Power(T,3) + 4*Power(T,4)))) - 5*T*sqrt(S(ss1)/((1 + S(ss1))*(3 + 4*T - 7*Power(T,2) - 4*Power(T,3) + 4*Power(T,4)))) + 2*Power(T,2)*sqrt(S(ss1)/((1 + S(ss1))*(3 + 4*T - 7*Power(T,2) - 4*Power(T,3) + 4*Power(T,4))))))/(T + 2*S(ss1)*T);
+          case 111: return (-6*sqrt(S(ss1)*(1 + S(ss1))))/((1 + 2*S(ss1))*(T + 2*Power(T,2)));
+          case 112: return -3*(-3 + 2*T)*(-1 + 2*T)*sqrt((S(ss1)*(-1 + T))/((1 + S(ss1))*Power(T,2)*(-3 - 4*T + 4*Power(T,2))*(-3 + T + 8*Power(T,2) + 4*Power(T,3)))) - 3*(-3 + 2*T)*(-1 + 2*T)*sqrt((S(ss1)*(-1 + T))/((1 + S(ss1))*Power(T + 2*S(ss1)*T,2)*(-3 - 4*T + 4*Power(T,2))*(-3 + T + 8*Power(T,2) + 4*Power(T,3)))) - (6*sqrt((S(ss1)*(3 - 5*T + 2*Power(T,2)))/((1 + S(ss1))*(-3 - 5*T + 10*Power(T,2) + 20*Power(T,3) + 8*Power(T,4)))))/T - (6*sqrt((S(ss1)*(3 - 5*T + 2*Power(T,2)))/((1 + S(ss1))*(-3 - 5*T + 10*Power(T,2) + 20*Power(T,3) + 8*Power(T,4)))))/(T + 2*S(ss1)*T) - (-1 + 2*T)*(3 - 5*T + 2*Power(T,2))*sqrt(S(ss1)/((1 + S(ss1))*Power(1 + 2*S(ss1),2)*(-9 + 49*Power(T,2) - 56*Power(T,4) + 16*Power(T,6)))) - ((-1 + 2*T)*(3 - 5*T + 2*Power(T,2)))/sqrt(((1 + S(ss1))*(-9 + 49*Power(T,2) - 56*Power(T,4) + 16*Power(T,6)))/S(ss1));
+          case 113: return sqrt(3)*((-6*sqrt((S(ss1)*(-1 + T))/((1 + S(ss1))*Power(1 + T,3)*(3 + 8*T + 4*Power(T,2)))))/T - 3*(-1 + T)*(-1 + 2*T)*sqrt(S(ss1)/((1 + S(ss1))*Power(T,2)*Power(1 + T,3)*(-3 - 5*T + 4*Power(T,2) + 4*Power(T,3)))) - 3*(-1 + T)*(-1 + 2*T)*sqrt(S(ss1)/((1 + S(ss1))*Power(1 + T,3)*Power(T + 2*S(ss1)*T,2)*(-3 - 5*T + 4*Power(T,2) + 4*Power(T,3)))) - (6*sqrt((S(ss1)*(-1 + T))/((1 + S(ss1))*(3 + 11*T + 12*Power(T,2) + 4*Power(T,3)))))/((1 + T)*(T + 2*S(ss1)*T)) - ((-1 + T)*Power(-1 + 2*T,1.5)*sqrt(S(ss1)/((1 + S(ss1))*(3 + 2*T - 15*Power(T,2) - 10*Power(T,3) + 12*Power(T,4) + 8*Power(T,5)))))/(1 + T) - ((-1 + T)*Power(-1 + 2*T,1.5)*sqrt(S(ss1)/((1 + S(ss1))*(3 + 2*T - 15*Power(T,2) - 10*Power(T,3) + 12*Power(T,4) + 8*Power(T,5)))))/((1 + 2*S(ss1))*(1 + T)));
+          case 114: return sqrt(6)*(-6*sqrt(S(ss1)/((1 + S(ss1))*(T + 2*Power(T,2))*Power(3 + 5*T + 2*Power(T,2),3))) + 3*(1 - 2*T)*sqrt(S(ss1)/((1 + S(ss1))*(T + 2*Power(T,2))*Power(3 + 5*T + 2*Power(T,2),3))) - (T*(-1 + 2*T)*sqrt(S(ss1)/((1 + S(ss1))*T*(3 + 11*T + 12*Power(T,2) + 4*Power(T,3)))))/(3 + 5*T + 2*Power(T,2)) - (6*sqrt(S(ss1)/((1 + S(ss1))*Power(1 + 2*S(ss1),2)*T*(3 + 11*T + 12*Power(T,2) + 4*Power(T,3)))))/(3 + 5*T + 2*Power(T,2)) - (3*Power(-1 + 2*T,1.5)*sqrt(S(ss1)/((1 + S(ss1))*T*(-3 - 5*T + 10*Power(T,2) + 20*Power(T,3) + 8*Power(T,4)))))/((1 + 2*S(ss1))*(3 + 5*T + 2*Power(T,2))) - (T*Power(-1 + 2*T,1.5))/((1 + 2*S(ss1))*(3 + 5*T + 2*Power(T,2))*sqrt(((1 + S(ss1))*T*(-3 - 5*T + 10*Power(T,2) + 20*Power(T,3) + 8*Power(T,4)))/S(ss1))));
+          case 115: return (-6*sqrt((S(ss1)*(1 - 3*T + 2*Power(T,2)))/((1 + S(ss1))*T*Power(1 + T,3)*(6 + 7*T + 2*Power(T,2)))))/(1 + 2*T) - ((-1 + T)*T)/sqrt(((1 + S(ss1))*T*(-1 + Power(T,2))*(6 + 7*T + 2*Power(T,2)))/(S(ss1)*(-1 + 2*T))) - ((-1 + T)*T)/sqrt(((1 + S(ss1))*Power(1 + 2*S(ss1),2)*T*(-1 + Power(T,2))*(6 + 7*T + 2*Power(T,2)))/(S(ss1)*(-1 + 2*T))) - 3*(-1 + T)*T*sqrt((S(ss1)*(-1 + 2*T))/((1 + S(ss1))*T*Power(1 + T,3)*(-6 - T + 5*Power(T,2) + 2*Power(T,3)))) - 3*(-1 + T)*T*sqrt((S(ss1)*(-1 + 2*T))/((1 + S(ss1))*Power(1 + 2*S(ss1),2)*T*Power(1 + T,3)*(-6 - T + 5*Power(T,2) + 2*Power(T,3)))) - (9*T*sqrt((S(ss1)*(-1 + T)*(-1 + 2*T))/((1 + S(ss1))*T*(6 + 13*T + 9*Power(T,2) + 2*Power(T,3)))))/(1 + 3*T + 2*Power(T,2)) - (6*sqrt((S(ss1)*(1 - 3*T + 2*Power(T,2)))/((1 + S(ss1))*T*(6 + 13*T + 9*Power(T,2) + 2*Power(T,3)))))/((1 + T)*(1 + 2*S(ss1) + 2*T + 4*S(ss1)*T)) - (9*(-1 + T)*sqrt((S(ss1)*T*(-1 + 2*T))/((1 + S(ss1))*Power(1 + 2*S(ss1),2)*Power(1 + 2*T,2)*(-6 - 7*T + 4*Power(T,2) + 7*Power(T,3) + 2*Power(T,4)))))/(1 + T);
+          case 116: return sqrt(2)*T*sqrt(((1 + 2*S(ss1))*(1 + 2*T))/(Power(1 + S(ss1),5)*Power(T,5)*Power(1 + T,4)*Power(2 + T,5)*Power(3 + 2*T,6)))*((-3*Power(1 + S(ss1),2)*Power(T,2)*(1 + T)*Power(2 + T,2)*Power(3 + 2*T,2)*sqrt((S(ss1)*(-1 + 2*T))/(2 + 3*T + Power(T,2))))/Power(1 + 2*S(ss1),1.5) - sqrt((S(ss1)*Power(1 + S(ss1),4)*Power(T,4)*(-1 + 2*T)*Power(3 + 2*T,4)*Power(2 + 3*T + Power(T,2),3))/Power(1 + 2*S(ss1),3)) - sqrt((S(ss1)*Power(1 + S(ss1),4)*Power(T,4)*(-1 + 2*T)*Power(3 + 2*T,4)*Power(2 + 3*T + Power(T,2),3))/(1 + 2*S(ss1))) - 3*sqrt((S(ss1)*Power(1 + S(ss1),4)*Power(T,4)*Power(2 + T,3)*Power(3 + 2*T,4)*(-1 + T + 2*Power(T,2)))/(1 + 2*S(ss1))) - 9*sqrt((S(ss1)*Power(1 + S(ss1),4)*Power(T,4)*Power(2 + T,3)*Power(3 + 2*T,4)*(-1 + T + 2*Power(T,2)))/((1 + 2*S(ss1))*Power(1 + 2*T,2))) - (6*Power(1 + S(ss1),2)*T*(1 + T)*sqrt((S(ss1)*(-1 + 2*T))/(2 + 3*T + Power(T,2)))*Power(6 + 7*T + 2*Power(T,2),2))/(Power(1 + 2*S(ss1),1.5)*(1 + 2*T)) - (9*Power(1 + S(ss1),2)*Power(T,2)*(1 + T)*sqrt((S(ss1)*(-1 + 2*T))/(2 + 3*T + Power(T,2)))*Power(6 + 7*T + 2*Power(T,2),2))/(Power(1 + 2*S(ss1),1.5)*(1 + 2*T)) - (6*Power(1 + S(ss1),2)*T*(1 + T)*sqrt((S(ss1)*(-1 + 2*T))/((1 + 2*S(ss1))*(2 + 3*T + Power(T,2))))*Power(6 + 7*T + 2*Power(T,2),2))/(1 + 2*T));
+          case 117: return -0.5*(12*sqrt((S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*T*(-1 + 2*T)*(5 + 2*T))/((1 + 2*T)*(6 + 7*T + 2*Power(T,2)))) + 12*(1 + T)*sqrt((S(ss1)*(1 + S(ss1))*T*(-1 + 2*T)*(1 + 2*T)*(5 + 2*T))/((1 + 2*S(ss1))*(6 + 7*T + 2*Power(T,2)))) + 12*sqrt((S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*T*(-1 + 2*T)*(1 + 2*T)*(5 + 2*T))/(6 + 7*T + 2*Power(T,2))) + 12*(1 + T)*sqrt((S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*T*(-1 + 2*T)*(1 + 2*T)*(5 + 2*T))/(6 + 7*T + 2*Power(T,2))) + 12*sqrt((S(ss1)*(1 + S(ss1))*T*(1 + 2*T)*(-5 + 8*T + 4*Power(T,2)))/((1 + 2*S(ss1))*(6 + 7*T + 2*Power(T,2)))) + 4*(1 + T)*sqrt((S(ss1)*(1 + S(ss1))*T*(-1 + 2*T)*(1 + 2*T)*(15 + 16*T + 4*Power(T,2)))/((1 + 2*S(ss1))*(2 + T))) + 4*(1 + T)*sqrt((S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*T*(-1 + 2*T)*(1 + 2*T)*(15 + 16*T + 4*Power(T,2)))/(2 + T)) + 12*sqrt((S(ss1)*(1 + S(ss1))*T*(-5 + 8*T + 4*Power(T,2)))/((1 + 2*S(ss1))*(6 + 19*T + 16*Power(T,2) + 4*Power(T,3)))) + 2*(1 + T)*sqrt((S(ss1)*(1 + S(ss1))*T*(-1 + 2*T)*(1 + 2*T)*(30 + 47*T + 24*Power(T,2) + 4*Power(T,3)))/(1 + 2*S(ss1))) + 2*sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*T*(-1 + 2*T)*(1 + 3*T + 2*Power(T,2))*(30 + 77*T + 71*Power(T,2) + 28*Power(T,3) + 4*Power(T,4))))/((1 + S(ss1))*sqrt((1 + 2*S(ss1))*T*(2 + T))*(15 + 31*T + 20*Power(T,2) + 4*Power(T,3)));
+          case 118: return 1;
+          case 119: return 1/T;
+          case 120: return 1/(T + 2*Power(T,2));
+          case 121: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 122: return 1/(sqrt(S(ss1)*(1 + 2*S(ss1)))*T);
+          case 123: return 1/(sqrt(S(ss1)*(1 + 2*S(ss1)))*T*(1 + 2*T));
+          case 124: return sqrt(-1 + Power(T,2))/T;
+          case 125: return sqrt((-1 + 2*T)/(1 + 2*T))/T;
+          case 126: return 1/(T*sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + Power(T,2))));
+          case 127: return 1/sqrt((S(ss1)*(1 + 2*S(ss1))*Power(T,2)*(1 + 2*T))/(-1 + 2*T));
+          case 128: return (sqrt(T*(1 + T)*(-1 + 2*T)*(1 + 2*T)) + sqrt((T*(-1 + 2*T))/(1 + 3*T + 2*Power(T,2))) + sqrt((T*(-1 + 4*Power(T,2)))/(1 + T)))/sqrt(T*(1 + 2*T)*(3 + 5*T + 2*Power(T,2)));
+          case 129: return (sqrt(T*(1 + T)*(-1 + 2*T)*(1 + 2*T)) + sqrt((T*(-1 + 2*T))/(1 + 3*T + 2*Power(T,2))) + sqrt((T*(-1 + 4*Power(T,2)))/(1 + T)))/sqrt(S(ss1)*(1 + 2*S(ss1))*T*(1 + 2*T)*(3 + 5*T + 2*Power(T,2)));
+          case 130: return (-sqrt(2 + 1/S(ss1)) + sqrt(S(ss1)*(1 + 2*S(ss1))) + 2*sqrt(Power(S(ss1),3)*(1 + 2*S(ss1))))/((1 + 2*S(ss1))*sqrt(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 131: return (-sqrt((2 + 1/S(ss1))*T) + sqrt(S(ss1)*(1 + 2*S(ss1))*T) + 2*S(ss1)*sqrt(S(ss1)*(1 + 2*S(ss1))*T))/((1 + 2*S(ss1))*sqrt(-1 + S(ss1) + 2*Power(S(ss1),2))*Power(T,1.5));
+          case 132: return ((-1 + S(ss1) + 2*Power(S(ss1),2))*(-sqrt(((1 + 2*S(ss1))*T*(1 + 2*T))/S(ss1)) + sqrt(S(ss1)*(1 + 2*S(ss1))*T*(1 + 2*T)) + 2*sqrt(Power(S(ss1),3)*(1 + 2*S(ss1))*T*(1 + 2*T))))/((1 + 2*S(ss1))*Power((-1 + S(ss1) + 2*Power(S(ss1),2))*T*(1 + 2*T),1.5));
+          case 133: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 134: return 1/(sqrt((1 + S(ss1))*(1 + 2*S(ss1)))*T);
+          case 135: return 1/(sqrt(1 + 3*S(ss1) + 2*Power(S(ss1),2))*(T + 2*Power(T,2)));
+          case 136: return (-1 + T)/sqrt((S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*(-1 + T)*(1 + T))/(-1 + 2*S(ss1))) + 1/sqrt((S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*Power(T,2)*(1 + T))/((-1 + 2*S(ss1))*(-1 + T))) + (S(ss1)*(-1 + 2*S(ss1)))/sqrt((S(ss1)*(1 + S(ss1))*(-1 + 4*Power(S(ss1),2))*Power(T,2)*(1 + T))/(-1 + T)) + ((-1 + 2*S(ss1))*(-1 + T)*T)/sqrt(((1 + S(ss1))*(-1 + 4*Power(S(ss1),2))*(-1 + T)*Power(T,2)*(1 + T))/S(ss1));
+          case 137: return (sqrt((-1 + 2*S(ss1))/(1 + S(ss1)))*(sqrt(((1 + 2*S(ss1))*(-1 + 4*Power(T,2)))/S(ss1)) + sqrt(S(ss1)*(1 + 2*S(ss1))*(-1 + 4*Power(T,2)))))/((1 + 2*S(ss1))*T*(1 + 2*T));
+          case 138: return 1/(T*sqrt(((1 + S(ss1))*(1 + 2*S(ss1)))/(-1 + Power(T,2))));
+          case 139: return 1/(T*sqrt(((1 + S(ss1))*(1 + 2*S(ss1))*(1 + 2*T))/(-1 + 2*T)));
+          case 140: return ((-1 + 2*S(ss1))*sqrt(((1 + 2*S(ss1))*(-1 + 2*T))/(S(ss1)*(1 + T))) - sqrt((S(ss1)*(1 + 2*S(ss1))*(-1 + 2*T))/(1 + T)) + 2*sqrt((Power(S(ss1),3)*(1 + 2*S(ss1))*(-1 + 2*T))/(1 + T)) + (-1 + 2*S(ss1))*sqrt(((1 + 2*S(ss1))*(-1 + 2*T))/(S(ss1)*(1 + T)))*(1 + 2*T) - sqrt((S(ss1)*(1 + 2*S(ss1))*(-1 + 2*T))/(1 + T))*(1 + 2*T) + 2*S(ss1)*sqrt((S(ss1)*(1 + 2*S(ss1))*(-1 + 2*T))/(1 + T))*(1 + 2*T) + 2*Power(S(ss1),1.5)*(1 + 2*T)*sqrt((1 + 2*S(ss1))*(-1 + T + 2*Power(T,2))) - S(ss1)*(1 + 2*T)*sqrt(((1 + 2*S(ss1))*(-1 + T + 2*Power(T,2)))/S(ss1)) + (-1 + 2*S(ss1))*(1 + 2*T)*sqrt(((1 + 2*S(ss1))*(-1 + T + 2*Power(T,2)))/S(ss1)))/((1 + 2*S(ss1))*(1 + 2*T)*sqrt((-1 + S(ss1) + 2*Power(S(ss1),2))*(3 + 5*T + 2*Power(T,2))));
+          case 141: return 1/((1 + 2*T)*sqrt(((1 + S(ss1))*(1 + 2*S(ss1)))/(-3 + 4*T + 4*Power(T,2))));
+          case 142: return (sqrt(S(ss1)/(1 + S(ss1))) + sqrt(S(ss1)/(1 + S(ss1)))*(1 + 2*S(ss1)) + sqrt(S(ss1)*(1 + S(ss1)))*(1 + 2*S(ss1)))/((1 + S(ss1))*sqrt(3 + 8*S(ss1) + 4*Power(S(ss1),2)));
+          case 143: return (2*sqrt(S(ss1)/(1 + S(ss1))) + sqrt(S(ss1)*(1 + S(ss1))) + 2*S(ss1)*(sqrt(S(ss1)/(1 + S(ss1))) + sqrt(S(ss1)*(1 + S(ss1)))))/((1 + S(ss1))*sqrt(3 + 8*S(ss1) + 4*Power(S(ss1),2))*T);
+          case 144: return (3 + 2*S(ss1))/sqrt(((1 + 2*S(ss1))*(3 + 5*S(ss1) + 2*Power(S(ss1),2))*Power(T + 2*Power(T,2),2))/S(ss1));
+          case 145: return (sqrt((S(ss1)*(-1 + T))/((1 + S(ss1))*T)) + (1 + 2*S(ss1))*sqrt((S(ss1)*(-1 + T))/((1 + S(ss1))*T)) + (1 + 2*S(ss1))*sqrt((S(ss1)*(1 + S(ss1))*(-1 + T))/T) - (1 + 2*S(ss1))*sqrt((S(ss1)*(1 + S(ss1)))/((-1 + T)*T))*T + (1 + 2*S(ss1))*sqrt((S(ss1)*(1 + S(ss1)))/((-1 + T)*T))*Power(T,2) + sqrt((S(ss1)*(-1 + T)*T)/(1 + S(ss1))) + (1 + 2*S(ss1))*sqrt((S(ss1)*(-1 + T)*T)/(1 + S(ss1))))/((1 + S(ss1))*sqrt((3 + 8*S(ss1) + 4*Power(S(ss1),2))*T*(1 + T)));
+          case 146: return (2*sqrt((S(ss1)*(-1 + 2*T))/(1 + S(ss1))) + 2*sqrt((Power(S(ss1),3)*(-1 + 2*T))/(1 + S(ss1))) + sqrt(S(ss1)*(1 + S(ss1))*(-1 + 2*T)) + 2*S(ss1)*sqrt(S(ss1)*(1 + S(ss1))*(-1 + 2*T)) + T*(2*sqrt((S(ss1)*(-1 + 2*T))/(1 + S(ss1))) + sqrt(S(ss1)*(1 + S(ss1))*(-1 + 2*T)) + 2*S(ss1)*(sqrt((S(ss1)*(-1 + 2*T))/(1 + S(ss1))) + sqrt(S(ss1)*(1 + S(ss1))*(-1 + 2*T)))))/((1 + S(ss1))*T*(1 + T)*sqrt((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(1 + 2*T)));
+          case 147: return (3*(sqrt((S(ss1)*T*(-1 + 2*T))/((1 + S(ss1))*(1 + 3*T + 2*Power(T,2)))) + sqrt((Power(S(ss1),3)*T*(-1 + 2*T))/((1 + S(ss1))*(1 + 3*T + 2*Power(T,2)))) + sqrt((S(ss1)*T*(-1 + 4*Power(T,2)))/((1 + S(ss1))*(1 + T))) + sqrt((Power(S(ss1),3)*T*(-1 + 4*Power(T,2)))/((1 + S(ss1))*(1 + T))) + sqrt((S(ss1)*T*(-1 - T + 4*Power(T,2) + 4*Power(T,3)))/(1 + S(ss1))) + sqrt((Power(S(ss1),3)*T*(-1 - T + 4*Power(T,2) + 4*Power(T,3)))/(1 + S(ss1)))) + 2*S(ss1)*(sqrt((S(ss1)*(1 + S(ss1))*T*(-1 + 2*T))/(1 + 3*T + 2*Power(T,2))) + sqrt((S(ss1)*(1 + S(ss1))*T*(-1 + 4*Power(T,2)))/(1 + T)) + sqrt(S(ss1)*(1 + S(ss1))*T*(-1 - T + 4*Power(T,2) + 4*Power(T,3)))))/((1 + S(ss1))*sqrt((3 + 8*S(ss1) + 4*Power(S(ss1),2))*T*(3 + 11*T + 12*Power(T,2) + 4*Power(T,3))));
+          case 148: return 1;
+          case 149: return 1/T;
+          case 150: return 1/(T + 2*Power(T,2));
+          case 151: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 152: return 1/(sqrt(S(ss1)*(1 + 2*S(ss1)))*T);
+          case 153: return 1/(sqrt(S(ss1)*(1 + 2*S(ss1)))*T*(1 + 2*T));
+          case 154: return sqrt(-1 + Power(T,2))/T;
+          case 155: return sqrt((-1 + 2*T)/(1 + 2*T))/T;
+          case 156: return 1/(T*sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + Power(T,2))));
+          case 157: return 1/sqrt((S(ss1)*(1 + 2*S(ss1))*Power(T,2)*(1 + 2*T))/(-1 + 2*T));
+          case 158: return (sqrt(T*(1 + T)*(-1 + 2*T)*(1 + 2*T)) + sqrt((T*(-1 + 2*T))/(1 + 3*T + 2*Power(T,2))) + sqrt((T*(-1 + 4*Power(T,2)))/(1 + T)))/sqrt(T*(1 + 2*T)*(3 + 5*T + 2*Power(T,2)));
+          case 159: return (sqrt(T*(1 + T)*(-1 + 2*T)*(1 + 2*T)) + sqrt((T*(-1 + 2*T))/(1 + 3*T + 2*Power(T,2))) + sqrt((T*(-1 + 4*Power(T,2)))/(1 + T)))/sqrt(S(ss1)*(1 + 2*S(ss1))*T*(1 + 2*T)*(3 + 5*T + 2*Power(T,2)));
+          case 160: return (-sqrt(2 + 1/S(ss1)) + sqrt(S(ss1)*(1 + 2*S(ss1))) + 2*sqrt(Power(S(ss1),3)*(1 + 2*S(ss1))))/((1 + 2*S(ss1))*sqrt(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 161: return (-sqrt((2 + 1/S(ss1))*T) + sqrt(S(ss1)*(1 + 2*S(ss1))*T) + 2*S(ss1)*sqrt(S(ss1)*(1 + 2*S(ss1))*T))/((1 + 2*S(ss1))*sqrt(-1 + S(ss1) + 2*Power(S(ss1),2))*Power(T,1.5));
+          case 162: return ((-1 + S(ss1) + 2*Power(S(ss1),2))*(-sqrt(((1 + 2*S(ss1))*T*(1 + 2*T))/S(ss1)) + sqrt(S(ss1)*(1 + 2*S(ss1))*T*(1 + 2*T)) + 2*sqrt(Power(S(ss1),3)*(1 + 2*S(ss1))*T*(1 + 2*T))))/((1 + 2*S(ss1))*Power((-1 + S(ss1) + 2*Power(S(ss1),2))*T*(1 + 2*T),1.5));
+          case 163: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 164: return 1/(sqrt((1 + S(ss1))*(1 + 2*S(ss1)))*T);
+          case 165: return 1/(sqrt(1 + 3*S(ss1) + 2*Power(S(ss1),2))*(T + 2*Power(T,2)));
+          case 166: return (-1 + T)/sqrt((S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*(-1 + T)*(1 + T))/(-1 + 2*S(ss1))) + 1/sqrt((S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*Power(T,2)*(1 + T))/((-1 + 2*S(ss1))*(-1 + T))) + (S(ss1)*(-1 + 2*S(ss1)))/sqrt((S(ss1)*(1 + S(ss1))*(-1 + 4*Power(S(ss1),2))*Power(T,2)*(1 + T))/(-1 + T)) + ((-1 + 2*S(ss1))*(-1 + T)*T)/sqrt(((1 + S(ss1))*(-1 + 4*Power(S(ss1),2))*(-1 + T)*Power(T,2)*(1 + T))/S(ss1));
+          case 167: return (sqrt((-1 + 2*S(ss1))/(1 + S(ss1)))*(sqrt(((1 + 2*S(ss1))*(-1 + 4*Power(T,2)))/S(ss1)) + sqrt(S(ss1)*(1 + 2*S(ss1))*(-1 + 4*Power(T,2)))))/((1 + 2*S(ss1))*T*(1 + 2*T));
+          case 168: return 1/(T*sqrt(((1 + S(ss1))*(1 + 2*S(ss1)))/(-1 + Power(T,2))));
+          case 169: return 1/(T*sqrt(((1 + S(ss1))*(1 + 2*S(ss1))*(1 + 2*T))/(-1 + 2*T)));
+          case 170: return ((-1 + 2*S(ss1))*sqrt(((1 + 2*S(ss1))*(-1 + 2*T))/(S(ss1)*(1 + T))) - sqrt((S(ss1)*(1 + 2*S(ss1))*(-1 + 2*T))/(1 + T)) + 2*sqrt((Power(S(ss1),3)*(1 + 2*S(ss1))*(-1 + 2*T))/(1 + T)) + (-1 + 2*S(ss1))*sqrt(((1 + 2*S(ss1))*(-1 + 2*T))/(S(ss1)*(1 + T)))*(1 + 2*T) - sqrt((S(ss1)*(1 + 2*S(ss1))*(-1 + 2*T))/(1 + T))*(1 + 2*T) + 2*S(ss1)*sqrt((S(ss1)*(1 + 2*S(ss1))*(-1 + 2*T))/(1 + T))*(1 + 2*T) + 2*Power(S(ss1),1.5)*(1 + 2*T)*sqrt((1 + 2*S(ss1))*(-1 + T + 2*Power(T,2))) - S(ss1)*(1 + 2*T)*sqrt(((1 + 2*S(ss1))*(-1 + T + 2*Power(T,2)))/S(ss1)) + (-1 + 2*S(ss1))*(1 + 2*T)*sqrt(((1 + 2*S(ss1))*(-1 + T + 2*Power(T,2)))/S(ss1)))/((1 + 2*S(ss1))*(1 + 2*T)*sqrt((-1 + S(ss1) + 2*Power(S(ss1),2))*(3 + 5*T + 2*Power(T,2))));
+          case 171: return 1/((1 + 2*T)*sqrt(((1 + S(ss1))*(1 + 2*S(ss1)))/(-3 + 4*T + 4*Power(T,2))));
+          case 172: return (sqrt(S(ss1)/(1 + S(ss1))) + sqrt(S(ss1)/(1 + S(ss1)))*(1 + 2*S(ss1)) + sqrt(S(ss1)*(1 + S(ss1)))*(1 + 2*S(ss1)))/((1 + S(ss1))*sqrt(3 + 8*S(ss1) + 4*Power(S(ss1),2)));
+          case 173: return (2*sqrt(S(ss1)/(1 + S(ss1))) + sqrt(S(ss1)*(1 + S(ss1))) + 2*S(ss1)*(sqrt(S(ss1)/(1 + S(ss1))) + sqrt(S(ss1)*(1 + S(ss1)))))/((1 + S(ss1))*sqrt(3 + 8*S(ss1) + 4*Power(S(ss1),2))*T);
+          case 174: return (3 + 2*S(ss1))/sqrt(((1 + 2*S(ss1))*(3 + 5*S(ss1) + 2*Power(S(ss1),2))*Power(T + 2*Power(T,2),2))/S(ss1));
+          case 175: return (sqrt((S(ss1)*(-1 + T))/((1 + S(ss1))*T)) + (1 + 2*S(ss1))*sqrt((S(ss1)*(-1 + T))/((1 + S(ss1))*T)) + (1 + 2*S(ss1))*sqrt((S(ss1)*(1 + S(ss1))*(-1 + T))/T) - (1 + 2*S(ss1))*sqrt((S(ss1)*(1 + S(ss1)))/((-1 + T)*T))*T + (1 + 2*S(ss1))*sqrt((S(ss1)*(1 + S(ss1)))/((-1 + T)*T))*Power(T,2) + sqrt((S(ss1)*(-1 + T)*T)/(1 + S(ss1))) + (1 + 2*S(ss1))*sqrt((S(ss1)*(-1 + T)*T)/(1 + S(ss1))))/((1 + S(ss1))*sqrt((3 + 8*S(ss1) + 4*Power(S(ss1),2))*T*(1 + T)));
+          case 176: return (2*sqrt((S(ss1)*(-1 + 2*T))/(1 + S(ss1))) + 2*sqrt((Power(S(ss1),3)*(-1 + 2*T))/(1 + S(ss1))) + sqrt(S(ss1)*(1 + S(ss1))*(-1 + 2*T)) + 2*S(ss1)*sqrt(S(ss1)*(1 + S(ss1))*(-1 + 2*T)) + T*(2*sqrt((S(ss1)*(-1 + 2*T))/(1 + S(ss1))) + sqrt(S(ss1)*(1 + S(ss1))*(-1 + 2*T)) + 2*S(ss1)*(sqrt((S(ss1)*(-1 + 2*T))/(1 + S(ss1))) + sqrt(S(ss1)*(1 + S(ss1))*(-1 + 2*T)))))/((1 + S(ss1))*T*(1 + T)*sqrt((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(1 + 2*T)));
+          case 177: return (3*(sqrt((S(ss1)*T*(-1 + 2*T))/((1 + S(ss1))*(1 + 3*T + 2*Power(T,2)))) + sqrt((Power(S(ss1),3)*T*(-1 + 2*T))/((1 + S(ss1))*(1 + 3*T + 2*Power(T,2)))) + sqrt((S(ss1)*T*(-1 + 4*Power(T,2)))/((1 + S(ss1))*(1 + T))) + sqrt((Power(S(ss1),3)*T*(-1 + 4*Power(T,2)))/((1 + S(ss1))*(1 + T))) + sqrt((S(ss1)*T*(-1 - T + 4*Power(T,2) + 4*Power(T,3)))/(1 + S(ss1))) + sqrt((Power(S(ss1),3)*T*(-1 - T + 4*Power(T,2) + 4*Power(T,3)))/(1 + S(ss1)))) + 2*S(ss1)*(sqrt((S(ss1)*(1 + S(ss1))*T*(-1 + 2*T))/(1 + 3*T + 2*Power(T,2))) + sqrt((S(ss1)*(1 + S(ss1))*T*(-1 + 4*Power(T,2)))/(1 + T)) + sqrt(S(ss1)*(1 + S(ss1))*T*(-1 - T + 4*Power(T,2) + 4*Power(T,3)))))/((1 + S(ss1))*sqrt((3 + 8*S(ss1) + 4*Power(S(ss1),2))*T*(3 + 11*T + 12*Power(T,2) + 4*Power(T,3))));
+          case 178: return -1;
+          case 179: return -(sqrt(3)/sqrt(-1 + 4*Power(S(ss1),2)));
+          case 180: return (-2*(-1 + Power(S(ss1),2)))/sqrt(1 - 5*Power(S(ss1),2) + 4*Power(S(ss1),4));
+          case 181: return -2/(1 + 2*S(ss1));
+          case 182: return -(sqrt(-3 + 4*S(ss1) + 4*Power(S(ss1),2))/(1 + 2*S(ss1)));
+          case 183: return -((sqrt(3)*(3*sqrt(S(ss1)*(1 + S(ss1))) + 5*sqrt(Power(S(ss1),3)*(1 + S(ss1))) + 2*sqrt(Power(S(ss1),5)*(1 + S(ss1)))))/sqrt(S(ss1)*(1 + 2*S(ss1))*Power(3 + 5*S(ss1) + 2*Power(S(ss1),2),3)));
+          case 184: return -((9*sqrt(S(ss1)/(3 + 2*S(ss1))) + sqrt(S(ss1)*(3 + 2*S(ss1))) + 2*S(ss1)*(3*sqrt(S(ss1)/(3 + 2*S(ss1))) + sqrt(S(ss1)*(3 + 2*S(ss1)))))/((3 + 2*S(ss1))*sqrt(2 + 5*S(ss1) + 2*Power(S(ss1),2))));
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(1, 2, 1));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(1, 2, 1));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -75,10 +824,432 @@ MatrixElements<SC> SymmetrySPSU2T<SC>::recalc_doublet(const DiagInfo<SC> &diag,
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "spsu2t/spsu2t-doubletp0.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {4, 4},
+        {5, 5},
+        {5, 6},
+        {6, 5},
+        {6, 6},
+        {6, 7},
+        {7, 6},
+        {7, 7},
+        {7, 8},
+        {8, 7},
+        {8, 8},
+        {8, 9},
+        {9, 8},
+        {9, 9},
+        {10, 10},
+        {10, 11},
+        {11, 10},
+        {11, 11},
+        {11, 12},
+        {12, 11},
+        {12, 12},
+        {12, 13},
+        {13, 12},
+        {13, 13},
+        {13, 14},
+        {14, 13},
+        {14, 14},
+        {15, 15},
+        {15, 16},
+        {16, 15},
+        {16, 16},
+        {16, 17},
+        {17, 16},
+        {17, 17},
+        {18, 15},
+        {18, 16},
+        {18, 18},
+        {18, 19},
+        {19, 15},
+        {19, 16},
+        {19, 17},
+        {19, 18},
+        {19, 19},
+        {19, 20},
+        {20, 16},
+        {20, 17},
+        {20, 19},
+        {20, 20},
+        {21, 21},
+        {21, 22},
+        {22, 21},
+        {22, 22},
+        {22, 23},
+        {23, 22},
+        {23, 23},
+        {24, 21},
+        {24, 22},
+        {24, 24},
+        {24, 25},
+        {25, 21},
+        {25, 22},
+        {25, 23},
+        {25, 24},
+        {25, 25},
+        {25, 26},
+        {26, 22},
+        {26, 23},
+        {26, 25},
+        {26, 26},
+        {27, 27},
+        {27, 28},
+        {28, 27},
+        {28, 28},
+        {28, 29},
+        {29, 28},
+        {29, 29},
+        {30, 27},
+        {30, 28},
+        {30, 30},
+        {30, 31},
+        {31, 27},
+        {31, 28},
+        {31, 29},
+        {31, 30},
+        {31, 31},
+        {31, 32},
+        {32, 28},
+        {32, 29},
+        {32, 31},
+        {32, 32},
+        {33, 33},
+        {33, 34},
+        {34, 33},
+        {34, 34},
+        {34, 35},
+        {35, 34},
+        {35, 35},
+        {35, 36},
+        {36, 35},
+        {36, 36},
+        {36, 37},
+        {37, 36},
+        {37, 37},
+        {38, 33},
+        {38, 34},
+        {38, 38},
+        {38, 39},
+        {39, 33},
+        {39, 34},
+        {39, 35},
+        {39, 38},
+        {39, 39},
+        {39, 40},
+        {40, 34},
+        {40, 35},
+        {40, 36},
+        {40, 39},
+        {40, 40},
+        {40, 41},
+        {41, 35},
+        {41, 36},
+        {41, 37},
+        {41, 40},
+        {41, 41},
+        {41, 42},
+        {42, 36},
+        {42, 37},
+        {42, 41},
+        {42, 42},
+        {43, 43},
+        {43, 44},
+        {44, 43},
+        {44, 44},
+        {44, 45},
+        {45, 44},
+        {45, 45},
+        {46, 43},
+        {46, 44},
+        {46, 46},
+        {46, 47},
+        {47, 43},
+        {47, 44},
+        {47, 45},
+        {47, 46},
+        {47, 47},
+        {47, 48},
+        {48, 44},
+        {48, 45},
+        {48, 47},
+        {48, 48},
+        {49, 46},
+        {49, 47},
+        {49, 49},
+        {49, 50},
+        {50, 46},
+        {50, 47},
+        {50, 48},
+        {50, 49},
+        {50, 50},
+        {50, 51},
+        {51, 47},
+        {51, 48},
+        {51, 50},
+        {51, 51},
+        {52, 52},
+        {52, 53},
+        {53, 52},
+        {53, 53},
+        {53, 54},
+        {54, 53},
+        {54, 54},
+        {55, 52},
+        {55, 53},
+        {55, 55},
+        {55, 56},
+        {56, 52},
+        {56, 53},
+        {56, 54},
+        {56, 55},
+        {56, 56},
+        {56, 57},
+        {57, 53},
+        {57, 54},
+        {57, 56},
+        {57, 57},
+        {58, 55},
+        {58, 56},
+        {58, 58},
+        {58, 59},
+        {59, 55},
+        {59, 56},
+        {59, 57},
+        {59, 58},
+        {59, 59},
+        {59, 60},
+        {60, 56},
+        {60, 57},
+        {60, 59},
+        {60, 60},
+        {61, 61},
+        {62, 61},
+        {62, 62},
+        {63, 62},
+        {63, 63},
+        {64, 63},
+        {64, 64}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return 1;
+          case 3: return 1;
+          case 4: return 1/sqrt(((-1 + T)*T)/(-2 - T + Power(T,2)));
+          case 5: return sqrt((-6 + 4*T)/(T - 3*Power(T,2) + 2*Power(T,3)));
+          case 6: return -(sqrt(2)/sqrt((-1 + T)*T));
+          case 7: return (-3 + Power(T,2))/(T*sqrt(-1 + Power(T,2)));
+          case 8: return (sqrt(3)*(-3 + T + 2*Power(T,2)))/(T*sqrt((1 + T)*(-3 - 5*T + 4*Power(T,2) + 4*Power(T,3))));
+          case 9: return -((sqrt(3)*(-2*(-1 + T)*Power(T,2.5)*Power(1 + T,1.5)*sqrt(-1 + 2*T)*(3 + 2*T) + 7*(-1 + T)*Power(T*(1 + T),1.5)*sqrt(-1 + 2*T)*(3 + 2*T) - 3*(-1 + T)*Power(1 + T,1.5)*sqrt(T*(-1 + 2*T))*(3 + 2*T) + T*sqrt(T*Power(1 + T,3)*(-1 + 2*T)*Power(3 + 2*T,2)) - 3*Power(T,2)*sqrt(T*Power(1 + T,3)*(-1 + 2*T)*Power(3 + 2*T,2)) + 2*Power(T,3)*sqrt(T*Power(1 + T,3)*(-1 + 2*T)*Power(3 + 2*T,2)) - 2*sqrt((T*(1 + T))/(-1 + 2*T))*(3 - 5*T + 2*Power(T,2))*(-3 + T + 8*Power(T,2) + 4*Power(T,3))))/(sqrt(-1 + T)*Power(1 + T,2)*(-1 + 2*T)*Power(T*(3 + 2*T),1.5)));
+          case 10: return (-3 + T + Power(T,2))/(T*(1 + T));
+          case 11: return (sqrt(3)*sqrt(1 + T)*(6*sqrt(T*(-2 + 3*T + 2*Power(T,2)))*(3 + 5*T + 2*Power(T,2)) - 19*T*sqrt(T*(-2 + 3*T + 2*Power(T,2)))*(3 + 5*T + 2*Power(T,2)) + 12*Power(T,2)*sqrt(T*(-2 + 3*T + 2*Power(T,2)))*(3 + 5*T + 2*Power(T,2)) + 4*Power(T,3)*sqrt(T*(-2 + 3*T + 2*Power(T,2)))*(3 + 5*T + 2*Power(T,2)) + 12*sqrt(T*(2 + T)*Power(-1 + 2*T,3)*Power(3 + 5*T + 2*Power(T,2),2))))/(T*(-2 + 3*T + 2*Power(T,2))*Power(3 + 5*T + 2*Power(T,2),2.5));
+          case 12: return (sqrt(3 + 3/T)*(-6*sqrt((-6 + 5*T + 12*Power(T,2) + 4*Power(T,3))/(1 + 2*T)) - 3*T*sqrt((-6 + 5*T + 12*Power(T,2) + 4*Power(T,3))/(1 + 2*T)) + 6*Power(T,2)*sqrt((-6 + 5*T + 12*Power(T,2) + 4*Power(T,3))/(1 + 2*T)) - 4*T*sqrt(-6 - 7*T + 22*Power(T,2) + 28*Power(T,3) + 8*Power(T,4))))/((2 + T)*Power(3 + 5*T + 2*Power(T,2),1.5));
+          case 13: return (-2 + 2*T + Power(T,2))/((1 + T)*sqrt(T*(2 + T)));
+          case 14: return (sqrt(2)*(45*T*sqrt((T*(3 + 5*T + 2*Power(T,2)))/(5 + 2*T)) + 2*(sqrt((Power(T,3)*Power(1 + T,3)*Power(1 + 2*T,2)*(3 + 2*T))/(5 + 2*T)) + 15*sqrt((T*(3 + 5*T + 2*Power(T,2)))/(5 + 2*T)) + 9*sqrt((Power(T,5)*(3 + 5*T + 2*Power(T,2)))/(5 + 2*T)))))/((1 + T)*sqrt(T*(5 + 2*T))*Power(6 + 7*T + 2*Power(T,2),1.5));
+          case 15: return -((sqrt(2)*(5*sqrt(T*(1 + T)) + 2*sqrt(Power(T,3)*(1 + T))))/((1 + T)*sqrt(T*(5 + 2*T)*(6 + 7*T + 2*Power(T,2)))));
+          case 16: return (3 + T)/sqrt(11 + 6/T + 6*T + Power(T,2));
+          case 17: return 1/sqrt(((-1 + T)*T)/(-2 - T + Power(T,2)));
+          case 18: return sqrt((-6 + 4*T)/(T - 3*Power(T,2) + 2*Power(T,3)));
+          case 19: return -(sqrt(2)/sqrt((-1 + T)*T));
+          case 20: return (-3 + Power(T,2))/(T*sqrt(-1 + Power(T,2)));
+          case 21: return (sqrt(3)*(-3 + T + 2*Power(T,2)))/(T*sqrt((1 + T)*(-3 - 5*T + 4*Power(T,2) + 4*Power(T,3))));
+          case 22: return -((sqrt(3)*(-2*(-1 + T)*Power(T,2.5)*Power(1 + T,1.5)*sqrt(-1 + 2*T)*(3 + 2*T) + 7*(-1 + T)*Power(T*(1 + T),1.5)*sqrt(-1 + 2*T)*(3 + 2*T) - 3*(-1 + T)*Power(1 + T,1.5)*sqrt(T*(-1 + 2*T))*(3 + 2*T) + T*sqrt(T*Power(1 + T,3)*(-1 + 2*T)*Power(3 + 2*T,2)) - 3*Power(T,2)*sqrt(T*Power(1 + T,3)*(-1 + 2*T)*Power(3 + 2*T,2)) + 2*Power(T,3)*sqrt(T*Power(1 + T,3)*(-1 + 2*T)*Power(3 + 2*T,2)) - 2*sqrt((T*(1 + T))/(-1 + 2*T))*(3 - 5*T + 2*Power(T,2))*(-3 + T + 8*Power(T,2) + 4*Power(T,3))))/(sqrt(-1 + T)*Power(1 + T,2)*(-1 + 2*T)*Power(T*(3 + 2*T),1.5)));
+          case 23: return (-3 + T + Power(T,2))/(T*(1 + T));
+          case 24: return (sqrt(3)*sqrt(1 + T)*(6*sqrt(T*(-2 + 3*T + 2*Power(T,2)))*(3 + 5*T + 2*Power(T,2)) - 19*T*sqrt(T*(-2 + 3*T + 2*Power(T,2)))*(3 + 5*T + 2*Power(T,2)) + 12*Power(T,2)*sqrt(T*(-2 + 3*T + 2*Power(T,2)))*(3 + 5*T + 2*Power(T,2)) + 4*Power(T,3)*sqrt(T*(-2 + 3*T + 2*Power(T,2)))*(3 + 5*T + 2*Power(T,2)) + 12*sqrt(T*(2 + T)*Power(-1 + 2*T,3)*Power(3 + 5*T + 2*Power(T,2),2))))/(T*(-2 + 3*T + 2*Power(T,2))*Power(3 + 5*T + 2*Power(T,2),2.5));
+          case 25: return (sqrt(3 + 3/T)*(-6*sqrt((-6 + 5*T + 12*Power(T,2) + 4*Power(T,3))/(1 + 2*T)) - 3*T*sqrt((-6 + 5*T + 12*Power(T,2) + 4*Power(T,3))/(1 + 2*T)) + 6*Power(T,2)*sqrt((-6 + 5*T + 12*Power(T,2) + 4*Power(T,3))/(1 + 2*T)) - 4*T*sqrt(-6 - 7*T + 22*Power(T,2) + 28*Power(T,3) + 8*Power(T,4))))/((2 + T)*Power(3 + 5*T + 2*Power(T,2),1.5));
+          case 26: return (-2 + 2*T + Power(T,2))/((1 + T)*sqrt(T*(2 + T)));
+          case 27: return (sqrt(2)*(45*T*sqrt((T*(3 + 5*T + 2*Power(T,2)))/(5 + 2*T)) + 2*(sqrt((Power(T,3)*Power(1 + T,3)*Power(1 + 2*T,2)*(3 + 2*T))/(5 + 2*T)) + 15*sqrt((T*(3 + 5*T + 2*Power(T,2)))/(5 + 2*T)) + 9*sqrt((Power(T,5)*(3 + 5*T + 2*Power(T,2)))/(5 + 2*T)))))/((1 + T)*sqrt(T*(5 + 2*T))*Power(6 + 7*T + 2*Power(T,2),1.5));
+          case 28: return -((sqrt(2)*(5*sqrt(T*(1 + T)) + 2*sqrt(Power(T,3)*(1 + T))))/((1 + T)*sqrt(T*(5 + 2*T)*(6 + 7*T + 2*Power(T,2)))));
+          case 29: return (3 + T)/sqrt(11 + 6/T + 6*T + Power(T,2));
+          case 30: return (-2*sqrt(S(ss1)*(1 + S(ss1))*(-1 + Power(T,2))))/(T + 2*S(ss1)*T);
+          case 31: return (-2*sqrt((S(ss1)*(1 + S(ss1))*(-1 + 2*T))/(1 + 2*T)))/(T + 2*S(ss1)*T);
+          case 32: return (2*sqrt(S(ss1)*(1 + S(ss1))))/(T + 2*S(ss1)*T);
+          case 33: return (-2*sqrt(S(ss1)*(1 + S(ss1)))*(-1 + T + Power(T,2)))/((1 + 2*S(ss1))*T*(1 + T));
+          case 34: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1) + T + 2*S(ss1)*T);
+          case 35: return (2*(2*sqrt((S(ss1) + 2*S(ss1)*T)/(1 + 2*S(ss1))) + sqrt(S(ss1)/(1 + 2*S(ss1) + 2*T + 4*S(ss1)*T)) - 2*T*sqrt(S(ss1)/(1 + 2*S(ss1) + 2*T + 4*S(ss1)*T))))/((1 + T)*sqrt(((1 + 2*S(ss1))*(3 + 2*T))/(1 + S(ss1))));
+          case 36: return (-2*sqrt(S(ss1)*(1 + S(ss1))*T*(2 + T)))/(1 + 2*S(ss1) + T + 2*S(ss1)*T);
+          case 37: return sqrt(-1 + Power(T,2))/(T + 2*S(ss1)*T);
+          case 38: return sqrt((-1 + 2*T)/(1 + 2*T))/(T + 2*S(ss1)*T);
+          case 39: return -(sqrt(-1 + Power(T,2))/T);
+          case 40: return -(sqrt((-1 + 2*T)/(1 + 2*T))/T);
+          case 41: return -((sqrt(((1 + S(ss1))*T*(1 + T))/(1 + 2*S(ss1))) + 2*S(ss1)*(-(T*sqrt(((1 + S(ss1))*T*(1 + T))/(1 + 2*S(ss1)))) + sqrt(((1 + S(ss1))*Power(T,3)*(1 + T))/(1 + 2*S(ss1)))))/(T*sqrt((1 + S(ss1))*(1 + 2*S(ss1))*T*(1 + T))));
+          case 42: return (-1 + T + Power(T,2))/((1 + 2*S(ss1))*T*(1 + T));
+          case 43: return 1/(1 + 2*S(ss1) + T + 2*S(ss1)*T);
+          case 44: return 1/T;
+          case 45: return -(((Power(1 + S(ss1),1.5)*Power(T,2.5)*(1 + T))/sqrt(3 + 2*S(ss1)) + (2*Power(1 + S(ss1),1.5)*Power(T,2.5)*(1 + T))/((1 + 2*S(ss1))*sqrt(3 + 2*S(ss1))) - T*sqrt((Power(1 + S(ss1),3)*T*Power(1 + T,2))/(3 + 2*S(ss1))) - 2*T*sqrt((Power(1 + S(ss1),3)*T*Power(1 + T,2))/(Power(1 + 2*S(ss1),2)*(3 + 2*S(ss1)))) + sqrt((Power(1 + S(ss1),3)*T*Power(-1 + T + 2*Power(T,2),2))/(3 + 2*S(ss1))) + 2*sqrt((Power(1 + S(ss1),3)*T*Power(-1 + T + 2*Power(T,2),2))/(Power(1 + 2*S(ss1),2)*(3 + 2*S(ss1)))))/sqrt((Power(1 + S(ss1),3)*(3 + 2*S(ss1))*Power(T,3)*Power(1 + T,4))/Power(1 + 2*S(ss1),2)));
+          case 46: return -(1/(1 + T));
+          case 47: return -(sqrt((3 + 2*T)/(1 + 2*T))/(1 + 2*S(ss1) + T + 2*S(ss1)*T));
+          case 48: return ((1 + S(ss1))*(2*Power(T,2)*sqrt(((1 + S(ss1))*T*(3 + 5*T + 2*Power(T,2)))/(2 + T)) + 6*S(ss1)*(sqrt(((1 + S(ss1))*T*(3 + 2*T))/(2 + 3*T + Power(T,2))) + T*sqrt(((1 + S(ss1))*T*(3 + 2*T))/(2 + 3*T + Power(T,2))) - sqrt(((1 + S(ss1))*T*(3 + 5*T + 2*Power(T,2)))/(2 + T))) + 3*(sqrt(((1 + S(ss1))*T*(3 + 2*T))/(2 + 3*T + Power(T,2))) + sqrt(((1 + S(ss1))*T*(3 + 5*T + 2*Power(T,2)))/(2 + T))) + T*(3*sqrt(((1 + S(ss1))*T*(3 + 2*T))/(2 + 3*T + Power(T,2))) + 7*sqrt(((1 + S(ss1))*T*(3 + 5*T + 2*Power(T,2)))/(2 + T)))))/((1 + 2*S(ss1))*Power((1 + S(ss1))*(1 + T)*(3 + 2*T),1.5));
+          case 49: return (2*sqrt((Power(1 + S(ss1),3)*T*Power(1 + T,2)*Power(3 + 2*T,3))/((1 + 2*S(ss1))*(1 + 2*T))) + sqrt((Power(1 + S(ss1),3)*(1 + 2*S(ss1))*T*Power(1 + T,2)*Power(3 + 2*T,3))/(1 + 2*T)) + 2*sqrt((Power(1 + S(ss1),3)*T*Power(1 + T,4)*Power(3 + 2*T,3))/((1 + 2*S(ss1))*(1 + 2*T))) + sqrt((Power(1 + S(ss1),3)*(1 + 2*S(ss1))*T*Power(1 + T,4)*Power(3 + 2*T,3))/(1 + 2*T)) - 2*sqrt((Power(1 + S(ss1),3)*T*Power(3 + 2*T,3)*Power(-1 + T + 2*Power(T,2),2))/((1 + 2*S(ss1))*Power(1 + 2*T,3))) - sqrt((Power(1 + S(ss1),3)*(1 + 2*S(ss1))*T*Power(3 + 2*T,3)*Power(-1 + T + 2*Power(T,2),2))/Power(1 + 2*T,3)) - T*(2*sqrt((Power(1 + S(ss1),3)*T*Power(1 + T,2)*Power(3 + 2*T,3))/((1 + 2*S(ss1))*(1 + 2*T))) + sqrt((Power(1 + S(ss1),3)*(1 + 2*S(ss1))*T*Power(1 + T,2)*Power(3 + 2*T,3))/(1 + 2*T))))/sqrt((Power(1 + S(ss1),3)*Power(3 + 2*S(ss1),2)*T*Power(3 + 5*T + 2*Power(T,2),4))/((1 + 2*S(ss1))*Power(1 + 2*T,2)));
+          case 50: return -((2*sqrt((Power(1 + S(ss1),3)*(1 + 2*S(ss1))*T*(1 + T)*Power(3 + 2*T,3))/((3 + 2*S(ss1))*(2 + T))) + 4*sqrt((Power(1 + S(ss1),3)*T*(1 + T)*Power(3 + 2*T,3))/((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(2 + T))) + 3*sqrt((Power(1 + S(ss1),3)*(1 + 2*S(ss1))*T*(1 + T)*Power(3 + 2*T,3))/((3 + 2*S(ss1))*(2 + T)*Power(1 + 2*T,2))) + (6*(1 + S(ss1))*(1 + T)*(3 + 2*T)*sqrt(((1 + S(ss1))*T*(3 + 2*T))/((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(2 + 3*T + Power(T,2)))))/(1 + 2*T) + sqrt((Power(1 + S(ss1),3)*(1 + 2*S(ss1))*T*Power(3 + 5*T + 2*Power(T,2),3))/((3 + 2*S(ss1))*(2 + T))) + 2*sqrt((Power(1 + S(ss1),3)*T*Power(3 + 5*T + 2*Power(T,2),3))/((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(2 + T))))/sqrt((Power(1 + S(ss1),3)*(3 + 2*S(ss1))*Power(1 + T,3)*Power(3 + 2*T,5))/((1 + 2*S(ss1))*Power(1 + 2*T,2))));
+          case 51: return (-2*sqrt(S(ss1)*(1 + S(ss1))*(-1 + Power(T,2))))/(T + 2*S(ss1)*T);
+          case 52: return (-2*sqrt((S(ss1)*(1 + S(ss1))*(-1 + 2*T))/(1 + 2*T)))/(T + 2*S(ss1)*T);
+          case 53: return (2*sqrt(S(ss1)*(1 + S(ss1))))/(T + 2*S(ss1)*T);
+          case 54: return (-2*sqrt(S(ss1)*(1 + S(ss1)))*(-1 + T + Power(T,2)))/((1 + 2*S(ss1))*T*(1 + T));
+          case 55: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1) + T + 2*S(ss1)*T);
+          case 56: return (2*(3*sqrt(S(ss1)/(1 + 2*S(ss1) + 2*T + 4*S(ss1)*T)) + T*(sqrt((S(ss1) + 2*S(ss1)*T)/(1 + 2*S(ss1))) + 4*sqrt(S(ss1)/(1 + 2*S(ss1) + 2*T + 4*S(ss1)*T)))))/(Power(1 + T,2)*sqrt(((1 + 2*S(ss1))*(3 + 2*T))/(1 + S(ss1))));
+          case 57: return (-2*sqrt(S(ss1)*(1 + S(ss1))*T*(2 + T)))/(1 + 2*S(ss1) + T + 2*S(ss1)*T);
+          case 58: return sqrt(-1 + Power(T,2))/(T + 2*S(ss1)*T);
+          case 59: return sqrt((-1 + 2*T)/(1 + 2*T))/(T + 2*S(ss1)*T);
+          case 60: return -(sqrt(-1 + Power(T,2))/T);
+          case 61: return -(sqrt((-1 + 2*T)/(1 + 2*T))/T);
+          case 62: return -((sqrt(((1 + S(ss1))*T*(1 + T))/(1 + 2*S(ss1))) + 2*S(ss1)*(-(T*sqrt(((1 + S(ss1))*T*(1 + T))/(1 + 2*S(ss1)))) + sqrt(((1 + S(ss1))*Power(T,3)*(1 + T))/(1 + 2*S(ss1)))))/(T*sqrt((1 + S(ss1))*(1 + 2*S(ss1))*T*(1 + T))));
+          case 63: return (-1 + T + Power(T,2))/((1 + 2*S(ss1))*T*(1 + T));
+          case 64: return 1/(1 + 2*S(ss1) + T + 2*S(ss1)*T);
+          case 65: return 1/T;
+          case 66: return -((-1 + T + Power(T,2))/(T*(1 + T)));
+          case 67: return -(1/(1 + T));
+          case 68: return -(sqrt((3 + 2*T)/(1 + 2*T))/(1 + 2*S(ss1) + T + 2*S(ss1)*T));
+          case 69: return ((1 + S(ss1))*(2*Power(T,2)*sqrt(((1 + S(ss1))*T*(3 + 5*T + 2*Power(T,2)))/(2 + T)) + 6*S(ss1)*(sqrt(((1 + S(ss1))*T*(3 + 2*T))/(2 + 3*T + Power(T,2))) + T*sqrt(((1 + S(ss1))*T*(3 + 2*T))/(2 + 3*T + Power(T,2))) - sqrt(((1 + S(ss1))*T*(3 + 5*T + 2*Power(T,2)))/(2 + T))) + 3*(sqrt(((1 + S(ss1))*T*(3 + 2*T))/(2 + 3*T + Power(T,2))) + sqrt(((1 + S(ss1))*T*(3 + 5*T + 2*Power(T,2)))/(2 + T))) + T*(3*sqrt(((1 + S(ss1))*T*(3 + 2*T))/(2 + 3*T + Power(T,2))) + 7*sqrt(((1 + S(ss1))*T*(3 + 5*T + 2*Power(T,2)))/(2 + T)))))/((1 + 2*S(ss1))*Power((1 + S(ss1))*(1 + T)*(3 + 2*T),1.5));
+          case 70: return sqrt((3 + 2*T)/(1 + 2*T))/(1 + T);
+          case 71: return -(sqrt(((1 + 2*S(ss1))*Power(1 + 2*T,2))/(Power(1 + S(ss1),3)*(3 + 2*S(ss1))*Power(1 + T,3)*Power(3 + 2*T,5)))*(2*sqrt((Power(1 + S(ss1),3)*(1 + 2*S(ss1))*T*(1 + T)*Power(3 + 2*T,3))/((3 + 2*S(ss1))*(2 + T))) + 3*sqrt((Power(1 + S(ss1),3)*(1 + 2*S(ss1))*T*(1 + T)*Power(3 + 2*T,3))/((3 + 2*S(ss1))*(2 + T)*Power(1 + 2*T,2))) + 4/sqrt(((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(2 + T))/(Power(1 + S(ss1),3)*Power(3 + 2*T,3)*(T + Power(T,2)))) + (6*(1 + S(ss1))*(1 + T)*(3 + 2*T)*sqrt(((1 + S(ss1))*T*(3 + 2*T))/((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(2 + 3*T + Power(T,2)))))/(1 + 2*T) + 2/sqrt(((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(2 + T))/(Power(1 + S(ss1),3)*T*Power(3 + 5*T + 2*Power(T,2),3))) + 1/sqrt(((3 + 2*S(ss1))*(2 + T))/(Power(1 + S(ss1),3)*(T + 2*S(ss1)*T)*Power(3 + 5*T + 2*Power(T,2),3)))));
+          case 72: return (-2*sqrt(S(ss1)*(1 + S(ss1))*(-1 + Power(T,2))))/(T + 2*S(ss1)*T);
+          case 73: return (-2*sqrt((S(ss1)*(1 + S(ss1))*(-1 + 2*T))/(1 + 2*T)))/(T + 2*S(ss1)*T);
+          case 74: return (2*sqrt(S(ss1)*(1 + S(ss1))))/(T + 2*S(ss1)*T);
+          case 75: return (-2*sqrt(S(ss1)*(1 + S(ss1)))*(-1 + T + Power(T,2)))/((1 + 2*S(ss1))*T*(1 + T));
+          case 76: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1) + T + 2*S(ss1)*T);
+          case 77: return (2*(2*sqrt((S(ss1) + 2*S(ss1)*T)/(1 + 2*S(ss1))) + sqrt(S(ss1)/(1 + 2*S(ss1) + 2*T + 4*S(ss1)*T)) - 2*T*sqrt(S(ss1)/(1 + 2*S(ss1) + 2*T + 4*S(ss1)*T))))/((1 + T)*sqrt(((1 + 2*S(ss1))*(3 + 2*T))/(1 + S(ss1))));
+          case 78: return (-2*sqrt(S(ss1)*(1 + S(ss1))*T*(2 + T)))/(1 + 2*S(ss1) + T + 2*S(ss1)*T);
+          case 79: return sqrt(-1 + Power(T,2))/(T + 2*S(ss1)*T);
+          case 80: return sqrt((-1 + 2*T)/(1 + 2*T))/(T + 2*S(ss1)*T);
+          case 81: return -(sqrt(-1 + Power(T,2))/T);
+          case 82: return -(sqrt((-1 + 2*T)/(1 + 2*T))/T);
+          case 83: return -((sqrt(((1 + S(ss1))*T*(1 + T))/(1 + 2*S(ss1))) + 2*S(ss1)*(-(T*sqrt(((1 + S(ss1))*T*(1 + T))/(1 + 2*S(ss1)))) + sqrt(((1 + S(ss1))*Power(T,3)*(1 + T))/(1 + 2*S(ss1)))))/(T*sqrt((1 + S(ss1))*(1 + 2*S(ss1))*T*(1 + T))));
+          case 84: return (-1 + T + Power(T,2))/((1 + 2*S(ss1))*T*(1 + T));
+          case 85: return 1/(1 + 2*S(ss1) + T + 2*S(ss1)*T);
+          case 86: return 1/T;
+          case 87: return -(((Power(1 + S(ss1),1.5)*Power(T,2.5)*(1 + T))/sqrt(3 + 2*S(ss1)) + (2*Power(1 + S(ss1),1.5)*Power(T,2.5)*(1 + T))/((1 + 2*S(ss1))*sqrt(3 + 2*S(ss1))) - T*sqrt((Power(1 + S(ss1),3)*T*Power(1 + T,2))/(3 + 2*S(ss1))) - 2*T*sqrt((Power(1 + S(ss1),3)*T*Power(1 + T,2))/(Power(1 + 2*S(ss1),2)*(3 + 2*S(ss1)))) + sqrt((Power(1 + S(ss1),3)*T*Power(-1 + T + 2*Power(T,2),2))/(3 + 2*S(ss1))) + 2*sqrt((Power(1 + S(ss1),3)*T*Power(-1 + T + 2*Power(T,2),2))/(Power(1 + 2*S(ss1),2)*(3 + 2*S(ss1)))))/sqrt((Power(1 + S(ss1),3)*(3 + 2*S(ss1))*Power(T,3)*Power(1 + T,4))/Power(1 + 2*S(ss1),2)));
+          case 88: return -(1/(1 + T));
+          case 89: return -(sqrt((3 + 2*T)/(1 + 2*T))/(1 + 2*S(ss1) + T + 2*S(ss1)*T));
+          case 90: return ((1 + S(ss1))*(2*Power(T,2)*sqrt(((1 + S(ss1))*T*(3 + 5*T + 2*Power(T,2)))/(2 + T)) + 6*S(ss1)*(sqrt(((1 + S(ss1))*T*(3 + 2*T))/(2 + 3*T + Power(T,2))) + T*sqrt(((1 + S(ss1))*T*(3 + 2*T))/(2 + 3*T + Power(T,2))) - sqrt(((1 + S(ss1))*T*(3 + 5*T + 2*Power(T,2)))/(2 + T))) + 3*(sqrt(((1 + S(ss1))*T*(3 + 2*T))/(2 + 3*T + Power(T,2))) + sqrt(((1 + S(ss1))*T*(3 + 5*T + 2*Power(T,2)))/(2 + T))) + T*(3*sqrt(((1 + S(ss1))*T*(3 + 2*T))/(2 + 3*T + Power(T,2))) + 7*sqrt(((1 + S(ss1))*T*(3 + 5*T + 2*Power(T,2)))/(2 + T)))))/((1 + 2*S(ss1))*Power((1 + S(ss1))*(1 + T)*(3 + 2*T),1.5));
+          case 91: return (2*sqrt((Power(1 + S(ss1),3)*T*Power(1 + T,2)*Power(3 + 2*T,3))/((1 + 2*S(ss1))*(1 + 2*T))) + sqrt((Power(1 + S(ss1),3)*(1 + 2*S(ss1))*T*Power(1 + T,2)*Power(3 + 2*T,3))/(1 + 2*T)) + 2*sqrt((Power(1 + S(ss1),3)*T*Power(1 + T,4)*Power(3 + 2*T,3))/((1 + 2*S(ss1))*(1 + 2*T))) + sqrt((Power(1 + S(ss1),3)*(1 + 2*S(ss1))*T*Power(1 + T,4)*Power(3 + 2*T,3))/(1 + 2*T)) - 2*sqrt((Power(1 + S(ss1),3)*T*Power(3 + 2*T,3)*Power(-1 + T + 2*Power(T,2),2))/((1 + 2*S(ss1))*Power(1 + 2*T,3))) - sqrt((Power(1 + S(ss1),3)*(1 + 2*S(ss1))*T*Power(3 + 2*T,3)*Power(-1 + T + 2*Power(T,2),2))/Power(1 + 2*T,3)) - T*(2*sqrt((Power(1 + S(ss1),3)*T*Power(1 + T,2)*Power(3 + 2*T,3))/((1 + 2*S(ss1))*(1 + 2*T))) + sqrt((Power(1 + S(ss1),3)*(1 + 2*S(ss1))*T*Power(1 + T,2)*Power(3 + 2*T,3))/(1 + 2*T))))/sqrt((Power(1 + S(ss1),3)*Power(3 + 2*S(ss1),2)*T*Power(3 + 5*T + 2*Power(T,2),4))/((1 + 2*S(ss1))*Power(1 + 2*T,2)));
+          case 92: return -((2*sqrt((Power(1 + S(ss1),3)*(1 + 2*S(ss1))*T*(1 + T)*Power(3 + 2*T,3))/((3 + 2*S(ss1))*(2 + T))) + 4*sqrt((Power(1 + S(ss1),3)*T*(1 + T)*Power(3 + 2*T,3))/((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(2 + T))) + 3*sqrt((Power(1 + S(ss1),3)*(1 + 2*S(ss1))*T*(1 + T)*Power(3 + 2*T,3))/((3 + 2*S(ss1))*(2 + T)*Power(1 + 2*T,2))) + (6*(1 + S(ss1))*(1 + T)*(3 + 2*T)*sqrt(((1 + S(ss1))*T*(3 + 2*T))/((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(2 + 3*T + Power(T,2)))))/(1 + 2*T) + sqrt((Power(1 + S(ss1),3)*(1 + 2*S(ss1))*T*Power(3 + 5*T + 2*Power(T,2),3))/((3 + 2*S(ss1))*(2 + T))) + 2*sqrt((Power(1 + S(ss1),3)*T*Power(3 + 5*T + 2*Power(T,2),3))/((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(2 + T))))/sqrt((Power(1 + S(ss1),3)*(3 + 2*S(ss1))*Power(1 + T,3)*Power(3 + 2*T,5))/((1 + 2*S(ss1))*Power(1 + 2*T,2))));
+          case 93: return (-2*sqrt((S(ss1)*(1 + S(ss1))*(-2 + T)*(1 + T))/((-1 + T)*T)))/(1 + 2*S(ss1));
+          case 94: return -2*sqrt(2)*sqrt(((S(ss1) + Power(S(ss1),2))*(-3 + 2*T))/(Power(1 + 2*S(ss1),2)*(T - 3*Power(T,2) + 2*Power(T,3))));
+          case 95: return (-2*sqrt(2)*(-sqrt((S(ss1)*T*(1 + T))/(1 + 2*S(ss1))) + sqrt((S(ss1)*(1 + T))/(T + 2*S(ss1)*T)) + sqrt((S(ss1)*Power(-2 + T,2)*(1 + T))/(T + 2*S(ss1)*T))))/sqrt(((1 + 2*S(ss1))*(-1 + Power(T,2)))/(1 + S(ss1)));
+          case 96: return (-2*(-3 + Power(T,2))*sqrt((S(ss1)*(1 + S(ss1)))/(-1 + Power(T,2))))/(T + 2*S(ss1)*T);
+          case 97: return (-2*sqrt(3)*(-3 + T + 2*Power(T,2))*sqrt((S(ss1)*(1 + S(ss1)))/(Power(1 + 2*S(ss1),2)*(-1 + Power(T,2))*(3 + 8*T + 4*Power(T,2)))))/T;
+          case 98: return (2*sqrt(3)*sqrt(((1 + S(ss1))*(1 + T))/(T + 2*S(ss1)*T))*(3*T*sqrt((S(ss1)*(-1 + T + 2*Power(T,2)))/((1 + 2*S(ss1))*(-1 + T)*T)) - 7*Power(T,2)*sqrt((S(ss1)*(-1 + T + 2*Power(T,2)))/((1 + 2*S(ss1))*(-1 + T)*T)) + 4*Power(T,4)*sqrt((S(ss1)*(-1 + T + 2*Power(T,2)))/((1 + 2*S(ss1))*(-1 + T)*T)) + 15*sqrt((S(ss1)*T*(1 - 2*T - Power(T,2) + 2*Power(T,3)))/(1 + 2*S(ss1))) - 4*sqrt((S(ss1)*Power(T,5)*(1 - 2*T - Power(T,2) + 2*Power(T,3)))/(1 + 2*S(ss1))) + 9*sqrt((S(ss1)*(1 - 2*T - Power(T,2) + 2*Power(T,3)))/(T + 2*S(ss1)*T))))/((-1 + 2*T)*Power(3 + 5*T + 2*Power(T,2),1.5));
+          case 99: return (2*(15*sqrt((S(ss1)*T*(3 + 2*T))/(1 + 2*S(ss1))) + 11*sqrt((S(ss1)*Power(T,3)*(3 + 2*T))/(1 + 2*S(ss1))) - 8*sqrt((S(ss1)*Power(T,5)*(3 + 2*T))/(1 + 2*S(ss1))) - 4*sqrt((S(ss1)*Power(T,7)*(3 + 2*T))/(1 + 2*S(ss1))) - 9*sqrt((S(ss1)*(3 + 2*T))/(T + 2*S(ss1)*T))))/((-1 + 2*T)*sqrt((T + 2*S(ss1)*T)/(1 + S(ss1) + T + S(ss1)*T))*Power(3 + 5*T + 2*Power(T,2),1.5));
+          case 100: return (-2*sqrt(3)*sqrt((S(ss1)*(1 + S(ss1))*T*(-2 + 3*T + 2*Power(T,2)))/(Power(1 + T,2)*(3 + 2*T))))/(T + 2*S(ss1)*T);
+          case 101: return (-2*sqrt(3)*sqrt(((1 + S(ss1))*(1 + T))/(T + 2*S(ss1)*T))*(-6*sqrt((S(ss1)*(-2 + 3*T + 2*Power(T,2)))/((1 + 2*S(ss1))*(1 + 3*T + 2*Power(T,2)))) + 2*Power(T,3)*sqrt((S(ss1)*(2 + 5*T + 2*Power(T,2)))/((1 + 2*S(ss1))*(-1 + T + 2*Power(T,2)))) + Power(T,2)*(6*sqrt((S(ss1)*(-2 + 3*T + 2*Power(T,2)))/((1 + 2*S(ss1))*(1 + 3*T + 2*Power(T,2)))) - 7*sqrt((S(ss1)*(2 + 5*T + 2*Power(T,2)))/((1 + 2*S(ss1))*(-1 + T + 2*Power(T,2)))) - 2*sqrt((S(ss1)*(2 + 7*T + 7*Power(T,2) + 2*Power(T,3)))/((1 + 2*S(ss1))*(-1 + 2*T)))) + T*(-3*sqrt((S(ss1)*(-2 + 3*T + 2*Power(T,2)))/((1 + 2*S(ss1))*(1 + 3*T + 2*Power(T,2)))) + 3*sqrt((S(ss1)*(2 + 5*T + 2*Power(T,2)))/((1 + 2*S(ss1))*(-1 + T + 2*Power(T,2)))) + sqrt((S(ss1)*(2 + 7*T + 7*Power(T,2) + 2*Power(T,3)))/((1 + 2*S(ss1))*(-1 + 2*T))))))/(6 + 13*T + 9*Power(T,2) + 2*Power(T,3));
+          case 102: return (2*sqrt((S(ss1)*(1 + S(ss1)))/Power(1 + 2*S(ss1),2))*(12*sqrt(T*(3 + 2*T)) + 2*sqrt(Power(T,3)*(3 + 2*T)) - 16*sqrt(Power(T,5)*(3 + 2*T)) - 11*sqrt(Power(T,7)*(3 + 2*T)) - 2*sqrt(Power(T,9)*(3 + 2*T))))/(T*(1 + T)*Power(6 + 7*T + 2*Power(T,2),1.5));
+          case 103: return (-2*sqrt(2)*sqrt(((1 + S(ss1))*(1 + T))/(T + 2*S(ss1)*T))*(150*sqrt((S(ss1)*T)/(2 + 4*S(ss1) + T + 2*S(ss1)*T)) + 295*sqrt((S(ss1)*Power(T,3))/(2 + 4*S(ss1) + T + 2*S(ss1)*T)) + 214*sqrt((S(ss1)*Power(T,5))/(2 + 4*S(ss1) + T + 2*S(ss1)*T)) + 68*sqrt((S(ss1)*Power(T,7))/(2 + 4*S(ss1) + T + 2*S(ss1)*T)) + 8*sqrt((S(ss1)*Power(T,9))/(2 + 4*S(ss1) + T + 2*S(ss1)*T))))/(Power(5 + 2*T,2)*(6 + 13*T + 9*Power(T,2) + 2*Power(T,3)));
+          case 104: return 2*sqrt(2)*(5 + 2*T)*sqrt((S(ss1)*(1 + S(ss1)))/(Power(1 + 2*S(ss1),2)*(5 + 7*T + 2*Power(T,2))*(6 + 7*T + 2*Power(T,2))));
+          case 105: return (-2*sqrt((1 + S(ss1))/((1 + 2*S(ss1))*(30 + 47*T + 24*Power(T,2) + 4*Power(T,3))))*(4*(1 + 2*T)*sqrt((S(ss1)*T*(3 + 5*T + 2*Power(T,2)))/((1 + 2*S(ss1))*(15 + 11*T + 2*Power(T,2)))) + (2 + T)*(1 + 2*T)*sqrt((S(ss1)*T*(3 + 5*T + 2*Power(T,2)))/((1 + 2*S(ss1))*(15 + 11*T + 2*Power(T,2)))) + 18*(1 + 2*T)*sqrt((S(ss1)*T*(1 + T))/((1 + 2*S(ss1))*(45 + 63*T + 28*Power(T,2) + 4*Power(T,3)))) + 30*sqrt((S(ss1)*T)/((1 + 2*S(ss1))*(45 + 108*T + 91*Power(T,2) + 32*Power(T,3) + 4*Power(T,4)))) + 24*(1 + 2*T)*sqrt((S(ss1)*T)/((1 + 2*S(ss1))*(45 + 108*T + 91*Power(T,2) + 32*Power(T,3) + 4*Power(T,4))))))/(2 + T);
+          case 106: return 1/((1 + 2*S(ss1))*sqrt(((-1 + T)*T)/(-2 - T + Power(T,2))));
+          case 107: return sqrt((-6 + 4*T)/(T - 3*Power(T,2) + 2*Power(T,3)))/(1 + 2*S(ss1));
+          case 108: return -(1/sqrt(((-1 + T)*T)/(-2 - T + Power(T,2))));
+          case 109: return -sqrt((-6 + 4*T)/(T - 3*Power(T,2) + 2*Power(T,3)));
+          case 110: return -(sqrt(2)/((1 + 2*S(ss1))*sqrt((-1 + T)*T)));
+          case 111: return (-3 + Power(T,2))/((T + 2*S(ss1)*T)*sqrt(-1 + Power(T,2)));
+          case 112: return (sqrt(3)*(-3 + T + 2*Power(T,2)))/((T + 2*S(ss1)*T)*sqrt(-3 - 8*T - Power(T,2) + 8*Power(T,3) + 4*Power(T,4)));
+          case 113: return sqrt(2)/sqrt((-1 + T)*T);
+          case 114: return (3 - Power(T,2))/(T*sqrt(-1 + Power(T,2)));
+          case 115: return -((sqrt(3)*(-3 + T + 2*Power(T,2)))/(T*sqrt((1 + T)*(-3 - 5*T + 4*Power(T,2) + 4*Power(T,3)))));
+          case 116: return -((sqrt(3)*(-3 + T + 2*Power(T,2)))/((T + 2*S(ss1)*T)*sqrt((1 + T)*(3 - 7*T + 4*Power(T,3)))));
+          case 117: return (-3 + T + Power(T,2))/((1 + T)*(T + 2*S(ss1)*T));
+          case 118: return sqrt(3)*sqrt((1 + S(ss1))*(1 + T))*((-24*S(ss1)*sqrt((-1 + 2*T)/((1 + S(ss1))*T*(2 + T)*Power(3 + 5*T + 2*Power(T,2),3))))/(1 + 2*S(ss1)) + (2*(-1 + T)*T*(-1 + 2*T))/(sqrt((1 + S(ss1))*T*(-2 + 3*T + 2*Power(T,2)))*Power(3 + 5*T + 2*Power(T,2),1.5)) + (12*sqrt((-1 + 2*T)/((1 + S(ss1))*T*(6 + 13*T + 9*Power(T,2) + 2*Power(T,3)))))/(3 + 5*T + 2*Power(T,2)) + (3*(-2 + 3*T)*sqrt((-1 + 2*T)/((1 + S(ss1))*T*(6 + 13*T + 9*Power(T,2) + 2*Power(T,3)))))/(3 + 5*T + 2*Power(T,2)) - (4*S(ss1)*(-1 + T)*T*(-1 + 2*T))/((1 + 2*S(ss1))*(3 + 5*T + 2*Power(T,2))*sqrt((1 + S(ss1))*T*(-6 - T + 17*Power(T,2) + 16*Power(T,3) + 4*Power(T,4)))) - (6*S(ss1)*(-1 + 2*T)*(-2 + 3*T))/((1 + 2*S(ss1))*(3 + 5*T + 2*Power(T,2))*sqrt((1 + S(ss1))*T*(-6 - T + 17*Power(T,2) + 16*Power(T,3) + 4*Power(T,4)))));
+          case 119: return (sqrt(3)*(-3 + T + 2*Power(T,2)))/(T*sqrt((1 + T)*(3 - 7*T + 4*Power(T,3))));
+          case 120: return -((-3 + T + Power(T,2))/(T*(1 + T)));
+          case 121: return sqrt(3)*sqrt((1 + S(ss1))*(1 + T))*((-2*(1 + 2*S(ss1))*(-1 + T)*T*(-1 + 2*T))/((3 + 2*S(ss1))*sqrt((1 + S(ss1))*T*(-2 + 3*T + 2*Power(T,2)))*Power(3 + 5*T + 2*Power(T,2),1.5)) - (3*(1 + 2*S(ss1))*(-1 + 2*T)*(-2 + 3*T))/((3 + 2*S(ss1))*sqrt((1 + S(ss1))*T*(-2 + 3*T + 2*Power(T,2)))*Power(3 + 5*T + 2*Power(T,2),1.5)) - 24/sqrt(((1 + S(ss1))*Power(3 + 2*S(ss1),2)*T*(2 + T)*Power(3 + 5*T + 2*Power(T,2),3))/(-1 + 2*T)) - (12*(1 + 2*S(ss1))*sqrt((-1 + 2*T)/((1 + S(ss1))*T*(6 + 13*T + 9*Power(T,2) + 2*Power(T,3)))))/((3 + 2*S(ss1))*(3 + 5*T + 2*Power(T,2))) - (4*(-1 + T)*T*(-1 + 2*T))/((3 + 2*S(ss1))*(3 + 5*T + 2*Power(T,2))*sqrt((1 + S(ss1))*T*(-6 - T + 17*Power(T,2) + 16*Power(T,3) + 4*Power(T,4)))) - (6*(-1 + 2*T)*(-2 + 3*T))/((3 + 2*S(ss1))*(3 + 5*T + 2*Power(T,2))*sqrt((1 + S(ss1))*T*(-6 - T + 17*Power(T,2) + 16*Power(T,3) + 4*Power(T,4)))));
+          case 122: return sqrt(3)*sqrt((1 + S(ss1))*(1 + T))*(T*(3 - 7*T + 2*Power(T,2))*sqrt((1 + 2*T)/((1 + S(ss1))*T*Power(1 + T,3)*Power(3 + 2*T,2)*(-2 + 3*T + 2*Power(T,2)))) - 2*T*(3 - 7*T + 2*Power(T,2))*sqrt((Power(S(ss1),2)*(1 + 2*T))/((1 + S(ss1))*Power(1 + 2*S(ss1),2)*T*Power(1 + T,3)*Power(3 + 2*T,2)*(-2 + 3*T + 2*Power(T,2)))) + 6*sqrt((Power(-1 + T,2)*(-1 + 2*T))/((1 + S(ss1))*T*Power(1 + T,3)*Power(3 + 2*T,2)*(2 + 5*T + 2*Power(T,2)))) + (2*S(ss1)*T*(-1 + 2*T))/((1 + 2*S(ss1))*sqrt(((1 + S(ss1))*T*Power(3 + 2*T,2)*(-2 + T + 5*Power(T,2) + 2*Power(T,3)))/(1 + 2*T))) + (T - 2*Power(T,2))/sqrt(((1 + S(ss1))*T*Power(3 + 2*T,2)*(-2 + T + 5*Power(T,2) + 2*Power(T,3)))/(1 + 2*T)) + (3*(-3 + 2*T)*sqrt((T*(-1 + 2*T))/((1 + S(ss1))*(2 + 7*T + 7*Power(T,2) + 2*Power(T,3)))))/(3 + 5*T + 2*Power(T,2)) - (12*S(ss1)*(-1 + T)*sqrt((-1 + 2*T)/((1 + S(ss1))*T*Power(3 + 2*T,2)*(2 + 7*T + 7*Power(T,2) + 2*Power(T,3)))))/((1 + 2*S(ss1))*(1 + T)) - (6*S(ss1)*T*(-3 + 2*T)*sqrt((-1 + 2*T)/((1 + S(ss1))*T*Power(3 + 2*T,2)*(2 + 7*T + 7*Power(T,2) + 2*Power(T,3)))))/((1 + 2*S(ss1))*(1 + T)));
+          case 123: return sqrt((1 + S(ss1))*(1 + T))*(((-2 + T)*T)/sqrt(((1 + S(ss1))*T*(1 + T)*Power(2 + T,3)*Power(3 + 2*T,2))/Power(1 + 2*T,2)) + (12*(-1 + 2*T))/(sqrt((1 + S(ss1))*T)*(3 + 2*T)*Power(2 + 3*T + Power(T,2),1.5)) - (24*S(ss1)*(-1 + 2*T))/((1 + 2*S(ss1))*sqrt((1 + S(ss1))*T)*(3 + 2*T)*Power(2 + 3*T + Power(T,2),1.5)) + (6*(-1 + T)*T*(1 + 2*T))/(sqrt((1 + S(ss1))*T)*(3 + 2*T)*Power(2 + 3*T + Power(T,2),1.5)) - (18*S(ss1)*T*(-2 + 3*T))/((1 + 2*S(ss1))*sqrt((1 + S(ss1))*T)*(3 + 2*T)*Power(2 + 3*T + Power(T,2),1.5)) - (12*(-1 + T)*T*(S(ss1) + 2*S(ss1)*T))/((1 + 2*S(ss1))*sqrt((1 + S(ss1))*T)*(3 + 2*T)*Power(2 + 3*T + Power(T,2),1.5)) - (2*S(ss1)*(-2 + T)*T*(1 + 2*T))/((1 + 2*S(ss1))*(2 + T)*(3 + 2*T)*sqrt((1 + S(ss1))*T*(2 + 3*T + Power(T,2)))) + (9*(-2 + 3*T)*sqrt(T/((1 + S(ss1))*(2 + 3*T + Power(T,2)))))/(6 + 13*T + 9*Power(T,2) + 2*Power(T,3)));
+          case 124: return sqrt(2)/((1 + 2*S(ss1))*sqrt((1 + T)*(2 + T)));
+          case 125: return sqrt(3)*sqrt((1 + S(ss1))*(1 + T))*(-(T*(3 - 7*T + 2*Power(T,2))*sqrt((Power(1 + 2*S(ss1),2)*(1 + 2*T))/((1 + S(ss1))*Power(3 + 2*S(ss1),2)*T*Power(1 + T,3)*Power(3 + 2*T,2)*(-2 + 3*T + 2*Power(T,2))))) - (2*T*(3 - 7*T + 2*Power(T,2)))/sqrt(((1 + S(ss1))*Power(3 + 2*S(ss1),2)*T*Power(1 + T,3)*Power(3 + 2*T,2)*(-2 + 3*T + 2*Power(T,2)))/(1 + 2*T)) - 3*T*(-3 + 2*T)*sqrt((Power(1 + 2*S(ss1),2)*(-1 + 2*T))/((1 + S(ss1))*Power(3 + 2*S(ss1),2)*T*Power(1 + T,3)*Power(3 + 2*T,2)*(2 + 5*T + 2*Power(T,2)))) - (6*(1 + 2*S(ss1))*(-1 + T))/(Power(1 + T,1.5)*(3 + 2*T)*sqrt(((1 + S(ss1))*Power(3 + 2*S(ss1),2)*T*(2 + 5*T + 2*Power(T,2)))/(-1 + 2*T))) + (2*T*(-1 + 2*T)*sqrt((1 + 2*T)/((1 + S(ss1))*T*(-2 + T + 5*Power(T,2) + 2*Power(T,3)))))/((3 + 2*S(ss1))*(3 + 2*T)) + ((1 + 2*S(ss1))*T*(-1 + 2*T))/((3 + 2*S(ss1))*(3 + 2*T)*sqrt(((1 + S(ss1))*T*(-2 + T + 5*Power(T,2) + 2*Power(T,3)))/(1 + 2*T))) - (6*(-3 + 2*T)*sqrt((T*(-1 + 2*T))/((1 + S(ss1))*Power(3 + 2*S(ss1),2)*(2 + 7*T + 7*Power(T,2) + 2*Power(T,3)))))/(3 + 5*T + 2*Power(T,2)) - (12*(-1 + T)*sqrt((-1 + 2*T)/((1 + S(ss1))*T*Power(3 + 2*T,2)*(2 + 7*T + 7*Power(T,2) + 2*Power(T,3)))))/((3 + 2*S(ss1))*(1 + T)));
+          case 126: return -(((1 + S(ss1))*(-36*sqrt((1 + S(ss1))*T*(2 + 3*T + Power(T,2))) + 30*T*sqrt((1 + S(ss1))*T*(2 + 3*T + Power(T,2))) - 6*Power(T,2)*sqrt((1 + S(ss1))*T*(2 + 3*T + Power(T,2))) + 33*Power(T,3)*sqrt((1 + S(ss1))*T*(2 + 3*T + Power(T,2))) + 6*Power(T,4)*sqrt((1 + S(ss1))*T*(2 + 3*T + Power(T,2))) - 36*sqrt((1 + S(ss1))*Power(T,3)*(2 + 3*T + Power(T,2))) + 54*sqrt((1 + S(ss1))*Power(T,5)*(2 + 3*T + Power(T,2))) + 2*S(ss1)*sqrt((1 + S(ss1))*T*(2 + 3*T + Power(T,2)))*(-12 - 2*T + 16*Power(T,2) + 11*Power(T,3) + 2*Power(T,4))))/((3 + 2*S(ss1))*T*Power((1 + S(ss1))*(1 + T),1.5)*Power(2 + T,2)*(3 + 2*T)));
+          case 127: return -(sqrt(2)/sqrt(2 + 3*T + Power(T,2)));
+          case 128: return sqrt(2)*sqrt((1 + S(ss1))*(1 + T))*((-12*S(ss1)*(-1 + 2*T))/((1 + 2*S(ss1))*(1 + T)*sqrt((1 + S(ss1))*(5 + 2*T))*Power(6 + 7*T + 2*Power(T,2),1.5)) + (6*(-1 + T)*(1 + 2*T))/(sqrt((1 + S(ss1))*(5 + 2*T))*Power(6 + 7*T + 2*Power(T,2),1.5)) + (3*(1 + 2*T)*(-2 + 3*T))/((1 + T)*sqrt((1 + S(ss1))*(5 + 2*T))*Power(6 + 7*T + 2*Power(T,2),1.5)) - (12*(-1 + T)*(S(ss1) + 2*S(ss1)*T))/((1 + 2*S(ss1))*sqrt((1 + S(ss1))*(5 + 2*T))*Power(6 + 7*T + 2*Power(T,2),1.5)) - (6*(-2 + 3*T)*(S(ss1) + 2*S(ss1)*T))/((1 + 2*S(ss1))*(1 + T)*sqrt((1 + S(ss1))*(5 + 2*T))*Power(6 + 7*T + 2*Power(T,2),1.5)) + (2*S(ss1)*(1 + 2*T))/((1 + 2*S(ss1))*sqrt((1 + S(ss1))*(5 + 2*T)*(6 + 7*T + 2*Power(T,2)))) - (2*(-2 + T)*(S(ss1) + 2*S(ss1)*T))/((1 + 2*S(ss1))*Power(2 + T,1.5)*sqrt((1 + S(ss1))*(15 + 16*T + 4*Power(T,2)))) + (-1 - 2*T)/sqrt((1 + S(ss1))*(30 + 47*T + 24*Power(T,2) + 4*Power(T,3))) + ((-2 + T)*(1 + 2*T))/((2 + T)*sqrt((1 + S(ss1))*(30 + 47*T + 24*Power(T,2) + 4*Power(T,3)))) + (6*(-1 + 2*T))/((1 + T)*(6 + 7*T + 2*Power(T,2))*sqrt((1 + S(ss1))*(30 + 47*T + 24*Power(T,2) + 4*Power(T,3)))));
+          case 129: return (sqrt((1 + 3*T + 2*Power(T,2))/(2 + 6*S(ss1) + 4*Power(S(ss1),2)))*(30*sqrt(2)*sqrt(((1 + S(ss1))*(1 + 2*S(ss1))*T*(5 + 2*T))/((1 + 2*T)*(6 + 5*T + Power(T,2)))) - 36*sqrt(2)*S(ss1)*(1 + T)*sqrt(((1 + S(ss1))*T*(1 + 2*T)*(5 + 2*T))/((1 + 2*S(ss1))*(6 + 5*T + Power(T,2)))) - 8*sqrt(2)*S(ss1)*(1 + T)*(3 + 2*T)*sqrt(((1 + S(ss1))*T*(1 + 2*T)*(5 + 2*T))/((1 + 2*S(ss1))*(6 + 5*T + Power(T,2)))) + 18*sqrt(2)*(1 + T)*sqrt(((1 + S(ss1))*(1 + 2*S(ss1))*T*(1 + 2*T)*(5 + 2*T))/(6 + 5*T + Power(T,2))) + 4*sqrt(2)*(1 + T)*(3 + 2*T)*sqrt(((1 + S(ss1))*(1 + 2*S(ss1))*T*(1 + 2*T)*(5 + 2*T))/(6 + 5*T + Power(T,2))) - 48*S(ss1)*sqrt(((1 + S(ss1))*T*(5 + 2*T)*(2 + 4*T))/((1 + 2*S(ss1))*(6 + 5*T + Power(T,2)))) + 24*sqrt(((1 + S(ss1))*(1 + 2*S(ss1))*T*(5 + 2*T)*(2 + 4*T))/(6 + 5*T + Power(T,2))) + sqrt(2)*(3 + 5*T + 2*Power(T,2))*sqrt(((1 + S(ss1))*(1 + 2*S(ss1))*T*(1 + 2*T)*(10 + 9*T + 2*Power(T,2)))/(3 + T)) - 60*sqrt(2)*S(ss1)*sqrt(((1 + S(ss1))*T*(5 + 2*T))/((1 + 2*S(ss1))*(6 + 17*T + 11*Power(T,2) + 2*Power(T,3)))) - 2*sqrt(2)*S(ss1)*(3 + 5*T + 2*Power(T,2))*sqrt(((1 + S(ss1))*T*(10 + 29*T + 20*Power(T,2) + 4*Power(T,3)))/((1 + 2*S(ss1))*(3 + T)))))/(Power(5 + 2*T,1.5)*(6 + 13*T + 9*Power(T,2) + 2*Power(T,3)));
+          case 130: return (sqrt(2)*sqrt((1 + T)*(30 + 47*T + 24*Power(T,2) + 4*Power(T,3))))/(6 + 13*T + 9*Power(T,2) + 2*Power(T,3));
+          case 131: return -(((3 + 2*S(ss1))*sqrt((1 + 3*T + 2*Power(T,2))/(3 + 5*S(ss1) + 2*Power(S(ss1),2)))*(2*Power(T,2)*(4*sqrt(((1 + S(ss1))*T*(5 + 12*T + 4*Power(T,2)))/((3 + 2*S(ss1))*(6 + 5*T + Power(T,2)))) + sqrt(((1 + S(ss1))*T*(10 + 29*T + 20*Power(T,2) + 4*Power(T,3)))/((3 + 2*S(ss1))*(3 + T)))) + 3*(18*sqrt(((1 + S(ss1))*T*(5 + 12*T + 4*Power(T,2)))/((3 + 2*S(ss1))*(6 + 5*T + Power(T,2)))) + 10*sqrt(((1 + S(ss1))*T*(5 + 2*T))/((3 + 2*S(ss1))*(6 + 17*T + 11*Power(T,2) + 2*Power(T,3)))) + sqrt(((1 + S(ss1))*T*(10 + 29*T + 20*Power(T,2) + 4*Power(T,3)))/((3 + 2*S(ss1))*(3 + T)))) + T*(38*sqrt(((1 + S(ss1))*T*(5 + 12*T + 4*Power(T,2)))/((3 + 2*S(ss1))*(6 + 5*T + Power(T,2)))) + 5*sqrt(((1 + S(ss1))*T*(10 + 29*T + 20*Power(T,2) + 4*Power(T,3)))/((3 + 2*S(ss1))*(3 + T))))))/(Power(5 + 2*T,1.5)*(6 + 13*T + 9*Power(T,2) + 2*Power(T,3))));
+          case 132: return sqrt(((-1 + S(ss1) + 2*Power(S(ss1),2))*(-1 + Power(T,2)))/((S(ss1) + 2*Power(S(ss1),2))*Power(T,2)));
+          case 133: return sqrt(((-1 + S(ss1) + 2*Power(S(ss1),2))*(-1 + 2*T))/((S(ss1) + 2*Power(S(ss1),2))*(1 + 2*T)))/T;
+          case 134: return -(sqrt((-1 + S(ss1) + 2*Power(S(ss1),2))/(S(ss1)*(1 + 2*S(ss1))))/T);
+          case 135: return (sqrt((-1 + S(ss1) + 2*Power(S(ss1),2))/(S(ss1)*(1 + 2*S(ss1))))*(-1 + T + Power(T,2)))/(T*(1 + T));
+          case 136: return sqrt((-1 + S(ss1) + 2*Power(S(ss1),2))/(S(ss1)*(1 + 2*S(ss1))))/(1 + T);
+          case 137: return -((3*sqrt((-1 + 2*S(ss1))/((1 + 2*S(ss1))*(1 + 2*T))) + T*(4*sqrt((-1 + 2*S(ss1))/((1 + 2*S(ss1))*(1 + 2*T))) + sqrt(((-1 + 2*S(ss1))*(1 + 2*T))/(1 + 2*S(ss1)))))/(Power(1 + T,2)*sqrt((S(ss1)*(3 + 2*T))/(1 + S(ss1)))));
+          case 138: return sqrt(((-1 + S(ss1) + 2*Power(S(ss1),2))*T*(2 + T))/(S(ss1)*(1 + 2*S(ss1))))/(1 + T);
+          case 139: return -(1/sqrt((S(ss1)*(1 + 2*S(ss1))*Power(T,2))/(-1 + Power(T,2))));
+          case 140: return -(sqrt((-1 + 2*T)/((S(ss1) + 2*Power(S(ss1),2))*(1 + 2*T)))/T);
+          case 141: return ((3 + 2*S(ss1))*sqrt((S(ss1)*(-1 + Power(T,2)))/(3 + 11*S(ss1) + 12*Power(S(ss1),2) + 4*Power(S(ss1),3))))/T;
+          case 142: return (3 + 2*S(ss1))*sqrt((S(ss1)*(-1 + 2*T))/((3 + 11*S(ss1) + 12*Power(S(ss1),2) + 4*Power(S(ss1),3))*Power(T,2)*(1 + 2*T)));
+          case 143: return 1/(sqrt(S(ss1)*(1 + 2*S(ss1)))*T);
+          case 144: return (sqrt((1 + S(ss1))*T) - sqrt((1 + S(ss1))*Power(T,3)) - sqrt((1 + S(ss1))*Power(T,5)))/(T*sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*T)*(1 + T));
+          case 145: return -((4*sqrt((S(ss1)*Power(1 + S(ss1),3)*Power(T + Power(T,2),2))/(3 + 2*T)) + 6*Power((1 + S(ss1))*(1 + T),1.5)*sqrt(S(ss1)/(3 + 5*T + 2*Power(T,2))) - (3*(-1 + 2*S(ss1))*Power((1 + S(ss1))*(1 + T),1.5))/sqrt(S(ss1)*(3 + 5*T + 2*Power(T,2))) - (2*(-1 + 2*S(ss1))*T*Power((1 + S(ss1))*(1 + T),1.5))/sqrt(S(ss1)*(3 + 5*T + 2*Power(T,2))))/(Power(1 + S(ss1),1.5)*Power(1 + T,2)*sqrt((1 + 2*S(ss1))*(3 + 2*T))));
+          case 146: return -((3*sqrt(S(ss1)*T*(1 + T)) + 2*S(ss1)*(1 + T)*sqrt(S(ss1)*T*(1 + T)) - 2*sqrt(Power(S(ss1),3)*Power(T,3)*(1 + T)))/(T*sqrt((1 + S(ss1))*(3 + 8*S(ss1) + 4*Power(S(ss1),2))*T*(1 + T))));
+          case 147: return (4*sqrt(S(ss1)/(3 + 11*S(ss1) + 12*Power(S(ss1),2) + 4*Power(S(ss1),3)))*(-1 + T))/(1 + T) + ((-1 + 2*S(ss1))*(-1 + T))/sqrt(((1 + S(ss1))*(3 + 8*S(ss1) + 4*Power(S(ss1),2))*Power(1 + T,2))/S(ss1)) + (S(ss1)*(-1 + 2*S(ss1))*(-1 + 2*T))/(sqrt(S(ss1)*(1 + S(ss1))*(3 + 8*S(ss1) + 4*Power(S(ss1),2)))*T*(1 + T)) + (4*sqrt(S(ss1))*(-1 + 2*T))/(sqrt(3 + 11*S(ss1) + 12*Power(S(ss1),2) + 4*Power(S(ss1),3))*(T + Power(T,2)));
+          case 148: return ((3 + 2*S(ss1))*sqrt(S(ss1)/((1 + S(ss1))*(3 + 8*S(ss1) + 4*Power(S(ss1),2)))))/(1 + T);
+          case 149: return (3 + 2*T)/((1 + T)*sqrt(S(ss1)*(1 + 2*S(ss1))*(3 + 8*T + 4*Power(T,2))));
+          case 150: return -(sqrt((T*(2 + T))/(S(ss1)*(1 + 2*S(ss1))))/(1 + T));
+          case 151: return sqrt((1 + S(ss1))*(1 + T))*(4*(-1 + T)*sqrt((S(ss1)*(1 + 2*T))/(Power(1 + S(ss1),2)*(3 + 8*S(ss1) + 4*Power(S(ss1),2))*Power(1 + T,3)*(3 + 2*T))) + ((-1 + 2*S(ss1))*(-1 + T))/sqrt((Power(1 + S(ss1),2)*(3 + 8*S(ss1) + 4*Power(S(ss1),2))*Power(1 + T,3)*(3 + 2*T))/(S(ss1) + 2*S(ss1)*T)) - (4*sqrt((S(ss1)*(1 + 2*T))/((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(3 + 5*T + 2*Power(T,2)))))/(1 + S(ss1)) + (S(ss1) - 2*Power(S(ss1),2))/sqrt((S(ss1)*Power(1 + S(ss1),2)*(3 + 8*S(ss1) + 4*Power(S(ss1),2))*(3 + 5*T + 2*Power(T,2)))/(1 + 2*T)) + 4*sqrt((S(ss1)*Power(1 - 2*T,2))/(Power(1 + S(ss1),2)*(3 + 8*S(ss1) + 4*Power(S(ss1),2))*Power(1 + T,3)*(3 + 8*T + 4*Power(T,2)))) + (-1 + 2*S(ss1))/sqrt((Power(1 + S(ss1),2)*(3 + 8*S(ss1) + 4*Power(S(ss1),2))*Power(1 + T,3)*(3 + 8*T + 4*Power(T,2)))/(S(ss1)*Power(1 - 2*T,2))));
+          case 152: return (S(ss1)*(2*S(ss1)*(5*sqrt(T/(1 + T)) + 4*T*sqrt(T/(1 + T)) + sqrt(T*(1 + T)) + 2*sqrt(Power(T,3)*(1 + T))) + 3*(5*sqrt(T/(1 + T)) + sqrt(T*(1 + T)) + 2*T*(2*sqrt(T/(1 + T)) + sqrt(T*(1 + T))))))/(sqrt((S(ss1)*(1 + S(ss1))*(3 + 8*S(ss1) + 4*Power(S(ss1),2))*(2 + T))/(1 + T))*(3 + 5*T + 2*Power(T,2)));
+          case 153: return -((-2*S(ss1)*(sqrt(((1 + 2*S(ss1))*(-1 + T))/((3 + 5*S(ss1) + 2*Power(S(ss1),2))*T)) + 2*sqrt((-1 + T)/((3 + 11*S(ss1) + 12*Power(S(ss1),2) + 4*Power(S(ss1),3))*T))) + 2*sqrt(((1 + 3*S(ss1) + 2*Power(S(ss1),2))*(-1 + T))/((3 + 2*S(ss1))*T)) + sqrt(((1 + 2*S(ss1))*(-1 + T))/((3 + 5*S(ss1) + 2*Power(S(ss1),2))*T)))/sqrt(((3 + 2*S(ss1))*T)/(1 + T)));
+          case 154: return -(1/(T*sqrt(((1 + 3*S(ss1) + 2*Power(S(ss1),2))*(1 + 2*T))/(-1 + 2*T))));
+          case 155: return sqrt(-1 + Power(T,2))/T;
+          case 156: return sqrt((-1 + 2*T)/(1 + 2*T))/T;
+          case 157: return 1/(sqrt((1 + S(ss1))*(1 + 2*S(ss1)))*T);
+          case 158: return -((-1 + T + Power(T,2))/(sqrt((1 + S(ss1))*(1 + 2*S(ss1)))*T*(1 + T)));
+          case 159: return -(1/(sqrt((1 + S(ss1))*(1 + 2*S(ss1)))*(1 + T)));
+          case 160: return -(1/T);
+          case 161: return (-1 + T + Power(T,2))/(T*(1 + T));
+          case 162: return 1/(1 + T);
+          case 163: return sqrt((1 + S(ss1))*(1 + T))*(-2*(-1 + T)*sqrt(((1 + 2*S(ss1))*(1 + 2*T))/(Power(3 + 2*S(ss1),2)*Power(1 + T,3)*(3 + 2*T))) + 4*(-1 + T)*sqrt((Power(S(ss1),2)*(1 + 2*T))/((1 + 2*S(ss1))*Power(3 + 5*S(ss1) + 2*Power(S(ss1),2),2)*Power(1 + T,3)*(3 + 2*T))) + (-1 + 2*S(ss1))*(-1 + T)*sqrt(((1 + 2*S(ss1))*(1 + 2*T))/(Power(3 + 5*S(ss1) + 2*Power(S(ss1),2),2)*Power(1 + T,3)*(3 + 2*T))) - (4*S(ss1)*sqrt((1 + 2*T)/((1 + 2*S(ss1))*(3 + 5*T + 2*Power(T,2)))))/(3 + 5*S(ss1) + 2*Power(S(ss1),2)) + (2*sqrt(((1 + 2*S(ss1))*(1 + 2*T))/(3 + 5*T + 2*Power(T,2))))/(3 + 2*S(ss1)) + (1 - 4*Power(S(ss1),2))/((1 + S(ss1))*sqrt(((1 + 2*S(ss1))*Power(3 + 2*S(ss1),2)*(3 + 5*T + 2*Power(T,2)))/(1 + 2*T))) - 2*sqrt(((1 + 2*S(ss1))*Power(1 - 2*T,2))/(Power(3 + 2*S(ss1),2)*Power(1 + T,3)*(3 + 8*T + 4*Power(T,2)))) + (-1 + 2*S(ss1))/sqrt((Power(3 + 5*S(ss1) + 2*Power(S(ss1),2),2)*Power(1 + T,3)*(3 + 8*T + 4*Power(T,2)))/((1 + 2*S(ss1))*Power(1 - 2*T,2))) + (4*S(ss1)*(-1 + 2*T))/((3 + 5*S(ss1) + 2*Power(S(ss1),2))*(1 + T)*sqrt((1 + 2*S(ss1))*(3 + 11*T + 12*Power(T,2) + 4*Power(T,3)))));
+          case 164: return -(((2 + T)*(sqrt(((3 + 2*S(ss1))*T*(3 + 2*T))/((1 + S(ss1))*(2 + T))) - 4*Power(S(ss1),2)*sqrt(((3 + 2*S(ss1))*T*(3 + 2*T))/((1 + S(ss1))*(2 + T))) + 2*sqrt(((3 + 5*S(ss1) + 2*Power(S(ss1),2))*T*(3 + 2*T))/(2 + T)) + 4*S(ss1)*(-sqrt(((3 + 2*S(ss1))*T*(3 + 2*T))/((1 + S(ss1))*(2 + T))) + sqrt(((3 + 5*S(ss1) + 2*Power(S(ss1),2))*T*(3 + 2*T))/(2 + T)))))/((3 + 2*S(ss1))*(1 + T)*sqrt((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(3 + 2*T))));
+          case 165: return (-3 - 2*T)/((1 + T)*sqrt(3 + 8*T + 4*Power(T,2)));
+          case 166: return sqrt(T*(2 + T))/(1 + T);
+          case 167: return sqrt(((-1 + S(ss1) + 2*Power(S(ss1),2))*(-1 + Power(T,2)))/((S(ss1) + 2*Power(S(ss1),2))*Power(T,2)));
+          case 168: return sqrt(((-1 + S(ss1) + 2*Power(S(ss1),2))*(-1 + 2*T))/((S(ss1) + 2*Power(S(ss1),2))*(1 + 2*T)))/T;
+          case 169: return -(sqrt((-1 + S(ss1) + 2*Power(S(ss1),2))/(S(ss1)*(1 + 2*S(ss1))))/T);
+          case 170: return (sqrt((-1 + S(ss1) + 2*Power(S(ss1),2))/(S(ss1)*(1 + 2*S(ss1))))*(-1 + T + Power(T,2)))/(T*(1 + T));
+          case 171: return sqrt((-1 + S(ss1) + 2*Power(S(ss1),2))/(S(ss1)*(1 + 2*S(ss1))))/(1 + T);
+          case 172: return -((3*sqrt((-1 + 2*S(ss1))/((1 + 2*S(ss1))*(1 + 2*T))) + T*(4*sqrt((-1 + 2*S(ss1))/((1 + 2*S(ss1))*(1 + 2*T))) + sqrt(((-1 + 2*S(ss1))*(1 + 2*T))/(1 + 2*S(ss1)))))/(Power(1 + T,2)*sqrt((S(ss1)*(3 + 2*T))/(1 + S(ss1)))));
+          case 173: return sqrt(((-1 + S(ss1) + 2*Power(S(ss1),2))*T*(2 + T))/(S(ss1)*(1 + 2*S(ss1))))/(1 + T);
+          case 174: return -(1/sqrt((S(ss1)*(1 + 2*S(ss1))*Power(T,2))/(-1 + Power(T,2))));
+          case 175: return -(sqrt((-1 + 2*T)/((S(ss1) + 2*Power(S(ss1),2))*(1 + 2*T)))/T);
+          case 176: return ((3 + 2*S(ss1))*sqrt((S(ss1)*(-1 + Power(T,2)))/(3 + 11*S(ss1) + 12*Power(S(ss1),2) + 4*Power(S(ss1),3))))/T;
+          case 177: return (3 + 2*S(ss1))*sqrt((S(ss1)*(-1 + 2*T))/((3 + 11*S(ss1) + 12*Power(S(ss1),2) + 4*Power(S(ss1),3))*Power(T,2)*(1 + 2*T)));
+          case 178: return 1/(sqrt(S(ss1)*(1 + 2*S(ss1)))*T);
+          case 179: return (sqrt((1 + S(ss1))*T) - sqrt((1 + S(ss1))*Power(T,3)) - sqrt((1 + S(ss1))*Power(T,5)))/(T*sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*T)*(1 + T));
+          case 180: return -((4*sqrt((S(ss1)*Power(1 + S(ss1),3)*Power(T + Power(T,2),2))/(3 + 2*T)) + 6*Power((1 + S(ss1))*(1 + T),1.5)*sqrt(S(ss1)/(3 + 5*T + 2*Power(T,2))) - (3*(-1 + 2*S(ss1))*Power((1 + S(ss1))*(1 + T),1.5))/sqrt(S(ss1)*(3 + 5*T + 2*Power(T,2))) - (2*(-1 + 2*S(ss1))*T*Power((1 + S(ss1))*(1 + T),1.5))/sqrt(S(ss1)*(3 + 5*T + 2*Power(T,2))))/(Power(1 + S(ss1),1.5)*Power(1 + T,2)*sqrt((1 + 2*S(ss1))*(3 + 2*T))));
+          case 181: return -((3*sqrt(S(ss1)*T*(1 + T)) + 2*S(ss1)*(1 + T)*sqrt(S(ss1)*T*(1 + T)) - 2*sqrt(Power(S(ss1),3)*Power(T,3)*(1 + T)))/(T*sqrt((1 + S(ss1))*(3 + 8*S(ss1) + 4*Power(S(ss1),2))*T*(1 + T))));
+          case 182: return (4*sqrt(S(ss1)/(3 + 11*S(ss1) + 12*Power(S(ss1),2) + 4*Power(S(ss1),3)))*(-1 + T))/(1 + T) + ((-1 + 2*S(ss1))*(-1 + T))/sqrt(((1 + S(ss1))*(3 + 8*S(ss1) + 4*Power(S(ss1),2))*Power(1 + T,2))/S(ss1)) + (S(ss1)*(-1 + 2*S(ss1))*(-1 + 2*T))/(sqrt(S(ss1)*(1 + S(ss1))*(3 + 8*S(ss1) + 4*Power(S(ss1),2)))*T*(1 + T)) + (4*sqrt(S(ss1))*(-1 + 2*T))/(sqrt(3 + 11*S(ss1) + 12*Power(S(ss1),2) + 4*Power(S(ss1),3))*(T + Power(T,2)));
+          case 183: return ((3 + 2*S(ss1))*sqrt(S(ss1)/((1 + S(ss1))*(3 + 8*S(ss1) + 4*Power(S(ss1),2)))))/(1 + T);
+          case 184: return (3 + 2*T)/((1 + T)*sqrt(S(ss1)*(1 + 2*S(ss1))*(3 + 8*T + 4*Power(T,2))));
+          case 185: return -(sqrt((T*(2 + T))/(S(ss1)*(1 + 2*S(ss1))))/(1 + T));
+          case 186: return sqrt((1 + S(ss1))*(1 + T))*(4*(-1 + T)*sqrt((S(ss1)*(1 + 2*T))/(Power(1 + S(ss1),2)*(3 + 8*S(ss1) + 4*Power(S(ss1),2))*Power(1 + T,3)*(3 + 2*T))) + ((-1 + 2*S(ss1))*(-1 + T))/sqrt((Power(1 + S(ss1),2)*(3 + 8*S(ss1) + 4*Power(S(ss1),2))*Power(1 + T,3)*(3 + 2*T))/(S(ss1) + 2*S(ss1)*T)) - (4*sqrt((S(ss1)*(1 + 2*T))/((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(3 + 5*T + 2*Power(T,2)))))/(1 + S(ss1)) + (S(ss1) - 2*Power(S(ss1),2))/sqrt((S(ss1)*Power(1 + S(ss1),2)*(3 + 8*S(ss1) + 4*Power(S(ss1),2))*(3 + 5*T + 2*Power(T,2)))/(1 + 2*T)) + 4*sqrt((S(ss1)*Power(1 - 2*T,2))/(Power(1 + S(ss1),2)*(3 + 8*S(ss1) + 4*Power(S(ss1),2))*Power(1 + T,3)*(3 + 8*T + 4*Power(T,2)))) + (-1 + 2*S(ss1))/sqrt((Power(1 + S(ss1),2)*(3 + 8*S(ss1) + 4*Power(S(ss1),2))*Power(1 + T,3)*(3 + 8*T + 4*Power(T,2)))/(S(ss1)*Power(1 - 2*T,2))));
+          case 187: return (S(ss1)*(2*S(ss1)*(5*sqrt(T/(1 + T)) + 4*T*sqrt(T/(1 + T)) + sqrt(T*(1 + T)) + 2*sqrt(Power(T,3)*(1 + T))) + 3*(5*sqrt(T/(1 + T)) + sqrt(T*(1 + T)) + 2*T*(2*sqrt(T/(1 + T)) + sqrt(T*(1 + T))))))/(sqrt((S(ss1)*(1 + S(ss1))*(3 + 8*S(ss1) + 4*Power(S(ss1),2))*(2 + T))/(1 + T))*(3 + 5*T + 2*Power(T,2)));
+          case 188: return -((-2*S(ss1)*(sqrt(((1 + 2*S(ss1))*(-1 + T))/((3 + 5*S(ss1) + 2*Power(S(ss1),2))*T)) + 2*sqrt((-1 + T)/((3 + 11*S(ss1) + 12*Power(S(ss1),2) + 4*Power(S(ss1),3))*T))) + 2*sqrt(((1 + 3*S(ss1) + 2*Power(S(ss1),2))*(-1 + T))/((3 + 2*S(ss1))*T)) + sqrt(((1 + 2*S(ss1))*(-1 + T))/((3 + 5*S(ss1) + 2*Power(S(ss1),2))*T)))/sqrt(((3 + 2*S(ss1))*T)/(1 + T)));
+          case 189: return -(1/(T*sqrt(((1 + 3*S(ss1) + 2*Power(S(ss1),2))*(1 + 2*T))/(-1 + 2*T))));
+          case 190: return sqrt(-1 + Power(T,2))/T;
+          case 191: return sqrt((-1 + 2*T)/(1 + 2*T))/T;
+          case 192: return 1/(sqrt((1 + S(ss1))*(1 + 2*S(ss1)))*T);
+          case 193: return -((-1 + T + Power(T,2))/(sqrt((1 + S(ss1))*(1 + 2*S(ss1)))*T*(1 + T)));
+          case 194: return -(1/(sqrt((1 + S(ss1))*(1 + 2*S(ss1)))*(1 + T)));
+          case 195: return -(1/T);
+          case 196: return (-1 + T + Power(T,2))/(T*(1 + T));
+          case 197: return 1/(1 + T);
+          case 198: return sqrt((1 + S(ss1))*(1 + T))*(-2*(-1 + T)*sqrt(((1 + 2*S(ss1))*(1 + 2*T))/(Power(3 + 2*S(ss1),2)*Power(1 + T,3)*(3 + 2*T))) + 4*(-1 + T)*sqrt((Power(S(ss1),2)*(1 + 2*T))/((1 + 2*S(ss1))*Power(3 + 5*S(ss1) + 2*Power(S(ss1),2),2)*Power(1 + T,3)*(3 + 2*T))) + (-1 + 2*S(ss1))*(-1 + T)*sqrt(((1 + 2*S(ss1))*(1 + 2*T))/(Power(3 + 5*S(ss1) + 2*Power(S(ss1),2),2)*Power(1 + T,3)*(3 + 2*T))) - (4*S(ss1)*sqrt((1 + 2*T)/((1 + 2*S(ss1))*(3 + 5*T + 2*Power(T,2)))))/(3 + 5*S(ss1) + 2*Power(S(ss1),2)) + (2*sqrt(((1 + 2*S(ss1))*(1 + 2*T))/(3 + 5*T + 2*Power(T,2))))/(3 + 2*S(ss1)) + (1 - 4*Power(S(ss1),2))/((1 + S(ss1))*sqrt(((1 + 2*S(ss1))*Power(3 + 2*S(ss1),2)*(3 + 5*T + 2*Power(T,2)))/(1 + 2*T))) - 2*sqrt(((1 + 2*S(ss1))*Power(1 - 2*T,2))/(Power(3 + 2*S(ss1),2)*Power(1 + T,3)*(3 + 8*T + 4*Power(T,2)))) + (-1 + 2*S(ss1))/sqrt((Power(3 + 5*S(ss1) + 2*Power(S(ss1),2),2)*Power(1 + T,3)*(3 + 8*T + 4*Power(T,2)))/((1 + 2*S(ss1))*Power(1 - 2*T,2))) + (4*S(ss1)*(-1 + 2*T))/((3 + 5*S(ss1) + 2*Power(S(ss1),2))*(1 + T)*sqrt((1 + 2*S(ss1))*(3 + 11*T + 12*Power(T,2) + 4*Power(T,3)))));
+          case 199: return -(((2 + T)*(sqrt(((3 + 2*S(ss1))*T*(3 + 2*T))/((1 + S(ss1))*(2 + T))) - 4*Power(S(ss1),2)*sqrt(((3 + 2*S(ss1))*T*(3 + 2*T))/((1 + S(ss1))*(2 + T))) + 2*sqrt(((3 + 5*S(ss1) + 2*Power(S(ss1),2))*T*(3 + 2*T))/(2 + T)) + 4*S(ss1)*(-sqrt(((3 + 2*S(ss1))*T*(3 + 2*T))/((1 + S(ss1))*(2 + T))) + sqrt(((3 + 5*S(ss1) + 2*Power(S(ss1),2))*T*(3 + 2*T))/(2 + T)))))/((3 + 2*S(ss1))*(1 + T)*sqrt((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(3 + 2*T))));
+          case 200: return (-3 - 2*T)/((1 + T)*sqrt(3 + 8*T + 4*Power(T,2)));
+          case 201: return sqrt(T*(2 + T))/(1 + T);
+          case 202: return -2*sqrt((-1 + Power(S(ss1),2))/(-1 + 4*Power(S(ss1),2)));
+          case 203: return sqrt(3)/sqrt(-1 + 4*Power(S(ss1),2));
+          case 204: return -(sqrt(-3 + 4*S(ss1) + 4*Power(S(ss1),2))/(1 + 2*S(ss1)));
+          case 205: return 2/(1 + 2*S(ss1));
+          case 206: return (S(ss1)*sqrt((4 + 4*S(ss1))/(S(ss1) + 2*Power(S(ss1),2)))*(sqrt((2 + 3*S(ss1) + Power(S(ss1),2))/(3 + 2*S(ss1)))*(3 + 8*S(ss1) + 4*Power(S(ss1),2)) - S(ss1)*sqrt((2 + 3*S(ss1) + Power(S(ss1),2))/(3 + 2*S(ss1)))*(3 + 8*S(ss1) + 4*Power(S(ss1),2)) - 7*sqrt(6 + 13*S(ss1) + 9*Power(S(ss1),2) + 2*Power(S(ss1),3)) - 8*S(ss1)*sqrt(6 + 13*S(ss1) + 9*Power(S(ss1),2) + 2*Power(S(ss1),3))))/(Power(3 + 2*S(ss1),2)*(2 + 3*S(ss1) + Power(S(ss1),2)));
+          case 207: return sqrt(3)/sqrt(3 + 8*S(ss1) + 4*Power(S(ss1),2));
+          case 208: return -1;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(1, 2, 1));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(1, 2, 1));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -90,10 +1261,432 @@ MatrixElements<SC> SymmetrySPSU2T<SC>::recalc_doublet(const DiagInfo<SC> &diag,
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "spsu2t/spsu2t-doubletm0.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {4, 4},
+        {5, 5},
+        {5, 6},
+        {6, 5},
+        {6, 6},
+        {6, 7},
+        {7, 6},
+        {7, 7},
+        {7, 8},
+        {8, 7},
+        {8, 8},
+        {8, 9},
+        {9, 8},
+        {9, 9},
+        {10, 10},
+        {10, 11},
+        {11, 10},
+        {11, 11},
+        {11, 12},
+        {12, 11},
+        {12, 12},
+        {12, 13},
+        {13, 12},
+        {13, 13},
+        {13, 14},
+        {14, 13},
+        {14, 14},
+        {15, 15},
+        {15, 16},
+        {15, 18},
+        {15, 19},
+        {16, 15},
+        {16, 16},
+        {16, 17},
+        {16, 18},
+        {16, 19},
+        {16, 20},
+        {17, 16},
+        {17, 17},
+        {17, 19},
+        {17, 20},
+        {18, 18},
+        {18, 19},
+        {19, 18},
+        {19, 19},
+        {19, 20},
+        {20, 19},
+        {20, 20},
+        {21, 21},
+        {21, 22},
+        {21, 24},
+        {21, 25},
+        {22, 21},
+        {22, 22},
+        {22, 23},
+        {22, 24},
+        {22, 25},
+        {22, 26},
+        {23, 22},
+        {23, 23},
+        {23, 25},
+        {23, 26},
+        {24, 24},
+        {24, 25},
+        {25, 24},
+        {25, 25},
+        {25, 26},
+        {26, 25},
+        {26, 26},
+        {27, 27},
+        {27, 28},
+        {27, 30},
+        {27, 31},
+        {28, 27},
+        {28, 28},
+        {28, 29},
+        {28, 30},
+        {28, 31},
+        {28, 32},
+        {29, 28},
+        {29, 29},
+        {29, 31},
+        {29, 32},
+        {30, 30},
+        {30, 31},
+        {31, 30},
+        {31, 31},
+        {31, 32},
+        {32, 31},
+        {32, 32},
+        {33, 33},
+        {33, 34},
+        {33, 38},
+        {33, 39},
+        {34, 33},
+        {34, 34},
+        {34, 35},
+        {34, 38},
+        {34, 39},
+        {34, 40},
+        {35, 34},
+        {35, 35},
+        {35, 36},
+        {35, 39},
+        {35, 40},
+        {35, 41},
+        {36, 35},
+        {36, 36},
+        {36, 37},
+        {36, 40},
+        {36, 41},
+        {36, 42},
+        {37, 36},
+        {37, 37},
+        {37, 41},
+        {37, 42},
+        {38, 38},
+        {38, 39},
+        {39, 38},
+        {39, 39},
+        {39, 40},
+        {40, 39},
+        {40, 40},
+        {40, 41},
+        {41, 40},
+        {41, 41},
+        {41, 42},
+        {42, 41},
+        {42, 42},
+        {43, 43},
+        {43, 44},
+        {43, 46},
+        {43, 47},
+        {44, 43},
+        {44, 44},
+        {44, 45},
+        {44, 46},
+        {44, 47},
+        {44, 48},
+        {45, 44},
+        {45, 45},
+        {45, 47},
+        {45, 48},
+        {46, 46},
+        {46, 47},
+        {46, 49},
+        {46, 50},
+        {47, 46},
+        {47, 47},
+        {47, 48},
+        {47, 49},
+        {47, 50},
+        {47, 51},
+        {48, 47},
+        {48, 48},
+        {48, 50},
+        {48, 51},
+        {49, 49},
+        {49, 50},
+        {50, 49},
+        {50, 50},
+        {50, 51},
+        {51, 50},
+        {51, 51},
+        {52, 52},
+        {52, 53},
+        {52, 55},
+        {52, 56},
+        {53, 52},
+        {53, 53},
+        {53, 54},
+        {53, 55},
+        {53, 56},
+        {53, 57},
+        {54, 53},
+        {54, 54},
+        {54, 56},
+        {54, 57},
+        {55, 55},
+        {55, 56},
+        {55, 58},
+        {55, 59},
+        {56, 55},
+        {56, 56},
+        {56, 57},
+        {56, 58},
+        {56, 59},
+        {56, 60},
+        {57, 56},
+        {57, 57},
+        {57, 59},
+        {57, 60},
+        {58, 58},
+        {58, 59},
+        {59, 58},
+        {59, 59},
+        {59, 60},
+        {60, 59},
+        {60, 60},
+        {61, 61},
+        {61, 62},
+        {62, 62},
+        {62, 63},
+        {63, 63},
+        {63, 64},
+        {64, 64}
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(1, 2, 1));
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return 1;
+          case 3: return 1;
+          case 4: return 1/sqrt(((-1 + T)*T)/(-2 - T + Power(T,2)));
+          case 5: return sqrt((-6 + 4*T)/(T - 3*Power(T,2) + 2*Power(T,3)));
+          case 6: return -(sqrt(2)/sqrt((-1 + T)*T));
+          case 7: return (-3 + Power(T,2))/(T*sqrt(-1 + Power(T,2)));
+          case 8: return (sqrt(3)*(-3 + T + 2*Power(T,2)))/(T*sqrt((1 + T)*(-3 - 5*T + 4*Power(T,2) + 4*Power(T,3))));
+          case 9: return -((sqrt(3)*(-2*(-1 + T)*Power(T,2.5)*Power(1 + T,1.5)*sqrt(-1 + 2*T)*(3 + 2*T) + 7*(-1 + T)*Power(T*(1 + T),1.5)*sqrt(-1 + 2*T)*(3 + 2*T) - 3*(-1 + T)*Power(1 + T,1.5)*sqrt(T*(-1 + 2*T))*(3 + 2*T) + T*sqrt(T*Power(1 + T,3)*(-1 + 2*T)*Power(3 + 2*T,2)) - 3*Power(T,2)*sqrt(T*Power(1 + T,3)*(-1 + 2*T)*Power(3 + 2*T,2)) + 2*Power(T,3)*sqrt(T*Power(1 + T,3)*(-1 + 2*T)*Power(3 + 2*T,2)) - 2*sqrt((T*(1 + T))/(-1 + 2*T))*(3 - 5*T + 2*Power(T,2))*(-3 + T + 8*Power(T,2) + 4*Power(T,3))))/(sqrt(-1 + T)*Power(1 + T,2)*(-1 + 2*T)*Power(T*(3 + 2*T),1.5)));
+          case 10: return (-3 + T + Power(T,2))/(T*(1 + T));
+          case 11: return (sqrt(3)*sqrt(1 + T)*(6*sqrt(T*(-2 + 3*T + 2*Power(T,2)))*(3 + 5*T + 2*Power(T,2)) - 19*T*sqrt(T*(-2 + 3*T + 2*Power(T,2)))*(3 + 5*T + 2*Power(T,2)) + 12*Power(T,2)*sqrt(T*(-2 + 3*T + 2*Power(T,2)))*(3 + 5*T + 2*Power(T,2)) + 4*Power(T,3)*sqrt(T*(-2 + 3*T + 2*Power(T,2)))*(3 + 5*T + 2*Power(T,2)) + 12*sqrt(T*(2 + T)*Power(-1 + 2*T,3)*Power(3 + 5*T + 2*Power(T,2),2))))/(T*(-2 + 3*T + 2*Power(T,2))*Power(3 + 5*T + 2*Power(T,2),2.5));
+          case 12: return (sqrt(3 + 3/T)*(-6*sqrt((-6 + 5*T + 12*Power(T,2) + 4*Power(T,3))/(1 + 2*T)) - 3*T*sqrt((-6 + 5*T + 12*Power(T,2) + 4*Power(T,3))/(1 + 2*T)) + 6*Power(T,2)*sqrt((-6 + 5*T + 12*Power(T,2) + 4*Power(T,3))/(1 + 2*T)) - 4*T*sqrt(-6 - 7*T + 22*Power(T,2) + 28*Power(T,3) + 8*Power(T,4))))/((2 + T)*Power(3 + 5*T + 2*Power(T,2),1.5));
+          case 13: return (-2 + 2*T + Power(T,2))/((1 + T)*sqrt(T*(2 + T)));
+          case 14: return (sqrt(2)*(45*T*sqrt((T*(3 + 5*T + 2*Power(T,2)))/(5 + 2*T)) + 2*(sqrt((Power(T,3)*Power(1 + T,3)*Power(1 + 2*T,2)*(3 + 2*T))/(5 + 2*T)) + 15*sqrt((T*(3 + 5*T + 2*Power(T,2)))/(5 + 2*T)) + 9*sqrt((Power(T,5)*(3 + 5*T + 2*Power(T,2)))/(5 + 2*T)))))/((1 + T)*sqrt(T*(5 + 2*T))*Power(6 + 7*T + 2*Power(T,2),1.5));
+          case 15: return -((sqrt(2)*(5*sqrt(T*(1 + T)) + 2*sqrt(Power(T,3)*(1 + T))))/((1 + T)*sqrt(T*(5 + 2*T)*(6 + 7*T + 2*Power(T,2)))));
+          case 16: return (3 + T)/sqrt(11 + 6/T + 6*T + Power(T,2));
+          case 17: return 1/sqrt(((-1 + T)*T)/(-2 - T + Power(T,2)));
+          case 18: return sqrt((-6 + 4*T)/(T - 3*Power(T,2) + 2*Power(T,3)));
+          case 19: return -(sqrt(2)/sqrt((-1 + T)*T));
+          case 20: return (-3 + Power(T,2))/(T*sqrt(-1 + Power(T,2)));
+          case 21: return (sqrt(3)*(-3 + T + 2*Power(T,2)))/(T*sqrt((1 + T)*(-3 - 5*T + 4*Power(T,2) + 4*Power(T,3))));
+          case 22: return -((sqrt(3)*(-2*(-1 + T)*Power(T,2.5)*Power(1 + T,1.5)*sqrt(-1 + 2*T)*(3 + 2*T) + 7*(-1 + T)*Power(T*(1 + T),1.5)*sqrt(-1 + 2*T)*(3 + 2*T) - 3*(-1 + T)*Power(1 + T,1.5)*sqrt(T*(-1 + 2*T))*(3 + 2*T) + T*sqrt(T*Power(1 + T,3)*(-1 + 2*T)*Power(3 + 2*T,2)) - 3*Power(T,2)*sqrt(T*Power(1 + T,3)*(-1 + 2*T)*Power(3 + 2*T,2)) + 2*Power(T,3)*sqrt(T*Power(1 + T,3)*(-1 + 2*T)*Power(3 + 2*T,2)) - 2*sqrt((T*(1 + T))/(-1 + 2*T))*(3 - 5*T + 2*Power(T,2))*(-3 + T + 8*Power(T,2) + 4*Power(T,3))))/(sqrt(-1 + T)*Power(1 + T,2)*(-1 + 2*T)*Power(T*(3 + 2*T),1.5)));
+          case 23: return (-3 + T + Power(T,2))/(T*(1 + T));
+          case 24: return (sqrt(3)*sqrt(1 + T)*(6*sqrt(T*(-2 + 3*T + 2*Power(T,2)))*(3 + 5*T + 2*Power(T,2)) - 19*T*sqrt(T*(-2 + 3*T + 2*Power(T,2)))*(3 + 5*T + 2*Power(T,2)) + 12*Power(T,2)*sqrt(T*(-2 + 3*T + 2*Power(T,2)))*(3 + 5*T + 2*Power(T,2)) + 4*Power(T,3)*sqrt(T*(-2 + 3*T + 2*Power(T,2)))*(3 + 5*T + 2*Power(T,2)) + 12*sqrt(T*(2 + T)*Power(-1 + 2*T,3)*Power(3 + 5*T + 2*Power(T,2),2))))/(T*(-2 + 3*T + 2*Power(T,2))*Power(3 + 5*T + 2*Power(T,2),2.5));
+          case 25: return (sqrt(3 + 3/T)*(-6*sqrt((-6 + 5*T + 12*Power(T,2) + 4*Power(T,3))/(1 + 2*T)) - 3*T*sqrt((-6 + 5*T + 12*Power(T,2) + 4*Power(T,3))/(1 + 2*T)) + 6*Power(T,2)*sqrt((-6 + 5*T + 12*Power(T,2) + 4*Power(T,3))/(1 + 2*T)) - 4*T*sqrt(-6 - 7*T + 22*Power(T,2) + 28*Power(T,3) + 8*Power(T,4))))/((2 + T)*Power(3 + 5*T + 2*Power(T,2),1.5));
+          case 26: return (-2 + 2*T + Power(T,2))/((1 + T)*sqrt(T*(2 + T)));
+          case 27: return (sqrt(2)*(45*T*sqrt((T*(3 + 5*T + 2*Power(T,2)))/(5 + 2*T)) + 2*(sqrt((Power(T,3)*Power(1 + T,3)*Power(1 + 2*T,2)*(3 + 2*T))/(5 + 2*T)) + 15*sqrt((T*(3 + 5*T + 2*Power(T,2)))/(5 + 2*T)) + 9*sqrt((Power(T,5)*(3 + 5*T + 2*Power(T,2)))/(5 + 2*T)))))/((1 + T)*sqrt(T*(5 + 2*T))*Power(6 + 7*T + 2*Power(T,2),1.5));
+          case 28: return -((sqrt(2)*(5*sqrt(T*(1 + T)) + 2*sqrt(Power(T,3)*(1 + T))))/((1 + T)*sqrt(T*(5 + 2*T)*(6 + 7*T + 2*Power(T,2)))));
+          case 29: return (3 + T)/sqrt(11 + 6/T + 6*T + Power(T,2));
+          case 30: return -(sqrt(-1 + Power(T,2))/T);
+          case 31: return -(sqrt((-1 + 2*T)/(1 + 2*T))/T);
+          case 32: return -(sqrt(-1 + Power(T,2))/(T + 2*S(ss1)*T));
+          case 33: return -(sqrt((-1 + 2*T)/(1 + 2*T))/(T + 2*S(ss1)*T));
+          case 34: return 1/T;
+          case 35: return -((-1 + T + Power(T,2))/(T*(1 + T)));
+          case 36: return -(1/(1 + T));
+          case 37: return 1/(T + 2*S(ss1)*T);
+          case 38: return -((-1 + T + Power(T,2))/((1 + 2*S(ss1))*T*(1 + T)));
+          case 39: return -(1/(1 + 2*S(ss1) + T + 2*S(ss1)*T));
+          case 40: return -((sqrt((-1 + 2*T)/(3 + 2*T))*(sqrt((-1 + 2*T)/(1 + 3*T + 2*Power(T,2))) + T*sqrt((-1 + 2*T)/(1 + 3*T + 2*Power(T,2))) - 2*sqrt((1 + 3*T + 2*Power(T,2))/(-1 + 2*T))))/Power(1 + T,1.5));
+          case 41: return -(sqrt(1 + T)*(2*sqrt((T*Power(1 + 2*T,2))/(Power(1 + T,3)*(2 + T)*Power(3 + 2*T,2))) + ((1 + 2*T)*sqrt(T/(2 + 3*T + Power(T,2))))/(3 + 2*T) + (3*sqrt(T/(2 + 3*T + Power(T,2))))/(3 + 5*T + 2*Power(T,2))));
+          case 42: return -((-2*sqrt((1 + 2*S(ss1))*T*(1 + 2*T)) + (-1 + 2*T)*sqrt((T + 2*S(ss1)*T)/(1 + 2*T)))/(Power(1 + 2*S(ss1),1.5)*(1 + T)*sqrt(T*(3 + 2*T))));
+          case 43: return -((sqrt(1 + T)*(sqrt((T*(1 + T))/(2 + T)) + 5*sqrt(T/(2 + 3*T + Power(T,2))) + 2*T*(sqrt((T*(1 + T))/(2 + T)) + 2*sqrt(T/(2 + 3*T + Power(T,2))))))/((1 + 2*S(ss1))*(3 + 5*T + 2*Power(T,2))));
+          case 44: return (-2*sqrt(S(ss1)*(1 + S(ss1))*(-1 + Power(T,2))))/(T + 2*S(ss1)*T);
+          case 45: return (-2*sqrt((S(ss1)*(1 + S(ss1))*(-1 + 2*T))/(1 + 2*T)))/(T + 2*S(ss1)*T);
+          case 46: return (2*sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*T))/Power(T + 2*S(ss1)*T,1.5);
+          case 47: return (-2*sqrt(S(ss1)*(1 + S(ss1)))*(-1 + T + Power(T,2)))/((1 + 2*S(ss1))*T*(1 + T));
+          case 48: return (-2*(sqrt(S(ss1)*(1 + S(ss1))) + 2*sqrt(Power(S(ss1),3)*(1 + S(ss1))) + sqrt(Power(S(ss1),5)*(1 + S(ss1)))))/(Power(1 + S(ss1),2)*(1 + 2*S(ss1))*(1 + T));
+          case 49: return -(((1 + 2*T)*(-sqrt((S(ss1)*Power(1 + S(ss1),3)*T*Power(1 + T,2)*Power(3 + 2*T,3))/((1 + 2*S(ss1))*(1 + 2*T))) - sqrt((S(ss1)*Power(1 + S(ss1),3)*(1 + 2*S(ss1))*T*Power(1 + T,2)*Power(3 + 2*T,3))/(1 + 2*T)) - sqrt((S(ss1)*Power(1 + S(ss1),3)*T*Power(1 + T,4)*Power(3 + 2*T,3))/((1 + 2*S(ss1))*(1 + 2*T))) - sqrt((S(ss1)*Power(1 + S(ss1),3)*(1 + 2*S(ss1))*T*Power(1 + T,4)*Power(3 + 2*T,3))/(1 + 2*T)) + 2*Power(1 + S(ss1),2.5)*T*(1 + T)*Power(3 + 2*T,1.5)*sqrt((S(ss1)*T)/(1 + 2*S(ss1) + 2*T + 4*S(ss1)*T)) + sqrt((S(ss1)*Power(1 + S(ss1),3)*T*Power(3 + 2*T,3)*Power(-1 + T + 2*Power(T,2),2))/((1 + 2*S(ss1))*Power(1 + 2*T,3))) + sqrt((S(ss1)*Power(1 + S(ss1),3)*(1 + 2*S(ss1))*T*Power(3 + 2*T,3)*Power(-1 + T + 2*Power(T,2),2))/Power(1 + 2*T,3))))/(Power(1 + S(ss1),2)*sqrt(T + 2*S(ss1)*T)*Power(3 + 5*T + 2*Power(T,2),2)));
+          case 50: return ((1 + 2*T)*(-4*sqrt((S(ss1)*Power(1 + S(ss1),3)*T*(1 + T)*Power(3 + 2*T,3))/(2 + T)) - 4*sqrt((S(ss1)*Power(1 + S(ss1),3)*T*(1 + T)*Power(3 + 2*T,3))/(Power(1 + 2*S(ss1),2)*(2 + T))) - 6*sqrt((S(ss1)*Power(1 + S(ss1),3)*T*(1 + T)*Power(3 + 2*T,3))/((2 + T)*Power(1 + 2*T,2))) - (6*(1 + S(ss1))*(1 + T)*Power(3 + 2*T,1.5)*sqrt((S(ss1)*(1 + S(ss1))*T)/(2 + 3*T + Power(T,2))))/((1 + 2*S(ss1))*(1 + 2*T)) - 2*sqrt((S(ss1)*Power(1 + S(ss1),3)*T*Power(3 + 5*T + 2*Power(T,2),3))/(2 + T)) - 2*sqrt((S(ss1)*Power(1 + S(ss1),3)*T*Power(3 + 5*T + 2*Power(T,2),3))/(Power(1 + 2*S(ss1),2)*(2 + T)))))/(2.*Power(1 + S(ss1),2)*Power(1 + T,1.5)*Power(3 + 2*T,2.5));
+          case 51: return -(sqrt(-1 + Power(T,2))/T);
+          case 52: return -(sqrt((-1 + 2*T)/(1 + 2*T))/T);
+          case 53: return -(sqrt(-1 + Power(T,2))/(T + 2*S(ss1)*T));
+          case 54: return -(sqrt((-1 + 2*T)/(1 + 2*T))/(T + 2*S(ss1)*T));
+          case 55: return 1/T;
+          case 56: return -((-1 + T + Power(T,2))/(T*(1 + T)));
+          case 57: return -(1/(1 + T));
+          case 58: return 1/(T + 2*S(ss1)*T);
+          case 59: return -((-1 + T + Power(T,2))/((1 + 2*S(ss1))*T*(1 + T)));
+          case 60: return -(1/(1 + 2*S(ss1) + T + 2*S(ss1)*T));
+          case 61: return -((sqrt((-1 + 2*T)/(3 + 2*T))*(sqrt((-1 + 2*T)/(1 + 3*T + 2*Power(T,2))) + T*sqrt((-1 + 2*T)/(1 + 3*T + 2*Power(T,2))) - 2*sqrt((1 + 3*T + 2*Power(T,2))/(-1 + 2*T))))/Power(1 + T,1.5));
+          case 62: return sqrt(1 + T)*(-2*sqrt((T*Power(1 + 2*T,2))/(Power(1 + T,3)*(2 + T)*Power(3 + 2*T,2))) - ((1 + 2*T)*sqrt(T/(2 + 3*T + Power(T,2))))/(3 + 2*T) - (3*sqrt(T/(2 + 3*T + Power(T,2))))/(3 + 5*T + 2*Power(T,2)));
+          case 63: return -((-2*sqrt((1 + 2*S(ss1))*T*(1 + 2*T)) + (-1 + 2*T)*sqrt((T + 2*S(ss1)*T)/(1 + 2*T)))/(Power(1 + 2*S(ss1),1.5)*(1 + T)*sqrt(T*(3 + 2*T))));
+          case 64: return -((sqrt(1 + T)*(sqrt((T*(1 + T))/(2 + T)) + 5*sqrt(T/(2 + 3*T + Power(T,2))) + 2*T*(sqrt((T*(1 + T))/(2 + T)) + 2*sqrt(T/(2 + 3*T + Power(T,2))))))/((1 + 2*S(ss1))*(3 + 5*T + 2*Power(T,2))));
+          case 65: return (-2*sqrt(S(ss1)*(1 + S(ss1))*(-1 + Power(T,2))))/(T + 2*S(ss1)*T);
+          case 66: return (-2*sqrt((S(ss1)*(1 + S(ss1))*(-1 + 2*T))/(1 + 2*T)))/(T + 2*S(ss1)*T);
+          case 67: return (2*sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*T))/Power(T + 2*S(ss1)*T,1.5);
+          case 68: return (-2*sqrt(S(ss1)*(1 + S(ss1)))*(-1 + T + Power(T,2)))/((1 + 2*S(ss1))*T*(1 + T));
+          case 69: return (-2*(sqrt(S(ss1)*(1 + S(ss1))) + 2*sqrt(Power(S(ss1),3)*(1 + S(ss1))) + sqrt(Power(S(ss1),5)*(1 + S(ss1)))))/(Power(1 + S(ss1),2)*(1 + 2*S(ss1))*(1 + T));
+          case 70: return -(((1 + 2*T)*(-sqrt((S(ss1)*Power(1 + S(ss1),3)*T*Power(1 + T,2)*Power(3 + 2*T,3))/((1 + 2*S(ss1))*(1 + 2*T))) - sqrt((S(ss1)*Power(1 + S(ss1),3)*(1 + 2*S(ss1))*T*Power(1 + T,2)*Power(3 + 2*T,3))/(1 + 2*T)) - sqrt((S(ss1)*Power(1 + S(ss1),3)*T*Power(1 + T,4)*Power(3 + 2*T,3))/((1 + 2*S(ss1))*(1 + 2*T))) - sqrt((S(ss1)*Power(1 + S(ss1),3)*(1 + 2*S(ss1))*T*Power(1 + T,4)*Power(3 + 2*T,3))/(1 + 2*T)) + 2*Power(1 + S(ss1),2.5)*T*(1 + T)*Power(3 + 2*T,1.5)*sqrt((S(ss1)*T)/(1 + 2*S(ss1) + 2*T + 4*S(ss1)*T)) + sqrt((S(ss1)*Power(1 + S(ss1),3)*T*Power(3 + 2*T,3)*Power(-1 + T + 2*Power(T,2),2))/((1 + 2*S(ss1))*Power(1 + 2*T,3))) + sqrt((S(ss1)*Power(1 + S(ss1),3)*(1 + 2*S(ss1))*T*Power(3 + 2*T,3)*Power(-1 + T + 2*Power(T,2),2))/Power(1 + 2*T,3))))/(Power(1 + S(ss1),2)*sqrt(T + 2*S(ss1)*T)*Power(3 + 5*T + 2*Power(T,2),2)));
+          case 71: return ((1 + 2*T)*(-2*sqrt((S(ss1)*Power(1 + S(ss1),3)*T*(1 + T)*Power(3 + 2*T,3))/(2 + T)) - 2*sqrt((S(ss1)*Power(1 + S(ss1),3)*T*(1 + T)*Power(3 + 2*T,3))/(Power(1 + 2*S(ss1),2)*(2 + T))) - 3*sqrt((S(ss1)*Power(1 + S(ss1),3)*T*(1 + T)*Power(3 + 2*T,3))/((2 + T)*Power(1 + 2*T,2))) - (3*(1 + S(ss1))*(1 + T)*(3 + 2*T)*sqrt((S(ss1)*(1 + S(ss1))*T*(3 + 2*T))/(Power(1 + 2*S(ss1),2)*(2 + 3*T + Power(T,2)))))/(1 + 2*T) - sqrt((S(ss1)*Power(1 + S(ss1),3)*T*Power(3 + 5*T + 2*Power(T,2),3))/(2 + T)) - sqrt((S(ss1)*Power(1 + S(ss1),3)*T*Power(3 + 5*T + 2*Power(T,2),3))/(Power(1 + 2*S(ss1),2)*(2 + T)))))/(Power(1 + S(ss1),2)*Power(1 + T,1.5)*Power(3 + 2*T,2.5));
+          case 72: return -(sqrt(-1 + Power(T,2))/T);
+          case 73: return -(sqrt((-1 + 2*T)/(1 + 2*T))/T);
+          case 74: return -(sqrt(-1 + Power(T,2))/(T + 2*S(ss1)*T));
+          case 75: return -(sqrt((-1 + 2*T)/(1 + 2*T))/(T + 2*S(ss1)*T));
+          case 76: return 1/T;
+          case 77: return -((-1 + T + Power(T,2))/(T*(1 + T)));
+          case 78: return -(1/(1 + T));
+          case 79: return 1/(T + 2*S(ss1)*T);
+          case 80: return -((-1 + T + Power(T,2))/((1 + 2*S(ss1))*T*(1 + T)));
+          case 81: return -(1/(1 + 2*S(ss1) + T + 2*S(ss1)*T));
+          case 82: return -((sqrt((-1 + 2*T)/(3 + 2*T))*(sqrt((-1 + 2*T)/(1 + 3*T + 2*Power(T,2))) + T*sqrt((-1 + 2*T)/(1 + 3*T + 2*Power(T,2))) - 2*sqrt((1 + 3*T + 2*Power(T,2))/(-1 + 2*T))))/Power(1 + T,1.5));
+          case 83: return -(sqrt(1 + T)*(2*sqrt((T*Power(1 + 2*T,2))/(Power(1 + T,3)*(2 + T)*Power(3 + 2*T,2))) + ((1 + 2*T)*sqrt(T/(2 + 3*T + Power(T,2))))/(3 + 2*T) + (3*sqrt(T/(2 + 3*T + Power(T,2))))/(3 + 5*T + 2*Power(T,2))));
+          case 84: return -((-2*sqrt((1 + 2*S(ss1))*T*(1 + 2*T)) + (-1 + 2*T)*sqrt((T + 2*S(ss1)*T)/(1 + 2*T)))/(Power(1 + 2*S(ss1),1.5)*(1 + T)*sqrt(T*(3 + 2*T))));
+          case 85: return -((sqrt(1 + T)*(sqrt((T*(1 + T))/(2 + T)) + 5*sqrt(T/(2 + 3*T + Power(T,2))) + 2*T*(sqrt((T*(1 + T))/(2 + T)) + 2*sqrt(T/(2 + 3*T + Power(T,2))))))/((1 + 2*S(ss1))*(3 + 5*T + 2*Power(T,2))));
+          case 86: return (-2*sqrt(S(ss1)*(1 + S(ss1))*(-1 + Power(T,2))))/(T + 2*S(ss1)*T);
+          case 87: return (-2*sqrt((S(ss1)*(1 + S(ss1))*(-1 + 2*T))/(1 + 2*T)))/(T + 2*S(ss1)*T);
+          case 88: return (2*sqrt(S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*T))/Power(T + 2*S(ss1)*T,1.5);
+          case 89: return (-2*sqrt(S(ss1)*(1 + S(ss1)))*(-1 + T + Power(T,2)))/((1 + 2*S(ss1))*T*(1 + T));
+          case 90: return (-2*(sqrt(S(ss1)*(1 + S(ss1))) + 2*sqrt(Power(S(ss1),3)*(1 + S(ss1))) + sqrt(Power(S(ss1),5)*(1 + S(ss1)))))/(Power(1 + S(ss1),2)*(1 + 2*S(ss1))*(1 + T));
+          case 91: return -(((1 + 2*T)*(-sqrt((S(ss1)*Power(1 + S(ss1),3)*T*Power(1 + T,2)*Power(3 + 2*T,3))/((1 + 2*S(ss1))*(1 + 2*T))) - sqrt((S(ss1)*Power(1 + S(ss1),3)*(1 + 2*S(ss1))*T*Power(1 + T,2)*Power(3 + 2*T,3))/(1 + 2*T)) - sqrt((S(ss1)*Power(1 + S(ss1),3)*T*Power(1 + T,4)*Power(3 + 2*T,3))/((1 + 2*S(ss1))*(1 + 2*T))) - sqrt((S(ss1)*Power(1 + S(ss1),3)*(1 + 2*S(ss1))*T*Power(1 + T,4)*Power(3 + 2*T,3))/(1 + 2*T)) + 2*Power(1 + S(ss1),2.5)*T*(1 + T)*Power(3 + 2*T,1.5)*sqrt((S(ss1)*T)/(1 + 2*S(ss1) + 2*T + 4*S(ss1)*T)) + sqrt((S(ss1)*Power(1 + S(ss1),3)*T*Power(3 + 2*T,3)*Power(-1 + T + 2*Power(T,2),2))/((1 + 2*S(ss1))*Power(1 + 2*T,3))) + sqrt((S(ss1)*Power(1 + S(ss1),3)*(1 + 2*S(ss1))*T*Power(3 + 2*T,3)*Power(-1 + T + 2*Power(T,2),2))/Power(1 + 2*T,3))))/(Power(1 + S(ss1),2)*sqrt(T + 2*S(ss1)*T)*Power(3 + 5*T + 2*Power(T,2),2)));
+          case 92: return ((1 + 2*T)*(-4*sqrt((S(ss1)*Power(1 + S(ss1),3)*T*(1 + T)*Power(3 + 2*T,3))/(2 + T)) - 4*sqrt((S(ss1)*Power(1 + S(ss1),3)*T*(1 + T)*Power(3 + 2*T,3))/(Power(1 + 2*S(ss1),2)*(2 + T))) - 6*sqrt((S(ss1)*Power(1 + S(ss1),3)*T*(1 + T)*Power(3 + 2*T,3))/((2 + T)*Power(1 + 2*T,2))) - (6*(1 + S(ss1))*(1 + T)*Power(3 + 2*T,1.5)*sqrt((S(ss1)*(1 + S(ss1))*T)/(2 + 3*T + Power(T,2))))/((1 + 2*S(ss1))*(1 + 2*T)) - 2*sqrt((S(ss1)*Power(1 + S(ss1),3)*T*Power(3 + 5*T + 2*Power(T,2),3))/(2 + T)) - 2*sqrt((S(ss1)*Power(1 + S(ss1),3)*T*Power(3 + 5*T + 2*Power(T,2),3))/(Power(1 + 2*S(ss1),2)*(2 + T)))))/(2.*Power(1 + S(ss1),2)*Power(1 + T,1.5)*Power(3 + 2*T,2.5));
+          case 93: return -(1/sqrt(((-1 + T)*T)/(-2 - T + Power(T,2))));
+          case 94: return -sqrt((-6 + 4*T)/(T - 3*Power(T,2) + 2*Power(T,3)));
+          case 95: return -(1/sqrt((Power(1 + 2*S(ss1),2)*(-1 + T)*T)/(-2 - T + Power(T,2))));
+          case 96: return -sqrt((-6 + 4*T)/(Power(1 + 2*S(ss1),2)*T*(1 - 3*T + 2*Power(T,2))));
+          case 97: return sqrt(2)/sqrt((-1 + T)*T);
+          case 98: return (3 - Power(T,2))/(T*sqrt(-1 + Power(T,2)));
+          case 99: return -((sqrt(3)*(-3 + T + 2*Power(T,2)))/(T*sqrt((1 + T)*(-3 - 5*T + 4*Power(T,2) + 4*Power(T,3)))));
+          case 100: return sqrt(2)/((1 + 2*S(ss1))*sqrt((-1 + T)*T));
+          case 101: return -((-3 + Power(T,2))/((T + 2*S(ss1)*T)*sqrt(-1 + Power(T,2))));
+          case 102: return -((sqrt(3)*sqrt((-3 + T + 2*Power(T,2))/(1 + 3*T + 2*Power(T,2))))/(T + 2*S(ss1)*T));
+          case 103: return -((sqrt(3)*(2*(-1 + T)*Power(T,2.5)*Power(1 + T,1.5)*sqrt(-1 + 2*T)*(3 + 2*T) - 7*(-1 + T)*Power(T*(1 + T),1.5)*sqrt(-1 + 2*T)*(3 + 2*T) + 3*(-1 + T)*Power(1 + T,1.5)*sqrt(T*(-1 + 2*T))*(3 + 2*T) - T*sqrt(T*Power(1 + T,3)*(-1 + 2*T)*Power(3 + 2*T,2)) + 3*Power(T,2)*sqrt(T*Power(1 + T,3)*(-1 + 2*T)*Power(3 + 2*T,2)) - 2*Power(T,3)*sqrt(T*Power(1 + T,3)*(-1 + 2*T)*Power(3 + 2*T,2)) + 2*sqrt((T*(1 + T))/(-1 + 2*T))*(3 - 5*T + 2*Power(T,2))*(-3 + T + 8*Power(T,2) + 4*Power(T,3))))/(sqrt(-1 + T)*Power(1 + T,2)*(-1 + 2*T)*Power(T*(3 + 2*T),1.5)));
+          case 104: return -((-3 + T + Power(T,2))/(T*(1 + T)));
+          case 105: return -((sqrt(3)*sqrt(1 + T)*(6*sqrt(T*(-2 + 3*T + 2*Power(T,2)))*(3 + 5*T + 2*Power(T,2)) - 19*T*sqrt(T*(-2 + 3*T + 2*Power(T,2)))*(3 + 5*T + 2*Power(T,2)) + 12*Power(T,2)*sqrt(T*(-2 + 3*T + 2*Power(T,2)))*(3 + 5*T + 2*Power(T,2)) + 4*Power(T,3)*sqrt(T*(-2 + 3*T + 2*Power(T,2)))*(3 + 5*T + 2*Power(T,2)) + 12*sqrt(T*(2 + T)*Power(-1 + 2*T,3)*Power(3 + 5*T + 2*Power(T,2),2))))/(T*(-2 + 3*T + 2*Power(T,2))*Power(3 + 5*T + 2*Power(T,2),2.5)));
+          case 106: return (sqrt(3)*(-1 + T)*(-6*sqrt(((1 + 2*S(ss1))*(1 + T))/(T*(-1 + 2*T))) + 16*sqrt(((1 + 2*S(ss1))*T*(1 + T))/(-1 + 2*T)) - 8*sqrt(((1 + 2*S(ss1))*Power(T,3)*(1 + T))/(-1 + 2*T)) - 3*sqrt(((1 + 2*S(ss1))*(-1 + T + 2*Power(T,2)))/T) + 6*sqrt((1 + 2*S(ss1))*T*(-1 + T + 2*Power(T,2))) + 2*T*sqrt((1 + 2*S(ss1))*T*(-1 + T + 2*Power(T,2))) - 2*sqrt((1 + 2*S(ss1))*Power(T,3)*(-1 + T + 2*Power(T,2)))))/(Power(1 + 2*S(ss1),1.5)*sqrt(T*(-3 + T + 2*Power(T,2)))*(-1 + T + 2*Power(T,2)));
+          case 107: return -((sqrt(1 + T)*(-1 + 2*T)*(-9*sqrt((1 + 2*S(ss1))*T*(-3 + 4*T + 4*Power(T,2))) - 3*T*sqrt((1 + 2*S(ss1))*T*(-3 + 4*T + 4*Power(T,2))) - 7*Power(T,2)*sqrt((1 + 2*S(ss1))*T*(-3 + 4*T + 4*Power(T,2))) + 2*Power(T,3)*sqrt((1 + 2*S(ss1))*T*(-3 + 4*T + 4*Power(T,2))) + 12*sqrt((1 + 2*S(ss1))*Power(T,5)*(-3 + 4*T + 4*Power(T,2)))))/Power((1 + 2*S(ss1))*T*(-3 + T + 8*Power(T,2) + 4*Power(T,3)),1.5));
+          case 108: return -(sqrt((-6 + 9*T + 6*Power(T,2))/(T*(3 + 2*T)))/((1 + 2*S(ss1))*(1 + T)));
+          case 109: return (sqrt(3 + 3/T)*(6*sqrt((-6 + 5*T + 12*Power(T,2) + 4*Power(T,3))/(1 + 2*T)) + 3*T*sqrt((-6 + 5*T + 12*Power(T,2) + 4*Power(T,3))/(1 + 2*T)) - 6*Power(T,2)*sqrt((-6 + 5*T + 12*Power(T,2) + 4*Power(T,3))/(1 + 2*T)) + 4*T*sqrt(-6 - 7*T + 22*Power(T,2) + 28*Power(T,3) + 8*Power(T,4))))/((2 + T)*Power(3 + 5*T + 2*Power(T,2),1.5));
+          case 110: return -((-2 + 2*T + Power(T,2))/((1 + T)*sqrt(T*(2 + T))));
+          case 111: return -((sqrt(2)*(45*T*sqrt((T*(3 + 5*T + 2*Power(T,2)))/(5 + 2*T)) + 2*(sqrt((Power(T,3)*Power(1 + T,3)*Power(1 + 2*T,2)*(3 + 2*T))/(5 + 2*T)) + 15*sqrt((T*(3 + 5*T + 2*Power(T,2)))/(5 + 2*T)) + 9*sqrt((Power(T,5)*(3 + 5*T + 2*Power(T,2)))/(5 + 2*T)))))/((1 + T)*sqrt(T*(5 + 2*T))*Power(6 + 7*T + 2*Power(T,2),1.5)));
+          case 112: return -((sqrt(3 + 3/T)*(-6*sqrt(((2 + T)*(-3 + 4*T + 4*Power(T,2)))/(1 + 2*T)) - 3*T*sqrt(((2 + T)*(-3 + 4*T + 4*Power(T,2)))/(1 + 2*T)) + 6*Power(T,2)*sqrt(((2 + T)*(-3 + 4*T + 4*Power(T,2)))/(1 + 2*T)) - 4*T*sqrt((3 + 2*T)*(-2 - T + 8*Power(T,2) + 4*Power(T,3)))))/((1 + 2*S(ss1))*(2 + T)*Power(3 + 5*T + 2*Power(T,2),1.5)));
+          case 113: return (5*Power(T,2)*sqrt((1 + 2*S(ss1))*T*(1 + T)) - 2*Power(T,4)*sqrt((1 + 2*S(ss1))*T*(1 + T)) - 3*(4*sqrt(((1 + 2*S(ss1))*Power(1 - 2*T,2)*T)/(1 + T)) + 7*sqrt(((1 + 2*S(ss1))*Power(T,5))/(1 + T)) + 9*sqrt(((1 + 2*S(ss1))*Power(T,7))/(1 + T))) + Power(T,3)*(sqrt((1 + 2*S(ss1))*T*(1 + T)) - 6*sqrt(((1 + 2*S(ss1))*T*Power(1 + 2*T,2))/(1 + T))) + 2*T*(sqrt((1 + 2*S(ss1))*T*(1 + T)) + 18*sqrt((T + 2*S(ss1)*T)/(1 + T))))/(T*(3 + 2*T)*Power((1 + 2*S(ss1))*(2 + 3*T + Power(T,2)),1.5));
+          case 114: return -((sqrt(2)*(45*T*sqrt((T*(3 + 5*T + 2*Power(T,2)))/(5 + 2*T)) + 2*(sqrt((Power(T,3)*Power(1 + T,3)*Power(1 + 2*T,2)*(3 + 2*T))/(5 + 2*T)) + 15*sqrt((T*(3 + 5*T + 2*Power(T,2)))/(5 + 2*T)) + 9*sqrt((Power(T,5)*(3 + 5*T + 2*Power(T,2)))/(5 + 2*T)))))/((1 + 2*S(ss1))*(1 + T)*sqrt(T*(5 + 2*T))*Power(6 + 7*T + 2*Power(T,2),1.5)));
+          case 115: return (sqrt(2)*(5*sqrt(T*(1 + T)) + 2*sqrt(Power(T,3)*(1 + T))))/((1 + T)*sqrt(T*(5 + 2*T)*(6 + 7*T + 2*Power(T,2))));
+          case 116: return -((3 + T)/sqrt(11 + 6/T + 6*T + Power(T,2)));
+          case 117: return (sqrt((2 + 4*T)/(5*T + 2*Power(T,2)))*(2*(1 + 2*S(ss1))*sqrt((T*(1 + T)*(1 + 2*T))/(2 + T))*Power(3 + 2*T,1.5)*(2 + 3*T + Power(T,2)) - (1 + 2*S(ss1))*T*sqrt((T*(1 + T)*(1 + 2*T))/(2 + T))*Power(3 + 2*T,1.5)*(2 + 3*T + Power(T,2)) - 9*(1 + 2*S(ss1))*Power(T,1.5)*sqrt((1 + T)*(1 + 2*T)*(6 + 7*T + 2*Power(T,2))) + 6*(1 + 2*S(ss1))*sqrt(T*(1 + T)*(1 + 2*T)*(6 + 7*T + 2*Power(T,2))) - 6*(1 + 2*S(ss1))*Power(T,1.5)*sqrt((1 + 3*T + 2*Power(T,2))/(6 + 7*T + 2*Power(T,2)))*(6 + 13*T + 9*Power(T,2) + 2*Power(T,3)) + 6*(1 + 2*S(ss1))*sqrt((T*(1 + 3*T + 2*Power(T,2)))/(6 + 7*T + 2*Power(T,2)))*(6 + 13*T + 9*Power(T,2) + 2*Power(T,3)) - 6*(1 + 2*S(ss1))*(-1 + 2*T)*sqrt((T*(6 + 13*T + 9*Power(T,2) + 2*Power(T,3)))/(1 + 2*T)) + sqrt(Power(1 + 2*S(ss1),2)*T*(1 + 2*T)*Power(6 + 13*T + 9*Power(T,2) + 2*Power(T,3),3))))/(Power(1 + 2*S(ss1),2)*(1 + T)*Power(6 + 7*T + 2*Power(T,2),2));
+          case 118: return -(((3 + T)*sqrt(T/(6 + 11*T + 6*Power(T,2) + Power(T,3))))/(1 + 2*S(ss1)));
+          case 119: return (-2*sqrt((S(ss1)*(1 + S(ss1))*(-2 - T + Power(T,2)))/((-1 + T)*T)))/(1 + 2*S(ss1));
+          case 120: return (-2*sqrt(2)*sqrt((S(ss1)*(1 + S(ss1))*(-3 + 2*T))/(T*(1 - 3*T + 2*Power(T,2)))))/(1 + 2*S(ss1));
+          case 121: return (2*sqrt(2)*sqrt((1 + S(ss1))/T)*(2*sqrt(S(ss1)/(-1 + T)) + 2*S(ss1)*sqrt(S(ss1)/(-1 + T)) + sqrt(S(ss1)*(-1 + T)) - sqrt(S(ss1)/(-1 + T))*T))/Power(1 + 2*S(ss1),2);
+          case 122: return (-2*(1 + S(ss1))*(-3*(2*sqrt(S(ss1)/((1 + S(ss1))*(-1 + T))) + sqrt((S(ss1)*(-1 + T))/(1 + S(ss1)))) + (4*sqrt(S(ss1)/((1 + S(ss1))*(-1 + T))) + sqrt((S(ss1)*(-1 + T))/(1 + S(ss1))))*T))/(sqrt(1 + T)*(T + 2*S(ss1)*T));
+          case 123: return (-2*sqrt(3)*(1 + S(ss1))*(6*sqrt((S(ss1)*(-1 + T))/((1 + S(ss1))*(3 + 8*T + 4*Power(T,2)))) + 3*sqrt(S(ss1)/((1 + S(ss1))*(-3 - 5*T + 4*Power(T,2) + 4*Power(T,3)))) - 5*T*sqrt(S(ss1)/((1 + S(ss1))*(-3 - 5*T + 4*Power(T,2) + 4*Power(T,3)))) + 2*Power(T,2)*sqrt(S(ss1)/((1 + S(ss1))*(-3 - 5*T + 4*Power(T,2) + 4*Power(T,3))))))/(sqrt(1 + T)*(T + 2*S(ss1)*T));
+          case 124: return (2*sqrt(3)*(1 + S(ss1))*(3*sqrt((S(ss1)*(-1 + T))/((1 + S(ss1))*(-3 + 4*T + 4*Power(T,2)))) + 2*Power(T,3)*sqrt(S(ss1)/((1 + S(ss1))*(3 - 7*T + 4*Power(T,3)))) + T*(3*sqrt((S(ss1)*(-1 + T))/((1 + S(ss1))*(-3 + 4*T + 4*Power(T,2)))) + sqrt(S(ss1)/((1 + S(ss1))*(3 - 7*T + 4*Power(T,3))))) - Power(T,2)*(2*sqrt((S(ss1)*(-1 + T))/((1 + S(ss1))*(-3 + 4*T + 4*Power(T,2)))) + 3*sqrt(S(ss1)/((1 + S(ss1))*(3 - 7*T + 4*Power(T,3)))))))/(sqrt(1 + T)*(T + 2*S(ss1)*T));
+          case 125: return -0.5*(sqrt(1 + T)*(36*sqrt((S(ss1)*Power(-1 + T,2))/((1 + S(ss1))*Power(T,2)*Power(1 + T,3)*Power(3 + 2*T,2))) + (36*sqrt(S(ss1)/(1 + S(ss1)))*(-1 + T))/((1 + 2*S(ss1))*T*Power(1 + T,1.5)*(3 + 2*T)) + (2*sqrt(S(ss1)/(1 + S(ss1)))*(-3 + T)*(-1 + 2*T))/(Power(1 + T,1.5)*(3 + 2*T)) + (2*(-3 + T)*(-1 + 2*T))/(sqrt(((1 + S(ss1))*Power(1 + 2*S(ss1),2)*(1 + T))/S(ss1))*(3 + 5*T + 2*Power(T,2))) + (6*(-3 + 2*T)*(-1 + 2*T)*sqrt(S(ss1)/(1 + S(ss1) + T + S(ss1)*T)))/(T*(3 + 5*T + 2*Power(T,2))) + (6*(-3 + 2*T)*(-1 + 2*T))/(sqrt(((1 + S(ss1))*(1 + T)*Power(T + 2*S(ss1)*T,2))/S(ss1))*(3 + 5*T + 2*Power(T,2)))));
+          case 126: return -(sqrt(3)*sqrt(1 + T)*(12*sqrt((S(ss1)*(-1 + 2*T))/((1 + S(ss1))*T*(2 + T)*Power(3 + 5*T + 2*Power(T,2),3))) + 2*(-1 + T)*T*(-1 + 2*T)*sqrt(S(ss1)/((1 + S(ss1))*T*(-2 + 3*T + 2*Power(T,2))*Power(3 + 5*T + 2*Power(T,2),3))) + 3*(-1 + 2*T)*(-2 + 3*T)*sqrt(S(ss1)/((1 + S(ss1))*T*(-2 + 3*T + 2*Power(T,2))*Power(3 + 5*T + 2*Power(T,2),3))) + (12*sqrt((S(ss1)*(-1 + 2*T))/((1 + S(ss1))*Power(1 + 2*S(ss1),2)*T*(6 + 13*T + 9*Power(T,2) + 2*Power(T,3)))))/(3 + 5*T + 2*Power(T,2)) + (2*(-1 + T)*T*(-1 + 2*T)*sqrt(S(ss1)/((1 + S(ss1))*Power(1 + 2*S(ss1),2)*T*(-6 - T + 17*Power(T,2) + 16*Power(T,3) + 4*Power(T,4)))))/(3 + 5*T + 2*Power(T,2)) + (3*(-1 + 2*T)*(-2 + 3*T)*sqrt(S(ss1)/((1 + S(ss1))*Power(1 + 2*S(ss1),2)*T*(-6 - T + 17*Power(T,2) + 16*Power(T,3) + 4*Power(T,4)))))/(3 + 5*T + 2*Power(T,2))));
+          case 127: return -0.5*(sqrt(3)*sqrt(1 + T)*(12/sqrt(((1 + S(ss1))*Power(1 + 2*S(ss1),2)*T*Power(1 + T,3)*(2 + T)*(1 + 2*T)*Power(3 + 2*T,2))/(S(ss1)*Power(-1 + T,2)*(-1 + 2*T))) - (2*T*(-1 + 2*T))/sqrt(((1 + S(ss1))*T*(2 + T)*Power(3 + 2*T,2)*(-1 + T + 2*Power(T,2)))/(S(ss1) + 2*S(ss1)*T)) + 2*T*(3 - 7*T + 2*Power(T,2))*sqrt((S(ss1)*(1 + 2*T))/((1 + S(ss1))*T*Power(1 + T,3)*Power(3 + 2*T,2)*(-2 + 3*T + 2*Power(T,2)))) + 2*T*(3 - 7*T + 2*Power(T,2))*sqrt((S(ss1)*(1 + 2*T))/((1 + S(ss1))*Power(1 + 2*S(ss1),2)*T*Power(1 + T,3)*Power(3 + 2*T,2)*(-2 + 3*T + 2*Power(T,2)))) + 6*T*(-3 + 2*T)*sqrt((S(ss1)*(-1 + 2*T))/((1 + S(ss1))*T*Power(1 + T,3)*Power(3 + 2*T,2)*(2 + 5*T + 2*Power(T,2)))) + 12*sqrt((S(ss1)*Power(-1 + T,2)*(-1 + 2*T))/((1 + S(ss1))*T*Power(1 + T,3)*Power(3 + 2*T,2)*(2 + 5*T + 2*Power(T,2)))) + (6*(-3 + 2*T))/(sqrt(((1 + S(ss1))*Power(1 + 2*S(ss1),2)*(2 + T)*(1 + 3*T + 2*Power(T,2)))/(S(ss1)*T*(-1 + 2*T)))*(3 + 5*T + 2*Power(T,2))) - 2*T*(-1 + 2*T)*sqrt((S(ss1)*(1 + 2*T))/((1 + S(ss1))*Power(1 + 2*S(ss1),2)*T*Power(3 + 2*T,2)*(-2 + T + 5*Power(T,2) + 2*Power(T,3))))));
+          case 128: return -0.5*(sqrt(1 + T)*((2*(-2 + T)*T)/sqrt(((1 + S(ss1))*T*(1 + T)*Power(2 + T,3)*Power(3 + 2*T,2))/(S(ss1)*Power(1 + 2*T,2))) + 2*(-2 + T)*T*sqrt((S(ss1)*Power(1 + 2*T,2))/((1 + S(ss1))*Power(1 + 2*S(ss1),2)*Power(2 + T,3)*Power(3 + 2*T,2)*(T + Power(T,2)))) + 18*T*(-2 + 3*T)*sqrt(S(ss1)/((1 + S(ss1))*T*Power(3 + 2*T,2)*Power(2 + 3*T + Power(T,2),3))) + 12*(-1 + T)*T*sqrt((S(ss1)*Power(1 + 2*T,2))/((1 + S(ss1))*T*Power(3 + 2*T,2)*Power(2 + 3*T + Power(T,2),3))) + (12*(-1 + T)*sqrt((S(ss1)*T)/(1 + S(ss1)))*(1 + 2*T))/((1 + 2*S(ss1))*(3 + 2*T)*Power(2 + 3*T + Power(T,2),1.5)) + (24*(-1 + 2*T)*sqrt(S(ss1)/(T + S(ss1)*T)))/((3 + 2*T)*Power(2 + 3*T + Power(T,2),1.5)) + (18*(-2 + 3*T))/(sqrt(((1 + S(ss1))*Power(1 + 2*S(ss1),2)*(2 + 3*T + Power(T,2)))/(S(ss1)*T))*(6 + 13*T + 9*Power(T,2) + 2*Power(T,3))) + (24*(-1 + 2*T))/((1 + 2*S(ss1))*sqrt(((1 + S(ss1))*T*(2 + 3*T + Power(T,2)))/S(ss1))*(6 + 13*T + 9*Power(T,2) + 2*Power(T,3)))));
+          case 129: return -(sqrt(2)*T*sqrt(((1 + 2*S(ss1))*Power(1 + 2*T,2))/(Power(1 + S(ss1),5)*Power(T,4)*Power(1 + T,3)*(5 + 2*T)*Power(6 + 7*T + 2*Power(T,2),6)))*(2*sqrt((S(ss1)*Power(1 + S(ss1),4)*Power(T,4)*Power(2 + T,3)*Power(3 + 5*T + 2*Power(T,2),4))/((1 + 2*S(ss1))*(5 + 2*T))) + (9*Power(1 + S(ss1),2)*Power(T,2)*(1 + T)*Power(6 + 7*T + 2*Power(T,2),2)*sqrt(S(ss1)/(10 + 9*T + 2*Power(T,2))))/Power(1 + 2*S(ss1),1.5) + (2*Power(1 + S(ss1),2)*Power(T,2)*Power(1 + T,2)*Power(6 + 7*T + 2*Power(T,2),2)*sqrt(S(ss1)/(10 + 9*T + 2*Power(T,2))))/Power(1 + 2*S(ss1),1.5) + (30*Power(1 + S(ss1),2)*T*(1 + T)*Power(6 + 7*T + 2*Power(T,2),2)*sqrt(S(ss1)/(10 + 9*T + 2*Power(T,2))))/(Power(1 + 2*S(ss1),1.5)*(1 + 2*T)) + (36*Power(1 + S(ss1),2)*Power(T,2)*(1 + T)*Power(6 + 7*T + 2*Power(T,2),2)*sqrt(S(ss1)/(10 + 9*T + 2*Power(T,2))))/(Power(1 + 2*S(ss1),1.5)*(1 + 2*T)) + 9*Power(1 + S(ss1),2)*Power(T,2)*(1 + T)*Power(6 + 7*T + 2*Power(T,2),2)*sqrt(S(ss1)/((1 + 2*S(ss1))*(10 + 9*T + 2*Power(T,2)))) + (30*Power(1 + S(ss1),2)*T*(1 + T)*Power(6 + 7*T + 2*Power(T,2),2)*sqrt(S(ss1)/((1 + 2*S(ss1))*(10 + 9*T + 2*Power(T,2)))))/(1 + 2*T) + (36*Power(1 + S(ss1),2)*Power(T,2)*(1 + T)*Power(6 + 7*T + 2*Power(T,2),2)*sqrt(S(ss1)/((1 + 2*S(ss1))*(10 + 9*T + 2*Power(T,2)))))/(1 + 2*T)));
+          case 130: return -(sqrt(2)*sqrt(1 + T)*((6*(-1 + T)*(1 + 2*T)*sqrt(S(ss1)/((1 + S(ss1))*(5 + 2*T))))/Power(6 + 7*T + 2*Power(T,2),1.5) + (6*(-1 + T)*(1 + 2*T)*sqrt(S(ss1)/((1 + S(ss1))*(5 + 2*T))))/((1 + 2*S(ss1))*Power(6 + 7*T + 2*Power(T,2),1.5)) + (3*(1 + 2*T)*sqrt(S(ss1)/((1 + S(ss1))*(5 + 2*T)))*(-2 + 3*T))/((1 + T)*Power(6 + 7*T + 2*Power(T,2),1.5)) + (3*(1 + 2*T)*sqrt(S(ss1)/((1 + S(ss1))*(5 + 2*T)))*(-2 + 3*T))/((1 + 2*S(ss1))*(1 + T)*Power(6 + 7*T + 2*Power(T,2),1.5)) + ((-2 + T)*(1 + 2*T)*sqrt(S(ss1)/((1 + S(ss1))*(15 + 16*T + 4*Power(T,2)))))/Power(2 + T,1.5) - (1 + 2*T)*sqrt(S(ss1)/((1 + S(ss1))*(30 + 47*T + 24*Power(T,2) + 4*Power(T,3)))) - ((1 + 2*T)*sqrt(S(ss1)/((1 + S(ss1))*(30 + 47*T + 24*Power(T,2) + 4*Power(T,3)))))/(1 + 2*S(ss1)) + ((-2 + T)*(1 + 2*T)*sqrt(S(ss1)/((1 + S(ss1))*(30 + 47*T + 24*Power(T,2) + 4*Power(T,3)))))/((1 + 2*S(ss1))*(2 + T)) + (6*(-1 + 2*T)*sqrt(S(ss1)/((1 + S(ss1))*(30 + 47*T + 24*Power(T,2) + 4*Power(T,3)))))/((1 + T)*(6 + 7*T + 2*Power(T,2))) + (6*(-1 + 2*T)*sqrt(S(ss1)/((1 + S(ss1))*(30 + 47*T + 24*Power(T,2) + 4*Power(T,3)))))/((1 + 2*S(ss1))*(6 + 13*T + 9*Power(T,2) + 2*Power(T,3)))));
+          case 131: return (sqrt(((1 + T)*(1 + 2*T))/(1 + 2*S(ss1)))*(-60*sqrt((S(ss1)*(1 + S(ss1))*T*(5 + 2*T))/((1 + 2*S(ss1))*(1 + 2*T)*(6 + 5*T + Power(T,2)))) - 60*sqrt((S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*T*(5 + 2*T))/((1 + 2*T)*(6 + 5*T + Power(T,2)))) - 48*sqrt((S(ss1)*(1 + S(ss1))*T*(1 + 2*T)*(5 + 2*T))/((1 + 2*S(ss1))*(6 + 5*T + Power(T,2)))) - 36*(1 + T)*sqrt((S(ss1)*(1 + S(ss1))*T*(1 + 2*T)*(5 + 2*T))/((1 + 2*S(ss1))*(6 + 5*T + Power(T,2)))) - 8*(1 + T)*(3 + 2*T)*sqrt((S(ss1)*(1 + S(ss1))*T*(1 + 2*T)*(5 + 2*T))/((1 + 2*S(ss1))*(6 + 5*T + Power(T,2)))) - 36*(1 + T)*sqrt((S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*T*(1 + 2*T)*(5 + 2*T))/(6 + 5*T + Power(T,2))) - 8*(1 + T)*(3 + 2*T)*sqrt((S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*T*(1 + 2*T)*(5 + 2*T))/(6 + 5*T + Power(T,2))) - 48*sqrt((S(ss1)*(1 + 3*S(ss1) + 2*Power(S(ss1),2))*T*(1 + 2*T)*(5 + 2*T))/(6 + 5*T + Power(T,2))) - 2*(3 + 5*T + 2*Power(T,2))*sqrt((S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*T*(1 + 2*T)*(10 + 9*T + 2*Power(T,2)))/(3 + T)) - 2*(3 + 5*T + 2*Power(T,2))*sqrt((S(ss1)*(1 + S(ss1))*T*(10 + 29*T + 20*Power(T,2) + 4*Power(T,3)))/((1 + 2*S(ss1))*(3 + T)))))/(2.*(1 + S(ss1))*Power(5 + 2*T,1.5)*(6 + 13*T + 9*Power(T,2) + 2*Power(T,3)));
+          case 132: return sqrt(-1 + Power(T,2))/T;
+          case 133: return sqrt((-1 + 2*T)/(1 + 2*T))/T;
+          case 134: return sqrt((-1 + Power(T,2))/((S(ss1) + 2*Power(S(ss1),2))*Power(T,2)));
+          case 135: return sqrt((-1 + 2*T)/((S(ss1) + 2*Power(S(ss1),2))*(1 + 2*T)))/T;
+          case 136: return -(1/T);
+          case 137: return (-1 + T + Power(T,2))/(T*(1 + T));
+          case 138: return 1/(1 + T);
+          case 139: return -(1/(sqrt(S(ss1)*(1 + 2*S(ss1)))*T));
+          case 140: return (-1 + T + Power(T,2))/(sqrt(S(ss1)*(1 + 2*S(ss1)))*T*(1 + T));
+          case 141: return 1/(sqrt(S(ss1)*(1 + 2*S(ss1)))*(1 + T));
+          case 142: return (-3 - 2*T)/((1 + T)*sqrt(3 + 8*T + 4*Power(T,2)));
+          case 143: return sqrt(1 + T)*(2*sqrt((T*Power(1 + 2*T,2))/(Power(1 + T,3)*(2 + T)*Power(3 + 2*T,2))) + ((1 + 2*T)*sqrt(T/(2 + 3*T + Power(T,2))))/(3 + 2*T) + (3*sqrt(T/(2 + 3*T + Power(T,2))))/(3 + 5*T + 2*Power(T,2)));
+          case 144: return (-2*sqrt((1 + 2*S(ss1))*T*(1 + 2*T)) + (-1 + 2*T)*sqrt((T + 2*S(ss1)*T)/(1 + 2*T)))/((1 + 2*S(ss1))*(1 + T)*sqrt(S(ss1)*T*(3 + 2*T)));
+          case 145: return (sqrt((T*(1 + T))/(2 + T)) + 5*sqrt(T/(2 + 3*T + Power(T,2))) + 2*T*(sqrt((T*(1 + T))/(2 + T)) + 2*sqrt(T/(2 + 3*T + Power(T,2)))))/(sqrt((S(ss1)*(1 + 2*S(ss1)))/(1 + T))*(3 + 5*T + 2*Power(T,2)));
+          case 146: return (sqrt(((-1 + 2*S(ss1))*(-1 + T))/((S(ss1) + 2*Power(S(ss1),2))*T)) - sqrt((S(ss1) - S(ss1)*T)/(T - 4*Power(S(ss1),2)*T)) + 2*S(ss1)*sqrt((S(ss1) - S(ss1)*T)/(T - 4*Power(S(ss1),2)*T)))/sqrt(((1 + S(ss1))*T)/(1 + T));
+          case 147: return (-sqrt((S(ss1)*(-1 + 2*T))/((-1 + 4*Power(S(ss1),2))*T*(1 + T))) + 2*S(ss1)*sqrt((S(ss1)*(-1 + 2*T))/((-1 + 4*Power(S(ss1),2))*T*(1 + T))) + sqrt(((-1 + 2*S(ss1))*(-1 + 2*T))/(S(ss1)*(1 + 2*S(ss1))*(T + Power(T,2)))))/sqrt(((1 + S(ss1))*T*(1 + 2*T))/(1 + T));
+          case 148: return 1/sqrt(((1 + S(ss1))*(1 + 2*S(ss1))*Power(T,2))/(-1 + Power(T,2)));
+          case 149: return 1/sqrt(((1 + S(ss1))*(1 + 2*S(ss1))*Power(T,2)*(1 + 2*T))/(-1 + 2*T));
+          case 150: return -((sqrt(-1 - 1/S(ss1) + 4*S(ss1) + 4*Power(S(ss1),2)) + sqrt(S(ss1)*(-1 - S(ss1) + 4*Power(S(ss1),2) + 4*Power(S(ss1),3))))/((1 + S(ss1))*(1 + 2*S(ss1))*T));
+          case 151: return ((-1 + 2*S(ss1))*(-1 + T))/(sqrt(((1 + S(ss1))*(-1 + 4*Power(S(ss1),2)))/S(ss1))*(1 + T)) + (sqrt(-1 + 2*S(ss1))*(-1 + T))/(sqrt(S(ss1) + 3*Power(S(ss1),2) + 2*Power(S(ss1),3))*(1 + T)) + (S(ss1)*(-1 + 2*S(ss1))*(-1 + 2*T))/(sqrt(S(ss1)*(1 + S(ss1))*(-1 + 4*Power(S(ss1),2)))*T*(1 + T)) + (-1 + 2*T)/(sqrt((S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1)))/(-1 + 2*S(ss1)))*(T + Power(T,2)));
+          case 152: return (-sqrt(((1 + 3*S(ss1) + 2*Power(S(ss1),2))*(1 + T))/S(ss1)) + sqrt(S(ss1)*(1 + 3*S(ss1) + 2*Power(S(ss1),2))*(1 + T)) + 2*S(ss1)*sqrt(S(ss1)*(1 + 3*S(ss1) + 2*Power(S(ss1),2))*(1 + T)))/((1 + S(ss1))*sqrt(-1 + 2*S(ss1))*(1 + 2*S(ss1))*Power(1 + T,1.5));
+          case 153: return -(1/(sqrt((1 + S(ss1))*(1 + 2*S(ss1)))*T));
+          case 154: return (-sqrt((1 + S(ss1))/(1 + 2*S(ss1) + T + 2*S(ss1)*T)) + T*(-sqrt(((1 + S(ss1))*(1 + T))/(1 + 2*S(ss1))) + sqrt((1 + S(ss1))/(1 + 2*S(ss1) + T + 2*S(ss1)*T))) + Power(T,2)*(sqrt(((1 + S(ss1))*(1 + T))/(1 + 2*S(ss1))) + 2*sqrt((1 + S(ss1))/(1 + 2*S(ss1) + T + 2*S(ss1)*T))))/((1 + S(ss1))*T*Power(1 + T,1.5));
+          case 155: return 1/(sqrt(1 + 3*S(ss1) + 2*Power(S(ss1),2))*(1 + T));
+          case 156: return sqrt(1 + T)*(-(1/sqrt((S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*(1 + T)*(3 + 2*T))/((-1 + 2*S(ss1))*(1 + 2*T)))) + (S(ss1) - 2*Power(S(ss1),2))/sqrt((S(ss1)*(1 + S(ss1))*(-1 + 4*Power(S(ss1),2))*(1 + T)*(3 + 2*T))/(1 + 2*T)) + (-1 + T)/sqrt((S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*Power(1 + T,3)*(3 + 2*T))/((-1 + 2*S(ss1))*(1 + 2*T))) + ((-1 + 2*S(ss1))*(-1 + T))/sqrt(((1 + S(ss1))*(-1 + 4*Power(S(ss1),2))*Power(1 + T,3)*(3 + 2*T))/(S(ss1) + 2*S(ss1)*T)) + sqrt(((-1 + 2*S(ss1))*Power(1 - 2*T,2))/(S(ss1)*(1 + 3*S(ss1) + 2*Power(S(ss1),2))*Power(1 + T,3)*(3 + 8*T + 4*Power(T,2)))) + (-1 + 2*S(ss1))*sqrt((S(ss1)*Power(1 - 2*T,2))/((-1 - S(ss1) + 4*Power(S(ss1),2) + 4*Power(S(ss1),3))*Power(1 + T,3)*(3 + 8*T + 4*Power(T,2)))));
+          case 157: return (-6*sqrt(((1 + 2*S(ss1))*T*(3 + 2*T))/(S(ss1)*(2 + T))) - 2*Power(T,2)*sqrt(((1 + 2*S(ss1))*T*(3 + 2*T))/(S(ss1)*(2 + T))) + 6*sqrt((S(ss1)*(1 + 2*S(ss1))*T*(3 + 2*T))/(2 + T)) + 12*sqrt((Power(S(ss1),3)*(1 + 2*S(ss1))*T*(3 + 2*T))/(2 + T)) + 2*sqrt((S(ss1)*(1 + 2*S(ss1))*Power(T,5)*(3 + 2*T))/(2 + T)) + 4*sqrt((Power(S(ss1),3)*(1 + 2*S(ss1))*Power(T,5)*(3 + 2*T))/(2 + T)) + 7*T*(-sqrt(((1 + 2*S(ss1))*T*(3 + 2*T))/(S(ss1)*(2 + T))) + sqrt((S(ss1)*(1 + 2*S(ss1))*T*(3 + 2*T))/(2 + T)) + 2*sqrt((Power(S(ss1),3)*(1 + 2*S(ss1))*T*(3 + 2*T))/(2 + T))))/((1 + 2*S(ss1))*sqrt((-1 + S(ss1) + 2*Power(S(ss1),2))/(1 + T))*Power(3 + 5*T + 2*Power(T,2),1.5));
+          case 158: return -((sqrt(((1 + S(ss1))*(1 + T))/(1 + 2*T)) - 2*T*sqrt(((1 + S(ss1))*(1 + T))/(1 + 2*T)) + 2*sqrt((1 + S(ss1))*(1 + 3*T + 2*Power(T,2))))/((1 + S(ss1))*(1 + T)*sqrt((1 + 2*S(ss1))*(1 + T)*(3 + 2*T))));
+          case 159: return sqrt((T*(2 + T))/(1 + 3*S(ss1) + 2*Power(S(ss1),2)))/(1 + T);
+          case 160: return (sqrt((S(ss1)*(1 + 2*S(ss1))*(-1 + T))/T) + sqrt((S(ss1)*(1 + 2*S(ss1))*(-1 + T))/(Power(1 + S(ss1),2)*T)) + sqrt((S(ss1)*(-1 + T))/(Power(1 + S(ss1),2)*(T + 2*S(ss1)*T))))/sqrt(((3 + 5*S(ss1) + 2*Power(S(ss1),2))*T)/(1 + T));
+          case 161: return (3 + 2*S(ss1))/sqrt(((1 + 2*S(ss1))*(3 + 5*S(ss1) + 2*Power(S(ss1),2))*Power(T,2)*(1 + 2*T))/(S(ss1)*(-1 + 2*T)));
+          case 162: return -((3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 8*S(ss1) + 4*Power(S(ss1),2))*Power(T,2))/S(ss1)));
+          case 163: return ((3 + 2*S(ss1))*sqrt(S(ss1)/(3 + 11*S(ss1) + 12*Power(S(ss1),2) + 4*Power(S(ss1),3)))*(-1 + T + Power(T,2)))/(T*(1 + T));
+          case 164: return ((3 + 2*S(ss1))*sqrt(S(ss1)/(3 + 11*S(ss1) + 12*Power(S(ss1),2) + 4*Power(S(ss1),3))))/(1 + T);
+          case 165: return -(((1 + 2*S(ss1))*sqrt((S(ss1)*(1 + S(ss1))*(1 + 2*T))/(1 + T)) - (1 + 2*S(ss1))*T*sqrt((S(ss1)*(1 + S(ss1))*(1 + 2*T))/(1 + T)) + sqrt((S(ss1)*(1 + T)*(1 + 2*T))/(1 + S(ss1))) + (1 + 2*S(ss1))*sqrt((S(ss1)*(1 + T)*(1 + 2*T))/(1 + S(ss1))) + (1 + 2*S(ss1))*sqrt(S(ss1)*(1 + S(ss1))*(1 + T)*(1 + 2*T)) + sqrt((S(ss1) + 2*S(ss1)*T)/(1 + S(ss1) + T + S(ss1)*T)) + (1 + 2*S(ss1))*sqrt((S(ss1) + 2*S(ss1)*T)/(1 + S(ss1) + T + S(ss1)*T)) - T*sqrt((S(ss1) + 2*S(ss1)*T)/(1 + S(ss1) + T + S(ss1)*T)) - (1 + 2*S(ss1))*T*sqrt((S(ss1) + 2*S(ss1)*T)/(1 + S(ss1) + T + S(ss1)*T)) + (1 - 2*T)*sqrt(S(ss1)/((1 + S(ss1))*(1 + 3*T + 2*Power(T,2)))) - (1 + 2*S(ss1))*(-1 + 2*T)*sqrt(S(ss1)/((1 + S(ss1))*(1 + 3*T + 2*Power(T,2)))) - (1 + 2*S(ss1))*(-1 + 2*T)*sqrt((S(ss1)*(1 + S(ss1)))/(1 + 3*T + 2*Power(T,2))))/((1 + S(ss1))*sqrt((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(1 + T)*(3 + 2*T))));
+          case 166: return -((sqrt((1 + T)/(3 + 8*S(ss1) + 4*Power(S(ss1),2)))*(-(sqrt((S(ss1)*T*(1 + T))/((1 + S(ss1))*(2 + T)))*(1 + 2*T)) - (1 + 2*S(ss1))*sqrt((S(ss1)*T*(1 + T))/((1 + S(ss1))*(2 + T)))*(1 + 2*T) - (1 + 2*S(ss1))*sqrt((S(ss1)*(1 + S(ss1))*T*(1 + T))/(2 + T))*(1 + 2*T) - 3*sqrt((S(ss1)*T)/((1 + S(ss1))*(2 + 3*T + Power(T,2)))) - 3*(1 + 2*S(ss1))*sqrt((S(ss1)*T)/((1 + S(ss1))*(2 + 3*T + Power(T,2)))) - 2*(1 + 2*T)*sqrt((S(ss1)*T)/((1 + S(ss1))*(2 + 3*T + Power(T,2)))) - 2*(1 + 2*S(ss1))*(1 + 2*T)*sqrt((S(ss1)*T)/((1 + S(ss1))*(2 + 3*T + Power(T,2)))) - 3*(1 + 2*S(ss1))*sqrt((S(ss1)*(1 + S(ss1))*T)/(2 + 3*T + Power(T,2))) - 2*(1 + 2*S(ss1))*(1 + 2*T)*sqrt((S(ss1)*(1 + S(ss1))*T)/(2 + 3*T + Power(T,2)))))/((1 + S(ss1))*(3 + 5*T + 2*Power(T,2))));
+          case 167: return sqrt(-1 + Power(T,2))/T;
+          case 168: return sqrt((-1 + 2*T)/(1 + 2*T))/T;
+          case 169: return sqrt((-1 + Power(T,2))/((S(ss1) + 2*Power(S(ss1),2))*Power(T,2)));
+          case 170: return sqrt((-1 + 2*T)/((S(ss1) + 2*Power(S(ss1),2))*(1 + 2*T)))/T;
+          case 171: return -(1/T);
+          case 172: return (-1 + T + Power(T,2))/(T*(1 + T));
+          case 173: return 1/(1 + T);
+          case 174: return -(1/(sqrt(S(ss1)*(1 + 2*S(ss1)))*T));
+          case 175: return (-1 + T + Power(T,2))/(sqrt(S(ss1)*(1 + 2*S(ss1)))*T*(1 + T));
+          case 176: return 1/(sqrt(S(ss1)*(1 + 2*S(ss1)))*(1 + T));
+          case 177: return (-3 - 2*T)/((1 + T)*sqrt(3 + 8*T + 4*Power(T,2)));
+          case 178: return sqrt(1 + T)*(2*sqrt((T*Power(1 + 2*T,2))/(Power(1 + T,3)*(2 + T)*Power(3 + 2*T,2))) + ((1 + 2*T)*sqrt(T/(2 + 3*T + Power(T,2))))/(3 + 2*T) + (3*sqrt(T/(2 + 3*T + Power(T,2))))/(3 + 5*T + 2*Power(T,2)));
+          case 179: return (-2*sqrt((1 + 2*S(ss1))*T*(1 + 2*T)) + (-1 + 2*T)*sqrt((T + 2*S(ss1)*T)/(1 + 2*T)))/((1 + 2*S(ss1))*(1 + T)*sqrt(S(ss1)*T*(3 + 2*T)));
+          case 180: return (sqrt((T*(1 + T))/(2 + T)) + 5*sqrt(T/(2 + 3*T + Power(T,2))) + 2*T*(sqrt((T*(1 + T))/(2 + T)) + 2*sqrt(T/(2 + 3*T + Power(T,2)))))/(sqrt((S(ss1)*(1 + 2*S(ss1)))/(1 + T))*(3 + 5*T + 2*Power(T,2)));
+          case 181: return (sqrt(((-1 + 2*S(ss1))*(-1 + T))/((S(ss1) + 2*Power(S(ss1),2))*T)) - sqrt((S(ss1) - S(ss1)*T)/(T - 4*Power(S(ss1),2)*T)) + 2*S(ss1)*sqrt((S(ss1) - S(ss1)*T)/(T - 4*Power(S(ss1),2)*T)))/sqrt(((1 + S(ss1))*T)/(1 + T));
+          case 182: return (-sqrt((S(ss1)*(-1 + 2*T))/((-1 + 4*Power(S(ss1),2))*T*(1 + T))) + 2*S(ss1)*sqrt((S(ss1)*(-1 + 2*T))/((-1 + 4*Power(S(ss1),2))*T*(1 + T))) + sqrt(((-1 + 2*S(ss1))*(-1 + 2*T))/(S(ss1)*(1 + 2*S(ss1))*(T + Power(T,2)))))/sqrt(((1 + S(ss1))*T*(1 + 2*T))/(1 + T));
+          case 183: return 1/sqrt(((1 + S(ss1))*(1 + 2*S(ss1))*Power(T,2))/(-1 + Power(T,2)));
+          case 184: return 1/sqrt(((1 + S(ss1))*(1 + 2*S(ss1))*Power(T,2)*(1 + 2*T))/(-1 + 2*T));
+          case 185: return -((sqrt(-1 - 1/S(ss1) + 4*S(ss1) + 4*Power(S(ss1),2)) + sqrt(S(ss1)*(-1 - S(ss1) + 4*Power(S(ss1),2) + 4*Power(S(ss1),3))))/((1 + S(ss1))*(1 + 2*S(ss1))*T));
+          case 186: return ((-1 + 2*S(ss1))*(-1 + T))/(sqrt(((1 + S(ss1))*(-1 + 4*Power(S(ss1),2)))/S(ss1))*(1 + T)) + (sqrt(-1 + 2*S(ss1))*(-1 + T))/(sqrt(S(ss1) + 3*Power(S(ss1),2) + 2*Power(S(ss1),3))*(1 + T)) + (S(ss1)*(-1 + 2*S(ss1))*(-1 + 2*T))/(sqrt(S(ss1)*(1 + S(ss1))*(-1 + 4*Power(S(ss1),2)))*T*(1 + T)) + (-1 + 2*T)/(sqrt((S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1)))/(-1 + 2*S(ss1)))*(T + Power(T,2)));
+          case 187: return (-sqrt(((1 + 3*S(ss1) + 2*Power(S(ss1),2))*(1 + T))/S(ss1)) + sqrt(S(ss1)*(1 + 3*S(ss1) + 2*Power(S(ss1),2))*(1 + T)) + 2*S(ss1)*sqrt(S(ss1)*(1 + 3*S(ss1) + 2*Power(S(ss1),2))*(1 + T)))/((1 + S(ss1))*sqrt(-1 + 2*S(ss1))*(1 + 2*S(ss1))*Power(1 + T,1.5));
+          case 188: return -(1/(sqrt((1 + S(ss1))*(1 + 2*S(ss1)))*T));
+          case 189: return (-sqrt((1 + S(ss1))/(1 + 2*S(ss1) + T + 2*S(ss1)*T)) + T*(-sqrt(((1 + S(ss1))*(1 + T))/(1 + 2*S(ss1))) + sqrt((1 + S(ss1))/(1 + 2*S(ss1) + T + 2*S(ss1)*T))) + Power(T,2)*(sqrt(((1 + S(ss1))*(1 + T))/(1 + 2*S(ss1))) + 2*sqrt((1 + S(ss1))/(1 + 2*S(ss1) + T + 2*S(ss1)*T))))/((1 + S(ss1))*T*Power(1 + T,1.5));
+          case 190: return 1/(sqrt(1 + 3*S(ss1) + 2*Power(S(ss1),2))*(1 + T));
+          case 191: return sqrt(1 + T)*(-(1/sqrt((S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*(1 + T)*(3 + 2*T))/((-1 + 2*S(ss1))*(1 + 2*T)))) + (S(ss1) - 2*Power(S(ss1),2))/sqrt((S(ss1)*(1 + S(ss1))*(-1 + 4*Power(S(ss1),2))*(1 + T)*(3 + 2*T))/(1 + 2*T)) + (-1 + T)/sqrt((S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*Power(1 + T,3)*(3 + 2*T))/((-1 + 2*S(ss1))*(1 + 2*T))) + ((-1 + 2*S(ss1))*(-1 + T))/sqrt(((1 + S(ss1))*(-1 + 4*Power(S(ss1),2))*Power(1 + T,3)*(3 + 2*T))/(S(ss1) + 2*S(ss1)*T)) + sqrt(((-1 + 2*S(ss1))*Power(1 - 2*T,2))/(S(ss1)*(1 + 3*S(ss1) + 2*Power(S(ss1),2))*Power(1 + T,3)*(3 + 8*T + 4*Power(T,2)))) + (-1 + 2*S(ss1))*sqrt((S(ss1)*Power(1 - 2*T,2))/((-1 - S(ss1) + 4*Power(S(ss1),2) + 4*Power(S(ss1),3))*Power(1 + T,3)*(3 + 8*T + 4*Power(T,2)))));
+          case 192: return (-6*sqrt(((1 + 2*S(ss1))*T*(3 + 2*T))/(S(ss1)*(2 + T))) - 2*Power(T,2)*sqrt(((1 + 2*S(ss1))*T*(3 + 2*T))/(S(ss1)*(2 + T))) + 6*sqrt((S(ss1)*(1 + 2*S(ss1))*T*(3 + 2*T))/(2 + T)) + 12*sqrt((Power(S(ss1),3)*(1 + 2*S(ss1))*T*(3 + 2*T))/(2 + T)) + 2*sqrt((S(ss1)*(1 + 2*S(ss1))*Power(T,5)*(3 + 2*T))/(2 + T)) + 4*sqrt((Power(S(ss1),3)*(1 + 2*S(ss1))*Power(T,5)*(3 + 2*T))/(2 + T)) + 7*T*(-sqrt(((1 + 2*S(ss1))*T*(3 + 2*T))/(S(ss1)*(2 + T))) + sqrt((S(ss1)*(1 + 2*S(ss1))*T*(3 + 2*T))/(2 + T)) + 2*sqrt((Power(S(ss1),3)*(1 + 2*S(ss1))*T*(3 + 2*T))/(2 + T))))/((1 + 2*S(ss1))*sqrt((-1 + S(ss1) + 2*Power(S(ss1),2))/(1 + T))*Power(3 + 5*T + 2*Power(T,2),1.5));
+          case 193: return -((sqrt(((1 + S(ss1))*(1 + T))/(1 + 2*T)) - 2*T*sqrt(((1 + S(ss1))*(1 + T))/(1 + 2*T)) + 2*sqrt((1 + S(ss1))*(1 + 3*T + 2*Power(T,2))))/((1 + S(ss1))*(1 + T)*sqrt((1 + 2*S(ss1))*(1 + T)*(3 + 2*T))));
+          case 194: return sqrt((T*(2 + T))/(1 + 3*S(ss1) + 2*Power(S(ss1),2)))/(1 + T);
+          case 195: return (sqrt((S(ss1)*(1 + 2*S(ss1))*(-1 + T))/T) + sqrt((S(ss1)*(1 + 2*S(ss1))*(-1 + T))/(Power(1 + S(ss1),2)*T)) + sqrt((S(ss1)*(-1 + T))/(Power(1 + S(ss1),2)*(T + 2*S(ss1)*T))))/sqrt(((3 + 5*S(ss1) + 2*Power(S(ss1),2))*T)/(1 + T));
+          case 196: return (3 + 2*S(ss1))/sqrt(((1 + 2*S(ss1))*(3 + 5*S(ss1) + 2*Power(S(ss1),2))*Power(T,2)*(1 + 2*T))/(S(ss1)*(-1 + 2*T)));
+          case 197: return -((3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 8*S(ss1) + 4*Power(S(ss1),2))*Power(T,2))/S(ss1)));
+          case 198: return ((3 + 2*S(ss1))*sqrt(S(ss1)/(3 + 11*S(ss1) + 12*Power(S(ss1),2) + 4*Power(S(ss1),3)))*(-1 + T + Power(T,2)))/(T*(1 + T));
+          case 199: return ((3 + 2*S(ss1))*sqrt(S(ss1)/(3 + 11*S(ss1) + 12*Power(S(ss1),2) + 4*Power(S(ss1),3))))/(1 + T);
+          case 200: return -(((1 + 2*S(ss1))*sqrt((S(ss1)*(1 + S(ss1))*(1 + 2*T))/(1 + T)) - (1 + 2*S(ss1))*T*sqrt((S(ss1)*(1 + S(ss1))*(1 + 2*T))/(1 + T)) + sqrt((S(ss1)*(1 + T)*(1 + 2*T))/(1 + S(ss1))) + (1 + 2*S(ss1))*sqrt((S(ss1)*(1 + T)*(1 + 2*T))/(1 + S(ss1))) + (1 + 2*S(ss1))*sqrt(S(ss1)*(1 + S(ss1))*(1 + T)*(1 + 2*T)) + sqrt((S(ss1) + 2*S(ss1)*T)/(1 + S(ss1) + T + S(ss1)*T)) + (1 + 2*S(ss1))*sqrt((S(ss1) + 2*S(ss1)*T)/(1 + S(ss1) + T + S(ss1)*T)) - T*sqrt((S(ss1) + 2*S(ss1)*T)/(1 + S(ss1) + T + S(ss1)*T)) - (1 + 2*S(ss1))*T*sqrt((S(ss1) + 2*S(ss1)*T)/(1 + S(ss1) + T + S(ss1)*T)) + (1 - 2*T)*sqrt(S(ss1)/((1 + S(ss1))*(1 + 3*T + 2*Power(T,2)))) - (1 + 2*S(ss1))*(-1 + 2*T)*sqrt(S(ss1)/((1 + S(ss1))*(1 + 3*T + 2*Power(T,2)))) - (1 + 2*S(ss1))*(-1 + 2*T)*sqrt((S(ss1)*(1 + S(ss1)))/(1 + 3*T + 2*Power(T,2))))/((1 + S(ss1))*sqrt((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(1 + T)*(3 + 2*T))));
+          case 201: return -((sqrt((1 + T)/(3 + 8*S(ss1) + 4*Power(S(ss1),2)))*(-(sqrt((S(ss1)*T*(1 + T))/((1 + S(ss1))*(2 + T)))*(1 + 2*T)) - (1 + 2*S(ss1))*sqrt((S(ss1)*T*(1 + T))/((1 + S(ss1))*(2 + T)))*(1 + 2*T) - (1 + 2*S(ss1))*sqrt((S(ss1)*(1 + S(ss1))*T*(1 + T))/(2 + T))*(1 + 2*T) - 3*sqrt((S(ss1)*T)/((1 + S(ss1))*(2 + 3*T + Power(T,2)))) - 3*(1 + 2*S(ss1))*sqrt((S(ss1)*T)/((1 + S(ss1))*(2 + 3*T + Power(T,2)))) - 2*(1 + 2*T)*sqrt((S(ss1)*T)/((1 + S(ss1))*(2 + 3*T + Power(T,2)))) - 2*(1 + 2*S(ss1))*(1 + 2*T)*sqrt((S(ss1)*T)/((1 + S(ss1))*(2 + 3*T + Power(T,2)))) - 3*(1 + 2*S(ss1))*sqrt((S(ss1)*(1 + S(ss1))*T)/(2 + 3*T + Power(T,2))) - 2*(1 + 2*S(ss1))*(1 + 2*T)*sqrt((S(ss1)*(1 + S(ss1))*T)/(2 + 3*T + Power(T,2)))))/((1 + S(ss1))*(3 + 5*T + 2*Power(T,2))));
+          case 202: return -1;
+          case 203: return -(sqrt(3)/sqrt(-1 + 4*Power(S(ss1),2)));
+          case 204: return (-2*(-1 + Power(S(ss1),2)))/sqrt(1 - 5*Power(S(ss1),2) + 4*Power(S(ss1),4));
+          case 205: return -2/(1 + 2*S(ss1));
+          case 206: return -(sqrt(-3 + 4*S(ss1) + 4*Power(S(ss1),2))/(1 + 2*S(ss1)));
+          case 207: return -((sqrt(3)*(3*sqrt(S(ss1)*(1 + S(ss1))) + 5*sqrt(Power(S(ss1),3)*(1 + S(ss1))) + 2*sqrt(Power(S(ss1),5)*(1 + S(ss1)))))/sqrt(S(ss1)*(1 + 2*S(ss1))*Power(3 + 5*S(ss1) + 2*Power(S(ss1),2),3)));
+          case 208: return -((9*sqrt(S(ss1)/(3 + 2*S(ss1))) + sqrt(S(ss1)*(3 + 2*S(ss1))) + 2*S(ss1)*(3*sqrt(S(ss1)/(3 + 2*S(ss1))) + sqrt(S(ss1)*(3 + 2*S(ss1)))))/((3 + 2*S(ss1))*sqrt(2 + 5*S(ss1) + 2*Power(S(ss1),2))));
+          default: my_assert_not_reached();
+        }
+      };
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(1, 2, 1));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -105,10 +1698,384 @@ MatrixElements<SC> SymmetrySPSU2T<SC>::recalc_doublet(const DiagInfo<SC> &diag,
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "spsu2t/spsu2t-doubletp+1.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {4, 4},
+        {5, 5},
+        {6, 5},
+        {6, 6},
+        {7, 5},
+        {7, 6},
+        {7, 7},
+        {8, 6},
+        {8, 7},
+        {8, 8},
+        {9, 7},
+        {9, 8},
+        {9, 9},
+        {10, 10},
+        {11, 10},
+        {11, 11},
+        {12, 10},
+        {12, 11},
+        {12, 12},
+        {13, 11},
+        {13, 12},
+        {13, 13},
+        {14, 12},
+        {14, 13},
+        {14, 14},
+        {15, 15},
+        {16, 15},
+        {16, 16},
+        {17, 15},
+        {17, 16},
+        {17, 17},
+        {18, 15},
+        {18, 18},
+        {19, 15},
+        {19, 16},
+        {19, 18},
+        {19, 19},
+        {20, 15},
+        {20, 16},
+        {20, 17},
+        {20, 18},
+        {20, 19},
+        {20, 20},
+        {21, 21},
+        {22, 21},
+        {22, 22},
+        {23, 21},
+        {23, 22},
+        {23, 23},
+        {24, 21},
+        {24, 24},
+        {25, 21},
+        {25, 22},
+        {25, 24},
+        {25, 25},
+        {26, 21},
+        {26, 22},
+        {26, 23},
+        {26, 24},
+        {26, 25},
+        {26, 26},
+        {27, 27},
+        {28, 27},
+        {28, 28},
+        {29, 27},
+        {29, 28},
+        {29, 29},
+        {30, 27},
+        {30, 30},
+        {31, 27},
+        {31, 28},
+        {31, 30},
+        {31, 31},
+        {32, 27},
+        {32, 28},
+        {32, 29},
+        {32, 30},
+        {32, 31},
+        {32, 32},
+        {33, 33},
+        {34, 33},
+        {34, 34},
+        {35, 33},
+        {35, 34},
+        {35, 35},
+        {36, 34},
+        {36, 35},
+        {36, 36},
+        {37, 35},
+        {37, 36},
+        {37, 37},
+        {38, 33},
+        {38, 38},
+        {39, 33},
+        {39, 34},
+        {39, 38},
+        {39, 39},
+        {40, 33},
+        {40, 34},
+        {40, 35},
+        {40, 38},
+        {40, 39},
+        {40, 40},
+        {41, 34},
+        {41, 35},
+        {41, 36},
+        {41, 39},
+        {41, 40},
+        {41, 41},
+        {42, 35},
+        {42, 36},
+        {42, 37},
+        {42, 40},
+        {42, 41},
+        {42, 42},
+        {43, 43},
+        {44, 43},
+        {44, 44},
+        {45, 43},
+        {45, 44},
+        {45, 45},
+        {46, 43},
+        {46, 46},
+        {47, 43},
+        {47, 44},
+        {47, 46},
+        {47, 47},
+        {48, 43},
+        {48, 44},
+        {48, 45},
+        {48, 46},
+        {48, 47},
+        {48, 48},
+        {49, 46},
+        {49, 49},
+        {50, 46},
+        {50, 47},
+        {50, 49},
+        {50, 50},
+        {51, 46},
+        {51, 47},
+        {51, 48},
+        {51, 49},
+        {51, 50},
+        {51, 51},
+        {52, 52},
+        {53, 52},
+        {53, 53},
+        {54, 52},
+        {54, 53},
+        {54, 54},
+        {55, 52},
+        {55, 55},
+        {56, 52},
+        {56, 53},
+        {56, 55},
+        {56, 56},
+        {57, 52},
+        {57, 53},
+        {57, 54},
+        {57, 55},
+        {57, 56},
+        {57, 57},
+        {58, 55},
+        {58, 58},
+        {59, 55},
+        {59, 56},
+        {59, 58},
+        {59, 59},
+        {60, 55},
+        {60, 56},
+        {60, 57},
+        {60, 58},
+        {60, 59},
+        {60, 60},
+        {61, 61},
+        {62, 61},
+        {62, 62},
+        {63, 62},
+        {63, 63},
+        {64, 63},
+        {64, 64}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return 1;
+          case 3: return 1;
+          case 4: return sqrt((9 - 4*Power(T,2))/(1 - 4*Power(T,2)));
+          case 5: return (sqrt(2)*sqrt((3 + 5*T + 2*Power(T,2))/(-1 + T))*(-2*sqrt(((-1 + T)*T)/(1 + 2*T)) + 2/sqrt((T*(1 + 2*T))/(-1 + T)) + ((-1 + T)*(-3 + 2*T))/sqrt(T*(-1 - T + 2*Power(T,2)))))/(1 + T);
+          case 6: return sqrt(((-2 + T + Power(T,2))*(-3 + T + 8*Power(T,2) + 4*Power(T,3)))/T)/((1 + T)*(1 + 2*T));
+          case 7: return sqrt(6)/sqrt(T*(1 + 2*T)*(-1 + T + 2*Power(T,2)));
+          case 8: return -((sqrt(3)*(-4*sqrt((-1 + 2*T)/(1 + T)) + 7*Power(T,2)*sqrt((-1 + 2*T)/(1 + T)) + 6*sqrt(-1 + T + 2*Power(T,2)) + 3*T*(sqrt((-1 + 2*T)/(1 + T)) - 2*sqrt(-1 + T + 2*Power(T,2)))))/(Power(1 + T,1.5)*sqrt(T*(2 + 5*T + 2*Power(T,2)))));
+          case 9: return (T*(10 + 9*T + 2*Power(T,2)))/(Power(1 + T,1.5)*(3 + 2*T)*sqrt((T*(10 + 29*T + 20*Power(T,2) + 4*Power(T,3)))/(-3 + T + 8*Power(T,2) + 4*Power(T,3))));
+          case 10: return 3/(1 + 3*T + 2*Power(T,2));
+          case 11: return -((T*sqrt((15 + 6*T)/(2*T + 5*Power(T,2) + 2*Power(T,3))))/(1 + T));
+          case 12: return (T*(3 + T))/sqrt(T*(6 + 11*T + 6*Power(T,2) + Power(T,3)));
+          case 13: return sqrt(6)/sqrt((1 + T)*(6 + 19*T + 16*Power(T,2) + 4*Power(T,3)));
+          case 14: return -(sqrt(2)/sqrt((1 + T)*(2 + T)));
+          case 15: return 1;
+          case 16: return sqrt((9 - 4*Power(T,2))/(1 - 4*Power(T,2)));
+          case 17: return (sqrt(2)*sqrt((3 + 5*T + 2*Power(T,2))/(-1 + T))*(-2*sqrt(((-1 + T)*T)/(1 + 2*T)) + 2/sqrt((T*(1 + 2*T))/(-1 + T)) + ((-1 + T)*(-3 + 2*T))/sqrt(T*(-1 - T + 2*Power(T,2)))))/(1 + T);
+          case 18: return sqrt(((-2 + T + Power(T,2))*(-3 + T + 8*Power(T,2) + 4*Power(T,3)))/T)/((1 + T)*(1 + 2*T));
+          case 19: return sqrt(6)/sqrt(T*(1 + 2*T)*(-1 + T + 2*Power(T,2)));
+          case 20: return -((sqrt(3)*(-4*sqrt((-1 + 2*T)/(1 + T)) + 7*Power(T,2)*sqrt((-1 + 2*T)/(1 + T)) + 6*sqrt(-1 + T + 2*Power(T,2)) + 3*T*(sqrt((-1 + 2*T)/(1 + T)) - 2*sqrt(-1 + T + 2*Power(T,2)))))/(Power(1 + T,1.5)*sqrt(T*(2 + 5*T + 2*Power(T,2)))));
+          case 21: return (T*(10 + 9*T + 2*Power(T,2)))/(Power(1 + T,1.5)*(3 + 2*T)*sqrt((T*(10 + 29*T + 20*Power(T,2) + 4*Power(T,3)))/(-3 + T + 8*Power(T,2) + 4*Power(T,3))));
+          case 22: return 3/(1 + 3*T + 2*Power(T,2));
+          case 23: return -((T*sqrt((15 + 6*T)/(2*T + 5*Power(T,2) + 2*Power(T,3))))/(1 + T));
+          case 24: return (T*(3 + T))/sqrt(T*(6 + 11*T + 6*Power(T,2) + Power(T,3)));
+          case 25: return sqrt(6)/sqrt((1 + T)*(6 + 19*T + 16*Power(T,2) + 4*Power(T,3)));
+          case 26: return -(sqrt(2)/sqrt((1 + T)*(2 + T)));
+          case 27: return 1;
+          case 28: return (-2*sqrt(S(ss1)*(1 + S(ss1))*(-3 + 4*T + 4*Power(T,2))))/(1 + 2*S(ss1) + 2*T + 4*S(ss1)*T);
+          case 29: return (2*sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*T))/(1 + 2*T)))/(1 + 2*S(ss1) + T + 2*S(ss1)*T);
+          case 30: return (-2*(2*sqrt((S(ss1)*(1 + S(ss1))*T)/(2 + T)) + sqrt((S(ss1)*(1 + S(ss1))*Power(T,3))/(2 + T))))/((1 + 2*S(ss1))*(1 + T));
+          case 31: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/((1 + 2*S(ss1))*(1 + 3*T + 2*Power(T,2)));
+          case 32: return (2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1) + T + 2*S(ss1)*T);
+          case 33: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 34: return sqrt(-3 + 4*T + 4*Power(T,2))/(1 + 2*S(ss1) + 2*T + 4*S(ss1)*T);
+          case 35: return -(sqrt(-3 + 4*T + 4*Power(T,2))/(1 + 2*T));
+          case 36: return -(sqrt((3 + 2*T)/(1 + 2*T))/(1 + 2*S(ss1) + T + 2*S(ss1)*T));
+          case 37: return ((2 + T)*sqrt(((1 + S(ss1))*T*(3 + 5*T + 2*Power(T,2)))/(1 + 2*S(ss1))) - 2*S(ss1)*(-(T*sqrt(((1 + S(ss1))*T*(3 + 5*T + 2*Power(T,2)))/(1 + 2*S(ss1)))) + sqrt(((1 + S(ss1))*Power(T,3)*(3 + 5*T + 2*Power(T,2)))/(1 + 2*S(ss1)))))/((1 + T)*sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*T)*(2 + 3*T + Power(T,2))));
+          case 38: return sqrt((3 + 2*T)/(1 + 2*T))/(1 + T);
+          case 39: return (T*sqrt((Power(1 + S(ss1),3)*T*Power(1 + T,2))/((3 + 2*S(ss1))*(3 + 2*T))) - Power(T,2)*sqrt((Power(1 + S(ss1),3)*T*Power(1 + T,2))/((3 + 2*S(ss1))*(3 + 2*T))) + 2*T*sqrt((Power(1 + S(ss1),3)*T*Power(1 + T,2))/(Power(1 + 2*S(ss1),2)*(3 + 2*S(ss1))*(3 + 2*T))) - 2*Power(T,2)*sqrt((Power(1 + S(ss1),3)*T*Power(1 + T,2))/(Power(1 + 2*S(ss1),2)*(3 + 2*S(ss1))*(3 + 2*T))) - (3*Power((1 + S(ss1))*T*(1 + T),1.5))/sqrt((3 + 2*S(ss1))*(3 + 5*T + 2*Power(T,2))) - (6*Power((1 + S(ss1))*T*(1 + T),1.5))/((1 + 2*S(ss1))*sqrt((3 + 2*S(ss1))*(3 + 5*T + 2*Power(T,2)))))/sqrt((Power(1 + S(ss1),3)*(3 + 2*S(ss1))*Power(T,2)*Power(1 + T,4)*(2 + T))/(Power(1 + 2*S(ss1),2)*(3 + 2*T)));
+          case 40: return 1/((1 + 2*S(ss1))*(1 + T)*(1 + 2*T));
+          case 41: return -(1/(1 + 2*S(ss1) + T + 2*S(ss1)*T));
+          case 42: return 1/(1 + 2*S(ss1));
+          case 43: return -((sqrt(((1 + 2*S(ss1))*(1 + 2*T))/(3 + 2*S(ss1)))*(-2*T*sqrt(((1 + 2*S(ss1))*(1 + T))/((3 + 2*S(ss1))*(1 + 2*T)))*Power((1 + S(ss1))*(3 + 2*T),1.5) - 4*T*sqrt((1 + T)/((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(1 + 2*T)))*Power((1 + S(ss1))*(3 + 2*T),1.5) + T*sqrt(((1 + 2*S(ss1))*(1 + T))/(3 + 2*S(ss1)))*(-1 + 2*T)*Power(((1 + S(ss1))*(3 + 2*T))/(1 + 2*T),1.5) + 2*T*sqrt((1 + T)/(3 + 8*S(ss1) + 4*Power(S(ss1),2)))*(-1 + 2*T)*Power(((1 + S(ss1))*(3 + 2*T))/(1 + 2*T),1.5) + (2*Power((1 + S(ss1))*(3 + 5*T + 2*Power(T,2)),1.5))/sqrt((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(1 + 2*T)) + sqrt((1 + 2*S(ss1))/(3 + 2*S(ss1) + 6*T + 4*S(ss1)*T))*Power((1 + S(ss1))*(3 + 5*T + 2*Power(T,2)),1.5)))/Power((1 + S(ss1))*(3 + 5*T + 2*Power(T,2)),1.5));
+          case 44: return (sqrt((Power(1 + S(ss1),3)*(1 + 2*S(ss1))*(1 + T)*Power(3 + 2*T,3))/((3 + 2*S(ss1))*(2 + T))) + 2*sqrt((Power(1 + S(ss1),3)*(1 + T)*Power(3 + 2*T,3))/((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(2 + T))) - 3*sqrt((Power(1 + S(ss1),3)*(1 + 2*S(ss1))*Power(T,2)*(1 + T)*Power(3 + 2*T,3))/((3 + 2*S(ss1))*(2 + T)*Power(1 + 2*T,2))) - 6*sqrt((Power(1 + S(ss1),3)*Power(T,2)*(1 + T)*Power(3 + 2*T,3))/((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(2 + T)*Power(1 + 2*T,2))) + sqrt((Power(1 + S(ss1),3)*(1 + 2*S(ss1))*Power(3 + 5*T + 2*Power(T,2),3))/((3 + 2*S(ss1))*(2 + T))) + 2*sqrt((Power(1 + S(ss1),3)*Power(3 + 5*T + 2*Power(T,2),3))/((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(2 + T))) - T*(sqrt((Power(1 + S(ss1),3)*(1 + 2*S(ss1))*(1 + T)*Power(3 + 2*T,3))/((3 + 2*S(ss1))*(2 + T))) + 2*sqrt((Power(1 + S(ss1),3)*(1 + T)*Power(3 + 2*T,3))/((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(2 + T)))))/sqrt((Power(1 + S(ss1),3)*(3 + 2*S(ss1))*(2 + T)*Power(3 + 5*T + 2*Power(T,2),3))/((1 + 2*S(ss1))*Power(1 + 2*T,2)));
+          case 45: return (-3*sqrt((Power(1 + S(ss1),3)*(1 + 2*S(ss1))*Power(1 + T,2)*Power(3 + 2*T,3))/((3 + 2*S(ss1))*(10 + 9*T + 2*Power(T,2)))) - sqrt((Power(1 + S(ss1),3)*(1 + 2*S(ss1))*Power(1 + T,4)*Power(3 + 2*T,3))/((3 + 2*S(ss1))*(10 + 9*T + 2*Power(T,2)))) - 2*sqrt((Power(1 + S(ss1),3)*Power(1 + T,4)*Power(3 + 2*T,3))/((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(10 + 9*T + 2*Power(T,2)))) - 6*sqrt((Power(1 + S(ss1),3)*(1 + 2*S(ss1))*Power(1 + T,2)*Power(3 + 2*T,3))/((3 + 2*S(ss1))*Power(1 + 2*T,2)*(10 + 9*T + 2*Power(T,2)))) - (6*(1 + T)*Power((1 + S(ss1))*(3 + 2*T),1.5))/sqrt((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(10 + 9*T + 2*Power(T,2))) - (12*(1 + T)*Power((1 + S(ss1))*(3 + 2*T),1.5))/((1 + 2*T)*sqrt((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(10 + 9*T + 2*Power(T,2)))))/sqrt((Power(1 + S(ss1),3)*(3 + 2*S(ss1))*Power(1 + T,2)*Power(3 + 2*T,3)*(10 + 9*T + 2*Power(T,2)))/((1 + 2*S(ss1))*Power(1 + 2*T,2)));
+          case 46: return (-2*sqrt(S(ss1)*(1 + S(ss1))*(-3 + 4*T + 4*Power(T,2))))/(1 + 2*S(ss1) + 2*T + 4*S(ss1)*T);
+          case 47: return (2*sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*T))/(1 + 2*T)))/(1 + 2*S(ss1) + T + 2*S(ss1)*T);
+          case 48: return (-2*(2*sqrt((S(ss1)*(1 + S(ss1))*T)/(2 + T)) + sqrt((S(ss1)*(1 + S(ss1))*Power(T,3))/(2 + T))))/((1 + 2*S(ss1))*(1 + T));
+          case 49: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/((1 + 2*S(ss1))*(1 + 3*T + 2*Power(T,2)));
+          case 50: return (2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1) + T + 2*S(ss1)*T);
+          case 51: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 52: return sqrt(-3 + 4*T + 4*Power(T,2))/(1 + 2*S(ss1) + 2*T + 4*S(ss1)*T);
+          case 53: return -(sqrt(-3 + 4*T + 4*Power(T,2))/(1 + 2*T));
+          case 54: return -(sqrt((3 + 2*T)/(1 + 2*T))/(1 + 2*S(ss1) + T + 2*S(ss1)*T));
+          case 55: return ((2 + T)*sqrt(((1 + S(ss1))*T*(3 + 5*T + 2*Power(T,2)))/(1 + 2*S(ss1))) - 2*S(ss1)*(-(T*sqrt(((1 + S(ss1))*T*(3 + 5*T + 2*Power(T,2)))/(1 + 2*S(ss1)))) + sqrt(((1 + S(ss1))*Power(T,3)*(3 + 5*T + 2*Power(T,2)))/(1 + 2*S(ss1)))))/((1 + T)*sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*T)*(2 + 3*T + Power(T,2))));
+          case 56: return sqrt((3 + 2*T)/(1 + 2*T))/(1 + T);
+          case 57: return ((1 + 2*S(ss1))*(T*sqrt((Power(1 + S(ss1),3)*T*Power(1 + T,2))/((3 + 2*S(ss1))*(3 + 2*T))) - Power(T,2)*sqrt((Power(1 + S(ss1),3)*T*Power(1 + T,2))/((3 + 2*S(ss1))*(3 + 2*T))) + 2*T*sqrt((Power(1 + S(ss1),3)*T*Power(1 + T,2))/(Power(1 + 2*S(ss1),2)*(3 + 2*S(ss1))*(3 + 2*T))) - 2*Power(T,2)*sqrt((Power(1 + S(ss1),3)*T*Power(1 + T,2))/(Power(1 + 2*S(ss1),2)*(3 + 2*S(ss1))*(3 + 2*T))) - (3*Power((1 + S(ss1))*T*(1 + T),1.5))/sqrt((3 + 2*S(ss1))*(3 + 5*T + 2*Power(T,2))) - (6*Power((1 + S(ss1))*T*(1 + T),1.5))/((1 + 2*S(ss1))*sqrt((3 + 2*S(ss1))*(3 + 5*T + 2*Power(T,2))))))/(Power(1 + S(ss1),1.5)*T*Power(1 + T,2)*sqrt(((3 + 2*S(ss1))*(2 + T))/(3 + 2*T)));
+          case 58: return 1/((1 + 2*S(ss1))*(1 + T)*(1 + 2*T));
+          case 59: return -(1/(1 + 2*S(ss1) + T + 2*S(ss1)*T));
+          case 60: return 1/(1 + 2*S(ss1));
+          case 61: return (sqrt(((1 + 2*S(ss1))*(1 + 2*T))/(3 + 2*S(ss1)))*(2*T*sqrt(((1 + 2*S(ss1))*(1 + T))/((3 + 2*S(ss1))*(1 + 2*T)))*Power((1 + S(ss1))*(3 + 2*T),1.5) + 4*T*sqrt((1 + T)/((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(1 + 2*T)))*Power((1 + S(ss1))*(3 + 2*T),1.5) - T*sqrt(((1 + 2*S(ss1))*(1 + T))/(3 + 2*S(ss1)))*(-1 + 2*T)*Power(((1 + S(ss1))*(3 + 2*T))/(1 + 2*T),1.5) - 2*T*sqrt((1 + T)/(3 + 8*S(ss1) + 4*Power(S(ss1),2)))*(-1 + 2*T)*Power(((1 + S(ss1))*(3 + 2*T))/(1 + 2*T),1.5) - (2*Power((1 + S(ss1))*(3 + 5*T + 2*Power(T,2)),1.5))/sqrt((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(1 + 2*T)) - sqrt((1 + 2*S(ss1))/(3 + 2*S(ss1) + 6*T + 4*S(ss1)*T))*Power((1 + S(ss1))*(3 + 5*T + 2*Power(T,2)),1.5)))/Power((1 + S(ss1))*(3 + 5*T + 2*Power(T,2)),1.5);
+          case 62: return sqrt(((1 + 2*S(ss1))*Power(1 + 2*T,2))/(Power(1 + S(ss1),3)*(3 + 2*S(ss1))*(2 + T)*Power(3 + 5*T + 2*Power(T,2),3)))*(2/sqrt(((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(2 + T))/(Power(1 + S(ss1),3)*(1 + T)*Power(3 + 2*T,3))) - (2*T)/sqrt(((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(2 + T))/(Power(1 + S(ss1),3)*(1 + T)*Power(3 + 2*T,3))) - 6/sqrt(((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(2 + T)*Power(1 + 2*T,2))/(Power(1 + S(ss1),3)*Power(T,2)*(1 + T)*Power(3 + 2*T,3))) + sqrt((Power(1 + S(ss1),3)*(1 + 2*S(ss1))*(1 + T)*Power(3 + 2*T,3))/((3 + 2*S(ss1))*(2 + T))) - T*sqrt((Power(1 + S(ss1),3)*(1 + 2*S(ss1))*(1 + T)*Power(3 + 2*T,3))/((3 + 2*S(ss1))*(2 + T))) - 3*sqrt((Power(1 + S(ss1),3)*(1 + 2*S(ss1))*Power(T,2)*(1 + T)*Power(3 + 2*T,3))/((3 + 2*S(ss1))*(2 + T)*Power(1 + 2*T,2))) + 1/sqrt(((3 + 2*S(ss1))*(2 + T))/(Power(1 + S(ss1),3)*(1 + 2*S(ss1))*Power(3 + 5*T + 2*Power(T,2),3))) + 2/sqrt(((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(2 + T))/(Power(1 + S(ss1),3)*Power(3 + 5*T + 2*Power(T,2),3))));
+          case 63: return -1;
+          case 64: return (-2*sqrt(S(ss1)*(1 + S(ss1))*(-3 + 4*T + 4*Power(T,2))))/(1 + 2*S(ss1) + 2*T + 4*S(ss1)*T);
+          case 65: return (2*sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*T))/(1 + 2*T)))/(1 + 2*S(ss1) + T + 2*S(ss1)*T);
+          case 66: return (-2*(2*sqrt((S(ss1)*(1 + S(ss1))*T)/(2 + T)) + sqrt((S(ss1)*(1 + S(ss1))*Power(T,3))/(2 + T))))/((1 + 2*S(ss1))*(1 + T));
+          case 67: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/((1 + 2*S(ss1))*(1 + 3*T + 2*Power(T,2)));
+          case 68: return (2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1) + T + 2*S(ss1)*T);
+          case 69: return (-2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1));
+          case 70: return sqrt(-3 + 4*T + 4*Power(T,2))/(1 + 2*S(ss1) + 2*T + 4*S(ss1)*T);
+          case 71: return -(sqrt(-3 + 4*T + 4*Power(T,2))/(1 + 2*T));
+          case 72: return -(sqrt((3 + 2*T)/(1 + 2*T))/(1 + 2*S(ss1) + T + 2*S(ss1)*T));
+          case 73: return ((2 + T)*sqrt(((1 + S(ss1))*T*(3 + 5*T + 2*Power(T,2)))/(1 + 2*S(ss1))) - 2*S(ss1)*(-(T*sqrt(((1 + S(ss1))*T*(3 + 5*T + 2*Power(T,2)))/(1 + 2*S(ss1)))) + sqrt(((1 + S(ss1))*Power(T,3)*(3 + 5*T + 2*Power(T,2)))/(1 + 2*S(ss1)))))/((1 + T)*sqrt((1 + S(ss1))*(1 + 2*S(ss1))*(3 + 2*T)*(2 + 3*T + Power(T,2))));
+          case 74: return sqrt((3 + 2*T)/(1 + 2*T))/(1 + T);
+          case 75: return (T*sqrt((Power(1 + S(ss1),3)*T*Power(1 + T,2))/((3 + 2*S(ss1))*(3 + 2*T))) - Power(T,2)*sqrt((Power(1 + S(ss1),3)*T*Power(1 + T,2))/((3 + 2*S(ss1))*(3 + 2*T))) + 2*T*sqrt((Power(1 + S(ss1),3)*T*Power(1 + T,2))/(Power(1 + 2*S(ss1),2)*(3 + 2*S(ss1))*(3 + 2*T))) - 2*Power(T,2)*sqrt((Power(1 + S(ss1),3)*T*Power(1 + T,2))/(Power(1 + 2*S(ss1),2)*(3 + 2*S(ss1))*(3 + 2*T))) - (3*Power((1 + S(ss1))*T*(1 + T),1.5))/sqrt((3 + 2*S(ss1))*(3 + 5*T + 2*Power(T,2))) - (6*Power((1 + S(ss1))*T*(1 + T),1.5))/((1 + 2*S(ss1))*sqrt((3 + 2*S(ss1))*(3 + 5*T + 2*Power(T,2)))))/sqrt((Power(1 + S(ss1),3)*(3 + 2*S(ss1))*Power(T,2)*Power(1 + T,4)*(2 + T))/(Power(1 + 2*S(ss1),2)*(3 + 2*T)));
+          case 76: return 1/((1 + 2*S(ss1))*(1 + T)*(1 + 2*T));
+          case 77: return -(1/(1 + 2*S(ss1) + T + 2*S(ss1)*T));
+          case 78: return 1/(1 + 2*S(ss1));
+          case 79: return -((sqrt(((1 + 2*S(ss1))*(1 + 2*T))/(3 + 2*S(ss1)))*(-2*T*sqrt(((1 + 2*S(ss1))*(1 + T))/((3 + 2*S(ss1))*(1 + 2*T)))*Power((1 + S(ss1))*(3 + 2*T),1.5) - 4*T*sqrt((1 + T)/((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(1 + 2*T)))*Power((1 + S(ss1))*(3 + 2*T),1.5) + T*sqrt(((1 + 2*S(ss1))*(1 + T))/(3 + 2*S(ss1)))*(-1 + 2*T)*Power(((1 + S(ss1))*(3 + 2*T))/(1 + 2*T),1.5) + 2*T*sqrt((1 + T)/(3 + 8*S(ss1) + 4*Power(S(ss1),2)))*(-1 + 2*T)*Power(((1 + S(ss1))*(3 + 2*T))/(1 + 2*T),1.5) + (2*Power((1 + S(ss1))*(3 + 5*T + 2*Power(T,2)),1.5))/sqrt((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(1 + 2*T)) + sqrt((1 + 2*S(ss1))/(3 + 2*S(ss1) + 6*T + 4*S(ss1)*T))*Power((1 + S(ss1))*(3 + 5*T + 2*Power(T,2)),1.5)))/Power((1 + S(ss1))*(3 + 5*T + 2*Power(T,2)),1.5));
+          case 80: return (sqrt((Power(1 + S(ss1),3)*(1 + 2*S(ss1))*(1 + T)*Power(3 + 2*T,3))/((3 + 2*S(ss1))*(2 + T))) + 2*sqrt((Power(1 + S(ss1),3)*(1 + T)*Power(3 + 2*T,3))/((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(2 + T))) - 3*sqrt((Power(1 + S(ss1),3)*(1 + 2*S(ss1))*Power(T,2)*(1 + T)*Power(3 + 2*T,3))/((3 + 2*S(ss1))*(2 + T)*Power(1 + 2*T,2))) - 6*sqrt((Power(1 + S(ss1),3)*Power(T,2)*(1 + T)*Power(3 + 2*T,3))/((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(2 + T)*Power(1 + 2*T,2))) + sqrt((Power(1 + S(ss1),3)*(1 + 2*S(ss1))*Power(3 + 5*T + 2*Power(T,2),3))/((3 + 2*S(ss1))*(2 + T))) + 2*sqrt((Power(1 + S(ss1),3)*Power(3 + 5*T + 2*Power(T,2),3))/((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(2 + T))) - T*(sqrt((Power(1 + S(ss1),3)*(1 + 2*S(ss1))*(1 + T)*Power(3 + 2*T,3))/((3 + 2*S(ss1))*(2 + T))) + 2*sqrt((Power(1 + S(ss1),3)*(1 + T)*Power(3 + 2*T,3))/((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(2 + T)))))/sqrt((Power(1 + S(ss1),3)*(3 + 2*S(ss1))*(2 + T)*Power(3 + 5*T + 2*Power(T,2),3))/((1 + 2*S(ss1))*Power(1 + 2*T,2)));
+          case 81: return (-3*sqrt((Power(1 + S(ss1),3)*(1 + 2*S(ss1))*Power(1 + T,2)*Power(3 + 2*T,3))/((3 + 2*S(ss1))*(10 + 9*T + 2*Power(T,2)))) - sqrt((Power(1 + S(ss1),3)*(1 + 2*S(ss1))*Power(1 + T,4)*Power(3 + 2*T,3))/((3 + 2*S(ss1))*(10 + 9*T + 2*Power(T,2)))) - 2*sqrt((Power(1 + S(ss1),3)*Power(1 + T,4)*Power(3 + 2*T,3))/((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(10 + 9*T + 2*Power(T,2)))) - 6*sqrt((Power(1 + S(ss1),3)*(1 + 2*S(ss1))*Power(1 + T,2)*Power(3 + 2*T,3))/((3 + 2*S(ss1))*Power(1 + 2*T,2)*(10 + 9*T + 2*Power(T,2)))) - (6*(1 + T)*Power((1 + S(ss1))*(3 + 2*T),1.5))/sqrt((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(10 + 9*T + 2*Power(T,2))) - (12*(1 + T)*Power((1 + S(ss1))*(3 + 2*T),1.5))/((1 + 2*T)*sqrt((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(10 + 9*T + 2*Power(T,2)))))/sqrt((Power(1 + S(ss1),3)*(3 + 2*S(ss1))*Power(1 + T,2)*Power(3 + 2*T,3)*(10 + 9*T + 2*Power(T,2)))/((1 + 2*S(ss1))*Power(1 + 2*T,2)));
+          case 82: return (-2*sqrt((S(ss1)*(1 + S(ss1))*(-9 + 4*Power(T,2)))/(-1 + 4*Power(T,2))))/(1 + 2*S(ss1));
+          case 83: return (2*sqrt(2)*sqrt((S(ss1)*(1 + S(ss1))*(3 + 5*T + 2*Power(T,2)))/(T*(1 + 2*T))))/(1 + 2*S(ss1) + T + 2*S(ss1)*T);
+          case 84: return (-2*(1 - 3*T + 2*Power(T,2))*sqrt((S(ss1)*(1 + S(ss1))*(6 + 13*T + 9*Power(T,2) + 2*Power(T,3)))/(Power(1 + 2*S(ss1),2)*(T - 3*Power(T,2) + 2*Power(T,3)))))/((1 + T)*(1 + 2*T));
+          case 85: return (-2*sqrt(6)*sqrt(-((S(ss1)*(1 + S(ss1)))/(T + Power(T,2) - 4*Power(T,3) - 4*Power(T,4)))))/(1 + 2*S(ss1));
+          case 86: return (2*sqrt(3)*(2 + T)*sqrt((S(ss1)*(1 + S(ss1))*(-1 + 2*T))/(Power(1 + 2*S(ss1),2)*T*(2 + 5*T + 2*Power(T,2)))))/(1 + T);
+          case 87: return (-2*T*(10 + 9*T + 2*Power(T,2))*sqrt((S(ss1)*(1 + S(ss1))*(-3 + 4*T + 4*Power(T,2)))/(Power(1 + 2*S(ss1),2)*T*(10 + 29*T + 20*Power(T,2) + 4*Power(T,3)))))/(3 + 5*T + 2*Power(T,2));
+          case 88: return (6*sqrt(((1 + S(ss1))*(3 + 5*T + 2*Power(T,2)))/(T + 2*S(ss1)*T))*(-2*sqrt((S(ss1)*T*(3 + 2*T))/((1 + 2*S(ss1))*(1 + T))) + 2*Power(T,3)*sqrt((S(ss1)*T*(3 + 2*T))/((1 + 2*S(ss1))*(1 + T))) - T*sqrt((S(ss1)*T*(3 + 5*T + 2*Power(T,2)))/(1 + 2*S(ss1))) + Power(T,2)*(3*sqrt((S(ss1)*T*(3 + 2*T))/((1 + 2*S(ss1))*(1 + T))) - 2*sqrt((S(ss1)*T*(3 + 5*T + 2*Power(T,2)))/(1 + 2*S(ss1))))))/((1 + 2*T)*(6 + 13*T + 9*Power(T,2) + 2*Power(T,3)));
+          case 89: return (-2*sqrt(3)*T*sqrt(((1 + S(ss1))*(3 + 5*T + 2*Power(T,2)))/(T*(10 + 9*T + 2*Power(T,2))))*(-12*sqrt((S(ss1)*(3 + 2*T))/(1 + 3*T + 2*Power(T,2))) + sqrt((S(ss1)*(3 + 8*T + 4*Power(T,2)))/(1 + T)) + sqrt(S(ss1)*(3 + 11*T + 12*Power(T,2) + 4*Power(T,3))) + 2*Power(T,2)*(9*sqrt((S(ss1)*(3 + 2*T))/(1 + 3*T + 2*Power(T,2))) + sqrt((S(ss1)*(3 + 8*T + 4*Power(T,2)))/(1 + T))) - T*(3*sqrt((S(ss1)*(3 + 2*T))/(1 + 3*T + 2*Power(T,2))) + 9*sqrt((S(ss1)*(3 + 8*T + 4*Power(T,2)))/(1 + T)) + 2*sqrt(S(ss1)*(3 + 11*T + 12*Power(T,2) + 4*Power(T,3))))))/((1 + 2*S(ss1))*(6 + 13*T + 9*Power(T,2) + 2*Power(T,3)));
+          case 90: return (-2*sqrt(S(ss1)*(1 + S(ss1))*(3 + 5*T + 2*Power(T,2)))*(96*sqrt(((1 + 2*S(ss1))*T*(9 + 9*T + 2*Power(T,2)))/(2 + T)) + 41*T*sqrt(((1 + 2*S(ss1))*T*(9 + 9*T + 2*Power(T,2)))/(2 + T)) - 14*Power(T,2)*sqrt(((1 + 2*S(ss1))*T*(9 + 9*T + 2*Power(T,2)))/(2 + T)) + Power(T,3)*sqrt(((1 + 2*S(ss1))*T*(9 + 9*T + 2*Power(T,2)))/(2 + T)) + 2*Power(T,4)*sqrt(((1 + 2*S(ss1))*T*(9 + 9*T + 2*Power(T,2)))/(2 + T)) + 81*sqrt(((1 + 2*S(ss1))*Power(T,3)*(9 + 9*T + 2*Power(T,2)))/(2 + T)) + 81*sqrt(((1 + 2*S(ss1))*Power(T,5)*(9 + 9*T + 2*Power(T,2)))/(2 + T)) + 18*sqrt(((1 + 2*S(ss1))*Power(T,7)*(9 + 9*T + 2*Power(T,2)))/(2 + T)) - 18*sqrt((1 + 2*S(ss1))*T*(18 + 27*T + 13*Power(T,2) + 2*Power(T,3)))))/(Power(1 + 2*S(ss1),1.5)*(1 + T)*Power(2 + T,2)*(45 + 63*T + 28*Power(T,2) + 4*Power(T,3)));
+          case 91: return (-2*sqrt(6)*(sqrt((S(ss1)*(1 + 3*T + 2*Power(T,2)))/((1 + 2*S(ss1))*(15 + 16*T + 4*Power(T,2)))) + 3*sqrt((S(ss1)*(3 + 11*T + 12*Power(T,2) + 4*Power(T,3)))/((1 + 2*S(ss1))*(5 + 2*T))) + 2*Power(T,2)*(sqrt((S(ss1)*(1 + 3*T + 2*Power(T,2)))/((1 + 2*S(ss1))*(15 + 16*T + 4*Power(T,2)))) + 3*sqrt((S(ss1)*(1 + 2*T))/((1 + 2*S(ss1))*(15 + 31*T + 20*Power(T,2) + 4*Power(T,3)))) + 6*sqrt(S(ss1)/((1 + 2*S(ss1))*(15 + 61*T + 82*Power(T,2) + 44*Power(T,3) + 8*Power(T,4))))) - T*(9*sqrt((S(ss1)*(1 + 3*T + 2*Power(T,2)))/((1 + 2*S(ss1))*(15 + 16*T + 4*Power(T,2)))) + sqrt((S(ss1)*(3 + 11*T + 12*Power(T,2) + 4*Power(T,3)))/((1 + 2*S(ss1))*(5 + 2*T))) + 9*sqrt((S(ss1)*(1 + 2*T))/((1 + 2*S(ss1))*(15 + 31*T + 20*Power(T,2) + 4*Power(T,3)))) + 6*sqrt(S(ss1)/((1 + 2*S(ss1))*(15 + 61*T + 82*Power(T,2) + 44*Power(T,3) + 8*Power(T,4)))))))/((2 + T)*sqrt(((1 + 2*S(ss1))*(10 + 9*T + 2*Power(T,2)))/(1 + S(ss1))));
+          case 92: return sqrt(2)*sqrt(((1 + S(ss1))*(3 + 5*T + 2*Power(T,2)))/(1 + 2*S(ss1)))*(-2*(-3 + T)*sqrt((S(ss1)*Power(1 + 2*T,2)*(3 + 2*T))/((1 + 2*S(ss1))*Power(2 + T,3)*Power(3 + T,2)*Power(5 + 2*T,2))) + 2/sqrt(((1 + 2*S(ss1))*(2 + T)*Power(3 + T,2)*Power(5 + 2*T,2))/(S(ss1)*Power(1 + 2*T,2)*(3 + 2*T))) - 12*(-1 + 3*T)*sqrt((S(ss1)*Power(1 + 2*T,2))/((1 + 2*S(ss1))*Power(2 + T,3)*Power(3 + T,2)*(3 + 2*T)*Power(5 + 7*T + 2*Power(T,2),2))) - 18*(-1 + T)*(1 + 2*T)*sqrt(S(ss1)/((1 + 2*S(ss1))*Power(2 + T,3)*(3 + 2*T)*Power(15 + 11*T + 2*Power(T,2),2))) - (60*T*sqrt(S(ss1)/((1 + 2*S(ss1))*Power(2 + T,3)*(3 + 2*T))))/(15 + 26*T + 13*Power(T,2) + 2*Power(T,3)));
+          case 93: return (-2*(4*Power(T,3)*(sqrt((S(ss1)*(2 + T))/((1 + 2*S(ss1))*(5 + 2*T))) + 6*sqrt(S(ss1)/((1 + 2*S(ss1))*(10 + 9*T + 2*Power(T,2))))) + 12*Power(T,2)*(sqrt((S(ss1)*(2 + T))/((1 + 2*S(ss1))*(5 + 2*T))) + 12*sqrt(S(ss1)/((1 + 2*S(ss1))*(10 + 9*T + 2*Power(T,2))))) + 3*(sqrt((S(ss1)*(2 + T))/((1 + 2*S(ss1))*(5 + 2*T))) + 68*sqrt(S(ss1)/((1 + 2*S(ss1))*(10 + 9*T + 2*Power(T,2))))) + T*(11*sqrt((S(ss1)*(2 + T))/((1 + 2*S(ss1))*(5 + 2*T))) + 294*sqrt(S(ss1)/((1 + 2*S(ss1))*(10 + 9*T + 2*Power(T,2)))))))/(sqrt(((1 + 2*S(ss1))*(10 + 9*T + 2*Power(T,2)))/(1 + S(ss1)))*(21 + 13*T + 2*Power(T,2)));
+          case 94: return sqrt((9 - 4*Power(T,2))/(1 - 4*Power(T,2)))/(1 + 2*S(ss1));
+          case 95: return -sqrt((9 - 4*Power(T,2))/(1 - 4*Power(T,2)));
+          case 96: return (sqrt(2)*sqrt((1 + 2*S(ss1))*(3 + 5*T + 2*Power(T,2)))*(2*S(ss1)*sqrt((1 + T)/(Power(1 + 2*S(ss1),3)*T*(1 + 2*T))) - 2*sqrt((T + Power(T,2))/(1 + 2*S(ss1) + 2*T + 4*S(ss1)*T)) - sqrt((1 + T)/((1 + 2*S(ss1))*(T + 2*Power(T,2)))) + 2*T*sqrt((1 + T)/((1 + 2*S(ss1))*(T + 2*Power(T,2))))))/Power(1 + T,1.5);
+          case 97: return (sqrt((1 + S(ss1))*(3 + 5*T + 2*Power(T,2)))*((sqrt(2)*(-4 + T)*(-1 + T))/((1 + T)*sqrt(((1 + S(ss1))*(-1 + T)*T*(2 + T))/(-1 + 2*T))*(1 + 2*T)) - (2*S(ss1)*(-4 + T)*(-1 + T))/((1 + 2*S(ss1))*(1 + 2*T)*sqrt(((1 + S(ss1))*(-1 + T)*T*Power(1 + T,2)*(2 + T))/(-2 + 4*T))) - (12*S(ss1))/((1 + 2*S(ss1))*(1 + 2*T)*sqrt(((1 + S(ss1))*T*Power(1 + T,2)*(2 + T))/(2 - 6*T + 4*Power(T,2)))) + 6/sqrt(((1 + S(ss1))*T*Power(1 + T,2)*(2 + T)*Power(1 + 2*T,2))/(2 - 6*T + 4*Power(T,2)))))/sqrt(2);
+          case 98: return 1/sqrt((T*(1 + T)*(1 + 2*T))/(6 + 4*T));
+          case 99: return -((sqrt((1 + S(ss1))*(3 + 5*T + 2*Power(T,2)))*((2*(-4 + T)*(-1 + T))/sqrt(((1 + S(ss1))*Power(3 + 2*S(ss1),2)*(-1 + T)*T*Power(1 + T,2)*(2 + T)*Power(1 + 2*T,2))/(-2 + 4*T)) + ((1 + 2*S(ss1))*(-4 + T)*(-1 + T)*sqrt(-2 + 4*T))/((3 + 2*S(ss1))*sqrt((1 + S(ss1))*T*(-2 + T + Power(T,2)))*(1 + 3*T + 2*Power(T,2))) + (6*(1 + 2*S(ss1)))/((3 + 2*S(ss1))*(1 + 3*T + 2*Power(T,2))*sqrt(((1 + S(ss1))*T*(2 + T))/(2 - 6*T + 4*Power(T,2)))) + 12/sqrt(((1 + S(ss1))*Power(3 + 2*S(ss1),2)*T*Power(1 + T,2)*(2 + T)*Power(1 + 2*T,2))/(2 - 6*T + 4*Power(T,2)))))/sqrt(2));
+          case 100: return (sqrt(6)*sqrt(-(1/((1 + T)*(T - 4*Power(T,3))))))/(1 + 2*S(ss1));
+          case 101: return (sqrt((1 + S(ss1))*(3 + 5*T + 2*Power(T,2)))*((-12*sqrt(6)*S(ss1)*(-1 + T))/((1 + 2*S(ss1))*(1 + T)*sqrt(((1 + S(ss1))*T*(2 + 5*T + 2*Power(T,2))*(3 + 5*T + 2*Power(T,2)))/(-1 + 2*T))) - (2*sqrt(6)*S(ss1)*Power(1 - 2*T,2)*(-4 + T))/((1 + 2*S(ss1))*(1 + T)*sqrt((1 + S(ss1))*T*(2 + 5*T + 2*Power(T,2))*(-3 + T + 8*Power(T,2) + 4*Power(T,3)))) + (4*sqrt(6)*S(ss1)*(-1 + T)*T*(-1 + 2*T))/((1 + 2*S(ss1))*(1 + T)*sqrt((1 + S(ss1))*T*(2 + 5*T + 2*Power(T,2))*(-3 + T + 8*Power(T,2) + 4*Power(T,3)))) + 6*sqrt(6)*sqrt((Power(-1 + T,2)*(-1 + 2*T))/((1 + S(ss1))*T*Power(1 + T,3)*(6 + 19*T + 16*Power(T,2) + 4*Power(T,3)))) + (sqrt(6)*(-4 + T)*(-1 + 2*T))/((1 + T)*sqrt(((1 + S(ss1))*T*(1 + T)*(6 + 19*T + 16*Power(T,2) + 4*Power(T,3)))/(-1 + 2*T))) - (2*sqrt(6)*(-1 + T)*T*(-1 + 2*T))/sqrt((1 + S(ss1))*T*Power(1 + T,3)*(-6 - 7*T + 22*Power(T,2) + 28*Power(T,3) + 8*Power(T,4)))))/sqrt(2);
+          case 102: return sqrt((1 + S(ss1))*(3 + 5*T + 2*Power(T,2)))*((36*sqrt((T*(-1 + 2*T))/((1 + S(ss1))*Power(1 + T,3)*(10 + 29*T + 20*Power(T,2) + 4*Power(T,3)))))/(3 + 2*T) - (72*S(ss1)*sqrt((T*(-1 + 2*T))/((1 + S(ss1))*Power(3 + 2*T,2)*(10 + 39*T + 49*Power(T,2) + 24*Power(T,3) + 4*Power(T,4)))))/((1 + 2*S(ss1))*(1 + T)) + 9*(-3 + 2*T)*(-1 + 2*T)*sqrt(T/((1 + S(ss1))*Power(1 + T,3)*Power(3 + 2*T,2)*(-10 - 9*T + 38*Power(T,2) + 36*Power(T,3) + 8*Power(T,4)))) + (T*(-1 + 2*T)*(1 - 9*T + 2*Power(T,2)))/sqrt((1 + S(ss1))*T*Power(1 + T,3)*Power(3 + 2*T,2)*(-10 - 9*T + 38*Power(T,2) + 36*Power(T,3) + 8*Power(T,4))) - (18*S(ss1)*(-3 + 2*T)*(-1 + 2*T)*sqrt(T/((1 + S(ss1))*Power(3 + 2*T,2)*(-10 - 19*T + 29*Power(T,2) + 74*Power(T,3) + 44*Power(T,4) + 8*Power(T,5)))))/((1 + 2*S(ss1))*(1 + T)) - (2*S(ss1)*T*(-1 + 2*T)*(1 - 9*T + 2*Power(T,2)))/((1 + 2*S(ss1))*(1 + T)*(3 + 2*T)*sqrt((1 + S(ss1))*T*(-10 - 19*T + 29*Power(T,2) + 74*Power(T,3) + 44*Power(T,4) + 8*Power(T,5)))));
+          case 103: return -(sqrt(6)*sqrt(-(1/((1 + T)*(T - 4*Power(T,3))))));
+          case 104: return -((sqrt((1 + S(ss1))*(3 + 5*T + 2*Power(T,2)))*((12*sqrt(6)*(-1 + T))/((3 + 2*S(ss1))*(1 + T)*sqrt(((1 + S(ss1))*T*(2 + 5*T + 2*Power(T,2))*(3 + 5*T + 2*Power(T,2)))/(-1 + 2*T))) + (2*sqrt(6)*Power(1 - 2*T,2)*(-4 + T))/((3 + 2*S(ss1))*(1 + T)*sqrt((1 + S(ss1))*T*(2 + 5*T + 2*Power(T,2))*(-3 + T + 8*Power(T,2) + 4*Power(T,3)))) + (6*sqrt(6)*(1 + 2*S(ss1))*(-1 + T)*sqrt((-1 + 2*T)/((1 + S(ss1))*Power(3 + 2*S(ss1),2)*T*(6 + 19*T + 16*Power(T,2) + 4*Power(T,3)))))/Power(1 + T,1.5) + (sqrt(6)*(1 + 2*S(ss1))*(-4 + T)*(-1 + 2*T))/((1 + T)*sqrt(((1 + S(ss1))*Power(3 + 2*S(ss1),2)*T*(1 + T)*(6 + 19*T + 16*Power(T,2) + 4*Power(T,3)))/(-1 + 2*T))) - (2*sqrt(6)*(1 + 2*S(ss1))*(-1 + T)*T*(-1 + 2*T))/((3 + 2*S(ss1))*Power(1 + T,1.5)*sqrt((1 + S(ss1))*T*(-6 - 7*T + 22*Power(T,2) + 28*Power(T,3) + 8*Power(T,4)))) - (4*sqrt(6)*(-1 + T)*T*(-1 + 2*T))/sqrt((1 + S(ss1))*Power(3 + 2*S(ss1),2)*T*Power(1 + T,3)*(-6 - 7*T + 22*Power(T,2) + 28*Power(T,3) + 8*Power(T,4)))))/sqrt(2));
+          case 105: return -(sqrt((1 + S(ss1))*(3 + 5*T + 2*Power(T,2)))*(36*sqrt((Power(1 + 2*S(ss1),2)*T*(-1 + 2*T))/((1 + S(ss1))*Power(3 + 2*S(ss1),2)*Power(1 + T,3)*Power(3 + 2*T,2)*(10 + 29*T + 20*Power(T,2) + 4*Power(T,3)))) + (72*sqrt((T*(-1 + 2*T))/((1 + S(ss1))*(10 + 39*T + 49*Power(T,2) + 24*Power(T,3) + 4*Power(T,4)))))/((1 + T)*(9 + 6*S(ss1) + 6*T + 4*S(ss1)*T)) + 18*(-3 + 2*T)*(-1 + 2*T)*sqrt(T/((1 + S(ss1))*Power(3 + 2*S(ss1),2)*Power(1 + T,3)*Power(3 + 2*T,2)*(-10 - 9*T + 38*Power(T,2) + 36*Power(T,3) + 8*Power(T,4)))) + 9*(-3 + 2*T)*(-1 + 2*T)*sqrt((Power(1 + 2*S(ss1),2)*T)/((1 + S(ss1))*Power(3 + 2*S(ss1),2)*Power(1 + T,3)*Power(3 + 2*T,2)*(-10 - 9*T + 38*Power(T,2) + 36*Power(T,3) + 8*Power(T,4)))) + ((1 + 2*S(ss1))*T*(-1 + 2*T)*(1 - 9*T + 2*Power(T,2)))/((3 + 2*S(ss1))*Power(1 + T,1.5)*(3 + 2*T)*sqrt((1 + S(ss1))*T*(-10 - 9*T + 38*Power(T,2) + 36*Power(T,3) + 8*Power(T,4)))) + (2*T*(-1 + 2*T)*(1 - 9*T + 2*Power(T,2)))/((3 + 2*S(ss1))*(1 + T)*(3 + 2*T)*sqrt((1 + S(ss1))*T*(-10 - 19*T + 29*Power(T,2) + 74*Power(T,3) + 44*Power(T,4) + 8*Power(T,5))))));
+          case 106: return 3/((1 + 2*S(ss1))*(1 + T)*(1 + 2*T));
+          case 107: return (sqrt((1 + S(ss1))*(3 + 5*T + 2*Power(T,2)))*((2*sqrt(6)*S(ss1)*T*(-1 + 2*T))/((1 + 2*S(ss1))*(2 + T)*sqrt(((1 + S(ss1))*T*(5 + 7*T + 2*Power(T,2))*(6 + 7*T + 2*Power(T,2)))/(1 + 2*T))) - 2*sqrt(6)*T*(1 - 9*T + 2*Power(T,2))*sqrt((Power(S(ss1),2)*(1 + 2*T))/((1 + S(ss1))*Power(1 + 2*S(ss1),2)*T*Power(2 + 3*T + Power(T,2),3)*(15 + 16*T + 4*Power(T,2)))) - (24*sqrt(6)*S(ss1)*(-1 + 2*T)*sqrt(T/((1 + S(ss1))*(5 + 12*T + 4*Power(T,2))*(6 + 13*T + 9*Power(T,2) + 2*Power(T,3)))))/((1 + 2*S(ss1))*(2 + 3*T + Power(T,2))) + (9*sqrt(6)*Power(T,2)*(-3 + 2*T))/((2 + 3*T + Power(T,2))*sqrt((1 + S(ss1))*T*(5 + 12*T + 4*Power(T,2))*(6 + 13*T + 9*Power(T,2) + 2*Power(T,3)))) - (18*sqrt(6)*S(ss1)*Power(T,2)*(-3 + 2*T))/((1 + 2*S(ss1))*(2 + 3*T + Power(T,2))*sqrt((1 + S(ss1))*T*(5 + 12*T + 4*Power(T,2))*(6 + 13*T + 9*Power(T,2) + 2*Power(T,3)))) - (sqrt(6)*T*(-1 + 2*T))/sqrt(((1 + S(ss1))*T*Power(2 + T,3)*(15 + 31*T + 20*Power(T,2) + 4*Power(T,3)))/(1 + 2*T)) + 12*sqrt(6)*sqrt((Power(1 - 2*T,2)*T)/((1 + S(ss1))*Power(2 + 3*T + Power(T,2),3)*(15 + 46*T + 36*Power(T,2) + 8*Power(T,3)))) + (sqrt(6)*T*(1 + 2*T)*(1 - 9*T + 2*Power(T,2)))/((2 + 3*T + Power(T,2))*sqrt((1 + S(ss1))*T*(30 + 137*T + 225*Power(T,2) + 170*Power(T,3) + 60*Power(T,4) + 8*Power(T,5))))))/sqrt(2);
+          case 108: return sqrt((1 + S(ss1))*(3 + 5*T + 2*Power(T,2)))*((60*sqrt(T/((1 + S(ss1))*Power(2 + T,3)*(9 + 9*T + 2*Power(T,2)))))/(5 + 7*T + 2*Power(T,2)) - 120*sqrt((Power(S(ss1),2)*T)/((1 + S(ss1))*Power(1 + 2*S(ss1),2)*Power(2 + T,3)*Power(5 + 7*T + 2*Power(T,2),2)*(9 + 9*T + 2*Power(T,2)))) + (9*(-1 + T)*T*(1 + 2*T))/(Power(2 + T,1.5)*(5 + 7*T + 2*Power(T,2))*sqrt((1 + S(ss1))*T*(9 + 9*T + 2*Power(T,2)))) + ((-3 + T)*T)/sqrt(((1 + S(ss1))*T*Power(2 + T,3)*Power(5 + 2*T,2)*(9 + 9*T + 2*Power(T,2)))/Power(1 + 2*T,2)) + (18*T*(-1 + 3*T))/((5 + 2*T)*(2 + 3*T + Power(T,2))*sqrt((1 + S(ss1))*T*(18 + 27*T + 13*Power(T,2) + 2*Power(T,3)))) - (18*(-1 + T)*T*(S(ss1) + 2*S(ss1)*T))/((1 + 2*S(ss1))*(2 + T)*(5 + 7*T + 2*Power(T,2))*sqrt((1 + S(ss1))*T*(18 + 27*T + 13*Power(T,2) + 2*Power(T,3)))) - (2*S(ss1)*(-3 + T)*T*(1 + 2*T))/((1 + 2*S(ss1))*(10 + 9*T + 2*Power(T,2))*sqrt((1 + S(ss1))*T*(18 + 27*T + 13*Power(T,2) + 2*Power(T,3)))) - (36*S(ss1)*T*(-1 + 3*T))/((1 + 2*S(ss1))*(1 + T)*(10 + 9*T + 2*Power(T,2))*sqrt((1 + S(ss1))*T*(18 + 27*T + 13*Power(T,2) + 2*Power(T,3)))));
+          case 109: return -3/(1 + 3*T + 2*Power(T,2));
+          case 110: return -(sqrt(3)*sqrt((1 + S(ss1))*(3 + 5*T + 2*Power(T,2)))*((2*(1 - 9*T + 2*Power(T,2))*sqrt((T*(1 + 2*T))/((1 + S(ss1))*(15 + 16*T + 4*Power(T,2)))))/((3 + 2*S(ss1))*Power(2 + 3*T + Power(T,2),1.5)) + ((1 + 2*S(ss1))*(1 - 9*T + 2*Power(T,2))*sqrt((T*(1 + 2*T))/((1 + S(ss1))*(15 + 16*T + 4*Power(T,2)))))/((3 + 2*S(ss1))*Power(2 + 3*T + Power(T,2),1.5)) - T*(-1 + 2*T)*sqrt((Power(1 + 2*S(ss1),2)*(1 + 2*T))/((1 + S(ss1))*Power(3 + 2*S(ss1),2)*T*Power(2 + T,3)*(15 + 31*T + 20*Power(T,2) + 4*Power(T,3)))) - (2*T*(-1 + 2*T))/sqrt(((1 + S(ss1))*Power(3 + 2*S(ss1),2)*T*Power(2 + T,3)*(15 + 31*T + 20*Power(T,2) + 4*Power(T,3)))/(1 + 2*T)) + 12*sqrt((Power(1 + 2*S(ss1),2)*Power(1 - 2*T,2)*T)/((1 + S(ss1))*Power(3 + 2*S(ss1),2)*Power(2 + 3*T + Power(T,2),3)*(15 + 46*T + 36*Power(T,2) + 8*Power(T,3)))) + (24*(-1 + 2*T))/((3 + 2*S(ss1))*Power(2 + 3*T + Power(T,2),1.5)*sqrt(((1 + S(ss1))*(15 + 46*T + 36*Power(T,2) + 8*Power(T,3)))/T)) + (18*Power(T,2)*(-3 + 2*T))/((3 + 2*S(ss1))*(2 + 3*T + Power(T,2))*sqrt((1 + S(ss1))*T*(30 + 137*T + 225*Power(T,2) + 170*Power(T,3) + 60*Power(T,4) + 8*Power(T,5)))) + (9*(1 + 2*S(ss1))*Power(T,2)*(-3 + 2*T))/((3 + 2*S(ss1))*(2 + 3*T + Power(T,2))*sqrt((1 + S(ss1))*T*(30 + 137*T + 225*Power(T,2) + 170*Power(T,3) + 60*Power(T,4) + 8*Power(T,5))))));
+          case 111: return -(sqrt((1 + S(ss1))*(3 + 5*T + 2*Power(T,2)))*(60*sqrt((Power(1 + 2*S(ss1),2)*T)/((1 + S(ss1))*Power(3 + 2*S(ss1),2)*Power(2 + T,3)*Power(5 + 7*T + 2*Power(T,2),2)*(9 + 9*T + 2*Power(T,2)))) + (2*(-3 + T)*T*(1 + 2*T))/((3 + 2*S(ss1))*Power(2 + T,1.5)*(5 + 2*T)*sqrt((1 + S(ss1))*T*(9 + 9*T + 2*Power(T,2)))) + ((1 + 2*S(ss1))*(-3 + T)*T*(1 + 2*T))/((3 + 2*S(ss1))*Power(2 + T,1.5)*(5 + 2*T)*sqrt((1 + S(ss1))*T*(9 + 9*T + 2*Power(T,2)))) + (18*(1 + 2*S(ss1))*T*(-1 + 3*T))/((3 + 2*S(ss1))*Power(2 + T,1.5)*(5 + 7*T + 2*Power(T,2))*sqrt((1 + S(ss1))*T*(9 + 9*T + 2*Power(T,2)))) + 120/sqrt(((1 + S(ss1))*Power(3 + 2*S(ss1),2)*Power(2 + T,3)*Power(5 + 7*T + 2*Power(T,2),2)*(9 + 9*T + 2*Power(T,2)))/T) + (18*(-1 + T)*T*(1 + 2*T))/((3 + 2*S(ss1))*(5 + 2*T)*(2 + 3*T + Power(T,2))*sqrt((1 + S(ss1))*T*(18 + 27*T + 13*Power(T,2) + 2*Power(T,3)))) + (9*(1 + 2*S(ss1))*(-1 + T)*T*(1 + 2*T))/((3 + 2*S(ss1))*(5 + 2*T)*(2 + 3*T + Power(T,2))*sqrt((1 + S(ss1))*T*(18 + 27*T + 13*Power(T,2) + 2*Power(T,3)))) + (36*T*(-1 + 3*T))/((3 + 2*S(ss1))*(5 + 2*T)*(2 + 3*T + Power(T,2))*sqrt((1 + S(ss1))*T*(18 + 27*T + 13*Power(T,2) + 2*Power(T,3))))));
+          case 112: return -(sqrt(6)*sqrt((1 + S(ss1))*(3 + 5*T + 2*Power(T,2)))*((-1 + 2*T)*sqrt((1 + 2*T)/((1 + S(ss1))*Power(2 + T,3)*Power(5 + 2*T,2))) - 2*(-1 + 2*T)*sqrt((Power(S(ss1),2)*(1 + 2*T))/((1 + S(ss1))*Power(1 + 2*S(ss1),2)*Power(2 + T,3)*Power(5 + 2*T,2))) + (2*S(ss1))/((1 + 2*S(ss1))*sqrt(((1 + S(ss1))*(2 + T)*Power(5 + 2*T,2))/(1 + 2*T))) - sqrt((1 + 2*T)/(2 + 2*S(ss1) + T + S(ss1)*T))/(5 + 2*T) + (-1 + 9*T - 2*Power(T,2))*sqrt((1 + 2*T)/((1 + S(ss1))*Power(2 + T,3)*Power(15 + 16*T + 4*Power(T,2),2))) + 2*(1 - 9*T + 2*Power(T,2))*sqrt((Power(S(ss1),2)*(1 + 2*T))/((1 + S(ss1))*Power(1 + 2*S(ss1),2)*Power(2 + T,3)*Power(15 + 16*T + 4*Power(T,2),2))) - 3*(-3 + 2*T)*sqrt((Power(T,2)*(1 + 2*T))/((1 + S(ss1))*Power(2 + T,3)*Power(15 + 31*T + 20*Power(T,2) + 4*Power(T,3),2))) + (6*S(ss1)*T*(-3 + 2*T))/((1 + 2*S(ss1))*Power(2 + T,1.5)*sqrt((1 + S(ss1))/(1 + 2*T))*(15 + 31*T + 20*Power(T,2) + 4*Power(T,3))) - (6*T*(-1 + 2*T))/(Power(2 + T,1.5)*sqrt((1 + S(ss1))*(1 + 2*T))*(15 + 31*T + 20*Power(T,2) + 4*Power(T,3))) + (12*S(ss1)*T*(-1 + 2*T))/((1 + 2*S(ss1))*(2 + T)*sqrt((1 + S(ss1))*(2 + 5*T + 2*Power(T,2)))*(15 + 31*T + 20*Power(T,2) + 4*Power(T,3)))));
+          case 113: return -((sqrt(2)*sqrt((1 + S(ss1))*(3 + 5*T + 2*Power(T,2)))*(Power(T,4)*(-18*sqrt(1/((1 + S(ss1))*Power(2 + T,5)*(3 + 2*T))) + 4*S(ss1)*sqrt((3 + 2*T)/((1 + S(ss1))*Power(2 + T,5)))) + 5*(6*sqrt(1/((1 + S(ss1))*Power(2 + T,5)*(3 + 2*T))) + sqrt((3 + 2*T)/((1 + S(ss1))*Power(2 + T,3)))) + 6*S(ss1)*(-2*sqrt((3 + 2*T)/((1 + S(ss1))*Power(2 + T,5))) + sqrt((3 + 2*T)/((1 + S(ss1))*Power(2 + T,3)))) - 2*Power(T,2)*(54*sqrt(1/((1 + S(ss1))*Power(2 + T,5)*(3 + 2*T))) + 14*S(ss1)*sqrt((3 + 2*T)/((1 + S(ss1))*Power(2 + T,5))) - 5*sqrt((3 + 2*T)/((1 + S(ss1))*Power(2 + T,3))) - 3*S(ss1)*sqrt((3 + 2*T)/((1 + S(ss1))*Power(2 + T,3)))) + T*(-21*sqrt(1/((1 + S(ss1))*Power(2 + T,5)*(3 + 2*T))) - 38*S(ss1)*sqrt((3 + 2*T)/((1 + S(ss1))*Power(2 + T,5))) + 15*sqrt((3 + 2*T)/((1 + S(ss1))*Power(2 + T,3))) + 16*S(ss1)*sqrt((3 + 2*T)/((1 + S(ss1))*Power(2 + T,3)))) + Power(T,3)*(-81*sqrt(1/((1 + S(ss1))*Power(2 + T,5)*(3 + 2*T))) + 2*S(ss1)*(sqrt((3 + 2*T)/((1 + S(ss1))*Power(2 + T,5))) - 2*sqrt((3 + 2*T)/((1 + S(ss1))*Power(2 + T,3)))))))/((1 + 2*S(ss1))*(15 + 26*T + 13*Power(T,2) + 2*Power(T,3))));
+          case 114: return (120*sqrt(((1 + 3*S(ss1) + 2*Power(S(ss1),2))*(5 + 12*T + 4*Power(T,2)))/(21 + 13*T + 2*Power(T,2))) + 79*T*sqrt(((1 + 3*S(ss1) + 2*Power(S(ss1),2))*(5 + 12*T + 4*Power(T,2)))/(21 + 13*T + 2*Power(T,2))) + 21*Power(T,2)*sqrt(((1 + 3*S(ss1) + 2*Power(S(ss1),2))*(5 + 12*T + 4*Power(T,2)))/(21 + 13*T + 2*Power(T,2))) + 2*Power(T,3)*sqrt(((1 + 3*S(ss1) + 2*Power(S(ss1),2))*(5 + 12*T + 4*Power(T,2)))/(21 + 13*T + 2*Power(T,2))) + 90*sqrt(((1 + 3*S(ss1) + 2*Power(S(ss1),2))*(5 + 2*T))/(21 + 55*T + 28*Power(T,2) + 4*Power(T,3))) - 2*S(ss1)*(120*sqrt(((1 + S(ss1))*(5 + 12*T + 4*Power(T,2)))/((1 + 2*S(ss1))*(21 + 13*T + 2*Power(T,2)))) + 79*T*sqrt(((1 + S(ss1))*(5 + 12*T + 4*Power(T,2)))/((1 + 2*S(ss1))*(21 + 13*T + 2*Power(T,2)))) + 21*Power(T,2)*sqrt(((1 + S(ss1))*(5 + 12*T + 4*Power(T,2)))/((1 + 2*S(ss1))*(21 + 13*T + 2*Power(T,2)))) + 2*Power(T,3)*sqrt(((1 + S(ss1))*(5 + 12*T + 4*Power(T,2)))/((1 + 2*S(ss1))*(21 + 13*T + 2*Power(T,2)))) + 90*sqrt(((1 + S(ss1))*(5 + 2*T))/((1 + 2*S(ss1))*(21 + 55*T + 28*Power(T,2) + 4*Power(T,3))))))/sqrt(((1 + 3*S(ss1) + 2*Power(S(ss1),2))*Power(2 + T,2)*Power(5 + 2*T,3)*(21 + 13*T + 2*Power(T,2)))/(1 + 2*T));
+          case 115: return -(sqrt(6)*sqrt((1 + S(ss1))*(3 + 5*T + 2*Power(T,2)))*((2 - 4*T)/((3 + 2*S(ss1))*Power(2 + T,1.5)*sqrt((1 + S(ss1))/(1 + 2*T))*(5 + 2*T)) + 2/((3 + 2*S(ss1))*sqrt(((1 + S(ss1))*(2 + T))/(1 + 2*T))*(5 + 2*T)) + 1/sqrt(((1 + S(ss1))*Power(3 + 2*S(ss1),2)*(2 + T)*Power(5 + 2*T,2))/(Power(1 + 2*S(ss1),2)*(1 + 2*T))) + (1 - 2*T)/sqrt(((1 + S(ss1))*Power(3 + 2*S(ss1),2)*Power(2 + T,3)*Power(5 + 2*T,2))/(Power(1 + 2*S(ss1),2)*(1 + 2*T))) + (6*(1 + 2*S(ss1))*T*(-1 + 2*T))/((3 + 2*S(ss1))*Power(2 + T,1.5)*sqrt((1 + S(ss1))*(1 + 2*T))*(3 + 2*T)*(5 + 7*T + 2*Power(T,2))) + (3*(-3 + 2*T))/sqrt(((1 + S(ss1))*Power(3 + 2*S(ss1),2)*Power(2 + T,3)*Power(3 + 2*T,2)*Power(5 + 7*T + 2*Power(T,2),2))/((1 + 2*T)*Power(T + 2*S(ss1)*T,2))) + (2*(1 - 9*T + 2*Power(T,2)))/((3 + 2*S(ss1))*sqrt(((1 + S(ss1))*(2 + T)*Power(3 + 2*T,2))/(1 + 2*T))*(10 + 9*T + 2*Power(T,2))) + ((1 + 2*S(ss1))*(1 - 9*T + 2*Power(T,2)))/((3 + 2*S(ss1))*sqrt(((1 + S(ss1))*(2 + T)*Power(3 + 2*T,2))/(1 + 2*T))*(10 + 9*T + 2*Power(T,2))) + (12*T*(-1 + 2*T))/((3 + 2*S(ss1))*(3 + 2*T)*sqrt((1 + S(ss1))*(2 + 5*T + 2*Power(T,2)))*(10 + 19*T + 11*Power(T,2) + 2*Power(T,3))) + (6*(-3 + 2*T))/sqrt(((1 + S(ss1))*Power(3 + 2*S(ss1),2)*Power(2 + T,3)*Power(15 + 31*T + 20*Power(T,2) + 4*Power(T,3),2))/(Power(T,2)*(1 + 2*T)))));
+          case 116: return -((sqrt(2)*sqrt((1 + S(ss1))*(3 + 5*T + 2*Power(T,2)))*((-2*(1 + 2*T))/((3 + T)*sqrt(((1 + S(ss1))*(2 + T))/(3 + 2*T))*(5 + 2*T)) + (60*T)/(Power(2 + T,1.5)*(3 + T)*sqrt((1 + S(ss1))*(3 + 2*T))*(5 + 7*T + 2*Power(T,2))) + (6*(1 + 2*S(ss1))*(1 + 2*T)*(-1 + 3*T))/(Power(2 + T,1.5)*(3 + T)*sqrt((1 + S(ss1))*(3 + 2*T))*(5 + 7*T + 2*Power(T,2))) + (2*(-3 + T)*(1 + 2*T))/(sqrt(((1 + S(ss1))*(2 + T)*Power(3 + T,2))/(3 + 2*T))*(10 + 9*T + 2*Power(T,2))) + ((1 + 2*S(ss1))*(-3 + T)*(1 + 2*T))/(sqrt(((1 + S(ss1))*(2 + T)*Power(3 + T,2))/(3 + 2*T))*(10 + 9*T + 2*Power(T,2))) + (18*(-1 + T)*(1 + 2*T))/((3 + T)*sqrt((1 + S(ss1))*(6 + 7*T + 2*Power(T,2)))*(10 + 9*T + 2*Power(T,2))) + (9*(1 + 2*S(ss1))*(-1 + T)*(1 + 2*T))/((3 + T)*sqrt((1 + S(ss1))*(6 + 7*T + 2*Power(T,2)))*(10 + 9*T + 2*Power(T,2))) - ((1 + 2*S(ss1))*(1 + 2*T))/(sqrt(((1 + S(ss1))*(2 + T))/(3 + 2*T))*(15 + 11*T + 2*Power(T,2))) + (30*(T + 2*S(ss1)*T))/(Power(2 + T,1.5)*sqrt((1 + S(ss1))*(3 + 2*T))*(15 + 26*T + 13*Power(T,2) + 2*Power(T,3))) + (12*(1 + 2*T)*(-1 + 3*T))/((2 + T)*sqrt((1 + S(ss1))*(6 + 7*T + 2*Power(T,2)))*(15 + 26*T + 13*Power(T,2) + 2*Power(T,3)))))/(3 + 2*S(ss1)));
+          case 117: return -(((3 + 2*S(ss1))*(120*sqrt(((1 + S(ss1))*(5 + 12*T + 4*Power(T,2)))/((3 + 2*S(ss1))*(21 + 13*T + 2*Power(T,2)))) + 79*T*sqrt(((1 + S(ss1))*(5 + 12*T + 4*Power(T,2)))/((3 + 2*S(ss1))*(21 + 13*T + 2*Power(T,2)))) + 21*Power(T,2)*sqrt(((1 + S(ss1))*(5 + 12*T + 4*Power(T,2)))/((3 + 2*S(ss1))*(21 + 13*T + 2*Power(T,2)))) + 2*Power(T,3)*sqrt(((1 + S(ss1))*(5 + 12*T + 4*Power(T,2)))/((3 + 2*S(ss1))*(21 + 13*T + 2*Power(T,2)))) + 90*sqrt(((1 + S(ss1))*(5 + 2*T))/((3 + 2*S(ss1))*(21 + 55*T + 28*Power(T,2) + 4*Power(T,3))))))/sqrt(((1 + S(ss1))*(3 + 2*S(ss1))*Power(2 + T,2)*Power(5 + 2*T,3)*(21 + 13*T + 2*Power(T,2)))/(1 + 2*T)));
+          case 118: return sqrt(((-1 + S(ss1) + 2*Power(S(ss1),2))*(-3 + 4*T + 4*Power(T,2)))/(S(ss1)*(1 + 2*S(ss1))))/(1 + 2*T);
+          case 119: return -(1/((1 + T)*sqrt((S(ss1)*(1 + 2*S(ss1))*(1 + 2*T))/((-1 + S(ss1) + 2*Power(S(ss1),2))*(3 + 2*T)))));
+          case 120: return (sqrt(((1 + S(ss1))*(3 + 2*T))/S(ss1))*(2*sqrt(((-1 + 2*S(ss1))*T)/((1 + 2*S(ss1))*(6 + 7*T + 2*Power(T,2)))) + sqrt(((-1 + 2*S(ss1))*Power(T,3))/((1 + 2*S(ss1))*(6 + 7*T + 2*Power(T,2))))))/(1 + T);
+          case 121: return sqrt((-1 + S(ss1) + 2*Power(S(ss1),2))/(S(ss1)*(1 + 2*S(ss1))))/(1 + 3*T + 2*Power(T,2));
+          case 122: return -(sqrt((-1 + S(ss1) + 2*Power(S(ss1),2))/(S(ss1)*(1 + 2*S(ss1))))/(1 + T));
+          case 123: return sqrt((-1 + S(ss1) + 2*Power(S(ss1),2))/(S(ss1)*(1 + 2*S(ss1))));
+          case 124: return -(1/sqrt((S(ss1)*(1 + 2*S(ss1))*Power(1 + 2*T,2))/(-3 + 4*T + 4*Power(T,2))));
+          case 125: return ((3 + 2*S(ss1))*sqrt((S(ss1)*(-3 + 4*T + 4*Power(T,2)))/(3 + 11*S(ss1) + 12*Power(S(ss1),2) + 4*Power(S(ss1),3))))/(1 + 2*T);
+          case 126: return 1/((1 + T)*sqrt((S(ss1)*(1 + 2*S(ss1))*(1 + 2*T))/(3 + 2*T)));
+          case 127: return -((-2*T*sqrt((S(ss1)*Power(1 + S(ss1),3)*T*Power(1 + T,2))/(3 + 2*T)) + 2*Power(T,2)*sqrt((S(ss1)*Power(1 + S(ss1),3)*T*Power(1 + T,2))/(3 + 2*T)) - (Power(1 + S(ss1),1.5)*(-1 + 2*S(ss1))*Power(T,2.5)*(1 + T))/sqrt(S(ss1)*(3 + 2*T)) + (Power(1 + S(ss1),1.5)*(-1 + 2*S(ss1))*T*(1 + T))/sqrt((S(ss1)*(3 + 2*T))/T) + 6*Power((1 + S(ss1))*T*(1 + T),1.5)*sqrt(S(ss1)/(3 + 5*T + 2*Power(T,2))) - (3*(-1 + 2*S(ss1))*Power((1 + S(ss1))*T*(1 + T),1.5))/sqrt(S(ss1)*(3 + 5*T + 2*Power(T,2))))/(Power(1 + S(ss1),1.5)*T*Power(1 + T,2)*sqrt(((1 + 2*S(ss1))*(2 + T))/(3 + 2*T))));
+          case 128: return -((S(ss1)*(3 + 2*S(ss1)))/((1 + T)*sqrt((S(ss1)*(1 + S(ss1))*(3 + 8*S(ss1) + 4*Power(S(ss1),2))*(1 + 2*T))/(3 + 2*T))));
+          case 129: return (12*sqrt((S(ss1)*T)/((3 + 11*S(ss1) + 12*Power(S(ss1),2) + 4*Power(S(ss1),3))*(2 + T))))/(1 + T) + (3*S(ss1)*(-1 + 2*S(ss1)))/sqrt((S(ss1)*(1 + S(ss1))*(3 + 8*S(ss1) + 4*Power(S(ss1),2))*Power(1 + T,2)*(2 + T))/T) + (4*(-1 + T)*T)/sqrt(((1 + S(ss1))*(3 + 8*S(ss1) + 4*Power(S(ss1),2))*T*Power(1 + T,2)*(2 + T))/S(ss1)) + ((-1 + 2*S(ss1))*(-1 + T)*T)/sqrt(((1 + S(ss1))*(3 + 8*S(ss1) + 4*Power(S(ss1),2))*T*Power(1 + T,2)*(2 + T))/S(ss1));
+          case 130: return -((2*(-1 + 2*S(ss1))*T*sqrt((1 + 2*T)/(S(ss1) + S(ss1)*T)) - 4*T*sqrt((S(ss1) + 2*S(ss1)*T)/(1 + T)) + (1 - 2*S(ss1))/sqrt(S(ss1)/(1 + 3*T + 2*Power(T,2))) + 2*T*(-1 + 2*T)*sqrt(S(ss1)/(1 + 3*T + 2*Power(T,2))) - ((-1 + 2*S(ss1))*T*(-1 + 2*T))/sqrt(S(ss1)*(1 + 3*T + 2*Power(T,2))) + 2*sqrt(S(ss1)*(1 + 3*T + 2*Power(T,2))))/((1 + T)*sqrt(((1 + 2*S(ss1))*(1 + 2*T))/(1 + T))));
+          case 131: return 1/sqrt(S(ss1)*(1 + 2*S(ss1))*Power(1 + T,2));
+          case 132: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 133: return (3*sqrt((S(ss1)*(1 + 3*T + 2*Power(T,2)))/(1 + S(ss1))) + 2*sqrt((Power(S(ss1),3)*(1 + 3*T + 2*Power(T,2)))/(1 + S(ss1))) - T*(6*sqrt((S(ss1) + 2*S(ss1)*T)/(1 + S(ss1) + T + S(ss1)*T)) + 4*sqrt((Power(S(ss1),3) + 2*Power(S(ss1),3)*T)/(1 + S(ss1) + T + S(ss1)*T)) + 3*sqrt(S(ss1)/((1 + S(ss1))*(1 + 3*T + 2*Power(T,2)))) + 2*sqrt(Power(S(ss1),3)/((1 + S(ss1))*(1 + 3*T + 2*Power(T,2))))) + Power(T,2)*(6*sqrt(S(ss1)/((1 + S(ss1))*(1 + 3*T + 2*Power(T,2)))) + 4*sqrt(Power(S(ss1),3)/((1 + S(ss1))*(1 + 3*T + 2*Power(T,2))))))/sqrt((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(1 + 3*T + 2*Power(T,2)));
+          case 134: return -(sqrt((1 + S(ss1))*(3 + 5*T + 2*Power(T,2)))*(-4*(-1 + T)*sqrt((S(ss1)*Power(1 + 2*T,2))/(Power(1 + S(ss1),2)*(3 + 8*S(ss1) + 4*Power(S(ss1),2))*Power(1 + T,3)*Power(2 + T,2)*(3 + 2*T))) + (3 - 6*S(ss1))/sqrt((Power(1 + S(ss1),2)*(3 + 8*S(ss1) + 4*Power(S(ss1),2))*Power(1 + T,3)*Power(2 + T,2)*(3 + 2*T))/(S(ss1)*Power(T,2))) + (-1 - 2*S(ss1)*(-1 + T) + T)/sqrt((Power(1 + S(ss1),2)*(3 + 8*S(ss1) + 4*Power(S(ss1),2))*Power(1 + T,3)*Power(2 + T,2)*(3 + 2*T))/(S(ss1)*Power(1 + 2*T,2))) - (12*T*sqrt(S(ss1)/(Power(1 + S(ss1),2)*(3 + 8*S(ss1) + 4*Power(S(ss1),2))*(3 + 5*T + 2*Power(T,2)))))/(2 + 3*T + Power(T,2)) + 4*sqrt((S(ss1)*Power(1 + 2*T,2))/(Power(1 + S(ss1),2)*(3 + 8*S(ss1) + 4*Power(S(ss1),2))*Power(2 + T,2)*(3 + 5*T + 2*Power(T,2)))) + (S(ss1)*(-1 + 2*S(ss1))*(1 + 2*T))/((1 + S(ss1))*(2 + T)*sqrt(S(ss1)*(3 + 8*S(ss1) + 4*Power(S(ss1),2))*(3 + 5*T + 2*Power(T,2))))));
+          case 135: return (3 + 2*S(ss1))*sqrt(S(ss1)/((1 + S(ss1))*(3 + 8*S(ss1) + 4*Power(S(ss1),2))));
+          case 136: return -((2*sqrt(((1 + 3*S(ss1) + 2*Power(S(ss1),2))*T*(-1 + 2*T))/((3 + 2*S(ss1))*(1 + 3*T + 2*Power(T,2)))) + sqrt(((1 + 2*S(ss1))*T*(-1 + 2*T))/((3 + 5*S(ss1) + 2*Power(S(ss1),2))*(1 + 3*T + 2*Power(T,2)))) - 2*S(ss1)*(sqrt(((1 + 2*S(ss1))*T*(-1 + 2*T))/((3 + 5*S(ss1) + 2*Power(S(ss1),2))*(1 + 3*T + 2*Power(T,2)))) + 2*sqrt((T*(-1 + 2*T))/((3 + 11*S(ss1) + 12*Power(S(ss1),2) + 4*Power(S(ss1),3))*(1 + 3*T + 2*Power(T,2))))))/sqrt(((3 + 2*S(ss1))*T*(1 + 2*T))/(3 + 5*T + 2*Power(T,2))));
+          case 137: return sqrt(-3 + 4*T + 4*Power(T,2))/(1 + 2*T);
+          case 138: return 1/((1 + T)*sqrt(((1 + 3*S(ss1) + 2*Power(S(ss1),2))*(1 + 2*T))/(3 + 2*T)));
+          case 139: return -(sqrt((1 + S(ss1))*(3 + 5*T + 2*Power(T,2)))*(2*(-1 + T)*T*sqrt((1 + 2*S(ss1))/(Power(3 + 2*S(ss1),2)*T*Power(1 + T,3)*(6 + 7*T + 2*Power(T,2)))) - (12*S(ss1)*sqrt(T/((1 + 2*S(ss1))*Power(1 + T,3)*(6 + 7*T + 2*Power(T,2)))))/(3 + 5*S(ss1) + 2*Power(S(ss1),2)) + (6*sqrt(((1 + 2*S(ss1))*T)/(Power(1 + T,3)*(6 + 7*T + 2*Power(T,2)))))/(3 + 2*S(ss1)) - 4*(-1 + T)*sqrt((Power(S(ss1),2)*T)/((1 + 2*S(ss1))*Power(3 + 5*S(ss1) + 2*Power(S(ss1),2),2)*Power(1 + T,3)*(6 + 7*T + 2*Power(T,2)))) + (3 - 6*S(ss1))/sqrt((Power(3 + 5*S(ss1) + 2*Power(S(ss1),2),2)*Power(1 + T,3)*(6 + 7*T + 2*Power(T,2)))/(T + 2*S(ss1)*T)) + (-1 - 2*S(ss1)*(-1 + T) + T)/sqrt((Power(3 + 5*S(ss1) + 2*Power(S(ss1),2),2)*Power(1 + T,3)*(6 + 7*T + 2*Power(T,2)))/(T + 2*S(ss1)*T))));
+          case 140: return -(sqrt((3 + 2*T)/(1 + 2*T))/(1 + T));
+          case 141: return sqrt(T*(2 + T))/(1 + T);
+          case 142: return -(1/(sqrt((1 + S(ss1))*(1 + 2*S(ss1)))*(1 + 3*T + 2*Power(T,2))));
+          case 143: return -(sqrt((1 + S(ss1))*(3 + 5*T + 2*Power(T,2)))*((6*T*sqrt((1 + 2*S(ss1))/(Power(1 + T,3)*(3 + 2*T))))/((3 + 2*S(ss1))*(2 + T)) + 2*(-1 + T)*sqrt(((1 + 2*S(ss1))*Power(1 + 2*T,2))/(Power(3 + 2*S(ss1),2)*Power(1 + T,3)*Power(2 + T,2)*(3 + 2*T))) + ((3 - 6*S(ss1))*T)/((3 + 5*S(ss1) + 2*Power(S(ss1),2))*Power(1 + T,1.5)*(2 + T)*sqrt((3 + 2*T)/(1 + 2*S(ss1)))) - (4*(-1 + T)*(S(ss1) + 2*S(ss1)*T))/((3 + 5*S(ss1) + 2*Power(S(ss1),2))*Power(1 + T,1.5)*(2 + T)*sqrt((1 + 2*S(ss1))*(3 + 2*T))) - ((-1 + 2*S(ss1))*(-1 + T)*(1 + 2*T)*sqrt((1 + 2*S(ss1))/(3 + 5*T + 2*Power(T,2))))/((1 + S(ss1))*(3 + 2*S(ss1))*(1 + T)*(2 + T)) + ((-1 + 2*S(ss1))*(1 + 2*T))/((1 + S(ss1))*(3 + 2*S(ss1))*(2 + T)*sqrt((3 + 5*T + 2*Power(T,2))/(1 + 2*S(ss1)))) + (4*(S(ss1) + 2*S(ss1)*T))/((1 + S(ss1))*(3 + 2*S(ss1))*(2 + T)*sqrt((1 + 2*S(ss1))*(3 + 5*T + 2*Power(T,2)))) - (12*S(ss1)*T)/((3 + 5*S(ss1) + 2*Power(S(ss1),2))*(2 + 3*T + Power(T,2))*sqrt((1 + 2*S(ss1))*(3 + 5*T + 2*Power(T,2)))) - (2*(1 + 2*T))/((3 + 2*S(ss1))*sqrt((Power(2 + T,2)*(3 + 5*T + 2*Power(T,2)))/(1 + 2*S(ss1))))));
+          case 144: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 145: return 1/(1 + 3*T + 2*Power(T,2));
+          case 146: return -(1/(1 + T));
+          case 147: return 1;
+          case 148: return sqrt(((-1 + S(ss1) + 2*Power(S(ss1),2))*(-3 + 4*T + 4*Power(T,2)))/(S(ss1)*(1 + 2*S(ss1))))/(1 + 2*T);
+          case 149: return -(1/((1 + T)*sqrt((S(ss1)*(1 + 2*S(ss1))*(1 + 2*T))/((-1 + S(ss1) + 2*Power(S(ss1),2))*(3 + 2*T)))));
+          case 150: return (sqrt(((1 + S(ss1))*(3 + 2*T))/S(ss1))*(2*sqrt(((-1 + 2*S(ss1))*T)/((1 + 2*S(ss1))*(6 + 7*T + 2*Power(T,2)))) + sqrt(((-1 + 2*S(ss1))*Power(T,3))/((1 + 2*S(ss1))*(6 + 7*T + 2*Power(T,2))))))/(1 + T);
+          case 151: return sqrt((-1 + S(ss1) + 2*Power(S(ss1),2))/(S(ss1)*(1 + 2*S(ss1))))/(1 + 3*T + 2*Power(T,2));
+          case 152: return -(sqrt((-1 + S(ss1) + 2*Power(S(ss1),2))/(S(ss1)*(1 + 2*S(ss1))))/(1 + T));
+          case 153: return sqrt((-1 + S(ss1) + 2*Power(S(ss1),2))/(S(ss1)*(1 + 2*S(ss1))));
+          case 154: return -(1/sqrt((S(ss1)*(1 + 2*S(ss1))*Power(1 + 2*T,2))/(-3 + 4*T + 4*Power(T,2))));
+          case 155: return ((3 + 2*S(ss1))*sqrt((S(ss1)*(-3 + 4*T + 4*Power(T,2)))/(3 + 11*S(ss1) + 12*Power(S(ss1),2) + 4*Power(S(ss1),3))))/(1 + 2*T);
+          case 156: return 1/((1 + T)*sqrt((S(ss1)*(1 + 2*S(ss1))*(1 + 2*T))/(3 + 2*T)));
+          case 157: return -((-2*T*sqrt((S(ss1)*Power(1 + S(ss1),3)*T*Power(1 + T,2))/(3 + 2*T)) + 2*Power(T,2)*sqrt((S(ss1)*Power(1 + S(ss1),3)*T*Power(1 + T,2))/(3 + 2*T)) - (Power(1 + S(ss1),1.5)*(-1 + 2*S(ss1))*Power(T,2.5)*(1 + T))/sqrt(S(ss1)*(3 + 2*T)) + (Power(1 + S(ss1),1.5)*(-1 + 2*S(ss1))*T*(1 + T))/sqrt((S(ss1)*(3 + 2*T))/T) + 6*Power((1 + S(ss1))*T*(1 + T),1.5)*sqrt(S(ss1)/(3 + 5*T + 2*Power(T,2))) - (3*(-1 + 2*S(ss1))*Power((1 + S(ss1))*T*(1 + T),1.5))/sqrt(S(ss1)*(3 + 5*T + 2*Power(T,2))))/(Power(1 + S(ss1),1.5)*T*Power(1 + T,2)*sqrt(((1 + 2*S(ss1))*(2 + T))/(3 + 2*T))));
+          case 158: return -((S(ss1)*(3 + 2*S(ss1)))/((1 + T)*sqrt((S(ss1)*(1 + S(ss1))*(3 + 8*S(ss1) + 4*Power(S(ss1),2))*(1 + 2*T))/(3 + 2*T))));
+          case 159: return (12*sqrt((S(ss1)*T)/((3 + 11*S(ss1) + 12*Power(S(ss1),2) + 4*Power(S(ss1),3))*(2 + T))))/(1 + T) + (3*S(ss1)*(-1 + 2*S(ss1)))/sqrt((S(ss1)*(1 + S(ss1))*(3 + 8*S(ss1) + 4*Power(S(ss1),2))*Power(1 + T,2)*(2 + T))/T) + (4*(-1 + T)*T)/sqrt(((1 + S(ss1))*(3 + 8*S(ss1) + 4*Power(S(ss1),2))*T*Power(1 + T,2)*(2 + T))/S(ss1)) + ((-1 + 2*S(ss1))*(-1 + T)*T)/sqrt(((1 + S(ss1))*(3 + 8*S(ss1) + 4*Power(S(ss1),2))*T*Power(1 + T,2)*(2 + T))/S(ss1));
+          case 160: return -((2*(-1 + 2*S(ss1))*T*sqrt((1 + 2*T)/(S(ss1) + S(ss1)*T)) - 4*T*sqrt((S(ss1) + 2*S(ss1)*T)/(1 + T)) + (1 - 2*S(ss1))/sqrt(S(ss1)/(1 + 3*T + 2*Power(T,2))) + 2*T*(-1 + 2*T)*sqrt(S(ss1)/(1 + 3*T + 2*Power(T,2))) - ((-1 + 2*S(ss1))*T*(-1 + 2*T))/sqrt(S(ss1)*(1 + 3*T + 2*Power(T,2))) + 2*sqrt(S(ss1)*(1 + 3*T + 2*Power(T,2))))/((1 + T)*sqrt(((1 + 2*S(ss1))*(1 + 2*T))/(1 + T))));
+          case 161: return 1/sqrt(S(ss1)*(1 + 2*S(ss1))*Power(1 + T,2));
+          case 162: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 163: return (3*sqrt((S(ss1)*(1 + 3*T + 2*Power(T,2)))/(1 + S(ss1))) + 2*sqrt((Power(S(ss1),3)*(1 + 3*T + 2*Power(T,2)))/(1 + S(ss1))) - T*(6*sqrt((S(ss1) + 2*S(ss1)*T)/(1 + S(ss1) + T + S(ss1)*T)) + 4*sqrt((Power(S(ss1),3) + 2*Power(S(ss1),3)*T)/(1 + S(ss1) + T + S(ss1)*T)) + 3*sqrt(S(ss1)/((1 + S(ss1))*(1 + 3*T + 2*Power(T,2)))) + 2*sqrt(Power(S(ss1),3)/((1 + S(ss1))*(1 + 3*T + 2*Power(T,2))))) + Power(T,2)*(6*sqrt(S(ss1)/((1 + S(ss1))*(1 + 3*T + 2*Power(T,2)))) + 4*sqrt(Power(S(ss1),3)/((1 + S(ss1))*(1 + 3*T + 2*Power(T,2))))))/sqrt((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(1 + 3*T + 2*Power(T,2)));
+          case 164: return -(sqrt((1 + S(ss1))*(3 + 5*T + 2*Power(T,2)))*(-4*(-1 + T)*sqrt((S(ss1)*Power(1 + 2*T,2))/(Power(1 + S(ss1),2)*(3 + 8*S(ss1) + 4*Power(S(ss1),2))*Power(1 + T,3)*Power(2 + T,2)*(3 + 2*T))) + (3 - 6*S(ss1))/sqrt((Power(1 + S(ss1),2)*(3 + 8*S(ss1) + 4*Power(S(ss1),2))*Power(1 + T,3)*Power(2 + T,2)*(3 + 2*T))/(S(ss1)*Power(T,2))) + (-1 - 2*S(ss1)*(-1 + T) + T)/sqrt((Power(1 + S(ss1),2)*(3 + 8*S(ss1) + 4*Power(S(ss1),2))*Power(1 + T,3)*Power(2 + T,2)*(3 + 2*T))/(S(ss1)*Power(1 + 2*T,2))) - (12*T*sqrt(S(ss1)/(Power(1 + S(ss1),2)*(3 + 8*S(ss1) + 4*Power(S(ss1),2))*(3 + 5*T + 2*Power(T,2)))))/(2 + 3*T + Power(T,2)) + 4*sqrt((S(ss1)*Power(1 + 2*T,2))/(Power(1 + S(ss1),2)*(3 + 8*S(ss1) + 4*Power(S(ss1),2))*Power(2 + T,2)*(3 + 5*T + 2*Power(T,2)))) + (S(ss1)*(-1 + 2*S(ss1))*(1 + 2*T))/((1 + S(ss1))*(2 + T)*sqrt(S(ss1)*(3 + 8*S(ss1) + 4*Power(S(ss1),2))*(3 + 5*T + 2*Power(T,2))))));
+          case 165: return (3 + 2*S(ss1))*sqrt(S(ss1)/((1 + S(ss1))*(3 + 8*S(ss1) + 4*Power(S(ss1),2))));
+          case 166: return -((2*sqrt(((1 + 3*S(ss1) + 2*Power(S(ss1),2))*T*(-1 + 2*T))/((3 + 2*S(ss1))*(1 + 3*T + 2*Power(T,2)))) + sqrt(((1 + 2*S(ss1))*T*(-1 + 2*T))/((3 + 5*S(ss1) + 2*Power(S(ss1),2))*(1 + 3*T + 2*Power(T,2)))) - 2*S(ss1)*(sqrt(((1 + 2*S(ss1))*T*(-1 + 2*T))/((3 + 5*S(ss1) + 2*Power(S(ss1),2))*(1 + 3*T + 2*Power(T,2)))) + 2*sqrt((T*(-1 + 2*T))/((3 + 11*S(ss1) + 12*Power(S(ss1),2) + 4*Power(S(ss1),3))*(1 + 3*T + 2*Power(T,2))))))/sqrt(((3 + 2*S(ss1))*T*(1 + 2*T))/(3 + 5*T + 2*Power(T,2))));
+          case 167: return sqrt(-3 + 4*T + 4*Power(T,2))/(1 + 2*T);
+          case 168: return 1/((1 + T)*sqrt(((1 + 3*S(ss1) + 2*Power(S(ss1),2))*(1 + 2*T))/(3 + 2*T)));
+          case 169: return -(sqrt((1 + S(ss1))*(3 + 5*T + 2*Power(T,2)))*(2*(-1 + T)*T*sqrt((1 + 2*S(ss1))/(Power(3 + 2*S(ss1),2)*T*Power(1 + T,3)*(6 + 7*T + 2*Power(T,2)))) - (12*S(ss1)*sqrt(T/((1 + 2*S(ss1))*Power(1 + T,3)*(6 + 7*T + 2*Power(T,2)))))/(3 + 5*S(ss1) + 2*Power(S(ss1),2)) + (6*sqrt(((1 + 2*S(ss1))*T)/(Power(1 + T,3)*(6 + 7*T + 2*Power(T,2)))))/(3 + 2*S(ss1)) - 4*(-1 + T)*sqrt((Power(S(ss1),2)*T)/((1 + 2*S(ss1))*Power(3 + 5*S(ss1) + 2*Power(S(ss1),2),2)*Power(1 + T,3)*(6 + 7*T + 2*Power(T,2)))) + (3 - 6*S(ss1))/sqrt((Power(3 + 5*S(ss1) + 2*Power(S(ss1),2),2)*Power(1 + T,3)*(6 + 7*T + 2*Power(T,2)))/(T + 2*S(ss1)*T)) + (-1 - 2*S(ss1)*(-1 + T) + T)/sqrt((Power(3 + 5*S(ss1) + 2*Power(S(ss1),2),2)*Power(1 + T,3)*(6 + 7*T + 2*Power(T,2)))/(T + 2*S(ss1)*T))));
+          case 170: return -(sqrt((3 + 2*T)/(1 + 2*T))/(1 + T));
+          case 171: return sqrt(T*(2 + T))/(1 + T);
+          case 172: return -(1/(sqrt((1 + S(ss1))*(1 + 2*S(ss1)))*(1 + 3*T + 2*Power(T,2))));
+          case 173: return -(sqrt((1 + S(ss1))*(3 + 5*T + 2*Power(T,2)))*((6*T*sqrt((1 + 2*S(ss1))/(Power(1 + T,3)*(3 + 2*T))))/((3 + 2*S(ss1))*(2 + T)) + 2*(-1 + T)*sqrt(((1 + 2*S(ss1))*Power(1 + 2*T,2))/(Power(3 + 2*S(ss1),2)*Power(1 + T,3)*Power(2 + T,2)*(3 + 2*T))) + ((3 - 6*S(ss1))*T)/((3 + 5*S(ss1) + 2*Power(S(ss1),2))*Power(1 + T,1.5)*(2 + T)*sqrt((3 + 2*T)/(1 + 2*S(ss1)))) - (4*(-1 + T)*(S(ss1) + 2*S(ss1)*T))/((3 + 5*S(ss1) + 2*Power(S(ss1),2))*Power(1 + T,1.5)*(2 + T)*sqrt((1 + 2*S(ss1))*(3 + 2*T))) - ((-1 + 2*S(ss1))*(-1 + T)*(1 + 2*T)*sqrt((1 + 2*S(ss1))/(3 + 5*T + 2*Power(T,2))))/((1 + S(ss1))*(3 + 2*S(ss1))*(1 + T)*(2 + T)) + ((-1 + 2*S(ss1))*(1 + 2*T))/((1 + S(ss1))*(3 + 2*S(ss1))*(2 + T)*sqrt((3 + 5*T + 2*Power(T,2))/(1 + 2*S(ss1)))) + (4*(S(ss1) + 2*S(ss1)*T))/((1 + S(ss1))*(3 + 2*S(ss1))*(2 + T)*sqrt((1 + 2*S(ss1))*(3 + 5*T + 2*Power(T,2)))) - (12*S(ss1)*T)/((3 + 5*S(ss1) + 2*Power(S(ss1),2))*(2 + 3*T + Power(T,2))*sqrt((1 + 2*S(ss1))*(3 + 5*T + 2*Power(T,2)))) - (2*(1 + 2*T))/((3 + 2*S(ss1))*sqrt((Power(2 + T,2)*(3 + 5*T + 2*Power(T,2)))/(1 + 2*S(ss1))))));
+          case 174: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 175: return 1/(1 + 3*T + 2*Power(T,2));
+          case 176: return -(1/(1 + T));
+          case 177: return 1;
+          case 178: return -2*sqrt((-1 + Power(S(ss1),2))/(-1 + 4*Power(S(ss1),2)));
+          case 179: return sqrt(3)/sqrt(-1 + 4*Power(S(ss1),2));
+          case 180: return -(sqrt(-3 + 4*S(ss1) + 4*Power(S(ss1),2))/(1 + 2*S(ss1)));
+          case 181: return 2/(1 + 2*S(ss1));
+          case 182: return (S(ss1)*sqrt((4 + 4*S(ss1))/(S(ss1) + 2*Power(S(ss1),2)))*(sqrt((2 + 3*S(ss1) + Power(S(ss1),2))/(3 + 2*S(ss1)))*(3 + 8*S(ss1) + 4*Power(S(ss1),2)) - S(ss1)*sqrt((2 + 3*S(ss1) + Power(S(ss1),2))/(3 + 2*S(ss1)))*(3 + 8*S(ss1) + 4*Power(S(ss1),2)) - 7*sqrt(6 + 13*S(ss1) + 9*Power(S(ss1),2) + 2*Power(S(ss1),3)) - 8*S(ss1)*sqrt(6 + 13*S(ss1) + 9*Power(S(ss1),2) + 2*Power(S(ss1),3))))/(Power(3 + 2*S(ss1),2)*(2 + 3*S(ss1) + Power(S(ss1),2)));
+          case 183: return sqrt(3)/sqrt(3 + 8*S(ss1) + 4*Power(S(ss1),2));
+          case 184: return -1;
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(1, 2, 1));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(1, 2, 1));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -120,10 +2087,384 @@ MatrixElements<SC> SymmetrySPSU2T<SC>::recalc_doublet(const DiagInfo<SC> &diag,
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "spsu2t/spsu2t-doubletm+1.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {4, 4},
+        {5, 5},
+        {6, 5},
+        {6, 6},
+        {7, 5},
+        {7, 6},
+        {7, 7},
+        {8, 6},
+        {8, 7},
+        {8, 8},
+        {9, 7},
+        {9, 8},
+        {9, 9},
+        {10, 10},
+        {11, 10},
+        {11, 11},
+        {12, 10},
+        {12, 11},
+        {12, 12},
+        {13, 11},
+        {13, 12},
+        {13, 13},
+        {14, 12},
+        {14, 13},
+        {14, 14},
+        {15, 15},
+        {15, 18},
+        {16, 15},
+        {16, 16},
+        {16, 18},
+        {16, 19},
+        {17, 15},
+        {17, 16},
+        {17, 17},
+        {17, 18},
+        {17, 19},
+        {17, 20},
+        {18, 18},
+        {19, 18},
+        {19, 19},
+        {20, 18},
+        {20, 19},
+        {20, 20},
+        {21, 21},
+        {21, 24},
+        {22, 21},
+        {22, 22},
+        {22, 24},
+        {22, 25},
+        {23, 21},
+        {23, 22},
+        {23, 23},
+        {23, 24},
+        {23, 25},
+        {23, 26},
+        {24, 24},
+        {25, 24},
+        {25, 25},
+        {26, 24},
+        {26, 25},
+        {26, 26},
+        {27, 27},
+        {27, 30},
+        {28, 27},
+        {28, 28},
+        {28, 30},
+        {28, 31},
+        {29, 27},
+        {29, 28},
+        {29, 29},
+        {29, 30},
+        {29, 31},
+        {29, 32},
+        {30, 30},
+        {31, 30},
+        {31, 31},
+        {32, 30},
+        {32, 31},
+        {32, 32},
+        {33, 33},
+        {33, 38},
+        {34, 33},
+        {34, 34},
+        {34, 38},
+        {34, 39},
+        {35, 33},
+        {35, 34},
+        {35, 35},
+        {35, 38},
+        {35, 39},
+        {35, 40},
+        {36, 34},
+        {36, 35},
+        {36, 36},
+        {36, 39},
+        {36, 40},
+        {36, 41},
+        {37, 35},
+        {37, 36},
+        {37, 37},
+        {37, 40},
+        {37, 41},
+        {37, 42},
+        {38, 38},
+        {39, 38},
+        {39, 39},
+        {40, 38},
+        {40, 39},
+        {40, 40},
+        {41, 39},
+        {41, 40},
+        {41, 41},
+        {42, 40},
+        {42, 41},
+        {42, 42},
+        {43, 43},
+        {43, 46},
+        {44, 43},
+        {44, 44},
+        {44, 46},
+        {44, 47},
+        {45, 43},
+        {45, 44},
+        {45, 45},
+        {45, 46},
+        {45, 47},
+        {45, 48},
+        {46, 46},
+        {46, 49},
+        {47, 46},
+        {47, 47},
+        {47, 49},
+        {47, 50},
+        {48, 46},
+        {48, 47},
+        {48, 48},
+        {48, 49},
+        {48, 50},
+        {48, 51},
+        {49, 49},
+        {50, 49},
+        {50, 50},
+        {51, 49},
+        {51, 50},
+        {51, 51},
+        {52, 52},
+        {52, 55},
+        {53, 52},
+        {53, 53},
+        {53, 55},
+        {53, 56},
+        {54, 52},
+        {54, 53},
+        {54, 54},
+        {54, 55},
+        {54, 56},
+        {54, 57},
+        {55, 55},
+        {55, 58},
+        {56, 55},
+        {56, 56},
+        {56, 58},
+        {56, 59},
+        {57, 55},
+        {57, 56},
+        {57, 57},
+        {57, 58},
+        {57, 59},
+        {57, 60},
+        {58, 58},
+        {59, 58},
+        {59, 59},
+        {60, 58},
+        {60, 59},
+        {60, 60},
+        {61, 61},
+        {61, 62},
+        {62, 62},
+        {62, 63},
+        {63, 63},
+        {63, 64},
+        {64, 64}
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(1, 2, 1));
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return 1;
+          case 3: return 1;
+          case 4: return sqrt((9 - 4*Power(T,2))/(1 - 4*Power(T,2)));
+          case 5: return (sqrt(2)*sqrt((3 + 5*T + 2*Power(T,2))/(-1 + T))*(-2*sqrt(((-1 + T)*T)/(1 + 2*T)) + 2/sqrt((T*(1 + 2*T))/(-1 + T)) + ((-1 + T)*(-3 + 2*T))/sqrt(T*(-1 - T + 2*Power(T,2)))))/(1 + T);
+          case 6: return sqrt(((-2 + T + Power(T,2))*(-3 + T + 8*Power(T,2) + 4*Power(T,3)))/T)/((1 + T)*(1 + 2*T));
+          case 7: return sqrt(6)/sqrt(T*(1 + 2*T)*(-1 + T + 2*Power(T,2)));
+          case 8: return -((sqrt(3)*(-4*sqrt((-1 + 2*T)/(1 + T)) + 7*Power(T,2)*sqrt((-1 + 2*T)/(1 + T)) + 6*sqrt(-1 + T + 2*Power(T,2)) + 3*T*(sqrt((-1 + 2*T)/(1 + T)) - 2*sqrt(-1 + T + 2*Power(T,2)))))/(Power(1 + T,1.5)*sqrt(T*(2 + 5*T + 2*Power(T,2)))));
+          case 9: return (T*(10 + 9*T + 2*Power(T,2)))/(Power(1 + T,1.5)*(3 + 2*T)*sqrt((T*(10 + 29*T + 20*Power(T,2) + 4*Power(T,3)))/(-3 + T + 8*Power(T,2) + 4*Power(T,3))));
+          case 10: return 3/(1 + 3*T + 2*Power(T,2));
+          case 11: return -((T*sqrt((15 + 6*T)/(2*T + 5*Power(T,2) + 2*Power(T,3))))/(1 + T));
+          case 12: return (T*(3 + T))/sqrt(T*(6 + 11*T + 6*Power(T,2) + Power(T,3)));
+          case 13: return sqrt(6)/sqrt((1 + T)*(6 + 19*T + 16*Power(T,2) + 4*Power(T,3)));
+          case 14: return -(sqrt(2)/sqrt((1 + T)*(2 + T)));
+          case 15: return 1;
+          case 16: return sqrt((9 - 4*Power(T,2))/(1 - 4*Power(T,2)));
+          case 17: return (sqrt(2)*sqrt((3 + 5*T + 2*Power(T,2))/(-1 + T))*(-2*sqrt(((-1 + T)*T)/(1 + 2*T)) + 2/sqrt((T*(1 + 2*T))/(-1 + T)) + ((-1 + T)*(-3 + 2*T))/sqrt(T*(-1 - T + 2*Power(T,2)))))/(1 + T);
+          case 18: return sqrt(((-2 + T + Power(T,2))*(-3 + T + 8*Power(T,2) + 4*Power(T,3)))/T)/((1 + T)*(1 + 2*T));
+          case 19: return sqrt(6)/sqrt(T*(1 + 2*T)*(-1 + T + 2*Power(T,2)));
+          case 20: return -((sqrt(3)*(-4*sqrt((-1 + 2*T)/(1 + T)) + 7*Power(T,2)*sqrt((-1 + 2*T)/(1 + T)) + 6*sqrt(-1 + T + 2*Power(T,2)) + 3*T*(sqrt((-1 + 2*T)/(1 + T)) - 2*sqrt(-1 + T + 2*Power(T,2)))))/(Power(1 + T,1.5)*sqrt(T*(2 + 5*T + 2*Power(T,2)))));
+          case 21: return (T*(10 + 9*T + 2*Power(T,2)))/(Power(1 + T,1.5)*(3 + 2*T)*sqrt((T*(10 + 29*T + 20*Power(T,2) + 4*Power(T,3)))/(-3 + T + 8*Power(T,2) + 4*Power(T,3))));
+          case 22: return 3/(1 + 3*T + 2*Power(T,2));
+          case 23: return -((T*sqrt((15 + 6*T)/(2*T + 5*Power(T,2) + 2*Power(T,3))))/(1 + T));
+          case 24: return (T*(3 + T))/sqrt(T*(6 + 11*T + 6*Power(T,2) + Power(T,3)));
+          case 25: return sqrt(6)/sqrt((1 + T)*(6 + 19*T + 16*Power(T,2) + 4*Power(T,3)));
+          case 26: return -(sqrt(2)/sqrt((1 + T)*(2 + T)));
+          case 27: return 1;
+          case 28: return -(sqrt(-3 + 4*T + 4*Power(T,2))/(1 + 2*T));
+          case 29: return -(sqrt(-3 + 4*T + 4*Power(T,2))/(1 + 2*S(ss1) + 2*T + 4*S(ss1)*T));
+          case 30: return sqrt((3 + 2*T)/(1 + 2*T))/(1 + T);
+          case 31: return -((2*sqrt(T/(2 + T)) + sqrt(Power(T,3)/(2 + T)))/(1 + T));
+          case 32: return sqrt((3 + 2*T)/(1 + 2*T))/(1 + 2*S(ss1) + T + 2*S(ss1)*T);
+          case 33: return -((2*sqrt(T/(2 + T)) + sqrt(Power(T,3)/(2 + T)))/(1 + 2*S(ss1) + T + 2*S(ss1)*T));
+          case 34: return -(1/(1 + 3*T + 2*Power(T,2)));
+          case 35: return 1/(1 + T);
+          case 36: return -1;
+          case 37: return -(1/((1 + 2*S(ss1))*(1 + 3*T + 2*Power(T,2))));
+          case 38: return 1/(1 + 2*S(ss1) + T + 2*S(ss1)*T);
+          case 39: return 1/(-1 - 2*S(ss1));
+          case 40: return (-2*sqrt(S(ss1)*(1 + S(ss1))*(-3 + 4*T + 4*Power(T,2))))/(1 + 2*S(ss1) + 2*T + 4*S(ss1)*T);
+          case 41: return (2*sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*T))/(1 + 2*T)))/(1 + 2*S(ss1) + T + 2*S(ss1)*T);
+          case 42: return (-2*sqrt(S(ss1)*(1 + S(ss1))*T*(2 + T)))/(1 + 2*S(ss1) + T + 2*S(ss1)*T);
+          case 43: return (-2*sqrt((S(ss1)*(1 + S(ss1)))/Power(1 + 2*T,2)))/((1 + 2*S(ss1))*(1 + T));
+          case 44: return (2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1) + T + 2*S(ss1)*T);
+          case 45: return -(((1 + 2*T)*(3*(1 + S(ss1))*(1 + T)*(3 + 2*T)*sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*T))/(Power(1 + 2*S(ss1),2)*(10 + 9*T + 2*Power(T,2)))) + (6*(1 + S(ss1))*(1 + T)*(3 + 2*T)*sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*T))/(Power(1 + 2*S(ss1),2)*(10 + 9*T + 2*Power(T,2)))))/(1 + 2*T) + 3*sqrt((S(ss1)*Power(1 + S(ss1),3)*Power(1 + T,2)*Power(3 + 2*T,3))/(10 + 9*T + 2*Power(T,2))) + sqrt((S(ss1)*Power(1 + S(ss1),3)*Power(1 + T,4)*Power(3 + 2*T,3))/(10 + 9*T + 2*Power(T,2))) + sqrt((S(ss1)*Power(1 + S(ss1),3)*Power(1 + T,4)*Power(3 + 2*T,3))/(Power(1 + 2*S(ss1),2)*(10 + 9*T + 2*Power(T,2)))) + 6*sqrt((S(ss1)*Power(1 + S(ss1),3)*Power(1 + T,2)*Power(3 + 2*T,3))/(Power(1 + 2*T,2)*(10 + 9*T + 2*Power(T,2))))))/(Power(1 + S(ss1),2)*(1 + T)*Power(3 + 2*T,1.5)*sqrt(10 + 9*T + 2*Power(T,2))));
+          case 46: return -(sqrt(-3 + 4*T + 4*Power(T,2))/(1 + 2*T));
+          case 47: return -(sqrt(-3 + 4*T + 4*Power(T,2))/(1 + 2*S(ss1) + 2*T + 4*S(ss1)*T));
+          case 48: return sqrt((3 + 2*T)/(1 + 2*T))/(1 + T);
+          case 49: return -((2*sqrt(T/(2 + T)) + sqrt(Power(T,3)/(2 + T)))/(1 + T));
+          case 50: return sqrt((3 + 2*T)/(1 + 2*T))/(1 + 2*S(ss1) + T + 2*S(ss1)*T);
+          case 51: return -((2*sqrt(T/(2 + T)) + sqrt(Power(T,3)/(2 + T)))/(1 + 2*S(ss1) + T + 2*S(ss1)*T));
+          case 52: return -(1/(1 + 3*T + 2*Power(T,2)));
+          case 53: return 1/(1 + T);
+          case 54: return -1;
+          case 55: return -(1/((1 + 2*S(ss1))*(1 + 3*T + 2*Power(T,2))));
+          case 56: return 1/(1 + 2*S(ss1) + T + 2*S(ss1)*T);
+          case 57: return 1/(-1 - 2*S(ss1));
+          case 58: return (-2*sqrt(S(ss1)*(1 + S(ss1))*(-3 + 4*T + 4*Power(T,2))))/(1 + 2*S(ss1) + 2*T + 4*S(ss1)*T);
+          case 59: return (2*sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*T))/(1 + 2*T)))/(1 + 2*S(ss1) + T + 2*S(ss1)*T);
+          case 60: return -((sqrt(((1 + 2*S(ss1))*(3 + 2*T))/(2 + T))*(2*sqrt((S(ss1)*(1 + S(ss1))*Power(T,3))/(Power(1 + 2*S(ss1),3)*(3 + 2*T))) + 2*sqrt((S(ss1)*(1 + S(ss1))*Power(T,3))/((1 + 2*S(ss1))*(3 + 2*T))) + sqrt((S(ss1)*(1 + S(ss1))*Power(T,5))/(Power(1 + 2*S(ss1),3)*(3 + 2*T))) + sqrt((S(ss1)*(1 + S(ss1))*Power(T,5))/((1 + 2*S(ss1))*(3 + 2*T)))))/((1 + S(ss1))*T*(1 + T)));
+          case 61: return (-2*sqrt((S(ss1)*(1 + S(ss1)))/Power(1 + 2*T,2)))/((1 + 2*S(ss1))*(1 + T));
+          case 62: return ((1 + 2*T)*((-2*Power(1 + S(ss1),2.5)*T*sqrt((S(ss1)*(1 + T))/(2 + T))*Power(3 + 2*T,1.5))/(1 + 2*S(ss1)) + sqrt((S(ss1)*Power(1 + S(ss1),3)*(1 + T)*Power(3 + 2*T,3))/(2 + T)) + sqrt((S(ss1)*Power(1 + S(ss1),3)*(1 + T)*Power(3 + 2*T,3))/(Power(1 + 2*S(ss1),2)*(2 + T))) - 3*sqrt((S(ss1)*Power(1 + S(ss1),3)*Power(T,2)*(1 + T)*Power(3 + 2*T,3))/((2 + T)*Power(1 + 2*T,2))) - 3*sqrt((S(ss1)*Power(1 + S(ss1),3)*Power(T,2)*(1 + T)*Power(3 + 2*T,3))/(Power(1 + 2*S(ss1),2)*(2 + T)*Power(1 + 2*T,2))) + sqrt((S(ss1)*Power(1 + S(ss1),3)*Power(3 + 5*T + 2*Power(T,2),3))/(2 + T)) + sqrt((S(ss1)*Power(1 + S(ss1),3)*Power(3 + 5*T + 2*Power(T,2),3))/(Power(1 + 2*S(ss1),2)*(2 + T)))))/(Power(1 + S(ss1),2)*sqrt(2 + T)*Power(3 + 5*T + 2*Power(T,2),1.5));
+          case 63: return -(((1 + 2*T)*(3*(1 + S(ss1))*(1 + T)*(3 + 2*T)*sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*T))/(Power(1 + 2*S(ss1),2)*(10 + 9*T + 2*Power(T,2)))) + (6*(1 + S(ss1))*(1 + T)*(3 + 2*T)*sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*T))/(Power(1 + 2*S(ss1),2)*(10 + 9*T + 2*Power(T,2)))))/(1 + 2*T) + 3*sqrt((S(ss1)*Power(1 + S(ss1),3)*Power(1 + T,2)*Power(3 + 2*T,3))/(10 + 9*T + 2*Power(T,2))) + sqrt((S(ss1)*Power(1 + S(ss1),3)*Power(1 + T,4)*Power(3 + 2*T,3))/(10 + 9*T + 2*Power(T,2))) + sqrt((S(ss1)*Power(1 + S(ss1),3)*Power(1 + T,4)*Power(3 + 2*T,3))/(Power(1 + 2*S(ss1),2)*(10 + 9*T + 2*Power(T,2)))) + 6*sqrt((S(ss1)*Power(1 + S(ss1),3)*Power(1 + T,2)*Power(3 + 2*T,3))/(Power(1 + 2*T,2)*(10 + 9*T + 2*Power(T,2))))))/(Power(1 + S(ss1),2)*(1 + T)*Power(3 + 2*T,1.5)*sqrt(10 + 9*T + 2*Power(T,2))));
+          case 64: return -(sqrt(-3 + 4*T + 4*Power(T,2))/(1 + 2*T));
+          case 65: return -(sqrt(-3 + 4*T + 4*Power(T,2))/(1 + 2*S(ss1) + 2*T + 4*S(ss1)*T));
+          case 66: return sqrt((3 + 2*T)/(1 + 2*T))/(1 + T);
+          case 67: return -((2*sqrt(T/(2 + T)) + sqrt(Power(T,3)/(2 + T)))/(1 + T));
+          case 68: return sqrt((3 + 2*T)/(1 + 2*T))/(1 + 2*S(ss1) + T + 2*S(ss1)*T);
+          case 69: return -((2*sqrt(T/(2 + T)) + sqrt(Power(T,3)/(2 + T)))/(1 + 2*S(ss1) + T + 2*S(ss1)*T));
+          case 70: return -(1/(1 + 3*T + 2*Power(T,2)));
+          case 71: return 1/(1 + T);
+          case 72: return -1;
+          case 73: return -(1/((1 + 2*S(ss1))*(1 + 3*T + 2*Power(T,2))));
+          case 74: return 1/(1 + 2*S(ss1) + T + 2*S(ss1)*T);
+          case 75: return 1/(-1 - 2*S(ss1));
+          case 76: return (-2*sqrt(S(ss1)*(1 + S(ss1))*(-3 + 4*T + 4*Power(T,2))))/(1 + 2*S(ss1) + 2*T + 4*S(ss1)*T);
+          case 77: return (2*sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*T))/(1 + 2*T)))/(1 + 2*S(ss1) + T + 2*S(ss1)*T);
+          case 78: return (-2*sqrt(S(ss1)*(1 + S(ss1))*T*(2 + T)))/(1 + 2*S(ss1) + T + 2*S(ss1)*T);
+          case 79: return (-2*sqrt((S(ss1)*(1 + S(ss1)))/Power(1 + 2*T,2)))/((1 + 2*S(ss1))*(1 + T));
+          case 80: return (2*sqrt(S(ss1)*(1 + S(ss1))))/(1 + 2*S(ss1) + T + 2*S(ss1)*T);
+          case 81: return -(((1 + 2*T)*(3*(1 + S(ss1))*(1 + T)*(3 + 2*T)*sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*T))/(Power(1 + 2*S(ss1),2)*(10 + 9*T + 2*Power(T,2)))) + (6*(1 + S(ss1))*(1 + T)*(3 + 2*T)*sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*T))/(Power(1 + 2*S(ss1),2)*(10 + 9*T + 2*Power(T,2)))))/(1 + 2*T) + 3*sqrt((S(ss1)*Power(1 + S(ss1),3)*Power(1 + T,2)*Power(3 + 2*T,3))/(10 + 9*T + 2*Power(T,2))) + sqrt((S(ss1)*Power(1 + S(ss1),3)*Power(1 + T,4)*Power(3 + 2*T,3))/(10 + 9*T + 2*Power(T,2))) + sqrt((S(ss1)*Power(1 + S(ss1),3)*Power(1 + T,4)*Power(3 + 2*T,3))/(Power(1 + 2*S(ss1),2)*(10 + 9*T + 2*Power(T,2)))) + 6*sqrt((S(ss1)*Power(1 + S(ss1),3)*Power(1 + T,2)*Power(3 + 2*T,3))/(Power(1 + 2*T,2)*(10 + 9*T + 2*Power(T,2))))))/(Power(1 + S(ss1),2)*(1 + T)*Power(3 + 2*T,1.5)*sqrt(10 + 9*T + 2*Power(T,2))));
+          case 82: return -sqrt((9 - 4*Power(T,2))/(1 - 4*Power(T,2)));
+          case 83: return -(sqrt((9 - 4*Power(T,2))/(1 - 4*Power(T,2)))/(1 + 2*S(ss1)));
+          case 84: return (sqrt(2)*sqrt((3 + 5*T + 2*Power(T,2))/(-1 + T))*(2*sqrt(((-1 + T)*T)/(1 + 2*T)) - 2/sqrt((T*(1 + 2*T))/(-1 + T)) - ((-1 + T)*(-3 + 2*T))/sqrt(T*(-1 - T + 2*Power(T,2)))))/(1 + T);
+          case 85: return -(sqrt(((-2 + T + Power(T,2))*(-3 + T + 8*Power(T,2) + 4*Power(T,3)))/T)/((1 + T)*(1 + 2*T)));
+          case 86: return sqrt((6 + 10*T + 4*Power(T,2))/(T + 2*Power(T,2)))/((1 + 2*S(ss1))*(1 + T));
+          case 87: return -(sqrt(-5 + 6/T - 18*T + Power(T,2) + 12*Power(T,3) + 4*Power(T,4))/((1 + 2*S(ss1))*(1 + 3*T + 2*Power(T,2))));
+          case 88: return -(sqrt(6)/sqrt(T*(1 + 2*T)*(-1 + T + 2*Power(T,2))));
+          case 89: return (sqrt(3)*(-4*sqrt((-1 + 2*T)/(1 + T)) + 7*Power(T,2)*sqrt((-1 + 2*T)/(1 + T)) + 6*sqrt(-1 + T + 2*Power(T,2)) + 3*T*(sqrt((-1 + 2*T)/(1 + T)) - 2*sqrt(-1 + T + 2*Power(T,2)))))/(Power(1 + T,1.5)*sqrt(T*(2 + 5*T + 2*Power(T,2))));
+          case 90: return -((T*(10 + 9*T + 2*Power(T,2)))/(Power(1 + T,1.5)*(3 + 2*T)*sqrt((T*(10 + 29*T + 20*Power(T,2) + 4*Power(T,3)))/(-3 + T + 8*Power(T,2) + 4*Power(T,3)))));
+          case 91: return -(sqrt(6)/((1 + 2*S(ss1))*sqrt(T*(1 + 2*T)*(-1 + T + 2*Power(T,2)))));
+          case 92: return (sqrt(3)*(-4*sqrt((-1 + 2*T)/(1 + T)) + 7*Power(T,2)*sqrt((-1 + 2*T)/(1 + T)) + 6*sqrt(-1 + T + 2*Power(T,2)) + 3*T*(sqrt((-1 + 2*T)/(1 + T)) - 2*sqrt(-1 + T + 2*Power(T,2)))))/((1 + 2*S(ss1))*Power(1 + T,1.5)*sqrt(T*(2 + 5*T + 2*Power(T,2))));
+          case 93: return -((T*(10 + 9*T + 2*Power(T,2)))/(Power(1 + T,1.5)*(3 + 2*T)*sqrt((Power(1 + 2*S(ss1),2)*T*(10 + 29*T + 20*Power(T,2) + 4*Power(T,3)))/(-3 + T + 8*Power(T,2) + 4*Power(T,3)))));
+          case 94: return -3/(1 + 3*T + 2*Power(T,2));
+          case 95: return (T*sqrt((15 + 6*T)/(2*T + 5*Power(T,2) + 2*Power(T,3))))/(1 + T);
+          case 96: return -((T*(3 + T))/sqrt(T*(6 + 11*T + 6*Power(T,2) + Power(T,3))));
+          case 97: return (-3*sqrt(3 + 5*T + 2*Power(T,2))*(2*sqrt(((1 + 2*S(ss1))*(3 + 2*T))/(1 + T)) - 2*Power(T,3)*sqrt(((1 + 2*S(ss1))*(3 + 2*T))/(1 + T)) + T*sqrt((1 + 2*S(ss1))*(3 + 5*T + 2*Power(T,2))) + Power(T,2)*(-3*sqrt(((1 + 2*S(ss1))*(3 + 2*T))/(1 + T)) + 2*sqrt((1 + 2*S(ss1))*(3 + 5*T + 2*Power(T,2))))))/(Power(1 + 2*S(ss1),1.5)*(1 + T)*(2 + T)*(3 + 8*T + 4*Power(T,2)));
+          case 98: return -((T*sqrt((9 + 15*T + 6*Power(T,2))/(T + 2*Power(T,2)))*(2*Power(1 + T,1.5)*sqrt(((1 + 2*S(ss1))*(15 + 16*T + 4*Power(T,2)))/(2 + T)) + T*Power(1 + T,1.5)*sqrt(((1 + 2*S(ss1))*(15 + 16*T + 4*Power(T,2)))/(2 + T)) - 8*Power(T,2)*Power(1 + T,1.5)*sqrt(((1 + 2*S(ss1))*(15 + 16*T + 4*Power(T,2)))/(2 + T)) - 4*Power(T,3)*Power(1 + T,1.5)*sqrt(((1 + 2*S(ss1))*(15 + 16*T + 4*Power(T,2)))/(2 + T)) - 11*sqrt((1 + 2*S(ss1))*(30 + 77*T + 71*Power(T,2) + 28*Power(T,3) + 4*Power(T,4))) - 10*T*sqrt((1 + 2*S(ss1))*(30 + 77*T + 71*Power(T,2) + 28*Power(T,3) + 4*Power(T,4))) + 2*Power(T,2)*sqrt((1 + 2*S(ss1))*(30 + 77*T + 71*Power(T,2) + 28*Power(T,3) + 4*Power(T,4))) + 4*Power(T,3)*sqrt((1 + 2*S(ss1))*(30 + 77*T + 71*Power(T,2) + 28*Power(T,3) + 4*Power(T,4)))))/(Power(1 + 2*S(ss1),1.5)*Power(2 + 3*T + Power(T,2),2)*(15 + 16*T + 4*Power(T,2))));
+          case 99: return -((sqrt(3 + 5*T + 2*Power(T,2))*(54*Power(T,1.5)*(2 + 3*T + Power(T,2))*sqrt(((1 + 2*S(ss1))*(9 + 9*T + 2*Power(T,2)))/(2 + T)) - 9*T*(1 + 2*T)*(2 + 3*T + Power(T,2))*sqrt(((1 + 2*S(ss1))*(9 + 9*T + 2*Power(T,2)))/(T*(2 + T))) + 9*Power(T,2)*(1 + 2*T)*(2 + 3*T + Power(T,2))*sqrt(((1 + 2*S(ss1))*(9 + 9*T + 2*Power(T,2)))/(T*(2 + T))) + 60*(2 + 3*T + Power(T,2))*sqrt(((1 + 2*S(ss1))*T*(9 + 9*T + 2*Power(T,2)))/(2 + T)) + Power(T,1.5)*Power(1 + T,2)*(1 + 2*T)*sqrt((1 + 2*S(ss1))*(2 + T)*(9 + 9*T + 2*Power(T,2))) - 3*Power(1 + T,2)*(1 + 2*T)*sqrt((1 + 2*S(ss1))*T*(2 + T)*(9 + 9*T + 2*Power(T,2))) - 18*T*(1 + T)*sqrt(((1 + 2*S(ss1))*(18 + 27*T + 13*Power(T,2) + 2*Power(T,3)))/T)))/(Power(1 + 2*S(ss1),1.5)*Power(2 + 3*T + Power(T,2),2)*(45 + 63*T + 28*Power(T,2) + 4*Power(T,3))));
+          case 100: return -(sqrt(6)/sqrt((1 + T)*(6 + 19*T + 16*Power(T,2) + 4*Power(T,3))));
+          case 101: return sqrt(2)/sqrt((1 + T)*(2 + T));
+          case 102: return -1;
+          case 103: return -(sqrt(6)/((1 + 2*S(ss1))*sqrt((1 + T)*(6 + 19*T + 16*Power(T,2) + 4*Power(T,3)))));
+          case 104: return -((sqrt((2 + 4*S(ss1))*T*(3 + 8*T + 4*Power(T,2)))*((-3*Power(1 + T,1.5)*(3 + T)*(10 + 9*T + 2*Power(T,2)))/sqrt((T*(6 + 5*T + Power(T,2)))/(3 + 8*T + 4*Power(T,2))) + (T*Power(1 + T,1.5)*(3 + T)*(10 + 9*T + 2*Power(T,2)))/sqrt((T*(6 + 5*T + Power(T,2)))/(3 + 8*T + 4*Power(T,2))) - (5 + 2*T)*Power(2 + 3*T + Power(T,2),1.5)*sqrt(27 + 9/T + 20*T + 4*Power(T,2)) - (6*(30 + 37*T + 15*Power(T,2) + 2*Power(T,3)))/sqrt((T*(18 + 27*T + 13*Power(T,2) + 2*Power(T,3)))/(1 + 3*T + 2*Power(T,2))) + (18*T*(30 + 37*T + 15*Power(T,2) + 2*Power(T,3)))/sqrt((T*(18 + 27*T + 13*Power(T,2) + 2*Power(T,3)))/(1 + 3*T + 2*Power(T,2))) - 9*(3 + T)*(10 + 19*T + 11*Power(T,2) + 2*Power(T,3))*sqrt((1 + 3*T + 2*Power(T,2))/(18*T + 27*Power(T,2) + 13*Power(T,3) + 2*Power(T,4))) + 9*T*(3 + T)*(10 + 19*T + 11*Power(T,2) + 2*Power(T,3))*sqrt((1 + 3*T + 2*Power(T,2))/(18*T + 27*Power(T,2) + 13*Power(T,3) + 2*Power(T,4))) + 30*(30 + 37*T + 15*Power(T,2) + 2*Power(T,3))*sqrt((T*(1 + T))/(18 + 63*T + 67*Power(T,2) + 28*Power(T,3) + 4*Power(T,4)))))/((1 + T)*Power((1 + 2*S(ss1))*(3 + T),1.5)*Power(10 + 9*T + 2*Power(T,2),2)));
+          case 105: return 1/(-1 - 2*S(ss1));
+          case 106: return (-2*sqrt((S(ss1)*(1 + S(ss1))*(-9 + 4*Power(T,2)))/(-1 + 4*Power(T,2))))/(1 + 2*S(ss1));
+          case 107: return (-2*sqrt(2)*sqrt((1 + 2*S(ss1))*(3 + 5*T + 2*Power(T,2)))*(2*sqrt((Power(S(ss1),3)*(1 + T))/(T*(1 + 2*T))) + sqrt((Power(S(ss1),5)*(1 + T))/(T*(1 + 2*T))) - sqrt((S(ss1)*T*(1 + T))/(1 + 2*T)) - 2*sqrt((Power(S(ss1),3)*T*(1 + T))/(1 + 2*T)) - sqrt((Power(S(ss1),5)*T*(1 + T))/(1 + 2*T)) + sqrt((S(ss1) + S(ss1)*T)/(T + 2*Power(T,2)))))/((-1 + T)*Power((1 + S(ss1))*(1 + 2*S(ss1))*(1 + T),1.5));
+          case 108: return (-2*(1 + S(ss1))*sqrt(3 + 5*T + 2*Power(T,2))*(4*sqrt((S(ss1)*(-1 + 2*T))/((1 + S(ss1))*T*(-2 + T + Power(T,2)))) - 5*T*sqrt((S(ss1)*(-1 + 2*T))/((1 + S(ss1))*T*(-2 + T + Power(T,2)))) + Power(T,2)*sqrt((S(ss1)*(-1 + 2*T))/((1 + S(ss1))*T*(-2 + T + Power(T,2)))) + 6*sqrt((S(ss1)*(1 - 3*T + 2*Power(T,2)))/((1 + S(ss1))*T*(2 + T)))))/((1 + 2*S(ss1))*(1 + 3*T + 2*Power(T,2)));
+          case 109: return (-2*sqrt(6)*sqrt((S(ss1)*(1 + S(ss1)))/(T*(1 + T)*(-1 + 4*Power(T,2)))))/(1 + 2*S(ss1));
+          case 110: return sqrt(9 + 15*T + 6*Power(T,2))*(-((-4 + T)*(-1 + 2*T)*sqrt((S(ss1)*(-1 + 2*T))/((1 + S(ss1))*T*Power(1 + T,3)*(6 + 19*T + 16*Power(T,2) + 4*Power(T,3))))) - 6*sqrt((S(ss1)*Power(-1 + T,2)*(-1 + 2*T))/((1 + S(ss1))*T*Power(1 + T,3)*(6 + 19*T + 16*Power(T,2) + 4*Power(T,3)))) - 6*sqrt((S(ss1)*Power(-1 + T,2)*(-1 + 2*T))/((1 + S(ss1))*Power(1 + 2*S(ss1),2)*T*Power(1 + T,3)*(6 + 19*T + 16*Power(T,2) + 4*Power(T,3)))) + 2*(-1 + T)*T*(-1 + 2*T)*sqrt(S(ss1)/((1 + S(ss1))*T*Power(1 + T,3)*(-6 - 7*T + 22*Power(T,2) + 28*Power(T,3) + 8*Power(T,4)))) + 2*(-1 + T)*T*(-1 + 2*T)*sqrt(S(ss1)/((1 + S(ss1))*Power(1 + 2*S(ss1),2)*T*Power(1 + T,3)*(-6 - 7*T + 22*Power(T,2) + 28*Power(T,3) + 8*Power(T,4)))) - (Power(1 - 2*T,2)*(-4 + T))/((1 + 2*S(ss1))*(1 + T)*sqrt(((1 + S(ss1))*T*(-6 - 13*T + 15*Power(T,2) + 50*Power(T,3) + 36*Power(T,4) + 8*Power(T,5)))/S(ss1))));
+          case 111: return (sqrt(3 + 5*T + 2*Power(T,2))*((-72*sqrt((S(ss1)*T*(-1 + 2*T))/((1 + S(ss1))*Power(1 + T,3)*(10 + 29*T + 20*Power(T,2) + 4*Power(T,3)))))/(3 + 2*T) - 72/((1 + 2*S(ss1))*(1 + T)*sqrt(((1 + S(ss1))*(1 + T)*Power(3 + 2*T,2)*(10 + 29*T + 20*Power(T,2) + 4*Power(T,3)))/(S(ss1)*T*(-1 + 2*T)))) + (18*(1 - 2*T)*(-3 + 2*T))/sqrt(((1 + S(ss1))*Power(1 + T,3)*(-1 + 2*T)*Power(3 + 2*T,2)*(10 + 29*T + 20*Power(T,2) + 4*Power(T,3)))/(S(ss1)*T)) - (18*(-3 + 2*T)*(-1 + 2*T))/sqrt(((1 + S(ss1))*Power(1 + 2*S(ss1),2)*Power(1 + T,3)*(-1 + 2*T)*Power(3 + 2*T,2)*(10 + 29*T + 20*Power(T,2) + 4*Power(T,3)))/(S(ss1)*T)) - (2*T*(-1 + 2*T)*(1 - 9*T + 2*Power(T,2)))/sqrt(((1 + S(ss1))*T*Power(1 + T,3)*(-1 + 2*T)*Power(3 + 2*T,2)*(10 + 29*T + 20*Power(T,2) + 4*Power(T,3)))/S(ss1)) - 2*T*(-1 + 2*T)*(1 - 9*T + 2*Power(T,2))*sqrt(S(ss1)/((1 + S(ss1))*Power(1 + 2*S(ss1),2)*T*Power(1 + T,3)*Power(3 + 2*T,2)*(-10 - 9*T + 38*Power(T,2) + 36*Power(T,3) + 8*Power(T,4))))))/2.;
+          case 112: return 3*sqrt(3 + 5*T + 2*Power(T,2))*(2*(-1 + T)*T*sqrt(S(ss1)/((1 + S(ss1))*Power(1 + T,3)*Power(2 + T,2)*(3 + 2*T))) + 2*(-1 + T)*T*sqrt(S(ss1)/((1 + S(ss1))*Power(1 + 2*S(ss1),2)*Power(1 + T,3)*Power(2 + T,2)*(3 + 2*T))) - (-4 + T)*T*sqrt((S(ss1)*Power(1 - 2*T,2))/((1 + S(ss1))*Power(1 + T,3)*(3 + 2*T)*Power(2 + 5*T + 2*Power(T,2),2))) - (-4 + T)*T*sqrt((S(ss1)*Power(1 - 2*T,2))/((1 + S(ss1))*Power(1 + 2*S(ss1),2)*Power(1 + T,3)*(3 + 2*T)*Power(2 + 5*T + 2*Power(T,2),2))) - 2*sqrt((S(ss1)*Power(1 - 3*T + 2*Power(T,2),2))/((1 + S(ss1))*Power(1 + T,3)*(3 + 2*T)*Power(2 + 5*T + 2*Power(T,2),2))) - (T*sqrt(S(ss1)/((1 + S(ss1))*(3 + 5*T + 2*Power(T,2)))))/(2 + 4*S(ss1) + T + 2*S(ss1)*T) - (2*(1 - 3*T + 2*Power(T,2))*sqrt(S(ss1)/((1 + S(ss1))*Power(2 + T,2)*(3 + 5*T + 2*Power(T,2)))))/((1 + 2*S(ss1))*(1 + 3*T + 2*Power(T,2))) - T/((2 + T)*sqrt(((1 + S(ss1))*(3 + 5*T + 2*Power(T,2)))/S(ss1))));
+          case 113: return sqrt(9 + 15*T + 6*Power(T,2))*(-(T*(1 - 9*T + 2*Power(T,2))*sqrt((S(ss1)*(1 + 2*T))/((1 + S(ss1))*T*Power(2 + 3*T + Power(T,2),3)*(15 + 16*T + 4*Power(T,2))))) + T*(-1 + 2*T)*sqrt((S(ss1)*(1 + 2*T))/((1 + S(ss1))*T*Power(2 + T,3)*(15 + 31*T + 20*Power(T,2) + 4*Power(T,3)))) + T*(-1 + 2*T)*sqrt((S(ss1)*(1 + 2*T))/((1 + S(ss1))*Power(1 + 2*S(ss1),2)*T*Power(2 + T,3)*(15 + 31*T + 20*Power(T,2) + 4*Power(T,3)))) - 9*T*(-3 + 2*T)*sqrt((S(ss1)*T)/((1 + S(ss1))*Power(2 + 3*T + Power(T,2),3)*(15 + 46*T + 36*Power(T,2) + 8*Power(T,3)))) - 12*sqrt((S(ss1)*Power(1 - 2*T,2)*T)/((1 + S(ss1))*Power(2 + 3*T + Power(T,2),3)*(15 + 46*T + 36*Power(T,2) + 8*Power(T,3)))) - 12*sqrt((S(ss1)*Power(1 - 2*T,2)*T)/((1 + S(ss1))*Power(1 + 2*S(ss1),2)*Power(2 + 3*T + Power(T,2),3)*(15 + 46*T + 36*Power(T,2) + 8*Power(T,3)))) - (T*(1 + 2*T)*(1 - 9*T + 2*Power(T,2))*sqrt(S(ss1)/((1 + S(ss1))*Power(1 + 2*S(ss1),2)*T*(30 + 137*T + 225*Power(T,2) + 170*Power(T,3) + 60*Power(T,4) + 8*Power(T,5)))))/(2 + 3*T + Power(T,2)) - (9*Power(T,2)*(-3 + 2*T))/((1 + 2*S(ss1))*(2 + 3*T + Power(T,2))*sqrt(((1 + S(ss1))*T*(30 + 137*T + 225*Power(T,2) + 170*Power(T,3) + 60*Power(T,4) + 8*Power(T,5)))/S(ss1))));
+          case 114: return (sqrt(3 + 5*T + 2*Power(T,2))*((-2*(-3 + T)*T)/sqrt(((1 + S(ss1))*T*Power(2 + T,3)*(3 + T)*(3 + 2*T)*Power(5 + 2*T,2))/(S(ss1)*Power(1 + 2*T,2))) - (2*(-3 + T)*T)/sqrt(((1 + S(ss1))*Power(1 + 2*S(ss1),2)*T*Power(2 + T,3)*(3 + T)*(3 + 2*T)*Power(5 + 2*T,2))/(S(ss1)*Power(1 + 2*T,2))) - (36*T*(-1 + 3*T))/sqrt(((1 + S(ss1))*T*Power(1 + T,2)*Power(2 + T,3)*(3 + T)*(3 + 2*T)*Power(5 + 2*T,2))/S(ss1)) - 120/sqrt(((1 + S(ss1))*Power(2 + T,3)*(3 + T)*(3 + 2*T)*Power(5 + 7*T + 2*Power(T,2),2))/(S(ss1)*T)) - (36*T*(-1 + 3*T)*sqrt(S(ss1)/((1 + S(ss1))*Power(1 + 2*S(ss1),2)*T*(2 + T)*Power(5 + 2*T,2)*(9 + 9*T + 2*Power(T,2)))))/(2 + 3*T + Power(T,2)) - 120*sqrt((S(ss1)*T)/((1 + S(ss1))*Power(1 + 2*S(ss1),2)*Power(2 + T,3)*Power(5 + 7*T + 2*Power(T,2),2)*(9 + 9*T + 2*Power(T,2)))) - (18*(-1 + T)*T*(1 + 2*T))/((2 + 3*T + Power(T,2))*sqrt(((1 + S(ss1))*T*(2 + T)*Power(5 + 2*T,2)*(9 + 9*T + 2*Power(T,2)))/S(ss1))) - (18*(-1 + T)*T*(1 + 2*T)*sqrt(S(ss1)/((1 + S(ss1))*Power(1 + 2*S(ss1),2)*T*(18 + 27*T + 13*Power(T,2) + 2*Power(T,3)))))/((5 + 2*T)*(2 + 3*T + Power(T,2)))))/2.;
+          case 115: return sqrt(6)*sqrt(3 + 5*T + 2*Power(T,2))*((-1 + 2*T)*sqrt((S(ss1)*(1 + 2*T))/((1 + S(ss1))*Power(2 + T,3)*Power(5 + 2*T,2))) + (-1 + 2*T)*sqrt((S(ss1)*(1 + 2*T))/((1 + S(ss1))*Power(1 + 2*S(ss1),2)*Power(2 + T,3)*Power(5 + 2*T,2))) - sqrt((S(ss1) + 2*S(ss1)*T)/(2 + 2*S(ss1) + T + S(ss1)*T))/(5 + 2*T) - sqrt((S(ss1)*(1 + 2*T))/((1 + S(ss1))*(2 + T)))/(5 + 10*S(ss1) + 2*T + 4*S(ss1)*T) + (-1 + 9*T - 2*Power(T,2))*sqrt((S(ss1)*(1 + 2*T))/((1 + S(ss1))*Power(2 + T,3)*Power(15 + 16*T + 4*Power(T,2),2))) + (-1 + 9*T - 2*Power(T,2))*sqrt((S(ss1)*(1 + 2*T))/((1 + S(ss1))*Power(1 + 2*S(ss1),2)*Power(2 + T,3)*Power(15 + 16*T + 4*Power(T,2),2))) - 6*sqrt((S(ss1)*Power(1 - 2*T,2)*Power(T,2))/((1 + S(ss1))*Power(2 + T,3)*(1 + 2*T)*Power(15 + 31*T + 20*Power(T,2) + 4*Power(T,3),2))) - 3*(-3 + 2*T)*sqrt((S(ss1)*Power(T,2)*(1 + 2*T))/((1 + S(ss1))*Power(2 + T,3)*Power(15 + 31*T + 20*Power(T,2) + 4*Power(T,3),2))) - 3*(-3 + 2*T)*sqrt((S(ss1)*Power(T,2)*(1 + 2*T))/((1 + S(ss1))*Power(1 + 2*S(ss1),2)*Power(2 + T,3)*Power(15 + 31*T + 20*Power(T,2) + 4*Power(T,3),2))) - (6*T*(-1 + 2*T)*sqrt(S(ss1)/((1 + S(ss1))*(2 + 5*T + 2*Power(T,2))*Power(15 + 31*T + 20*Power(T,2) + 4*Power(T,3),2))))/((1 + 2*S(ss1))*(2 + T)));
+          case 116: return sqrt(6 + 10*T + 4*Power(T,2))*(-(((-3 + T)*(1 + 2*T)*sqrt((S(ss1)*(3 + 2*T))/((1 + S(ss1))*Power(1 + 2*S(ss1),2)*(2 + T)*Power(3 + T,2))))/(10 + 9*T + 2*Power(T,2))) - (9*(-1 + T)*(1 + 2*T)*sqrt(S(ss1)/((1 + S(ss1))*Power(1 + 2*S(ss1),2)*Power(3 + T,2)*(6 + 7*T + 2*Power(T,2)))))/(10 + 9*T + 2*Power(T,2)) - 9*(-1 + T)*sqrt((S(ss1)*Power(1 + 2*T,2))/((1 + S(ss1))*Power(2 + T,3)*(3 + 2*T)*Power(15 + 11*T + 2*Power(T,2),2))) - (-3 + T)*sqrt((S(ss1)*Power(1 + 2*T,2)*(3 + 2*T))/((1 + S(ss1))*Power(2 + T,3)*Power(15 + 11*T + 2*Power(T,2),2))) + sqrt((S(ss1)*Power(1 + 2*T,2)*(3 + 2*T))/((1 + S(ss1))*(2 + T)*Power(15 + 11*T + 2*Power(T,2),2))) + sqrt((S(ss1)*Power(1 + 2*T,2)*(3 + 2*T))/((1 + S(ss1))*Power(1 + 2*S(ss1),2)*(2 + T)*Power(15 + 11*T + 2*Power(T,2),2))) - 30*sqrt((S(ss1)*Power(T,2))/((1 + S(ss1))*Power(1 + 2*S(ss1),2)*Power(2 + T,3)*(3 + 2*T)*Power(15 + 26*T + 13*Power(T,2) + 2*Power(T,3),2))) - 6*(-1 + 3*T)*sqrt((S(ss1)*Power(1 + 2*T,2))/((1 + S(ss1))*Power(2 + T,3)*(3 + 2*T)*Power(15 + 26*T + 13*Power(T,2) + 2*Power(T,3),2))) - 6*(-1 + 3*T)*sqrt((S(ss1)*Power(1 + 2*T,2))/((1 + S(ss1))*Power(1 + 2*S(ss1),2)*Power(2 + T,3)*(3 + 2*T)*Power(15 + 26*T + 13*Power(T,2) + 2*Power(T,3),2))) - (30*T*sqrt(S(ss1)/((1 + S(ss1))*Power(2 + T,3)*(3 + 2*T))))/(15 + 26*T + 13*Power(T,2) + 2*Power(T,3)));
+          case 117: return (-2*sqrt(1 + 2*T)*(90*sqrt((S(ss1)*(1 + S(ss1))*(5 + 2*T))/(1 + 2*T)) + 120*sqrt(S(ss1)*(1 + S(ss1))*(5 + 12*T + 4*Power(T,2))) + 79*T*sqrt(S(ss1)*(1 + S(ss1))*(5 + 12*T + 4*Power(T,2))) + 21*Power(T,2)*sqrt(S(ss1)*(1 + S(ss1))*(5 + 12*T + 4*Power(T,2))) + 2*Power(T,3)*sqrt(S(ss1)*(1 + S(ss1))*(5 + 12*T + 4*Power(T,2)))))/((1 + 2*S(ss1))*(2 + T)*Power(5 + 2*T,1.5)*(21 + 13*T + 2*Power(T,2)));
+          case 118: return sqrt(-3 + 4*T + 4*Power(T,2))/(1 + 2*T);
+          case 119: return 1/sqrt((S(ss1)*(1 + 2*S(ss1))*Power(1 + 2*T,2))/(-3 + 4*T + 4*Power(T,2)));
+          case 120: return -(sqrt((3 + 2*T)/(1 + 2*T))/(1 + T));
+          case 121: return (2*sqrt(T/(2 + T)) + sqrt(Power(T,3)/(2 + T)))/(1 + T);
+          case 122: return -(1/((1 + T)*sqrt((S(ss1)*(1 + 2*S(ss1))*(1 + 2*T))/(3 + 2*T))));
+          case 123: return (2*sqrt(T/((S(ss1) + 2*Power(S(ss1),2))*(2 + T))) + sqrt(Power(T,3)/((S(ss1) + 2*Power(S(ss1),2))*(2 + T))))/(1 + T);
+          case 124: return 1/(1 + 3*T + 2*Power(T,2));
+          case 125: return -(1/(1 + T));
+          case 126: return 1;
+          case 127: return 1/(sqrt(S(ss1)*(1 + 2*S(ss1)))*(1 + 3*T + 2*Power(T,2)));
+          case 128: return -(1/(sqrt(S(ss1)*(1 + 2*S(ss1)))*(1 + T)));
+          case 129: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 130: return (sqrt(((-1 + 2*S(ss1))*T*(-1 + 2*T))/(S(ss1)*(1 + 2*S(ss1))*(1 + 3*T + 2*Power(T,2)))) - sqrt((S(ss1)*T*(-1 + 2*T))/((-1 + 4*Power(S(ss1),2))*(1 + 3*T + 2*Power(T,2)))) + 2*S(ss1)*sqrt((S(ss1)*T*(-1 + 2*T))/((-1 + 4*Power(S(ss1),2))*(1 + 3*T + 2*Power(T,2)))))/sqrt(((1 + S(ss1))*T*(1 + 2*T))/(3 + 5*T + 2*Power(T,2)));
+          case 131: return 1/sqrt(((1 + S(ss1))*(1 + 2*S(ss1))*Power(1 + 2*T,2))/(-3 + 4*T + 4*Power(T,2)));
+          case 132: return (sqrt(3 + 5*T + 2*Power(T,2))*(-sqrt(((-1 + S(ss1) + 2*Power(S(ss1),2))*(1 + T))/((S(ss1) + 2*Power(S(ss1),2))*(1 + 2*T))) + S(ss1)*sqrt(((1 + S(ss1))*(1 + T))/((-S(ss1) + 4*Power(S(ss1),3))*(1 + 2*T))) - 2*Power(S(ss1),2)*sqrt(((1 + S(ss1))*(1 + T))/((-S(ss1) + 4*Power(S(ss1),3))*(1 + 2*T))) + 2*T*(sqrt((S(ss1)*(1 + S(ss1))*(1 + T))/((-1 + 4*Power(S(ss1),2))*(1 + 2*T))) - 2*sqrt((Power(S(ss1),3)*(1 + S(ss1))*(1 + T))/((-1 + 4*Power(S(ss1),2))*(1 + 2*T))) - S(ss1)*sqrt(((1 + S(ss1))*(1 + T))/((-S(ss1) + 4*Power(S(ss1),3))*(1 + 2*T))) + 2*Power(S(ss1),2)*sqrt(((1 + S(ss1))*(1 + T))/((-S(ss1) + 4*Power(S(ss1),3))*(1 + 2*T))))))/((1 + S(ss1))*Power(1 + T,2));
+          case 133: return 3/((1 + T)*sqrt((S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*(2 + T))/((-1 + 2*S(ss1))*T))) + (3*S(ss1)*(-1 + 2*S(ss1)))/sqrt((S(ss1)*(1 + S(ss1))*(-1 + 4*Power(S(ss1),2))*Power(1 + T,2)*(2 + T))/T) + ((-1 + T)*T)/sqrt((S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*T*Power(1 + T,2)*(2 + T))/(-1 + 2*S(ss1))) + ((-1 + 2*S(ss1))*(-1 + T)*T)/sqrt(((1 + S(ss1))*(-1 + 4*Power(S(ss1),2))*T*Power(1 + T,2)*(2 + T))/S(ss1));
+          case 134: return -(1/((1 + T)*sqrt(((1 + S(ss1))*(1 + 2*S(ss1))*(1 + 2*T))/(3 + 2*T))));
+          case 135: return sqrt((T*(2 + T))/(1 + 3*S(ss1) + 2*Power(S(ss1),2)))/(1 + T);
+          case 136: return 1/(sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)))*(1 + T)*(1 + 2*T));
+          case 137: return sqrt(3 + 5*T + 2*Power(T,2))*(-3*(1 - 2*S(ss1))*sqrt((S(ss1)*Power(T,2))/((1 + S(ss1))*(-1 + 4*Power(S(ss1),2))*Power(1 + T,3)*Power(2 + T,2)*(3 + 2*T))) + (-1 + T)/sqrt((S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*Power(1 + T,3)*Power(2 + T,2)*(3 + 2*T))/((-1 + 2*S(ss1))*Power(1 + 2*T,2))) + ((-1 + 2*S(ss1))*(-1 + T))/sqrt(((1 + S(ss1))*(-1 + 4*Power(S(ss1),2))*Power(1 + T,3)*Power(2 + T,2)*(3 + 2*T))/(S(ss1)*Power(1 + 2*T,2))) - ((1 + 2*T)*sqrt((-1 + 2*S(ss1))/((S(ss1) + 3*Power(S(ss1),2) + 2*Power(S(ss1),3))*(3 + 5*T + 2*Power(T,2)))))/(2 + T) + (3*T*sqrt((-1 + 2*S(ss1))/((S(ss1) + 3*Power(S(ss1),2) + 2*Power(S(ss1),3))*(3 + 5*T + 2*Power(T,2)))))/(2 + 3*T + Power(T,2)) - (S(ss1)*(-1 + 2*S(ss1))*(1 + 2*T))/((2 + T)*sqrt(S(ss1)*(-1 - S(ss1) + 4*Power(S(ss1),2) + 4*Power(S(ss1),3))*(3 + 5*T + 2*Power(T,2)))));
+          case 138: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 139: return (2*Power(T,2)*sqrt(((1 + S(ss1))*(1 + T))/(1 + 2*T)) + sqrt((1 + S(ss1))*(1 + 3*T + 2*Power(T,2))) - T*(sqrt(((1 + S(ss1))*(1 + T))/(1 + 2*T)) + sqrt((1 + S(ss1))*(1 + 3*T + 2*Power(T,2)))))/((1 + S(ss1))*(1 + T)*sqrt((1 + 2*S(ss1))*(1 + T)*(1 + 2*T)));
+          case 140: return -((sqrt(((1 + S(ss1))*(2 + T))/(1 + T)) - 2*T*sqrt(((1 + S(ss1))*(2 + T))/(1 + T)) - 2*Power(T,2)*sqrt(((1 + S(ss1))*(2 + T))/(1 + T)) + sqrt((1 + S(ss1))*(2 + 3*T + Power(T,2))) + 2*T*sqrt((1 + S(ss1))*(2 + 3*T + Power(T,2))))/((1 + S(ss1))*(2 + T)*sqrt((1 + 2*S(ss1))*(1 + T)*(2 + T))));
+          case 141: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 142: return ((3 + 2*S(ss1))*sqrt((S(ss1)*(-3 + 4*T + 4*Power(T,2)))/(3 + 11*S(ss1) + 12*Power(S(ss1),2) + 4*Power(S(ss1),3))))/(1 + 2*T);
+          case 143: return -((Power(S(ss1),2)*(3 + 2*S(ss1)))/((1 + T)*sqrt((Power(S(ss1),3)*(1 + 2*S(ss1))*(3 + 5*S(ss1) + 2*Power(S(ss1),2))*(1 + 2*T))/(3 + 2*T))));
+          case 144: return ((3 + 2*S(ss1))*(2*sqrt(S(ss1)*T) + sqrt(S(ss1)*Power(T,3)) + S(ss1)*sqrt(S(ss1)*T)*(2 + T)))/((1 + S(ss1))*(1 + T)*sqrt((1 + S(ss1))*(3 + 8*S(ss1) + 4*Power(S(ss1),2))*(2 + T)));
+          case 145: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 8*S(ss1) + 4*Power(S(ss1),2))*Power(1 + 3*T + 2*Power(T,2),2))/S(ss1));
+          case 146: return -(((3 + 2*S(ss1))*sqrt(S(ss1)/(3 + 11*S(ss1) + 12*Power(S(ss1),2) + 4*Power(S(ss1),3))))/(1 + T));
+          case 147: return (S(ss1)*(3 + 2*S(ss1)))/sqrt(S(ss1)*(1 + S(ss1))*(3 + 8*S(ss1) + 4*Power(S(ss1),2)));
+          case 148: return sqrt(-3 + 4*T + 4*Power(T,2))/(1 + 2*T);
+          case 149: return 1/sqrt((S(ss1)*(1 + 2*S(ss1))*Power(1 + 2*T,2))/(-3 + 4*T + 4*Power(T,2)));
+          case 150: return -(sqrt((3 + 2*T)/(1 + 2*T))/(1 + T));
+          case 151: return (2*sqrt(T/(2 + T)) + sqrt(Power(T,3)/(2 + T)))/(1 + T);
+          case 152: return -(1/((1 + T)*sqrt((S(ss1)*(1 + 2*S(ss1))*(1 + 2*T))/(3 + 2*T))));
+          case 153: return (2*sqrt(T/((S(ss1) + 2*Power(S(ss1),2))*(2 + T))) + sqrt(Power(T,3)/((S(ss1) + 2*Power(S(ss1),2))*(2 + T))))/(1 + T);
+          case 154: return 1/(1 + 3*T + 2*Power(T,2));
+          case 155: return -(1/(1 + T));
+          case 156: return 1;
+          case 157: return 1/(sqrt(S(ss1)*(1 + 2*S(ss1)))*(1 + 3*T + 2*Power(T,2)));
+          case 158: return -(1/(sqrt(S(ss1)*(1 + 2*S(ss1)))*(1 + T)));
+          case 159: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 160: return (sqrt(((-1 + 2*S(ss1))*T*(-1 + 2*T))/(S(ss1)*(1 + 2*S(ss1))*(1 + 3*T + 2*Power(T,2)))) - sqrt((S(ss1)*T*(-1 + 2*T))/((-1 + 4*Power(S(ss1),2))*(1 + 3*T + 2*Power(T,2)))) + 2*S(ss1)*sqrt((S(ss1)*T*(-1 + 2*T))/((-1 + 4*Power(S(ss1),2))*(1 + 3*T + 2*Power(T,2)))))/sqrt(((1 + S(ss1))*T*(1 + 2*T))/(3 + 5*T + 2*Power(T,2)));
+          case 161: return 1/sqrt(((1 + S(ss1))*(1 + 2*S(ss1))*Power(1 + 2*T,2))/(-3 + 4*T + 4*Power(T,2)));
+          case 162: return (sqrt(3 + 5*T + 2*Power(T,2))*(-sqrt(((-1 + S(ss1) + 2*Power(S(ss1),2))*(1 + T))/((S(ss1) + 2*Power(S(ss1),2))*(1 + 2*T))) + S(ss1)*sqrt(((1 + S(ss1))*(1 + T))/((-S(ss1) + 4*Power(S(ss1),3))*(1 + 2*T))) - 2*Power(S(ss1),2)*sqrt(((1 + S(ss1))*(1 + T))/((-S(ss1) + 4*Power(S(ss1),3))*(1 + 2*T))) + 2*T*(sqrt((S(ss1)*(1 + S(ss1))*(1 + T))/((-1 + 4*Power(S(ss1),2))*(1 + 2*T))) - 2*sqrt((Power(S(ss1),3)*(1 + S(ss1))*(1 + T))/((-1 + 4*Power(S(ss1),2))*(1 + 2*T))) - S(ss1)*sqrt(((1 + S(ss1))*(1 + T))/((-S(ss1) + 4*Power(S(ss1),3))*(1 + 2*T))) + 2*Power(S(ss1),2)*sqrt(((1 + S(ss1))*(1 + T))/((-S(ss1) + 4*Power(S(ss1),3))*(1 + 2*T))))))/((1 + S(ss1))*Power(1 + T,2));
+          case 163: return 3/((1 + T)*sqrt((S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*(2 + T))/((-1 + 2*S(ss1))*T))) + (3*S(ss1)*(-1 + 2*S(ss1)))/sqrt((S(ss1)*(1 + S(ss1))*(-1 + 4*Power(S(ss1),2))*Power(1 + T,2)*(2 + T))/T) + ((-1 + T)*T)/sqrt((S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*T*Power(1 + T,2)*(2 + T))/(-1 + 2*S(ss1))) + ((-1 + 2*S(ss1))*(-1 + T)*T)/sqrt(((1 + S(ss1))*(-1 + 4*Power(S(ss1),2))*T*Power(1 + T,2)*(2 + T))/S(ss1));
+          case 164: return -(1/((1 + T)*sqrt(((1 + S(ss1))*(1 + 2*S(ss1))*(1 + 2*T))/(3 + 2*T))));
+          case 165: return sqrt((T*(2 + T))/(1 + 3*S(ss1) + 2*Power(S(ss1),2)))/(1 + T);
+          case 166: return 1/(sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)))*(1 + T)*(1 + 2*T));
+          case 167: return sqrt(3 + 5*T + 2*Power(T,2))*(-3*(1 - 2*S(ss1))*sqrt((S(ss1)*Power(T,2))/((1 + S(ss1))*(-1 + 4*Power(S(ss1),2))*Power(1 + T,3)*Power(2 + T,2)*(3 + 2*T))) + (-1 + T)/sqrt((S(ss1)*(1 + S(ss1))*(1 + 2*S(ss1))*Power(1 + T,3)*Power(2 + T,2)*(3 + 2*T))/((-1 + 2*S(ss1))*Power(1 + 2*T,2))) + ((-1 + 2*S(ss1))*(-1 + T))/sqrt(((1 + S(ss1))*(-1 + 4*Power(S(ss1),2))*Power(1 + T,3)*Power(2 + T,2)*(3 + 2*T))/(S(ss1)*Power(1 + 2*T,2))) - ((1 + 2*T)*sqrt((-1 + 2*S(ss1))/((S(ss1) + 3*Power(S(ss1),2) + 2*Power(S(ss1),3))*(3 + 5*T + 2*Power(T,2)))))/(2 + T) + (3*T*sqrt((-1 + 2*S(ss1))/((S(ss1) + 3*Power(S(ss1),2) + 2*Power(S(ss1),3))*(3 + 5*T + 2*Power(T,2)))))/(2 + 3*T + Power(T,2)) - (S(ss1)*(-1 + 2*S(ss1))*(1 + 2*T))/((2 + T)*sqrt(S(ss1)*(-1 - S(ss1) + 4*Power(S(ss1),2) + 4*Power(S(ss1),3))*(3 + 5*T + 2*Power(T,2)))));
+          case 168: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 169: return (2*Power(T,2)*sqrt(((1 + S(ss1))*(1 + T))/(1 + 2*T)) + sqrt((1 + S(ss1))*(1 + 3*T + 2*Power(T,2))) - T*(sqrt(((1 + S(ss1))*(1 + T))/(1 + 2*T)) + sqrt((1 + S(ss1))*(1 + 3*T + 2*Power(T,2)))))/((1 + S(ss1))*(1 + T)*sqrt((1 + 2*S(ss1))*(1 + T)*(1 + 2*T)));
+          case 170: return -((sqrt(((1 + S(ss1))*(2 + T))/(1 + T)) - 2*T*sqrt(((1 + S(ss1))*(2 + T))/(1 + T)) - 2*Power(T,2)*sqrt(((1 + S(ss1))*(2 + T))/(1 + T)) + sqrt((1 + S(ss1))*(2 + 3*T + Power(T,2))) + 2*T*sqrt((1 + S(ss1))*(2 + 3*T + Power(T,2))))/((1 + S(ss1))*(2 + T)*sqrt((1 + 2*S(ss1))*(1 + T)*(2 + T))));
+          case 171: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 172: return ((3 + 2*S(ss1))*sqrt((S(ss1)*(-3 + 4*T + 4*Power(T,2)))/(3 + 11*S(ss1) + 12*Power(S(ss1),2) + 4*Power(S(ss1),3))))/(1 + 2*T);
+          case 173: return -((Power(S(ss1),2)*(3 + 2*S(ss1)))/((1 + T)*sqrt((Power(S(ss1),3)*(1 + 2*S(ss1))*(3 + 5*S(ss1) + 2*Power(S(ss1),2))*(1 + 2*T))/(3 + 2*T))));
+          case 174: return ((3 + 2*S(ss1))*(2*sqrt(S(ss1)*T) + sqrt(S(ss1)*Power(T,3)) + S(ss1)*sqrt(S(ss1)*T)*(2 + T)))/((1 + S(ss1))*(1 + T)*sqrt((1 + S(ss1))*(3 + 8*S(ss1) + 4*Power(S(ss1),2))*(2 + T)));
+          case 175: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 8*S(ss1) + 4*Power(S(ss1),2))*Power(1 + 3*T + 2*Power(T,2),2))/S(ss1));
+          case 176: return -(((3 + 2*S(ss1))*sqrt(S(ss1)/(3 + 11*S(ss1) + 12*Power(S(ss1),2) + 4*Power(S(ss1),3))))/(1 + T));
+          case 177: return (S(ss1)*(3 + 2*S(ss1)))/sqrt(S(ss1)*(1 + S(ss1))*(3 + 8*S(ss1) + 4*Power(S(ss1),2)));
+          case 178: return -1;
+          case 179: return -(sqrt(3)/sqrt(-1 + 4*Power(S(ss1),2)));
+          case 180: return (-2*(-1 + Power(S(ss1),2)))/sqrt(1 - 5*Power(S(ss1),2) + 4*Power(S(ss1),4));
+          case 181: return -2/(1 + 2*S(ss1));
+          case 182: return -(sqrt(-3 + 4*S(ss1) + 4*Power(S(ss1),2))/(1 + 2*S(ss1)));
+          case 183: return -((sqrt(3)*(3*sqrt(S(ss1)*(1 + S(ss1))) + 5*sqrt(Power(S(ss1),3)*(1 + S(ss1))) + 2*sqrt(Power(S(ss1),5)*(1 + S(ss1)))))/sqrt(S(ss1)*(1 + 2*S(ss1))*Power(3 + 5*S(ss1) + 2*Power(S(ss1),2),3)));
+          case 184: return -((9*sqrt(S(ss1)/(3 + 2*S(ss1))) + sqrt(S(ss1)*(3 + 2*S(ss1))) + 2*S(ss1)*(3*sqrt(S(ss1)/(3 + 2*S(ss1))) + sqrt(S(ss1)*(3 + 2*S(ss1)))))/((3 + 2*S(ss1))*sqrt(2 + 5*S(ss1) + 2*Power(S(ss1),2))));
+          default: my_assert_not_reached();
+        }
+      };
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(1, 2, 1));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -240,6 +2581,7 @@ Opch<SC> SymmetrySPSU2T<SC>::recalc_irreduc(const Step &step, const DiagInfo<SC>
 template<typename SC>
 MatrixElements<SC> SymmetrySPSU2T<SC>::recalc_triplet(const DiagInfo<SC> &diag, const SubspaceStructure &substruct, const MatrixElements<SC> &cold) const {
   MatrixElements<SC> cnew;
+  const auto blocks = std::make_shared<const BlockIndex<SC>>(cold, substruct);
   for(const auto &[I1, eig]: diag) {
     int ss1  = I1.get("SS");
     int t1 = I1.get("T");
@@ -252,10 +2594,258 @@ MatrixElements<SC> SymmetrySPSU2T<SC>::recalc_triplet(const DiagInfo<SC> &diag,
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "spsu2t/spsu2t-triplets.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {4, 4},
+        {5, 5},
+        {6, 6},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {10, 10},
+        {11, 11},
+        {12, 12},
+        {13, 13},
+        {14, 14},
+        {15, 15},
+        {15, 18},
+        {16, 16},
+        {16, 19},
+        {17, 17},
+        {17, 20},
+        {18, 15},
+        {18, 18},
+        {19, 16},
+        {19, 19},
+        {20, 17},
+        {20, 20},
+        {21, 21},
+        {21, 24},
+        {22, 22},
+        {22, 25},
+        {23, 23},
+        {23, 26},
+        {24, 21},
+        {24, 24},
+        {25, 22},
+        {25, 25},
+        {26, 23},
+        {26, 26},
+        {27, 27},
+        {27, 30},
+        {28, 28},
+        {28, 31},
+        {29, 29},
+        {29, 32},
+        {30, 27},
+        {30, 30},
+        {31, 28},
+        {31, 31},
+        {32, 29},
+        {32, 32},
+        {33, 33},
+        {33, 38},
+        {34, 34},
+        {34, 39},
+        {35, 35},
+        {35, 40},
+        {36, 36},
+        {36, 41},
+        {37, 37},
+        {37, 42},
+        {38, 33},
+        {38, 38},
+        {39, 34},
+        {39, 39},
+        {40, 35},
+        {40, 40},
+        {41, 36},
+        {41, 41},
+        {42, 37},
+        {42, 42},
+        {43, 43},
+        {43, 46},
+        {44, 44},
+        {44, 47},
+        {45, 45},
+        {45, 48},
+        {46, 43},
+        {46, 46},
+        {46, 49},
+        {47, 44},
+        {47, 47},
+        {47, 50},
+        {48, 45},
+        {48, 48},
+        {48, 51},
+        {49, 46},
+        {49, 49},
+        {50, 47},
+        {50, 50},
+        {51, 48},
+        {51, 51},
+        {52, 52},
+        {52, 55},
+        {53, 53},
+        {53, 56},
+        {54, 54},
+        {54, 57},
+        {55, 52},
+        {55, 55},
+        {55, 58},
+        {56, 53},
+        {56, 56},
+        {56, 59},
+        {57, 54},
+        {57, 57},
+        {57, 60},
+        {58, 55},
+        {58, 58},
+        {59, 56},
+        {59, 59},
+        {60, 57},
+        {60, 60},
+        {61, 61},
+        {61, 62},
+        {62, 61},
+        {62, 62},
+        {62, 63},
+        {63, 62},
+        {63, 63},
+        {63, 64},
+        {64, 63},
+        {64, 64}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return 1;
+          case 3: return 1;
+          case 4: return 1;
+          case 5: return 1;
+          case 6: return 1;
+          case 7: return 1;
+          case 8: return 1;
+          case 9: return 1;
+          case 10: return 1;
+          case 11: return 1;
+          case 12: return 1;
+          case 13: return 1;
+          case 14: return sqrt((-1 + S(ss1) + 2*Power(S(ss1),2))/(S(ss1)*(1 + 2*S(ss1))));
+          case 15: return 1/sqrt(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 16: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 17: return 1/sqrt(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 18: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 19: return 1/sqrt(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 20: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 21: return (sqrt((S(ss1)*(1 + 2*S(ss1)))/(3 + 2*S(ss1)))/(1 + S(ss1)) + S(ss1)*sqrt((S(ss1)*(1 + 2*S(ss1)))/(Power(1 + S(ss1),2)*(3 + 2*S(ss1)))) + 2*sqrt(S(ss1)/(3 + 8*S(ss1) + 4*Power(S(ss1),2))))/sqrt(1 + S(ss1));
+          case 22: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 23: return (sqrt((S(ss1)*(1 + 2*S(ss1)))/(3 + 2*S(ss1))) + 2*sqrt(S(ss1)/(3 + 8*S(ss1) + 4*Power(S(ss1),2))))/sqrt(1 + S(ss1));
+          case 24: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 25: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 8*S(ss1) + 4*Power(S(ss1),2)))/S(ss1));
+          case 26: return sqrt((-1 + S(ss1) + 2*Power(S(ss1),2))/(S(ss1)*(1 + 2*S(ss1))));
+          case 27: return 1/sqrt(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 28: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 29: return 1/sqrt(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 30: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 31: return 1/sqrt(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 32: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 33: return (sqrt((S(ss1)*(1 + 2*S(ss1)))/(3 + 2*S(ss1)))/(1 + S(ss1)) + S(ss1)*sqrt((S(ss1)*(1 + 2*S(ss1)))/(Power(1 + S(ss1),2)*(3 + 2*S(ss1)))) + 2*sqrt(S(ss1)/(3 + 8*S(ss1) + 4*Power(S(ss1),2))))/sqrt(1 + S(ss1));
+          case 34: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 35: return (sqrt((S(ss1)*(1 + 2*S(ss1)))/(3 + 2*S(ss1))) + 2*sqrt(S(ss1)/(3 + 8*S(ss1) + 4*Power(S(ss1),2))))/sqrt(1 + S(ss1));
+          case 36: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 37: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 8*S(ss1) + 4*Power(S(ss1),2)))/S(ss1));
+          case 38: return sqrt((-1 + S(ss1) + 2*Power(S(ss1),2))/(S(ss1)*(1 + 2*S(ss1))));
+          case 39: return 1/sqrt(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 40: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 41: return 1/sqrt(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 42: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 43: return 1/sqrt(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 44: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 45: return (sqrt((S(ss1)*(1 + 2*S(ss1)))/(3 + 2*S(ss1)))/(1 + S(ss1)) + S(ss1)*sqrt((S(ss1)*(1 + 2*S(ss1)))/(Power(1 + S(ss1),2)*(3 + 2*S(ss1)))) + 2*sqrt(S(ss1)/(3 + 8*S(ss1) + 4*Power(S(ss1),2))))/sqrt(1 + S(ss1));
+          case 46: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 47: return (sqrt((S(ss1)*(1 + 2*S(ss1)))/(3 + 2*S(ss1))) + 2*sqrt(S(ss1)/(3 + 8*S(ss1) + 4*Power(S(ss1),2))))/sqrt(1 + S(ss1));
+          case 48: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 49: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 8*S(ss1) + 4*Power(S(ss1),2)))/S(ss1));
+          case 50: return sqrt((-1 + S(ss1) + 2*Power(S(ss1),2))/(S(ss1)*(1 + 2*S(ss1))));
+          case 51: return 1/sqrt(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 52: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 53: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 54: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-1 + S(ss1) + 2*Power(S(ss1),2)));
+          case 55: return 1/sqrt(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 56: return (T*((3*S(ss1)*Power(T,2)*(1 + T)*Power(6 + 7*T + 2*Power(T,2),1.5))/sqrt((-1 + 2*S(ss1))/(1 + 2*T)) + (6*S(ss1)*T*(1 + T)*Power(6 + 7*T + 2*Power(T,2),1.5))/sqrt((-1 + 2*S(ss1))*(1 + 2*T)) + (9*S(ss1)*Power(T,2)*(1 + T)*Power(6 + 7*T + 2*Power(T,2),1.5))/sqrt((-1 + 2*S(ss1))*(1 + 2*T)) + sqrt((Power(S(ss1),2)*(1 + 2*T)*Power(T + Power(T,2),4)*Power(6 + 7*T + 2*Power(T,2),3))/(-1 + 2*S(ss1)))))/sqrt((Power(S(ss1),3)*(1 + 2*S(ss1))*Power(T + Power(T,2),4)*Power(6 + 7*T + 2*Power(T,2),5))/((1 + S(ss1))*Power(-1 + 2*S(ss1),2)*(1 + 2*T)));
+          case 57: return 1/sqrt((1 + S(ss1))*(1 + 2*S(ss1)));
+          case 58: return sqrt((1 + S(ss1))/((1 + 2*S(ss1))*(30 + 77*T + 71*Power(T,2) + 28*Power(T,3) + 4*Power(T,4))))*(2*(1 + 2*T)*sqrt(((-1 + 2*S(ss1))*(3 + 5*T + 2*Power(T,2)))/(S(ss1)*(10 + 9*T + 2*Power(T,2)))) + (1 + 2*T)*sqrt(((-1 + 2*S(ss1))*(6 + 13*T + 9*Power(T,2) + 2*Power(T,3)))/(S(ss1)*(5 + 2*T))) + 6*(1 + 2*T)*sqrt(((-1 + 2*S(ss1))*(1 + T))/(S(ss1)*(30 + 47*T + 24*Power(T,2) + 4*Power(T,3)))) + 6*sqrt((-1 + 2*S(ss1))/(S(ss1)*(30 + 77*T + 71*Power(T,2) + 28*Power(T,3) + 4*Power(T,4)))) + 6*(1 + 2*T)*sqrt((-1 + 2*S(ss1))/(S(ss1)*(30 + 77*T + 71*Power(T,2) + 28*Power(T,3) + 4*Power(T,4)))));
+          case 59: return 1/sqrt(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 60: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 61: return (sqrt((S(ss1)*(1 + 2*S(ss1)))/(3 + 2*S(ss1)))/(1 + S(ss1)) + S(ss1)*sqrt((S(ss1)*(1 + 2*S(ss1)))/(Power(1 + S(ss1),2)*(3 + 2*S(ss1)))) + 2*sqrt(S(ss1)/(3 + 8*S(ss1) + 4*Power(S(ss1),2))))/sqrt(1 + S(ss1));
+          case 62: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 63: return (sqrt((S(ss1)*(1 + 2*S(ss1)))/(3 + 2*S(ss1))) + 2*sqrt(S(ss1)/(3 + 8*S(ss1) + 4*Power(S(ss1),2))))/sqrt(1 + S(ss1));
+          case 64: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 65: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 8*S(ss1) + 4*Power(S(ss1),2)))/S(ss1));
+          case 66: return -(1/sqrt(S(ss1)*(1 + 2*S(ss1))));
+          case 67: return (6*(sqrt((S(ss1)*(1 + 2*S(ss1)))/(3 + 2*S(ss1))) + sqrt((Power(S(ss1),3)*(1 + 2*S(ss1)))/(3 + 2*S(ss1))) + 2*sqrt(S(ss1)/(3 + 8*S(ss1) + 4*Power(S(ss1),2)))) + 13*(sqrt((S(ss1)*(1 + 2*S(ss1)))/(3 + 2*S(ss1))) + 2*sqrt(S(ss1)/(3 + 8*S(ss1) + 4*Power(S(ss1),2))))*T + 9*(sqrt((S(ss1)*(1 + 2*S(ss1)))/(3 + 2*S(ss1))) + 2*sqrt(S(ss1)/(3 + 8*S(ss1) + 4*Power(S(ss1),2))))*Power(T,2) + 2*(sqrt((S(ss1)*(1 + 2*S(ss1)))/(3 + 2*S(ss1))) + 2*sqrt(S(ss1)/(3 + 8*S(ss1) + 4*Power(S(ss1),2))))*Power(T,3) + S(ss1)*(12*sqrt(S(ss1)/(3 + 8*S(ss1) + 4*Power(S(ss1),2))) + 13*(sqrt((S(ss1)*(1 + 2*S(ss1)))/(3 + 2*S(ss1))) + 2*sqrt(S(ss1)/(3 + 8*S(ss1) + 4*Power(S(ss1),2))))*T + 9*(sqrt((S(ss1)*(1 + 2*S(ss1)))/(3 + 2*S(ss1))) + 2*sqrt(S(ss1)/(3 + 8*S(ss1) + 4*Power(S(ss1),2))))*Power(T,2) + 2*(sqrt((S(ss1)*(1 + 2*S(ss1)))/(3 + 2*S(ss1))) + 2*sqrt(S(ss1)/(3 + 8*S(ss1) + 4*Power(S(ss1),2))))*Power(T,3)))/(Power(1 + S(ss1),1.5)*(1 + T)*(6 + 7*T + 2*Power(T,2)));
+          case 68: return ((-1 + 2*S(ss1))*sqrt((S(ss1)*(1 + S(ss1)))/(1 + 2*S(ss1))) - sqrt(S(ss1)*(1 + 3*S(ss1) + 2*Power(S(ss1),2))))/(2.*S(ss1)*sqrt(1 + S(ss1)));
+          case 69: return (3 + 2*S(ss1))/sqrt(((1 + S(ss1))*(3 + 8*S(ss1) + 4*Power(S(ss1),2)))/S(ss1));
+          case 70: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 71: return sqrt((-1 + 2*S(ss1))/(1 + 2*S(ss1)))/S(ss1);
+          case 72: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 73: return sqrt((-1 + 2*S(ss1))/(1 + 2*S(ss1)))/S(ss1);
+          case 74: return (sqrt(((-1 + S(ss1))*(1 + T)*Power(1 + 2*T,2))/(S(ss1)*(3 + 2*T))) + sqrt((-1 + S(ss1))/(S(ss1)*(3 + 5*T + 2*Power(T,2)))) + sqrt(((-1 + S(ss1))*Power(1 + 2*T,2))/(S(ss1)*(3 + 5*T + 2*Power(T,2)))))/sqrt((S(ss1)*(3 + 5*T + 2*Power(T,2)))/(1 + S(ss1)));
+          case 75: return (sqrt(((-1 + 2*S(ss1))*(1 + T)*Power(1 + 2*T,2))/((S(ss1) + Power(S(ss1),2))*(3 + 2*T))) + sqrt((-1 + 2*S(ss1))/(S(ss1)*(1 + S(ss1))*(3 + 5*T + 2*Power(T,2)))) + sqrt(((-1 + 2*S(ss1))*Power(1 + 2*T,2))/(S(ss1)*(1 + S(ss1))*(3 + 5*T + 2*Power(T,2)))))/sqrt((S(ss1)*(1 + 2*S(ss1))*(3 + 5*T + 2*Power(T,2)))/(1 + S(ss1)));
+          case 76: return -(1/S(ss1));
+          case 77: return (-1 + S(ss1) + Power(S(ss1),2))/(S(ss1)*(1 + S(ss1)));
+          case 78: return 1/(1 + S(ss1));
+          case 79: return -(1/S(ss1));
+          case 80: return (-1 + S(ss1) + Power(S(ss1),2))/(S(ss1)*(1 + S(ss1)));
+          case 81: return 1/(1 + S(ss1));
+          case 82: return -(1/S(ss1));
+          case 83: return (-1 + S(ss1) + Power(S(ss1),2))/(S(ss1)*(1 + S(ss1)));
+          case 84: return 1/(1 + S(ss1));
+          case 85: return (-3 - 2*S(ss1))/((1 + S(ss1))*sqrt(3 + 8*S(ss1) + 4*Power(S(ss1),2)));
+          case 86: return sqrt(1 + S(ss1))*(2*sqrt((S(ss1)*Power(1 + 2*S(ss1),2))/(Power(1 + S(ss1),3)*(2 + S(ss1))*Power(3 + 2*S(ss1),2))) + ((1 + 2*S(ss1))*sqrt(S(ss1)/(2 + 3*S(ss1) + Power(S(ss1),2))))/(3 + 2*S(ss1)) + (3*sqrt(S(ss1)/(2 + 3*S(ss1) + Power(S(ss1),2))))/(3 + 5*S(ss1) + 2*Power(S(ss1),2)));
+          case 87: return -((4*Power(S(ss1),2.5)*Power(T,1.5) + 5*Power(S(ss1),1.5)*Power(T,2.5) + 3*sqrt(S(ss1)*T) + 10*Power(S(ss1)*T,1.5) + 2*Power(S(ss1)*T,2.5) + 5*sqrt(Power(S(ss1),3)*T) + 2*sqrt(Power(S(ss1),5)*T) + 6*sqrt(S(ss1)*Power(T,3)) + 3*sqrt(S(ss1)*Power(T,5)))/(Power(1 + S(ss1),1.5)*sqrt(S(ss1)*(3 + 2*S(ss1))*(1 + 3*S(ss1) + 2*Power(S(ss1),2))*T)*Power(1 + T,2)));
+          case 88: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 89: return (-3 - 2*S(ss1))/((1 + S(ss1))*sqrt(3 + 8*S(ss1) + 4*Power(S(ss1),2)));
+          case 90: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 91: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 92: return sqrt((-1 + 2*S(ss1))/(1 + 2*S(ss1)))/S(ss1);
+          case 93: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 94: return sqrt((-1 + 2*S(ss1))/(1 + 2*S(ss1)))/S(ss1);
+          case 95: return (sqrt(((-1 + S(ss1))*(1 + T)*Power(1 + 2*T,2))/(S(ss1)*(3 + 2*T))) + sqrt((-1 + S(ss1))/(S(ss1)*(3 + 5*T + 2*Power(T,2)))) + sqrt(((-1 + S(ss1))*Power(1 + 2*T,2))/(S(ss1)*(3 + 5*T + 2*Power(T,2)))))/sqrt((S(ss1)*(3 + 5*T + 2*Power(T,2)))/(1 + S(ss1)));
+          case 96: return (sqrt(((-1 + 2*S(ss1))*(1 + T)*Power(1 + 2*T,2))/((S(ss1) + Power(S(ss1),2))*(3 + 2*T))) + sqrt((-1 + 2*S(ss1))/(S(ss1)*(1 + S(ss1))*(3 + 5*T + 2*Power(T,2)))) + sqrt(((-1 + 2*S(ss1))*Power(1 + 2*T,2))/(S(ss1)*(1 + S(ss1))*(3 + 5*T + 2*Power(T,2)))))/sqrt((S(ss1)*(1 + 2*S(ss1))*(3 + 5*T + 2*Power(T,2)))/(1 + S(ss1)));
+          case 97: return -(1/S(ss1));
+          case 98: return (-1 + S(ss1) + Power(S(ss1),2))/(S(ss1)*(1 + S(ss1)));
+          case 99: return 1/(1 + S(ss1));
+          case 100: return -(1/S(ss1));
+          case 101: return (-1 + S(ss1) + Power(S(ss1),2))/(S(ss1)*(1 + S(ss1)));
+          case 102: return 1/(1 + S(ss1));
+          case 103: return -(1/S(ss1));
+          case 104: return (-1 + S(ss1) + Power(S(ss1),2))/(S(ss1)*(1 + S(ss1)));
+          case 105: return 1/(1 + S(ss1));
+          case 106: return (-3 - 2*S(ss1))/((1 + S(ss1))*sqrt(3 + 8*S(ss1) + 4*Power(S(ss1),2)));
+          case 107: return sqrt(1 + S(ss1))*(2*sqrt((S(ss1)*Power(1 + 2*S(ss1),2))/(Power(1 + S(ss1),3)*(2 + S(ss1))*Power(3 + 2*S(ss1),2))) + ((1 + 2*S(ss1))*sqrt(S(ss1)/(2 + 3*S(ss1) + Power(S(ss1),2))))/(3 + 2*S(ss1)) + (3*sqrt(S(ss1)/(2 + 3*S(ss1) + Power(S(ss1),2))))/(3 + 5*S(ss1) + 2*Power(S(ss1),2)));
+          case 108: return -((4*Power(S(ss1),2.5)*Power(T,1.5) + 5*Power(S(ss1),1.5)*Power(T,2.5) + 3*sqrt(S(ss1)*T) + 10*Power(S(ss1)*T,1.5) + 2*Power(S(ss1)*T,2.5) + 5*sqrt(Power(S(ss1),3)*T) + 2*sqrt(Power(S(ss1),5)*T) + 6*sqrt(S(ss1)*Power(T,3)) + 3*sqrt(S(ss1)*Power(T,5)))/(Power(1 + S(ss1),1.5)*sqrt(S(ss1)*(3 + 2*S(ss1))*(1 + 3*S(ss1) + 2*Power(S(ss1),2))*T)*Power(1 + T,2)));
+          case 109: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 110: return (-3 - 2*S(ss1))/((1 + S(ss1))*sqrt(3 + 8*S(ss1) + 4*Power(S(ss1),2)));
+          case 111: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 112: return sqrt((3 + S(ss1) - 2*Power(S(ss1),2))/(S(ss1) - 2*Power(S(ss1),2)));
+          case 113: return (sqrt(3)*sqrt((-1 + S(ss1))/(-1 + 2*S(ss1))))/S(ss1);
+          case 114: return -(sqrt(3)/sqrt(S(ss1)*(-1 + 2*S(ss1))));
+          case 115: return (-4 + S(ss1) + 2*Power(S(ss1),2))/sqrt(S(ss1)*(1 + S(ss1))*(-1 + 4*Power(S(ss1),2)));
+          case 116: return (3*sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(-1 + 4*Power(S(ss1),2))) - 10*S(ss1)*sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(-1 + 4*Power(S(ss1),2))) + 8*Power(S(ss1),2)*sqrt((S(ss1)*(1 + S(ss1))*(3 + 2*S(ss1)))/(-1 + 4*Power(S(ss1),2))) + 9*(1 + S(ss1))*sqrt((S(ss1)*(-3 + 4*S(ss1) + 4*Power(S(ss1),2)))/(1 + 3*S(ss1) + 2*Power(S(ss1),2))))/(2.*S(ss1)*Power(1 + S(ss1),1.5)*(3 + 2*S(ss1)));
+          case 117: return (3*sqrt((S(ss1)*(3 + 2*S(ss1)))/(1 + 2*S(ss1))) - 5*sqrt((Power(S(ss1),3)*(3 + 2*S(ss1)))/(1 + 2*S(ss1))) - 4*sqrt((Power(S(ss1),5)*(3 + 2*S(ss1)))/(1 + 2*S(ss1))) + 4*sqrt((Power(S(ss1),7)*(3 + 2*S(ss1)))/(1 + 2*S(ss1))) + sqrt(Power(S(ss1),3)*(3 + 8*S(ss1) + 4*Power(S(ss1),2))) - 2*sqrt(Power(S(ss1),5)*(3 + 8*S(ss1) + 4*Power(S(ss1),2))))/(S(ss1)*(3 + 2*S(ss1))*sqrt(S(ss1)*(-1 + S(ss1) + 2*Power(S(ss1),2))));
+          case 118: return (-9*sqrt((-3 + 4*S(ss1) + 4*Power(S(ss1),2))/(1 + 2*S(ss1))) + S(ss1)*(6*sqrt((-3 + 4*S(ss1) + 4*Power(S(ss1),2))/(1 + 2*S(ss1))) - 3*sqrt(-3 - 2*S(ss1) + 12*Power(S(ss1),2) + 8*Power(S(ss1),3))) + 2*Power(S(ss1),2)*(8*sqrt((-3 + 4*S(ss1) + 4*Power(S(ss1),2))/(1 + 2*S(ss1))) + sqrt(-3 - 2*S(ss1) + 12*Power(S(ss1),2) + 8*Power(S(ss1),3))))/(Power(3 + 2*S(ss1),2)*sqrt(S(ss1)*(-1 + S(ss1) + 2*Power(S(ss1),2))));
+          case 119: return sqrt(3)/sqrt((1 + S(ss1))*(3 + 2*S(ss1)));
+          case 120: return -0.5*(sqrt(3)*sqrt((-1 + S(ss1) + 2*Power(S(ss1),2))/(2 + S(ss1)))*(9*sqrt((3 + 5*S(ss1) + 2*Power(S(ss1),2))/(-1 + 2*S(ss1))) + 20*S(ss1)*sqrt((3 + 5*S(ss1) + 2*Power(S(ss1),2))/(-1 + 2*S(ss1))) + 4*Power(S(ss1),2)*sqrt((3 + 5*S(ss1) + 2*Power(S(ss1),2))/(-1 + 2*S(ss1))) - 3*sqrt(-3 + S(ss1) + 8*Power(S(ss1),2) + 4*Power(S(ss1),3))))/Power(3 + 5*S(ss1) + 2*Power(S(ss1),2),2);
+          case 121: return sqrt(1 + S(ss1))*(9*sqrt((S(ss1)*Power(1 + 2*S(ss1),2))/(Power(3 + 2*S(ss1),3)*(5 + 2*S(ss1))*Power(2 + 3*S(ss1) + Power(S(ss1),2),2))) + ((1 + 2*S(ss1))*sqrt(S(ss1)/(15 + 16*S(ss1) + 4*Power(S(ss1),2))))/(2 + S(ss1)) + (6*(1 + 2*S(ss1))*sqrt(S(ss1)/(15 + 16*S(ss1) + 4*Power(S(ss1),2))))/(6 + 7*S(ss1) + 2*Power(S(ss1),2)) + (12*sqrt(S(ss1)/(15 + 16*S(ss1) + 4*Power(S(ss1),2))))/(6 + 13*S(ss1) + 9*Power(S(ss1),2) + 2*Power(S(ss1),3)));
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(3, 0));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(3, 0));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -267,10 +2857,216 @@ MatrixElements<SC> SymmetrySPSU2T<SC>::recalc_triplet(const DiagInfo<SC> &diag,
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "spsu2t/spsu2t-tripletp.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {4, 4},
+        {5, 5},
+        {6, 6},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {10, 10},
+        {11, 11},
+        {12, 12},
+        {13, 13},
+        {14, 14},
+        {15, 15},
+        {16, 16},
+        {17, 17},
+        {18, 15},
+        {18, 18},
+        {19, 16},
+        {19, 19},
+        {20, 17},
+        {20, 20},
+        {21, 21},
+        {22, 22},
+        {23, 23},
+        {24, 21},
+        {24, 24},
+        {25, 22},
+        {25, 25},
+        {26, 23},
+        {26, 26},
+        {27, 27},
+        {28, 28},
+        {29, 29},
+        {30, 27},
+        {30, 30},
+        {31, 28},
+        {31, 31},
+        {32, 29},
+        {32, 32},
+        {33, 33},
+        {34, 34},
+        {35, 35},
+        {36, 36},
+        {37, 37},
+        {38, 33},
+        {38, 38},
+        {39, 34},
+        {39, 39},
+        {40, 35},
+        {40, 40},
+        {41, 36},
+        {41, 41},
+        {42, 37},
+        {42, 42},
+        {43, 43},
+        {44, 44},
+        {45, 45},
+        {46, 43},
+        {46, 46},
+        {47, 44},
+        {47, 47},
+        {48, 45},
+        {48, 48},
+        {49, 43},
+        {49, 46},
+        {49, 49},
+        {50, 44},
+        {50, 47},
+        {50, 50},
+        {51, 45},
+        {51, 48},
+        {51, 51},
+        {52, 52},
+        {53, 53},
+        {54, 54},
+        {55, 52},
+        {55, 55},
+        {56, 53},
+        {56, 56},
+        {57, 54},
+        {57, 57},
+        {58, 52},
+        {58, 55},
+        {58, 58},
+        {59, 53},
+        {59, 56},
+        {59, 59},
+        {60, 54},
+        {60, 57},
+        {60, 60},
+        {61, 61},
+        {62, 61},
+        {62, 62},
+        {63, 61},
+        {63, 62},
+        {63, 63},
+        {64, 62},
+        {64, 63},
+        {64, 64}
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(3, 0));
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return 1;
+          case 3: return 1;
+          case 4: return 1;
+          case 5: return 1;
+          case 6: return 1;
+          case 7: return 1;
+          case 8: return 1;
+          case 9: return 1;
+          case 10: return 1;
+          case 11: return 1;
+          case 12: return 1;
+          case 13: return 1;
+          case 14: return sqrt((S(ss1)*(3 + 5*S(ss1) + 2*Power(S(ss1),2)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 15: return sqrt((S(ss1)*(3 + 5*S(ss1) + 2*Power(S(ss1),2)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 16: return (sqrt((S(ss1)*(1 + T)*Power(1 + 2*T,2))/((1 + S(ss1))*(3 + 2*T))) + sqrt(S(ss1)/((1 + S(ss1))*(3 + 5*T + 2*Power(T,2)))) + sqrt((S(ss1)*Power(1 + 2*T,2))/((1 + S(ss1))*(3 + 5*T + 2*Power(T,2)))))/sqrt(((1 + 2*S(ss1))*(3 + 5*T + 2*Power(T,2)))/(3 + 2*S(ss1)));
+          case 17: return -(1/sqrt(1 + 3*S(ss1) + 2*Power(S(ss1),2)));
+          case 18: return 1;
+          case 19: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 20: return 1;
+          case 21: return -(1/sqrt(1 + 3*S(ss1) + 2*Power(S(ss1),2)));
+          case 22: return 1;
+          case 23: return sqrt((S(ss1)*(3 + 5*S(ss1) + 2*Power(S(ss1),2)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 24: return sqrt((S(ss1)*(3 + 5*S(ss1) + 2*Power(S(ss1),2)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 25: return (sqrt((S(ss1)*(1 + T)*Power(1 + 2*T,2))/((1 + S(ss1))*(3 + 2*T))) + sqrt(S(ss1)/((1 + S(ss1))*(3 + 5*T + 2*Power(T,2)))) + sqrt((S(ss1)*Power(1 + 2*T,2))/((1 + S(ss1))*(3 + 5*T + 2*Power(T,2)))))/sqrt(((1 + 2*S(ss1))*(3 + 5*T + 2*Power(T,2)))/(3 + 2*S(ss1)));
+          case 26: return -(1/sqrt(1 + 3*S(ss1) + 2*Power(S(ss1),2)));
+          case 27: return 1;
+          case 28: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 29: return 1;
+          case 30: return -(1/sqrt(1 + 3*S(ss1) + 2*Power(S(ss1),2)));
+          case 31: return 1;
+          case 32: return sqrt((S(ss1)*(3 + 5*S(ss1) + 2*Power(S(ss1),2)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 33: return sqrt((S(ss1)*(3 + 5*S(ss1) + 2*Power(S(ss1),2)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 34: return (sqrt((S(ss1)*(1 + T)*Power(1 + 2*T,2))/((1 + S(ss1))*(3 + 2*T))) + sqrt(S(ss1)/((1 + S(ss1))*(3 + 5*T + 2*Power(T,2)))) + sqrt((S(ss1)*Power(1 + 2*T,2))/((1 + S(ss1))*(3 + 5*T + 2*Power(T,2)))))/sqrt(((1 + 2*S(ss1))*(3 + 5*T + 2*Power(T,2)))/(3 + 2*S(ss1)));
+          case 35: return -(1/sqrt(1 + 3*S(ss1) + 2*Power(S(ss1),2)));
+          case 36: return 1;
+          case 37: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 38: return 1;
+          case 39: return -(1/sqrt(1 + 3*S(ss1) + 2*Power(S(ss1),2)));
+          case 40: return 1;
+          case 41: return sqrt((S(ss1)*(3 + 5*S(ss1) + 2*Power(S(ss1),2)))/(1 + 2*S(ss1)))/(1 + S(ss1));
+          case 42: return (sqrt(S(ss1)/((1 + S(ss1))*(-1 + T))) + 2*sqrt((S(ss1)*(-1 + T))/(1 + S(ss1))) - 2*sqrt(S(ss1)/((1 + S(ss1))*(-1 + T)))*T + sqrt(S(ss1)/((1 + S(ss1))*(-1 + T)))*Power(T,2))/(sqrt(((1 + 2*S(ss1))*(-1 + T))/(3 + 2*S(ss1)))*(1 + T));
+          case 43: return (-3*sqrt(S(ss1)*T*(3 + 5*T + 2*Power(T,2))) + 12*Power(T,2)*sqrt(S(ss1)*T*(3 + 5*T + 2*Power(T,2))) + sqrt(S(ss1)*Power(T,3)*(3 + 5*T + 2*Power(T,2))) - 4*sqrt(S(ss1)*Power(T,5)*(3 + 5*T + 2*Power(T,2))) + 4*sqrt(S(ss1)*Power(T,7)*(3 + 5*T + 2*Power(T,2))))/(sqrt(((1 + S(ss1))*(1 + 2*S(ss1))*T)/(3 + 2*S(ss1)))*(-1 + 2*T)*Power(3 + 5*T + 2*Power(T,2),1.5));
+          case 44: return (sqrt((3 + 2*S(ss1))/(1 + 3*S(ss1) + 2*Power(S(ss1),2)))*(sqrt(S(ss1)*Power(1 + T,3)*Power(T + 2*Power(T,2),2)*(6 + 7*T + 2*Power(T,2))) + 6*sqrt(S(ss1)*(6 + 13*T + 9*Power(T,2) + 2*Power(T,3))) + 12*T*sqrt(S(ss1)*(6 + 13*T + 9*Power(T,2) + 2*Power(T,3))) + 6*Power(T,2)*sqrt(S(ss1)*(6 + 13*T + 9*Power(T,2) + 2*Power(T,3)))))/Power(6 + 13*T + 9*Power(T,2) + 2*Power(T,3),1.5);
+          case 45: return sqrt((3 + 2*S(ss1))/((1 + 2*S(ss1))*(30 + 77*T + 71*Power(T,2) + 28*Power(T,3) + 4*Power(T,4))))*(2*(1 + 2*T)*sqrt((S(ss1)*(3 + 5*T + 2*Power(T,2)))/((1 + S(ss1))*(10 + 9*T + 2*Power(T,2)))) + (1 + 2*T)*sqrt((S(ss1)*(6 + 13*T + 9*Power(T,2) + 2*Power(T,3)))/((1 + S(ss1))*(5 + 2*T))) + 6*(1 + 2*T)*sqrt((S(ss1)*(1 + T))/((1 + S(ss1))*(30 + 47*T + 24*Power(T,2) + 4*Power(T,3)))) + 6*sqrt(S(ss1)/((1 + S(ss1))*(30 + 77*T + 71*Power(T,2) + 28*Power(T,3) + 4*Power(T,4)))) + 6*(1 + 2*T)*sqrt(S(ss1)/((1 + S(ss1))*(30 + 77*T + 71*Power(T,2) + 28*Power(T,3) + 4*Power(T,4)))));
+          case 46: return -(1/sqrt(1 + 3*S(ss1) + 2*Power(S(ss1),2)));
+          case 47: return 1;
+          case 48: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 49: return 1;
+          case 50: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 51: return 1;
+          case 52: return ((1 + 2*S(ss1))*sqrt((3 + 5*S(ss1) + 2*Power(S(ss1),2))/T)*Power(1 + 2*T,1.5)*(-6*sqrt(T/((3 + 8*S(ss1) + 4*Power(S(ss1),2))*Power(1 + 2*T,3))) - 9*sqrt(Power(T,3)/((3 + 8*S(ss1) + 4*Power(S(ss1),2))*Power(1 + 2*T,3))) - 4*sqrt(Power(T,3)/((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(1 + 2*T))) - sqrt(Power(T,5)/((3 + 8*S(ss1) + 4*Power(S(ss1),2))*(1 + 2*T))) + 2*S(ss1)*(6*sqrt(T/(Power(1 + 2*S(ss1),3)*(3 + 2*S(ss1))*Power(1 + 2*T,3))) + 9*sqrt(Power(T,3)/(Power(1 + 2*S(ss1),3)*(3 + 2*S(ss1))*Power(1 + 2*T,3))) + 4*sqrt(Power(T,3)/(Power(1 + 2*S(ss1),3)*(3 + 2*S(ss1))*(1 + 2*T))) + sqrt(Power(T,5)/(Power(1 + 2*S(ss1),3)*(3 + 2*S(ss1))*(1 + 2*T))))))/((1 + S(ss1))*(1 + T)*(6 + 7*T + 2*Power(T,2)));
+          case 53: return 1;
+          case 54: return -(1/sqrt((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 55: return 1;
+          case 56: return sqrt(-3 + 4*S(ss1) + 4*Power(S(ss1),2))/(1 + 2*S(ss1));
+          case 57: return sqrt(-3 + 4*S(ss1) + 4*Power(S(ss1),2))/(1 + 2*S(ss1));
+          case 58: return (sqrt((S(ss1)*(-1 + 2*S(ss1))*(1 + T)*Power(1 + 2*T,2))/((1 + 3*S(ss1) + 2*Power(S(ss1),2))*(3 + 2*T))) + sqrt((S(ss1)*(-1 + 2*S(ss1)))/((1 + 3*S(ss1) + 2*Power(S(ss1),2))*(3 + 5*T + 2*Power(T,2)))) + sqrt((S(ss1)*(-1 + 2*S(ss1))*Power(1 + 2*T,2))/((1 + 3*S(ss1) + 2*Power(S(ss1),2))*(3 + 5*T + 2*Power(T,2)))))/sqrt((S(ss1)*(1 + 2*S(ss1))*(3 + 5*T + 2*Power(T,2)))/(3 + 5*S(ss1) + 2*Power(S(ss1),2)));
+          case 59: return -(sqrt((3 + 2*S(ss1))/(1 + 2*S(ss1)))/(1 + S(ss1)));
+          case 60: return (2*sqrt(S(ss1)/(2 + S(ss1))) + sqrt(Power(S(ss1),3)/(2 + S(ss1))))/(1 + S(ss1));
+          case 61: return -(sqrt((3 + 2*S(ss1))/(1 + 2*S(ss1)))/(1 + S(ss1)));
+          case 62: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 63: return -(sqrt((3 + 2*S(ss1))/(1 + 2*S(ss1)))/(1 + S(ss1)));
+          case 64: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 65: return 1/(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 66: return -(1/(1 + S(ss1)));
+          case 67: return 1;
+          case 68: return 1/(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 69: return -(1/(1 + S(ss1)));
+          case 70: return 1;
+          case 71: return 1/(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 72: return -(1/(1 + S(ss1)));
+          case 73: return 1;
+          case 74: return sqrt(-3 + 4*S(ss1) + 4*Power(S(ss1),2))/(1 + 2*S(ss1));
+          case 75: return sqrt(-3 + 4*S(ss1) + 4*Power(S(ss1),2))/(1 + 2*S(ss1));
+          case 76: return (sqrt((S(ss1)*(-1 + 2*S(ss1))*(1 + T)*Power(1 + 2*T,2))/((1 + 3*S(ss1) + 2*Power(S(ss1),2))*(3 + 2*T))) + sqrt((S(ss1)*(-1 + 2*S(ss1)))/((1 + 3*S(ss1) + 2*Power(S(ss1),2))*(3 + 5*T + 2*Power(T,2)))) + sqrt((S(ss1)*(-1 + 2*S(ss1))*Power(1 + 2*T,2))/((1 + 3*S(ss1) + 2*Power(S(ss1),2))*(3 + 5*T + 2*Power(T,2)))))/sqrt((S(ss1)*(1 + 2*S(ss1))*(3 + 5*T + 2*Power(T,2)))/(3 + 5*S(ss1) + 2*Power(S(ss1),2)));
+          case 77: return -(sqrt((3 + 2*S(ss1))/(1 + 2*S(ss1)))/(1 + S(ss1)));
+          case 78: return (2*sqrt(S(ss1)/(2 + S(ss1))) + sqrt(Power(S(ss1),3)/(2 + S(ss1))))/(1 + S(ss1));
+          case 79: return -(sqrt((3 + 2*S(ss1))/(1 + 2*S(ss1)))/(1 + S(ss1)));
+          case 80: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 81: return -(sqrt((3 + 2*S(ss1))/(1 + 2*S(ss1)))/(1 + S(ss1)));
+          case 82: return sqrt(S(ss1)*(2 + S(ss1)))/(1 + S(ss1));
+          case 83: return 1/(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 84: return -(1/(1 + S(ss1)));
+          case 85: return 1;
+          case 86: return 1/(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 87: return -(1/(1 + S(ss1)));
+          case 88: return 1;
+          case 89: return 1/(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 90: return -(1/(1 + S(ss1)));
+          case 91: return 1;
+          case 92: return 1/sqrt((S(ss1)*(1 + 2*S(ss1)))/(-3 + S(ss1) + 2*Power(S(ss1),2)));
+          case 93: return -(sqrt(9 + 15*S(ss1) + 6*Power(S(ss1),2))/((1 + S(ss1))*(1 + 2*S(ss1))));
+          case 94: return sqrt(S(ss1)*(3 + 2*S(ss1))*(-2 + 3*S(ss1) + 2*Power(S(ss1),2)))/(1 + 3*S(ss1) + 2*Power(S(ss1),2));
+          case 95: return sqrt(3)/(sqrt(S(ss1)*(1 + S(ss1)))*(1 + 2*S(ss1)));
+          case 96: return (-4*sqrt(S(ss1)*(2 + S(ss1))*(3 + 5*S(ss1) + 2*Power(S(ss1),2))))/((1 + S(ss1))*(3 + 8*S(ss1) + 4*Power(S(ss1),2)));
+          case 97: return ((5 + 2*S(ss1))*sqrt((S(ss1)*(1 + S(ss1)))/(15 + 16*S(ss1) + 4*Power(S(ss1),2))))/(1 + S(ss1));
+          case 98: return (sqrt(3)*sqrt(S(ss1)*(1 + S(ss1)))*(sqrt((Power(2 + S(ss1),2)*(3 + 2*S(ss1))*Power(1 + 3*S(ss1) + 2*Power(S(ss1),2),3))/S(ss1)) - 4*Power(1 + S(ss1),1.5)*sqrt((S(ss1)*(1 + 2*S(ss1)))/(3 + 2*S(ss1)))*(2 + 5*S(ss1) + 2*Power(S(ss1),2)) + (Power(1 + S(ss1),1.5)*(2 + 5*S(ss1) + 2*Power(S(ss1),2)))/sqrt((S(ss1)*(3 + 2*S(ss1)))/(1 + 2*S(ss1))) + 3*(2 + 3*S(ss1) + Power(S(ss1),2))*sqrt((Power(1 - 2*S(ss1),2)*S(ss1)*(1 + 2*S(ss1)))/(3 + 5*S(ss1) + 2*Power(S(ss1),2))) - 5*sqrt((S(ss1)*(1 + 2*S(ss1)))/(3 + 5*S(ss1) + 2*Power(S(ss1),2)))*(2 + 7*S(ss1) + 7*Power(S(ss1),2) + 2*Power(S(ss1),3)) + 2*S(ss1)*sqrt((S(ss1)*(1 + 2*S(ss1)))/(3 + 5*S(ss1) + 2*Power(S(ss1),2)))*(2 + 7*S(ss1) + 7*Power(S(ss1),2) + 2*Power(S(ss1),3))))/(2.*(1 + 2*S(ss1))*Power(2 + 3*S(ss1) + Power(S(ss1),2),2));
+          case 99: return -((sqrt(3)*sqrt(1 + S(ss1))*(7*sqrt((5 + 2*S(ss1))/(3 + 2*S(ss1))) - 4*Power(S(ss1),3)*sqrt((5 + 2*S(ss1))/(3 + 2*S(ss1))) + sqrt(15 + 16*S(ss1) + 4*Power(S(ss1),2)) + 2*Power(S(ss1),2)*(-5*sqrt((5 + 2*S(ss1))/(3 + 2*S(ss1))) + sqrt(15 + 16*S(ss1) + 4*Power(S(ss1),2))) + S(ss1)*(-2*sqrt((5 + 2*S(ss1))/(3 + 2*S(ss1))) + 3*sqrt(15 + 16*S(ss1) + 4*Power(S(ss1),2)))))/(Power(5 + 2*S(ss1),1.5)*(2 + 3*S(ss1) + Power(S(ss1),2))));
+          case 100: return (sqrt((1 + S(ss1))*(1 + 2*S(ss1)))*(15*sqrt((2 + S(ss1))/(1 + 3*S(ss1) + 2*Power(S(ss1),2))) + 9*sqrt((2 + 5*S(ss1) + 2*Power(S(ss1),2))/(1 + S(ss1))) + 6*sqrt(2 + 7*S(ss1) + 7*Power(S(ss1),2) + 2*Power(S(ss1),3)) + S(ss1)*sqrt(2 + 7*S(ss1) + 7*Power(S(ss1),2) + 2*Power(S(ss1),3))))/(Power(2 + S(ss1),1.5)*(15 + 11*S(ss1) + 2*Power(S(ss1),2)));
+          default: my_assert_not_reached();
+        }
+      };
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(3, 0));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -282,10 +3078,216 @@ MatrixElements<SC> SymmetrySPSU2T<SC>::recalc_triplet(const DiagInfo<SC> &diag,
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include "spsu2t/spsu2t-tripletm.dat"
+      static constexpr RecalcIndex recalc_index[] = {
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {4, 4},
+        {5, 5},
+        {6, 6},
+        {7, 7},
+        {8, 8},
+        {9, 9},
+        {10, 10},
+        {11, 11},
+        {12, 12},
+        {13, 13},
+        {14, 14},
+        {15, 15},
+        {15, 18},
+        {16, 16},
+        {16, 19},
+        {17, 17},
+        {17, 20},
+        {18, 18},
+        {19, 19},
+        {20, 20},
+        {21, 21},
+        {21, 24},
+        {22, 22},
+        {22, 25},
+        {23, 23},
+        {23, 26},
+        {24, 24},
+        {25, 25},
+        {26, 26},
+        {27, 27},
+        {27, 30},
+        {28, 28},
+        {28, 31},
+        {29, 29},
+        {29, 32},
+        {30, 30},
+        {31, 31},
+        {32, 32},
+        {33, 33},
+        {33, 38},
+        {34, 34},
+        {34, 39},
+        {35, 35},
+        {35, 40},
+        {36, 36},
+        {36, 41},
+        {37, 37},
+        {37, 42},
+        {38, 38},
+        {39, 39},
+        {40, 40},
+        {41, 41},
+        {42, 42},
+        {43, 43},
+        {43, 46},
+        {43, 49},
+        {44, 44},
+        {44, 47},
+        {44, 50},
+        {45, 45},
+        {45, 48},
+        {45, 51},
+        {46, 46},
+        {46, 49},
+        {47, 47},
+        {47, 50},
+        {48, 48},
+        {48, 51},
+        {49, 49},
+        {50, 50},
+        {51, 51},
+        {52, 52},
+        {52, 55},
+        {52, 58},
+        {53, 53},
+        {53, 56},
+        {53, 59},
+        {54, 54},
+        {54, 57},
+        {54, 60},
+        {55, 55},
+        {55, 58},
+        {56, 56},
+        {56, 59},
+        {57, 57},
+        {57, 60},
+        {58, 58},
+        {59, 59},
+        {60, 60},
+        {61, 61},
+        {61, 62},
+        {61, 63},
+        {62, 62},
+        {62, 63},
+        {62, 64},
+        {63, 63},
+        {63, 64},
+        {64, 64}
+      };
+      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {
+        switch (k) {
+          case 0: return 1;
+          case 1: return 1;
+          case 2: return 1;
+          case 3: return 1;
+          case 4: return 1;
+          case 5: return 1;
+          case 6: return 1;
+          case 7: return 1;
+          case 8: return 1;
+          case 9: return 1;
+          case 10: return 1;
+          case 11: return 1;
+          case 12: return 1;
+          case 13: return 1;
+          case 14: return 1;
+          case 15: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 16: return 1;
+          case 17: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 18: return 1;
+          case 19: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 20: return (sqrt((-1 + 2*S(ss1))/(1 + 2*S(ss1))) + sqrt(-1 + 4*Power(S(ss1),2)))/(2.*sqrt(S(ss1)*(1 + S(ss1))));
+          case 21: return (-sqrt(S(ss1)*(1 + S(ss1))) + sqrt(Power(S(ss1),3)*(1 + S(ss1))) + 2*sqrt(Power(S(ss1),5)*(1 + S(ss1))))/(S(ss1)*(1 + S(ss1))*sqrt(-1 + 4*Power(S(ss1),2)));
+          case 22: return sqrt(S(ss1)*(1 + S(ss1))*(-1 + 4*Power(S(ss1),2)))/(S(ss1)*(1 + 2*S(ss1)));
+          case 23: return 1;
+          case 24: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 25: return 1;
+          case 26: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 27: return 1;
+          case 28: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 29: return (sqrt((-1 + 2*S(ss1))/(1 + 2*S(ss1))) + sqrt(-1 + 4*Power(S(ss1),2)))/(2.*sqrt(S(ss1)*(1 + S(ss1))));
+          case 30: return (-sqrt(S(ss1)*(1 + S(ss1))) + sqrt(Power(S(ss1),3)*(1 + S(ss1))) + 2*sqrt(Power(S(ss1),5)*(1 + S(ss1))))/(S(ss1)*(1 + S(ss1))*sqrt(-1 + 4*Power(S(ss1),2)));
+          case 31: return sqrt(S(ss1)*(1 + S(ss1))*(-1 + 4*Power(S(ss1),2)))/(S(ss1)*(1 + 2*S(ss1)));
+          case 32: return 1;
+          case 33: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 34: return 1;
+          case 35: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 36: return 1;
+          case 37: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 38: return (sqrt((-1 + 2*S(ss1))/(1 + 2*S(ss1))) + sqrt(-1 + 4*Power(S(ss1),2)))/(2.*sqrt(S(ss1)*(1 + S(ss1))));
+          case 39: return (-sqrt(S(ss1)*(1 + S(ss1))) + sqrt(Power(S(ss1),3)*(1 + S(ss1))) + 2*sqrt(Power(S(ss1),5)*(1 + S(ss1))))/(S(ss1)*(1 + S(ss1))*sqrt(-1 + 4*Power(S(ss1),2)));
+          case 40: return sqrt(S(ss1)*(1 + S(ss1))*(-1 + 4*Power(S(ss1),2)))/(S(ss1)*(1 + 2*S(ss1)));
+          case 41: return 1;
+          case 42: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 43: return 1;
+          case 44: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 45: return 1;
+          case 46: return 1/sqrt(S(ss1)*(1 + 2*S(ss1)));
+          case 47: return 1;
+          case 48: return ((9*S(ss1)*Power(T,2.5)*(1 + T)*Power(6 + 7*T + 2*Power(T,2),1.5))/sqrt(1 + 2*T) + 3*S(ss1)*Power(T,2)*(1 + T)*sqrt(T*(1 + 2*T))*Power(6 + 7*T + 2*Power(T,2),1.5) + (6*S(ss1)*(1 + T)*Power(T*(6 + 7*T + 2*Power(T,2)),1.5))/sqrt(1 + 2*T) + T*sqrt(Power(S(ss1),2)*Power(T,3)*Power(1 + T,4)*(1 + 2*T)*Power(6 + 7*T + 2*Power(T,2),3)))/sqrt((Power(S(ss1),3)*(1 + 2*S(ss1))*Power(T,3)*Power(1 + T,4)*Power(6 + 7*T + 2*Power(T,2),5))/(1 + 2*T));
+          case 49: return 1;
+          case 50: return (sqrt((1 + 2*T)/(1 + 2*S(ss1)))*(29*T*sqrt(S(ss1)*(5 + 12*T + 4*Power(T,2))) + 13*Power(T,2)*sqrt(S(ss1)*(5 + 12*T + 4*Power(T,2))) + 2*Power(T,3)*sqrt(S(ss1)*(5 + 12*T + 4*Power(T,2))) + 6*(sqrt((S(ss1)*(5 + 2*T))/(1 + 2*T)) + 4*sqrt(S(ss1)*(5 + 12*T + 4*Power(T,2))))))/(S(ss1)*Power(5 + 2*T,1.5)*(6 + 13*T + 9*Power(T,2) + 2*Power(T,3)));
+          case 51: return (sqrt((-1 + 2*S(ss1))/(1 + 2*S(ss1))) + sqrt(-1 + 4*Power(S(ss1),2)))/(2.*sqrt(S(ss1)*(1 + S(ss1))));
+          case 52: return (1/sqrt((S(ss1)*(1 + 3*S(ss1) + 2*Power(S(ss1),2)))/(-1 + 2*S(ss1))) + 1/sqrt((S(ss1)*(1 + S(ss1)))/(-1 + 4*Power(S(ss1),2))))/2.;
+          case 53: return ((-1 + 2*S(ss1))*(sqrt((S(ss1)*(1 + 3*S(ss1) + 2*Power(S(ss1),2)))/(-1 + 2*S(ss1))) + sqrt((S(ss1)*(1 + S(ss1)))/(-1 + 4*Power(S(ss1),2)))))/(2.*S(ss1)*(1 + S(ss1)));
+          case 54: return ((-1 + 2*S(ss1))*(sqrt((S(ss1)*(1 + 3*S(ss1) + 2*Power(S(ss1),2)))/(-1 + 2*S(ss1))) + sqrt((S(ss1)*(1 + S(ss1)))/(-1 + 4*Power(S(ss1),2)))))/(2.*S(ss1)*(1 + S(ss1)));
+          case 55: return (sqrt((S(ss1)*(-1 + S(ss1) + 2*Power(S(ss1),2)))/(1 + 2*S(ss1))) + sqrt(S(ss1)*(-1 - S(ss1) + 4*Power(S(ss1),2) + 4*Power(S(ss1),3))))/(2*S(ss1) + 2*Power(S(ss1),2));
+          case 56: return 1;
+          case 57: return 1/S(ss1);
+          case 58: return 1/(S(ss1) + 2*Power(S(ss1),2));
+          case 59: return 1;
+          case 60: return 1/S(ss1);
+          case 61: return 1/(S(ss1) + 2*Power(S(ss1),2));
+          case 62: return 1;
+          case 63: return 1/S(ss1);
+          case 64: return 1/(S(ss1) + 2*Power(S(ss1),2));
+          case 65: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 66: return sqrt((-1 + 2*S(ss1))/(1 + 2*S(ss1)))/S(ss1);
+          case 67: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 68: return sqrt((-1 + 2*S(ss1))/(1 + 2*S(ss1)))/S(ss1);
+          case 69: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 70: return sqrt((-1 + 2*S(ss1))/(1 + 2*S(ss1)))/S(ss1);
+          case 71: return (sqrt(S(ss1)*(1 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))) + sqrt((S(ss1)*(-1 + 2*S(ss1)))/(1 + 3*S(ss1) + 2*Power(S(ss1),2))) + sqrt((S(ss1)*(-1 + 4*Power(S(ss1),2)))/(1 + S(ss1))))/sqrt(S(ss1)*(1 + 2*S(ss1))*(3 + 5*S(ss1) + 2*Power(S(ss1),2)));
+          case 72: return (sqrt((S(ss1)*(-1 + 2*S(ss1)))/(1 + 3*S(ss1) + 2*Power(S(ss1),2))) + sqrt((S(ss1)*(-1 + 4*Power(S(ss1),2)))/(1 + S(ss1))) + sqrt(S(ss1)*(-1 - S(ss1) + 4*Power(S(ss1),2) + 4*Power(S(ss1),3))))/sqrt(S(ss1)*(1 + 2*S(ss1))*(3 + 5*S(ss1) + 2*Power(S(ss1),2)));
+          case 73: return (sqrt((S(ss1)*(-1 + 2*S(ss1)))/(1 + 3*S(ss1) + 2*Power(S(ss1),2))) + sqrt((S(ss1)*(-1 + 4*Power(S(ss1),2)))/(1 + S(ss1))) + sqrt(S(ss1)*(-1 - S(ss1) + 4*Power(S(ss1),2) + 4*Power(S(ss1),3))))/sqrt(S(ss1)*(1 + 2*S(ss1))*(3 + 5*S(ss1) + 2*Power(S(ss1),2)));
+          case 74: return 1;
+          case 75: return 1/S(ss1);
+          case 76: return 1/(S(ss1) + 2*Power(S(ss1),2));
+          case 77: return 1;
+          case 78: return 1/S(ss1);
+          case 79: return 1/(S(ss1) + 2*Power(S(ss1),2));
+          case 80: return 1;
+          case 81: return 1/S(ss1);
+          case 82: return 1/(S(ss1) + 2*Power(S(ss1),2));
+          case 83: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 84: return sqrt((-1 + 2*S(ss1))/(1 + 2*S(ss1)))/S(ss1);
+          case 85: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 86: return sqrt((-1 + 2*S(ss1))/(1 + 2*S(ss1)))/S(ss1);
+          case 87: return sqrt(-1 + Power(S(ss1),2))/S(ss1);
+          case 88: return sqrt((-1 + 2*S(ss1))/(1 + 2*S(ss1)))/S(ss1);
+          case 89: return (sqrt(S(ss1)*(1 + S(ss1))*(-1 + 2*S(ss1))*(1 + 2*S(ss1))) + sqrt((S(ss1)*(-1 + 2*S(ss1)))/(1 + 3*S(ss1) + 2*Power(S(ss1),2))) + sqrt((S(ss1)*(-1 + 4*Power(S(ss1),2)))/(1 + S(ss1))))/sqrt(S(ss1)*(1 + 2*S(ss1))*(3 + 5*S(ss1) + 2*Power(S(ss1),2)));
+          case 90: return (sqrt((S(ss1)*(-1 + 2*S(ss1)))/(1 + 3*S(ss1) + 2*Power(S(ss1),2))) + sqrt((S(ss1)*(-1 + 4*Power(S(ss1),2)))/(1 + S(ss1))) + sqrt(S(ss1)*(-1 - S(ss1) + 4*Power(S(ss1),2) + 4*Power(S(ss1),3))))/sqrt(S(ss1)*(1 + 2*S(ss1))*(3 + 5*S(ss1) + 2*Power(S(ss1),2)));
+          case 91: return (sqrt((S(ss1)*(-1 + 2*S(ss1)))/(1 + 3*S(ss1) + 2*Power(S(ss1),2))) + sqrt((S(ss1)*(-1 + 4*Power(S(ss1),2)))/(1 + S(ss1))) + sqrt(S(ss1)*(-1 - S(ss1) + 4*Power(S(ss1),2) + 4*Power(S(ss1),3))))/sqrt(S(ss1)*(1 + 2*S(ss1))*(3 + 5*S(ss1) + 2*Power(S(ss1),2)));
+          case 92: return 1;
+          case 93: return sqrt(3)/sqrt(S(ss1)*(-1 + 2*S(ss1)));
+          case 94: return sqrt(3)/(S(ss1)*sqrt(-1 + 4*Power(S(ss1),2)));
+          case 95: return sqrt((3 + S(ss1) - 2*Power(S(ss1),2))/(S(ss1) - 2*Power(S(ss1),2)));
+          case 96: return (2*(sqrt(-((1 + S(ss1))/(1 + S(ss1) - 2*Power(S(ss1),2)))) - 3*S(ss1)*sqrt(-((1 + S(ss1))/(1 + S(ss1) - 2*Power(S(ss1),2)))) + 2*Power(S(ss1),2)*sqrt(-((1 + S(ss1))/(1 + S(ss1) - 2*Power(S(ss1),2)))) + 3*sqrt((-1 + Power(S(ss1),2))/(1 + 2*S(ss1)))))/((1 + S(ss1))*sqrt(S(ss1)*(-1 + 4*Power(S(ss1),2))));
+          case 97: return sqrt(3)/(sqrt(S(ss1)*(1 + S(ss1)))*(1 + 2*S(ss1)));
+          case 98: return (-(S(ss1)*sqrt(((-1 + 2*S(ss1))*(1 + 2*S(ss1))*(3 + 5*S(ss1) + 2*Power(S(ss1),2)))/(-1 + S(ss1)))) + Power(S(ss1),2)*sqrt(((-1 + 2*S(ss1))*(1 + 2*S(ss1))*(3 + 5*S(ss1) + 2*Power(S(ss1),2)))/(-1 + S(ss1))) + 3*sqrt(((1 - 3*S(ss1) + 2*Power(S(ss1),2))*(3 + 5*S(ss1) + 2*Power(S(ss1),2)))/(1 + 2*S(ss1))) - 4*S(ss1)*sqrt((-3 + S(ss1) + 8*Power(S(ss1),2) + 4*Power(S(ss1),3))/(-1 - S(ss1) + 2*Power(S(ss1),2))) + 4*Power(S(ss1),2)*sqrt((-3 + S(ss1) + 8*Power(S(ss1),2) + 4*Power(S(ss1),3))/(-1 - S(ss1) + 2*Power(S(ss1),2))))/(S(ss1)*sqrt(1 + 2*S(ss1))*(3 + 5*S(ss1) + 2*Power(S(ss1),2)));
+          case 99: return (sqrt(3)*(3*sqrt((S(ss1)*(-1 + S(ss1) + 2*Power(S(ss1),2)))/(1 + 2*S(ss1))) + 4*S(ss1)*sqrt((S(ss1)*(-1 + S(ss1) + 2*Power(S(ss1),2)))/(1 + 2*S(ss1))) + sqrt(Power(S(ss1),3)*(-1 - S(ss1) + 4*Power(S(ss1),2) + 4*Power(S(ss1),3)))))/(S(ss1)*Power(1 + S(ss1),1.5)*sqrt(1 + 2*S(ss1))*(3 + 2*S(ss1)));
+          case 100: return (3*(1 + 2*S(ss1))*sqrt((S(ss1)*(-1 + S(ss1) + 2*Power(S(ss1),2)))/(3 + 2*S(ss1))) + 3*sqrt((S(ss1)*(-1 + 2*S(ss1)))/(3 + 5*S(ss1) + 2*Power(S(ss1),2))) + 3*(1 + 2*S(ss1))*sqrt((S(ss1)*(-1 + 2*S(ss1)))/(3 + 5*S(ss1) + 2*Power(S(ss1),2))) + (1 + 2*S(ss1))*sqrt(S(ss1)*(-3 + S(ss1) + 8*Power(S(ss1),2) + 4*Power(S(ss1),3))))/(2.*(1 + S(ss1))*sqrt(S(ss1)*(6 + 19*S(ss1) + 16*Power(S(ss1),2) + 4*Power(S(ss1),3))));
+          default: my_assert_not_reached();
+        }
       };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, Invar(3, 0));
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), Invar(3, 0));
       if (cn) cnew[II] = *cn;
     }
   }
@@ -8,10 +8,8 @@ define(`RECALC_TAB', {
   auto II = Twoinvar(I1, Ip);
   if (diag.count(I1) && diag.count(Ip)) {
     if (diag.at(I1).getnrstored() && diag.at(Ip).getnrstored()) {
-      std::initializer_list<Recalc<SC>> recalc_table = {
-#include $1
-      };
-      auto cn = this->recalc_general(diag, substruct, cold, I1, Ip, recalc_table, $2);
+      `esyscmd'(`awk -f recalc-table.awk coefnew/'$1)
+      auto cn = this->recalc_general(*this, diag, substruct, blocks, I1, Ip, make_recalc_table<SC>(recalc_index, recalc_factor), $2);
       if (cn) cnew[II] = *cn;
     }
   }
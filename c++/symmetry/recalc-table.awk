@@ -0,0 +1,45 @@
+# Converts a table of coefficients for recalc_general() from the coefnew/ directory into C++ code, see RECALC_TAB in
+# recalc-macros.m4. Each input line has the form
+#   { i1, ip, Invar(...), Invar(...), factor},
+# The Invar entries are the ancestor subspaces of I1 and Ip, which are known from SubspaceStructure, thus they are
+# dropped. The output is a constexpr table of the combination indexes (recalc_index) and a functor which evaluates the
+# factor of the k-th entry (recalc_factor). The output is quoted for m4.
+
+BEGIN { n = 0 }
+
+/^[ \t]*$/ { next }
+
+{
+  if ($0 !~ /^\{ *[0-9]+, *[0-9]+, *Invar\([^)]*\), *Invar\([^)]*\), *.*\},[ \t]*$/) {
+    print FILENAME ":" NR ": unexpected table entry: " $0 > "/dev/stderr"
+    exit 1
+  }
+  line = $0
+  sub(/^\{ */, "", line)
+  i1 = line; sub(/,.*/, "", i1)
+  sub(/^[0-9]+, */, "", line)
+  ip = line; sub(/,.*/, "", ip)
+  sub(/^[0-9]+, */, "", line)
+  sub(/^Invar\([^)]*\), */, "", line)
+  sub(/^Invar\([^)]*\), */, "", line)
+  sub(/\},[ \t]*$/, "", line)
+  index_[n] = i1 ", " ip
+  factor[n] = line
+  n++
+}
+
+END {
+  if (n == 0) {
+    print FILENAME ": empty table" > "/dev/stderr"
+    exit 1
+  }
+  print "`static constexpr RecalcIndex recalc_index[] = {"
+  for (k = 0; k < n; k++) print "        {" index_[k] "}" (k < n-1 ? "," : "")
+  print "      };"
+  print "      const auto recalc_factor = [&](const size_t k) -> coef_traits<SC> {"
+  print "        switch (k) {"
+  for (k = 0; k < n; k++) print "          case " k ": return " factor[k] ";"
+  print "          default: my_assert_not_reached();"
+  print "        }"
+  printf "      };'"
+}
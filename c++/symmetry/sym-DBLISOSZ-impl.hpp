@@ -1,7 +1,7 @@
 namespace NRG {
 
 template<typename SC>
-class SymmetryDBLISOSZ : public SymField<SC> {
+class SymmetryDBLISOSZ final : public SymField<SC> {
  private:
    using Symmetry<SC>::P;
    using Symmetry<SC>::In;
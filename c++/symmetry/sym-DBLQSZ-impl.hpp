@@ -1,7 +1,7 @@
 namespace NRG {
 
 template<typename SC>
-class SymmetryDBLQSZ : public SymField<SC> {
+class SymmetryDBLQSZ final : public SymField<SC> {
  private:
    using Symmetry<SC>::P;
    using Symmetry<SC>::In;
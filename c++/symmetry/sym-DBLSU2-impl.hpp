@@ -1,7 +1,7 @@
 namespace NRG {
 
 template<typename SC>
-class SymmetryDBLSU2 : public Symmetry<SC> {
+class SymmetryDBLSU2 final : public Symmetry<SC> {
  private:
    using Symmetry<SC>::P;
    using Symmetry<SC>::In;
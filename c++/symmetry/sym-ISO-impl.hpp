@@ -63,7 +63,7 @@ class SymmetryISOcommon : public Symmetry<SC> {
 };
 
 template<typename SC>
-class SymmetryISO : public SymmetryISOcommon<SC> {
+class SymmetryISO final : public SymmetryISOcommon<SC> {
   private:
    using SymmetryISOcommon<SC>::P;
    using SymmetryISOcommon<SC>::In;
@@ -98,7 +98,7 @@ class SymmetryISO : public SymmetryISOcommon<SC> {
 };
 
 template<typename SC>
-class SymmetryISO2 : public SymmetryISOcommon<SC> {
+class SymmetryISO2 final : public SymmetryISOcommon<SC> {
   private:
    using SymmetryISOcommon<SC>::P;
    using SymmetryISOcommon<SC>::In;
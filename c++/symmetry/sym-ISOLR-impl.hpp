@@ -56,7 +56,7 @@ class SymmetryISOLRcommon : public SymLR<SC> {
 };
 
 template<typename SC>
-class SymmetryISOLR : public SymmetryISOLRcommon<SC> {
+class SymmetryISOLR final : public SymmetryISOLRcommon<SC> {
  private:
    using SymmetryISOLRcommon<SC>::P;
    using SymmetryISOLRcommon<SC>::In;
@@ -79,7 +79,7 @@ class SymmetryISOLR : public SymmetryISOLRcommon<SC> {
 };
 
 template<typename SC>
-class SymmetryISO2LR : public SymmetryISOLRcommon<SC> {
+class SymmetryISO2LR final : public SymmetryISOLRcommon<SC> {
  private:
    using SymmetryISOLRcommon<SC>::P;
    using SymmetryISOLRcommon<SC>::In;
@@ -1,7 +1,7 @@
 namespace NRG {
 
 template<typename SC>
-class SymmetryISOSZ : public SymField<SC> {
+class SymmetryISOSZ final : public SymField<SC> {
   private:
    using Symmetry<SC>::P;
    using Symmetry<SC>::In;
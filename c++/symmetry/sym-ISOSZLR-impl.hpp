@@ -1,7 +1,7 @@
 namespace NRG {
 
 template<typename SC>
-class SymmetryISOSZLR : public SymFieldLR<SC> {
+class SymmetryISOSZLR final : public SymFieldLR<SC> {
  private:
    using Symmetry<SC>::P;
    using Symmetry<SC>::In;
@@ -1,7 +1,7 @@
 namespace NRG {
 
 template<typename SC>
-class SymmetryNONE : public Symmetry<SC> {
+class SymmetryNONE final : public Symmetry<SC> {
   private:
    using Symmetry<SC>::P;
    using Symmetry<SC>::In;
@@ -1,7 +1,7 @@
 namespace NRG {
 
 template<typename SC>
-class SymmetryP : public Symmetry<SC> {
+class SymmetryP final : public Symmetry<SC> {
   private:
    using Symmetry<SC>::P;
    using Symmetry<SC>::In;
@@ -1,7 +1,7 @@
 namespace NRG {
 
 template<typename SC>
-class SymmetryPP : public Symmetry<SC> {
+class SymmetryPP final : public Symmetry<SC> {
  private:
    using Symmetry<SC>::P;
    using Symmetry<SC>::In;
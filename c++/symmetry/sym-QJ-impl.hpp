@@ -3,7 +3,7 @@
 namespace NRG {
 
 template<typename SC>
-class SymmetryQJ : public Symmetry<SC> {
+class SymmetryQJ final : public Symmetry<SC> {
  private:
    using Symmetry<SC>::P;
    using Symmetry<SC>::In;
@@ -1,7 +1,7 @@
 namespace NRG {
 
 template<typename SC>
-class SymmetryQS : public Symmetry<SC> {
+class SymmetryQS final : public Symmetry<SC> {
  private:
    using Symmetry<SC>::P;
    using Symmetry<SC>::In;
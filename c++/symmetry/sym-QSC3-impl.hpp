@@ -1,7 +1,7 @@
 namespace NRG {
 
 template<typename SC>
-class SymmetryQSC3 : public SymC3<SC> {
+class SymmetryQSC3 final : public SymC3<SC> {
  private:
    using Symmetry<SC>::P;
    using Symmetry<SC>::In;
@@ -1,7 +1,7 @@
 namespace NRG {
 
 template<typename SC>
-class SymmetryQSLR : public SymLR<SC> {
+class SymmetryQSLR final : public SymLR<SC> {
  private:
    using Symmetry<SC>::P;
    using Symmetry<SC>::In;
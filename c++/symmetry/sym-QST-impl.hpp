@@ -1,7 +1,7 @@
 namespace NRG {
 
 template<typename SC>
-class SymmetryQST : public Symmetry<SC> {
+class SymmetryQST final : public Symmetry<SC> {
  private:
    using Symmetry<SC>::P;
    using Symmetry<SC>::In;
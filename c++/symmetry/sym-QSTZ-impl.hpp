@@ -1,7 +1,7 @@
 namespace NRG {
 
 template<typename SC>
-class SymmetryQSTZ : public Symmetry<SC> {
+class SymmetryQSTZ final : public Symmetry<SC> {
  private:
    using Symmetry<SC>::P;
    using Symmetry<SC>::In;
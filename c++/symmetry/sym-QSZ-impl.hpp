@@ -1,7 +1,7 @@
 namespace NRG {
 
 template<typename SC>
-class SymmetryQSZ : public SymField<SC> {
+class SymmetryQSZ final : public SymField<SC> {
  private:
    using Symmetry<SC>::P;
    using Symmetry<SC>::In;
@@ -1,7 +1,7 @@
 namespace NRG {
 
 template<typename SC>
-class SymmetryQSZLR : public SymFieldLR<SC> {
+class SymmetryQSZLR final : public SymFieldLR<SC> {
  private:
    using Symmetry<SC>::P;
    using Symmetry<SC>::In;
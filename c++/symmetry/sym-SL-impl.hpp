@@ -1,7 +1,7 @@
 namespace NRG {
 
 template<typename SC>
-class SymmetrySL : public Symmetry<SC> {
+class SymmetrySL final : public Symmetry<SC> {
  private:
    using Symmetry<SC>::P;
    using Symmetry<SC>::In;
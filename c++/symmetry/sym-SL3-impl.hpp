@@ -1,7 +1,7 @@
 namespace NRG {
 
 template<typename SC>
-class SymmetrySL3 : public Symmetry<SC> {
+class SymmetrySL3 final : public Symmetry<SC> {
   private:
    using Symmetry<SC>::P;
    using Symmetry<SC>::In;
@@ -1,7 +1,7 @@
 namespace NRG {
 
 template<typename SC>
-class SymmetrySPSU2C3 : public SymC3<SC> {
+class SymmetrySPSU2C3 final : public SymC3<SC> {
  private:
    using Symmetry<SC>::P;
    using Symmetry<SC>::In;
@@ -1,7 +1,7 @@
 namespace NRG {
 
 template<typename SC>
-class SymmetrySPSU2LR : public SymLR<SC> {
+class SymmetrySPSU2LR final : public SymLR<SC> {
  private:
    using Symmetry<SC>::P;
    using Symmetry<SC>::In;
@@ -1,7 +1,7 @@
 namespace NRG {
 
 template<typename SC>
-class SymmetrySPU1 : public  SymField<SC> {
+class SymmetrySPU1 final : public  SymField<SC> {
  private:
    using Symmetry<SC>::P;
    using Symmetry<SC>::In;
@@ -1,7 +1,7 @@
 namespace NRG {
 
 template<typename SC>
-class SymmetrySPU1LR : public SymFieldLR<SC> {
+class SymmetrySPU1LR final : public SymFieldLR<SC> {
  private:
    using Symmetry<SC>::P;
    using Symmetry<SC>::In;
@@ -1,7 +1,7 @@
 namespace NRG {
 
 template<typename SC>
-class SymmetryU1 : public Symmetry<SC> {
+class SymmetryU1 final : public Symmetry<SC> {
  private:
    using Symmetry<SC>::P;
    using Symmetry<SC>::In;
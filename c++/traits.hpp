@@ -29,6 +29,10 @@ template <scalar S> auto size1(const Eigen::Block<EigenMatrix<S>> &m) { return m
 template <scalar S> auto size2(const Eigen::Block<EigenMatrix<S>> &m) { return m.cols(); }
 template <scalar S> auto size1(const Eigen::Block<const EigenMatrix<S>> &m) { return m.rows(); }
 template <scalar S> auto size2(const Eigen::Block<const EigenMatrix<S>> &m) { return m.cols(); }
+template <scalar S> size_t size1(const Eigen::Map<const EigenMatrix<S>> &m) { return m.rows(); } // memory-mapped, see block_file.hpp
+template <scalar S> size_t size2(const Eigen::Map<const EigenMatrix<S>> &m) { return m.cols(); }
+template <scalar S> auto size1(const Eigen::Block<const Eigen::Map<const EigenMatrix<S>>> &m) { return m.rows(); }
+template <scalar S> auto size2(const Eigen::Block<const Eigen::Map<const EigenMatrix<S>>> &m) { return m.cols(); }
 
 template <typename T>
   concept matrix = requires(T a, T b, size_t i, size_t j) {
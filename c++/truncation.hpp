@@ -2,6 +2,7 @@
 #define _truncation_hpp_
 
 #include <algorithm> // clamp
+#include <vector>
 
 #include "step.hpp"
 #include "eigen.hpp"
@@ -62,7 +63,10 @@ struct truncate_stats {
   void report() { std::cout << nrgdump4(nrkept, nrkeptmult, nrall, nrallmult) << std::endl; }
 };
 
-struct NotEnough : public std::exception {};
+struct NotEnough : public std::exception {
+  std::vector<Invar> subspaces; // subspaces with an insufficient number of computed states
+  explicit NotEnough(std::vector<Invar> subspaces) : subspaces(std::move(subspaces)) {}
+};
 
 // Compute the number of states to keep in each subspace. Returns true if an insufficient number of states has been
 // obtained in the diagonalization and we need to compute more states.
@@ -76,11 +80,12 @@ void truncate_prepare(const Step &step, DiagInfo<S> &diag, MF mult, const Params
   std::cout << "Emax=" << Emax / step.unscale() << " ";
   truncate_stats ts(diag, mult);
   ts.report();
-  if (ranges::any_of(diag, [Emax](const auto &d) {
-        const auto &[I, eig] = d;
-        return eig.getnrkept() == eig.getnrcomputed() && eig.values.highest_corr() != Emax && eig.getnrcomputed() < eig.getdim();
-      }))
-    throw NotEnough();
+  std::vector<Invar> insufficient;
+  for (const auto &[I, eig] : diag)
+    if (eig.getnrkept() == eig.getnrcomputed() && eig.values.highest_corr() != Emax && eig.getnrcomputed() < eig.getdim())
+      insufficient.push_back(I);
+  if (!insufficient.empty())
+    throw NotEnough(std::move(insufficient));
   const double ratio = double(ts.nrkept) / ts.nrall;
   fmt::print(FMT_STRING("Kept: {} out of {}, ratio={:.3}\n"), ts.nrkept, ts.nrall, ratio);
 }
@@ -4,10 +4,23 @@
 #include <memory>
 #include <string>
 #include <optional>
+#include <map>
+#include <set>
+#include <mutex>
+#include <condition_variable>
+#include <vector>
+#include <exception>
+#include <functional>
+#include <sstream>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
 #include <cstring> // strncpy
 #include <cstdlib> // mkdtemp, getenv
 #include "portabil.hpp" // remove(std::string)
+#include "file_data.hpp"
 #include <cstdio> // C remove()
+#include <fmt/format.h>
 
 namespace NRG {
 
@@ -29,15 +42,126 @@ inline auto dtemp(const std::string &path, const std::string &pattern = "/XXXXXX
 // Note: This will remove a directory only if it is empty!
 inline int remove(const std::string &filename) { return std::remove(filename.c_str()); }
 
+// Bytes of the workdir files written and read, split between the in-memory cache and the disk. The disk reads are
+// the sizes of the mapped files; the pages which are not accessed are never actually read.
+struct WorkdirStats {
+  size_t mem_written = 0, disk_written = 0, mem_read = 0, disk_read = 0;
+  size_t spilled = 0;    // bytes moved from memory to disk to make room for newer files
+  size_t peak = 0;       // maximal amount of data held in memory
+  void report(std::ostream &F = std::cout) const {
+    constexpr double MB = 1024.0 * 1024.0;
+    F << fmt::format("[workdir] written: memory={:.1f} MB disk={:.1f} MB; read: memory={:.1f} MB disk={:.1f} MB; "
+                     "spilled={:.1f} MB; peak={:.1f} MB", mem_written/MB, disk_written/MB, mem_read/MB, disk_read/MB,
+                     spilled/MB, peak/MB) << std::endl;
+  }
+};
+
+// All unitaryN, rhoN and rhoFDMN files are written and read through write() and read(). With a nonzero memory
+// budget (parameter workdirmem), the files are kept in memory as long as they fit. When room is needed, the least
+// recently used files are spilled to disk. The files still held in memory at exit are written to disk, so that the
+// contents of the workdir are the same as without the cache (e.g. for removefiles=false or resume). The methods may
+// be called concurrently from the I/O thread, see AsyncStepIO. The disk writes are done without holding the lock:
+// the files being spilled are moved to 'spilling', where they can still be read, and writes or removals of such a
+// file wait until the spill is complete. Likewise, the older disk version of a file written to memory is removed
+// after the lock is released; meanwhile, the new version is 'pinned' in memory. Files are written under a temporary name and then renamed, so that a file
+// which is still mapped by a reader (see MappedFile) is never truncated.
 class Workdir {
  private:
    const std::string workdir {};
    bool remove_at_exit {true}; // XXX: tie to P.removefiles?
+   struct Entry {
+     std::shared_ptr<const std::string> data;
+     size_t used; // LRU stamp
+   };
+   using Spill = std::pair<std::string, std::shared_ptr<const std::string>>;
+   mutable std::mutex mtx;
+   std::condition_variable spilled;
+   size_t budget = 0, cached = 0, clock = 0;
+   std::map<std::string, Entry> mem;
+   std::map<std::string, std::shared_ptr<const std::string>> spilling; // being written to disk
+   std::set<std::string> pinned; // in memory, older disk version still being removed
+   WorkdirStats stats;
+   static void write_file(const std::string &fn, const std::function<void(std::ostream &)> &writer) {
+     const auto tmp = fn + ".tmp";
+     {
+       std::ofstream F(tmp, std::ios::binary | std::ios::out);
+       if (!F) throw std::runtime_error(fmt::format("Can't open file {} for writing.", tmp));
+       writer(F);
+       F.close();
+       if (F.fail()) {
+         NRG::remove(tmp);
+         throw std::runtime_error(fmt::format("Error writing {}", tmp));
+       }
+     }
+     if (std::rename(tmp.c_str(), fn.c_str()) != 0) {
+       NRG::remove(tmp);
+       throw std::runtime_error(fmt::format("Can't rename {} to {}", tmp, fn));
+     }
+   }
+   static void write_file(const std::string &fn, const std::string &data) {
+     write_file(fn, [&data](std::ostream &F) { F.write(data.data(), std::streamsize(data.size())); });
+   }
+   void wait_spilled(std::unique_lock<std::mutex> &lock, const std::string &fn) {
+     spilled.wait(lock, [this, &fn] { return !spilling.count(fn) && !pinned.count(fn); });
+   }
+   void drop(const std::string &fn) { // with the lock held
+     if (auto it = mem.find(fn); it != mem.end()) {
+       cached -= it->second.data->size();
+       mem.erase(it);
+     }
+   }
+   // Select the least recently used files to be spilled, with the lock held. The caller writes them using spill()
+   // after releasing the lock.
+   std::vector<Spill> make_room(const size_t size) {
+     std::vector<Spill> victims;
+     while (cached + size > budget) {
+       auto lru = mem.end();
+       for (auto it = mem.begin(); it != mem.end(); ++it)
+         if (!pinned.count(it->first) && (lru == mem.end() || it->second.used < lru->second.used)) lru = it;
+       if (lru == mem.end()) break;
+       victims.emplace_back(lru->first, lru->second.data);
+       spilling[lru->first] = lru->second.data;
+       cached -= lru->second.data->size();
+       mem.erase(lru);
+     }
+     return victims;
+   }
+   // Write the files to disk, without the lock held. A file which can't be written is returned to memory. The files
+   // written at flush() are not counted as spilled.
+   void spill(const std::vector<Spill> &victims, const bool count = true) {
+     std::exception_ptr error;
+     for (const auto &[fn, data] : victims) {
+       bool ok = true;
+       try {
+         write_file(fn, *data);
+       } catch (...) {
+         if (!error) error = std::current_exception();
+         ok = false;
+       }
+       {
+         std::lock_guard lock(mtx);
+         spilling.erase(fn);
+         if (!ok) {
+           cached += data->size();
+           mem[fn] = {data, ++clock};
+         } else if (count) {
+           stats.spilled += data->size();
+         }
+       }
+       spilled.notify_all();
+     }
+     if (error) std::rethrow_exception(error);
+   }
  public:
    explicit Workdir(const std::string &dir, const bool quiet = false) : workdir(dtemp(dir).value_or(default_workdir)) {
      if (!quiet) std::cout << "workdir=" << workdir << std::endl << std::endl;
    }
    explicit Workdir() : Workdir(default_workdir, true) {} // defaulted version (for testing purposes)
+   // Use the directory as it is, without creating a unique subdirectory, and leave it in place at exit. For processes
+   // which never write the workdir files, e.g. the MPI slaves.
+   struct existing_t {};
+   static constexpr existing_t existing{};
+   Workdir(existing_t, const std::string &dir) : workdir(dir), remove_at_exit(false) {}
    Workdir(const Workdir &) = delete;
    Workdir(Workdir &&) = delete;
    Workdir & operator=(const Workdir &) = delete;
@@ -49,10 +173,137 @@ class Workdir {
    [[nodiscard]] auto unitaryfn(const size_t N, const std::string &filename = "unitary"s) const { // eigenstates files
      return workdir + "/" + filename + std::to_string(N);
    }
+   void set_memory_budget(const size_t bytes) {
+     std::vector<Spill> victims;
+     {
+       std::lock_guard lock(mtx);
+       budget = bytes;
+       victims = make_room(0);
+     }
+     spill(victims);
+   }
+   [[nodiscard]] size_t memory_budget() const {
+     std::lock_guard lock(mtx);
+     return budget;
+   }
+   // Files larger than the budget are written directly to disk. size_hint is the expected file size, used to avoid
+   // serializing such files into memory first.
+   void write(const std::string &fn, const size_t size_hint, const std::function<void(std::ostream &)> &writer) {
+     if (const auto b = memory_budget(); b && size_hint <= b) {
+       std::ostringstream ss;
+       writer(ss);
+       if (!ss) throw std::runtime_error(fmt::format("Error writing {}", fn));
+       auto data = std::make_shared<const std::string>(std::move(ss).str());
+       std::vector<Spill> victims;
+       bool cache = false;
+       {
+         std::unique_lock lock(mtx);
+         wait_spilled(lock, fn);
+         drop(fn);
+         if (data->size() <= budget) { // otherwise size_hint was too small
+           victims = make_room(data->size());
+           cached += data->size();
+           stats.mem_written += data->size();
+           stats.peak = std::max(stats.peak, cached);
+           mem[fn] = {data, ++clock};
+           pinned.insert(fn);
+           cache = true;
+         }
+       }
+       if (cache) {
+         NRG::remove(fn); // older version on disk, if any
+         {
+           std::lock_guard lock(mtx);
+           pinned.erase(fn);
+         }
+         spilled.notify_all();
+         spill(victims);
+         return;
+       }
+       write_file(fn, *data);
+       std::lock_guard lock(mtx);
+       stats.disk_written += data->size();
+       return;
+     }
+     {
+       std::unique_lock lock(mtx);
+       wait_spilled(lock, fn);
+       drop(fn);
+     }
+     write_file(fn, writer);
+     std::ifstream F(fn, std::ios::binary | std::ios::ate);
+     std::lock_guard lock(mtx);
+     stats.disk_written += size_t(F.tellg());
+   }
+   // The data remains valid even if the file is spilled or removed in the meantime.
+   [[nodiscard]] std::shared_ptr<const FileData> read(const std::string &fn) {
+     {
+       std::lock_guard lock(mtx);
+       if (auto it = mem.find(fn); it != mem.end()) {
+         it->second.used = ++clock;
+         stats.mem_read += it->second.data->size();
+         return std::make_shared<MemoryFile>(fn, it->second.data);
+       }
+       if (auto it = spilling.find(fn); it != spilling.end()) {
+         stats.mem_read += it->second->size();
+         return std::make_shared<MemoryFile>(fn, it->second);
+       }
+     }
+     auto file = std::make_shared<MappedFile>(fn);
+     std::lock_guard lock(mtx);
+     stats.disk_read += file->size();
+     return file;
+   }
+   [[nodiscard]] bool exists(const std::string &fn) const {
+     {
+       std::lock_guard lock(mtx);
+       if (mem.count(fn) || spilling.count(fn)) return true;
+     }
+     std::ifstream F(fn);
+     return F.good();
+   }
+   // Returns 0 on success, like std::remove()
+   int remove(const std::string &fn) {
+     {
+       std::unique_lock lock(mtx);
+       wait_spilled(lock, fn);
+       if (mem.count(fn)) {
+         drop(fn);
+         return 0;
+       }
+     }
+     return NRG::remove(fn);
+   }
+   [[nodiscard]] WorkdirStats statistics() const {
+     std::lock_guard lock(mtx);
+     return stats;
+   }
+   void report(std::ostream &F = std::cout) const { statistics().report(F); }
+   void flush() { // write the files held in memory to disk
+     std::vector<Spill> victims;
+     {
+       std::unique_lock lock(mtx);
+       spilled.wait(lock, [this] { return pinned.empty(); });
+       for (const auto &[fn, entry] : mem) {
+         victims.emplace_back(fn, entry.data);
+         spilling[fn] = entry.data;
+       }
+       mem.clear();
+       cached = 0;
+     }
+     spill(victims, false);
+     std::unique_lock lock(mtx);
+     spilled.wait(lock, [this] { return spilling.empty(); }); // spills started by other threads
+   }
    void remove_workdir() {
      if (workdir != "") NRG::remove(workdir);
    }
   ~Workdir() {
+    try {
+      flush();
+    } catch (const std::exception &e) {
+      std::cerr << "Workdir: " << e.what() << std::endl;
+    }
     if (remove_at_exit) remove_workdir();
   }
 };
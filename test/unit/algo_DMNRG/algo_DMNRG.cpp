@@ -0,0 +1,44 @@
+#include <complex>
+#include <gtest/gtest.h>
+
+#include <traits.hpp>
+#include <eigen.hpp>
+#include <algo_DMNRG.hpp>
+
+using namespace NRG;
+
+// dmnrg_contractions() against the scalar sums over the kept states which it replaced in Algo_DMNRG::calc(). The
+// weights are also summed in the original loop order (rm outer, rj inner) and in the new one (rj outer, rm inner).
+template<scalar S> void check_contractions() {
+  using Matrix = Matrix_traits<S>;
+  Eigen<S> diagIp(5, 5), diagI1(4, 4);
+  diagIp.truncate_prepare(3);
+  diagI1.truncate_prepare(2);
+  const Matrix op1 = Matrix::Random(4, 5), op2 = Matrix::Random(4, 5);
+  const Matrix rhoNIp = Matrix::Random(5, 5), rhoNI1 = Matrix::Random(4, 4);
+  const auto [A, B] = dmnrg_contractions(diagIp, diagI1, op1, op2, rhoNIp, rhoNI1);
+  S total_old{}, total_new{};
+  for (const auto rm : diagIp.kept())
+    for (const auto rj : diagI1.kept()) {
+      S sumA{};
+      for (const auto ri : diagIp.kept()) sumA += op2(rj, ri) * rhoNIp(rm, ri);
+      S sumB{};
+      for (const auto ri : diagI1.kept()) sumB += conj_me(op1(ri, rm)) * rhoNI1(rj, ri);
+      EXPECT_NEAR(std::abs(A(rj, rm) - sumA), 0.0, 1e-14);
+      EXPECT_NEAR(std::abs(B(rj, rm) - sumB), 0.0, 1e-14);
+      total_old += sumA * conj_me(op1(rj, rm)) - sumB * op2(rj, rm);
+    }
+  for (const auto rj : diagI1.kept())
+    for (const auto rm : diagIp.kept())
+      total_new += A(rj, rm) * conj_me(op1(rj, rm)) - B(rj, rm) * op2(rj, rm);
+  EXPECT_NEAR(std::abs(total_new - total_old), 0.0, 1e-13);
+}
+
+TEST(algo_DMNRG, contractions_real) { check_contractions<double>(); } // NOLINT
+
+TEST(algo_DMNRG, contractions_complex) { check_contractions<std::complex<double>>(); } // NOLINT
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS(); // NOLINT
+}
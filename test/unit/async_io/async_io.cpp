@@ -0,0 +1,46 @@
+#include <string>
+#include <vector>
+#include <stdexcept>
+#include <gtest/gtest.h>
+
+#include <async_io.hpp>
+
+using namespace NRG;
+
+TEST(AsyncIO, IOThread) { // NOLINT
+  std::vector<int> out;
+  {
+    IOThread io(1);
+    for (int i = 0; i < 10; i++) io.submit([&out, i] { out.push_back(i); });
+  } // pending tasks completed
+  ASSERT_EQ(out.size(), 10);
+  for (int i = 0; i < 10; i++) EXPECT_EQ(out[i], i); // FIFO
+}
+
+TEST(AsyncIO, AsyncStepIO) { // NOLINT
+  for (const auto enabled : {true, false}) {
+    AsyncStepIO<std::vector<int>> io([](const size_t N) {
+      if (N == 99) throw std::runtime_error("load failed");
+      return std::vector<int>(N, 1);
+    }, enabled);
+    EXPECT_EQ(io.get(5).size(), 5); // miss
+    io.prefetch(4);
+    EXPECT_EQ(io.get(4).size(), 4);
+    io.prefetch(99);
+    EXPECT_THROW(io.get(99), std::runtime_error);
+    std::vector<int> out;
+    for (int i = 0; i < 5; i++) io.write([&out, i] { out.push_back(i); });
+    io.flush();
+    EXPECT_EQ(out.size(), 5);
+    const auto &s = io.statistics();
+    EXPECT_EQ(s.misses, enabled ? 1 : 2); // failed loads are not counted
+    EXPECT_EQ(s.hits + s.stalls, enabled ? 2 : 0);
+    EXPECT_EQ(s.writes, 5);
+    s.report(enabled ? "async" : "sync");
+  }
+}
+
+int main(int argc, char **argv) {
+   ::testing::InitGoogleTest(&argc, argv);
+   return RUN_ALL_TESTS(); // NOLINT
+}
@@ -0,0 +1,138 @@
+#include <string>
+#include <vector>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <cmath>
+#include <cstring>
+#include <cstdint>
+#include <gtest/gtest.h>
+
+#include <traits.hpp>
+#include <block_file.hpp>
+
+using namespace NRG;
+
+TEST(Compression, codec_from_string) { // NOLINT
+  EXPECT_EQ(codec_from_string("none"), Codec::none);
+  EXPECT_EQ(codec_from_string("lossless"), Codec::lossless);
+  EXPECT_EQ(codec_from_string("float32"), Codec::float32);
+  EXPECT_THROW(codec_from_string("zip"), std::invalid_argument);
+  EXPECT_EQ(to_string(Codec::float32), "float32");
+}
+
+TEST(Compression, shuffle) { // NOLINT
+  const std::string in = "abcdefgh";
+  std::string out(in.size(), ' '), back(in.size(), ' ');
+  byte_shuffle(in.data(), out.data(), 4, 2);
+  EXPECT_EQ(out, "acegbdfh");
+  byte_unshuffle(out.data(), back.data(), 4, 2);
+  EXPECT_EQ(back, in);
+}
+
+TEST(Compression, lossless) { // NOLINT
+  std::vector<double> x(1000);
+  for (size_t i = 0; i < x.size(); i++) x[i] = std::sin(double(i)) * std::exp(-double(i) / 100.0);
+  const auto c = compress(x.data(), x.size(), Codec::lossless);
+  EXPECT_LT(c.size(), x.size() * sizeof(double));
+  std::vector<double> y(x.size());
+  decompress(c.data(), c.size(), y.data(), y.size(), Codec::lossless);
+  EXPECT_EQ(x, y);
+  EXPECT_THROW(decompress(c.data(), c.size() / 2, y.data(), y.size(), Codec::lossless), std::runtime_error);
+}
+
+TEST(Compression, float32) { // NOLINT
+  std::vector<double> x = {0.0, 1.0, -1.0 / 3.0, 1e-10, 1e-40, 0.123456789};
+  const auto c = compress(x.data(), x.size(), Codec::float32);
+  std::vector<double> y(x.size());
+  decompress(c.data(), c.size(), y.data(), y.size(), Codec::float32);
+  for (size_t i = 0; i < x.size(); i++)
+    EXPECT_LE(std::abs(x[i] - y[i]), std::max(std::ldexp(std::abs(x[i]), -24), std::ldexp(1.0, -150)));
+  const std::vector<double> big = {1e300};
+  EXPECT_THROW(compress(big.data(), big.size(), Codec::float32), std::runtime_error);
+}
+
+TEST(Compression, chunks) { // NOLINT
+  std::string in(100000, '\0');
+  for (size_t i = 0; i < in.size(); i++) in[i] = char(i % 7 == 0 ? i % 251 : 0);
+  const auto c = deflate_bytes(in.data(), in.size(), 1000); // many input and output chunks
+  EXPECT_LT(c.size(), in.size());
+  std::string out(in.size(), ' ');
+  inflate_bytes(c.data(), c.size(), out.data(), out.size(), 1000);
+  EXPECT_EQ(out, in);
+  EXPECT_THROW(inflate_bytes(c.data(), c.size() - 1, out.data(), out.size(), 1000), std::runtime_error);
+  EXPECT_THROW(inflate_bytes(c.data(), c.size(), out.data(), out.size() - 1, 1000), std::runtime_error);
+}
+
+TEST(Compression, planes) { // NOLINT
+  const size_t n = 1000;
+  std::string in(2 * n, '\0'); // plane 0 constant, plane 1 pseudo-random
+  uint32_t r = 1;
+  for (size_t i = 0; i < n; i++) in[n + i] = char((r = r * 1664525 + 1013904223) >> 24);
+  std::vector<PlaneCoder> coders = {PlaneCoder::zlib};
+#ifdef NRG_ZSTD
+  coders.push_back(PlaneCoder::zstd);
+#endif
+  for (const auto coder : coders) {
+    const auto c = compress_planes(in.data(), n, 2, coder);
+    uint64_t header[3]; // coder, plane sizes
+    std::memcpy(header, c.data(), sizeof(header));
+    EXPECT_EQ(header[0], uint64_t(coder));
+    EXPECT_LT(header[1], n);
+    EXPECT_EQ(header[2], n); // stored as is
+    std::string out(in.size(), ' ');
+    decompress_planes(c.data(), c.size(), out.data(), n, 2);
+    EXPECT_EQ(out, in);
+  }
+}
+
+template <scalar S> auto round_trip(const std::vector<const EigenMatrix<S> *> &blocks, const Codec codec) {
+  std::ostringstream ss;
+  write_block_file<S>(ss, "meta", blocks, codec);
+  return BlockFile<S>(std::make_shared<MemoryFile>("test", std::make_shared<const std::string>(ss.str())));
+}
+
+TEST(Compression, BlockFile) { // NOLINT
+  const EigenMatrix<double> m1 = EigenMatrix<double>::Random(7, 5), m2 = EigenMatrix<double>::Identity(20, 20);
+  const std::vector<const EigenMatrix<double> *> blocks = {&m1, &m2};
+  for (const auto codec : {Codec::none, Codec::lossless, Codec::float32}) {
+    const auto file = round_trip<double>(blocks, codec);
+    EXPECT_EQ(file.codec(), codec);
+    EXPECT_EQ(file.metadata(), "meta");
+    EXPECT_EQ(file.size(), 2);
+    EXPECT_EQ(file[1], m2);
+    if (codec == Codec::float32)
+      EXPECT_LE((file[0] - m1).cwiseAbs().maxCoeff(), std::ldexp(1.0, -24));
+    else
+      EXPECT_EQ(file[0], m1);
+    if (codec == Codec::none)
+      EXPECT_EQ(file.compression_ratio(), 1.0);
+    else
+      EXPECT_GT(file.compression_ratio(), 1.0);
+  }
+  EXPECT_THROW(BlockFile<std::complex<double>>(std::make_shared<MemoryFile>("test", std::make_shared<const std::string>(""))),
+               std::runtime_error); // truncated
+}
+
+TEST(Compression, BlockFileLazy) { // NOLINT
+  const EigenMatrix<double> m1 = EigenMatrix<double>::Random(30, 20), m2 = EigenMatrix<double>::Random(10, 40);
+  const auto file = round_trip<double>({&m1, &m2}, Codec::lossless);
+  EXPECT_EQ(file.rows(1), 10);
+  EXPECT_EQ(file.cols(1), 40);
+  EXPECT_EQ(file.copy(1), m2);
+  EXPECT_EQ(file[1], m2);
+  EXPECT_EQ(file[1].data(), file[1].data()); // decompressed once
+  EXPECT_EQ(file.copy(0), m1);
+  EXPECT_EQ(file[0], m1);
+}
+
+TEST(Compression, BlockFileComplex) { // NOLINT
+  const EigenMatrix<std::complex<double>> m = EigenMatrix<std::complex<double>>::Random(6, 6);
+  const auto file = round_trip<std::complex<double>>({&m}, Codec::lossless);
+  EXPECT_EQ(file[0], m);
+}
+
+int main(int argc, char **argv) {
+   ::testing::InitGoogleTest(&argc, argv);
+   return RUN_ALL_TESTS(); // NOLINT
+}
@@ -319,6 +319,64 @@ TEST(Diag, diagonalise_complex) {
   }
 }
 
+TEST(Diag, diagonalise_twophase) {
+  Params P;
+  auto DP = DiagParams(P);
+  Matrix_traits<double> m0(3,3);
+  m0(0,0) = 1.0; m0(1,1) = 2.0; m0(2,2) = 3.0;
+  m0(0,1) = m0(0,2) = m0(1,2) = 0.5;
+  m0(1,0) = m0(2,0) = m0(2,1) = 0.0;
+  auto m = m0;
+  const auto ref = diagonalise(m, DP, -1);
+  {
+    DP.jobz = 'N'; // eigenvalues only
+    auto m = m0;
+    const auto res = diagonalise(m, DP, -1);
+    EXPECT_EQ(res.getnrcomputed(), 3);
+    EXPECT_EQ(res.getdim(), 3);
+    EXPECT_EQ(size1(res.vec), 0);
+    for (const auto i : range0(3))
+      EXPECT_NEAR(res.val[i], ref.val[i], 1e-14);
+  }
+  {
+    DP.jobz = 'V';
+    auto m = m0;
+    const auto res = diagonalise(m, DP, -1, 2); // two lowest eigenpairs
+    EXPECT_EQ(res.getnrcomputed(), 2);
+    EXPECT_EQ(res.getdim(), 3);
+    for (const auto i : range0(2)) {
+      EXPECT_NEAR(res.val[i], ref.val[i], 1e-14);
+      EXPECT_NEAR(abs(res.vec.row(i).dot(ref.vec.row(i))), 1.0, 1e-14);
+    }
+  }
+}
+
+TEST(Diag, workspace) {
+  Matrix_traits<double> m0(3,3);
+  m0(0,0) = 1.0; m0(1,1) = 2.0; m0(2,2) = 3.0;
+  m0(0,1) = m0(0,2) = m0(1,2) = 0.5;
+  m0(1,0) = m0(2,0) = m0(2,1) = 0.0;
+  auto m = m0;
+  const auto ref = diagonalise_dsyevr(m);
+  workspace_stats.reset();
+  m = m0;
+  const auto res = diagonalise_dsyevr(m); // same size: no new allocations, no workspace query
+  EXPECT_EQ(workspace_stats.allocated, 0);
+  EXPECT_GT(workspace_stats.reused, 0);
+  EXPECT_EQ(workspace_stats.queries, 0);
+  EXPECT_EQ(workspace_stats.cached, 1);
+  for (const auto i : range0(3)) {
+    EXPECT_EQ(res.val[i], ref.val[i]);
+    EXPECT_EQ(res.vec.row(i), ref.vec.row(i));
+  }
+  Matrix_traits<double> m1(4,4);
+  m1.setZero();
+  m1(0,0) = 1.0; m1(1,1) = 2.0; m1(2,2) = 3.0; m1(3,3) = 4.0;
+  diagonalise_dsyevr(m1); // larger matrix: buffers grow
+  EXPECT_GT(workspace_stats.allocated, 0);
+  EXPECT_EQ(workspace_stats.queries, 1);
+}
+
 int main(int argc, char **argv) {
    ::testing::InitGoogleTest(&argc, argv);
    return RUN_ALL_TESTS(); // NOLINT
@@ -101,6 +101,31 @@ TEST(io, read_std_vector) { // NOLINT
   VECTOR_EQ(vec, ref);
 }
 
+TEST(Blocks, views) { // NOLINT
+  EigenMatrix<double> m(2,3);
+  m << 1, 0, 0,
+       0, 0, 1;
+  const auto storage = m.data();
+  Vectors<double> vec;
+  vec.set(std::move(m));
+  const auto mm = vec.release();
+  EXPECT_EQ(mm.data(), storage); // no copy
+  EXPECT_EQ(vec.M(), 0);
+  EXPECT_EQ(vec.dim(), 3);
+  Blocks<double> U;
+  U.set(mm, {{0,1}, {1,3}});
+  EXPECT_EQ(U.size(), 2);
+  EXPECT_TRUE(U.is_unitary());
+  EXPECT_EQ(U(1).rows(), 2);
+  EXPECT_EQ(U(1).cols(), 1);
+  EXPECT_EQ(U(2).cols(), 2);
+  EXPECT_EQ(U(2)(1,1), 1.0);
+  EXPECT_EQ(U(2).data(), U(1).data() + 1); // strided views into the same matrix
+  U.truncate(1);
+  EXPECT_EQ(U(2).rows(), 1);
+  EXPECT_EQ(U(2)(0,0), 0.0);
+}
+
 template<typename T>
 auto range_size(T t)
 {
@@ -136,6 +161,40 @@ TEST(Diag, constructor) { // NOLINT
 //  diag.save(3, P);
 }
 
+TEST(Diag, UnitaryFile) { // NOLINT
+  Params P;
+  [[maybe_unused]] auto Sym = setup_Sym<double>(P); // need working Invar
+  DiagInfo<double> diag;
+  diag[Invar(0,1)] = NRG::Eigen<double>(2,2);
+  diag[Invar(0,1)].diagonal({1.0, 2.0});
+  EigenMatrix<double> m(3,3);
+  m << 0, 1, 0,
+       1, 0, 0,
+       0, 0, 1;
+  diag[Invar(1,2)].values.set({3.0, 4.0, 5.0});
+  diag[Invar(1,2)].vectors.set(m);
+  auto &workdir = *P.workdir;
+  UnitaryFile<double>::save(workdir, "unitary_test", diag); // no memory budget, saved to disk
+  const UnitaryFile<double> file(workdir.read("unitary_test"));
+  EXPECT_EQ(range_size(file.subspaces()), 2);
+  EXPECT_TRUE(file.contains(Invar(1,2)));
+  EXPECT_FALSE(file.contains(Invar(0,0)));
+  EXPECT_EQ(file.vectors(Invar(1,2)), m); // in place
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(file.vectors(Invar(1,2)).data()) % block_file_alignment, 0);
+  const auto eig = file.eigen(Invar(1,2));
+  EXPECT_EQ(eig.values.all_rel(), diag[Invar(1,2)].values.all_rel());
+  EXPECT_EQ(eig.vectors.get(), m);
+  EXPECT_EQ(eig.getdim(), 3);
+  EXPECT_THROW(UnitaryFile<std::complex<double>>(workdir.read("unitary_test")), std::runtime_error); // wrong data type
+  workdir.remove("unitary_test");
+  workdir.set_memory_budget(1024 * 1024);
+  UnitaryFile<double>::save(workdir, "unitary_test", diag);
+  EXPECT_EQ(workdir.statistics().disk_written, workdir.statistics().mem_written); // same file size
+  EXPECT_EQ(UnitaryFile<double>(workdir.read("unitary_test")).vectors(Invar(1,2)), m);
+  workdir.remove("unitary_test");
+  EXPECT_FALSE(workdir.exists("unitary_test"));
+}
+
 int main(int argc, char **argv) {
    ::testing::InitGoogleTest(&argc, argv);
    return RUN_ALL_TESTS(); // NOLINT
@@ -1,3 +1,4 @@
+#include <thread>
 #include <gtest/gtest.h>
 
 // Use the matrix backend settings from traits.hpp
@@ -526,6 +527,74 @@ TEST(numerics, rotate) {
   EXPECT_TRUE(r.isApprox(ref));
 }
 
+TEST(numerics, transform_lower) {
+  using cmpl = std::complex<double>;
+  NRG::EigenMatrix<cmpl> a(3,2), o(2,2);
+  a << cmpl(1,1), 2, 0, cmpl(0,-1), 3, 1;
+  o << 1, cmpl(2,1), cmpl(2,-1), -1;
+  auto r = NRG::zero_matrix<cmpl>(3,3);
+  transform_lower<cmpl>(r, 0.5, a, o);
+  hermitian_mirror(r);
+  const NRG::EigenMatrix<cmpl> ref = 0.5 * a * o * a.adjoint();
+  EXPECT_TRUE(r.isApprox(ref));
+  EXPECT_TRUE(NRG::is_hermitian(r));
+}
+
+TEST(numerics, rotate_lower) {
+  using cmpl = std::complex<double>;
+  NRG::EigenMatrix<cmpl> u(3,2), o(3,3);
+  u << cmpl(1,1), 2, 0, cmpl(0,-1), 3, 1;
+  o << 1, cmpl(2,1), 0, cmpl(2,-1), -1, 3, 0, 3, 2;
+  auto r = NRG::zero_matrix<cmpl>(2,2);
+  rotate_lower<cmpl>(r, 2.0, u, o);
+  hermitian_mirror(r);
+  const NRG::EigenMatrix<cmpl> ref = 2.0 * u.adjoint() * o * u;
+  EXPECT_TRUE(r.isApprox(ref));
+  EXPECT_FALSE(NRG::is_hermitian(u));
+}
+
+TEST(numerics, blas_gemm) {
+  using cmpl = std::complex<double>;
+  const NRG::EigenMatrix<cmpl> a0 = NRG::EigenMatrix<cmpl>::Random(5,6), b0 = NRG::EigenMatrix<cmpl>::Random(5,6);
+  const auto a = a0.block(1, 2, 3, 4); // strided blocks
+  const auto b = b0.block(0, 1, 5, 4);
+  NRG::EigenMatrix<cmpl> c1 = NRG::EigenMatrix<cmpl>::Random(4,7), c2 = c1;
+  blas_gemm<GemmOp::N, GemmOp::H>(c1.block(1, 1, 3, 5), cmpl(2,1), a, b, cmpl(0.5));
+  eigen_gemm<GemmOp::N, GemmOp::H>(c2.block(1, 1, 3, 5), cmpl(2,1), a, b, cmpl(0.5));
+  EXPECT_TRUE(c1.isApprox(c2));
+  blas_gemm<GemmOp::H, GemmOp::N>(c1.block(0, 0, 4, 4), cmpl(1), a, a, cmpl(0));
+  eigen_gemm<GemmOp::H, GemmOp::N>(c2.block(0, 0, 4, 4), cmpl(1), a, a, cmpl(0));
+  EXPECT_TRUE(c1.isApprox(c2));
+  const NRG::EigenMatrix<double> d = NRG::EigenMatrix<double>::Random(3,3);
+  NRG::EigenMatrix<double> r1(3,3), r2(3,3);
+  blas_gemm<GemmOp::N, GemmOp::N>(r1, 1.0, d, d, 0.0);
+  eigen_gemm<GemmOp::N, GemmOp::N>(r2, 1.0, d, d, 0.0);
+  EXPECT_TRUE(r1.isApprox(r2));
+}
+
+TEST(numerics, gemm_lower) {
+  using cmpl = std::complex<double>;
+  const NRG::EigenMatrix<cmpl> a = NRG::EigenMatrix<cmpl>::Random(150,40), b = NRG::EigenMatrix<cmpl>::Random(150,40);
+  NRG::EigenMatrix<cmpl> c = NRG::EigenMatrix<cmpl>::Random(150,150);
+  const NRG::EigenMatrix<cmpl> ref = c + cmpl(2,1) * a * b.adjoint();
+  gemm_lower<GemmOp::N, GemmOp::H>(c, cmpl(2,1), a, b); // several panels
+  EXPECT_TRUE(c.triangularView<Eigen::Lower>().toDenseMatrix().isApprox(ref.triangularView<Eigen::Lower>().toDenseMatrix()));
+  NRG::EigenMatrix<cmpl> d = NRG::EigenMatrix<cmpl>::Zero(40,40);
+  gemm_lower<GemmOp::H, GemmOp::N>(d, cmpl(1), a, a);
+  hermitian_mirror(d);
+  EXPECT_TRUE(d.isApprox(a.adjoint() * a));
+}
+
+TEST(numerics, release_scratch) {
+  auto a = scratch_matrix<double>(100, 100);
+  a.setOnes();
+  std::thread([] { scratch_matrix<double>(10, 10).setZero(); }).join(); // thread exit unregisters the buffer
+  release_scratch();
+  auto b = scratch_matrix<double>(3, 2);
+  b.setConstant(2.0);
+  EXPECT_EQ(b.sum(), 12.0);
+}
+
 TEST(numerics, matrix_prod) {
   auto a = generate_matrix<double>(2,2);
   auto b = generate_matrix<double>(2,2);
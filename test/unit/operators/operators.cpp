@@ -52,6 +52,40 @@ TEST(Operators, MatrixElements) { // NOLINT
   }
 }
 
+TEST(Operators, MatrixElements_norms) { // NOLINT
+  Params P;
+  auto SymSP = setup_Sym<double>(P);
+  auto Sym = SymSP.get();
+  auto diag = setup_diag<double>(P, Sym);
+  std::string str =
+    "2\n"
+    "0 1 0 1\n"
+    "3 0\n 0 4\n"
+    "1 2 1 2\n"
+    "0 0 0\n 0 0 0\n 0 0 0\n";
+  std::istringstream ss(str);
+  auto me = MatrixElements(ss, diag);
+  const Twoinvar II1 = {Invar(0,1), Invar(0,1)}, II2 = {Invar(1,2), Invar(1,2)};
+  EXPECT_DOUBLE_EQ(me.norm(II1), 5.0);
+  EXPECT_TRUE(me.is_zero(II2));
+  me[II2](0,0) = 1.0;
+  EXPECT_TRUE(me.is_zero(II2)); // stale until update_metadata()
+  me.update_metadata();
+  EXPECT_FALSE(me.is_zero(II2));
+  EXPECT_EQ(me.norm({Invar(0,1), Invar(1,2)}), std::numeric_limits<double>::infinity());
+  EXPECT_FALSE(me.is_hermitian(II1)); // not known to be a Hermitian operator
+  EXPECT_TRUE(me.check_hermitian());
+  me.set_hermitian(true);
+  me.update_metadata();
+  EXPECT_TRUE(me.is_hermitian(II1));
+  EXPECT_FALSE(me.is_hermitian({Invar(0,1), Invar(1,2)}));
+  me[II1](0,1) = 1.0;
+  EXPECT_FALSE(me.check_hermitian());
+  me.set_hermitian(false);
+  me.update_metadata();
+  EXPECT_FALSE(me.is_hermitian(II1));
+}
+
 TEST(Operators, Opch_empty) { // NOLINT
   Params P;
   auto SymSP = setup_Sym<double>(P);
@@ -84,6 +118,37 @@ TEST(Operators, Opch_clean) { // NOLINT
   o.dump();
 }
 
+TEST(Operators, Opch_serialize) { // NOLINT
+  Params P;
+  auto SymSP = setup_Sym<double>(P);
+  auto Sym = SymSP.get();
+  auto diag = setup_diag_clean<double>(P, Sym);
+  std::string str =
+    "f 0 0\n"
+    "2\n"
+    "1 1 0 2\n"
+    "1.4142135623730951\n"
+    "0 2 -1 1\n"
+    "1.\n";
+  std::istringstream ss(str);
+  const auto o = Opch<double>(ss, diag, P);
+  std::stringstream buf;
+  {
+    boost::archive::binary_oarchive oa(buf);
+    oa << o;
+  }
+  Opch<double> o2;
+  {
+    boost::archive::binary_iarchive ia(buf);
+    ia >> o2;
+  }
+  ASSERT_EQ(o2.size(), o.size());
+  ASSERT_EQ(o2[0].size(), o[0].size());
+  ASSERT_EQ(o2[0][0].size(), o[0][0].size());
+  for (const auto &[II, mat] : o[0][0])
+    EXPECT_EQ(o2[0][0].at(II), mat);
+}
+
 int main(int argc, char **argv) {
    ::testing::InitGoogleTest(&argc, argv);
    return RUN_ALL_TESTS(); // NOLINT
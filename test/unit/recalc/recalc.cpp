@@ -14,6 +14,46 @@ TEST(recalc, split_in_blocks_Eigen) { // NOLINT
 #endif
 }
 
+TEST(recalc, make_recalc_plan) { // NOLINT
+  using Term = RecalcPlan::Term;
+  // Two terms with the same ket block and a large ket subspace: sum up A O first, then multiply by B^\dag once
+  {
+    const auto plan = make_recalc_plan(10, 100, {Term{0, 1, 1, 5, 5}, Term{1, 2, 1, 5, 5}});
+    EXPECT_EQ(plan.grouping, RecalcGrouping::ip);
+    EXPECT_DOUBLE_EQ(plan.naive, 2*(10*5*5 + 10*5*100));
+    EXPECT_DOUBLE_EQ(plan.cost, 2*10*5*5 + 10*5*100);
+  }
+  // Same with the roles of bra and ket exchanged
+  {
+    const auto plan = make_recalc_plan(100, 10, {Term{0, 1, 1, 5, 5}, Term{1, 1, 2, 5, 5}});
+    EXPECT_EQ(plan.grouping, RecalcGrouping::i1);
+    EXPECT_DOUBLE_EQ(plan.cost, 2*5*5*10 + 100*5*10);
+  }
+  // No shared blocks: only the multiplication order is optimized
+  {
+    const auto plan = make_recalc_plan(100, 10, {Term{0, 1, 1, 5, 50}, Term{1, 2, 2, 50, 5}});
+    EXPECT_EQ(plan.grouping, RecalcGrouping::none);
+    EXPECT_EQ(plan.terms[0].order, RecalcOrder::right);
+    EXPECT_EQ(plan.terms[1].order, RecalcOrder::left);
+    EXPECT_LT(plan.cost, plan.naive);
+  }
+}
+
+TEST(recalc, RecalcPlanner) { // NOLINT
+  using Term = RecalcPlan::Term;
+  RecalcPlanner planner;
+  const Invar I1(0, 1), Ip(1, 2), Iop(1, 2);
+  const std::vector<Term> terms = {Term{0, 1, 1, 5, 5}, Term{1, 2, 1, 5, 5}};
+  const auto p1 = planner.plan(I1, Ip, Iop, 10, 100, terms);
+  const auto p2 = planner.plan(I1, Ip, Iop, 10, 100, terms);
+  EXPECT_EQ(p1, p2); // reused
+  const auto p3 = planner.plan(I1, Ip, Iop, 11, 100, terms);
+  EXPECT_NE(p1, p3); // dimensions changed
+  planner.clear();
+  const auto p4 = planner.plan(I1, Ip, Iop, 11, 100, terms);
+  EXPECT_NE(p3, p4);
+}
+
 int main(int argc, char **argv) {
    ::testing::InitGoogleTest(&argc, argv);
    return RUN_ALL_TESTS(); // NOLINT
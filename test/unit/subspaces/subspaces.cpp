@@ -23,6 +23,43 @@ TEST(Subspaces, SubspaceStructure) { // NOLINT
   EXPECT_EQ(substruct.at_or_null(Invar(0,0)).total(), 0);
 }
 
+TEST(Subspaces, ancestor_id) { // NOLINT
+  Params P;
+  auto SymSP = setup_Sym<double>(P);
+  auto Sym = SymSP.get();
+  auto diag = setup_diag(P, Sym);
+  SubspaceStructure substruct{diag, Sym};
+  EXPECT_EQ(substruct.nr_prev(), diag.size());
+  for (const auto &[I, sub] : substruct)
+    for (size_t i = 0; i < sub.combs(); i++) {
+      const auto id = sub.ancestor_id(i);
+      if (diag.count(sub.ancestor(i)))
+        EXPECT_EQ(size_t(std::distance(diag.begin(), diag.find(sub.ancestor(i)))), id);
+      else
+        EXPECT_EQ(id, SubspaceStructure::npos);
+    }
+}
+
+TEST(Subspaces, TaskList_subset) { // NOLINT
+  Params P;
+  auto SymSP = setup_Sym<double>(P);
+  auto Sym = SymSP.get();
+  auto diag = setup_diag(P, Sym);
+  SubspaceStructure substruct{diag, Sym};
+  TaskList tasklist{substruct};
+  const auto tasks = tasklist.get();
+  ASSERT_GE(tasks.size(), 2);
+  const std::vector<Invar> subset = { tasks.back(), tasks.front() };
+  const auto sub = tasklist.get(subset);
+  ASSERT_EQ(sub.size(), 2);
+  EXPECT_EQ(sub[0], tasks.front()); // order of the full list is preserved
+  EXPECT_EQ(sub[1], tasks.back());
+  const auto cost_front = std::pow(double(substruct.at_or_null(tasks.front()).total()), 3);
+  const auto cost_back = std::pow(double(substruct.at_or_null(tasks.back()).total()), 3);
+  EXPECT_DOUBLE_EQ(tasklist.cost(subset), cost_front + cost_back);
+  EXPECT_GE(tasklist.cost(), tasklist.cost(subset));
+}
+
 TEST(Subspaces, SubspaceDimensions) { // NOLINT
   Params P;
   auto SymSP = setup_Sym<double>(P);
@@ -49,6 +86,26 @@ TEST(Subspaces, SubspaceDimensions) { // NOLINT
   EXPECT_EQ(sd.chunk(2), std::make_pair(2ul,3ul));
   EXPECT_EQ(sd.chunk(3), std::make_pair(5ul,4ul));
   EXPECT_EQ(sd.total(), 9);
+  EXPECT_EQ(sd.ancestor(1), Invar(1,2));
+  EXPECT_EQ(&sd.ancestor(2), &sd.ancestor(2)); // no copy
+}
+
+TEST(Subspaces, Subs) { // NOLINT
+  Params P;
+  auto SymSP = setup_Sym<double>(P);
+  auto Sym = SymSP.get();
+  auto diag = setup_diag(P, Sym);
+  SubspaceStructure substruct{diag, Sym};
+  Subs<double> subs(diag, substruct, false);
+  ASSERT_EQ(subs.size(), diag.size());
+  for (const auto &[I, eig] : diag) {
+    const auto &sub = subs.at(I);
+    EXPECT_EQ(sub.kept(), eig.getnrkept());
+    EXPECT_EQ(sub.total(), eig.getdim());
+    EXPECT_EQ(sub.values.all_rel(), eig.values.all_rel());
+    EXPECT_EQ(sub.all().size(), 0); // not last step, all states kept
+  }
+  EXPECT_EQ(subs.bytes(), subs.at(Invar(0,1)).bytes() + subs.at(Invar(1,2)).bytes());
 }
 
 int main(int argc, char **argv) {
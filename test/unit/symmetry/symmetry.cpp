@@ -41,6 +41,28 @@ TEST(Symmetry, Symmetry) { // NOLINT
   EXPECT_EQ(Sym->mult(Invar(1,2)), 2);
 }
 
+TEST(Symmetry, spectrum_blocks) { // NOLINT
+  Params P;
+  auto Sym = set_symmetry<double>(P, "QS", 1);
+  auto diag = setup_diag(P, Sym.get());
+  MatrixElements<double> d;
+  d[{Invar(1,2), Invar(0,1)}] = zero_matrix<double>(3, 2);
+  MatrixElements<double> s = d;
+  s[{Invar(0,1), Invar(0,1)}] = zero_matrix<double>(2, 2);
+  const auto corr = Sym->spectrum_blocks(diag, s, s, SpecFactor::correlator, 0);
+  ASSERT_EQ(corr.size(), 2);
+  EXPECT_EQ(*corr[0].Ii, Invar(0,1)); // same order as in a double loop over the subspaces
+  EXPECT_EQ(*corr[0].Ij, Invar(0,1));
+  EXPECT_EQ(corr[0].factor, 1.0);     // multiplicity of Ij
+  EXPECT_EQ(*corr[1].Ij, Invar(1,2));
+  EXPECT_EQ(corr[1].factor, 2.0);
+  EXPECT_EQ(Sym->spectrum_blocks(diag, s, d, SpecFactor::correlator, 0).size(), 1); // only blocks present in both
+  const auto spec = Sym->spectrum_blocks(diag, d, d, SpecFactor::specdens, 0);
+  ASSERT_EQ(spec.size(), 1);
+  EXPECT_EQ(spec[0].factor, Sym->specdens_factor(Invar(0,1), Invar(1,2)));
+  EXPECT_EQ(spec[0].m1, &d.begin()->second);
+}
+
 int main(int argc, char **argv) {
    ::testing::InitGoogleTest(&argc, argv);
    return RUN_ALL_TESTS(); // NOLINT
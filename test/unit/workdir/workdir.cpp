@@ -1,6 +1,7 @@
 #include <string>
 using namespace std::string_literals;
 #include <gtest/gtest.h>
+#include <fstream>
 #include <workdir.hpp>
 
 using namespace NRG;
@@ -17,6 +18,73 @@ TEST(workdir, dtemp) {
   EXPECT_EQ(workdir.get().size(), 8); // ./XXXXXX
 }
 
+static std::string contents(const FileData &f) { return {f.data(), f.size()}; }
+
+static auto writer(const std::string &s) {
+  return [s](std::ostream &F) { F << s; };
+}
+
+TEST(workdir, disk) {
+  Workdir workdir(".", true);
+  const auto fn = workdir.get() + "/file";
+  workdir.write(fn, 3, writer("abc"));
+  EXPECT_TRUE(workdir.exists(fn));
+  EXPECT_TRUE(std::ifstream(fn).good()); // no budget, on disk
+  EXPECT_EQ(contents(*workdir.read(fn)), "abc");
+  EXPECT_EQ(workdir.statistics().disk_written, 3);
+  EXPECT_EQ(workdir.statistics().disk_read, 3);
+  EXPECT_EQ(workdir.remove(fn), 0);
+  EXPECT_FALSE(workdir.exists(fn));
+}
+
+TEST(workdir, overwrite) {
+  Workdir workdir(".", true);
+  const auto fn = workdir.get() + "/file";
+  workdir.write(fn, 3, writer("abc"));
+  const auto old = workdir.read(fn); // mapped
+  workdir.write(fn, 5, writer("defgh"));
+  EXPECT_EQ(contents(*old), "abc"); // not truncated
+  EXPECT_EQ(contents(*workdir.read(fn)), "defgh");
+  EXPECT_FALSE(std::ifstream(fn + ".tmp").good());
+  workdir.set_memory_budget(10);
+  workdir.write(fn, 3, writer("xyz")); // to memory, the older version on disk is removed
+  EXPECT_FALSE(std::ifstream(fn).good());
+  EXPECT_EQ(contents(*workdir.read(fn)), "xyz");
+  EXPECT_EQ(workdir.remove(fn), 0);
+  EXPECT_FALSE(workdir.exists(fn));
+}
+
+TEST(workdir, memory) {
+  Workdir workdir(".", true);
+  workdir.set_memory_budget(10);
+  const auto fn1 = workdir.get() + "/file1", fn2 = workdir.get() + "/file2", fn3 = workdir.get() + "/file3";
+  workdir.write(fn1, 4, writer("1111"));
+  workdir.write(fn2, 4, writer("2222"));
+  EXPECT_FALSE(std::ifstream(fn1).good()); // in memory only
+  EXPECT_TRUE(workdir.exists(fn1));
+  const auto f1 = workdir.read(fn1); // fn2 is now the least recently used
+  workdir.write(fn3, 4, writer("3333"));
+  EXPECT_TRUE(std::ifstream(fn2).good()); // spilled
+  EXPECT_FALSE(std::ifstream(fn1).good());
+  EXPECT_EQ(contents(*workdir.read(fn2)), "2222");
+  EXPECT_EQ(contents(*f1), "1111");
+  workdir.write(workdir.get() + "/big", 20, writer(std::string(20, 'x'))); // over the budget
+  EXPECT_TRUE(std::ifstream(workdir.get() + "/big").good());
+  const auto stats = workdir.statistics();
+  EXPECT_EQ(stats.mem_written, 12);
+  EXPECT_EQ(stats.disk_written, 20);
+  EXPECT_EQ(stats.spilled, 4);
+  EXPECT_EQ(stats.mem_read, 4);
+  EXPECT_EQ(stats.disk_read, 4);
+  EXPECT_EQ(stats.peak, 8);
+  EXPECT_EQ(workdir.remove(fn1), 0);
+  EXPECT_EQ(workdir.remove(fn2), 0);
+  EXPECT_EQ(workdir.remove(workdir.get() + "/big"), 0);
+  workdir.flush(); // fn3 left in memory
+  EXPECT_EQ(contents(MappedFile(fn3)), "3333");
+  EXPECT_EQ(workdir.remove(fn3), 0);
+}
+
 int main(int argc, char **argv) {
    ::testing::InitGoogleTest(&argc, argv);
    return RUN_ALL_TESTS();
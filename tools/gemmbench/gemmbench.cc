@@ -0,0 +1,93 @@
+// Matrix product benchmark
+// Compares the backends for the matrix products in numerics_Eigen.hpp (see blas_gemm.hpp) on block shapes which are
+// typical for the recalculation of operators, M += f A O B^\dag, where A and B are column blocks of eigenvector
+// matrices. 'expr' is the plain Eigen expression with temporaries, 'eigen' and 'blas' are two gemm calls with a
+// preallocated scratch matrix for the intermediate product A O.
+// Usage: gemmbench [-c] [-r repeats] [-b blocks] [dim1 dim2 ...]
+// agent, agent@local, 2026
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <complex>
+#include <chrono>
+#include <cstdlib>
+#include <unistd.h>
+
+#include <fmt/format.h>
+
+#include "traits.hpp"
+#include "blas_gemm.hpp"
+
+#ifdef CBLAS_WORKAROUND
+ #define ADD_
+ #include "cblas_globals.c"
+ #include "cblas_dgemm.c"
+ #include "cblas_zgemm.c"
+ #include "cblas_xerbla.c"
+#endif
+
+using namespace NRG;
+
+// Average time per call in seconds
+template <typename F> double timeit(const int repeats, F f) {
+  f(); // warm-up, allocates the scratch space
+  const auto start = std::chrono::steady_clock::now();
+  for (int r = 0; r < repeats; r++) f();
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() / repeats;
+}
+
+// The subspace of dimension dim is built from 'blocks' ancestor subspaces of dimension dim/blocks each.
+template <scalar S> void run(const std::vector<size_t> &dims, const int repeats, const size_t blocks) {
+  fmt::print("# {} data, {} blocks, repeats={}\n# dim  r  expr[GF/s]  eigen[GF/s]  blas[GF/s]  maxdiff\n",
+             is_complex<S>::value ? "complex" : "real", blocks, repeats);
+  const auto flop_per_fma = is_complex<S>::value ? 8.0 : 2.0;
+  for (const auto dim : dims) {
+    const auto r = std::max<size_t>(dim / blocks, 1);
+    const EigenMatrix<S> U1 = EigenMatrix<S>::Random(dim, blocks * r), Up = EigenMatrix<S>::Random(dim, blocks * r);
+    const EigenMatrix<S> O = EigenMatrix<S>::Random(r, r);
+    const auto A = U1.middleCols(0, r);
+    const auto B = Up.middleCols(r, r);
+    const S f = 0.5;
+    EigenMatrix<S> M1 = EigenMatrix<S>::Zero(dim, dim), M2 = M1, M3 = M1, T(dim, r);
+    const auto expr = timeit(repeats, [&] { M1 += f * A * O * B.adjoint(); });
+    const auto eigen = timeit(repeats, [&] {
+      eigen_gemm<GemmOp::N, GemmOp::N>(T, S(1), A, O, S(0));
+      eigen_gemm<GemmOp::N, GemmOp::H>(M2, f, T, B, S(1));
+    });
+    const auto blas = timeit(repeats, [&] {
+      blas_gemm<GemmOp::N, GemmOp::N>(T, S(1), A, O, S(0));
+      blas_gemm<GemmOp::N, GemmOp::H>(M3, f, T, B, S(1));
+    });
+    const auto flop = flop_per_fma * (double(dim) * r * r + double(dim) * r * dim);
+    const auto diff = std::max((M1 - M2).cwiseAbs().maxCoeff(), (M1 - M3).cwiseAbs().maxCoeff());
+    fmt::print("{} {} {:.2f} {:.2f} {:.2f} {:.3g}\n", dim, r, flop / expr / 1e9, flop / eigen / 1e9, flop / blas / 1e9, diff);
+  }
+}
+
+void usage(std::ostream &F = std::cout) {
+  F << "Usage: gemmbench [-c] [-r repeats] [-b blocks] [dim1 dim2 ...]" << std::endl;
+}
+
+int main(int argc, char *argv[]) {
+  bool complex  = false;
+  int repeats   = 10;
+  size_t blocks = 4;
+  int c;
+  while ((c = getopt(argc, argv, "hcr:b:")) != -1) {
+    switch (c) {
+      case 'h': usage(); return 0;
+      case 'c': complex = true; break;
+      case 'r': repeats = atoi(optarg); break;
+      case 'b': blocks = size_t(atol(optarg)); break;
+      default: usage(std::cerr); return 1;
+    }
+  }
+  std::vector<size_t> dims;
+  for (int i = optind; i < argc; i++) dims.push_back(size_t(atol(argv[i])));
+  if (dims.empty()) dims = {16, 64, 128, 256, 512, 1024, 2048};
+  if (complex)
+    run<std::complex<double>>(dims, repeats, blocks);
+  else
+    run<double>(dims, repeats, blocks);
+}
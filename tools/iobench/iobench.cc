@@ -0,0 +1,152 @@
+// Workdir file benchmark
+// Compares the write and read throughput of the formats for the density matrix and unitary transformation files:
+// 'boost' is the Boost binary archive with matrices serialized row by row (the format of the rho files before the
+// block files, see numerics_Eigen.hpp), the others are block files (see block_file.hpp) with the codecs from
+// compression.hpp. The data are 'blocks' random matrices of each dimension. Throughput is given in MB/s of
+// uncompressed data; the files are written to and read from the directory 'dir', thus the results for the reads
+// usually reflect the page cache rather than the disk. The reads copy the matrices into memory, as in
+// DensMatElements::load().
+// Usage: iobench [-c] [-r repeats] [-b blocks] [-d dir] [dim1 dim2 ...]
+// agent, agent@local, 2026
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <string>
+#include <complex>
+#include <chrono>
+#include <memory>
+#include <cstdlib>
+#include <cstdio>
+#include <unistd.h>
+
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/serialization/complex.hpp>
+
+#include <fmt/format.h>
+
+#include "traits.hpp"
+#include "block_file.hpp"
+
+using namespace NRG;
+
+// Average time per call in seconds
+template <typename F> double timeit(const int repeats, F f) {
+  f(); // warm-up
+  const auto start = std::chrono::steady_clock::now();
+  for (int r = 0; r < repeats; r++) f();
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() / repeats;
+}
+
+template <scalar S> void boost_write(const std::string &fn, const std::vector<EigenMatrix<S>> &mats) {
+  std::ofstream F(fn, std::ios::binary | std::ios::out);
+  boost::archive::binary_oarchive oa(F);
+  oa << mats.size();
+  for (const auto &m : mats) {
+    oa << size_t(m.rows()) << size_t(m.cols());
+    for (const auto row : m.rowwise()) oa << row;
+  }
+}
+
+template <scalar S> auto boost_read(const std::string &fn) {
+  std::ifstream F(fn, std::ios::binary | std::ios::in);
+  boost::archive::binary_iarchive ia(F);
+  size_t nr, rows, cols;
+  ia >> nr;
+  std::vector<EigenMatrix<S>> mats;
+  for (size_t i = 0; i < nr; i++) {
+    ia >> rows >> cols;
+    auto &m = mats.emplace_back(rows, cols);
+    for (size_t j = 0; j < rows; j++) {
+      EigenMatrix<S> row;
+      ia >> row;
+      m.row(j) = row;
+    }
+  }
+  return mats;
+}
+
+template <scalar S> void block_write(const std::string &fn, const std::vector<EigenMatrix<S>> &mats, const Codec codec) {
+  std::vector<const EigenMatrix<S> *> blocks;
+  for (const auto &m : mats) blocks.push_back(&m);
+  std::ofstream F(fn, std::ios::binary | std::ios::out);
+  write_block_file<S>(F, "", blocks, codec);
+}
+
+template <scalar S> auto block_read(const std::string &fn) {
+  const BlockFile<S> file(std::make_shared<MappedFile>(fn));
+  std::vector<EigenMatrix<S>> mats;
+  for (size_t i = 0; i < file.size(); i++) mats.push_back(file.copy(i));
+  return mats;
+}
+
+template <scalar S> double max_diff(const std::vector<EigenMatrix<S>> &a, const std::vector<EigenMatrix<S>> &b) {
+  double diff = 0;
+  for (size_t i = 0; i < a.size(); i++) diff = std::max(diff, (a[i] - b[i]).cwiseAbs().maxCoeff());
+  return diff;
+}
+
+size_t file_size(const std::string &fn) {
+  std::ifstream F(fn, std::ios::binary | std::ios::ate);
+  return size_t(F.tellg());
+}
+
+template <scalar S> void run(const std::vector<size_t> &dims, const int repeats, const size_t nrblocks, const std::string &dir) {
+  fmt::print("# {} data, {} blocks, repeats={}\n# dim  format  write[MB/s]  read[MB/s]  size[MB]  ratio  maxdiff\n",
+             is_complex<S>::value ? "complex" : "real", nrblocks, repeats);
+  const auto fn = dir + "/iobench.tmp";
+  constexpr double MB = 1024.0 * 1024.0;
+  for (const auto dim : dims) {
+    std::vector<EigenMatrix<S>> mats;
+    for (size_t i = 0; i < nrblocks; i++) mats.push_back(EigenMatrix<S>::Random(dim, dim));
+    const auto raw = double(nrblocks * dim * dim * sizeof(S)) / MB;
+    auto report = [&](const std::string &name, const double write, const double read, const double diff) {
+      const auto size = double(file_size(fn)) / MB;
+      fmt::print("{} {} {:.1f} {:.1f} {:.2f} {:.3f} {:.3g}\n", dim, name, raw / write, raw / read, size, raw / size, diff);
+      std::remove(fn.c_str());
+    };
+    {
+      const auto write = timeit(repeats, [&] { boost_write<S>(fn, mats); });
+      std::vector<EigenMatrix<S>> back;
+      const auto read = timeit(repeats, [&] { back = boost_read<S>(fn); });
+      report("boost", write, read, max_diff(mats, back));
+    }
+    for (const auto codec : {Codec::none, Codec::lossless, Codec::float32}) {
+      const auto write = timeit(repeats, [&] { block_write<S>(fn, mats, codec); });
+      std::vector<EigenMatrix<S>> back;
+      const auto read = timeit(repeats, [&] { back = block_read<S>(fn); });
+      report(to_string(codec), write, read, max_diff(mats, back));
+    }
+  }
+}
+
+void usage(std::ostream &F = std::cout) {
+  F << "Usage: iobench [-c] [-r repeats] [-b blocks] [-d dir] [dim1 dim2 ...]" << std::endl;
+}
+
+int main(int argc, char *argv[]) {
+  bool complex    = false;
+  int repeats     = 3;
+  size_t blocks   = 4;
+  std::string dir = ".";
+  int c;
+  while ((c = getopt(argc, argv, "hcr:b:d:")) != -1) {
+    switch (c) {
+      case 'h': usage(); return 0;
+      case 'c': complex = true; break;
+      case 'r': repeats = atoi(optarg); break;
+      case 'b': blocks = size_t(atol(optarg)); break;
+      case 'd': dir = optarg; break;
+      default: usage(std::cerr); return 1;
+    }
+  }
+  std::vector<size_t> dims;
+  for (int i = optind; i < argc; i++) dims.push_back(size_t(atol(argv[i])));
+  if (dims.empty()) dims = {64, 256, 1024, 2048};
+  if (complex)
+    run<std::complex<double>>(dims, repeats, blocks, dir);
+  else
+    run<double>(dims, repeats, blocks, dir);
+}
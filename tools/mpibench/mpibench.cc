@@ -0,0 +1,113 @@
+// MPI matrix transfer benchmark
+// Measures the throughput of the matrix transfer used by the MPI diagonalisation engine (chunked nonblocking
+// transfer, see mpi_transfer.hpp) and compares it with the row-by-row transfer with blocking sends.
+// Usage: mpirun -np 2 mpibench [-c] [-r repeats] [-k chunk_MB] [dim1 dim2 ...]
+// agent, agent@local, 2026
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <complex>
+#include <cstdlib>
+#include <unistd.h>
+
+#ifdef OMPI_SKIP_MPICXX // workaround to avoid warnings for for redefinition in mpi/environment.hpp
+ #undef OMPI_SKIP_MPICXX
+#endif
+#include <boost/mpi/environment.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/timer.hpp>
+#include <boost/serialization/complex.hpp> // row-by-row transfer of complex data
+
+#include <fmt/format.h>
+
+#include "traits.hpp"
+#include "mpi_transfer.hpp"
+
+using namespace NRG;
+
+enum TAG : int { TAG_SIZE = 1, TAG_DATA, TAG_ROW };
+
+// Send matrix row by row with blocking operations, as in the original DiagMPI implementation.
+template <scalar S> void send_rows(boost::mpi::communicator &comm, const int dest, const EigenMatrix<S> &m) {
+  const std::array<size_t, 2> dims = {size1(m), size2(m)};
+  comm.send(dest, TAG_SIZE, dims.data(), 2);
+  for (size_t i = 0; i < dims[0]; i++) comm.send(dest, TAG_ROW, m.data() + i * dims[1], int(dims[1]));
+}
+
+template <scalar S> auto recv_rows(boost::mpi::communicator &comm, const int source) {
+  std::array<size_t, 2> dims{};
+  comm.recv(source, TAG_SIZE, dims.data(), 2);
+  EigenMatrix<S> m(dims[0], dims[1]);
+  for (size_t i = 0; i < dims[0]; i++) comm.recv(source, TAG_ROW, m.data() + i * dims[1], int(dims[1]));
+  return m;
+}
+
+// Ping-pong between ranks 0 and 1. Returns the throughput in MB/s (rank 0 only).
+template <scalar S, typename SEND, typename RECV>
+double pingpong(boost::mpi::communicator &comm, const size_t dim, const int repeats, SEND send, RECV recv) {
+  EigenMatrix<S> m = EigenMatrix<S>::Random(dim, dim);
+  comm.barrier();
+  boost::mpi::timer t;
+  for (int r = 0; r < repeats; r++) {
+    if (comm.rank() == 0) {
+      send(m, 1);
+      m = recv(1);
+    } else if (comm.rank() == 1) {
+      m = recv(0);
+      send(m, 0);
+    }
+  }
+  const double elapsed = t.elapsed();
+  const double bytes = 2.0 * repeats * double(dim) * double(dim) * sizeof(S);
+  return bytes / elapsed / 1e6;
+}
+
+template <scalar S> void run(boost::mpi::communicator &comm, const std::vector<size_t> &dims, const int repeats, const size_t chunk_bytes) {
+  if (comm.rank() == 0)
+    fmt::print("# {} data, chunk={} MB, repeats={}\n# dim  MB  rows[MB/s]  chunked[MB/s]\n",
+               is_complex<S>::value ? "complex" : "real", chunk_bytes >> 20, repeats);
+  for (const auto dim : dims) {
+    const auto rows = pingpong<S>(comm, dim, repeats,
+                                  [&comm](const auto &m, const int dest) { send_rows<S>(comm, dest, m); },
+                                  [&comm](const int source) { return recv_rows<S>(comm, source); });
+    const auto chunked = pingpong<S>(comm, dim, repeats,
+                                     [&comm, chunk_bytes](const auto &m, const int dest) { send_matrix<S>(comm, dest, TAG_SIZE, TAG_DATA, m, chunk_bytes); },
+                                     [&comm, chunk_bytes](const int source) { return recv_matrix<S>(comm, source, TAG_SIZE, TAG_DATA, chunk_bytes); });
+    if (comm.rank() == 0)
+      fmt::print("{} {:.1f} {:.1f} {:.1f}\n", dim, double(dim) * double(dim) * sizeof(S) / 1e6, rows, chunked);
+  }
+}
+
+void usage(std::ostream &F = std::cout) {
+  F << "Usage: mpirun -np 2 mpibench [-c] [-r repeats] [-k chunk_MB] [dim1 dim2 ...]" << std::endl;
+}
+
+int main(int argc, char *argv[]) {
+  boost::mpi::environment env(argc, argv);
+  boost::mpi::communicator comm;
+  bool complex  = false;
+  int repeats   = 5;
+  size_t chunk_bytes = mpi_chunk_bytes;
+  int c;
+  while ((c = getopt(argc, argv, "hcr:k:")) != -1) {
+    switch (c) {
+      case 'h': usage(); return 0;
+      case 'c': complex = true; break;
+      case 'r': repeats = atoi(optarg); break;
+      case 'k': chunk_bytes = size_t(atol(optarg)) << 20; break;
+      default: usage(std::cerr); return 1;
+    }
+  }
+  std::vector<size_t> dims;
+  for (int i = optind; i < argc; i++) dims.push_back(size_t(atol(argv[i])));
+  if (dims.empty()) dims = {100, 500, 1000, 2000, 5000, 10000};
+  if (comm.size() < 2) {
+    if (comm.rank() == 0) std::cerr << "At least two MPI ranks are required." << std::endl;
+    return 1;
+  }
+  if (complex)
+    run<std::complex<double>>(comm, dims, repeats, chunk_bytes);
+  else
+    run<double>(comm, dims, repeats, chunk_bytes);
+}